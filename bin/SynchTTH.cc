@@ -9,6 +9,7 @@
 #include <algorithm> // std::for_each(), std::accumulate(), std::set_union()
 #include <sstream> // std::stringstream
 #include <iterator> // std::back_inserter()
+#include <initializer_list> // std::initializer_list<>
 
 #include "FWCore/ParameterSet/interface/ParameterSet.h" // edm::ParameterSet
 #include "FWCore/PythonParameterSet/interface/MakeParameterSets.h" // edm::readPSetsFrom()
@@ -43,6 +44,8 @@
 #include "tthAnalysis/HiggsToTauTau/interface/GenLeptonReader.h" // GenLeptonReader
 #include "tthAnalysis/HiggsToTauTau/interface/GenHadTauReader.h" // GenHadTauReader
 #include "tthAnalysis/HiggsToTauTau/interface/GenJetReader.h" // GenJetReader
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource
+#include "tthAnalysis/HiggsToTauTau/interface/CutFlowTable.h" // CutFlowTable
 #include "tthAnalysis/HiggsToTauTau/interface/convert_to_ptrs.h" // convert_to_ptrs
 #include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionSelector.h" // RecoElectronSelectorLoose, RecoElectronSelectorTight, RecoMuonSelectorLoose, RecoMuonSelectorTight, RecoHadTauSelector
 
@@ -173,9 +176,10 @@ bool isHigherPt_ptr(const GenParticle* particle1, const GenParticle* particle2)
  *        |
  *        |---- ttH/
  *        |     |
- *        |     |---- histograms.root (contains all histograms for this sample)
- *        |     |---- log.txt         (log file about file i/o and progress)
- *        |     |---- table.txt       (the results)
+ *        |     |---- histograms.root  (contains all histograms for this sample)
+ *        |     |---- log.txt          (log file about file i/o and progress)
+ *        |     |---- table.txt        (the results)
+ *        |     |---- cutFlowTable.txt (weighted event yields and CPU time per cut)
  *        |
  *        |---- ZZ/
  *        |     |---- histograms.root
@@ -187,6 +191,8 @@ bool isHigherPt_ptr(const GenParticle* particle1, const GenParticle* particle2)
  * The file `table.txt` is later needed by Python scripts which do the parsing;
  * the file contains semicolon-separated cut labels (e.g. "lepton mva" or
  * "Z veto") and corresponding event yield.
+ * The file `cutFlowTable.txt` contains one line per channel and cut, in the format
+ * written by CutFlowTable::write.
  */
 int
 main(int argc,
@@ -361,161 +367,182 @@ main(int argc,
     {ch::_1l_2tau, "1l2tau"}
   };
 
-//--- set up event counter for each channel
-  std::map<ch, std::map<cuts, Long64_t>> counter =
+//--- set up cut-flow table for each channel,
+//    with the cuts listed in the order in which they are applied
+  const std::map<ch, std::vector<cuts>> cuts_channel =
   {
     {ch::ee,
       {
-        {cuts::entry_point,     0},
-        {cuts::PS,              0},
-        {cuts::good_leptons,    0},
-        {cuts::dangling,        0},
-        {cuts::min_dilep_mass,  0},
-        {cuts::pT2010,          0},
-        {cuts::j2_plus,         0},
-        {cuts::bjet_2l_1m,      0}, // common end
-        {cuts::conv_veto,       0},
-        {cuts::lost_hits_0,     0},
-        {cuts::ele_id,          0},
-        {cuts::rel_iso_01,      0},
-        {cuts::sip3d_4,         0},
-        {cuts::tight_mva,       0},
-        {cuts::ss,              0},
-        {cuts::j4_plus,         0},
-        {cuts::met_ld_02,       0},
-        {cuts::pT2020,          0},
-        {cuts::ht_l1l2_met_100, 0},
-        {cuts::zveto,           0},
-        {cuts::charge_quality,  0}
+        cuts::entry_point,
+        cuts::PS,
+        cuts::good_leptons,
+        cuts::dangling,
+        cuts::min_dilep_mass,
+        cuts::pT2010,
+        cuts::j2_plus,
+        cuts::bjet_2l_1m, // common end
+        cuts::conv_veto,
+        cuts::lost_hits_0,
+        cuts::ele_id,
+        cuts::rel_iso_01,
+        cuts::sip3d_4,
+        cuts::tight_mva,
+        cuts::ss,
+        cuts::j4_plus,
+        cuts::met_ld_02,
+        cuts::pT2020,
+        cuts::ht_l1l2_met_100,
+        cuts::zveto,
+        cuts::charge_quality
       }
     },
     {ch::mumu,
       {
-        {cuts::entry_point,     0},
-        {cuts::PS,              0},
-        {cuts::good_leptons,    0},
-        {cuts::dangling,        0},
-        {cuts::min_dilep_mass,  0},
-        {cuts::pT2010,          0},
-        {cuts::j2_plus,         0},
-        {cuts::bjet_2l_1m,      0}, // common end
-        {cuts::medium_mu_id,    0},
-        {cuts::rel_iso_01,      0},
-        {cuts::sip3d_4,         0},
-        {cuts::tight_mva,       0},
-        {cuts::ss,              0},
-        {cuts::j4_plus,         0},
-        {cuts::met_ld_02,       0},
-        {cuts::pT2020,          0},
-        {cuts::ht_l1l2_met_100, 0},
-        {cuts::zveto,           0},
-        {cuts::charge_quality,  0}
+        cuts::entry_point,
+        cuts::PS,
+        cuts::good_leptons,
+        cuts::dangling,
+        cuts::min_dilep_mass,
+        cuts::pT2010,
+        cuts::j2_plus,
+        cuts::bjet_2l_1m, // common end
+        cuts::medium_mu_id,
+        cuts::rel_iso_01,
+        cuts::sip3d_4,
+        cuts::tight_mva,
+        cuts::ss,
+        cuts::j4_plus,
+        cuts::met_ld_02,
+        cuts::pT2020,
+        cuts::ht_l1l2_met_100,
+        cuts::zveto,
+        cuts::charge_quality
       }
     },
     {ch::emu,
       {
-        {cuts::entry_point,     0},
-        {cuts::PS,              0},
-        {cuts::good_leptons,    0},
-        {cuts::dangling,        0},
-        {cuts::min_dilep_mass,  0},
-        {cuts::pT2010,          0},
-        {cuts::j2_plus,         0},
-        {cuts::bjet_2l_1m,      0}, // common end
-        {cuts::medium_mu_id,    0},
-        {cuts::conv_veto,       0},
-        {cuts::lost_hits_0,     0},
-        {cuts::ele_id,          0},
-        {cuts::rel_iso_01,      0},
-        {cuts::sip3d_4,         0},
-        {cuts::tight_mva,       0},
-        {cuts::ss,              0},
-        {cuts::j4_plus,         0},
-        {cuts::met_ld_02,       0},
-        {cuts::pT2020,          0},
-        {cuts::ht_l1l2_met_100, 0},
-        {cuts::zveto,           0},
-        {cuts::charge_quality,  0}
+        cuts::entry_point,
+        cuts::PS,
+        cuts::good_leptons,
+        cuts::dangling,
+        cuts::min_dilep_mass,
+        cuts::pT2010,
+        cuts::j2_plus,
+        cuts::bjet_2l_1m, // common end
+        cuts::medium_mu_id,
+        cuts::conv_veto,
+        cuts::lost_hits_0,
+        cuts::ele_id,
+        cuts::rel_iso_01,
+        cuts::sip3d_4,
+        cuts::tight_mva,
+        cuts::ss,
+        cuts::j4_plus,
+        cuts::met_ld_02,
+        cuts::pT2020,
+        cuts::ht_l1l2_met_100,
+        cuts::zveto,
+        cuts::charge_quality
       }
     },
     {ch::_3l,
       {
-        {cuts::entry_point,       0},
-        {cuts::PS,                0},
-        {cuts::good_leptons,      0},
-        {cuts::dangling,          0},
-        {cuts::min_dilep_mass,    0},
-        {cuts::pT2010,            0},
-        {cuts::j2_plus,           0},
-        {cuts::bjet_2l_1m,        0}, // common end
-        {cuts::medium_mu_id,      0},
-        {cuts::conv_veto,         0},
-        {cuts::lost_hits_0,       0},
-        {cuts::ele_id,            0},
-        {cuts::rel_iso_01,        0},
-        {cuts::sip3d_4,           0},
-        {cuts::tight_mva,         0},
-        {cuts::j4_plus_met_ld_02, 0},
-        {cuts::sfos_zveto,        0}
+        cuts::entry_point,
+        cuts::PS,
+        cuts::good_leptons,
+        cuts::dangling,
+        cuts::min_dilep_mass,
+        cuts::pT2010,
+        cuts::j2_plus,
+        cuts::bjet_2l_1m, // common end
+        cuts::medium_mu_id,
+        cuts::conv_veto,
+        cuts::lost_hits_0,
+        cuts::ele_id,
+        cuts::rel_iso_01,
+        cuts::sip3d_4,
+        cuts::tight_mva,
+        cuts::j4_plus_met_ld_02,
+        cuts::sfos_zveto
       }
     },
     {ch::_4l,
       {
-        {cuts::entry_point,    0},
-        {cuts::PS,             0},
-        {cuts::good_leptons,   0},
-        {cuts::min_dilep_mass, 0},
-        {cuts::pT2010,         0},
-        {cuts::j2_plus,        0},
-        {cuts::bjet_2l_1m,     0}, // common end
-        {cuts::medium_mu_id,   0},
-        {cuts::loose_mva,      0},
-        {cuts::neutral_sum,    0},
-        {cuts::sfos_zveto,     0}
+        cuts::entry_point,
+        cuts::PS,
+        cuts::good_leptons,
+        cuts::min_dilep_mass,
+        cuts::pT2010,
+        cuts::j2_plus,
+        cuts::bjet_2l_1m, // common end
+        cuts::medium_mu_id,
+        cuts::loose_mva,
+        cuts::neutral_sum,
+        cuts::sfos_zveto
       }
     },
     {ch::_2l_1tau,
       {
-        {cuts::entry_point,     0},
-        {cuts::PS,              0},
-        {cuts::good_leptons,    0},
-        {cuts::dangling,        0},
-        {cuts::min_dilep_mass,  0},
-        {cuts::pT2010,          0},
-        {cuts::j2_plus,         0},
-        {cuts::bjet_2l_1m,      0},
-        {cuts::specific_cuts,   0}, // med_mu_id, conv_veto, lost_hits, ele_mva
-        {cuts::rel_iso_01,      0},
-        {cuts::sip3d_4,         0},
-        {cuts::tight_mva,       0},
-        {cuts::ss,              0},
-        {cuts::j4_plus,         0},
-        {cuts::met_ld_02,       0},
-        {cuts::pT2020,          0},
-        {cuts::ht_l1l2_met_100, 0},
-        {cuts::zveto,           0},
-        {cuts::charge_quality,  0},
-        {cuts::good_tau,        0}
-     }
+        cuts::entry_point,
+        cuts::PS,
+        cuts::good_leptons,
+        cuts::dangling,
+        cuts::min_dilep_mass,
+        cuts::pT2010,
+        cuts::j2_plus,
+        cuts::bjet_2l_1m,
+        cuts::specific_cuts, // med_mu_id, conv_veto, lost_hits, ele_mva
+        cuts::rel_iso_01,
+        cuts::sip3d_4,
+        cuts::tight_mva,
+        cuts::ss,
+        cuts::j4_plus,
+        cuts::met_ld_02,
+        cuts::pT2020,
+        cuts::ht_l1l2_met_100,
+        cuts::zveto,
+        cuts::charge_quality,
+        cuts::good_tau
+      }
     },
     {ch::_1l_2tau,
       {
-        {cuts::entry_point,  0},
-        {cuts::PS,           0},
-        {cuts::tight_lepton, 0},
-        {cuts::j2_plus,      0},
-        {cuts::bjet_2l_1m,   0},
-        {cuts::good_tau,     0}
+        cuts::entry_point,
+        cuts::PS,
+        cuts::tight_lepton,
+        cuts::j2_plus,
+        cuts::bjet_2l_1m,
+        cuts::good_tau
       }
     }
   };
+  std::map<ch, CutFlowTable> cutFlow;
+  std::map<ch, std::map<cuts, int>> cutIndices;
+  for(auto & channel: cuts_channel)
+  {
+    CutFlowTable & cutFlow_channel = cutFlow.insert(
+      std::make_pair(channel.first, CutFlowTable(ch_str.at(channel.first)))).first -> second;
+    for(cuts c: channel.second)
+      cutIndices[channel.first][c] = cutFlow_channel.addCut(cuts_str.at(c));
+  }
+  /**
+   * Records the outcome of a cut in the given channels
+   * and returns true if the event passes the cut.
+   */
+  auto apply_cut = [&cutFlow, &cutIndices](std::initializer_list<ch> channels, cuts c,
+                                           bool passes, double evtWeight) -> bool
+  {
+    for(ch channel: channels)
+      cutFlow.at(channel)(cutIndices.at(channel).at(c), passes, evtWeight);
+    return passes;
+  };
   /**
-   * Increments all but 1 lepton + 2 tau channel.
+   * Records the outcome of a cut in all but 1 lepton + 2 tau channel.
    */
-  auto increment_all = [&counter](cuts c)
+  auto apply_cut_all = [&apply_cut](cuts c, bool passes, double evtWeight) -> bool
   {
-    for(auto channel: {ch::ee, ch::mumu, ch::emu, ch::_3l, ch::_4l, ch::_2l_1tau})
-      ++counter[channel][c];
+    return apply_cut({ch::ee, ch::mumu, ch::emu, ch::_3l, ch::_4l, ch::_2l_1tau},
+                     c, passes, evtWeight);
   };
 
 //--- set up the histogram manager
@@ -662,45 +689,47 @@ main(int argc,
   const double mht_coef = 0.00265;
 
 //--- declare the variables
+  EventSource eventSource(&chain);
+
   RUN_TYPE run;
-  chain.SetBranchAddress(RUN_KEY, &run);
+  eventSource.setBranchAddress(RUN_KEY, &run);
   LUMI_TYPE lumi;
-  chain.SetBranchAddress(LUMI_KEY, &lumi);
+  eventSource.setBranchAddress(LUMI_KEY, &lumi);
   EVT_TYPE evt;
-  chain.SetBranchAddress(EVT_KEY, &evt);
+  eventSource.setBranchAddress(EVT_KEY, &evt);
   
   RecoElectronReader* electronReader = new RecoElectronReader("nselLeptons", "selLeptons");
-  electronReader->setBranchAddresses(&chain);
+  electronReader->setBranchAddresses(eventSource);
   RecoElectronCollectionSelectorLoose preselElectronSelector;
   RecoElectronCollectionSelectorTight tightElectronSelector;
   RecoMuonReader* muonReader = new RecoMuonReader("nselLeptons", "selLeptons");
-  muonReader->setBranchAddresses(&chain);
+  muonReader->setBranchAddresses(eventSource);
   RecoMuonCollectionSelectorLoose preselMuonSelector;
   RecoMuonCollectionSelectorTight tightMuonSelector;
   RecoHadTauReader* hadTauReader = new RecoHadTauReader("nTauGood", "TauGood");
-  hadTauReader->setBranchAddresses(&chain);
+  hadTauReader->setBranchAddresses(eventSource);
   RecoHadTauCollectionSelectorTight hadTauSelector;
   RecoJetReader* jetReader = new RecoJetReader("nJet", "Jet");
   jetReader->setBranchName_BtagWeight(jet_btagWeight_branch);
-  jetReader->setBranchAddresses(&chain);
+  jetReader->setBranchAddresses(eventSource);
   RecoJetCollectionSelector jetSelector;
   RecoJetCollectionSelectorBtagLoose jetSelectorBtagLoose;
   RecoJetCollectionSelectorBtagMedium jetSelectorBtagMedium;
 
   MET_PT_TYPE met_pt;
-  chain.SetBranchAddress(MET_PT_KEY, &met_pt);
+  eventSource.setBranchAddress(MET_PT_KEY, &met_pt);
   MET_ETA_TYPE met_eta;
-  chain.SetBranchAddress(MET_ETA_KEY, &met_eta);
+  eventSource.setBranchAddress(MET_ETA_KEY, &met_eta);
   MET_PHI_TYPE met_phi;
-  chain.SetBranchAddress(MET_PHI_KEY, &met_phi);
+  eventSource.setBranchAddress(MET_PHI_KEY, &met_phi);
   LV met_p4(met_pt, met_eta, met_phi, 0.);
 
   GenLeptonReader* genLeptonReader = new GenLeptonReader("nGenLep", "GenLep");
-  genLeptonReader->setBranchAddresses(&chain);
+  genLeptonReader->setBranchAddresses(eventSource);
   GenHadTauReader* genHadTauReader = new GenHadTauReader("nGenHadTaus", "GenHadTaus");
-  genHadTauReader->setBranchAddresses(&chain);
+  genHadTauReader->setBranchAddresses(eventSource);
   GenJetReader* genJetReader = new GenJetReader("nGenJet", "GenJet");
-  genJetReader->setBranchAddresses(&chain);
+  genJetReader->setBranchAddresses(eventSource);
 
 //--- initialize BDTs used to discriminate ttH vs. ttV and ttH vs. ttbar 
 //    in 2lss_1tau category of ttH multilepton analysis
@@ -713,7 +742,8 @@ main(int argc,
   mvaInputVariables_2lss_ttV.push_back("mindr_lep2_jet");
   mvaInputVariables_2lss_ttV.push_back("LepGood_conePt[iF_Recl[0]]");
   mvaInputVariables_2lss_ttV.push_back("LepGood_conePt[iF_Recl[1]]");
-  TMVAInterface mva_2lss_ttV(mvaFileName_2lss_ttV, mvaInputVariables_2lss_ttV, { "iF_Recl[0]", "iF_Recl[1]", "iF_Recl[2]" });
+  TMVAInterface mva_2lss_ttV(mvaFileName_2lss_ttV, mvaInputVariables_2lss_ttV, { "iF_Recl[0]", "iF_Recl[1]", "iF_Recl[2]" },
+                             getMVAInputLayout_2lss());
 
   std::string mvaFileName_2lss_ttbar = "tthAnalysis/HiggsToTauTau/data/2lss_ttbar_BDTG.weights.xml";
   std::vector<std::string> mvaInputVariables_2lss_ttbar;
@@ -724,9 +754,15 @@ main(int argc,
   mvaInputVariables_2lss_ttbar.push_back("min(met_pt,400)");
   mvaInputVariables_2lss_ttbar.push_back("avg_dr_jet");
   mvaInputVariables_2lss_ttbar.push_back("MT_met_lep1");
-  TMVAInterface mva_2lss_ttbar(mvaFileName_2lss_ttbar, mvaInputVariables_2lss_ttbar, { "iF_Recl[0]", "iF_Recl[1]", "iF_Recl[2]" });
+  TMVAInterface mva_2lss_ttbar(mvaFileName_2lss_ttbar, mvaInputVariables_2lss_ttbar, { "iF_Recl[0]", "iF_Recl[1]", "iF_Recl[2]" },
+                               getMVAInputLayout_2lss());
+
+  Float_t mvaInputs[kNumMVAInputs_2lss];
 
-  std::map<std::string, double> mvaInputs;
+//--- disable all branches that are not read by any of the readers,
+//    so that TTree::GetEntry does not unzip them
+  eventSource.getManifest().setBranchStatus(&chain);
+  eventSource.getManifest().print(&chain, std::cout);
 
   Long64_t nof_events = chain.GetEntries();
   log_file << "Total number of events: "
@@ -757,6 +793,8 @@ main(int argc,
     }
 
 //--- get the event
+    for(auto & cutFlow_channel: cutFlow)
+      cutFlow_channel.second.startEvent();
     chain.GetEntry(i);
 
 //--- create the lepton collection
@@ -802,8 +840,8 @@ main(int argc,
     bjets["medium"] = jetSelectorBtagMedium(jet_ptrs);
 
 //------------------------------------------------------------ COUNTER STARTS
-    increment_all(cuts::entry_point);
-    ++counter[ch::_1l_2tau][cuts::entry_point];
+    apply_cut({ch::ee, ch::mumu, ch::emu, ch::_3l, ch::_4l, ch::_2l_1tau, ch::_1l_2tau},
+              cuts::entry_point, true, evtWeight);
 
 //-------------------------------------------------------------- PRESELECTION
     std::vector<const RecoLepton*> preselLeptons;    
@@ -816,35 +854,29 @@ main(int argc,
     tightLeptons.insert(tightLeptons.end(), tightElectrons.begin(), tightElectrons.end());
     tightLeptons.insert(tightLeptons.end(), tightMuons.begin(), tightMuons.end());
 
-    if(preselLeptons.size() == 1)
+    if(apply_cut({ch::_1l_2tau}, cuts::PS, preselLeptons.size() == 1, evtWeight))
     {
 //====================== 2 TAU SINGLE LEPTON CHANNEL =========================
-      ++counter[ch::_1l_2tau][cuts::PS];
 
 //--- single tight lepton
-      if ( !(tightLeptons.size() >= 1) )
+      if ( !apply_cut({ch::_1l_2tau}, cuts::tight_lepton, tightLeptons.size() >= 1, evtWeight) )
         continue;
-      ++counter[ch::_1l_2tau][cuts::tight_lepton];
 
 //--- at least two jets
-      if ( !(selJets.size() >= 2) ) continue;
-      ++counter[ch::_1l_2tau][cuts::j2_plus];
+      if ( !apply_cut({ch::_1l_2tau}, cuts::j2_plus, selJets.size() >= 2, evtWeight) ) continue;
 
 //--- at least two loose bjets or one medium bjet
-      if ( !(bjets["loose"].size() >= 2 || bjets["medium"].size() >= 1) ) continue;
-      ++counter[ch::_1l_2tau][cuts::bjet_2l_1m];
+      if ( !apply_cut({ch::_1l_2tau}, cuts::bjet_2l_1m,
+                      bjets["loose"].size() >= 2 || bjets["medium"].size() >= 1, evtWeight) ) continue;
 
 //--- two good taus
-      if ( !(selHadTaus.size() >= 2) ) continue;
-      ++counter[ch::_1l_2tau][cuts::good_tau];
+      if ( !apply_cut({ch::_1l_2tau}, cuts::good_tau, selHadTaus.size() >= 2, evtWeight) ) continue;
       fill_pdg_plot(genLeptons, genJets, preselLeptons,
 		    &selHadTaus, &genHadTaus, ch::_1l_2tau, false);
 
       continue;
     }
-    else if(preselLeptons.size() == 0) continue;
-
-    increment_all(cuts::PS);
+    if(! apply_cut_all(cuts::PS, preselLeptons.size() >= 2, evtWeight)) continue;
 
 //---------------------------------------------------------- NOF GOOD LEPTONS
 //--- we need to count, how many tight and loose leptons we have
@@ -856,46 +888,38 @@ main(int argc,
     //CV: 4l category not used by ttH multilepton analysis of 2015 data
     //else
     //if(looseLeptons.size() == 4) selLeptons = looseLeptons;
-    else continue;
+    if(! apply_cut_all(cuts::good_leptons, ! selLeptons.empty(), evtWeight)) continue;
 //--- sort selected leptons by decreasing pT
     std::sort(selLeptons.begin(), selLeptons.end(), isHigherPt_ptr);
     const std::size_t nSelLeptons = selLeptons.size();
 
-    increment_all(cuts::good_leptons);
-
 //------------------------------------------------------- DANGLING LEPTON CUT
-    if((nSelLeptons == 2 && preselLeptons.size() != 2) ||
-       (nSelLeptons == 3 && preselLeptons.size() != 3))
+    const bool is_dangling = (nSelLeptons == 2 && preselLeptons.size() != 2) ||
+                             (nSelLeptons == 3 && preselLeptons.size() != 3);
+    if(! apply_cut({ch::ee, ch::emu, ch::mumu, ch::_3l, ch::_2l_1tau},
+                   cuts::dangling, ! is_dangling, evtWeight))
       continue;
 
-    for(ch channel: {ch::ee, ch::emu, ch::mumu, ch::_3l})
-      ++counter[channel][cuts::dangling];
-
 //------------------------------------------ DILEPTON INVARIANT MASS > 12 GeV
     bool proceed = true; // this guy is used throughout the analysis
     for(unsigned j = 0; j < nSelLeptons && proceed; ++j)
       for(unsigned k = 0; k < j && proceed; ++k)
-        if((selLeptons[j]->p4_ + selLeptons[k]->p4_).mass() < 12.0)
+        if((selLeptons[j]->p4() + selLeptons[k]->p4()).mass() < 12.0)
           proceed = false;
-    if(! proceed) continue;
-
-    increment_all(cuts::min_dilep_mass);
+    if(! apply_cut_all(cuts::min_dilep_mass, proceed, evtWeight)) continue;
 
 //-------------------------------------------------------- LEPTON PT > 20, 10
-    if(! (selLeptons[0]->pt_ > 20. &&           // leading lepton
-          selLeptons[1]->pt_ > 10.) ) continue; // subleading lepton
-
-    increment_all(cuts::pT2010);
+    if(! apply_cut_all(cuts::pT2010,
+                       selLeptons[0]->pt_ > 20. &&  // leading lepton
+                       selLeptons[1]->pt_ > 10.,    // subleading lepton
+                       evtWeight)) continue;
 
 //------------------------------------------------ 2+ JETS (>25 GeV)
-    if ( !(selJets.size() >= 2) ) continue;
-
-    increment_all(cuts::j2_plus);
+    if ( !apply_cut_all(cuts::j2_plus, selJets.size() >= 2, evtWeight) ) continue;
 
 //---------------------------------------- 2+ LOOSE B JETS / 1+ MEDIUM B JETS
-    if ( !(bjets["loose"].size() >= 2 || bjets["medium"].size() >= 1) ) continue;
-
-    increment_all(cuts::bjet_2l_1m);
+    if ( !apply_cut_all(cuts::bjet_2l_1m,
+                        bjets["loose"].size() >= 2 || bjets["medium"].size() >= 1, evtWeight) ) continue;
 
 //-------------------------------------------------------------- MEDIUM MU ID
 //--- CV: not neccessary anymore ?
@@ -905,10 +929,8 @@ main(int argc,
     //    proceed = false;
     //    break;
     //  }
-    if(! proceed) continue;
-
-    for(ch channel: {ch::emu, ch::mumu, ch::_3l, ch::_4l})
-      ++counter[channel][cuts::medium_mu_id];
+    if(! apply_cut({ch::emu, ch::mumu, ch::_3l, ch::_4l}, cuts::medium_mu_id, proceed, evtWeight))
+      continue;
 
 //--- tight lepton cuts
     if ( nSelLeptons < 4 )
@@ -921,9 +943,8 @@ main(int argc,
       //    proceed = false;
       //    break;
       //  }
-      if(! proceed) continue;
-      for(ch channel: {ch::ee, ch::emu, ch::_3l})
-        ++counter[channel][cuts::conv_veto];
+      if(! apply_cut({ch::ee, ch::emu, ch::_3l}, cuts::conv_veto, proceed, evtWeight))
+        continue;
 
 //--------------------------------------------------------------- 0 LOST HITS
 //--- CV: not neccessary anymore ?
@@ -933,10 +954,8 @@ main(int argc,
       //    proceed = false;
       //    break;
       //  }
-      if(! proceed) continue;
-
-      for(ch channel: {ch::ee, ch::emu, ch::_3l})
-        ++counter[channel][cuts::lost_hits_0];
+      if(! apply_cut({ch::ee, ch::emu, ch::_3l}, cuts::lost_hits_0, proceed, evtWeight))
+        continue;
 
 //--------------------------------------------------- ELECTRON IDENTIFICATION
 //--- CV: not neccessary anymore ?
@@ -946,12 +965,10 @@ main(int argc,
       //    proceed = false;
       //    break;
       //  }
-      if(! proceed) continue;
-
-      for(ch channel: {ch::ee, ch::emu, ch::_3l})
-        ++counter[channel][cuts::ele_id];
+      if(! apply_cut({ch::ee, ch::emu, ch::_3l}, cuts::ele_id, proceed, evtWeight))
+        continue;
 
-      ++counter[ch::_2l_1tau][cuts::specific_cuts]; // for dilepton + tau
+      apply_cut({ch::_2l_1tau}, cuts::specific_cuts, true, evtWeight); // for dilepton + tau
 
 //-------------------------------------------------- RELATIVE ISOLATION < 0.1
 //--- CV: not neccessary anymore ?
@@ -961,10 +978,8 @@ main(int argc,
       //    proceed = false;
       //    break;
       //  }
-      if(! proceed) continue;
-
-      for(ch channel: {ch::ee, ch::mumu, ch::emu, ch::_3l, ch::_2l_1tau})
-        ++counter[channel][cuts::rel_iso_01];
+      if(! apply_cut({ch::ee, ch::mumu, ch::emu, ch::_3l, ch::_2l_1tau}, cuts::rel_iso_01, proceed, evtWeight))
+        continue;
 
 //--------------------------------------------------------------- SIP3D < 4.0
 //--- CV: not neccessary anymore ?
@@ -974,10 +989,8 @@ main(int argc,
       //    proceed = false;
       //    break;
       //  }
-      if(! proceed) continue;
-
-      for(ch channel: {ch::ee, ch::mumu, ch::emu, ch::_3l, ch::_2l_1tau})
-        ++counter[channel][cuts::sip3d_4];
+      if(! apply_cut({ch::ee, ch::mumu, ch::emu, ch::_3l, ch::_2l_1tau}, cuts::sip3d_4, proceed, evtWeight))
+        continue;
     }
 
 //=========================== DILEPTON CHANNEL ==============================
@@ -993,69 +1006,52 @@ main(int argc,
       else if ( lepton1->is_muon()     && lepton2->is_muon()     ) channel = ch::mumu;
       else                                                         channel = ch::emu;
 
-      ++counter[channel][cuts::tight_mva];
-      ++counter[ch::_2l_1tau][cuts::tight_mva];
+      apply_cut({channel, ch::_2l_1tau}, cuts::tight_mva, true, evtWeight);
 
 //----------------------------------------------------------------- SAME SIGN
-      if ( !(lepton1->pdgId_ * lepton2->pdgId_) > 0 ) continue;
-
-      ++counter[channel][cuts::ss];
-      ++counter[ch::_2l_1tau][cuts::ss];
+      if ( !apply_cut({channel, ch::_2l_1tau}, cuts::ss,
+                      lepton1->pdgId_ * lepton2->pdgId_ > 0, evtWeight) ) continue;
 
 //------------------------------------------------------------------- 4+ JETS
-      if ( !(selJets.size() >= 4) ) continue;
-
-      ++counter[channel][cuts::j4_plus];
-      ++counter[ch::_2l_1tau][cuts::j4_plus];
+      if ( !apply_cut({channel, ch::_2l_1tau}, cuts::j4_plus, selJets.size() >= 4, evtWeight) ) continue;
 
 //-------------------------------------------------------------- MET_LD > 0.2
 //--- calculate MHT
       LV mht_vec(0,0,0,0);
       for ( auto & jet: selJets )
-        mht_vec += jet->p4_;
-      mht_vec += lepton1->p4_ + lepton2->p4_;
+        mht_vec += jet->p4();
+      mht_vec += lepton1->p4() + lepton2->p4();
       const Double_t mht_pt = mht_vec.pt();
       const Double_t met_ld = met_coef * met_pt + mht_coef * mht_pt;
-      if ( !(met_ld >= 0.2) ) continue;
-
-      ++counter[channel][cuts::met_ld_02];
-      ++counter[ch::_2l_1tau][cuts::met_ld_02];
+      if ( !apply_cut({channel, ch::_2l_1tau}, cuts::met_ld_02, met_ld >= 0.2, evtWeight) ) continue;
 
 //-------------------------------------------------------- LEPTON PT > 20, 20
-      if ( !(lepton1->pt_ >= 20. && lepton2->pt_ >= 20.) ) continue;
-
-      ++counter[channel][cuts::pT2020];
-      ++counter[ch::_2l_1tau][cuts::pT2020];
+      if ( !apply_cut({channel, ch::_2l_1tau}, cuts::pT2020,
+                      lepton1->pt_ >= 20. && lepton2->pt_ >= 20., evtWeight) ) continue;
 
 //----------------------------------------- SCALAR SUM(L0, L1, MET) > 100 GeV
-      if ( !(lepton1->pt_ + lepton2->pt_ + met_pt >= 100) ) continue;
-
-      ++counter[channel][cuts::ht_l1l2_met_100];
-      ++counter[ch::_2l_1tau][cuts::ht_l1l2_met_100];
+      if ( !apply_cut({channel, ch::_2l_1tau}, cuts::ht_l1l2_met_100,
+                      lepton1->pt_ + lepton2->pt_ + met_pt >= 100, evtWeight) ) continue;
 
 //-------------------------------------------------------------------- Z VETO
-      if ( std::fabs((lepton1->p4_ + lepton2->p4_).mass() - z_mass) <= z_th ) continue;
-
-      ++counter[channel][cuts::zveto];
-      ++counter[ch::_2l_1tau][cuts::zveto];
+      if ( !apply_cut({channel, ch::_2l_1tau}, cuts::zveto,
+                      std::fabs((lepton1->p4() + lepton2->p4()).mass() - z_mass) > z_th, evtWeight) ) continue;
 
 //-------------------------------------------------------------- TIGHT CHARGE
-      if ( !(lepton1->tightCharge_ >= 2 && lepton2->tightCharge_ >= 2) ) continue;
-
-      ++counter[channel][cuts::charge_quality];
-      ++counter[ch::_2l_1tau][cuts::charge_quality];
+      if ( !apply_cut({channel, ch::_2l_1tau}, cuts::charge_quality,
+                      lepton1->tightCharge_ >= 2 && lepton2->tightCharge_ >= 2, evtWeight) ) continue;
 
 //--- compute output of BDTs used to discriminate ttH vs. ttV and ttH vs. ttbar 
 //    in 2lss_1tau category of ttH multilepton analysis 
-      mvaInputs["max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))"] = std::max(std::fabs(lepton1->eta_), std::fabs(lepton2->eta_));
-      mvaInputs["MT_met_lep1"]                = comp_MT_met_lep1(*lepton1, met_pt, met_phi);
-      mvaInputs["nJet25_Recl"]                = comp_n_jet25_recl(selJets);
-      mvaInputs["mindr_lep1_jet"]             = comp_mindr_lep1_jet(*lepton1, selJets);
-      mvaInputs["mindr_lep2_jet"]             = comp_mindr_lep2_jet(*lepton2, selJets);
-      mvaInputs["LepGood_conePt[iF_Recl[0]]"] = comp_lep1_conePt(*lepton1);
-      mvaInputs["LepGood_conePt[iF_Recl[1]]"] = comp_lep2_conePt(*lepton2);
-      mvaInputs["min(met_pt,400)"]            = std::min(met_pt, (Float_t)400.);
-      mvaInputs["avg_dr_jet"]                 = comp_avg_dr_jet(selJets);
+      mvaInputs[kMVAInput_2lss_max_lep_eta]    = std::max(std::fabs(lepton1->eta_), std::fabs(lepton2->eta_));
+      mvaInputs[kMVAInput_2lss_MT_met_lep1]    = comp_MT_met_lep1(*lepton1, met_pt, met_phi);
+      mvaInputs[kMVAInput_2lss_nJet25_Recl]    = comp_n_jet25_recl(selJets);
+      mvaInputs[kMVAInput_2lss_mindr_lep1_jet] = comp_mindr_lep1_jet(*lepton1, selJets);
+      mvaInputs[kMVAInput_2lss_mindr_lep2_jet] = comp_mindr_lep2_jet(*lepton2, selJets);
+      mvaInputs[kMVAInput_2lss_lep1_conePt]    = comp_lep1_conePt(*lepton1);
+      mvaInputs[kMVAInput_2lss_lep2_conePt]    = comp_lep2_conePt(*lepton2);
+      mvaInputs[kMVAInput_2lss_met_pt]         = std::min(met_pt, (Float_t)400.);
+      mvaInputs[kMVAInput_2lss_avg_dr_jet]     = comp_avg_dr_jet(selJets);
 
       double mvaOutput_2lss_ttV = mva_2lss_ttV(mvaInputs);
       double mvaOutput_2lss_ttbar = mva_2lss_ttbar(mvaInputs);
@@ -1073,9 +1069,8 @@ main(int argc,
 //======================== DILEPTON + TAU CHANNEL ===========================
 
 //---------------------------------------------------------------- PDG ID PLOT
-      if ( selHadTaus.size() >= 1 )
+      if ( apply_cut({ch::_2l_1tau}, cuts::good_tau, selHadTaus.size() >= 1, evtWeight) )
       {
-        ++counter[ch::_2l_1tau][cuts::good_tau]; // add fill_pdg_plot here as well
         fill_pdg_plot(genLeptons, genJets, selLeptons,
                       &selHadTaus, &genHadTaus, ch::_2l_1tau, true);
       }
@@ -1087,13 +1082,13 @@ main(int argc,
       {
         Double_t min_dR_l2j = 1000;
         Double_t ht = lepton1->pt_ + lepton2->pt_;
-        LV ht_vec = lepton1->p4_ + lepton2->p4_;
+        LV ht_vec(lepton1->p4() + lepton2->p4());
         for ( auto & jet: selJets )
         {
           const Double_t dR = deltaR(lepton2->eta_, lepton2->phi_, jet->eta_, jet->phi_);
           if ( dR < min_dR_l2j ) min_dR_l2j = dR;
           ht += jet->pt_;
-          ht_vec += jet->p4_;
+          ht_vec += jet->p4();
         }
         const Double_t pt_trailing = lepton2->pt_;
         const Double_t eta_trailing = std::fabs(lepton2->eta_);
@@ -1108,34 +1103,33 @@ main(int argc,
 //=========================== TRILEPTON CHANNEL =============================
     else if ( nSelLeptons == 3 )
     {
-      ++counter[ch::_3l][cuts::tight_mva];
+      apply_cut({ch::_3l}, cuts::tight_mva, true, evtWeight);
 
 //--------------------------------------------------- 4+ JETS or MET_LD > 0.2
+      bool passes_j4_plus_met_ld_02 = true;
       if ( selJets.size() < 4 )
       {
 
 //--- calculate MHT
         LV mht_vec(0,0,0,0);
         for ( auto & jet: selJets )
-          mht_vec += jet->p4_;
+          mht_vec += jet->p4();
         for ( auto & lepton: selLeptons )
-          mht_vec += lepton->p4_;
+          mht_vec += lepton->p4();
         const Double_t mht_pt = mht_vec.pt();
         const Double_t met_ld = met_coef * met_pt + mht_coef * mht_pt;
-        if ( !(met_ld >= 0.2) ) continue;
+        passes_j4_plus_met_ld_02 = met_ld >= 0.2;
       }
-      ++counter[ch::_3l][cuts::j4_plus_met_ld_02];
+      if ( !apply_cut({ch::_3l}, cuts::j4_plus_met_ld_02, passes_j4_plus_met_ld_02, evtWeight) ) continue;
 
 //---------------------------------------------------------------- SFOS ZVETO
       for ( unsigned j = 0; j < 3 && proceed; ++j )
         for ( unsigned k = 0; k < j && proceed; ++k )
           if ( selLeptons[j]->pdgId_ == -selLeptons[k]->pdgId_ &&
-             std::fabs((selLeptons[j]->p4_ +
-                        selLeptons[k]->p4_).mass() - z_mass) <= z_th )
+             std::fabs((selLeptons[j]->p4() +
+                        selLeptons[k]->p4()).mass() - z_mass) <= z_th )
               proceed = false;
-      if ( !proceed ) continue;
-
-      ++counter[ch::_3l][cuts::sfos_zveto];
+      if ( !apply_cut({ch::_3l}, cuts::sfos_zveto, proceed, evtWeight) ) continue;
 
 //---------------------------------------------------------------- PDG ID PLOT
       fill_pdg_plot(genLeptons, genJets, selLeptons,
@@ -1145,7 +1139,7 @@ main(int argc,
 //=========================== 4-LEPTON CHANNEL ==============================
     else
     {
-      ++counter[ch::_4l][cuts::loose_mva];
+      apply_cut({ch::_4l}, cuts::loose_mva, true, evtWeight);
 
 //-------------------------------------------------------- NEUTRAL CHARGE SUM
       const Int_t charge_sum = std::accumulate
@@ -1159,20 +1153,16 @@ main(int argc,
             return lhs + charge;
           }
         );
-      if ( charge_sum != 0 ) continue;
-
-      ++counter[ch::_4l][cuts::neutral_sum];
+      if ( !apply_cut({ch::_4l}, cuts::neutral_sum, charge_sum == 0, evtWeight) ) continue;
 
 //---------------------------------------------------------------- SFOS ZVETO
       for ( unsigned j = 0; j < 4 && proceed; ++j )
         for ( unsigned k = 0; k < j && proceed; ++k )
           if ( selLeptons[j]->pdgId_ == -selLeptons[k]->pdgId_ &&
-             std::fabs((selLeptons[j]->p4_ +
-                        selLeptons[k]->p4_).mass() - z_mass) <= z_th)
+             std::fabs((selLeptons[j]->p4() +
+                        selLeptons[k]->p4()).mass() - z_mass) <= z_th)
               proceed = false;
-      if ( !proceed ) continue;
-
-      ++counter[ch::_4l][cuts::sfos_zveto];
+      if ( !apply_cut({ch::_4l}, cuts::sfos_zveto, proceed, evtWeight) ) continue;
 
 //---------------------------------------------------------------- PDG ID PLOT
       fill_pdg_plot(genLeptons, genJets, selLeptons,
@@ -1193,17 +1183,18 @@ main(int argc,
              << results_fn
              << "\n";
 
-    for(auto & channels: counter)
+    for(auto & channel: cutFlow)
     {
+      const CutFlowTable & cutFlow_channel = channel.second;
       std::vector<std::string> counter_labels,
                                counter_numbers;
 
       counter_labels.push_back("channel");
-      counter_numbers.push_back(ch_str.at(channels.first));
-      for(auto & kv: channels.second)
+      counter_numbers.push_back(cutFlow_channel.getName());
+      for(std::size_t idxCut = 0; idxCut < cutFlow_channel.getNumCuts(); ++idxCut)
       {
-        counter_labels.push_back(cuts_str.at(kv.first));
-        counter_numbers.push_back(std::to_string(kv.second));
+        counter_labels.push_back(cutFlow_channel.getLabel(idxCut));
+        counter_numbers.push_back(std::to_string(cutFlow_channel.getNumPassed(idxCut)));
       }
 
       const std::string label_str = join_strings(counter_labels);
@@ -1220,6 +1211,32 @@ main(int argc,
              << results_fn
              << "\n";
 
+//--- write the cut-flow tables, including weighted event yields and CPU time per cut,
+//    to cutFlowTable.txt
+  const std::string cutFlow_fn =
+    (boost::filesystem::path(output_dir) /
+     boost::filesystem::path("cutFlowTable.txt")).string();
+  std::ofstream cutFlow_file(cutFlow_fn);
+  if(cutFlow_file.is_open())
+  {
+    log_file << "Writing cut-flow tables to file: "
+             << cutFlow_fn
+             << "\n";
+
+    CutFlowTable::writeHeader(cutFlow_file);
+    for(auto & channel: cutFlow)
+    {
+      channel.second.write(cutFlow_file);
+      channel.second.print(log_file);
+    }
+
+    cutFlow_file.close();
+  }
+  else
+    log_file << "Couldn't open the following file for writing: "
+             << cutFlow_fn
+             << "\n";
+
   hm.write(histogram_fn);
   log_file << "Wrote the histograms to: "
            << histogram_fn
@@ -14,6 +14,7 @@
 #include <TTree.h> // TTree
 #include <TBenchmark.h> // TBenchmark
 #include <TString.h> // TString, Form
+#include <TROOT.h> // ROOT::EnableThreadSafety
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoLepton.h" // RecoLepton
 #include "tthAnalysis/HiggsToTauTau/interface/RecoJet.h" // RecoJet
@@ -31,11 +32,16 @@
 #include "tthAnalysis/HiggsToTauTau/interface/GenLeptonReader.h" // GenLeptonReader
 #include "tthAnalysis/HiggsToTauTau/interface/GenHadTauReader.h" // GenHadTauReader
 #include "tthAnalysis/HiggsToTauTau/interface/GenJetReader.h" // GenJetReader
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource
+#include "tthAnalysis/HiggsToTauTau/interface/ColumnarCache.h" // ColumnarCacheReader
+#include "tthAnalysis/HiggsToTauTau/interface/EntryRange.h" // EntryRange, getClusterBoundaries, splitEntryRange
 #include "tthAnalysis/HiggsToTauTau/interface/convert_to_ptrs.h" // convert_to_ptrs
 #include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionCleaner.h" // RecoElectronCollectionCleaner, RecoMuonCollectionCleaner, RecoHadTauCollectionCleaner, RecoJetCollectionCleaner
-#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionGenMatcher.h" // RecoElectronCollectionGenMatcher, RecoMuonCollectionGenMatcher, RecoHadTauCollectionGenMatcher, RecoJetCollectionGenMatcher
+#include "tthAnalysis/HiggsToTauTau/interface/GenMatchTable.h" // GenMatchTable
 #include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionSelector.h" // RecoElectronSelectorLoose, RecoElectronSelectorTight, RecoMuonSelectorLoose, RecoMuonSelectorTight, RecoHadTauSelectorLoose, RecoHadTauSelectorTight
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionMultiSelector.h" // RecoMuonCollectionMultiSelector, RecoElectronCollectionMultiSelector, RecoHadTauCollectionMultiSelector
 #include "tthAnalysis/HiggsToTauTau/interface/RunLumiEventSelector.h" // RunLumiEventSelector
+#include "tthAnalysis/HiggsToTauTau/interface/CutFlowTable.h" // CutFlowTable
 #include "tthAnalysis/HiggsToTauTau/interface/ElectronHistManager.h" // ElectronHistManager
 #include "tthAnalysis/HiggsToTauTau/interface/MuonHistManager.h" // MuonHistManager
 #include "tthAnalysis/HiggsToTauTau/interface/HadTauHistManager.h" // HadTauHistManager
@@ -55,6 +61,10 @@
 #include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
 #include <algorithm> // std::sort
 #include <fstream> // std::ofstream
+#include <sstream> // std::ostringstream
+#include <thread> // std::thread
+#include <mutex> // std::mutex, std::unique_lock, std::lock_guard
+#include <exception> // std::exception_ptr, std::current_exception, std::rethrow_exception
 #include <assert.h> // assert
 
 typedef math::PtEtaPhiMLorentzVector LV;
@@ -77,6 +87,240 @@ bool isHigherPt(const GenParticle* particle1, const GenParticle* particle2)
   return (particle1->pt_ > particle2->pt_);
 }
 
+/**
+ * @brief Collection of all histograms booked and filled in the 1l_2tau category
+ */
+struct histManagers_1l_2tau
+{
+  histManagers_1l_2tau(TFileDirectory& dir, const std::string& process_string, const std::string& charge_and_hadTauSelection, const std::string& central_or_shift);
+  ~histManagers_1l_2tau();
+
+  /**
+   * @brief Add histograms filled by another thread
+   */
+  void merge(const histManagers_1l_2tau& shard);
+
+  ElectronHistManager preselElectronHistManager_;
+  MuonHistManager preselMuonHistManager_;
+  HadTauHistManager preselHadTauHistManager_;
+  HadTauHistManager preselHadTauHistManager_lead_;
+  HadTauHistManager preselHadTauHistManager_sublead_;
+  JetHistManager preselJetHistManager_;
+  JetHistManager preselBJet_looseHistManager_;
+  JetHistManager preselBJet_mediumHistManager_;
+  MEtHistManager preselMEtHistManager_;
+  EvtHistManager_1l_2tau preselEvtHistManager_;
+
+  ElectronHistManager selElectronHistManager_;
+  std::map<std::string, ElectronHistManager*> selElectronHistManager_category_; // key = category
+  MuonHistManager selMuonHistManager_;
+  std::map<std::string, MuonHistManager*> selMuonHistManager_category_; // key = category
+  HadTauHistManager selHadTauHistManager_;
+  std::map<std::string, std::map<std::string, HadTauHistManager*>> selHadTauHistManager_category_; // key = category, "leadHadTau"/"subleadHadTau"
+  JetHistManager selJetHistManager_;
+  JetHistManager selJetHistManager_lead_;
+  JetHistManager selJetHistManager_sublead_;
+  JetHistManager selBJet_looseHistManager_;
+  JetHistManager selBJet_looseHistManager_lead_;
+  JetHistManager selBJet_looseHistManager_sublead_;
+  JetHistManager selBJet_mediumHistManager_;
+  MEtHistManager selMEtHistManager_;
+  EvtHistManager_1l_2tau selEvtHistManager_;
+  std::map<std::string, EvtHistManager_1l_2tau*> selEvtHistManager_category_; // key = category
+};
+
+histManagers_1l_2tau::histManagers_1l_2tau(TFileDirectory& dir, const std::string& process_string, const std::string& charge_and_hadTauSelection, const std::string& central_or_shift)
+  : preselElectronHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/presel/electrons", charge_and_hadTauSelection.data()), central_or_shift))
+  , preselMuonHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/presel/muons", charge_and_hadTauSelection.data()), central_or_shift))
+  , preselHadTauHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/presel/hadTaus", charge_and_hadTauSelection.data()), central_or_shift))
+  , preselHadTauHistManager_lead_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/presel/leadHadTau", charge_and_hadTauSelection.data()), central_or_shift))
+  , preselHadTauHistManager_sublead_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/presel/subleadHadTau", charge_and_hadTauSelection.data()), central_or_shift))
+  , preselJetHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/presel/jets", charge_and_hadTauSelection.data()), central_or_shift))
+  , preselBJet_looseHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/presel/BJets_loose", charge_and_hadTauSelection.data()), central_or_shift))
+  , preselBJet_mediumHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/presel/BJets_medium", charge_and_hadTauSelection.data()), central_or_shift))
+  , preselMEtHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/presel/met", charge_and_hadTauSelection.data()), central_or_shift))
+  , preselEvtHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/presel/evt", charge_and_hadTauSelection.data()), central_or_shift))
+  , selElectronHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/sel/electrons", charge_and_hadTauSelection.data()), central_or_shift))
+  , selMuonHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/sel/muons", charge_and_hadTauSelection.data()), central_or_shift))
+  , selHadTauHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/sel/hadTaus", charge_and_hadTauSelection.data()), central_or_shift))
+  , selJetHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/sel/jets", charge_and_hadTauSelection.data()), central_or_shift))
+  , selJetHistManager_lead_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/sel/leadJet", charge_and_hadTauSelection.data()), central_or_shift, 0))
+  , selJetHistManager_sublead_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/sel/subleadJet", charge_and_hadTauSelection.data()), central_or_shift, 1))
+  , selBJet_looseHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/sel/BJets_loose", charge_and_hadTauSelection.data()), central_or_shift))
+  , selBJet_looseHistManager_lead_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/sel/leadBJet_loose", charge_and_hadTauSelection.data()), central_or_shift, 0))
+  , selBJet_looseHistManager_sublead_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/sel/subleadBJet_loose", charge_and_hadTauSelection.data()), central_or_shift, 1))
+  , selBJet_mediumHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/sel/BJets_medium", charge_and_hadTauSelection.data()), central_or_shift))
+  , selMEtHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/sel/met", charge_and_hadTauSelection.data()), central_or_shift))
+  , selEvtHistManager_(makeHistManager_cfg(process_string,
+      Form("1l_2tau_%s/sel/evt", charge_and_hadTauSelection.data()), central_or_shift))
+{
+  preselElectronHistManager_.bookHistograms(dir);
+  preselMuonHistManager_.bookHistograms(dir);
+  preselHadTauHistManager_.bookHistograms(dir);
+  preselHadTauHistManager_lead_.bookHistograms(dir);
+  preselHadTauHistManager_sublead_.bookHistograms(dir);
+  preselJetHistManager_.bookHistograms(dir);
+  preselBJet_looseHistManager_.bookHistograms(dir);
+  preselBJet_mediumHistManager_.bookHistograms(dir);
+  preselMEtHistManager_.bookHistograms(dir);
+  preselEvtHistManager_.bookHistograms(dir);
+
+  selElectronHistManager_.bookHistograms(dir);
+  vstring categories_e = {
+    "1e_2tau_bloose", "1e_2tau_btight"
+  };
+  for ( vstring::const_iterator category = categories_e.begin();
+	category != categories_e.end(); ++category ) {
+    ElectronHistManager* selElectronHistManager = new ElectronHistManager(makeHistManager_cfg(process_string,
+      Form("%s_%s/sel/electron", category->data(), charge_and_hadTauSelection.data()), central_or_shift));
+    selElectronHistManager->bookHistograms(dir);
+    selElectronHistManager_category_[*category] = selElectronHistManager;
+  }
+
+  selMuonHistManager_.bookHistograms(dir);
+  vstring categories_mu = {
+    "1mu_2tau_bloose", "1mu_2tau_btight"
+  };
+  for ( vstring::const_iterator category = categories_mu.begin();
+	category != categories_mu.end(); ++category ) {
+    MuonHistManager* selMuonHistManager = new MuonHistManager(makeHistManager_cfg(process_string,
+      Form("%s_%s/sel/muon", category->data(), charge_and_hadTauSelection.data()), central_or_shift));
+    selMuonHistManager->bookHistograms(dir);
+    selMuonHistManager_category_[*category] = selMuonHistManager;
+  }
+
+  selHadTauHistManager_.bookHistograms(dir);
+  vstring categories_tau = {
+    "1e_2tau_bloose", "1e_2tau_btight",
+    "1mu_2tau_bloose", "1mu_2tau_btight"
+  };
+  for ( vstring::const_iterator category = categories_tau.begin();
+	category != categories_tau.end(); ++category ) {
+    HadTauHistManager* selHadTauHistManager_lead = new HadTauHistManager(makeHistManager_cfg(process_string,
+      Form("%s_%s/sel/leadHadTau", category->data(), charge_and_hadTauSelection.data()), central_or_shift, 0));
+    selHadTauHistManager_lead->bookHistograms(dir);
+    selHadTauHistManager_category_[*category]["leadHadTau"] = selHadTauHistManager_lead;
+    HadTauHistManager* selHadTauHistManager_sublead = new HadTauHistManager(makeHistManager_cfg(process_string,
+      Form("%s_%s/sel/subleadHadTau", category->data(), charge_and_hadTauSelection.data()), central_or_shift, 1));
+    selHadTauHistManager_sublead->bookHistograms(dir);
+    selHadTauHistManager_category_[*category]["subleadHadTau"] = selHadTauHistManager_sublead;
+  }
+
+  selJetHistManager_.bookHistograms(dir);
+  selJetHistManager_lead_.bookHistograms(dir);
+  selJetHistManager_sublead_.bookHistograms(dir);
+
+  selBJet_looseHistManager_.bookHistograms(dir);
+  selBJet_looseHistManager_lead_.bookHistograms(dir);
+  selBJet_looseHistManager_sublead_.bookHistograms(dir);
+  selBJet_mediumHistManager_.bookHistograms(dir);
+
+  selMEtHistManager_.bookHistograms(dir);
+
+  selEvtHistManager_.bookHistograms(dir);
+  vstring categories_evt = {
+    "1e_2tau_bloose", "1e_2tau_btight",
+    "1mu_2tau_bloose", "1mu_2tau_btight"
+  };
+  for ( vstring::const_iterator category = categories_evt.begin();
+	category != categories_evt.end(); ++category ) {
+    EvtHistManager_1l_2tau* selEvtHistManager = new EvtHistManager_1l_2tau(makeHistManager_cfg(process_string,
+      Form("%s_%s/sel/evt", category->data(), charge_and_hadTauSelection.data()), central_or_shift));
+    selEvtHistManager->bookHistograms(dir);
+    selEvtHistManager_category_[*category] = selEvtHistManager;
+  }
+}
+
+histManagers_1l_2tau::~histManagers_1l_2tau()
+{
+  for ( std::map<std::string, ElectronHistManager*>::iterator histManager = selElectronHistManager_category_.begin();
+	histManager != selElectronHistManager_category_.end(); ++histManager ) {
+    delete histManager->second;
+  }
+  for ( std::map<std::string, MuonHistManager*>::iterator histManager = selMuonHistManager_category_.begin();
+	histManager != selMuonHistManager_category_.end(); ++histManager ) {
+    delete histManager->second;
+  }
+  for ( std::map<std::string, std::map<std::string, HadTauHistManager*>>::iterator histManagers = selHadTauHistManager_category_.begin();
+	histManagers != selHadTauHistManager_category_.end(); ++histManagers ) {
+    for ( std::map<std::string, HadTauHistManager*>::iterator histManager = histManagers->second.begin();
+	  histManager != histManagers->second.end(); ++histManager ) {
+      delete histManager->second;
+    }
+  }
+  for ( std::map<std::string, EvtHistManager_1l_2tau*>::iterator histManager = selEvtHistManager_category_.begin();
+	histManager != selEvtHistManager_category_.end(); ++histManager ) {
+    delete histManager->second;
+  }
+}
+
+void histManagers_1l_2tau::merge(const histManagers_1l_2tau& shard)
+{
+  preselElectronHistManager_.merge(shard.preselElectronHistManager_);
+  preselMuonHistManager_.merge(shard.preselMuonHistManager_);
+  preselHadTauHistManager_.merge(shard.preselHadTauHistManager_);
+  preselHadTauHistManager_lead_.merge(shard.preselHadTauHistManager_lead_);
+  preselHadTauHistManager_sublead_.merge(shard.preselHadTauHistManager_sublead_);
+  preselJetHistManager_.merge(shard.preselJetHistManager_);
+  preselBJet_looseHistManager_.merge(shard.preselBJet_looseHistManager_);
+  preselBJet_mediumHistManager_.merge(shard.preselBJet_mediumHistManager_);
+  preselMEtHistManager_.merge(shard.preselMEtHistManager_);
+  preselEvtHistManager_.merge(shard.preselEvtHistManager_);
+
+  selElectronHistManager_.merge(shard.selElectronHistManager_);
+  for ( std::map<std::string, ElectronHistManager*>::iterator histManager = selElectronHistManager_category_.begin();
+	histManager != selElectronHistManager_category_.end(); ++histManager ) {
+    histManager->second->merge(*shard.selElectronHistManager_category_.at(histManager->first));
+  }
+  selMuonHistManager_.merge(shard.selMuonHistManager_);
+  for ( std::map<std::string, MuonHistManager*>::iterator histManager = selMuonHistManager_category_.begin();
+	histManager != selMuonHistManager_category_.end(); ++histManager ) {
+    histManager->second->merge(*shard.selMuonHistManager_category_.at(histManager->first));
+  }
+  selHadTauHistManager_.merge(shard.selHadTauHistManager_);
+  for ( std::map<std::string, std::map<std::string, HadTauHistManager*>>::iterator histManagers = selHadTauHistManager_category_.begin();
+	histManagers != selHadTauHistManager_category_.end(); ++histManagers ) {
+    for ( std::map<std::string, HadTauHistManager*>::iterator histManager = histManagers->second.begin();
+	  histManager != histManagers->second.end(); ++histManager ) {
+      histManager->second->merge(*shard.selHadTauHistManager_category_.at(histManagers->first).at(histManager->first));
+    }
+  }
+  selJetHistManager_.merge(shard.selJetHistManager_);
+  selJetHistManager_lead_.merge(shard.selJetHistManager_lead_);
+  selJetHistManager_sublead_.merge(shard.selJetHistManager_sublead_);
+  selBJet_looseHistManager_.merge(shard.selBJet_looseHistManager_);
+  selBJet_looseHistManager_lead_.merge(shard.selBJet_looseHistManager_lead_);
+  selBJet_looseHistManager_sublead_.merge(shard.selBJet_looseHistManager_sublead_);
+  selBJet_mediumHistManager_.merge(shard.selBJet_mediumHistManager_);
+  selMEtHistManager_.merge(shard.selMEtHistManager_);
+  selEvtHistManager_.merge(shard.selEvtHistManager_);
+  for ( std::map<std::string, EvtHistManager_1l_2tau*>::iterator histManager = selEvtHistManager_category_.begin();
+	histManager != selEvtHistManager_category_.end(); ++histManager ) {
+    histManager->second->merge(*shard.selEvtHistManager_category_.at(histManager->first));
+  }
+}
+
 /**
  * @brief Produce datacard and control plots for 1l_2tau category.
  */
@@ -108,10 +352,8 @@ int main(int argc, char* argv[])
   std::string process_string = cfg_analyze.getParameter<std::string>("process");
 
   vstring triggerNames_1e = cfg_analyze.getParameter<vstring>("triggers_1e");
-  std::vector<hltPath*> triggers_1e = create_hltPaths(triggerNames_1e);
   bool use_triggers_1e = cfg_analyze.getParameter<bool>("use_triggers_1e");
   vstring triggerNames_1mu = cfg_analyze.getParameter<vstring>("triggers_1mu");
-  std::vector<hltPath*> triggers_1mu = create_hltPaths(triggerNames_1mu);
   bool use_triggers_1mu = cfg_analyze.getParameter<bool>("use_triggers_1mu");
 
   enum { kOS, kSS };
@@ -135,6 +377,13 @@ int main(int argc, char* argv[])
   std::string central_or_shift = cfg_analyze.getParameter<std::string>("central_or_shift");
   double lumiScale = ( process_string != "data_obs" ) ? cfg_analyze.getParameter<double>("lumiScale") : 1.;
 
+//--- process the events in numThreads threads (optional)
+  int numThreads = ( cfg_analyze.exists("numThreads") ) ? cfg_analyze.getParameter<int>("numThreads") : 1;
+  if ( numThreads < 1 )
+    throw cms::Exception("analyze_1l_2tau") 
+      << "Invalid Configuration parameter 'numThreads' = " << numThreads << " !!\n";
+  if ( numThreads > 1 ) ROOT::EnableThreadSafety();
+
   std::string jet_btagWeight_branch = ( isMC ) ? "Jet_bTagWeight" : "";
 
   int jetPt_option = RecoJetReader::kJetPt_central;
@@ -227,16 +476,11 @@ int main(int argc, char* argv[])
 
   std::string selEventsFileName_input = cfg_analyze.getParameter<std::string>("selEventsFileName_input");
   std::cout << "selEventsFileName_input = " << selEventsFileName_input << std::endl;
-  RunLumiEventSelector* run_lumi_eventSelector = 0;
-  if ( selEventsFileName_input != "" ) {
-    edm::ParameterSet cfgRunLumiEventSelector;
-    cfgRunLumiEventSelector.addParameter<std::string>("inputFileName", selEventsFileName_input);
-    cfgRunLumiEventSelector.addParameter<std::string>("separator", ":");
-    run_lumi_eventSelector = new RunLumiEventSelector(cfgRunLumiEventSelector);
-  }
 
   std::string selEventsFileName_output = cfg_analyze.getParameter<std::string>("selEventsFileName_output");
 
+  std::string cutFlowFileName = ( cfg_analyze.exists("cutFlowFileName") ) ? cfg_analyze.getParameter<std::string>("cutFlowFileName") : "";
+
   fwlite::InputSource inputFiles(cfg); 
   int maxEvents = inputFiles.maxEvents();
   std::cout << " maxEvents = " << maxEvents << std::endl;
@@ -245,517 +489,568 @@ int main(int argc, char* argv[])
   fwlite::OutputFiles outputFile(cfg);
   fwlite::TFileService fs = fwlite::TFileService(outputFile.file().data());
 
-  TChain* inputTree = new TChain(treeName.data());
-  for ( std::vector<std::string>::const_iterator inputFileName = inputFiles.files().begin();
-	inputFileName != inputFiles.files().end(); ++inputFileName ) {
-    std::cout << "input Tree: adding file = " << (*inputFileName) << std::endl;
-    inputTree->AddFile(inputFileName->data());
-  }
+  edm::ParameterSet cfg_input = cfg.getParameter<edm::ParameterSet>("fwliteInput");
+  std::string inputFormat = "ROOT";
+  if ( cfg_input.exists("inputFormat") ) inputFormat = cfg_input.getParameter<std::string>("inputFormat");
+
+  TChain* inputTree = 0;
+  ColumnarCacheReader* inputCache = 0;
+  if ( inputFormat == "ROOT" ) {
+    inputTree = new TChain(treeName.data());
+    for ( std::vector<std::string>::const_iterator inputFileName = inputFiles.files().begin();
+	  inputFileName != inputFiles.files().end(); ++inputFileName ) {
+      std::cout << "input Tree: adding file = " << (*inputFileName) << std::endl;
+      inputTree->AddFile(inputFileName->data());
+    }
   
-  if ( !(inputTree->GetListOfFiles()->GetEntries() >= 1) ) {
+    if ( !(inputTree->GetListOfFiles()->GetEntries() >= 1) ) {
+      throw cms::Exception("analyze_1l_2tau") 
+        << "Failed to identify input Tree !!\n";
+    }
+  
+    // CV: need to call TChain::LoadTree before processing first event 
+    //     in order to prevent ROOT causing a segmentation violation,
+    //     cf. http://root.cern.ch/phpBB3/viewtopic.php?t=10062
+    inputTree->LoadTree(0);
+
+    std::cout << "input Tree contains " << inputTree->GetEntries() << " Entries in " << inputTree->GetListOfFiles()->GetEntries() << " files." << std::endl;
+  } else if ( inputFormat == "columnarCache" ) {
+    inputCache = new ColumnarCacheReader(inputFiles.files());
+    std::cout << "input columnar cache contains " << inputCache->getEntries() << " Entries in " << inputFiles.files().size() << " files." << std::endl;
+  } else {
     throw cms::Exception("analyze_1l_2tau") 
-      << "Failed to identify input Tree !!\n";
+      << "Invalid Configuration parameter 'inputFormat' = " << inputFormat << " !!\n";
   }
-  
-  // CV: need to call TChain::LoadTree before processing first event 
-  //     in order to prevent ROOT causing a segmentation violation,
-  //     cf. http://root.cern.ch/phpBB3/viewtopic.php?t=10062
-  inputTree->LoadTree(0);
-
-  std::cout << "input Tree contains " << inputTree->GetEntries() << " Entries in " << inputTree->GetListOfFiles()->GetEntries() << " files." << std::endl;
-
-//--- declare event-level variables
-  RUN_TYPE run;
-  inputTree->SetBranchAddress(RUN_KEY, &run);
-  LUMI_TYPE lumi;
-  inputTree->SetBranchAddress(LUMI_KEY, &lumi);
-  EVT_TYPE event;
-  inputTree->SetBranchAddress(EVT_KEY, &event);
-
-  hltPaths_setBranchAddresses(inputTree, triggers_1e);
-  hltPaths_setBranchAddresses(inputTree, triggers_1mu);
-
-  MET_PT_TYPE met_pt;
-  inputTree->SetBranchAddress(MET_PT_KEY, &met_pt);
-  MET_ETA_TYPE met_eta;
-  inputTree->SetBranchAddress(MET_ETA_KEY, &met_eta);
-  MET_PHI_TYPE met_phi;
-  inputTree->SetBranchAddress(MET_PHI_KEY, &met_phi);
-  LV met_p4(met_pt, met_eta, met_phi, 0.);
 
-//--- declare particle collections
-  RecoMuonReader* muonReader = new RecoMuonReader("nselLeptons", "selLeptons");
-  muonReader->setBranchAddresses(inputTree);
-  RecoMuonCollectionGenMatcher muonGenMatcher;
-  RecoMuonCollectionSelectorLoose preselMuonSelector;
-  RecoMuonCollectionSelectorTight tightMuonSelector;
-
-  RecoElectronReader* electronReader = new RecoElectronReader("nselLeptons", "selLeptons");
-  electronReader->setBranchAddresses(inputTree);
-  RecoElectronCollectionGenMatcher electronGenMatcher;
-  RecoElectronCollectionCleaner electronCleaner(0.3);
-  RecoElectronCollectionSelectorLoose preselElectronSelector;
-  RecoElectronCollectionSelectorTight tightElectronSelector;
-
-  RecoHadTauReader* hadTauReader = new RecoHadTauReader("nTauGood", "TauGood");
-  hadTauReader->setBranchAddresses(inputTree);
-  RecoHadTauCollectionGenMatcher hadTauGenMatcher;
-  RecoHadTauCollectionCleaner hadTauCleaner(0.3);
-  RecoHadTauCollectionSelectorLoose preselHadTauSelector;
-  RecoHadTauCollectionSelectorFakeable fakeableHadTauSelector;
-  RecoHadTauCollectionSelectorTight tightHadTauSelector;
-  
-  RecoJetReader* jetReader = new RecoJetReader("nJet", "Jet");
-  jetReader->setJetPt_central_or_shift(jetPt_option);
-  jetReader->setBranchName_BtagWeight(jet_btagWeight_branch);
-  jetReader->setBranchAddresses(inputTree);
-  RecoJetCollectionGenMatcher jetGenMatcher;
-  RecoJetCollectionCleaner jetCleaner(0.5);
-  RecoJetCollectionSelector jetSelector;  
-  RecoJetCollectionSelectorBtagLoose jetSelectorBtagLoose;
-  RecoJetCollectionSelectorBtagMedium jetSelectorBtagMedium;
-
-  GenLeptonReader* genLeptonReader = 0;
-  GenHadTauReader* genHadTauReader = 0;
-  GenJetReader* genJetReader = 0;
-  if ( isMC ) {
-    genLeptonReader = new GenLeptonReader("nGenLep", "GenLep");
-    genLeptonReader->setBranchAddresses(inputTree);
-    genHadTauReader = new GenHadTauReader("nGenHadTaus", "GenHadTaus");
-    genHadTauReader->setBranchAddresses(inputTree);
-    genJetReader = new GenJetReader("nGenJet", "GenJet");
-    genJetReader->setBranchAddresses(inputTree);
+//--- split the range of entries into contiguous ranges, one per thread;
+//    the boundaries between the ranges are aligned to the cluster boundaries of the input files,
+//    so that the split is reproducible and no cluster of baskets is decompressed by more than one thread
+  EntryRange entryRange(cfg_input, ( inputCache ) ? inputCache->getEntries() : inputTree->GetEntries());
+  if ( maxEvents != -1 && entryRange.size() > maxEvents ) entryRange = EntryRange(entryRange.firstEntry(), entryRange.firstEntry() + maxEvents);
+  std::cout << "processing Entries " << entryRange.firstEntry() << " to " << entryRange.lastEntry() << "." << std::endl;
+  std::vector<Long64_t> clusterBoundaries;
+  if ( inputTree && numThreads > 1 ) clusterBoundaries = getClusterBoundaries(inputTree);
+  std::vector<EntryRange> entryRanges = splitEntryRange(entryRange, numThreads, clusterBoundaries);
+  if ( numThreads > 1 ) {
+    for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+      std::cout << " thread #" << idxWorker << ": Entries " << entryRanges[idxWorker].firstEntry() << " to " << entryRanges[idxWorker].lastEntry() << std::endl;
+    }
   }
 
 //--- open output file containing run:lumi:event numbers of events passing final event selection criteria
   std::ostream* selEventsFile = new std::ofstream(selEventsFileName_output.data(), std::ios::out);
 
-//--- declare histograms
+//--- declare histograms;
+//    threads other than the first fill private copies of the histograms, booked in separate directories,
+//    which are added to the histograms of the first thread once all threads have finished
   std::string charge_and_hadTauSelection = Form("%s_%s", chargeSelection_string.data(), hadTauSelection_string.data());
-  ElectronHistManager preselElectronHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/presel/electrons", charge_and_hadTauSelection.data()), central_or_shift));
-  preselElectronHistManager.bookHistograms(fs);
-  MuonHistManager preselMuonHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/presel/muons", charge_and_hadTauSelection.data()), central_or_shift));
-  preselMuonHistManager.bookHistograms(fs);
-  HadTauHistManager preselHadTauHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/presel/hadTaus", charge_and_hadTauSelection.data()), central_or_shift));
-  preselHadTauHistManager.bookHistograms(fs);
-  HadTauHistManager preselHadTauHistManager_lead(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/presel/leadHadTau", charge_and_hadTauSelection.data()), central_or_shift));
-  preselHadTauHistManager_lead.bookHistograms(fs);
-  HadTauHistManager preselHadTauHistManager_sublead(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/presel/subleadHadTau", charge_and_hadTauSelection.data()), central_or_shift));
-  preselHadTauHistManager_sublead.bookHistograms(fs);
-  JetHistManager preselJetHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/presel/jets", charge_and_hadTauSelection.data()), central_or_shift));
-  preselJetHistManager.bookHistograms(fs);
-  JetHistManager preselBJet_looseHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/presel/BJets_loose", charge_and_hadTauSelection.data()), central_or_shift));
-  preselBJet_looseHistManager.bookHistograms(fs);
-  JetHistManager preselBJet_mediumHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/presel/BJets_medium", charge_and_hadTauSelection.data()), central_or_shift));
-  preselBJet_mediumHistManager.bookHistograms(fs);
-  MEtHistManager preselMEtHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/presel/met", charge_and_hadTauSelection.data()), central_or_shift));
-  preselMEtHistManager.bookHistograms(fs);
-  EvtHistManager_1l_2tau preselEvtHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/presel/evt", charge_and_hadTauSelection.data()), central_or_shift));
-  preselEvtHistManager.bookHistograms(fs);
-
-  ElectronHistManager selElectronHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/sel/electrons", charge_and_hadTauSelection.data()), central_or_shift));
-  selElectronHistManager.bookHistograms(fs);
-  vstring categories_e = { 
-    "1e_2tau_bloose", "1e_2tau_btight"
-  };
-  std::map<std::string, ElectronHistManager*> selElectronHistManager_category; // key = category
-  for ( vstring::const_iterator category = categories_e.begin();
-	category != categories_e.end(); ++category ) {
-    ElectronHistManager* selElectronHistManager = new ElectronHistManager(makeHistManager_cfg(process_string, 
-      Form("%s_%s/sel/electron", category->data(), charge_and_hadTauSelection.data()), central_or_shift));
-    selElectronHistManager->bookHistograms(fs);
-    selElectronHistManager_category[*category] = selElectronHistManager;
+  std::vector<histManagers_1l_2tau*> histManagers_workers;
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    TFileDirectory dir = ( idxWorker == 0 ) ? fs : fs.mkdir(Form("shard%i", idxWorker));
+    histManagers_workers.push_back(new histManagers_1l_2tau(dir, process_string, charge_and_hadTauSelection, central_or_shift));
   }
 
-  MuonHistManager selMuonHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/sel/muons", charge_and_hadTauSelection.data()), central_or_shift));
-  selMuonHistManager.bookHistograms(fs);
-  vstring categories_mu = { 
-    "1mu_2tau_bloose", "1mu_2tau_btight"
-  };
-  std::map<std::string, MuonHistManager*> selMuonHistManager_category; // key = category
-  for ( vstring::const_iterator category = categories_mu.begin();
-	category != categories_mu.end(); ++category ) {
-    MuonHistManager* selMuonHistManager = new MuonHistManager(makeHistManager_cfg(process_string, 
-      Form("%s_%s/sel/muon", category->data(), charge_and_hadTauSelection.data()), central_or_shift));
-    selMuonHistManager->bookHistograms(fs);
-    selMuonHistManager_category[*category] = selMuonHistManager;
-  }
-
-  HadTauHistManager selHadTauHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/sel/hadTaus", charge_and_hadTauSelection.data()), central_or_shift));
-  selHadTauHistManager.bookHistograms(fs);
-  vstring categories_tau = {
-    "1e_2tau_bloose", "1e_2tau_btight",
-    "1mu_2tau_bloose", "1mu_2tau_btight"
-  };
-  std::map<std::string, std::map<std::string, HadTauHistManager*>> selHadTauHistManager_category; // key = category, "leadHadTau"/"subleadHadTau"
-  for ( vstring::const_iterator category = categories_tau.begin();
-	category != categories_tau.end(); ++category ) {
-    HadTauHistManager* selHadTauHistManager_lead = new HadTauHistManager(makeHistManager_cfg(process_string, 
-      Form("%s_%s/sel/leadHadTau", category->data(), charge_and_hadTauSelection.data()), central_or_shift, 0));
-    selHadTauHistManager_lead->bookHistograms(fs);
-    selHadTauHistManager_category[*category]["leadHadTau"] = selHadTauHistManager_lead;
-    HadTauHistManager* selHadTauHistManager_sublead = new HadTauHistManager(makeHistManager_cfg(process_string, 
-      Form("%s_%s/sel/subleadHadTau", category->data(), charge_and_hadTauSelection.data()), central_or_shift, 1));
-    selHadTauHistManager_sublead->bookHistograms(fs);
-    selHadTauHistManager_category[*category]["subleadHadTau"] = selHadTauHistManager_sublead;
-  }
+  std::vector<std::ostringstream> selEventsFiles_workers(numThreads);
+  std::vector<int> analyzedEntries_workers(numThreads);
+  std::vector<int> selectedEntries_workers(numThreads);
+  std::vector<double> selectedEntries_weighted_workers(numThreads);
+  std::vector<CutFlowTable> cutFlow_workers(numThreads, CutFlowTable("analyze_1l_2tau"));
+  std::mutex workerMutex;
+  std::mutex coutMutex;
+
+//--- process the entries in range given by entryRanges[idxWorker];
+//    all objects that change their state while processing events (readers, selectors,...)
+//    are private to each thread, while the jet->tau fake-rate weights are shared, as they are only evaluated
+  auto processEntries = [&](int idxWorker)
+  {
+//--- construct and destruct the objects used by each thread one thread at a time,
+//    as creating and deleting TChain and TBranch objects is not guaranteed to be thread-safe
+    std::unique_lock<std::mutex> lock(workerMutex);
+
+//--- each thread other than the first reads the input files through its own TChain or ColumnarCacheReader object
+    TChain* inputTree_worker = inputTree;
+    ColumnarCacheReader* inputCache_worker = inputCache;
+    if ( idxWorker > 0 ) {
+      if ( inputTree ) {
+        inputTree_worker = new TChain(treeName.data());
+        for ( std::vector<std::string>::const_iterator inputFileName = inputFiles.files().begin();
+	      inputFileName != inputFiles.files().end(); ++inputFileName ) {
+          inputTree_worker->AddFile(inputFileName->data());
+        }
+        inputTree_worker->LoadTree(0);
+      } else {
+        inputCache_worker = new ColumnarCacheReader(inputFiles.files());
+      }
+    }
 
-  JetHistManager selJetHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/sel/jets", charge_and_hadTauSelection.data()), central_or_shift));
-  selJetHistManager.bookHistograms(fs);
-  JetHistManager selJetHistManager_lead(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/sel/leadJet", charge_and_hadTauSelection.data()), central_or_shift, 0));
-  selJetHistManager_lead.bookHistograms(fs);
-  JetHistManager selJetHistManager_sublead(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/sel/subleadJet", charge_and_hadTauSelection.data()), central_or_shift, 1));
-  selJetHistManager_sublead.bookHistograms(fs);
-
-  JetHistManager selBJet_looseHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/sel/BJets_loose", charge_and_hadTauSelection.data()), central_or_shift));
-  selBJet_looseHistManager.bookHistograms(fs);
-  JetHistManager selBJet_looseHistManager_lead(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/sel/leadBJet_loose", charge_and_hadTauSelection.data()), central_or_shift, 0));
-  selBJet_looseHistManager_lead.bookHistograms(fs);
-  JetHistManager selBJet_looseHistManager_sublead(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/sel/subleadBJet_loose", charge_and_hadTauSelection.data()), central_or_shift, 1));
-  selBJet_looseHistManager_sublead.bookHistograms(fs);
-  JetHistManager selBJet_mediumHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/sel/BJets_medium", charge_and_hadTauSelection.data()), central_or_shift));
-  selBJet_mediumHistManager.bookHistograms(fs);
-
-  MEtHistManager selMEtHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/sel/met", charge_and_hadTauSelection.data()), central_or_shift));
-  selMEtHistManager.bookHistograms(fs);
-
-  EvtHistManager_1l_2tau selEvtHistManager(makeHistManager_cfg(process_string, 
-    Form("1l_2tau_%s/sel/evt", charge_and_hadTauSelection.data()), central_or_shift));
-  selEvtHistManager.bookHistograms(fs);
-  vstring categories_evt = { 
-    "1e_2tau_bloose", "1e_2tau_btight", 
-    "1mu_2tau_bloose", "1mu_2tau_btight"
-  };
-  std::map<std::string, EvtHistManager_1l_2tau*> selEvtHistManager_category; // key = category
-  for ( vstring::const_iterator category = categories_evt.begin();
-	category != categories_evt.end(); ++category ) {
-    EvtHistManager_1l_2tau* selEvtHistManager = new EvtHistManager_1l_2tau(makeHistManager_cfg(process_string, 
-      Form("%s_%s/sel/evt", category->data(), charge_and_hadTauSelection.data()), central_or_shift));
-    selEvtHistManager->bookHistograms(fs);
-    selEvtHistManager_category[*category] = selEvtHistManager;
-  }
+//--- declare event-level variables
+    EventSource* eventSource_ptr = ( inputCache_worker ) ? new EventSource(inputCache_worker) : new EventSource(inputTree_worker);
+    EventSource& eventSource = (*eventSource_ptr);
+
+    RUN_TYPE run;
+    eventSource.setBranchAddress(RUN_KEY, &run);
+    LUMI_TYPE lumi;
+    eventSource.setBranchAddress(LUMI_KEY, &lumi);
+    EVT_TYPE event;
+    eventSource.setBranchAddress(EVT_KEY, &event);
+
+    std::vector<hltPath*> triggers_1e = create_hltPaths(triggerNames_1e);
+    std::vector<hltPath*> triggers_1mu = create_hltPaths(triggerNames_1mu);
+    hltPaths_setBranchAddresses(eventSource, triggers_1e);
+    hltPaths_setBranchAddresses(eventSource, triggers_1mu);
+
+    MET_PT_TYPE met_pt;
+    eventSource.setBranchAddress(MET_PT_KEY, &met_pt);
+    MET_ETA_TYPE met_eta;
+    eventSource.setBranchAddress(MET_ETA_KEY, &met_eta);
+    MET_PHI_TYPE met_phi;
+    eventSource.setBranchAddress(MET_PHI_KEY, &met_phi);
+    LV met_p4(met_pt, met_eta, met_phi, 0.);
 
-  int numEntries = inputTree->GetEntries();
-  int analyzedEntries = 0;
-  int selectedEntries = 0;
-  double selectedEntries_weighted = 0.;
-  for ( int idxEntry = 0; idxEntry < numEntries && (maxEvents == -1 || idxEntry < maxEvents); ++idxEntry ) {
-    if ( idxEntry > 0 && (idxEntry % reportEvery) == 0 ) {
-      std::cout << "processing Entry " << idxEntry << " (" << selectedEntries << " Entries selected)" << std::endl;
+//--- declare particle collections
+    RecoMuonReader* muonReader = new RecoMuonReader("nselLeptons", "selLeptons");
+    muonReader->setBranchAddresses(eventSource);
+    RecoMuonCollectionMultiSelector muonSelector;
+    RecoMuonCollectionSelection muonSelection;
+
+    RecoElectronReader* electronReader = new RecoElectronReader("nselLeptons", "selLeptons");
+    electronReader->setBranchAddresses(eventSource);
+    RecoElectronCollectionCleaner electronCleaner(0.3);
+    RecoElectronCollectionMultiSelector electronSelector;
+    RecoElectronCollectionSelection electronSelection;
+
+    RecoHadTauReader* hadTauReader = new RecoHadTauReader("nTauGood", "TauGood");
+    hadTauReader->setBranchAddresses(eventSource);
+    RecoHadTauCollectionCleaner hadTauCleaner(0.3);
+    RecoHadTauCollectionMultiSelector hadTauSelector;
+    RecoHadTauCollectionSelection hadTauSelectionResults;
+  
+    RecoJetReader* jetReader = new RecoJetReader("nJet", "Jet");
+    jetReader->setJetPt_central_or_shift(jetPt_option);
+    jetReader->setBranchName_BtagWeight(jet_btagWeight_branch);
+    jetReader->setBranchAddresses(eventSource);
+    RecoJetCollectionCleaner jetCleaner(0.5);
+    RecoJetCollectionSelector jetSelector;  
+    RecoJetCollectionSelectorBtagLoose jetSelectorBtagLoose;
+    RecoJetCollectionSelectorBtagMedium jetSelectorBtagMedium;
+
+    GenLeptonReader* genLeptonReader = 0;
+    GenHadTauReader* genHadTauReader = 0;
+    GenJetReader* genJetReader = 0;
+    if ( isMC ) {
+      genLeptonReader = new GenLeptonReader("nGenLep", "GenLep");
+      genLeptonReader->setBranchAddresses(eventSource);
+      genHadTauReader = new GenHadTauReader("nGenHadTaus", "GenHadTaus");
+      genHadTauReader->setBranchAddresses(eventSource);
+      genJetReader = new GenJetReader("nGenJet", "GenJet");
+      genJetReader->setBranchAddresses(eventSource);
+    }
+    GenMatchTable genMatchTable;
+
+    RunLumiEventSelector* run_lumi_eventSelector = 0;
+    if ( selEventsFileName_input != "" ) {
+      edm::ParameterSet cfgRunLumiEventSelector;
+      cfgRunLumiEventSelector.addParameter<std::string>("inputFileName", selEventsFileName_input);
+      cfgRunLumiEventSelector.addParameter<std::string>("separator", ":");
+      run_lumi_eventSelector = new RunLumiEventSelector(cfgRunLumiEventSelector);
     }
-    ++analyzedEntries;
+
+//--- selected run:lumi:event numbers and counters of each thread are collected separately
+//    and combined once all threads have finished
+    std::ostream& selEventsFile = selEventsFiles_workers[idxWorker];
+    int& analyzedEntries = analyzedEntries_workers[idxWorker];
+    int& selectedEntries = selectedEntries_workers[idxWorker];
+    double& selectedEntries_weighted = selectedEntries_weighted_workers[idxWorker];
+    histManagers_1l_2tau& histManagers = (*histManagers_workers[idxWorker]);
+
+//--- disable all branches that are not read by any of the readers,
+//    so that TTree::GetEntry does not unzip them
+    eventSource.setBranchStatus();
+    if ( idxWorker == 0 ) eventSource.printManifest(std::cout);
+
+//--- declare the cuts of the event selection, in the order in which they are applied
+    CutFlowTable& cutFlow = cutFlow_workers[idxWorker];
+    const int cut_runLumiEvent = cutFlow.addCut("run:lumi:event selection");
+    const int cut_trigger = cutFlow.addCut("trigger");
+    const int cut_preselLeptons = cutFlow.addCut("1 presel lepton");
+    const int cut_preselLeptons_trigger = cutFlow.addCut("presel lepton trigger match");
+    const int cut_preselHadTaus = cutFlow.addCut(">= 2 presel taus");
+    const int cut_preselJets = cutFlow.addCut(">= 2 jets (presel)");
+    const int cut_preselBJets = cutFlow.addCut(">= 2 loose b-jets || >= 1 medium b-jet (presel)");
+    const int cut_selLeptons = cutFlow.addCut("1 sel lepton");
+    const int cut_selLeptons_trigger = cutFlow.addCut("sel lepton trigger match");
+    const int cut_selHadTaus = cutFlow.addCut(">= 2 sel taus");
+    const int cut_selJets = cutFlow.addCut(">= 4 jets");
+    const int cut_selBJets = cutFlow.addCut(">= 2 loose b-jets || >= 1 medium b-jet");
+    const int cut_leptonPt = cutFlow.addCut("lepton pT > 20 GeV");
+    const int cut_charge = cutFlow.addCut("tau charge");
+    const int cut_metLD = cutFlow.addCut("met_LD > 0.2");
+    const int cut_tightHadTauVeto = cutFlow.addCut("< 2 tight taus (fakeable)");
+
+    lock.unlock();
+
+    for ( Long64_t idxEntry = entryRanges[idxWorker].firstEntry(); idxEntry < entryRanges[idxWorker].lastEntry(); ++idxEntry ) {
+      if ( analyzedEntries > 0 && (analyzedEntries % reportEvery) == 0 ) {
+        std::lock_guard<std::mutex> lock_cout(coutMutex);
+        std::cout << "processing Entry " << idxEntry << " (" << selectedEntries << " Entries selected)" << std::endl;
+      }
+      ++analyzedEntries;
+
+      cutFlow.startEvent();
     
-    inputTree->GetEntry(idxEntry);
+      eventSource.getEntry(idxEntry);
 
-    if ( run_lumi_eventSelector && !(*run_lumi_eventSelector)(run, lumi, event) ) continue;
+      if ( !cutFlow(cut_runLumiEvent, !run_lumi_eventSelector || (*run_lumi_eventSelector)(run, lumi, event), lumiScale) ) continue;
 
-    bool isTriggered_1e = use_triggers_1e && hltPaths_isTriggered(triggers_1e);
-    bool isTriggered_1mu = use_triggers_1mu && hltPaths_isTriggered(triggers_1mu);
-    if ( !(isTriggered_1e || isTriggered_1mu) ) continue;
+      bool isTriggered_1e = use_triggers_1e && hltPaths_isTriggered(triggers_1e);
+      bool isTriggered_1mu = use_triggers_1mu && hltPaths_isTriggered(triggers_1mu);
+      if ( !cutFlow(cut_trigger, isTriggered_1e || isTriggered_1mu, lumiScale) ) continue;
 
 //--- build collections of electrons, muons and hadronic taus;
 //    resolve overlaps in order of priority: muon, electron,
-    std::vector<RecoMuon> muons = muonReader->read();
-    std::vector<const RecoMuon*> muon_ptrs = convert_to_ptrs(muons);
-    std::vector<const RecoMuon*> cleanedMuons = muon_ptrs; // CV: no cleaning needed for muons, as they have the highest priority in the overlap removal
-    std::vector<const RecoMuon*> preselMuons = preselMuonSelector(cleanedMuons);
-    std::vector<const RecoMuon*> selMuons = tightMuonSelector(preselMuons);
+      std::vector<RecoMuon> muons = muonReader->read();
+      std::vector<const RecoMuon*> muon_ptrs = convert_to_ptrs(muons);
+      std::vector<const RecoMuon*> cleanedMuons = muon_ptrs; // CV: no cleaning needed for muons, as they have the highest priority in the overlap removal
+      muonSelector(cleanedMuons, muonSelection);
+      std::vector<const RecoMuon*> preselMuons = muonSelection.filter(kSelectionLoose);
+      std::vector<const RecoMuon*> selMuons = muonSelection.filter(kSelectionLoose | kSelectionTight);
     
-    std::vector<RecoElectron> electrons = electronReader->read();
-    std::vector<const RecoElectron*> electron_ptrs = convert_to_ptrs(electrons);
-    std::vector<const RecoElectron*> cleanedElectrons = electronCleaner(electron_ptrs, selMuons);
-    std::vector<const RecoElectron*> preselElectrons = preselElectronSelector(cleanedElectrons);
-    std::vector<const RecoElectron*> selElectrons = tightElectronSelector(preselElectrons);
-
-    std::vector<RecoHadTau> hadTaus = hadTauReader->read();
-    std::vector<const RecoHadTau*> hadTau_ptrs = convert_to_ptrs(hadTaus);
-    std::vector<const RecoHadTau*> cleanedHadTaus = hadTauCleaner(hadTau_ptrs, selMuons, selElectrons);
-    std::vector<const RecoHadTau*> preselHadTaus = preselHadTauSelector(cleanedHadTaus);
-    std::vector<const RecoHadTau*> fakeableHadTaus = fakeableHadTauSelector(preselHadTaus);
-    std::vector<const RecoHadTau*> tightHadTaus = tightHadTauSelector(preselHadTaus);
-    std::vector<const RecoHadTau*> selHadTaus;
-    if      ( hadTauSelection == kLoose    ) selHadTaus = preselHadTaus;
-    else if ( hadTauSelection == kFakeable ) selHadTaus = fakeableHadTaus;
-    else if ( hadTauSelection == kTight    ) selHadTaus = tightHadTaus;
-    else assert(0);
-    std::sort(selHadTaus.begin(), selHadTaus.end(), isHigherPt);
+      std::vector<RecoElectron> electrons = electronReader->read();
+      std::vector<const RecoElectron*> electron_ptrs = convert_to_ptrs(electrons);
+      std::vector<const RecoElectron*> cleanedElectrons = electronCleaner(electron_ptrs, selMuons);
+      electronSelector(cleanedElectrons, electronSelection);
+      std::vector<const RecoElectron*> preselElectrons = electronSelection.filter(kSelectionLoose);
+      std::vector<const RecoElectron*> selElectrons = electronSelection.filter(kSelectionLoose | kSelectionTight);
+
+      std::vector<RecoHadTau> hadTaus = hadTauReader->read();
+      std::vector<const RecoHadTau*> hadTau_ptrs = convert_to_ptrs(hadTaus);
+      std::vector<const RecoHadTau*> cleanedHadTaus = hadTauCleaner(hadTau_ptrs, selMuons, selElectrons);
+      hadTauSelector(cleanedHadTaus, hadTauSelectionResults);
+      std::vector<const RecoHadTau*> preselHadTaus = hadTauSelectionResults.filter(kSelectionLoose);
+      std::vector<const RecoHadTau*> fakeableHadTaus = hadTauSelectionResults.filter(kSelectionLoose | kSelectionFakeable);
+      std::vector<const RecoHadTau*> tightHadTaus = hadTauSelectionResults.filter(kSelectionLoose | kSelectionTight);
+      std::vector<const RecoHadTau*> selHadTaus;
+      if      ( hadTauSelection == kLoose    ) selHadTaus = preselHadTaus;
+      else if ( hadTauSelection == kFakeable ) selHadTaus = fakeableHadTaus;
+      else if ( hadTauSelection == kTight    ) selHadTaus = tightHadTaus;
+      else assert(0);
+      std::sort(selHadTaus.begin(), selHadTaus.end(), isHigherPt);
     
 //--- build collections of jets and select subset of jets passing b-tagging criteria
-    std::vector<RecoJet> jets = jetReader->read();
-    std::vector<const RecoJet*> jet_ptrs = convert_to_ptrs(jets);
-    std::vector<const RecoJet*> cleanedJets = jetCleaner(jet_ptrs, selMuons, selElectrons, selHadTaus);
-    std::vector<const RecoJet*> selJets = jetSelector(cleanedJets);
-    std::vector<const RecoJet*> selBJets_loose = jetSelectorBtagLoose(cleanedJets);
-    std::vector<const RecoJet*> selBJets_medium = jetSelectorBtagMedium(cleanedJets);
+      std::vector<RecoJet> jets = jetReader->read();
+      std::vector<const RecoJet*> jet_ptrs = convert_to_ptrs(jets);
+      std::vector<const RecoJet*> cleanedJets = jetCleaner(jet_ptrs, selMuons, selElectrons, selHadTaus);
+      std::vector<const RecoJet*> selJets = jetSelector(cleanedJets);
+      std::vector<const RecoJet*> selBJets_loose = jetSelectorBtagLoose(cleanedJets);
+      std::vector<const RecoJet*> selBJets_medium = jetSelectorBtagMedium(cleanedJets);
 
 //--- build collections of generator level particles
-    std::vector<GenLepton> genLeptons;
-    std::vector<GenLepton> genElectrons;
-    std::vector<GenLepton> genMuons;
-    std::vector<GenHadTau> genHadTaus;
-    std::vector<GenJet> genJets;
-    if ( isMC ) {
-      genLeptons = genLeptonReader->read();
-      for ( std::vector<GenLepton>::const_iterator genLepton = genLeptons.begin();
-	    genLepton != genLeptons.end(); ++genLepton ) {
-	int abs_pdgId = std::abs(genLepton->pdgId_);
-	if      ( abs_pdgId == 11 ) genElectrons.push_back(*genLepton);
-	else if ( abs_pdgId == 13 ) genMuons.push_back(*genLepton);
+      std::vector<GenLepton> genLeptons;
+      std::vector<GenLepton> genElectrons;
+      std::vector<GenLepton> genMuons;
+      std::vector<GenHadTau> genHadTaus;
+      std::vector<GenJet> genJets;
+      if ( isMC ) {
+        genLeptons = genLeptonReader->read();
+        for ( std::vector<GenLepton>::const_iterator genLepton = genLeptons.begin();
+	      genLepton != genLeptons.end(); ++genLepton ) {
+	  int abs_pdgId = std::abs(genLepton->pdgId_);
+	  if      ( abs_pdgId == 11 ) genElectrons.push_back(*genLepton);
+	  else if ( abs_pdgId == 13 ) genMuons.push_back(*genLepton);
+        }
+        genHadTaus = genHadTauReader->read();
+        genJets = genJetReader->read();
       }
-      genHadTaus = genHadTauReader->read();
-      genJets = genJetReader->read();
-    }
 
 //--- match reconstructed to generator level particles
-    if ( isMC ) {
-      muonGenMatcher.addGenLeptonMatch(preselMuons, genLeptons, 0.3);
-      muonGenMatcher.addGenHadTauMatch(preselMuons, genHadTaus, 0.3);
-      muonGenMatcher.addGenJetMatch(preselMuons, genJets, 0.5);
-
-      electronGenMatcher.addGenLeptonMatch(preselElectrons, genLeptons, 0.3);
-      electronGenMatcher.addGenHadTauMatch(preselElectrons, genHadTaus, 0.3);
-      electronGenMatcher.addGenJetMatch(preselElectrons, genJets, 0.5);
-
-      hadTauGenMatcher.addGenLeptonMatch(preselHadTaus, genLeptons, 0.3);
-      hadTauGenMatcher.addGenHadTauMatch(preselHadTaus, genHadTaus, 0.3);
-      hadTauGenMatcher.addGenJetMatch(preselHadTaus, genJets, 0.5);
-
-      jetGenMatcher.addGenLeptonMatch(selJets, genLeptons, 0.3);
-      jetGenMatcher.addGenHadTauMatch(selJets, genHadTaus, 0.3);
-      jetGenMatcher.addGenJetMatch(selJets, genJets, 0.5);
-    }
+      genMatchTable.clear();
+      if ( isMC ) {
+        genMatchTable.setGenParticles(genLeptons, genHadTaus, genJets);
+        genMatchTable.addRecParticles(muons, preselMuons);
+        genMatchTable.addRecParticles(electrons, preselElectrons);
+        genMatchTable.addRecParticles(hadTaus, preselHadTaus);
+        genMatchTable.addRecParticles(jets, selJets);
+        genMatchTable.computeGenMatches();
+      }
 
 //--- apply preselection
-    std::vector<const RecoLepton*> preselLeptons;    
-    preselLeptons.reserve(preselElectrons.size() + preselMuons.size());
-    preselLeptons.insert(preselLeptons.end(), preselElectrons.begin(), preselElectrons.end());
-    preselLeptons.insert(preselLeptons.end(), preselMuons.begin(), preselMuons.end());
-    std::sort(preselLeptons.begin(), preselLeptons.end(), isHigherPt);
-    // require exactly one lepton passing loose preselection criteria
-    if ( !(preselLeptons.size() == 1) ) continue;
-    const RecoLepton* preselLepton = preselLeptons[0];
-    int preselLepton_type = getLeptonType(preselLepton->pdgId_);
-
-    // require that trigger paths match event category (with event category based on preselLeptons)
-    if ( preselElectrons.size() == 1 && !isTriggered_1e  ) continue;
-    if ( preselMuons.size()     == 1 && !isTriggered_1mu ) continue;
-
-    // require presence of at least two hadronic taus passing loose preselection criteria
-    // (do not veto events with more than two loosely selected hadronic tau candidates,
-    //  as sample of hadronic tau candidates passing loose preselection criteria contains significant contamination from jets)
-    std::sort(preselHadTaus.begin(), preselHadTaus.end(), isHigherPt);
-    if ( !(preselHadTaus.size() >= 2) ) continue;
-    const RecoHadTau* preselHadTau_lead = preselHadTaus[0];
-    const RecoHadTau* preselHadTau_sublead = preselHadTaus[1];
-    double mTauTauVis_presel = (preselHadTau_lead->p4_ + preselHadTau_sublead->p4_).mass();
-
-    // apply requirement on jets (incl. b-tagged jets) on preselection level
-    if ( !(selJets.size() >= 2) ) continue;
-    if ( !(selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1) ) continue;
+      std::vector<const RecoLepton*> preselLeptons;    
+      preselLeptons.reserve(preselElectrons.size() + preselMuons.size());
+      preselLeptons.insert(preselLeptons.end(), preselElectrons.begin(), preselElectrons.end());
+      preselLeptons.insert(preselLeptons.end(), preselMuons.begin(), preselMuons.end());
+      std::sort(preselLeptons.begin(), preselLeptons.end(), isHigherPt);
+      // require exactly one lepton passing loose preselection criteria
+      if ( !cutFlow(cut_preselLeptons, preselLeptons.size() == 1, lumiScale) ) continue;
+      const RecoLepton* preselLepton = preselLeptons[0];
+      int preselLepton_type = getLeptonType(preselLepton->pdgId_);
+
+      // require that trigger paths match event category (with event category based on preselLeptons)
+      bool failsTriggerMatch_presel = (preselElectrons.size() == 1 && !isTriggered_1e) || (preselMuons.size() == 1 && !isTriggered_1mu);
+      if ( !cutFlow(cut_preselLeptons_trigger, !failsTriggerMatch_presel, lumiScale) ) continue;
+
+      // require presence of at least two hadronic taus passing loose preselection criteria
+      // (do not veto events with more than two loosely selected hadronic tau candidates,
+      //  as sample of hadronic tau candidates passing loose preselection criteria contains significant contamination from jets)
+      std::sort(preselHadTaus.begin(), preselHadTaus.end(), isHigherPt);
+      if ( !cutFlow(cut_preselHadTaus, preselHadTaus.size() >= 2, lumiScale) ) continue;
+      const RecoHadTau* preselHadTau_lead = preselHadTaus[0];
+      const RecoHadTau* preselHadTau_sublead = preselHadTaus[1];
+      double mTauTauVis_presel = (preselHadTau_lead->p4() + preselHadTau_sublead->p4()).mass();
+
+      // apply requirement on jets (incl. b-tagged jets) on preselection level
+      if ( !cutFlow(cut_preselJets, selJets.size() >= 2, lumiScale) ) continue;
+      if ( !cutFlow(cut_preselBJets, selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1, lumiScale) ) continue;
 
 //--- compute MHT and linear MET discriminant (met_LD)
-    LV mht_p4(0,0,0,0);
-    for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
-	  jet != selJets.end(); ++jet ) {
-      mht_p4 += (*jet)->p4_;
-    }
-    for ( std::vector<const RecoLepton*>::const_iterator lepton = preselLeptons.begin();
-	  lepton != preselLeptons.end(); ++lepton ) {
-      mht_p4 += (*lepton)->p4_;
-    }
-    for ( std::vector<const RecoHadTau*>::const_iterator hadTau = selHadTaus.begin();
-	  hadTau != selHadTaus.end(); ++hadTau ) {
-      mht_p4 += (*hadTau)->p4_;
-    }
-    double met_LD = met_coef*met_p4.pt() + mht_coef*mht_p4.pt();    
+      LV mht_p4(0,0,0,0);
+      for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
+	    jet != selJets.end(); ++jet ) {
+        mht_p4 += (*jet)->p4();
+      }
+      for ( std::vector<const RecoLepton*>::const_iterator lepton = preselLeptons.begin();
+	    lepton != preselLeptons.end(); ++lepton ) {
+        mht_p4 += (*lepton)->p4();
+      }
+      for ( std::vector<const RecoHadTau*>::const_iterator hadTau = selHadTaus.begin();
+	    hadTau != selHadTaus.end(); ++hadTau ) {
+        mht_p4 += (*hadTau)->p4();
+      }
+      double met_LD = met_coef*met_p4.pt() + mht_coef*mht_p4.pt();    
 
 //--- compute event-level weight for data/MC correction of b-tagging efficiency and mistag rate
 //   (using the method "Event reweighting using scale factors calculated with a tag and probe method", 
 //    described on the BTV POG twiki https://twiki.cern.ch/twiki/bin/view/CMS/BTagShapeCalibration )
-    double evtWeight = lumiScale;
-    for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
-	  jet != selJets.end(); ++jet ) {
-      evtWeight *= (*jet)->BtagWeight_;
-    }
+      double evtWeight = lumiScale;
+      for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
+	    jet != selJets.end(); ++jet ) {
+        evtWeight *= (*jet)->BtagWeight_;
+      }
 
 //--- apply data/MC corrections for trigger efficiency,
 //    and efficiencies for lepton to pass loose identification and isolation criteria
-    if ( isMC ) {
-      evtWeight *= sf_triggerEff(preselLepton_type, preselLepton->pt_, preselLepton->eta_);
-      evtWeight *= sf_leptonID_and_Iso_loose(preselLepton_type, preselLepton->pt_, preselLepton->eta_);
-    }       
+      if ( isMC ) {
+        evtWeight *= sf_triggerEff(preselLepton_type, preselLepton->pt_, preselLepton->eta_);
+        evtWeight *= sf_leptonID_and_Iso_loose(preselLepton_type, preselLepton->pt_, preselLepton->eta_);
+      }       
 
 //--- fill histograms with events passing preselection
-    preselMuonHistManager.fillHistograms(preselMuons, evtWeight);
-    preselElectronHistManager.fillHistograms(preselElectrons, evtWeight);
-    preselHadTauHistManager.fillHistograms(preselHadTaus, evtWeight);
-    preselHadTauHistManager_lead.fillHistograms(preselHadTaus, evtWeight);
-    preselHadTauHistManager_sublead.fillHistograms(preselHadTaus, evtWeight);
-    preselJetHistManager.fillHistograms(selJets, evtWeight);
-    selBJet_looseHistManager.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_mediumHistManager.fillHistograms(selBJets_medium, evtWeight);
-    preselMEtHistManager.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
-    preselEvtHistManager.fillHistograms(selJets.size(), mTauTauVis_presel, evtWeight);
+      histManagers.preselMuonHistManager_.fillHistograms(preselMuons, genMatchTable, evtWeight);
+      histManagers.preselElectronHistManager_.fillHistograms(preselElectrons, genMatchTable, evtWeight);
+      histManagers.preselHadTauHistManager_.fillHistograms(preselHadTaus, genMatchTable, evtWeight);
+      histManagers.preselHadTauHistManager_lead_.fillHistograms(preselHadTaus, genMatchTable, evtWeight);
+      histManagers.preselHadTauHistManager_sublead_.fillHistograms(preselHadTaus, genMatchTable, evtWeight);
+      histManagers.preselJetHistManager_.fillHistograms(selJets, genMatchTable, evtWeight);
+      histManagers.selBJet_looseHistManager_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+      histManagers.selBJet_mediumHistManager_.fillHistograms(selBJets_medium, genMatchTable, evtWeight);
+      histManagers.preselMEtHistManager_.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
+      histManagers.preselEvtHistManager_.fillHistograms(selJets.size(), mTauTauVis_presel, evtWeight);
 
 //--- apply final event selection 
-    std::vector<const RecoLepton*> selLeptons;    
-    selLeptons.reserve(selElectrons.size() + selMuons.size());
-    selLeptons.insert(selLeptons.end(), selElectrons.begin(), selElectrons.end());
-    selLeptons.insert(selLeptons.end(), selMuons.begin(), selMuons.end());
-    std::sort(selLeptons.begin(), selLeptons.end(), isHigherPt);
-    // require exactly one lepton passing tight selection criteria of final event selection 
-    if ( !(selLeptons.size() == 1) ) continue;
-    const RecoLepton* selLepton = selLeptons[0];
-
-    // require that trigger paths match event category (with event category based on selLeptons)
-    if ( selElectrons.size() == 1 && !isTriggered_1e  ) continue;
-    if ( selMuons.size()     == 1 && !isTriggered_1mu ) continue;
-
-    // require presence of exactly two hadronic taus passing tight selection criteria of final event selection
-    std::sort(selHadTaus.begin(), selHadTaus.end(), isHigherPt);
-    if ( !(selHadTaus.size() >= 2) ) continue;
-    const RecoHadTau* selHadTau_lead = selHadTaus[0];
-    const RecoHadTau* selHadTau_sublead = selHadTaus[1];
-    double mTauTauVis = (selHadTau_lead->p4_ + selHadTau_sublead->p4_).mass();
-
-    // apply requirement on jets (incl. b-tagged jets) and hadronic taus on level of final event selection
-    if ( !(selJets.size() >= 4) ) continue;
-    if ( !(selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1) ) continue;
+      std::vector<const RecoLepton*> selLeptons;    
+      selLeptons.reserve(selElectrons.size() + selMuons.size());
+      selLeptons.insert(selLeptons.end(), selElectrons.begin(), selElectrons.end());
+      selLeptons.insert(selLeptons.end(), selMuons.begin(), selMuons.end());
+      std::sort(selLeptons.begin(), selLeptons.end(), isHigherPt);
+      // require exactly one lepton passing tight selection criteria of final event selection 
+      if ( !cutFlow(cut_selLeptons, selLeptons.size() == 1, evtWeight) ) continue;
+      const RecoLepton* selLepton = selLeptons[0];
+
+      // require that trigger paths match event category (with event category based on selLeptons)
+      bool failsTriggerMatch_sel = (selElectrons.size() == 1 && !isTriggered_1e) || (selMuons.size() == 1 && !isTriggered_1mu);
+      if ( !cutFlow(cut_selLeptons_trigger, !failsTriggerMatch_sel, evtWeight) ) continue;
+
+      // require presence of exactly two hadronic taus passing tight selection criteria of final event selection
+      std::sort(selHadTaus.begin(), selHadTaus.end(), isHigherPt);
+      if ( !cutFlow(cut_selHadTaus, selHadTaus.size() >= 2, evtWeight) ) continue;
+      const RecoHadTau* selHadTau_lead = selHadTaus[0];
+      const RecoHadTau* selHadTau_sublead = selHadTaus[1];
+      double mTauTauVis = (selHadTau_lead->p4() + selHadTau_sublead->p4()).mass();
+
+      // apply requirement on jets (incl. b-tagged jets) and hadronic taus on level of final event selection
+      if ( !cutFlow(cut_selJets, selJets.size() >= 4, evtWeight) ) continue;
+      if ( !cutFlow(cut_selBJets, selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1, evtWeight) ) continue;
  
-    double minPt = 20.;
-    if ( !(selLepton->pt_ > minPt) ) continue;
+      double minPt = 20.;
+      if ( !cutFlow(cut_leptonPt, selLepton->pt_ > minPt, evtWeight) ) continue;
 
-    bool isCharge_SS = selHadTau_lead->charge_*selHadTau_sublead->charge_ > 0;
-    bool isCharge_OS = selHadTau_lead->charge_*selHadTau_sublead->charge_ < 0;
-    if ( chargeSelection == kOS && isCharge_SS ) continue;
-    if ( chargeSelection == kSS && isCharge_OS ) continue;
+      bool isCharge_SS = selHadTau_lead->charge_*selHadTau_sublead->charge_ > 0;
+      bool isCharge_OS = selHadTau_lead->charge_*selHadTau_sublead->charge_ < 0;
+      bool failsChargeSelection = (chargeSelection == kOS && isCharge_SS) || (chargeSelection == kSS && isCharge_OS);
+      if ( !cutFlow(cut_charge, !failsChargeSelection, evtWeight) ) continue;
 
-    if ( met_LD < 0.2 ) continue;
+      if ( !cutFlow(cut_metLD, met_LD >= 0.2, evtWeight) ) continue;
     
-    if ( hadTauSelection == kFakeable && tightHadTaus.size() >= 2 ) continue; // CV: avoid overlap with signal region
+      // CV: avoid overlap with signal region
+      if ( !cutFlow(cut_tightHadTauVeto, !(hadTauSelection == kFakeable && tightHadTaus.size() >= 2), evtWeight) ) continue;
 
 //--- apply data/MC corrections for efficiencies of leptons passing the loose identification and isolation criteria
 //    to also pass the tight identification and isolation criteria
-    if ( isMC ) {
-      double sf_tight_to_loose = sf_leptonID_and_Iso_tight_to_loose(preselLepton_type, preselLepton->pt_, preselLepton->eta_);
-      evtWeight *= sf_tight_to_loose;
-    }
+      if ( isMC ) {
+        double sf_tight_to_loose = sf_leptonID_and_Iso_tight_to_loose(preselLepton_type, preselLepton->pt_, preselLepton->eta_);
+        evtWeight *= sf_tight_to_loose;
+      }
 
 //--- 
-    if ( applyJetToTauFakeRateWeight ) {
-      double selHadTau_lead_pt = selHadTau_lead->pt_;
-      double selHadTau_lead_absEta = std::fabs(selHadTau_lead->eta_);
-      double selHadTau_sublead_pt = selHadTau_sublead->pt_;
-      double selHadTau_sublead_absEta = std::fabs(selHadTau_sublead->eta_);
-      particleIDlooseToTightWeightEntryType* jetToTauFakeRateWeight_tauEtaBin = 0;
-      for ( std::vector<particleIDlooseToTightWeightEntryType*>::const_iterator jetToTauFakeRateWeight = jetToTauFakeRateWeights.begin();
-            jetToTauFakeRateWeight != jetToTauFakeRateWeights.end(); ++jetToTauFakeRateWeight ) {
-        if ( ((*jetToTauFakeRateWeight)->particle1EtaMin_ < 0. || selHadTau_lead_absEta    > (*jetToTauFakeRateWeight)->particle1EtaMin_) &&
-             ((*jetToTauFakeRateWeight)->particle1EtaMax_ > 5. || selHadTau_lead_absEta    < (*jetToTauFakeRateWeight)->particle1EtaMax_) &&
-             ((*jetToTauFakeRateWeight)->particle2EtaMin_ < 0. || selHadTau_sublead_absEta > (*jetToTauFakeRateWeight)->particle2EtaMin_) &&
-             ((*jetToTauFakeRateWeight)->particle2EtaMax_ > 5. || selHadTau_sublead_absEta < (*jetToTauFakeRateWeight)->particle2EtaMax_) ) {
-          jetToTauFakeRateWeight_tauEtaBin = (*jetToTauFakeRateWeight);
-          break;
+      if ( applyJetToTauFakeRateWeight ) {
+        double selHadTau_lead_pt = selHadTau_lead->pt_;
+        double selHadTau_lead_absEta = std::fabs(selHadTau_lead->eta_);
+        double selHadTau_sublead_pt = selHadTau_sublead->pt_;
+        double selHadTau_sublead_absEta = std::fabs(selHadTau_sublead->eta_);
+        particleIDlooseToTightWeightEntryType* jetToTauFakeRateWeight_tauEtaBin = 0;
+        for ( std::vector<particleIDlooseToTightWeightEntryType*>::const_iterator jetToTauFakeRateWeight = jetToTauFakeRateWeights.begin();
+              jetToTauFakeRateWeight != jetToTauFakeRateWeights.end(); ++jetToTauFakeRateWeight ) {
+          if ( ((*jetToTauFakeRateWeight)->particle1EtaMin_ < 0. || selHadTau_lead_absEta    > (*jetToTauFakeRateWeight)->particle1EtaMin_) &&
+               ((*jetToTauFakeRateWeight)->particle1EtaMax_ > 5. || selHadTau_lead_absEta    < (*jetToTauFakeRateWeight)->particle1EtaMax_) &&
+               ((*jetToTauFakeRateWeight)->particle2EtaMin_ < 0. || selHadTau_sublead_absEta > (*jetToTauFakeRateWeight)->particle2EtaMin_) &&
+               ((*jetToTauFakeRateWeight)->particle2EtaMax_ > 5. || selHadTau_sublead_absEta < (*jetToTauFakeRateWeight)->particle2EtaMax_) ) {
+            jetToTauFakeRateWeight_tauEtaBin = (*jetToTauFakeRateWeight);
+            break;
+          }
+        }
+        if ( jetToTauFakeRateWeight_tauEtaBin ) {
+          evtWeight *= jetToTauFakeRateWeight_tauEtaBin->weight(selHadTau_lead_pt, selHadTau_sublead_pt);
+        } else {
+          std::cerr << "Warning: leadHadTauEta = " << selHadTau_lead_absEta << ", subleadHadTauEta = " << selHadTau_sublead_absEta << " outside range !!" << std::endl;
         }
       }
-      if ( jetToTauFakeRateWeight_tauEtaBin ) {
-        evtWeight *= jetToTauFakeRateWeight_tauEtaBin->weight(selHadTau_lead_pt, selHadTau_sublead_pt);
-      } else {
-        std::cerr << "Warning: leadHadTauEta = " << selHadTau_lead_absEta << ", subleadHadTauEta = " << selHadTau_sublead_absEta << " outside range !!" << std::endl;
-      }
-    }
 
 //--- fill histograms with events passing final selection 
-    selMuonHistManager.fillHistograms(selMuons, evtWeight);
-    selElectronHistManager.fillHistograms(selElectrons, evtWeight);
-    selHadTauHistManager.fillHistograms(selHadTaus, evtWeight);
-    selJetHistManager.fillHistograms(selJets, evtWeight);
-    selJetHistManager_lead.fillHistograms(selJets, evtWeight);
-    selJetHistManager_sublead.fillHistograms(selJets, evtWeight);
-    selBJet_looseHistManager.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_looseHistManager_lead.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_looseHistManager_sublead.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_mediumHistManager.fillHistograms(selBJets_medium, evtWeight);
-    selMEtHistManager.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
-    selEvtHistManager.fillHistograms(selJets.size(), mTauTauVis, evtWeight);
-
-    int category = -1;
-    if      ( selElectrons.size() == 1 && selBJets_medium.size() >= 1 ) category = k1e_btight;
-    else if ( selElectrons.size() == 1                                ) category = k1e_bloose;
-    else if ( selMuons.size()     == 1 && selBJets_medium.size() >= 1 ) category = k1mu_btight;
-    else if ( selMuons.size()     == 1                                ) category = k1mu_bloose;
-    else assert(0);
-
-    if ( category == k1e_btight ) {
-      selElectronHistManager_category["1e_2tau_btight"]->fillHistograms(selElectrons, evtWeight);
-      selHadTauHistManager_category["1e_2tau_btight"]["leadHadTau"]->fillHistograms(selHadTaus, evtWeight);
-      selHadTauHistManager_category["1e_2tau_btight"]["subleadHadTau"]->fillHistograms(selHadTaus, evtWeight);
-      selEvtHistManager_category["1e_2tau_btight"]->fillHistograms(selJets.size(), mTauTauVis, evtWeight);
-    } else if ( category == k1e_bloose ) {
-      selElectronHistManager_category["1e_2tau_bloose"]->fillHistograms(selElectrons, evtWeight);
-      selHadTauHistManager_category["1e_2tau_bloose"]["leadHadTau"]->fillHistograms(selHadTaus, evtWeight);
-      selHadTauHistManager_category["1e_2tau_bloose"]["subleadHadTau"]->fillHistograms(selHadTaus, evtWeight);
-      selEvtHistManager_category["1e_2tau_bloose"]->fillHistograms(selJets.size(), mTauTauVis, evtWeight);
-    } else if ( category == k1mu_btight ) {
-      selMuonHistManager_category["1mu_2tau_btight"]->fillHistograms(selMuons, evtWeight);
-      selHadTauHistManager_category["1mu_2tau_btight"]["leadHadTau"]->fillHistograms(selHadTaus, evtWeight);
-      selHadTauHistManager_category["1mu_2tau_btight"]["subleadHadTau"]->fillHistograms(selHadTaus, evtWeight);
-      selEvtHistManager_category["1mu_2tau_btight"]->fillHistograms(selJets.size(), mTauTauVis, evtWeight);
-    } else if ( category == k1mu_bloose ) {
-      selMuonHistManager_category["1mu_2tau_btight"]->fillHistograms(selMuons, evtWeight);
-      selHadTauHistManager_category["1mu_2tau_btight"]["leadHadTau"]->fillHistograms(selHadTaus, evtWeight);
-      selHadTauHistManager_category["1mu_2tau_btight"]["subleadHadTau"]->fillHistograms(selHadTaus, evtWeight);
-      selEvtHistManager_category["1mu_2tau_btight"]->fillHistograms(selJets.size(), mTauTauVis, evtWeight);
-    } 
-
-    (*selEventsFile) << run << ":" << lumi << ":" << event;
-
-    ++selectedEntries;
-    selectedEntries_weighted += evtWeight;
+      histManagers.selMuonHistManager_.fillHistograms(selMuons, genMatchTable, evtWeight);
+      histManagers.selElectronHistManager_.fillHistograms(selElectrons, genMatchTable, evtWeight);
+      histManagers.selHadTauHistManager_.fillHistograms(selHadTaus, genMatchTable, evtWeight);
+      histManagers.selJetHistManager_.fillHistograms(selJets, genMatchTable, evtWeight);
+      histManagers.selJetHistManager_lead_.fillHistograms(selJets, genMatchTable, evtWeight);
+      histManagers.selJetHistManager_sublead_.fillHistograms(selJets, genMatchTable, evtWeight);
+      histManagers.selBJet_looseHistManager_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+      histManagers.selBJet_looseHistManager_lead_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+      histManagers.selBJet_looseHistManager_sublead_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+      histManagers.selBJet_mediumHistManager_.fillHistograms(selBJets_medium, genMatchTable, evtWeight);
+      histManagers.selMEtHistManager_.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
+      histManagers.selEvtHistManager_.fillHistograms(selJets.size(), mTauTauVis, evtWeight);
+
+      int category = -1;
+      if      ( selElectrons.size() == 1 && selBJets_medium.size() >= 1 ) category = k1e_btight;
+      else if ( selElectrons.size() == 1                                ) category = k1e_bloose;
+      else if ( selMuons.size()     == 1 && selBJets_medium.size() >= 1 ) category = k1mu_btight;
+      else if ( selMuons.size()     == 1                                ) category = k1mu_bloose;
+      else assert(0);
+
+      if ( category == k1e_btight ) {
+        histManagers.selElectronHistManager_category_["1e_2tau_btight"]->fillHistograms(selElectrons, genMatchTable, evtWeight);
+        histManagers.selHadTauHistManager_category_["1e_2tau_btight"]["leadHadTau"]->fillHistograms(selHadTaus, genMatchTable, evtWeight);
+        histManagers.selHadTauHistManager_category_["1e_2tau_btight"]["subleadHadTau"]->fillHistograms(selHadTaus, genMatchTable, evtWeight);
+        histManagers.selEvtHistManager_category_["1e_2tau_btight"]->fillHistograms(selJets.size(), mTauTauVis, evtWeight);
+      } else if ( category == k1e_bloose ) {
+        histManagers.selElectronHistManager_category_["1e_2tau_bloose"]->fillHistograms(selElectrons, genMatchTable, evtWeight);
+        histManagers.selHadTauHistManager_category_["1e_2tau_bloose"]["leadHadTau"]->fillHistograms(selHadTaus, genMatchTable, evtWeight);
+        histManagers.selHadTauHistManager_category_["1e_2tau_bloose"]["subleadHadTau"]->fillHistograms(selHadTaus, genMatchTable, evtWeight);
+        histManagers.selEvtHistManager_category_["1e_2tau_bloose"]->fillHistograms(selJets.size(), mTauTauVis, evtWeight);
+      } else if ( category == k1mu_btight ) {
+        histManagers.selMuonHistManager_category_["1mu_2tau_btight"]->fillHistograms(selMuons, genMatchTable, evtWeight);
+        histManagers.selHadTauHistManager_category_["1mu_2tau_btight"]["leadHadTau"]->fillHistograms(selHadTaus, genMatchTable, evtWeight);
+        histManagers.selHadTauHistManager_category_["1mu_2tau_btight"]["subleadHadTau"]->fillHistograms(selHadTaus, genMatchTable, evtWeight);
+        histManagers.selEvtHistManager_category_["1mu_2tau_btight"]->fillHistograms(selJets.size(), mTauTauVis, evtWeight);
+      } else if ( category == k1mu_bloose ) {
+        histManagers.selMuonHistManager_category_["1mu_2tau_btight"]->fillHistograms(selMuons, genMatchTable, evtWeight);
+        histManagers.selHadTauHistManager_category_["1mu_2tau_btight"]["leadHadTau"]->fillHistograms(selHadTaus, genMatchTable, evtWeight);
+        histManagers.selHadTauHistManager_category_["1mu_2tau_btight"]["subleadHadTau"]->fillHistograms(selHadTaus, genMatchTable, evtWeight);
+        histManagers.selEvtHistManager_category_["1mu_2tau_btight"]->fillHistograms(selJets.size(), mTauTauVis, evtWeight);
+      } 
+
+      selEventsFile << run << ":" << lumi << ":" << event;
+
+      ++selectedEntries;
+      selectedEntries_weighted += evtWeight;
+    }
+
+    lock.lock();
+
+    delete run_lumi_eventSelector;
+
+    delete muonReader;
+    delete electronReader;
+    delete hadTauReader;
+    delete jetReader;
+    delete genLeptonReader;
+    delete genHadTauReader;
+    delete genJetReader;
+
+    hltPaths_delete(triggers_1e);
+    hltPaths_delete(triggers_1mu);
+
+    delete eventSource_ptr;
+    if ( inputTree_worker != inputTree ) delete inputTree_worker;
+    if ( inputCache_worker != inputCache ) delete inputCache_worker;
+  };
+
+  if ( numThreads == 1 ) {
+    processEntries(0);
+  } else {
+    std::vector<std::exception_ptr> exceptions(numThreads);
+    std::vector<std::thread> workers;
+    for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+      workers.push_back(std::thread([&, idxWorker]() {
+        try {
+          processEntries(idxWorker);
+        } catch ( ... ) {
+          exceptions[idxWorker] = std::current_exception();
+        }
+      }));
+    }
+    for ( std::vector<std::thread>::iterator worker = workers.begin();
+	  worker != workers.end(); ++worker ) {
+      worker->join();
+    }
+    for ( std::vector<std::exception_ptr>::const_iterator exception = exceptions.begin();
+	  exception != exceptions.end(); ++exception ) {
+      if ( (*exception) ) std::rethrow_exception(*exception);
+    }
   }
 
-  std::cout << "num. Entries = " << numEntries << std::endl;
+//--- combine results of all threads, in order of the threads,
+//    so that the output does not depend on the order in which the threads have finished
+  int analyzedEntries = 0;
+  int selectedEntries = 0;
+  double selectedEntries_weighted = 0.;
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    (*selEventsFile) << selEventsFiles_workers[idxWorker].str();
+    analyzedEntries += analyzedEntries_workers[idxWorker];
+    selectedEntries += selectedEntries_workers[idxWorker];
+    selectedEntries_weighted += selectedEntries_weighted_workers[idxWorker];
+    if ( idxWorker > 0 ) {
+      cutFlow_workers[0].merge(cutFlow_workers[idxWorker]);
+      histManagers_workers[0]->merge(*histManagers_workers[idxWorker]);
+    }
+  }
+
+//--- add the events accumulated by the HistManagers to the booked histograms
+//    (the histograms of all threads have been merged into those of the first thread before)
+  HistManagerBase::flushAll();
+
+  std::cout << "num. Entries = " << entryRange.size() << std::endl;
   std::cout << " analyzed = " << analyzedEntries << std::endl;
   std::cout << " selected = " << selectedEntries << " (weighted = " << selectedEntries_weighted << ")" << std::endl;
 
-  delete run_lumi_eventSelector;
+  const CutFlowTable& cutFlow = cutFlow_workers[0];
+  cutFlow.print(std::cout);
+  if ( cutFlowFileName != "" ) {
+    std::ofstream cutFlowFile(cutFlowFileName.data(), std::ios::out);
+    CutFlowTable::writeHeader(cutFlowFile);
+    cutFlow.write(cutFlowFile);
+  }
 
   delete selEventsFile;
 
-  delete muonReader;
-  delete electronReader;
-  delete hadTauReader;
-  delete jetReader;
-  delete genLeptonReader;
-  delete genHadTauReader;
-  delete genJetReader;
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    delete histManagers_workers[idxWorker];
+    // CV: remove copies of histograms filled by threads other than the first from the output file
+    if ( idxWorker > 0 ) fs.getBareDirectory()->rmdir(Form("shard%i", idxWorker));
+  }
 
-  hltPaths_delete(triggers_1e);
-  hltPaths_delete(triggers_1mu);
+  delete inputTree;
+  delete inputCache;
 
   clock.Show("analyze_1l_2tau");
 
   return EXIT_SUCCESS;
 }
-
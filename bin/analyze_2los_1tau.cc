@@ -14,6 +14,7 @@
 #include <TTree.h> // TTree
 #include <TBenchmark.h> // TBenchmark
 #include <TString.h> // TString, Form
+#include <TROOT.h> // ROOT::EnableThreadSafety
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoLepton.h" // RecoLepton
 #include "tthAnalysis/HiggsToTauTau/interface/RecoJet.h" // RecoJet
@@ -31,11 +32,16 @@
 #include "tthAnalysis/HiggsToTauTau/interface/GenLeptonReader.h" // GenLeptonReader
 #include "tthAnalysis/HiggsToTauTau/interface/GenHadTauReader.h" // GenHadTauReader
 #include "tthAnalysis/HiggsToTauTau/interface/GenJetReader.h" // GenJetReader
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource
+#include "tthAnalysis/HiggsToTauTau/interface/ColumnarCache.h" // ColumnarCacheReader
+#include "tthAnalysis/HiggsToTauTau/interface/EntryRange.h" // EntryRange, getClusterBoundaries, splitEntryRange
 #include "tthAnalysis/HiggsToTauTau/interface/convert_to_ptrs.h" // convert_to_ptrs
 #include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionCleaner.h" // RecoElectronCollectionCleaner, RecoMuonCollectionCleaner, RecoHadTauCollectionCleaner, RecoJetCollectionCleaner
-#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionGenMatcher.h" // RecoElectronCollectionGenMatcher, RecoMuonCollectionGenMatcher, RecoHadTauCollectionGenMatcher, RecoJetCollectionGenMatcher
+#include "tthAnalysis/HiggsToTauTau/interface/GenMatchTable.h" // GenMatchTable
 #include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionSelector.h" // RecoElectronSelectorLoose, RecoElectronSelectorTight, RecoMuonSelectorLoose, RecoMuonSelectorTight, RecoHadTauSelectorTight
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionMultiSelector.h" // RecoMuonCollectionMultiSelector, RecoElectronCollectionMultiSelector, RecoHadTauCollectionMultiSelector
 #include "tthAnalysis/HiggsToTauTau/interface/RunLumiEventSelector.h" // RunLumiEventSelector
+#include "tthAnalysis/HiggsToTauTau/interface/CutFlowTable.h" // CutFlowTable
 #include "tthAnalysis/HiggsToTauTau/interface/ElectronHistManager.h" // ElectronHistManager
 #include "tthAnalysis/HiggsToTauTau/interface/MuonHistManager.h" // MuonHistManager
 #include "tthAnalysis/HiggsToTauTau/interface/HadTauHistManager.h" // HadTauHistManager
@@ -54,6 +60,10 @@
 #include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
 #include <algorithm> // std::sort
 #include <fstream> // std::ofstream
+#include <sstream> // std::ostringstream
+#include <thread> // std::thread
+#include <mutex> // std::mutex, std::unique_lock, std::lock_guard
+#include <exception> // std::exception_ptr, std::current_exception, std::rethrow_exception
 #include <assert.h> // assert
 
 typedef math::PtEtaPhiMLorentzVector LV;
@@ -77,6 +87,238 @@ bool isHigherPt(const GenParticle* particle1, const GenParticle* particle2)
   return (particle1->pt_ > particle2->pt_);
 }
 
+/**
+ * @brief Collection of all histograms booked and filled in the 2los_1tau categories
+ */
+struct histManagers_2los_1tau
+{
+  histManagers_2los_1tau(TFileDirectory& dir, const std::string& process_string, const std::string& leptonSelection_string, const std::string& central_or_shift);
+  ~histManagers_2los_1tau();
+
+  /**
+   * @brief Add histograms filled by another thread
+   */
+  void merge(const histManagers_2los_1tau& shard);
+
+  ElectronHistManager preselElectronHistManager_;
+  MuonHistManager preselMuonHistManager_;
+  HadTauHistManager preselHadTauHistManager_;
+  JetHistManager preselJetHistManager_;
+  JetHistManager preselBJet_looseHistManager_;
+  JetHistManager preselBJet_mediumHistManager_;
+  MEtHistManager preselMEtHistManager_;
+  EvtHistManager_2los_1tau preselEvtHistManager_;
+
+  ElectronHistManager selElectronHistManager_;
+  std::map<std::string, std::map<std::string, ElectronHistManager*>> selElectronHistManager_category_; // key = category, "leadElectron"/"subleadElectron"/"electron"
+  MuonHistManager selMuonHistManager_;
+  std::map<std::string, std::map<std::string, MuonHistManager*>> selMuonHistManager_category_; // key = category, "leadMuon"/"subleadMuon"/"muon"
+  HadTauHistManager selHadTauHistManager_;
+  JetHistManager selJetHistManager_;
+  JetHistManager selJetHistManager_lead_;
+  JetHistManager selJetHistManager_sublead_;
+  JetHistManager selBJet_looseHistManager_;
+  JetHistManager selBJet_looseHistManager_lead_;
+  JetHistManager selBJet_looseHistManager_sublead_;
+  JetHistManager selBJet_mediumHistManager_;
+  MEtHistManager selMEtHistManager_;
+  EvtHistManager_2los_1tau selEvtHistManager_;
+  std::map<std::string, EvtHistManager_2los_1tau*> selEvtHistManager_category_; // key = category
+};
+
+histManagers_2los_1tau::histManagers_2los_1tau(TFileDirectory& dir, const std::string& process_string, const std::string& leptonSelection_string, const std::string& central_or_shift)
+  : preselElectronHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/presel/electrons", leptonSelection_string.data()), central_or_shift))
+  , preselMuonHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/presel/muons", leptonSelection_string.data()), central_or_shift))
+  , preselHadTauHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/presel/hadTaus", leptonSelection_string.data()), central_or_shift))
+  , preselJetHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/presel/jets", leptonSelection_string.data()), central_or_shift))
+  , preselBJet_looseHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/presel/BJets_loose", leptonSelection_string.data()), central_or_shift))
+  , preselBJet_mediumHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/presel/BJets_medium", leptonSelection_string.data()), central_or_shift))
+  , preselMEtHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/presel/met", leptonSelection_string.data()), central_or_shift))
+  , preselEvtHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/presel/evt", leptonSelection_string.data()), central_or_shift))
+  , selElectronHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/sel/electrons", leptonSelection_string.data()), central_or_shift))
+  , selMuonHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/sel/muons", leptonSelection_string.data()), central_or_shift))
+  , selHadTauHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/sel/hadTaus", leptonSelection_string.data()), central_or_shift))
+  , selJetHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/sel/jets", leptonSelection_string.data()), central_or_shift))
+  , selJetHistManager_lead_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/sel/leadJet", leptonSelection_string.data()), central_or_shift, 0))
+  , selJetHistManager_sublead_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/sel/subleadJet", leptonSelection_string.data()), central_or_shift, 1))
+  , selBJet_looseHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/sel/BJets_loose", leptonSelection_string.data()), central_or_shift))
+  , selBJet_looseHistManager_lead_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/sel/leadBJet_loose", leptonSelection_string.data()), central_or_shift, 0))
+  , selBJet_looseHistManager_sublead_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/sel/subleadBJet_loose", leptonSelection_string.data()), central_or_shift, 1))
+  , selBJet_mediumHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/sel/BJets_medium", leptonSelection_string.data()), central_or_shift))
+  , selMEtHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/sel/met", leptonSelection_string.data()), central_or_shift))
+  , selEvtHistManager_(makeHistManager_cfg(process_string,
+      Form("2los_1tau_%s/sel/evt", leptonSelection_string.data()), central_or_shift))
+{
+  preselElectronHistManager_.bookHistograms(dir);
+  preselMuonHistManager_.bookHistograms(dir);
+  preselHadTauHistManager_.bookHistograms(dir);
+  preselJetHistManager_.bookHistograms(dir);
+  preselBJet_looseHistManager_.bookHistograms(dir);
+  preselBJet_mediumHistManager_.bookHistograms(dir);
+  preselMEtHistManager_.bookHistograms(dir);
+  preselEvtHistManager_.bookHistograms(dir);
+
+  selElectronHistManager_.bookHistograms(dir);
+  vstring categories_e = {
+    "2eos_1tau_bloose", "2eos_1tau_btight",
+    "1e1muos_1tau_bloose", "1e1muos_1tau_btight" };
+  for ( vstring::const_iterator category = categories_e.begin();
+	category != categories_e.end(); ++category ) {
+    if ( category->find("2eos") != std::string::npos ) {
+      ElectronHistManager* selElectronHistManager_lead = new ElectronHistManager(makeHistManager_cfg(process_string,
+	Form("%s_%s/sel/leadElectron", category->data(), leptonSelection_string.data()), central_or_shift, 0));
+      selElectronHistManager_lead->bookHistograms(dir);
+      selElectronHistManager_category_[*category]["leadElectron"] = selElectronHistManager_lead;
+      ElectronHistManager* selElectronHistManager_sublead = new ElectronHistManager(makeHistManager_cfg(process_string,
+	Form("%s_%s/sel/subleadElectron", category->data(), leptonSelection_string.data()), central_or_shift, 1));
+      selElectronHistManager_sublead->bookHistograms(dir);
+      selElectronHistManager_category_[*category]["subleadElectron"] = selElectronHistManager_sublead;
+    }
+    if ( category->find("1e1muos") != std::string::npos ) {
+      ElectronHistManager* selElectronHistManager = new ElectronHistManager(makeHistManager_cfg(process_string,
+	Form("%s_%s/sel/electron", category->data(), leptonSelection_string.data()), central_or_shift));
+      selElectronHistManager->bookHistograms(dir);
+      selElectronHistManager_category_[*category]["electron"] = selElectronHistManager;
+    }
+  }
+
+  selMuonHistManager_.bookHistograms(dir);
+  vstring categories_mu = {
+    "1e1muos_1tau_bloose", "1e1muos_1tau_btight",
+    "2muos_1tau_bloose", "2muos_1tau_btight"
+  };
+  for ( vstring::const_iterator category = categories_mu.begin();
+	category != categories_mu.end(); ++category ) {
+    if ( category->find("1e1muos") != std::string::npos ) {
+      MuonHistManager* selMuonHistManager = new MuonHistManager(makeHistManager_cfg(process_string,
+	Form("%s_%s/sel/muon", category->data(), leptonSelection_string.data()), central_or_shift));
+      selMuonHistManager->bookHistograms(dir);
+      selMuonHistManager_category_[*category]["muon"] = selMuonHistManager;
+    }
+    if ( category->find("2muos") != std::string::npos ) {
+      MuonHistManager* selMuonHistManager_lead = new MuonHistManager(makeHistManager_cfg(process_string,
+	Form("%s_%s/sel/leadMuon", category->data(), leptonSelection_string.data()), central_or_shift, 0));
+      selMuonHistManager_lead->bookHistograms(dir);
+      selMuonHistManager_category_[*category]["leadMuon"] = selMuonHistManager_lead;
+      MuonHistManager* selMuonHistManager_sublead = new MuonHistManager(makeHistManager_cfg(process_string,
+	Form("%s_%s/sel/subleadMuon", category->data(), leptonSelection_string.data()), central_or_shift, 1));
+      selMuonHistManager_sublead->bookHistograms(dir);
+      selMuonHistManager_category_[*category]["subleadMuon"] = selMuonHistManager_sublead;
+    }
+  }
+
+  selHadTauHistManager_.bookHistograms(dir);
+
+  selJetHistManager_.bookHistograms(dir);
+  selJetHistManager_lead_.bookHistograms(dir);
+  selJetHistManager_sublead_.bookHistograms(dir);
+
+  selBJet_looseHistManager_.bookHistograms(dir);
+  selBJet_looseHistManager_lead_.bookHistograms(dir);
+  selBJet_looseHistManager_sublead_.bookHistograms(dir);
+  selBJet_mediumHistManager_.bookHistograms(dir);
+
+  selMEtHistManager_.bookHistograms(dir);
+
+  selEvtHistManager_.bookHistograms(dir);
+  vstring categories_evt = {
+    "2eos_1tau_bloose", "2eos_1tau_btight",
+    "1e1muos_1tau_bloose", "1e1muos_1tau_btight",
+    "2muos_1tau_bloose", "2muos_1tau_btight"
+  };
+  for ( vstring::const_iterator category = categories_evt.begin();
+	category != categories_evt.end(); ++category ) {
+    EvtHistManager_2los_1tau* selEvtHistManager = new EvtHistManager_2los_1tau(makeHistManager_cfg(process_string,
+      Form("%s_%s/sel/evt", category->data(), leptonSelection_string.data()), central_or_shift));
+    selEvtHistManager->bookHistograms(dir);
+    selEvtHistManager_category_[*category] = selEvtHistManager;
+  }
+}
+
+histManagers_2los_1tau::~histManagers_2los_1tau()
+{
+  for ( std::map<std::string, std::map<std::string, ElectronHistManager*>>::iterator histManagers = selElectronHistManager_category_.begin();
+	histManagers != selElectronHistManager_category_.end(); ++histManagers ) {
+    for ( std::map<std::string, ElectronHistManager*>::iterator histManager = histManagers->second.begin();
+	  histManager != histManagers->second.end(); ++histManager ) {
+      delete histManager->second;
+    }
+  }
+  for ( std::map<std::string, std::map<std::string, MuonHistManager*>>::iterator histManagers = selMuonHistManager_category_.begin();
+	histManagers != selMuonHistManager_category_.end(); ++histManagers ) {
+    for ( std::map<std::string, MuonHistManager*>::iterator histManager = histManagers->second.begin();
+	  histManager != histManagers->second.end(); ++histManager ) {
+      delete histManager->second;
+    }
+  }
+  for ( std::map<std::string, EvtHistManager_2los_1tau*>::iterator histManager = selEvtHistManager_category_.begin();
+	histManager != selEvtHistManager_category_.end(); ++histManager ) {
+    delete histManager->second;
+  }
+}
+
+void histManagers_2los_1tau::merge(const histManagers_2los_1tau& shard)
+{
+  preselElectronHistManager_.merge(shard.preselElectronHistManager_);
+  preselMuonHistManager_.merge(shard.preselMuonHistManager_);
+  preselHadTauHistManager_.merge(shard.preselHadTauHistManager_);
+  preselJetHistManager_.merge(shard.preselJetHistManager_);
+  preselBJet_looseHistManager_.merge(shard.preselBJet_looseHistManager_);
+  preselBJet_mediumHistManager_.merge(shard.preselBJet_mediumHistManager_);
+  preselMEtHistManager_.merge(shard.preselMEtHistManager_);
+  preselEvtHistManager_.merge(shard.preselEvtHistManager_);
+
+  selElectronHistManager_.merge(shard.selElectronHistManager_);
+  for ( std::map<std::string, std::map<std::string, ElectronHistManager*>>::iterator histManagers = selElectronHistManager_category_.begin();
+	histManagers != selElectronHistManager_category_.end(); ++histManagers ) {
+    for ( std::map<std::string, ElectronHistManager*>::iterator histManager = histManagers->second.begin();
+	  histManager != histManagers->second.end(); ++histManager ) {
+      histManager->second->merge(*shard.selElectronHistManager_category_.at(histManagers->first).at(histManager->first));
+    }
+  }
+  selMuonHistManager_.merge(shard.selMuonHistManager_);
+  for ( std::map<std::string, std::map<std::string, MuonHistManager*>>::iterator histManagers = selMuonHistManager_category_.begin();
+	histManagers != selMuonHistManager_category_.end(); ++histManagers ) {
+    for ( std::map<std::string, MuonHistManager*>::iterator histManager = histManagers->second.begin();
+	  histManager != histManagers->second.end(); ++histManager ) {
+      histManager->second->merge(*shard.selMuonHistManager_category_.at(histManagers->first).at(histManager->first));
+    }
+  }
+  selHadTauHistManager_.merge(shard.selHadTauHistManager_);
+  selJetHistManager_.merge(shard.selJetHistManager_);
+  selJetHistManager_lead_.merge(shard.selJetHistManager_lead_);
+  selJetHistManager_sublead_.merge(shard.selJetHistManager_sublead_);
+  selBJet_looseHistManager_.merge(shard.selBJet_looseHistManager_);
+  selBJet_looseHistManager_lead_.merge(shard.selBJet_looseHistManager_lead_);
+  selBJet_looseHistManager_sublead_.merge(shard.selBJet_looseHistManager_sublead_);
+  selBJet_mediumHistManager_.merge(shard.selBJet_mediumHistManager_);
+  selMEtHistManager_.merge(shard.selMEtHistManager_);
+  selEvtHistManager_.merge(shard.selEvtHistManager_);
+  for ( std::map<std::string, EvtHistManager_2los_1tau*>::iterator histManager = selEvtHistManager_category_.begin();
+	histManager != selEvtHistManager_category_.end(); ++histManager ) {
+    histManager->second->merge(*shard.selEvtHistManager_category_.at(histManager->first));
+  }
+}
+
 /**
  * @brief Produce datacard and control plots for 2los_1tau categories.
  */
@@ -108,19 +350,14 @@ int main(int argc, char* argv[])
   std::string process_string = cfg_analyze.getParameter<std::string>("process");
 
   vstring triggerNames_1e = cfg_analyze.getParameter<vstring>("triggers_1e");
-  std::vector<hltPath*> triggers_1e = create_hltPaths(triggerNames_1e);
   bool use_triggers_1e = cfg_analyze.getParameter<bool>("use_triggers_1e");
   vstring triggerNames_2e = cfg_analyze.getParameter<vstring>("triggers_2e");
-  std::vector<hltPath*> triggers_2e = create_hltPaths(triggerNames_2e);
   bool use_triggers_2e = cfg_analyze.getParameter<bool>("use_triggers_2e");
   vstring triggerNames_1mu = cfg_analyze.getParameter<vstring>("triggers_1mu");
-  std::vector<hltPath*> triggers_1mu = create_hltPaths(triggerNames_1mu);
   bool use_triggers_1mu = cfg_analyze.getParameter<bool>("use_triggers_1mu");
   vstring triggerNames_2mu = cfg_analyze.getParameter<vstring>("triggers_2mu");
-  std::vector<hltPath*> triggers_2mu = create_hltPaths(triggerNames_2mu);
   bool use_triggers_2mu = cfg_analyze.getParameter<bool>("use_triggers_2mu");
   vstring triggerNames_1e1mu = cfg_analyze.getParameter<vstring>("triggers_1e1mu");
-  std::vector<hltPath*> triggers_1e1mu = create_hltPaths(triggerNames_1e1mu);
   bool use_triggers_1e1mu = cfg_analyze.getParameter<bool>("use_triggers_1e1mu");
 
   enum { kLoose, kFakeable, kTight };
@@ -136,6 +373,13 @@ int main(int argc, char* argv[])
   std::string central_or_shift = cfg_analyze.getParameter<std::string>("central_or_shift");
   double lumiScale = ( process_string != "data_obs" ) ? cfg_analyze.getParameter<double>("lumiScale") : 1.;
 
+//--- process the events in numThreads threads (optional)
+  int numThreads = ( cfg_analyze.exists("numThreads") ) ? cfg_analyze.getParameter<int>("numThreads") : 1;
+  if ( numThreads < 1 )
+    throw cms::Exception("analyze_2los_1tau") 
+      << "Invalid Configuration parameter 'numThreads' = " << numThreads << " !!\n";
+  if ( numThreads > 1 ) ROOT::EnableThreadSafety();
+
   std::string jet_btagWeight_branch = ( isMC ) ? "Jet_bTagWeight" : "";
 
   int jetPt_option = RecoJetReader::kJetPt_central;
@@ -165,16 +409,11 @@ int main(int argc, char* argv[])
 
   std::string selEventsFileName_input = cfg_analyze.getParameter<std::string>("selEventsFileName_input");
   std::cout << "selEventsFileName_input = " << selEventsFileName_input << std::endl;
-  RunLumiEventSelector* run_lumi_eventSelector = 0;
-  if ( selEventsFileName_input != "" ) {
-    edm::ParameterSet cfgRunLumiEventSelector;
-    cfgRunLumiEventSelector.addParameter<std::string>("inputFileName", selEventsFileName_input);
-    cfgRunLumiEventSelector.addParameter<std::string>("separator", ":");
-    run_lumi_eventSelector = new RunLumiEventSelector(cfgRunLumiEventSelector);
-  }
 
   std::string selEventsFileName_output = cfg_analyze.getParameter<std::string>("selEventsFileName_output");
 
+  std::string cutFlowFileName = ( cfg_analyze.exists("cutFlowFileName") ) ? cfg_analyze.getParameter<std::string>("cutFlowFileName") : "";
+
   fwlite::InputSource inputFiles(cfg); 
   int maxEvents = inputFiles.maxEvents();
   std::cout << " maxEvents = " << maxEvents << std::endl;
@@ -183,585 +422,641 @@ int main(int argc, char* argv[])
   fwlite::OutputFiles outputFile(cfg);
   fwlite::TFileService fs = fwlite::TFileService(outputFile.file().data());
 
-  TChain* inputTree = new TChain(treeName.data());
-  for ( std::vector<std::string>::const_iterator inputFileName = inputFiles.files().begin();
-	inputFileName != inputFiles.files().end(); ++inputFileName ) {
-    std::cout << "input Tree: adding file = " << (*inputFileName) << std::endl;
-    inputTree->AddFile(inputFileName->data());
-  }
+  edm::ParameterSet cfg_input = cfg.getParameter<edm::ParameterSet>("fwliteInput");
+  std::string inputFormat = "ROOT";
+  if ( cfg_input.exists("inputFormat") ) inputFormat = cfg_input.getParameter<std::string>("inputFormat");
+
+  TChain* inputTree = 0;
+  ColumnarCacheReader* inputCache = 0;
+  if ( inputFormat == "ROOT" ) {
+    inputTree = new TChain(treeName.data());
+    for ( std::vector<std::string>::const_iterator inputFileName = inputFiles.files().begin();
+	  inputFileName != inputFiles.files().end(); ++inputFileName ) {
+      std::cout << "input Tree: adding file = " << (*inputFileName) << std::endl;
+      inputTree->AddFile(inputFileName->data());
+    }
+  
+    if ( !(inputTree->GetListOfFiles()->GetEntries() >= 1) ) {
+      throw cms::Exception("analyze_2los_1tau") 
+        << "Failed to identify input Tree !!\n";
+    }
   
-  if ( !(inputTree->GetListOfFiles()->GetEntries() >= 1) ) {
+    // CV: need to call TChain::LoadTree before processing first event 
+    //     in order to prevent ROOT causing a segmentation violation,
+    //     cf. http://root.cern.ch/phpBB3/viewtopic.php?t=10062
+    inputTree->LoadTree(0);
+
+    std::cout << "input Tree contains " << inputTree->GetEntries() << " Entries in " << inputTree->GetListOfFiles()->GetEntries() << " files." << std::endl;
+  } else if ( inputFormat == "columnarCache" ) {
+    inputCache = new ColumnarCacheReader(inputFiles.files());
+    std::cout << "input columnar cache contains " << inputCache->getEntries() << " Entries in " << inputFiles.files().size() << " files." << std::endl;
+  } else {
     throw cms::Exception("analyze_2los_1tau") 
-      << "Failed to identify input Tree !!\n";
+      << "Invalid Configuration parameter 'inputFormat' = " << inputFormat << " !!\n";
   }
-  
-  // CV: need to call TChain::LoadTree before processing first event 
-  //     in order to prevent ROOT causing a segmentation violation,
-  //     cf. http://root.cern.ch/phpBB3/viewtopic.php?t=10062
-  inputTree->LoadTree(0);
-
-  std::cout << "input Tree contains " << inputTree->GetEntries() << " Entries in " << inputTree->GetListOfFiles()->GetEntries() << " files." << std::endl;
 
-//--- declare event-level variables
-  RUN_TYPE run;
-  inputTree->SetBranchAddress(RUN_KEY, &run);
-  LUMI_TYPE lumi;
-  inputTree->SetBranchAddress(LUMI_KEY, &lumi);
-  EVT_TYPE event;
-  inputTree->SetBranchAddress(EVT_KEY, &event);
-
-  hltPaths_setBranchAddresses(inputTree, triggers_1e);
-  hltPaths_setBranchAddresses(inputTree, triggers_2e);
-  hltPaths_setBranchAddresses(inputTree, triggers_1mu);
-  hltPaths_setBranchAddresses(inputTree, triggers_2mu);
-  hltPaths_setBranchAddresses(inputTree, triggers_1e1mu);
-
-  MET_PT_TYPE met_pt;
-  inputTree->SetBranchAddress(MET_PT_KEY, &met_pt);
-  MET_ETA_TYPE met_eta;
-  inputTree->SetBranchAddress(MET_ETA_KEY, &met_eta);
-  MET_PHI_TYPE met_phi;
-  inputTree->SetBranchAddress(MET_PHI_KEY, &met_phi);
-  LV met_p4(met_pt, met_eta, met_phi, 0.);
-
-//--- declare particle collections
-  RecoMuonReader* muonReader = new RecoMuonReader("nselLeptons", "selLeptons");
-  muonReader->setBranchAddresses(inputTree);
-  RecoMuonCollectionGenMatcher muonGenMatcher;
-  RecoMuonCollectionSelectorLoose preselMuonSelector;
-  RecoMuonCollectionSelectorFakeable fakeableMuonSelector;
-  RecoMuonCollectionSelectorTight tightMuonSelector;
-
-  RecoElectronReader* electronReader = new RecoElectronReader("nselLeptons", "selLeptons");
-  electronReader->setBranchAddresses(inputTree);
-  RecoElectronCollectionGenMatcher electronGenMatcher;
-  RecoElectronCollectionCleaner electronCleaner(0.3);
-  RecoElectronCollectionSelectorLoose preselElectronSelector;
-  RecoElectronCollectionSelectorFakeable fakeableElectronSelector;
-  RecoElectronCollectionSelectorTight tightElectronSelector;
-
-  RecoHadTauReader* hadTauReader = new RecoHadTauReader("nTauGood", "TauGood");
-  hadTauReader->setBranchAddresses(inputTree);
-  RecoHadTauCollectionGenMatcher hadTauGenMatcher;
-  RecoHadTauCollectionCleaner hadTauCleaner(0.3);
-  RecoHadTauCollectionSelectorTight hadTauSelector;
-  
-  RecoJetReader* jetReader = new RecoJetReader("nJet", "Jet");
-  jetReader->setJetPt_central_or_shift(jetPt_option);
-  jetReader->setBranchName_BtagWeight(jet_btagWeight_branch);
-  jetReader->setBranchAddresses(inputTree);
-  RecoJetCollectionGenMatcher jetGenMatcher;
-  RecoJetCollectionCleaner jetCleaner(0.5);
-  RecoJetCollectionSelector jetSelector;  
-  RecoJetCollectionSelectorBtagLoose jetSelectorBtagLoose;
-  RecoJetCollectionSelectorBtagMedium jetSelectorBtagMedium;
-
-  GenLeptonReader* genLeptonReader = 0;
-  GenHadTauReader* genHadTauReader = 0;
-  GenJetReader* genJetReader = 0;
-  if ( isMC ) {
-    genLeptonReader = new GenLeptonReader("nGenLep", "GenLep");
-    genLeptonReader->setBranchAddresses(inputTree);
-    genHadTauReader = new GenHadTauReader("nGenHadTaus", "GenHadTaus");
-    genHadTauReader->setBranchAddresses(inputTree);
-    genJetReader = new GenJetReader("nGenJet", "GenJet");
-    genJetReader->setBranchAddresses(inputTree);
+//--- split the range of entries into contiguous ranges, one per thread;
+//    the boundaries between the ranges are aligned to the cluster boundaries of the input files,
+//    so that the split is reproducible and no cluster of baskets is decompressed by more than one thread
+  EntryRange entryRange(cfg_input, ( inputCache ) ? inputCache->getEntries() : inputTree->GetEntries());
+  if ( maxEvents != -1 && entryRange.size() > maxEvents ) entryRange = EntryRange(entryRange.firstEntry(), entryRange.firstEntry() + maxEvents);
+  std::cout << "processing Entries " << entryRange.firstEntry() << " to " << entryRange.lastEntry() << "." << std::endl;
+  std::vector<Long64_t> clusterBoundaries;
+  if ( inputTree && numThreads > 1 ) clusterBoundaries = getClusterBoundaries(inputTree);
+  std::vector<EntryRange> entryRanges = splitEntryRange(entryRange, numThreads, clusterBoundaries);
+  if ( numThreads > 1 ) {
+    for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+      std::cout << " thread #" << idxWorker << ": Entries " << entryRanges[idxWorker].firstEntry() << " to " << entryRanges[idxWorker].lastEntry() << std::endl;
+    }
   }
 
-//--- initialize BDTs used to discriminate ttH vs. ttV and ttH vs. ttbar 
-//    in 2los_1tau category of ttH multilepton analysis
-  std::string mvaFileName_2los_ttV = "tthAnalysis/HiggsToTauTau/data/2lss_ttV_BDTG.weights.xml";
-  std::vector<std::string> mvaInputVariables_2los_ttV;
-  mvaInputVariables_2los_ttV.push_back("max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))");
-  mvaInputVariables_2los_ttV.push_back("MT_met_lep1");
-  mvaInputVariables_2los_ttV.push_back("nJet25_Recl");
-  mvaInputVariables_2los_ttV.push_back("mindr_lep1_jet");
-  mvaInputVariables_2los_ttV.push_back("mindr_lep2_jet");
-  mvaInputVariables_2los_ttV.push_back("LepGood_conePt[iF_Recl[0]]");
-  mvaInputVariables_2los_ttV.push_back("LepGood_conePt[iF_Recl[1]]");
-  TMVAInterface mva_2los_ttV(mvaFileName_2los_ttV, mvaInputVariables_2los_ttV, { "iF_Recl[0]", "iF_Recl[1]", "iF_Recl[2]" });
-
-  std::string mvaFileName_2los_ttbar = "tthAnalysis/HiggsToTauTau/data/2lss_ttbar_BDTG.weights.xml";
-  std::vector<std::string> mvaInputVariables_2los_ttbar;
-  mvaInputVariables_2los_ttbar.push_back("max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))");
-  mvaInputVariables_2los_ttbar.push_back("nJet25_Recl");
-  mvaInputVariables_2los_ttbar.push_back("mindr_lep1_jet");
-  mvaInputVariables_2los_ttbar.push_back("mindr_lep2_jet");
-  mvaInputVariables_2los_ttbar.push_back("min(met_pt,400)");
-  mvaInputVariables_2los_ttbar.push_back("avg_dr_jet");
-  mvaInputVariables_2los_ttbar.push_back("MT_met_lep1");
-  TMVAInterface mva_2los_ttbar(mvaFileName_2los_ttbar, mvaInputVariables_2los_ttbar, { "iF_Recl[0]", "iF_Recl[1]", "iF_Recl[2]" });
-
-  std::map<std::string, double> mvaInputs;
-
 //--- open output file containing run:lumi:event numbers of events passing final event selection criteria
   std::ostream* selEventsFile = new std::ofstream(selEventsFileName_output.data(), std::ios::out);
 
-//--- declare histograms
-  ElectronHistManager preselElectronHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/presel/electrons", leptonSelection_string.data()), central_or_shift));
-  preselElectronHistManager.bookHistograms(fs);
-  MuonHistManager preselMuonHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/presel/muons", leptonSelection_string.data()), central_or_shift));
-  preselMuonHistManager.bookHistograms(fs);
-  HadTauHistManager preselHadTauHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/presel/hadTaus", leptonSelection_string.data()), central_or_shift));
-  preselHadTauHistManager.bookHistograms(fs);
-  JetHistManager preselJetHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/presel/jets", leptonSelection_string.data()), central_or_shift));
-  preselJetHistManager.bookHistograms(fs);
-  JetHistManager preselBJet_looseHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/presel/BJets_loose", leptonSelection_string.data()), central_or_shift));
-  preselBJet_looseHistManager.bookHistograms(fs);
-  JetHistManager preselBJet_mediumHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/presel/BJets_medium", leptonSelection_string.data()), central_or_shift));
-  preselBJet_mediumHistManager.bookHistograms(fs);
-  MEtHistManager preselMEtHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/presel/met", leptonSelection_string.data()), central_or_shift));
-  preselMEtHistManager.bookHistograms(fs);
-  EvtHistManager_2los_1tau preselEvtHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/presel/evt", leptonSelection_string.data()), central_or_shift));
-  preselEvtHistManager.bookHistograms(fs);
-
-  ElectronHistManager selElectronHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/sel/electrons", leptonSelection_string.data()), central_or_shift));
-  selElectronHistManager.bookHistograms(fs);
-  vstring categories_e = { 
-    "2eos_1tau_bloose", "2eos_1tau_btight",
-    "1e1muos_1tau_bloose", "1e1muos_1tau_btight" };
-  std::map<std::string, std::map<std::string, ElectronHistManager*>> selElectronHistManager_category; // key = category, "leadElectron"/"subleadElectron"/"electron"
-  for ( vstring::const_iterator category = categories_e.begin();
-	category != categories_e.end(); ++category ) {
-    if ( category->find("2eos") != std::string::npos ) {
-      ElectronHistManager* selElectronHistManager_lead = new ElectronHistManager(makeHistManager_cfg(process_string, 
-	Form("%s_%s/sel/leadElectron", category->data(), leptonSelection_string.data()), central_or_shift, 0));
-      selElectronHistManager_lead->bookHistograms(fs);
-      selElectronHistManager_category[*category]["leadElectron"] = selElectronHistManager_lead;
-      ElectronHistManager* selElectronHistManager_sublead = new ElectronHistManager(makeHistManager_cfg(process_string, 
-	Form("%s_%s/sel/subleadElectron", category->data(), leptonSelection_string.data()), central_or_shift, 1));
-      selElectronHistManager_sublead->bookHistograms(fs);
-      selElectronHistManager_category[*category]["subleadElectron"] = selElectronHistManager_sublead;
-    }
-    if ( category->find("1e1muos") != std::string::npos ) {
-      ElectronHistManager* selElectronHistManager = new ElectronHistManager(makeHistManager_cfg(process_string, 
-	Form("%s_%s/sel/electron", category->data(), leptonSelection_string.data()), central_or_shift));
-      selElectronHistManager->bookHistograms(fs);
-      selElectronHistManager_category[*category]["electron"] = selElectronHistManager;
-    }
+//--- declare histograms;
+//    threads other than the first fill private copies of the histograms, booked in separate directories,
+//    which are added to the histograms of the first thread once all threads have finished
+  std::vector<histManagers_2los_1tau*> histManagers_workers;
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    TFileDirectory dir = ( idxWorker == 0 ) ? fs : fs.mkdir(Form("shard%i", idxWorker));
+    histManagers_workers.push_back(new histManagers_2los_1tau(dir, process_string, leptonSelection_string, central_or_shift));
   }
 
-  MuonHistManager selMuonHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/sel/muons", leptonSelection_string.data()), central_or_shift));
-  selMuonHistManager.bookHistograms(fs);
-  vstring categories_mu = { 
-    "1e1muos_1tau_bloose", "1e1muos_1tau_btight", 
-    "2muos_1tau_bloose", "2muos_1tau_btight" 
-  };
-  std::map<std::string, std::map<std::string, MuonHistManager*>> selMuonHistManager_category; // key = category, "leadMuon"/"subleadMuon"/"muon"
-  for ( vstring::const_iterator category = categories_mu.begin();
-	category != categories_mu.end(); ++category ) {
-    if ( category->find("1e1muos") != std::string::npos ) {
-      MuonHistManager* selMuonHistManager = new MuonHistManager(makeHistManager_cfg(process_string, 
-	Form("%s_%s/sel/muon", category->data(), leptonSelection_string.data()), central_or_shift));
-      selMuonHistManager->bookHistograms(fs);
-      selMuonHistManager_category[*category]["muon"] = selMuonHistManager;
-    }
-    if ( category->find("2muos") != std::string::npos ) {
-      MuonHistManager* selMuonHistManager_lead = new MuonHistManager(makeHistManager_cfg(process_string, 
-	Form("%s_%s/sel/leadMuon", category->data(), leptonSelection_string.data()), central_or_shift, 0));
-      selMuonHistManager_lead->bookHistograms(fs);
-      selMuonHistManager_category[*category]["leadMuon"] = selMuonHistManager_lead;
-      MuonHistManager* selMuonHistManager_sublead = new MuonHistManager(makeHistManager_cfg(process_string, 
-	Form("%s_%s/sel/subleadMuon", category->data(), leptonSelection_string.data()), central_or_shift, 1));
-      selMuonHistManager_sublead->bookHistograms(fs);
-      selMuonHistManager_category[*category]["subleadMuon"] = selMuonHistManager_sublead;
+  std::vector<std::ostringstream> selEventsFiles_workers(numThreads);
+  std::vector<int> analyzedEntries_workers(numThreads);
+  std::vector<int> selectedEntries_workers(numThreads);
+  std::vector<double> selectedEntries_weighted_workers(numThreads);
+  std::vector<CutFlowTable> cutFlow_workers(numThreads, CutFlowTable("analyze_2los_1tau"));
+  std::mutex workerMutex;
+  std::mutex coutMutex;
+
+//--- process the entries in range given by entryRanges[idxWorker];
+//    all objects that change their state while processing events (readers, selectors, TMVA::Reader objects,...)
+//    are private to each thread
+  auto processEntries = [&](int idxWorker)
+  {
+//--- construct and destruct the objects used by each thread one thread at a time,
+//    as creating and deleting TChain, TBranch and TMVA::Reader objects is not guaranteed to be thread-safe
+    std::unique_lock<std::mutex> lock(workerMutex);
+
+//--- each thread other than the first reads the input files through its own TChain or ColumnarCacheReader object
+    TChain* inputTree_worker = inputTree;
+    ColumnarCacheReader* inputCache_worker = inputCache;
+    if ( idxWorker > 0 ) {
+      if ( inputTree ) {
+        inputTree_worker = new TChain(treeName.data());
+        for ( std::vector<std::string>::const_iterator inputFileName = inputFiles.files().begin();
+	      inputFileName != inputFiles.files().end(); ++inputFileName ) {
+          inputTree_worker->AddFile(inputFileName->data());
+        }
+        inputTree_worker->LoadTree(0);
+      } else {
+        inputCache_worker = new ColumnarCacheReader(inputFiles.files());
+      }
     }
-  }
 
-  HadTauHistManager selHadTauHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/sel/hadTaus", leptonSelection_string.data()), central_or_shift));
-  selHadTauHistManager.bookHistograms(fs);
-
-  JetHistManager selJetHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/sel/jets", leptonSelection_string.data()), central_or_shift));
-  selJetHistManager.bookHistograms(fs);
-  JetHistManager selJetHistManager_lead(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/sel/leadJet", leptonSelection_string.data()), central_or_shift, 0));
-  selJetHistManager_lead.bookHistograms(fs);
-  JetHistManager selJetHistManager_sublead(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/sel/subleadJet", leptonSelection_string.data()), central_or_shift, 1));
-  selJetHistManager_sublead.bookHistograms(fs);
-
-  JetHistManager selBJet_looseHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/sel/BJets_loose", leptonSelection_string.data()), central_or_shift));
-  selBJet_looseHistManager.bookHistograms(fs);
-  JetHistManager selBJet_looseHistManager_lead(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/sel/leadBJet_loose", leptonSelection_string.data()), central_or_shift, 0));
-  selBJet_looseHistManager_lead.bookHistograms(fs);
-  JetHistManager selBJet_looseHistManager_sublead(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/sel/subleadBJet_loose", leptonSelection_string.data()), central_or_shift, 1));
-  selBJet_looseHistManager_sublead.bookHistograms(fs);
-  JetHistManager selBJet_mediumHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/sel/BJets_medium", leptonSelection_string.data()), central_or_shift));
-  selBJet_mediumHistManager.bookHistograms(fs);
-
-  MEtHistManager selMEtHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/sel/met", leptonSelection_string.data()), central_or_shift));
-  selMEtHistManager.bookHistograms(fs);
-
-  EvtHistManager_2los_1tau selEvtHistManager(makeHistManager_cfg(process_string, 
-    Form("2los_1tau_%s/sel/evt", leptonSelection_string.data()), central_or_shift));
-  selEvtHistManager.bookHistograms(fs);
-  vstring categories_evt = { 
-    "2eos_1tau_bloose", "2eos_1tau_btight", 
-    "1e1muos_1tau_bloose", "1e1muos_1tau_btight", 
-    "2muos_1tau_bloose", "2muos_1tau_btight"
-  };
-  std::map<std::string, EvtHistManager_2los_1tau*> selEvtHistManager_category; // key = category
-  for ( vstring::const_iterator category = categories_evt.begin();
-	category != categories_evt.end(); ++category ) {
-    EvtHistManager_2los_1tau* selEvtHistManager = new EvtHistManager_2los_1tau(makeHistManager_cfg(process_string, 
-      Form("%s_%s/sel/evt", category->data(), leptonSelection_string.data()), central_or_shift));
-    selEvtHistManager->bookHistograms(fs);
-    selEvtHistManager_category[*category] = selEvtHistManager;
-  }
+//--- declare event-level variables
+    EventSource* eventSource_ptr = ( inputCache_worker ) ? new EventSource(inputCache_worker) : new EventSource(inputTree_worker);
+    EventSource& eventSource = (*eventSource_ptr);
+
+    RUN_TYPE run;
+    eventSource.setBranchAddress(RUN_KEY, &run);
+    LUMI_TYPE lumi;
+    eventSource.setBranchAddress(LUMI_KEY, &lumi);
+    EVT_TYPE event;
+    eventSource.setBranchAddress(EVT_KEY, &event);
+
+    std::vector<hltPath*> triggers_1e = create_hltPaths(triggerNames_1e);
+    std::vector<hltPath*> triggers_2e = create_hltPaths(triggerNames_2e);
+    std::vector<hltPath*> triggers_1mu = create_hltPaths(triggerNames_1mu);
+    std::vector<hltPath*> triggers_2mu = create_hltPaths(triggerNames_2mu);
+    std::vector<hltPath*> triggers_1e1mu = create_hltPaths(triggerNames_1e1mu);
+    hltPaths_setBranchAddresses(eventSource, triggers_1e);
+    hltPaths_setBranchAddresses(eventSource, triggers_2e);
+    hltPaths_setBranchAddresses(eventSource, triggers_1mu);
+    hltPaths_setBranchAddresses(eventSource, triggers_2mu);
+    hltPaths_setBranchAddresses(eventSource, triggers_1e1mu);
+
+    MET_PT_TYPE met_pt;
+    eventSource.setBranchAddress(MET_PT_KEY, &met_pt);
+    MET_ETA_TYPE met_eta;
+    eventSource.setBranchAddress(MET_ETA_KEY, &met_eta);
+    MET_PHI_TYPE met_phi;
+    eventSource.setBranchAddress(MET_PHI_KEY, &met_phi);
+    LV met_p4(met_pt, met_eta, met_phi, 0.);
 
-  int numEntries = inputTree->GetEntries();
-  int analyzedEntries = 0;
-  int selectedEntries = 0;
-  double selectedEntries_weighted = 0.;
-  for ( int idxEntry = 0; idxEntry < numEntries && (maxEvents == -1 || idxEntry < maxEvents); ++idxEntry ) {
-    if ( idxEntry > 0 && (idxEntry % reportEvery) == 0 ) {
-      std::cout << "processing Entry " << idxEntry << " (" << selectedEntries << " Entries selected)" << std::endl;
+//--- declare particle collections
+    RecoMuonReader* muonReader = new RecoMuonReader("nselLeptons", "selLeptons");
+    muonReader->setBranchAddresses(eventSource);
+    RecoMuonCollectionMultiSelector muonSelector;
+    RecoMuonCollectionSelection muonSelection;
+
+    RecoElectronReader* electronReader = new RecoElectronReader("nselLeptons", "selLeptons");
+    electronReader->setBranchAddresses(eventSource);
+    RecoElectronCollectionCleaner electronCleaner(0.3);
+    RecoElectronCollectionMultiSelector electronSelector;
+    RecoElectronCollectionSelection electronSelection;
+
+    RecoHadTauReader* hadTauReader = new RecoHadTauReader("nTauGood", "TauGood");
+    hadTauReader->setBranchAddresses(eventSource);
+    RecoHadTauCollectionCleaner hadTauCleaner(0.3);
+    RecoHadTauCollectionSelectorTight hadTauSelector;
+  
+    RecoJetReader* jetReader = new RecoJetReader("nJet", "Jet");
+    jetReader->setJetPt_central_or_shift(jetPt_option);
+    jetReader->setBranchName_BtagWeight(jet_btagWeight_branch);
+    jetReader->setBranchAddresses(eventSource);
+    RecoJetCollectionCleaner jetCleaner(0.5);
+    RecoJetCollectionSelector jetSelector;  
+    RecoJetCollectionSelectorBtagLoose jetSelectorBtagLoose;
+    RecoJetCollectionSelectorBtagMedium jetSelectorBtagMedium;
+
+    GenLeptonReader* genLeptonReader = 0;
+    GenHadTauReader* genHadTauReader = 0;
+    GenJetReader* genJetReader = 0;
+    if ( isMC ) {
+      genLeptonReader = new GenLeptonReader("nGenLep", "GenLep");
+      genLeptonReader->setBranchAddresses(eventSource);
+      genHadTauReader = new GenHadTauReader("nGenHadTaus", "GenHadTaus");
+      genHadTauReader->setBranchAddresses(eventSource);
+      genJetReader = new GenJetReader("nGenJet", "GenJet");
+      genJetReader->setBranchAddresses(eventSource);
+    }
+    GenMatchTable genMatchTable;
+
+//--- initialize BDTs used to discriminate ttH vs. ttV and ttH vs. ttbar 
+//    in 2los_1tau category of ttH multilepton analysis
+    std::string mvaFileName_2los_ttV = "tthAnalysis/HiggsToTauTau/data/2lss_ttV_BDTG.weights.xml";
+    std::vector<std::string> mvaInputVariables_2los_ttV;
+    mvaInputVariables_2los_ttV.push_back("max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))");
+    mvaInputVariables_2los_ttV.push_back("MT_met_lep1");
+    mvaInputVariables_2los_ttV.push_back("nJet25_Recl");
+    mvaInputVariables_2los_ttV.push_back("mindr_lep1_jet");
+    mvaInputVariables_2los_ttV.push_back("mindr_lep2_jet");
+    mvaInputVariables_2los_ttV.push_back("LepGood_conePt[iF_Recl[0]]");
+    mvaInputVariables_2los_ttV.push_back("LepGood_conePt[iF_Recl[1]]");
+    TMVAInterface mva_2los_ttV(mvaFileName_2los_ttV, mvaInputVariables_2los_ttV, { "iF_Recl[0]", "iF_Recl[1]", "iF_Recl[2]" },
+                               getMVAInputLayout_2lss());
+
+    std::string mvaFileName_2los_ttbar = "tthAnalysis/HiggsToTauTau/data/2lss_ttbar_BDTG.weights.xml";
+    std::vector<std::string> mvaInputVariables_2los_ttbar;
+    mvaInputVariables_2los_ttbar.push_back("max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))");
+    mvaInputVariables_2los_ttbar.push_back("nJet25_Recl");
+    mvaInputVariables_2los_ttbar.push_back("mindr_lep1_jet");
+    mvaInputVariables_2los_ttbar.push_back("mindr_lep2_jet");
+    mvaInputVariables_2los_ttbar.push_back("min(met_pt,400)");
+    mvaInputVariables_2los_ttbar.push_back("avg_dr_jet");
+    mvaInputVariables_2los_ttbar.push_back("MT_met_lep1");
+    TMVAInterface mva_2los_ttbar(mvaFileName_2los_ttbar, mvaInputVariables_2los_ttbar, { "iF_Recl[0]", "iF_Recl[1]", "iF_Recl[2]" },
+                                 getMVAInputLayout_2lss());
+
+    Float_t mvaInputs[kNumMVAInputs_2lss];
+
+    RunLumiEventSelector* run_lumi_eventSelector = 0;
+    if ( selEventsFileName_input != "" ) {
+      edm::ParameterSet cfgRunLumiEventSelector;
+      cfgRunLumiEventSelector.addParameter<std::string>("inputFileName", selEventsFileName_input);
+      cfgRunLumiEventSelector.addParameter<std::string>("separator", ":");
+      run_lumi_eventSelector = new RunLumiEventSelector(cfgRunLumiEventSelector);
     }
-    ++analyzedEntries;
+
+//--- selected run:lumi:event numbers and counters of each thread are collected separately
+//    and combined once all threads have finished
+    std::ostream& selEventsFile = selEventsFiles_workers[idxWorker];
+    int& analyzedEntries = analyzedEntries_workers[idxWorker];
+    int& selectedEntries = selectedEntries_workers[idxWorker];
+    double& selectedEntries_weighted = selectedEntries_weighted_workers[idxWorker];
+    histManagers_2los_1tau& histManagers = (*histManagers_workers[idxWorker]);
+
+//--- disable all branches that are not read by any of the readers,
+//    so that TTree::GetEntry does not unzip them
+    eventSource.setBranchStatus();
+    if ( idxWorker == 0 ) eventSource.printManifest(std::cout);
+
+//--- declare the cuts of the event selection, in the order in which they are applied
+    CutFlowTable& cutFlow = cutFlow_workers[idxWorker];
+    const int cut_runLumiEvent = cutFlow.addCut("run:lumi:event selection");
+    const int cut_trigger = cutFlow.addCut("trigger");
+    const int cut_preselLeptons = cutFlow.addCut("2 presel leptons");
+    const int cut_preselLeptons_trigger = cutFlow.addCut("presel lepton trigger match");
+    const int cut_preselJets = cutFlow.addCut(">= 2 jets (presel)");
+    const int cut_preselBJets = cutFlow.addCut(">= 2 loose b-jets || >= 1 medium b-jet (presel)");
+    const int cut_preselHadTaus = cutFlow.addCut("1 sel tau (presel)");
+    const int cut_selLeptons = cutFlow.addCut("2 sel leptons");
+    const int cut_selLeptons_trigger = cutFlow.addCut("sel lepton trigger match");
+    const int cut_selJets = cutFlow.addCut(">= 4 jets");
+    const int cut_selBJets = cutFlow.addCut(">= 2 loose b-jets || >= 1 medium b-jet");
+    const int cut_selHadTaus = cutFlow.addCut("1 sel tau");
+    const int cut_lowMassVeto = cutFlow.addCut("m(ll) > 12 GeV");
+    const int cut_leptonPt = cutFlow.addCut("lepton pT");
+    const int cut_charge = cutFlow.addCut("lepton charge (OS)");
+    const int cut_ZbosonMassVeto = cutFlow.addCut("Z veto (ee)");
+    const int cut_metLD = cutFlow.addCut("met_LD > 0.2 (ee)");
+    const int cut_tightLeptonVeto = cutFlow.addCut("< 2 tight leptons (fakeable)");
+
+    lock.unlock();
+
+    for ( Long64_t idxEntry = entryRanges[idxWorker].firstEntry(); idxEntry < entryRanges[idxWorker].lastEntry(); ++idxEntry ) {
+      if ( analyzedEntries > 0 && (analyzedEntries % reportEvery) == 0 ) {
+        std::lock_guard<std::mutex> lock_cout(coutMutex);
+        std::cout << "processing Entry " << idxEntry << " (" << selectedEntries << " Entries selected)" << std::endl;
+      }
+      ++analyzedEntries;
+
+      cutFlow.startEvent();
     
-    inputTree->GetEntry(idxEntry);
+      eventSource.getEntry(idxEntry);
 
-    if ( run_lumi_eventSelector && !(*run_lumi_eventSelector)(run, lumi, event) ) continue;
+      if ( !cutFlow(cut_runLumiEvent, !run_lumi_eventSelector || (*run_lumi_eventSelector)(run, lumi, event), lumiScale) ) continue;
 
-    bool isTriggered_1e = use_triggers_1e && hltPaths_isTriggered(triggers_1e);
-    bool isTriggered_2e = use_triggers_2e && hltPaths_isTriggered(triggers_2e);
-    bool isTriggered_1mu = use_triggers_1mu && hltPaths_isTriggered(triggers_1mu);
-    bool isTriggered_2mu = use_triggers_2mu && hltPaths_isTriggered(triggers_2mu);
-    bool isTriggered_1e1mu = use_triggers_1e1mu && hltPaths_isTriggered(triggers_1e1mu);
-    if ( !(isTriggered_1e || isTriggered_2e || isTriggered_1mu || isTriggered_2mu || isTriggered_1e1mu) ) continue;
+      bool isTriggered_1e = use_triggers_1e && hltPaths_isTriggered(triggers_1e);
+      bool isTriggered_2e = use_triggers_2e && hltPaths_isTriggered(triggers_2e);
+      bool isTriggered_1mu = use_triggers_1mu && hltPaths_isTriggered(triggers_1mu);
+      bool isTriggered_2mu = use_triggers_2mu && hltPaths_isTriggered(triggers_2mu);
+      bool isTriggered_1e1mu = use_triggers_1e1mu && hltPaths_isTriggered(triggers_1e1mu);
+      if ( !cutFlow(cut_trigger, isTriggered_1e || isTriggered_2e || isTriggered_1mu || isTriggered_2mu || isTriggered_1e1mu, lumiScale) ) continue;
 
 //--- build collections of electrons, muons and hadronic taus;
 //    resolve overlaps in order of priority: muon, electron,
-    std::vector<RecoMuon> muons = muonReader->read();
-    std::vector<const RecoMuon*> muon_ptrs = convert_to_ptrs(muons);
-    std::vector<const RecoMuon*> cleanedMuons = muon_ptrs; // CV: no cleaning needed for muons, as they have the highest priority in the overlap removal
-    std::vector<const RecoMuon*> preselMuons = preselMuonSelector(cleanedMuons);
-    std::vector<const RecoMuon*> fakeableMuons = fakeableMuonSelector(preselMuons);
-    std::vector<const RecoMuon*> tightMuons = tightMuonSelector(preselMuons);
-    std::vector<const RecoMuon*> selMuons;
-    if      ( leptonSelection == kLoose    ) selMuons = preselMuons;
-    else if ( leptonSelection == kFakeable ) selMuons = fakeableMuons;
-    else if ( leptonSelection == kTight    ) selMuons = tightMuons;
-    else assert(0);
-
-    std::vector<RecoElectron> electrons = electronReader->read();
-    std::vector<const RecoElectron*> electron_ptrs = convert_to_ptrs(electrons);
-    std::vector<const RecoElectron*> cleanedElectrons = electronCleaner(electron_ptrs, selMuons);
-    std::vector<const RecoElectron*> preselElectrons = preselElectronSelector(cleanedElectrons);
-    std::vector<const RecoElectron*> fakeableElectrons = fakeableElectronSelector(preselElectrons);
-    std::vector<const RecoElectron*> tightElectrons = tightElectronSelector(preselElectrons);
-    std::vector<const RecoElectron*> selElectrons;
-    if      ( leptonSelection == kLoose    ) selElectrons = preselElectrons;
-    else if ( leptonSelection == kFakeable ) selElectrons = fakeableElectrons;
-    else if ( leptonSelection == kTight    ) selElectrons = tightElectrons;
-    else assert(0);
-
-    std::vector<RecoHadTau> hadTaus = hadTauReader->read();
-    std::vector<const RecoHadTau*> hadTau_ptrs = convert_to_ptrs(hadTaus);
-    std::vector<const RecoHadTau*> cleanedHadTaus = hadTauCleaner(hadTau_ptrs, selMuons, selElectrons);
-    std::vector<const RecoHadTau*> selHadTaus = hadTauSelector(cleanedHadTaus);
+      std::vector<RecoMuon> muons = muonReader->read();
+      std::vector<const RecoMuon*> muon_ptrs = convert_to_ptrs(muons);
+      std::vector<const RecoMuon*> cleanedMuons = muon_ptrs; // CV: no cleaning needed for muons, as they have the highest priority in the overlap removal
+      muonSelector(cleanedMuons, muonSelection);
+      std::vector<const RecoMuon*> preselMuons = muonSelection.filter(kSelectionLoose);
+      std::vector<const RecoMuon*> fakeableMuons = muonSelection.filter(kSelectionLoose | kSelectionFakeable);
+      std::vector<const RecoMuon*> tightMuons = muonSelection.filter(kSelectionLoose | kSelectionTight);
+      std::vector<const RecoMuon*> selMuons;
+      if      ( leptonSelection == kLoose    ) selMuons = preselMuons;
+      else if ( leptonSelection == kFakeable ) selMuons = fakeableMuons;
+      else if ( leptonSelection == kTight    ) selMuons = tightMuons;
+      else assert(0);
+
+      std::vector<RecoElectron> electrons = electronReader->read();
+      std::vector<const RecoElectron*> electron_ptrs = convert_to_ptrs(electrons);
+      std::vector<const RecoElectron*> cleanedElectrons = electronCleaner(electron_ptrs, selMuons);
+      electronSelector(cleanedElectrons, electronSelection);
+      std::vector<const RecoElectron*> preselElectrons = electronSelection.filter(kSelectionLoose);
+      std::vector<const RecoElectron*> fakeableElectrons = electronSelection.filter(kSelectionLoose | kSelectionFakeable);
+      std::vector<const RecoElectron*> tightElectrons = electronSelection.filter(kSelectionLoose | kSelectionTight);
+      std::vector<const RecoElectron*> selElectrons;
+      if      ( leptonSelection == kLoose    ) selElectrons = preselElectrons;
+      else if ( leptonSelection == kFakeable ) selElectrons = fakeableElectrons;
+      else if ( leptonSelection == kTight    ) selElectrons = tightElectrons;
+      else assert(0);
+
+      std::vector<RecoHadTau> hadTaus = hadTauReader->read();
+      std::vector<const RecoHadTau*> hadTau_ptrs = convert_to_ptrs(hadTaus);
+      std::vector<const RecoHadTau*> cleanedHadTaus = hadTauCleaner(hadTau_ptrs, selMuons, selElectrons);
+      std::vector<const RecoHadTau*> selHadTaus = hadTauSelector(cleanedHadTaus);
     
 //--- build collections of jets and select subset of jets passing b-tagging criteria
-    std::vector<RecoJet> jets = jetReader->read();
-    std::vector<const RecoJet*> jet_ptrs = convert_to_ptrs(jets);
-    std::vector<const RecoJet*> cleanedJets = jetCleaner(jet_ptrs, selMuons, selElectrons, selHadTaus);
-    std::vector<const RecoJet*> selJets = jetSelector(cleanedJets);
-    std::vector<const RecoJet*> selBJets_loose = jetSelectorBtagLoose(cleanedJets);
-    std::vector<const RecoJet*> selBJets_medium = jetSelectorBtagMedium(cleanedJets);
+      std::vector<RecoJet> jets = jetReader->read();
+      std::vector<const RecoJet*> jet_ptrs = convert_to_ptrs(jets);
+      std::vector<const RecoJet*> cleanedJets = jetCleaner(jet_ptrs, selMuons, selElectrons, selHadTaus);
+      std::vector<const RecoJet*> selJets = jetSelector(cleanedJets);
+      std::vector<const RecoJet*> selBJets_loose = jetSelectorBtagLoose(cleanedJets);
+      std::vector<const RecoJet*> selBJets_medium = jetSelectorBtagMedium(cleanedJets);
 
 //--- build collections of generator level particles
-    std::vector<GenLepton> genLeptons;
-    std::vector<GenLepton> genElectrons;
-    std::vector<GenLepton> genMuons;
-    std::vector<GenHadTau> genHadTaus;
-    std::vector<GenJet> genJets;
-    if ( isMC ) {
-      genLeptons = genLeptonReader->read();
-      for ( std::vector<GenLepton>::const_iterator genLepton = genLeptons.begin();
-	    genLepton != genLeptons.end(); ++genLepton ) {
-	int abs_pdgId = std::abs(genLepton->pdgId_);
-	if      ( abs_pdgId == 11 ) genElectrons.push_back(*genLepton);
-	else if ( abs_pdgId == 13 ) genMuons.push_back(*genLepton);
+      std::vector<GenLepton> genLeptons;
+      std::vector<GenLepton> genElectrons;
+      std::vector<GenLepton> genMuons;
+      std::vector<GenHadTau> genHadTaus;
+      std::vector<GenJet> genJets;
+      if ( isMC ) {
+        genLeptons = genLeptonReader->read();
+        for ( std::vector<GenLepton>::const_iterator genLepton = genLeptons.begin();
+	      genLepton != genLeptons.end(); ++genLepton ) {
+	  int abs_pdgId = std::abs(genLepton->pdgId_);
+	  if      ( abs_pdgId == 11 ) genElectrons.push_back(*genLepton);
+	  else if ( abs_pdgId == 13 ) genMuons.push_back(*genLepton);
+        }
+        genHadTaus = genHadTauReader->read();
+        genJets = genJetReader->read();
       }
-      genHadTaus = genHadTauReader->read();
-      genJets = genJetReader->read();
-    }
 
 //--- match reconstructed to generator level particles
-    if ( isMC ) {
-      muonGenMatcher.addGenLeptonMatch(preselMuons, genLeptons, 0.3);
-      muonGenMatcher.addGenHadTauMatch(preselMuons, genHadTaus, 0.3);
-      muonGenMatcher.addGenJetMatch(preselMuons, genJets, 0.5);
-
-      electronGenMatcher.addGenLeptonMatch(preselElectrons, genLeptons, 0.3);
-      electronGenMatcher.addGenHadTauMatch(preselElectrons, genHadTaus, 0.3);
-      electronGenMatcher.addGenJetMatch(preselElectrons, genJets, 0.5);
-
-      hadTauGenMatcher.addGenLeptonMatch(selHadTaus, genLeptons, 0.3);
-      hadTauGenMatcher.addGenHadTauMatch(selHadTaus, genHadTaus, 0.3);
-      hadTauGenMatcher.addGenJetMatch(selHadTaus, genJets, 0.5);
-
-      jetGenMatcher.addGenLeptonMatch(selJets, genLeptons, 0.3);
-      jetGenMatcher.addGenHadTauMatch(selJets, genHadTaus, 0.3);
-      jetGenMatcher.addGenJetMatch(selJets, genJets, 0.5);
-    }
+      genMatchTable.clear();
+      if ( isMC ) {
+        genMatchTable.setGenParticles(genLeptons, genHadTaus, genJets);
+        genMatchTable.addRecParticles(muons, preselMuons);
+        genMatchTable.addRecParticles(electrons, preselElectrons);
+        genMatchTable.addRecParticles(hadTaus, selHadTaus);
+        genMatchTable.addRecParticles(jets, selJets);
+        genMatchTable.computeGenMatches();
+      }
 
 //--- apply preselection
-    std::vector<const RecoLepton*> preselLeptons;    
-    preselLeptons.reserve(preselElectrons.size() + preselMuons.size());
-    preselLeptons.insert(preselLeptons.end(), preselElectrons.begin(), preselElectrons.end());
-    preselLeptons.insert(preselLeptons.end(), preselMuons.begin(), preselMuons.end());
-    std::sort(preselLeptons.begin(), preselLeptons.end(), isHigherPt);
-    // require exactly two leptons passing loose preselection criteria
-    if ( !(preselLeptons.size() == 2) ) continue;
-    const RecoLepton* preselLepton_lead = preselLeptons[0];
-    int preselLepton_lead_type = getLeptonType(preselLepton_lead->pdgId_);
-    const RecoLepton* preselLepton_sublead = preselLeptons[1];
-    int preselLepton_sublead_type = getLeptonType(preselLepton_sublead->pdgId_);
-
-    // require that trigger paths match event category (with event category based on preselLeptons);
-    if ( preselElectrons.size() == 2 &&                            !(isTriggered_1e  || isTriggered_2e)                       ) continue;
-    if (                                preselMuons.size() == 2 && !(isTriggered_1mu || isTriggered_2mu)                      ) continue;
-    if ( preselElectrons.size() == 1 && preselMuons.size() == 1 && !(isTriggered_1e  || isTriggered_1mu || isTriggered_1e1mu) ) continue;
-
-    // apply requirement on jets (incl. b-tagged jets) and hadronic taus on preselection level
-    if ( !(selJets.size() >= 2) ) continue;
-    if ( !(selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1) ) continue;
-    if ( !(selHadTaus.size() == 1) ) continue;
+      std::vector<const RecoLepton*> preselLeptons;    
+      preselLeptons.reserve(preselElectrons.size() + preselMuons.size());
+      preselLeptons.insert(preselLeptons.end(), preselElectrons.begin(), preselElectrons.end());
+      preselLeptons.insert(preselLeptons.end(), preselMuons.begin(), preselMuons.end());
+      std::sort(preselLeptons.begin(), preselLeptons.end(), isHigherPt);
+      // require exactly two leptons passing loose preselection criteria
+      if ( !cutFlow(cut_preselLeptons, preselLeptons.size() == 2, lumiScale) ) continue;
+      const RecoLepton* preselLepton_lead = preselLeptons[0];
+      int preselLepton_lead_type = getLeptonType(preselLepton_lead->pdgId_);
+      const RecoLepton* preselLepton_sublead = preselLeptons[1];
+      int preselLepton_sublead_type = getLeptonType(preselLepton_sublead->pdgId_);
+
+      // require that trigger paths match event category (with event category based on preselLeptons);
+      bool failsTriggerMatch_presel = false;
+      if ( preselElectrons.size() == 2 &&                            !(isTriggered_1e  || isTriggered_2e)                       ) failsTriggerMatch_presel = true;
+      if (                                preselMuons.size() == 2 && !(isTriggered_1mu || isTriggered_2mu)                      ) failsTriggerMatch_presel = true;
+      if ( preselElectrons.size() == 1 && preselMuons.size() == 1 && !(isTriggered_1e  || isTriggered_1mu || isTriggered_1e1mu) ) failsTriggerMatch_presel = true;
+      if ( !cutFlow(cut_preselLeptons_trigger, !failsTriggerMatch_presel, lumiScale) ) continue;
+
+      // apply requirement on jets (incl. b-tagged jets) and hadronic taus on preselection level
+      if ( !cutFlow(cut_preselJets, selJets.size() >= 2, lumiScale) ) continue;
+      if ( !cutFlow(cut_preselBJets, selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1, lumiScale) ) continue;
+      if ( !cutFlow(cut_preselHadTaus, selHadTaus.size() == 1, lumiScale) ) continue;
 
 //--- compute MHT and linear MET discriminant (met_LD)
-    LV mht_p4(0,0,0,0);
-    for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
-	  jet != selJets.end(); ++jet ) {
-      mht_p4 += (*jet)->p4_;
-    }
-    for ( std::vector<const RecoLepton*>::const_iterator lepton = preselLeptons.begin();
-	  lepton != preselLeptons.end(); ++lepton ) {
-      mht_p4 += (*lepton)->p4_;
-    }
-    for ( std::vector<const RecoHadTau*>::const_iterator hadTau = selHadTaus.begin();
-	  hadTau != selHadTaus.end(); ++hadTau ) {
-      mht_p4 += (*hadTau)->p4_;
-    }
-    double met_LD = met_coef*met_p4.pt() + mht_coef*mht_p4.pt();    
+      LV mht_p4(0,0,0,0);
+      for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
+	    jet != selJets.end(); ++jet ) {
+        mht_p4 += (*jet)->p4();
+      }
+      for ( std::vector<const RecoLepton*>::const_iterator lepton = preselLeptons.begin();
+	    lepton != preselLeptons.end(); ++lepton ) {
+        mht_p4 += (*lepton)->p4();
+      }
+      for ( std::vector<const RecoHadTau*>::const_iterator hadTau = selHadTaus.begin();
+	    hadTau != selHadTaus.end(); ++hadTau ) {
+        mht_p4 += (*hadTau)->p4();
+      }
+      double met_LD = met_coef*met_p4.pt() + mht_coef*mht_p4.pt();    
 
 //--- compute event-level weight for data/MC correction of b-tagging efficiency and mistag rate
 //   (using the method "Event reweighting using scale factors calculated with a tag and probe method", 
 //    described on the BTV POG twiki https://twiki.cern.ch/twiki/bin/view/CMS/BTagShapeCalibration )
-    double evtWeight = lumiScale;
-    for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
-	  jet != selJets.end(); ++jet ) {
-      evtWeight *= (*jet)->BtagWeight_;
-    }
+      double evtWeight = lumiScale;
+      for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
+	    jet != selJets.end(); ++jet ) {
+        evtWeight *= (*jet)->BtagWeight_;
+      }
 
 //--- apply data/MC corrections for trigger efficiency,
 //    and efficiencies for lepton to pass loose identification and isolation criteria
-    if ( isMC ) {
-      evtWeight *= sf_triggerEff(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
-      evtWeight *= sf_leptonID_and_Iso_loose(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
-    }    
+      if ( isMC ) {
+        evtWeight *= sf_triggerEff(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
+        evtWeight *= sf_leptonID_and_Iso_loose(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
+      }    
 
 //--- compute output of BDTs used to discriminate ttH vs. ttV and ttH vs. ttbar 
 //    in 2los_1tau category of ttH multilepton analysis 
-    mvaInputs["max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))"] = std::max(std::fabs(preselLepton_lead->eta_), std::fabs(preselLepton_sublead->eta_));
-    mvaInputs["MT_met_lep1"]                = comp_MT_met_lep1(*preselLepton_lead, met_pt, met_phi);
-    mvaInputs["nJet25_Recl"]                = comp_n_jet25_recl(selJets);
-    mvaInputs["mindr_lep1_jet"]             = comp_mindr_lep1_jet(*preselLepton_lead, selJets);
-    mvaInputs["mindr_lep2_jet"]             = comp_mindr_lep2_jet(*preselLepton_sublead, selJets);
-    mvaInputs["LepGood_conePt[iF_Recl[0]]"] = comp_lep1_conePt(*preselLepton_lead);
-    mvaInputs["LepGood_conePt[iF_Recl[1]]"] = comp_lep2_conePt(*preselLepton_sublead);
-    mvaInputs["min(met_pt,400)"]            = std::min(met_pt, (Float_t)400.);
-    mvaInputs["avg_dr_jet"]                 = comp_avg_dr_jet(selJets);
-
-    double mvaOutput_2los_ttV = mva_2los_ttV(mvaInputs);
-    double mvaOutput_2los_ttbar = mva_2los_ttbar(mvaInputs);
+      mvaInputs[kMVAInput_2lss_max_lep_eta]    = std::max(std::fabs(preselLepton_lead->eta_), std::fabs(preselLepton_sublead->eta_));
+      mvaInputs[kMVAInput_2lss_MT_met_lep1]    = comp_MT_met_lep1(*preselLepton_lead, met_pt, met_phi);
+      mvaInputs[kMVAInput_2lss_nJet25_Recl]    = comp_n_jet25_recl(selJets);
+      mvaInputs[kMVAInput_2lss_mindr_lep1_jet] = comp_mindr_lep1_jet(*preselLepton_lead, selJets);
+      mvaInputs[kMVAInput_2lss_mindr_lep2_jet] = comp_mindr_lep2_jet(*preselLepton_sublead, selJets);
+      mvaInputs[kMVAInput_2lss_lep1_conePt]    = comp_lep1_conePt(*preselLepton_lead);
+      mvaInputs[kMVAInput_2lss_lep2_conePt]    = comp_lep2_conePt(*preselLepton_sublead);
+      mvaInputs[kMVAInput_2lss_met_pt]         = std::min(met_pt, (Float_t)400.);
+      mvaInputs[kMVAInput_2lss_avg_dr_jet]     = comp_avg_dr_jet(selJets);
+
+      double mvaOutput_2los_ttV = mva_2los_ttV(mvaInputs);
+      double mvaOutput_2los_ttbar = mva_2los_ttbar(mvaInputs);
 
 //--- compute integer discriminant based on both BDT outputs,
 //    as defined in Table X of AN-2015/321
-    Double_t mvaDiscr_2los = -1;
-    if      ( mvaOutput_2los_ttbar > +0.3 && mvaOutput_2los_ttV >  -0.1 ) mvaDiscr_2los = 6.;
-    else if ( mvaOutput_2los_ttbar > +0.3 && mvaOutput_2los_ttV <= -0.1 ) mvaDiscr_2los = 5.;
-    else if ( mvaOutput_2los_ttbar > -0.2 && mvaOutput_2los_ttV >  -0.1 ) mvaDiscr_2los = 4.;
-    else if ( mvaOutput_2los_ttbar > -0.2 && mvaOutput_2los_ttV <= -0.1 ) mvaDiscr_2los = 3.;
-    else if (                                mvaOutput_2los_ttV >  -0.1 ) mvaDiscr_2los = 2.;
-    else                                                                  mvaDiscr_2los = 1.;
+      Double_t mvaDiscr_2los = -1;
+      if      ( mvaOutput_2los_ttbar > +0.3 && mvaOutput_2los_ttV >  -0.1 ) mvaDiscr_2los = 6.;
+      else if ( mvaOutput_2los_ttbar > +0.3 && mvaOutput_2los_ttV <= -0.1 ) mvaDiscr_2los = 5.;
+      else if ( mvaOutput_2los_ttbar > -0.2 && mvaOutput_2los_ttV >  -0.1 ) mvaDiscr_2los = 4.;
+      else if ( mvaOutput_2los_ttbar > -0.2 && mvaOutput_2los_ttV <= -0.1 ) mvaDiscr_2los = 3.;
+      else if (                                mvaOutput_2los_ttV >  -0.1 ) mvaDiscr_2los = 2.;
+      else                                                                  mvaDiscr_2los = 1.;
 
 //--- fill histograms with events passing preselection
-    preselMuonHistManager.fillHistograms(preselMuons, evtWeight);
-    preselElectronHistManager.fillHistograms(preselElectrons, evtWeight);
-    preselHadTauHistManager.fillHistograms(selHadTaus, evtWeight);
-    preselJetHistManager.fillHistograms(selJets, evtWeight);
-    selBJet_looseHistManager.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_mediumHistManager.fillHistograms(selBJets_medium, evtWeight);
-    preselMEtHistManager.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
-    preselEvtHistManager.fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
+      histManagers.preselMuonHistManager_.fillHistograms(preselMuons, genMatchTable, evtWeight);
+      histManagers.preselElectronHistManager_.fillHistograms(preselElectrons, genMatchTable, evtWeight);
+      histManagers.preselHadTauHistManager_.fillHistograms(selHadTaus, genMatchTable, evtWeight);
+      histManagers.preselJetHistManager_.fillHistograms(selJets, genMatchTable, evtWeight);
+      histManagers.selBJet_looseHistManager_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+      histManagers.selBJet_mediumHistManager_.fillHistograms(selBJets_medium, genMatchTable, evtWeight);
+      histManagers.preselMEtHistManager_.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
+      histManagers.preselEvtHistManager_.fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
 
 //--- apply final event selection 
-    std::vector<const RecoLepton*> selLeptons;    
-    selLeptons.reserve(selElectrons.size() + selMuons.size());
-    selLeptons.insert(selLeptons.end(), selElectrons.begin(), selElectrons.end());
-    selLeptons.insert(selLeptons.end(), selMuons.begin(), selMuons.end());
-    std::sort(selLeptons.begin(), selLeptons.end(), isHigherPt);
-    // require exactly two leptons passing tight selection criteria of final event selection 
-    if ( !(selLeptons.size() == 2) ) continue;
-    const RecoLepton* selLepton_lead = selLeptons[0];
-    const RecoLepton* selLepton_sublead = selLeptons[1];
-
-    // require that trigger paths match event category (with event category based on selLeptons);
-    if ( selElectrons.size() == 2 &&                         !(isTriggered_1e  || isTriggered_2e)                       ) continue;
-    if (                             selMuons.size() == 2 && !(isTriggered_1mu || isTriggered_2mu)                      ) continue;
-    if ( selElectrons.size() == 1 && selMuons.size() == 1 && !(isTriggered_1e  || isTriggered_1mu || isTriggered_1e1mu) ) continue;
-
-    // apply requirement on jets (incl. b-tagged jets) and hadronic taus on level of final event selection
-    if ( !(selJets.size() >= 4) ) continue;
-    if ( !(selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1) ) continue;
-    if ( !(selHadTaus.size() == 1) ) continue;
+      std::vector<const RecoLepton*> selLeptons;    
+      selLeptons.reserve(selElectrons.size() + selMuons.size());
+      selLeptons.insert(selLeptons.end(), selElectrons.begin(), selElectrons.end());
+      selLeptons.insert(selLeptons.end(), selMuons.begin(), selMuons.end());
+      std::sort(selLeptons.begin(), selLeptons.end(), isHigherPt);
+      // require exactly two leptons passing tight selection criteria of final event selection 
+      if ( !cutFlow(cut_selLeptons, selLeptons.size() == 2, evtWeight) ) continue;
+      const RecoLepton* selLepton_lead = selLeptons[0];
+      const RecoLepton* selLepton_sublead = selLeptons[1];
+
+      // require that trigger paths match event category (with event category based on selLeptons);
+      bool failsTriggerMatch_sel = false;
+      if ( selElectrons.size() == 2 &&                         !(isTriggered_1e  || isTriggered_2e)                       ) failsTriggerMatch_sel = true;
+      if (                             selMuons.size() == 2 && !(isTriggered_1mu || isTriggered_2mu)                      ) failsTriggerMatch_sel = true;
+      if ( selElectrons.size() == 1 && selMuons.size() == 1 && !(isTriggered_1e  || isTriggered_1mu || isTriggered_1e1mu) ) failsTriggerMatch_sel = true;
+      if ( !cutFlow(cut_selLeptons_trigger, !failsTriggerMatch_sel, evtWeight) ) continue;
+
+      // apply requirement on jets (incl. b-tagged jets) and hadronic taus on level of final event selection
+      if ( !cutFlow(cut_selJets, selJets.size() >= 4, evtWeight) ) continue;
+      if ( !cutFlow(cut_selBJets, selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1, evtWeight) ) continue;
+      if ( !cutFlow(cut_selHadTaus, selHadTaus.size() == 1, evtWeight) ) continue;
      
-    bool failsLowMassVeto = false;
-    for ( std::vector<const RecoLepton*>::const_iterator lepton1 = selLeptons.begin();
-	  lepton1 != selLeptons.end(); ++lepton1 ) {
-      for ( std::vector<const RecoLepton*>::const_iterator lepton2 = lepton1 + 1;
-	    lepton2 != selLeptons.end(); ++lepton2 ) {
-	if ( ((*lepton1)->p4_ + (*lepton2)->p4_).mass() < 12. ) {
-	  failsLowMassVeto = true;
-	}
+      bool failsLowMassVeto = false;
+      for ( std::vector<const RecoLepton*>::const_iterator lepton1 = selLeptons.begin();
+	    lepton1 != selLeptons.end(); ++lepton1 ) {
+        for ( std::vector<const RecoLepton*>::const_iterator lepton2 = lepton1 + 1;
+	      lepton2 != selLeptons.end(); ++lepton2 ) {
+	  if ( ((*lepton1)->p4() + (*lepton2)->p4()).mass() < 12. ) {
+	    failsLowMassVeto = true;
+	  }
+        }
       }
-    }
-    if ( failsLowMassVeto ) continue;
+      if ( !cutFlow(cut_lowMassVeto, !failsLowMassVeto, evtWeight) ) continue;
 
-    double minPt_lead = 20.;
-    double minPt_sublead = selLepton_sublead->is_electron() ? 15. : 10.;
-    if ( !(selLepton_lead->pt_ > minPt_lead && selLepton_sublead->pt_ > minPt_sublead) ) continue;
+      double minPt_lead = 20.;
+      double minPt_sublead = selLepton_sublead->is_electron() ? 15. : 10.;
+      if ( !cutFlow(cut_leptonPt, selLepton_lead->pt_ > minPt_lead && selLepton_sublead->pt_ > minPt_sublead, evtWeight) ) continue;
 
-    bool isCharge_OS = selLepton_lead->charge_*selLepton_sublead->charge_ < 0;
-    if ( !isCharge_OS ) continue;
+      bool isCharge_OS = selLepton_lead->charge_*selLepton_sublead->charge_ < 0;
+      if ( !cutFlow(cut_charge, isCharge_OS, evtWeight) ) continue;
 
-    if ( selLepton_lead->is_electron() && selLepton_sublead->is_electron() ) {
+      bool isElectronPair = selLepton_lead->is_electron() && selLepton_sublead->is_electron();
       bool failsZbosonMassVeto = false;
-      for ( std::vector<const RecoLepton*>::const_iterator lepton1 = selLeptons.begin();
-	    lepton1 != selLeptons.end(); ++lepton1 ) {
-	for ( std::vector<const RecoLepton*>::const_iterator lepton2 = lepton1 + 1;
-	      lepton2 != selLeptons.end(); ++lepton2 ) {
-	  if ( std::fabs(((*lepton1)->p4_ + (*lepton2)->p4_).mass() - z_mass) < z_window ) {
-	    failsZbosonMassVeto = true;
+      if ( isElectronPair ) {
+        for ( std::vector<const RecoLepton*>::const_iterator lepton1 = selLeptons.begin();
+	      lepton1 != selLeptons.end(); ++lepton1 ) {
+	  for ( std::vector<const RecoLepton*>::const_iterator lepton2 = lepton1 + 1;
+		lepton2 != selLeptons.end(); ++lepton2 ) {
+	    if ( std::fabs(((*lepton1)->p4() + (*lepton2)->p4()).mass() - z_mass) < z_window ) {
+	      failsZbosonMassVeto = true;
+	    }
 	  }
-	}
+        }
       }
-      if ( failsZbosonMassVeto ) continue;
+      if ( !cutFlow(cut_ZbosonMassVeto, !failsZbosonMassVeto, evtWeight) ) continue;
+      if ( !cutFlow(cut_metLD, !(isElectronPair && met_LD < 0.2), evtWeight) ) continue;
 
-      if ( met_LD < 0.2 ) continue;
-    }
-
-    if ( leptonSelection == kFakeable && (tightMuons.size() + tightElectrons.size()) >= 2 ) continue; // CV: avoid overlap with signal region
+      // CV: avoid overlap with signal region
+      if ( !cutFlow(cut_tightLeptonVeto, !(leptonSelection == kFakeable && (tightMuons.size() + tightElectrons.size()) >= 2), evtWeight) ) continue;
 
 //--- apply data/MC corrections for efficiencies of leptons passing the loose identification and isolation criteria
 //    to also pass the tight identification and isolation criteria
-    if ( isMC ) {
-      double sf_tight_to_loose = 1.;
-      if ( leptonSelection == kFakeable ) {
-	sf_tight_to_loose = sf_leptonID_and_Iso_fakeable_to_loose(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
-      } else if ( leptonSelection == kTight ) {
-	sf_tight_to_loose = sf_leptonID_and_Iso_tight_to_loose(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
+      if ( isMC ) {
+        double sf_tight_to_loose = 1.;
+        if ( leptonSelection == kFakeable ) {
+	  sf_tight_to_loose = sf_leptonID_and_Iso_fakeable_to_loose(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
+        } else if ( leptonSelection == kTight ) {
+	  sf_tight_to_loose = sf_leptonID_and_Iso_tight_to_loose(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
+        }
+        evtWeight *= sf_tight_to_loose;
       }
-      evtWeight *= sf_tight_to_loose;
-    }
 
 //--- fill histograms with events passing final selection 
-    selMuonHistManager.fillHistograms(selMuons, evtWeight);
-    selElectronHistManager.fillHistograms(selElectrons, evtWeight);
-    selHadTauHistManager.fillHistograms(selHadTaus, evtWeight);
-    selJetHistManager.fillHistograms(selJets, evtWeight);
-    selJetHistManager_lead.fillHistograms(selJets, evtWeight);
-    selJetHistManager_sublead.fillHistograms(selJets, evtWeight);
-    selBJet_looseHistManager.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_looseHistManager_lead.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_looseHistManager_sublead.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_mediumHistManager.fillHistograms(selBJets_medium, evtWeight);
-    selMEtHistManager.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
-    selEvtHistManager.fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
-
-    int category = -1;
-    if      ( selElectrons.size() == 2 &&                         selBJets_medium.size() >= 1 ) category = k2eos_btight;
-    else if ( selElectrons.size() == 2                                                        ) category = k2eos_bloose;
-    else if ( selElectrons.size() == 1 && selMuons.size() == 1 && selBJets_medium.size() >= 1 ) category = k1e1muos_btight;
-    else if ( selElectrons.size() == 1 && selMuons.size() == 1                                ) category = k1e1muos_bloose;
-    else if (                             selMuons.size() == 2 && selBJets_medium.size() >= 1 ) category = k2muos_btight;
-    else if (                             selMuons.size() == 2                                ) category = k2muos_bloose;
-    else assert(0);
-
-    if ( category == k2eos_btight ) {
-      selElectronHistManager_category["2eos_1tau_btight"]["leadElectron"]->fillHistograms(selElectrons, evtWeight);
-      selElectronHistManager_category["2eos_1tau_btight"]["subleadElectron"]->fillHistograms(selElectrons, evtWeight);
-      selEvtHistManager_category["2eos_1tau_btight"]->fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
-    } else if ( category == k2eos_bloose ) {
-      selElectronHistManager_category["2eos_1tau_bloose"]["leadElectron"]->fillHistograms(selElectrons, evtWeight);
-      selElectronHistManager_category["2eos_1tau_bloose"]["subleadElectron"]->fillHistograms(selElectrons, evtWeight);
-      selEvtHistManager_category["2eos_1tau_bloose"]->fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
-    } else if ( category == k1e1muos_btight ) {
-      selElectronHistManager_category["1e1muos_1tau_btight"]["electron"]->fillHistograms(selElectrons, evtWeight);
-      selMuonHistManager_category["1e1muos_1tau_btight"]["muon"]->fillHistograms(selMuons, evtWeight);
-      selEvtHistManager_category["1e1muos_1tau_btight"]->fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
-    } else if ( category == k1e1muos_bloose ) {
-      selElectronHistManager_category["1e1muos_1tau_bloose"]["electron"]->fillHistograms(selElectrons, evtWeight);
-      selMuonHistManager_category["1e1muos_1tau_bloose"]["muon"]->fillHistograms(selMuons, evtWeight);
-      selEvtHistManager_category["1e1muos_1tau_bloose"]->fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
-    } else if ( category == k2muos_btight ) {
-      selMuonHistManager_category["2muos_1tau_btight"]["leadMuon"]->fillHistograms(selMuons, evtWeight);
-      selMuonHistManager_category["2muos_1tau_btight"]["subleadMuon"]->fillHistograms(selMuons, evtWeight);
-      selEvtHistManager_category["2muos_1tau_btight"]->fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
-    } else if ( category == k2muos_bloose ) {
-      selMuonHistManager_category["2muos_1tau_bloose"]["leadMuon"]->fillHistograms(selMuons, evtWeight);
-      selMuonHistManager_category["2muos_1tau_bloose"]["subleadMuon"]->fillHistograms(selMuons, evtWeight);
-      selEvtHistManager_category["2muos_1tau_bloose"]->fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
-    } 
-
-    (*selEventsFile) << run << ":" << lumi << ":" << event;
-
-    ++selectedEntries;
-    selectedEntries_weighted += evtWeight;
+      histManagers.selMuonHistManager_.fillHistograms(selMuons, genMatchTable, evtWeight);
+      histManagers.selElectronHistManager_.fillHistograms(selElectrons, genMatchTable, evtWeight);
+      histManagers.selHadTauHistManager_.fillHistograms(selHadTaus, genMatchTable, evtWeight);
+      histManagers.selJetHistManager_.fillHistograms(selJets, genMatchTable, evtWeight);
+      histManagers.selJetHistManager_lead_.fillHistograms(selJets, genMatchTable, evtWeight);
+      histManagers.selJetHistManager_sublead_.fillHistograms(selJets, genMatchTable, evtWeight);
+      histManagers.selBJet_looseHistManager_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+      histManagers.selBJet_looseHistManager_lead_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+      histManagers.selBJet_looseHistManager_sublead_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+      histManagers.selBJet_mediumHistManager_.fillHistograms(selBJets_medium, genMatchTable, evtWeight);
+      histManagers.selMEtHistManager_.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
+      histManagers.selEvtHistManager_.fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
+
+      int category = -1;
+      if      ( selElectrons.size() == 2 &&                         selBJets_medium.size() >= 1 ) category = k2eos_btight;
+      else if ( selElectrons.size() == 2                                                        ) category = k2eos_bloose;
+      else if ( selElectrons.size() == 1 && selMuons.size() == 1 && selBJets_medium.size() >= 1 ) category = k1e1muos_btight;
+      else if ( selElectrons.size() == 1 && selMuons.size() == 1                                ) category = k1e1muos_bloose;
+      else if (                             selMuons.size() == 2 && selBJets_medium.size() >= 1 ) category = k2muos_btight;
+      else if (                             selMuons.size() == 2                                ) category = k2muos_bloose;
+      else assert(0);
+
+      if ( category == k2eos_btight ) {
+        histManagers.selElectronHistManager_category_["2eos_1tau_btight"]["leadElectron"]->fillHistograms(selElectrons, genMatchTable, evtWeight);
+        histManagers.selElectronHistManager_category_["2eos_1tau_btight"]["subleadElectron"]->fillHistograms(selElectrons, genMatchTable, evtWeight);
+        histManagers.selEvtHistManager_category_["2eos_1tau_btight"]->fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
+      } else if ( category == k2eos_bloose ) {
+        histManagers.selElectronHistManager_category_["2eos_1tau_bloose"]["leadElectron"]->fillHistograms(selElectrons, genMatchTable, evtWeight);
+        histManagers.selElectronHistManager_category_["2eos_1tau_bloose"]["subleadElectron"]->fillHistograms(selElectrons, genMatchTable, evtWeight);
+        histManagers.selEvtHistManager_category_["2eos_1tau_bloose"]->fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
+      } else if ( category == k1e1muos_btight ) {
+        histManagers.selElectronHistManager_category_["1e1muos_1tau_btight"]["electron"]->fillHistograms(selElectrons, genMatchTable, evtWeight);
+        histManagers.selMuonHistManager_category_["1e1muos_1tau_btight"]["muon"]->fillHistograms(selMuons, genMatchTable, evtWeight);
+        histManagers.selEvtHistManager_category_["1e1muos_1tau_btight"]->fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
+      } else if ( category == k1e1muos_bloose ) {
+        histManagers.selElectronHistManager_category_["1e1muos_1tau_bloose"]["electron"]->fillHistograms(selElectrons, genMatchTable, evtWeight);
+        histManagers.selMuonHistManager_category_["1e1muos_1tau_bloose"]["muon"]->fillHistograms(selMuons, genMatchTable, evtWeight);
+        histManagers.selEvtHistManager_category_["1e1muos_1tau_bloose"]->fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
+      } else if ( category == k2muos_btight ) {
+        histManagers.selMuonHistManager_category_["2muos_1tau_btight"]["leadMuon"]->fillHistograms(selMuons, genMatchTable, evtWeight);
+        histManagers.selMuonHistManager_category_["2muos_1tau_btight"]["subleadMuon"]->fillHistograms(selMuons, genMatchTable, evtWeight);
+        histManagers.selEvtHistManager_category_["2muos_1tau_btight"]->fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
+      } else if ( category == k2muos_bloose ) {
+        histManagers.selMuonHistManager_category_["2muos_1tau_bloose"]["leadMuon"]->fillHistograms(selMuons, genMatchTable, evtWeight);
+        histManagers.selMuonHistManager_category_["2muos_1tau_bloose"]["subleadMuon"]->fillHistograms(selMuons, genMatchTable, evtWeight);
+        histManagers.selEvtHistManager_category_["2muos_1tau_bloose"]->fillHistograms(mvaOutput_2los_ttV, mvaOutput_2los_ttbar, mvaDiscr_2los, selJets.size(), evtWeight);
+      } 
+
+      selEventsFile << run << ":" << lumi << ":" << event;
+
+      ++selectedEntries;
+      selectedEntries_weighted += evtWeight;
+    }
+
+    lock.lock();
+
+    delete run_lumi_eventSelector;
+
+    delete muonReader;
+    delete electronReader;
+    delete hadTauReader;
+    delete jetReader;
+    delete genLeptonReader;
+    delete genHadTauReader;
+    delete genJetReader;
+
+    hltPaths_delete(triggers_1e);
+    hltPaths_delete(triggers_2e);
+    hltPaths_delete(triggers_1mu);
+    hltPaths_delete(triggers_2mu);
+    hltPaths_delete(triggers_1e1mu);
+
+    delete eventSource_ptr;
+    if ( inputTree_worker != inputTree ) delete inputTree_worker;
+    if ( inputCache_worker != inputCache ) delete inputCache_worker;
+  };
+
+  if ( numThreads == 1 ) {
+    processEntries(0);
+  } else {
+    std::vector<std::exception_ptr> exceptions(numThreads);
+    std::vector<std::thread> workers;
+    for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+      workers.push_back(std::thread([&, idxWorker]() {
+        try {
+          processEntries(idxWorker);
+        } catch ( ... ) {
+          exceptions[idxWorker] = std::current_exception();
+        }
+      }));
+    }
+    for ( std::vector<std::thread>::iterator worker = workers.begin();
+	  worker != workers.end(); ++worker ) {
+      worker->join();
+    }
+    for ( std::vector<std::exception_ptr>::const_iterator exception = exceptions.begin();
+	  exception != exceptions.end(); ++exception ) {
+      if ( (*exception) ) std::rethrow_exception(*exception);
+    }
   }
 
-  std::cout << "num. Entries = " << numEntries << std::endl;
+//--- combine results of all threads, in order of the threads,
+//    so that the output does not depend on the order in which the threads have finished
+  int analyzedEntries = 0;
+  int selectedEntries = 0;
+  double selectedEntries_weighted = 0.;
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    (*selEventsFile) << selEventsFiles_workers[idxWorker].str();
+    analyzedEntries += analyzedEntries_workers[idxWorker];
+    selectedEntries += selectedEntries_workers[idxWorker];
+    selectedEntries_weighted += selectedEntries_weighted_workers[idxWorker];
+    if ( idxWorker > 0 ) {
+      cutFlow_workers[0].merge(cutFlow_workers[idxWorker]);
+      histManagers_workers[0]->merge(*histManagers_workers[idxWorker]);
+    }
+  }
+
+//--- add the events accumulated by the HistManagers to the booked histograms
+//    (the histograms of all threads have been merged into those of the first thread before)
+  HistManagerBase::flushAll();
+
+  std::cout << "num. Entries = " << entryRange.size() << std::endl;
   std::cout << " analyzed = " << analyzedEntries << std::endl;
   std::cout << " selected = " << selectedEntries << " (weighted = " << selectedEntries_weighted << ")" << std::endl;
 
-  delete run_lumi_eventSelector;
+  const CutFlowTable& cutFlow = cutFlow_workers[0];
+  cutFlow.print(std::cout);
+  if ( cutFlowFileName != "" ) {
+    std::ofstream cutFlowFile(cutFlowFileName.data(), std::ios::out);
+    CutFlowTable::writeHeader(cutFlowFile);
+    cutFlow.write(cutFlowFile);
+  }
 
   delete selEventsFile;
 
-  delete muonReader;
-  delete electronReader;
-  delete hadTauReader;
-  delete jetReader;
-  delete genLeptonReader;
-  delete genHadTauReader;
-  delete genJetReader;
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    delete histManagers_workers[idxWorker];
+    // CV: remove copies of histograms filled by threads other than the first from the output file
+    if ( idxWorker > 0 ) fs.getBareDirectory()->rmdir(Form("shard%i", idxWorker));
+  }
 
-  hltPaths_delete(triggers_1e);
-  hltPaths_delete(triggers_2e);
-  hltPaths_delete(triggers_1mu);
-  hltPaths_delete(triggers_2mu);
-  hltPaths_delete(triggers_1e1mu);
+  delete inputTree;
+  delete inputCache;
 
   clock.Show("analyze_2los_1tau");
 
   return EXIT_SUCCESS;
 }
-
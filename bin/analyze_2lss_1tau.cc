@@ -14,6 +14,7 @@
 #include <TTree.h> // TTree
 #include <TBenchmark.h> // TBenchmark
 #include <TString.h> // TString, Form
+#include <TROOT.h> // ROOT::EnableThreadSafety
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoLepton.h" // RecoLepton
 #include "tthAnalysis/HiggsToTauTau/interface/RecoJet.h" // RecoJet
@@ -21,8 +22,10 @@
 #include "tthAnalysis/HiggsToTauTau/interface/GenLepton.h" // GenLepton
 #include "tthAnalysis/HiggsToTauTau/interface/GenJet.h" // GenJet
 #include "tthAnalysis/HiggsToTauTau/interface/GenHadTau.h" // GenHadTau
+#include "tthAnalysis/HiggsToTauTau/interface/deltaRKernels.h" // comp_deltaR2
 #include "tthAnalysis/HiggsToTauTau/interface/TMVAInterface.h" // TMVAInterface
 #include "tthAnalysis/HiggsToTauTau/interface/mvaInputVariables.h" // auxiliary functions for computing input variables of the MVA used for signal extraction in the 2lss_1tau category 
+#include "tthAnalysis/HiggsToTauTau/interface/MVAOutputCache.h" // MVAOutputCache, getMVAOutputCacheTag
 #include "tthAnalysis/HiggsToTauTau/interface/KeyTypes.h"
 #include "tthAnalysis/HiggsToTauTau/interface/RecoElectronReader.h" // RecoElectronReader
 #include "tthAnalysis/HiggsToTauTau/interface/RecoMuonReader.h" // RecoMuonReader
@@ -31,10 +34,19 @@
 #include "tthAnalysis/HiggsToTauTau/interface/GenLeptonReader.h" // GenLeptonReader
 #include "tthAnalysis/HiggsToTauTau/interface/GenHadTauReader.h" // GenHadTauReader
 #include "tthAnalysis/HiggsToTauTau/interface/GenJetReader.h" // GenJetReader
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource
+#include "tthAnalysis/HiggsToTauTau/interface/ColumnarCache.h" // ColumnarCacheReader
+#include "tthAnalysis/HiggsToTauTau/interface/EntryRange.h" // EntryRange, getClusterBoundaries, splitEntryRange
+#include "tthAnalysis/HiggsToTauTau/interface/StagedEntryLoader.h" // StagedEntryLoader
+#include "tthAnalysis/HiggsToTauTau/interface/SkimWriter.h" // SkimWriter
+#include "tthAnalysis/HiggsToTauTau/interface/CutFlowTable.h" // CutFlowTable
+#include "tthAnalysis/HiggsToTauTau/interface/categories_2lss_1tau.h" // getCategory_2lss_1tau, getCategoryName_2lss_1tau, getCharge_2lss_1tau, kNumCategories_2lss_1tau
 #include "tthAnalysis/HiggsToTauTau/interface/convert_to_ptrs.h" // convert_to_ptrs
 #include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionCleaner.h" // RecoElectronCollectionCleaner, RecoMuonCollectionCleaner, RecoHadTauCollectionCleaner, RecoJetCollectionCleaner
-#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionGenMatcher.h" // RecoElectronCollectionGenMatcher, RecoMuonCollectionGenMatcher, RecoHadTauCollectionGenMatcher, RecoJetCollectionGenMatcher
+#include "tthAnalysis/HiggsToTauTau/interface/GenMatchTable.h" // GenMatchTable
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionView.h" // RecoMuonCollectionView, RecoElectronCollectionView, RecoHadTauCollectionView
 #include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionSelector.h" // RecoElectronSelectorLoose, RecoElectronSelectorTight, RecoMuonSelectorLoose, RecoMuonSelectorTight, RecoHadTauSelectorTight
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionMultiSelector.h" // RecoMuonCollectionMultiSelector, RecoElectronCollectionMultiSelector, RecoHadTauCollectionMultiSelector
 #include "tthAnalysis/HiggsToTauTau/interface/RunLumiEventSelector.h" // RunLumiEventSelector
 #include "tthAnalysis/HiggsToTauTau/interface/ElectronHistManager.h" // ElectronHistManager
 #include "tthAnalysis/HiggsToTauTau/interface/MuonHistManager.h" // MuonHistManager
@@ -44,12 +56,10 @@
 #include "tthAnalysis/HiggsToTauTau/interface/EvtHistManager_2lss_1tau.h" // EvtHistManager_2lss_1tau
 #include "tthAnalysis/HiggsToTauTau/interface/leptonTypes.h" // getLeptonType, kElectron, kMuon
 #include "tthAnalysis/HiggsToTauTau/interface/backgroundEstimation.h" // prob_chargeMisId
-#include "tthAnalysis/HiggsToTauTau/interface/hltPath.h" // hltPath, create_hltPaths, hltPaths_setBranchAddresses, hltPaths_isTriggered, hltPaths_delete
+#include "tthAnalysis/HiggsToTauTau/interface/hltPath.h" // hltPath, create_hltPaths, hltPaths_setBranchAddresses, hltPaths_branchNames, hltPaths_isTriggered, hltPaths_delete
 #include "tthAnalysis/HiggsToTauTau/interface/data_to_MC_corrections.h"
 #include "tthAnalysis/HiggsToTauTau/interface/lutAuxFunctions.h" // loadTH2, get_sf_from_TH2
-
-#include <boost/range/algorithm/copy.hpp> // boost::copy()
-#include <boost/range/adaptor/map.hpp> // boost::adaptors::map_keys
+#include "tthAnalysis/HiggsToTauTau/interface/allocationCounter.h" // getNumAllocations, isAllocationCountingEnabled
 
 #include <iostream> // std::cerr, std::fixed
 #include <iomanip> // std::setprecision(), std::setw()
@@ -58,6 +68,10 @@
 #include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
 #include <algorithm> // std::sort
 #include <fstream> // std::ofstream
+#include <sstream> // std::ostringstream
+#include <thread> // std::thread
+#include <mutex> // std::mutex, std::unique_lock, std::lock_guard
+#include <exception> // std::exception_ptr, std::current_exception, std::rethrow_exception
 #include <assert.h> // assert
 
 #define EPS 1E-2
@@ -65,13 +79,19 @@
 typedef math::PtEtaPhiMLorentzVector LV;
 typedef std::vector<std::string> vstring;
 
+enum { kMVAOutput_2lss_ttV, kMVAOutput_2lss_ttbar, kNumMVAOutputs_2lss };
+
 //--- declare constants
 const double z_mass   = 91.1876;
 const double z_window = 10.;
 const double met_coef =  0.00397;
 const double mht_coef =  0.00265;
 
-enum { k2epp_btight, k2epp_bloose, k2emm_btight, k2emm_bloose, k1e1mupp_btight, k1e1mupp_bloose, k1e1mumm_btight, k1e1mumm_bloose, k2mupp_btight, k2mupp_bloose, k2mumm_btight, k2mumm_bloose };
+const std::map<std::string, GENHIGGSDECAYMODE_TYPE> decayMode_idString = {
+  { "ttH_hww", static_cast<GENHIGGSDECAYMODE_TYPE>(24) },
+  { "ttH_hzz", static_cast<GENHIGGSDECAYMODE_TYPE>(23) },
+  { "ttH_htt", static_cast<GENHIGGSDECAYMODE_TYPE>(15) }
+};
 
 /**
  * @brief Auxiliary function used for sorting leptons by decreasing pT
@@ -91,12 +111,296 @@ bool isMatched(const Tfakeable& fakeableLepton, const std::vector<Ttight*>& tigh
 {
   for ( typename std::vector<const Ttight*>::const_iterator tightLepton = tightLeptons.begin();
         tightLepton != tightLeptons.end(); ++tightLepton ) {
-    double dR = deltaR(fakeableLepton.eta_, fakeableLepton.phi_, (*tightLepton)->eta_, (*tightLepton)->phi_);
-    if ( dR < dRmax ) return true; // found match
+    double dR2 = comp_deltaR2(fakeableLepton.eta_, fakeableLepton.phi_, (*tightLepton)->eta_, (*tightLepton)->phi_);
+    if ( dR2 < dRmax*dRmax ) return true; // found match
   }
   return false; // no match found
 }
+
+/**
+ * @brief Auxiliary function to determine jet pT shift and name of b-tagging weight branch for given central_or_shift value
+ */
+void get_jetShift(const std::string& central_or_shift, bool isMC, int& jetPt_option, std::string& jet_btagWeight_branch)
+{
+  jetPt_option = RecoJetReader::kJetPt_central;
+  jet_btagWeight_branch = ( isMC ) ? "Jet_bTagWeight" : "";
+  if ( isMC && central_or_shift != "central" ) {
+    TString central_or_shift_tstring = central_or_shift.data();
+    std::string shiftUp_or_Down = "";
+    if      ( central_or_shift_tstring.EndsWith("Up")   ) shiftUp_or_Down = "Up";
+    else if ( central_or_shift_tstring.EndsWith("Down") ) shiftUp_or_Down = "Down";
+    else throw cms::Exception("analyze_2lss_1tau")
+      << "Invalid Configuration parameter 'central_or_shift' = " << central_or_shift << " !!\n";
+    if      ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_HF")       ) jet_btagWeight_branch = "Jet_bTagWeight_HF" + shiftUp_or_Down;
+    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_HFStats1") ) jet_btagWeight_branch = "Jet_bTagWeight_HFStats1" + shiftUp_or_Down;
+    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_HFStats2") ) jet_btagWeight_branch = "Jet_bTagWeight_HFStats2" + shiftUp_or_Down;
+    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_LF")       ) jet_btagWeight_branch = "Jet_bTagWeight_LF" + shiftUp_or_Down;
+    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_LFStats1") ) jet_btagWeight_branch = "Jet_bTagWeight_LFStats1" + shiftUp_or_Down;
+    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_LFStats2") ) jet_btagWeight_branch = "Jet_bTagWeight_LFStats2" + shiftUp_or_Down;
+    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_cErr1")    ) jet_btagWeight_branch = "Jet_bTagWeight_cErr1" + shiftUp_or_Down;
+    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_cErr2")    ) jet_btagWeight_branch = "Jet_bTagWeight_cErr2" + shiftUp_or_Down;
+    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_JES") ) {
+      jet_btagWeight_branch = "Jet_bTagWeight_JES" + shiftUp_or_Down;
+      if      ( shiftUp_or_Down == "Up"   ) jetPt_option = RecoJetReader::kJetPt_jecUp;
+      else if ( shiftUp_or_Down == "Down" ) jetPt_option = RecoJetReader::kJetPt_jecDown;
+      else assert(0);
+    } else throw cms::Exception("analyze_2lss_1tau")
+	<< "Invalid Configuration parameter 'central_or_shift' = " << central_or_shift << " !!\n";
+  }
+}
+
+/**
+ * @brief Histograms booked and filled for one event category
+ */
+struct categoryHistManagers_2lss_1tau
+{
+  categoryHistManagers_2lss_1tau()
+    : selEvtHistManager_(0)
+  {}
+  std::vector<ElectronHistManager*> selElectronHistManagers_; // "leadElectron" and "subleadElectron" in 2e categories, "electron" in 1e1mu categories
+  std::vector<MuonHistManager*> selMuonHistManagers_;         // "muon" in 1e1mu categories, "leadMuon" and "subleadMuon" in 2mu categories
+  EvtHistManager_2lss_1tau* selEvtHistManager_;
+};
+
+/**
+ * @brief Collection of all histograms booked and filled for a group of central_or_shift values 
+ *        that differ in the event weight only
+ */
+struct histManagers_2lss_1tau
+{
+  histManagers_2lss_1tau(TFileDirectory& dir, const std::string& process_string, const std::string& charge_and_leptonSelection, const vstring& central_or_shifts);
+  ~histManagers_2lss_1tau();
+
+  /**
+   * @brief Book histograms of given HistManager for all central_or_shift values in the group
+   */
+  void bookHistograms(HistManagerBase& histManager, TFileDirectory& dir);
+
+  /**
+   * @brief Add histograms filled by another thread
+   */
+  void merge(const histManagers_2lss_1tau& shard);
+
+  vstring central_or_shifts_;
+  std::vector<double> btagWeights_; // b-tagging weight of the event for each central_or_shift value
+
+  ElectronHistManager preselElectronHistManager_;
+  MuonHistManager preselMuonHistManager_;
+  HadTauHistManager preselHadTauHistManager_;
+  JetHistManager preselJetHistManager_;
+  JetHistManager preselBJet_looseHistManager_;
+  JetHistManager preselBJet_mediumHistManager_;
+  MEtHistManager preselMEtHistManager_;
+  EvtHistManager_2lss_1tau preselEvtHistManager_;
+
+  ElectronHistManager selElectronHistManager_;
+  MuonHistManager selMuonHistManager_;
+  HadTauHistManager selHadTauHistManager_;
+  JetHistManager selJetHistManager_;
+  JetHistManager selJetHistManager_lead_;
+  JetHistManager selJetHistManager_sublead_;
+  JetHistManager selBJet_looseHistManager_;
+  JetHistManager selBJet_looseHistManager_lead_;
+  JetHistManager selBJet_looseHistManager_sublead_;
+  JetHistManager selBJet_mediumHistManager_;
+  MEtHistManager selMEtHistManager_;
+  EvtHistManager_2lss_1tau selEvtHistManager_;
+  std::map<std::string, EvtHistManager_2lss_1tau*> selEvtHistManager_decayMode_; // key = decay mode
+  categoryHistManagers_2lss_1tau selHistManagers_category_[kNumCategories_2lss_1tau]; // index = category
+};
+
+histManagers_2lss_1tau::histManagers_2lss_1tau(TFileDirectory& dir, const std::string& process_string, const std::string& charge_and_leptonSelection, const vstring& central_or_shifts)
+  : central_or_shifts_(central_or_shifts)
+  , btagWeights_(central_or_shifts.size(), 1.)
+  , preselElectronHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/presel/electrons", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , preselMuonHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/presel/muons", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , preselHadTauHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/presel/hadTaus", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , preselJetHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/presel/jets", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , preselBJet_looseHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/presel/BJets_loose", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , preselBJet_mediumHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/presel/BJets_medium", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , preselMEtHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/presel/met", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , preselEvtHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/presel/evt", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , selElectronHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/sel/electrons", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , selMuonHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/sel/muons", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , selHadTauHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/sel/hadTaus", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , selJetHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/sel/jets", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , selJetHistManager_lead_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/sel/leadJet", charge_and_leptonSelection.data()), central_or_shifts.front(), 0))
+  , selJetHistManager_sublead_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/sel/subleadJet", charge_and_leptonSelection.data()), central_or_shifts.front(), 1))
+  , selBJet_looseHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/sel/BJets_loose", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , selBJet_looseHistManager_lead_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/sel/leadBJet_loose", charge_and_leptonSelection.data()), central_or_shifts.front(), 0))
+  , selBJet_looseHistManager_sublead_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/sel/subleadBJet_loose", charge_and_leptonSelection.data()), central_or_shifts.front(), 1))
+  , selBJet_mediumHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/sel/BJets_medium", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , selMEtHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/sel/met", charge_and_leptonSelection.data()), central_or_shifts.front()))
+  , selEvtHistManager_(makeHistManager_cfg(process_string, 
+      Form("2lss_1tau_%s/sel/evt", charge_and_leptonSelection.data()), central_or_shifts.front()))
+{
+  bookHistograms(preselElectronHistManager_, dir);
+  bookHistograms(preselMuonHistManager_, dir);
+  bookHistograms(preselHadTauHistManager_, dir);
+  bookHistograms(preselJetHistManager_, dir);
+  bookHistograms(preselBJet_looseHistManager_, dir);
+  bookHistograms(preselBJet_mediumHistManager_, dir);
+  bookHistograms(preselMEtHistManager_, dir);
+  bookHistograms(preselEvtHistManager_, dir);
+
+  bookHistograms(selElectronHistManager_, dir);
+  for ( int category = 0; category < kNumCategories_2lss_1tau; ++category ) {
+    const char* categoryName = getCategoryName_2lss_1tau(category);
+    std::vector<ElectronHistManager*>& selElectronHistManagers = selHistManagers_category_[category].selElectronHistManagers_;
+    if ( getNumElectrons_2lss_1tau(category) == 2 ) {
+      ElectronHistManager* selElectronHistManager_lead = new ElectronHistManager(makeHistManager_cfg(process_string, 
+	Form("%s_%s/sel/leadElectron", categoryName, charge_and_leptonSelection.data()), central_or_shifts.front(), 0));
+      bookHistograms(*selElectronHistManager_lead, dir);
+      selElectronHistManagers.push_back(selElectronHistManager_lead);
+      ElectronHistManager* selElectronHistManager_sublead = new ElectronHistManager(makeHistManager_cfg(process_string, 
+	Form("%s_%s/sel/subleadElectron", categoryName, charge_and_leptonSelection.data()), central_or_shifts.front(), 1));
+      bookHistograms(*selElectronHistManager_sublead, dir);
+      selElectronHistManagers.push_back(selElectronHistManager_sublead);
+    } else if ( getNumElectrons_2lss_1tau(category) == 1 ) {
+      ElectronHistManager* selElectronHistManager = new ElectronHistManager(makeHistManager_cfg(process_string, 
+	Form("%s_%s/sel/electron", categoryName, charge_and_leptonSelection.data()), central_or_shifts.front()));
+      bookHistograms(*selElectronHistManager, dir);
+      selElectronHistManagers.push_back(selElectronHistManager);
+    }
+  }
+
+  bookHistograms(selMuonHistManager_, dir);
+  for ( int category = 0; category < kNumCategories_2lss_1tau; ++category ) {
+    const char* categoryName = getCategoryName_2lss_1tau(category);
+    std::vector<MuonHistManager*>& selMuonHistManagers = selHistManagers_category_[category].selMuonHistManagers_;
+    if ( getNumMuons_2lss_1tau(category) == 1 ) {
+      MuonHistManager* selMuonHistManager = new MuonHistManager(makeHistManager_cfg(process_string, 
+	Form("%s_%s/sel/muon", categoryName, charge_and_leptonSelection.data()), central_or_shifts.front()));
+      bookHistograms(*selMuonHistManager, dir);
+      selMuonHistManagers.push_back(selMuonHistManager);
+    } else if ( getNumMuons_2lss_1tau(category) == 2 ) {
+      MuonHistManager* selMuonHistManager_lead = new MuonHistManager(makeHistManager_cfg(process_string, 
+	Form("%s_%s/sel/leadMuon", categoryName, charge_and_leptonSelection.data()), central_or_shifts.front(), 0));
+      bookHistograms(*selMuonHistManager_lead, dir);
+      selMuonHistManagers.push_back(selMuonHistManager_lead);
+      MuonHistManager* selMuonHistManager_sublead = new MuonHistManager(makeHistManager_cfg(process_string, 
+	Form("%s_%s/sel/subleadMuon", categoryName, charge_and_leptonSelection.data()), central_or_shifts.front(), 1));
+      bookHistograms(*selMuonHistManager_sublead, dir);
+      selMuonHistManagers.push_back(selMuonHistManager_sublead);
+    }
+  }
+
+  bookHistograms(selHadTauHistManager_, dir);
+
+  bookHistograms(selJetHistManager_, dir);
+  bookHistograms(selJetHistManager_lead_, dir);
+  bookHistograms(selJetHistManager_sublead_, dir);
+
+  bookHistograms(selBJet_looseHistManager_, dir);
+  bookHistograms(selBJet_looseHistManager_lead_, dir);
+  bookHistograms(selBJet_looseHistManager_sublead_, dir);
+  bookHistograms(selBJet_mediumHistManager_, dir);
+
+  bookHistograms(selMEtHistManager_, dir);
+
+  bookHistograms(selEvtHistManager_, dir);
+  if ( process_string != "data_obs" ) {
+    for ( std::map<std::string, GENHIGGSDECAYMODE_TYPE>::const_iterator decayMode = decayMode_idString.begin();
+	  decayMode != decayMode_idString.end(); ++decayMode ) {
+      EvtHistManager_2lss_1tau* selEvtHistManager_ptr = new EvtHistManager_2lss_1tau(makeHistManager_cfg(decayMode->first,
+        Form("2lss_1tau_%s/sel/evt", charge_and_leptonSelection.data()), central_or_shifts.front()));
+      bookHistograms(*selEvtHistManager_ptr, dir);
+      selEvtHistManager_decayMode_[decayMode->first] = selEvtHistManager_ptr;
+    }
+  }
+  for ( int category = 0; category < kNumCategories_2lss_1tau; ++category ) {
+    EvtHistManager_2lss_1tau* selEvtHistManager_ptr = new EvtHistManager_2lss_1tau(makeHistManager_cfg(process_string,
+      Form("%s_%s/sel/evt", getCategoryName_2lss_1tau(category), charge_and_leptonSelection.data()), central_or_shifts.front()));
+    bookHistograms(*selEvtHistManager_ptr, dir);
+    selHistManagers_category_[category].selEvtHistManager_ = selEvtHistManager_ptr;
+  }
+}
+
+void histManagers_2lss_1tau::bookHistograms(HistManagerBase& histManager, TFileDirectory& dir)
+{
+  histManager.setWeightShifts(central_or_shifts_, btagWeights_.data());
+  histManager.bookHistograms(dir);
+}
+
+histManagers_2lss_1tau::~histManagers_2lss_1tau()
+{
+  for ( std::map<std::string, EvtHistManager_2lss_1tau*>::iterator histManager = selEvtHistManager_decayMode_.begin();
+	histManager != selEvtHistManager_decayMode_.end(); ++histManager ) {
+    delete histManager->second;
+  }
+  for ( int category = 0; category < kNumCategories_2lss_1tau; ++category ) {
+    categoryHistManagers_2lss_1tau& histManagers_category = selHistManagers_category_[category];
+    for ( std::vector<ElectronHistManager*>::iterator histManager = histManagers_category.selElectronHistManagers_.begin();
+	  histManager != histManagers_category.selElectronHistManagers_.end(); ++histManager ) {
+      delete (*histManager);
+    }
+    for ( std::vector<MuonHistManager*>::iterator histManager = histManagers_category.selMuonHistManagers_.begin();
+	  histManager != histManagers_category.selMuonHistManagers_.end(); ++histManager ) {
+      delete (*histManager);
+    }
+    delete histManagers_category.selEvtHistManager_;
+  }
+}
  
+void histManagers_2lss_1tau::merge(const histManagers_2lss_1tau& shard)
+{
+  preselElectronHistManager_.merge(shard.preselElectronHistManager_);
+  preselMuonHistManager_.merge(shard.preselMuonHistManager_);
+  preselHadTauHistManager_.merge(shard.preselHadTauHistManager_);
+  preselJetHistManager_.merge(shard.preselJetHistManager_);
+  preselBJet_looseHistManager_.merge(shard.preselBJet_looseHistManager_);
+  preselBJet_mediumHistManager_.merge(shard.preselBJet_mediumHistManager_);
+  preselMEtHistManager_.merge(shard.preselMEtHistManager_);
+  preselEvtHistManager_.merge(shard.preselEvtHistManager_);
+
+  selElectronHistManager_.merge(shard.selElectronHistManager_);
+  selMuonHistManager_.merge(shard.selMuonHistManager_);
+  selHadTauHistManager_.merge(shard.selHadTauHistManager_);
+  selJetHistManager_.merge(shard.selJetHistManager_);
+  selJetHistManager_lead_.merge(shard.selJetHistManager_lead_);
+  selJetHistManager_sublead_.merge(shard.selJetHistManager_sublead_);
+  selBJet_looseHistManager_.merge(shard.selBJet_looseHistManager_);
+  selBJet_looseHistManager_lead_.merge(shard.selBJet_looseHistManager_lead_);
+  selBJet_looseHistManager_sublead_.merge(shard.selBJet_looseHistManager_sublead_);
+  selBJet_mediumHistManager_.merge(shard.selBJet_mediumHistManager_);
+  selMEtHistManager_.merge(shard.selMEtHistManager_);
+  selEvtHistManager_.merge(shard.selEvtHistManager_);
+  for ( std::map<std::string, EvtHistManager_2lss_1tau*>::iterator histManager = selEvtHistManager_decayMode_.begin();
+	histManager != selEvtHistManager_decayMode_.end(); ++histManager ) {
+    histManager->second->merge(*shard.selEvtHistManager_decayMode_.at(histManager->first));
+  }
+  for ( int category = 0; category < kNumCategories_2lss_1tau; ++category ) {
+    categoryHistManagers_2lss_1tau& histManagers_category = selHistManagers_category_[category];
+    const categoryHistManagers_2lss_1tau& histManagers_category_shard = shard.selHistManagers_category_[category];
+    for ( size_t idxHistManager = 0; idxHistManager < histManagers_category.selElectronHistManagers_.size(); ++idxHistManager ) {
+      histManagers_category.selElectronHistManagers_[idxHistManager]->merge(*histManagers_category_shard.selElectronHistManagers_[idxHistManager]);
+    }
+    for ( size_t idxHistManager = 0; idxHistManager < histManagers_category.selMuonHistManagers_.size(); ++idxHistManager ) {
+      histManagers_category.selMuonHistManagers_[idxHistManager]->merge(*histManagers_category_shard.selMuonHistManagers_[idxHistManager]);
+    }
+    histManagers_category.selEvtHistManager_->merge(*histManagers_category_shard.selEvtHistManager_);
+  }
+}
+
 /**
  * @brief Produce datacard and control plots for 2lss_1tau categories.
  */
@@ -128,19 +432,14 @@ int main(int argc, char* argv[])
   std::string process_string = cfg_analyze.getParameter<std::string>("process");
 
   vstring triggerNames_1e = cfg_analyze.getParameter<vstring>("triggers_1e");
-  std::vector<hltPath*> triggers_1e = create_hltPaths(triggerNames_1e);
   bool use_triggers_1e = cfg_analyze.getParameter<bool>("use_triggers_1e");
   vstring triggerNames_2e = cfg_analyze.getParameter<vstring>("triggers_2e");
-  std::vector<hltPath*> triggers_2e = create_hltPaths(triggerNames_2e);
   bool use_triggers_2e = cfg_analyze.getParameter<bool>("use_triggers_2e");
   vstring triggerNames_1mu = cfg_analyze.getParameter<vstring>("triggers_1mu");
-  std::vector<hltPath*> triggers_1mu = create_hltPaths(triggerNames_1mu);
   bool use_triggers_1mu = cfg_analyze.getParameter<bool>("use_triggers_1mu");
   vstring triggerNames_2mu = cfg_analyze.getParameter<vstring>("triggers_2mu");
-  std::vector<hltPath*> triggers_2mu = create_hltPaths(triggerNames_2mu);
   bool use_triggers_2mu = cfg_analyze.getParameter<bool>("use_triggers_2mu");
   vstring triggerNames_1e1mu = cfg_analyze.getParameter<vstring>("triggers_1e1mu");
-  std::vector<hltPath*> triggers_1e1mu = create_hltPaths(triggerNames_1e1mu);
   bool use_triggers_1e1mu = cfg_analyze.getParameter<bool>("use_triggers_1e1mu");
 
   enum { kOS, kSS };
@@ -175,45 +474,58 @@ int main(int argc, char* argv[])
   std::string central_or_shift = cfg_analyze.getParameter<std::string>("central_or_shift");
   double lumiScale = ( process_string != "data_obs" ) ? cfg_analyze.getParameter<double>("lumiScale") : 1.;
 
-  std::string jet_btagWeight_branch = ( isMC ) ? "Jet_bTagWeight" : "";
+//--- process the events in numThreads threads (optional)
+  int numThreads = ( cfg_analyze.exists("numThreads") ) ? cfg_analyze.getParameter<int>("numThreads") : 1;
+  if ( numThreads < 1 )
+    throw cms::Exception("analyze_2lss_1tau") 
+      << "Invalid Configuration parameter 'numThreads' = " << numThreads << " !!\n";
+  if ( numThreads > 1 ) ROOT::EnableThreadSafety();
+
+//--- process all systematic shifts given in 'central_or_shifts' in a single pass over the input tree;
+//    if 'central_or_shifts' is empty, only the shift given by 'central_or_shift' is processed
+  vstring central_or_shifts;
+  if ( cfg_analyze.exists("central_or_shifts") ) central_or_shifts = cfg_analyze.getParameter<vstring>("central_or_shifts");
+  if ( central_or_shifts.empty() ) central_or_shifts.push_back(central_or_shift);
+  size_t numShifts = central_or_shifts.size();
+  std::vector<int> jetPt_options(numShifts);
+  vstring jet_btagWeight_branches(numShifts);
+  for ( size_t idxShift = 0; idxShift < numShifts; ++idxShift ) {
+    get_jetShift(central_or_shifts[idxShift], isMC, jetPt_options[idxShift], jet_btagWeight_branches[idxShift]);
+  }
 
-  int jetPt_option = RecoJetReader::kJetPt_central;
-  if ( isMC && central_or_shift != "central" ) {
-    TString central_or_shift_tstring = central_or_shift.data();
-    std::string shiftUp_or_Down = "";
-    if      ( central_or_shift_tstring.EndsWith("Up")   ) shiftUp_or_Down = "Up";
-    else if ( central_or_shift_tstring.EndsWith("Down") ) shiftUp_or_Down = "Down";
-    else throw cms::Exception("analyze_2lss_1tau")
-      << "Invalid Configuration parameter 'central_or_shift' = " << central_or_shift << " !!\n";
-    if      ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_HF")       ) jet_btagWeight_branch = "Jet_bTagWeight_HF" + shiftUp_or_Down;
-    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_HFStats1") ) jet_btagWeight_branch = "Jet_bTagWeight_HFStats1" + shiftUp_or_Down;
-    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_HFStats2") ) jet_btagWeight_branch = "Jet_bTagWeight_HFStats2" + shiftUp_or_Down;
-    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_LF")       ) jet_btagWeight_branch = "Jet_bTagWeight_LF" + shiftUp_or_Down;
-    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_LFStats1") ) jet_btagWeight_branch = "Jet_bTagWeight_LFStats1" + shiftUp_or_Down;
-    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_LFStats2") ) jet_btagWeight_branch = "Jet_bTagWeight_LFStats2" + shiftUp_or_Down;
-    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_cErr1")    ) jet_btagWeight_branch = "Jet_bTagWeight_cErr1" + shiftUp_or_Down;
-    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_btag_cErr2")    ) jet_btagWeight_branch = "Jet_bTagWeight_cErr2" + shiftUp_or_Down;
-    else if ( central_or_shift_tstring.BeginsWith("CMS_ttHl_JES") ) {
-      jet_btagWeight_branch = "Jet_bTagWeight_JES" + shiftUp_or_Down;
-      if      ( shiftUp_or_Down == "Up"   ) jetPt_option = RecoJetReader::kJetPt_jecUp;
-      else if ( shiftUp_or_Down == "Down" ) jetPt_option = RecoJetReader::kJetPt_jecDown;
-      else assert(0);
-    } else throw cms::Exception("analyze_2lss_1tau")
-	<< "Invalid Configuration parameter 'central_or_shift' = " << central_or_shift << " !!\n";
+//--- group systematic shifts that differ in the b-tagging weights only:
+//    the event selection is applied once per group and the histograms for all shifts in the group are filled in one pass,
+//    multiplying the event weight without b-tagging weights by the (absolute) b-tagging weight computed for each shift
+  std::vector<std::vector<size_t>> shiftGroups; // indices in central_or_shifts of the shifts in each group
+  for ( size_t idxShift = 0; idxShift < numShifts; ++idxShift ) {
+    bool isGrouped = false;
+    for ( std::vector<std::vector<size_t>>::iterator shiftGroup = shiftGroups.begin();
+	  shiftGroup != shiftGroups.end(); ++shiftGroup ) {
+      if ( jetPt_options[shiftGroup->front()] == jetPt_options[idxShift] ) {
+	shiftGroup->push_back(idxShift);
+	isGrouped = true;
+	break;
+      }
+    }
+    if ( !isGrouped ) shiftGroups.push_back(std::vector<size_t>(1, idxShift));
   }
+  size_t numShiftGroups = shiftGroups.size();
 
   std::string selEventsFileName_input = cfg_analyze.getParameter<std::string>("selEventsFileName_input");
   std::cout << "selEventsFileName_input = " << selEventsFileName_input << std::endl;
-  RunLumiEventSelector* run_lumi_eventSelector = 0;
-  if ( selEventsFileName_input != "" ) {
-    edm::ParameterSet cfgRunLumiEventSelector;
-    cfgRunLumiEventSelector.addParameter<std::string>("inputFileName", selEventsFileName_input);
-    cfgRunLumiEventSelector.addParameter<std::string>("separator", ":");
-    run_lumi_eventSelector = new RunLumiEventSelector(cfgRunLumiEventSelector);
-  }
 
   std::string selEventsFileName_output = cfg_analyze.getParameter<std::string>("selEventsFileName_output");
 
+  std::string cutFlowFileName = ( cfg_analyze.exists("cutFlowFileName") ) ? cfg_analyze.getParameter<std::string>("cutFlowFileName") : "";
+
+  std::string mvaOutputCacheFileName_input = "";
+  std::string mvaOutputCacheFileName_output = "";
+  if ( cfg_analyze.exists("mvaOutputCache") ) {
+    edm::ParameterSet cfg_mvaOutputCache = cfg_analyze.getParameter<edm::ParameterSet>("mvaOutputCache");
+    mvaOutputCacheFileName_input = cfg_mvaOutputCache.getParameter<std::string>("inputFileName");
+    mvaOutputCacheFileName_output = cfg_mvaOutputCache.getParameter<std::string>("outputFileName");
+  }
+
   fwlite::InputSource inputFiles(cfg); 
   int maxEvents = inputFiles.maxEvents();
   std::cout << " maxEvents = " << maxEvents << std::endl;
@@ -222,709 +534,905 @@ int main(int argc, char* argv[])
   fwlite::OutputFiles outputFile(cfg);
   fwlite::TFileService fs = fwlite::TFileService(outputFile.file().data());
 
-  TChain* inputTree = new TChain(treeName.data());
-  for ( std::vector<std::string>::const_iterator inputFileName = inputFiles.files().begin();
-	inputFileName != inputFiles.files().end(); ++inputFileName ) {
-    std::cout << "input Tree: adding file = " << (*inputFileName) << std::endl;
-    inputTree->AddFile(inputFileName->data());
-  }
+  edm::ParameterSet cfg_input = cfg.getParameter<edm::ParameterSet>("fwliteInput");
+  std::string inputFormat = "ROOT";
+  if ( cfg_input.exists("inputFormat") ) inputFormat = cfg_input.getParameter<std::string>("inputFormat");
+
+  TChain* inputTree = 0;
+  ColumnarCacheReader* inputCache = 0;
+  if ( inputFormat == "ROOT" ) {
+    inputTree = new TChain(treeName.data());
+    for ( std::vector<std::string>::const_iterator inputFileName = inputFiles.files().begin();
+	  inputFileName != inputFiles.files().end(); ++inputFileName ) {
+      std::cout << "input Tree: adding file = " << (*inputFileName) << std::endl;
+      inputTree->AddFile(inputFileName->data());
+    }
+  
+    if ( !(inputTree->GetListOfFiles()->GetEntries() >= 1) ) {
+      throw cms::Exception("analyze_2lss_1tau") 
+        << "Failed to identify input Tree !!\n";
+    }
   
-  if ( !(inputTree->GetListOfFiles()->GetEntries() >= 1) ) {
+    // CV: need to call TChain::LoadTree before processing first event 
+    //     in order to prevent ROOT causing a segmentation violation,
+    //     cf. http://root.cern.ch/phpBB3/viewtopic.php?t=10062
+    inputTree->LoadTree(0);
+
+    std::cout << "input Tree contains " << inputTree->GetEntries() << " Entries in " << inputTree->GetListOfFiles()->GetEntries() << " files." << std::endl;
+  } else if ( inputFormat == "columnarCache" ) {
+    inputCache = new ColumnarCacheReader(inputFiles.files());
+    std::cout << "input columnar cache contains " << inputCache->getEntries() << " Entries in " << inputFiles.files().size() << " files." << std::endl;
+  } else {
     throw cms::Exception("analyze_2lss_1tau") 
-      << "Failed to identify input Tree !!\n";
+      << "Invalid Configuration parameter 'inputFormat' = " << inputFormat << " !!\n";
   }
-  
-  // CV: need to call TChain::LoadTree before processing first event 
-  //     in order to prevent ROOT causing a segmentation violation,
-  //     cf. http://root.cern.ch/phpBB3/viewtopic.php?t=10062
-  inputTree->LoadTree(0);
 
-  std::cout << "input Tree contains " << inputTree->GetEntries() << " Entries in " << inputTree->GetListOfFiles()->GetEntries() << " files." << std::endl;
-
-//--- declare event-level variables
-  RUN_TYPE run;
-  inputTree->SetBranchAddress(RUN_KEY, &run);
-  LUMI_TYPE lumi;
-  inputTree->SetBranchAddress(LUMI_KEY, &lumi);
-  EVT_TYPE event;
-  inputTree->SetBranchAddress(EVT_KEY, &event);
-  GENHIGGSDECAYMODE_TYPE genHiggsDecayMode;
-  if(process_string != "data_obs")
-    inputTree->SetBranchAddress(GENHIGGSDECAYMODE_KEY, &genHiggsDecayMode);
-
-  hltPaths_setBranchAddresses(inputTree, triggers_1e);
-  hltPaths_setBranchAddresses(inputTree, triggers_2e);
-  hltPaths_setBranchAddresses(inputTree, triggers_1mu);
-  hltPaths_setBranchAddresses(inputTree, triggers_2mu);
-  hltPaths_setBranchAddresses(inputTree, triggers_1e1mu);
-
-  MET_PT_TYPE met_pt;
-  inputTree->SetBranchAddress(MET_PT_KEY, &met_pt);
-  MET_ETA_TYPE met_eta;
-  inputTree->SetBranchAddress(MET_ETA_KEY, &met_eta);
-  MET_PHI_TYPE met_phi;
-  inputTree->SetBranchAddress(MET_PHI_KEY, &met_phi);
-  LV met_p4(met_pt, met_eta, met_phi, 0.);
-
-//--- declare particle collections
-  RecoMuonReader* muonReader = new RecoMuonReader("nselLeptons", "selLeptons");
-  muonReader->setBranchAddresses(inputTree);
-  RecoMuonCollectionGenMatcher muonGenMatcher;
-  RecoMuonCollectionSelectorLoose preselMuonSelector;
-  RecoMuonCollectionSelectorFakeable fakeableMuonSelector;
-  RecoMuonCollectionSelectorTight tightMuonSelector;
-
-  RecoElectronReader* electronReader = new RecoElectronReader("nselLeptons", "selLeptons");
-  electronReader->setBranchAddresses(inputTree);
-  RecoElectronCollectionGenMatcher electronGenMatcher;
-  RecoElectronCollectionCleaner electronCleaner(0.3);
-  RecoElectronCollectionSelectorLoose preselElectronSelector;
-  RecoElectronCollectionSelectorFakeable fakeableElectronSelector;
-  RecoElectronCollectionSelectorTight tightElectronSelector;
-
-  RecoHadTauReader* hadTauReader = new RecoHadTauReader("nTauGood", "TauGood");
-  hadTauReader->setBranchAddresses(inputTree);
-  RecoHadTauCollectionGenMatcher hadTauGenMatcher;
-  RecoHadTauCollectionCleaner hadTauCleaner(0.3);
-  RecoHadTauCollectionSelectorTight hadTauSelector;
-  
-  RecoJetReader* jetReader = new RecoJetReader("nJet", "Jet");
-  jetReader->setJetPt_central_or_shift(jetPt_option);
-  jetReader->setBranchName_BtagWeight(jet_btagWeight_branch);
-  jetReader->setBranchAddresses(inputTree);
-  RecoJetCollectionGenMatcher jetGenMatcher;
-  RecoJetCollectionCleaner jetCleaner(0.5);
-  RecoJetCollectionSelector jetSelector;  
-  RecoJetCollectionSelectorBtagLoose jetSelectorBtagLoose;
-  RecoJetCollectionSelectorBtagMedium jetSelectorBtagMedium;
-
-  GenLeptonReader* genLeptonReader = 0;
-  GenHadTauReader* genHadTauReader = 0;
-  GenJetReader* genJetReader = 0;
-  if ( isMC ) {
-    genLeptonReader = new GenLeptonReader("nGenLep", "GenLep");
-    genLeptonReader->setBranchAddresses(inputTree);
-    genHadTauReader = new GenHadTauReader("nGenHadTaus", "GenHadTaus");
-    genHadTauReader->setBranchAddresses(inputTree);
-    genJetReader = new GenJetReader("nGenJet", "GenJet");
-    genJetReader->setBranchAddresses(inputTree);
+//--- split the range of entries into contiguous ranges, one per thread;
+//    the boundaries between the ranges are aligned to the cluster boundaries of the input files,
+//    so that the split is reproducible and no cluster of baskets is decompressed by more than one thread
+  EntryRange entryRange(cfg_input, ( inputCache ) ? inputCache->getEntries() : inputTree->GetEntries());
+  if ( maxEvents != -1 && entryRange.size() > maxEvents ) entryRange = EntryRange(entryRange.firstEntry(), entryRange.firstEntry() + maxEvents);
+  std::cout << "processing Entries " << entryRange.firstEntry() << " to " << entryRange.lastEntry() << "." << std::endl;
+  std::vector<Long64_t> clusterBoundaries;
+  if ( inputTree && numThreads > 1 ) clusterBoundaries = getClusterBoundaries(inputTree);
+  std::vector<EntryRange> entryRanges = splitEntryRange(entryRange, numThreads, clusterBoundaries);
+  if ( numThreads > 1 ) {
+    for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+      std::cout << " thread #" << idxWorker << ": Entries " << entryRanges[idxWorker].firstEntry() << " to " << entryRanges[idxWorker].lastEntry() << std::endl;
+    }
   }
 
-//--- initialize BDTs used to discriminate ttH vs. ttV and ttH vs. ttbar 
-//    in 2lss_1tau category of ttH multilepton analysis
-  std::string mvaFileName_2lss_ttV = "tthAnalysis/HiggsToTauTau/data/2lss_ttV_BDTG.weights.xml";
-  std::vector<std::string> mvaInputVariables_2lss_ttV;
-  mvaInputVariables_2lss_ttV.push_back("max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))");
-  mvaInputVariables_2lss_ttV.push_back("MT_met_lep1");
-  mvaInputVariables_2lss_ttV.push_back("nJet25_Recl");
-  mvaInputVariables_2lss_ttV.push_back("mindr_lep1_jet");
-  mvaInputVariables_2lss_ttV.push_back("mindr_lep2_jet");
-  mvaInputVariables_2lss_ttV.push_back("LepGood_conePt[iF_Recl[0]]");
-  mvaInputVariables_2lss_ttV.push_back("LepGood_conePt[iF_Recl[1]]");
-  TMVAInterface mva_2lss_ttV(mvaFileName_2lss_ttV, mvaInputVariables_2lss_ttV, { "iF_Recl[0]", "iF_Recl[1]", "iF_Recl[2]" });
-
-  std::string mvaFileName_2lss_ttbar = "tthAnalysis/HiggsToTauTau/data/2lss_ttbar_BDTG.weights.xml";
-  std::vector<std::string> mvaInputVariables_2lss_ttbar;
-  mvaInputVariables_2lss_ttbar.push_back("max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))");
-  mvaInputVariables_2lss_ttbar.push_back("nJet25_Recl");
-  mvaInputVariables_2lss_ttbar.push_back("mindr_lep1_jet");
-  mvaInputVariables_2lss_ttbar.push_back("mindr_lep2_jet");
-  mvaInputVariables_2lss_ttbar.push_back("min(met_pt,400)");
-  mvaInputVariables_2lss_ttbar.push_back("avg_dr_jet");
-  mvaInputVariables_2lss_ttbar.push_back("MT_met_lep1");
-  TMVAInterface mva_2lss_ttbar(mvaFileName_2lss_ttbar, mvaInputVariables_2lss_ttbar, { "iF_Recl[0]", "iF_Recl[1]", "iF_Recl[2]" });
-
-  std::map<std::string, double> mvaInputs;
+  if ( numThreads > 1 && cfg_analyze.exists("skim") && 
+       cfg_analyze.getParameter<edm::ParameterSet>("skim").getParameter<std::string>("outputFileName") != "" )
+    throw cms::Exception("analyze_2lss_1tau") 
+      << "Writing a skim is not supported when processing events in more than one thread !!\n";
 
 //--- open output file containing run:lumi:event numbers of events passing final event selection criteria
   std::ostream* selEventsFile = new std::ofstream(selEventsFileName_output.data(), std::ios::out);
 
-//--- declare histograms
+//--- declare histograms;
+//    threads other than the first fill private copies of the histograms, booked in separate directories,
+//    which are added to the histograms of the first thread once all threads have finished
   std::string charge_and_leptonSelection = Form("%s_%s", chargeSelection_string.data(), leptonSelection_string.data());
-  ElectronHistManager preselElectronHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/presel/electrons", charge_and_leptonSelection.data()), central_or_shift));
-  preselElectronHistManager.bookHistograms(fs);
-  MuonHistManager preselMuonHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/presel/muons", charge_and_leptonSelection.data()), central_or_shift));
-  preselMuonHistManager.bookHistograms(fs);
-  HadTauHistManager preselHadTauHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/presel/hadTaus", charge_and_leptonSelection.data()), central_or_shift));
-  preselHadTauHistManager.bookHistograms(fs);
-  JetHistManager preselJetHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/presel/jets", charge_and_leptonSelection.data()), central_or_shift));
-  preselJetHistManager.bookHistograms(fs);
-  JetHistManager preselBJet_looseHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/presel/BJets_loose", charge_and_leptonSelection.data()), central_or_shift));
-  preselBJet_looseHistManager.bookHistograms(fs);
-  JetHistManager preselBJet_mediumHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/presel/BJets_medium", charge_and_leptonSelection.data()), central_or_shift));
-  preselBJet_mediumHistManager.bookHistograms(fs);
-  MEtHistManager preselMEtHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/presel/met", charge_and_leptonSelection.data()), central_or_shift));
-  preselMEtHistManager.bookHistograms(fs);
-  EvtHistManager_2lss_1tau preselEvtHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/presel/evt", charge_and_leptonSelection.data()), central_or_shift));
-  preselEvtHistManager.bookHistograms(fs);
-
-  ElectronHistManager selElectronHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/sel/electrons", charge_and_leptonSelection.data()), central_or_shift));
-  selElectronHistManager.bookHistograms(fs);
-  vstring categories_e = { 
-    "2epp_1tau_bloose", "2epp_1tau_btight", "2emm_1tau_bloose", "2emm_1tau_btight", 
-    "1e1mupp_1tau_bloose", "1e1mupp_1tau_btight", "1e1mumm_1tau_bloose", "1e1mumm_1tau_btight" };
-  std::map<std::string, std::map<std::string, ElectronHistManager*>> selElectronHistManager_category; // key = category, "leadElectron"/"subleadElectron"/"electron"
-  for ( vstring::const_iterator category = categories_e.begin();
-	category != categories_e.end(); ++category ) {
-    if ( category->find("2epp") != std::string::npos || category->find("2emm") != std::string::npos ) {
-      ElectronHistManager* selElectronHistManager_lead = new ElectronHistManager(makeHistManager_cfg(process_string, 
-	Form("%s_%s/sel/leadElectron", category->data(), charge_and_leptonSelection.data()), central_or_shift, 0));
-      selElectronHistManager_lead->bookHistograms(fs);
-      selElectronHistManager_category[*category]["leadElectron"] = selElectronHistManager_lead;
-      ElectronHistManager* selElectronHistManager_sublead = new ElectronHistManager(makeHistManager_cfg(process_string, 
-	Form("%s_%s/sel/subleadElectron", category->data(), charge_and_leptonSelection.data()), central_or_shift, 1));
-      selElectronHistManager_sublead->bookHistograms(fs);
-      selElectronHistManager_category[*category]["subleadElectron"] = selElectronHistManager_sublead;
+  std::vector<std::vector<histManagers_2lss_1tau*>> histManagers_workers(numThreads);
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    TFileDirectory dir = ( idxWorker == 0 ) ? fs : fs.mkdir(Form("shard%i", idxWorker));
+    for ( std::vector<std::vector<size_t>>::const_iterator shiftGroup = shiftGroups.begin();
+	  shiftGroup != shiftGroups.end(); ++shiftGroup ) {
+      vstring central_or_shifts_group;
+      for ( std::vector<size_t>::const_iterator idxShift = shiftGroup->begin();
+	    idxShift != shiftGroup->end(); ++idxShift ) {
+	central_or_shifts_group.push_back(central_or_shifts[*idxShift]);
+      }
+      histManagers_workers[idxWorker].push_back(new histManagers_2lss_1tau(dir, process_string, charge_and_leptonSelection, central_or_shifts_group));
     }
-    if ( category->find("1e1mupp") != std::string::npos || category->find("1e1mumm") != std::string::npos ) {
-      ElectronHistManager* selElectronHistManager = new ElectronHistManager(makeHistManager_cfg(process_string, 
-	Form("%s_%s/sel/electron", category->data(), charge_and_leptonSelection.data()), central_or_shift));
-      selElectronHistManager->bookHistograms(fs);
-      selElectronHistManager_category[*category]["electron"] = selElectronHistManager;
+  }
+
+//--- declare caches of the BDT outputs, so that the BDTs are evaluated only once per event
+//    for all systematic shifts that do not change the BDT inputs (e.g. JES shifts that do not change the selected jets);
+//    the outputs read from the sidecar file (optional) are shared by all threads,
+//    while the outputs computed by each thread are collected separately and combined once all threads have finished
+  std::string mvaFileName_2lss_ttV = "tthAnalysis/HiggsToTauTau/data/2lss_ttV_BDTG.weights.xml";
+  std::string mvaFileName_2lss_ttbar = "tthAnalysis/HiggsToTauTau/data/2lss_ttbar_BDTG.weights.xml";
+  std::string mvaOutputCacheTag = getMVAOutputCacheTag({ mvaFileName_2lss_ttV, mvaFileName_2lss_ttbar }, getMVAInputLayout_2lss());
+  MVAOutputCache* mvaOutputCache_input = 0;
+  if ( mvaOutputCacheFileName_input != "" ) {
+    mvaOutputCache_input = new MVAOutputCache(mvaOutputCacheTag, kNumMVAInputs_2lss, kNumMVAOutputs_2lss, true);
+    if ( mvaOutputCache_input->read(mvaOutputCacheFileName_input) ) {
+      std::cout << "read " << mvaOutputCache_input->size() << " BDT outputs from file = " << mvaOutputCacheFileName_input << std::endl;
     }
   }
+  std::vector<MVAOutputCache*> mvaOutputCaches_workers;
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    MVAOutputCache* mvaOutputCache = new MVAOutputCache(mvaOutputCacheTag, kNumMVAInputs_2lss, kNumMVAOutputs_2lss, mvaOutputCacheFileName_output != "");
+    mvaOutputCache->setFallback(mvaOutputCache_input);
+    mvaOutputCaches_workers.push_back(mvaOutputCache);
+  }
 
-  MuonHistManager selMuonHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/sel/muons", charge_and_leptonSelection.data()), central_or_shift));
-  selMuonHistManager.bookHistograms(fs);
-  vstring categories_mu = { 
-    "1e1mupp_1tau_bloose", "1e1mupp_1tau_btight", "1e1mumm_1tau_bloose", "1e1mumm_1tau_btight",
-    "2mupp_1tau_bloose", "2mupp_1tau_btight", "2mumm_1tau_bloose", "2mumm_1tau_btight" 
-  };
-  std::map<std::string, std::map<std::string, MuonHistManager*>> selMuonHistManager_category; // key = category, "leadMuon"/"subleadMuon"/"muon"
-  for ( vstring::const_iterator category = categories_mu.begin();
-	category != categories_mu.end(); ++category ) {
-    if ( category->find("1e1mupp") != std::string::npos || category->find("1e1mumm") != std::string::npos ) {
-      MuonHistManager* selMuonHistManager = new MuonHistManager(makeHistManager_cfg(process_string, 
-	Form("%s_%s/sel/muon", category->data(), charge_and_leptonSelection.data()), central_or_shift));
-      selMuonHistManager->bookHistograms(fs);
-      selMuonHistManager_category[*category]["muon"] = selMuonHistManager;
+  std::vector<std::ostringstream> selEventsFiles_workers(numThreads);
+  std::vector<int> analyzedEntries_workers(numThreads);
+  std::vector<int> selectedEntries_workers(numThreads);
+  std::vector<double> selectedEntries_weighted_workers(numThreads);
+  std::vector<CutFlowTable> cutFlow_workers(numThreads, CutFlowTable("analyze_2lss_1tau"));
+  std::mutex workerMutex;
+  std::mutex coutMutex;
+
+//--- process the entries in range given by entryRanges[idxWorker];
+//    all objects that change their state while processing events (readers, selectors, TMVA::Reader objects,...)
+//    are private to each thread
+  auto processEntries = [&](int idxWorker)
+  {
+//--- construct and destruct the objects used by each thread one thread at a time,
+//    as creating and deleting TChain, TBranch and TMVA::Reader objects is not guaranteed to be thread-safe
+    std::unique_lock<std::mutex> lock(workerMutex);
+
+//--- each thread other than the first reads the input files through its own TChain or ColumnarCacheReader object
+    TChain* inputTree_worker = inputTree;
+    ColumnarCacheReader* inputCache_worker = inputCache;
+    if ( idxWorker > 0 ) {
+      if ( inputTree ) {
+        inputTree_worker = new TChain(treeName.data());
+        for ( std::vector<std::string>::const_iterator inputFileName = inputFiles.files().begin();
+	      inputFileName != inputFiles.files().end(); ++inputFileName ) {
+          inputTree_worker->AddFile(inputFileName->data());
+        }
+        inputTree_worker->LoadTree(0);
+      } else {
+        inputCache_worker = new ColumnarCacheReader(inputFiles.files());
+      }
     }
-    if ( category->find("2mupp") != std::string::npos || category->find("2mumm") != std::string::npos ) {
-      MuonHistManager* selMuonHistManager_lead = new MuonHistManager(makeHistManager_cfg(process_string, 
-	Form("%s_%s/sel/leadMuon", category->data(), charge_and_leptonSelection.data()), central_or_shift, 0));
-      selMuonHistManager_lead->bookHistograms(fs);
-      selMuonHistManager_category[*category]["leadMuon"] = selMuonHistManager_lead;
-      MuonHistManager* selMuonHistManager_sublead = new MuonHistManager(makeHistManager_cfg(process_string, 
-	Form("%s_%s/sel/subleadMuon", category->data(), charge_and_leptonSelection.data()), central_or_shift, 1));
-      selMuonHistManager_sublead->bookHistograms(fs);
-      selMuonHistManager_category[*category]["subleadMuon"] = selMuonHistManager_sublead;
+
+//--- declare event-level variables
+    EventSource* eventSource_ptr = ( inputCache_worker ) ? new EventSource(inputCache_worker) : new EventSource(inputTree_worker);
+    EventSource& eventSource = (*eventSource_ptr);
+
+    RUN_TYPE run;
+    eventSource.setBranchAddress(RUN_KEY, &run);
+    LUMI_TYPE lumi;
+    eventSource.setBranchAddress(LUMI_KEY, &lumi);
+    EVT_TYPE event;
+    eventSource.setBranchAddress(EVT_KEY, &event);
+    GENHIGGSDECAYMODE_TYPE genHiggsDecayMode;
+    if(process_string != "data_obs")
+      eventSource.setBranchAddress(GENHIGGSDECAYMODE_KEY, &genHiggsDecayMode);
+
+    std::vector<hltPath*> triggers_1e = create_hltPaths(triggerNames_1e);
+    std::vector<hltPath*> triggers_2e = create_hltPaths(triggerNames_2e);
+    std::vector<hltPath*> triggers_1mu = create_hltPaths(triggerNames_1mu);
+    std::vector<hltPath*> triggers_2mu = create_hltPaths(triggerNames_2mu);
+    std::vector<hltPath*> triggers_1e1mu = create_hltPaths(triggerNames_1e1mu);
+    hltPaths_setBranchAddresses(eventSource, triggers_1e);
+    hltPaths_setBranchAddresses(eventSource, triggers_2e);
+    hltPaths_setBranchAddresses(eventSource, triggers_1mu);
+    hltPaths_setBranchAddresses(eventSource, triggers_2mu);
+    hltPaths_setBranchAddresses(eventSource, triggers_1e1mu);
+
+    MET_PT_TYPE met_pt;
+    eventSource.setBranchAddress(MET_PT_KEY, &met_pt);
+    MET_ETA_TYPE met_eta;
+    eventSource.setBranchAddress(MET_ETA_KEY, &met_eta);
+    MET_PHI_TYPE met_phi;
+    eventSource.setBranchAddress(MET_PHI_KEY, &met_phi);
+    LV met_p4(met_pt, met_eta, met_phi, 0.);
+
+//--- declare particle collections
+    RecoMuonReader* muonReader = new RecoMuonReader("nselLeptons", "selLeptons");
+    muonReader->setBranchAddresses(eventSource);
+    RecoMuonCollectionSelectorLoose preselMuonSelector;
+    RecoMuonCollectionMultiSelector muonSelector;
+
+    RecoElectronReader* electronReader = new RecoElectronReader("nselLeptons", "selLeptons");
+    electronReader->setBranchAddresses(eventSource);
+    RecoElectronCollectionCleaner electronCleaner(0.3);
+    RecoElectronCollectionSelectorLoose preselElectronSelector;
+    RecoElectronCollectionMultiSelector electronSelector;
+
+    RecoHadTauReader* hadTauReader = new RecoHadTauReader("nTauGood", "TauGood");
+    hadTauReader->setBranchAddresses(eventSource);
+    RecoHadTauCollectionCleaner hadTauCleaner(0.3);
+    RecoHadTauCollectionSelectorTight hadTauSelector;
+
+    RecoJetReader* jetReader = new RecoJetReader("nJet", "Jet");
+    jetReader->setJetPt_central_or_shift(jetPt_options[0]);
+    jetReader->setBranchName_BtagWeight(jet_btagWeight_branches[0]);
+    jetReader->setBranchNames_BtagWeight_shifts(jet_btagWeight_branches);
+    jetReader->setBranchAddresses(eventSource);
+    RecoJetCollectionCleaner jetCleaner(0.5);
+    RecoJetCollectionSelector jetSelector;  
+    RecoJetCollectionSelectorBtagLoose jetSelectorBtagLoose;
+    RecoJetCollectionSelectorBtagMedium jetSelectorBtagMedium;
+
+    GenLeptonReader* genLeptonReader = 0;
+    GenHadTauReader* genHadTauReader = 0;
+    GenJetReader* genJetReader = 0;
+    if ( isMC ) {
+      genLeptonReader = new GenLeptonReader("nGenLep", "GenLep");
+      genLeptonReader->setBranchAddresses(eventSource);
+      genHadTauReader = new GenHadTauReader("nGenHadTaus", "GenHadTaus");
+      genHadTauReader->setBranchAddresses(eventSource);
+      genJetReader = new GenJetReader("nGenJet", "GenJet");
+      genJetReader->setBranchAddresses(eventSource);
     }
-  }
+    GenMatchTable genMatchTable;
 
-  HadTauHistManager selHadTauHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/sel/hadTaus", charge_and_leptonSelection.data()), central_or_shift));
-  selHadTauHistManager.bookHistograms(fs);
-
-  JetHistManager selJetHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/sel/jets", charge_and_leptonSelection.data()), central_or_shift));
-  selJetHistManager.bookHistograms(fs);
-  JetHistManager selJetHistManager_lead(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/sel/leadJet", charge_and_leptonSelection.data()), central_or_shift, 0));
-  selJetHistManager_lead.bookHistograms(fs);
-  JetHistManager selJetHistManager_sublead(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/sel/subleadJet", charge_and_leptonSelection.data()), central_or_shift, 1));
-  selJetHistManager_sublead.bookHistograms(fs);
-
-  JetHistManager selBJet_looseHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/sel/BJets_loose", charge_and_leptonSelection.data()), central_or_shift));
-  selBJet_looseHistManager.bookHistograms(fs);
-  JetHistManager selBJet_looseHistManager_lead(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/sel/leadBJet_loose", charge_and_leptonSelection.data()), central_or_shift, 0));
-  selBJet_looseHistManager_lead.bookHistograms(fs);
-  JetHistManager selBJet_looseHistManager_sublead(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/sel/subleadBJet_loose", charge_and_leptonSelection.data()), central_or_shift, 1));
-  selBJet_looseHistManager_sublead.bookHistograms(fs);
-  JetHistManager selBJet_mediumHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/sel/BJets_medium", charge_and_leptonSelection.data()), central_or_shift));
-  selBJet_mediumHistManager.bookHistograms(fs);
-
-  MEtHistManager selMEtHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/sel/met", charge_and_leptonSelection.data()), central_or_shift));
-  selMEtHistManager.bookHistograms(fs);
-
-  EvtHistManager_2lss_1tau selEvtHistManager(makeHistManager_cfg(process_string, 
-    Form("2lss_1tau_%s/sel/evt", charge_and_leptonSelection.data()), central_or_shift));
-  selEvtHistManager.bookHistograms(fs);
-  std::map<std::string, EvtHistManager_2lss_1tau*> selEvtHistManager_decayMode; // key = decay mode
-  const std::map<std::string, GENHIGGSDECAYMODE_TYPE> decayMode_idString = {
-    { "ttH_hww", static_cast<GENHIGGSDECAYMODE_TYPE>(24) },
-    { "ttH_hzz", static_cast<GENHIGGSDECAYMODE_TYPE>(23) },
-    { "ttH_htt", static_cast<GENHIGGSDECAYMODE_TYPE>(15) }
-  };
-  vstring decayModes_evt;
-  decayModes_evt.reserve(decayMode_idString.size());
-  boost::copy(decayMode_idString | boost::adaptors::map_keys, std::back_inserter(decayModes_evt));
-  if(process_string != "data_obs") {
-    for ( vstring::const_iterator decayMode = decayModes_evt.begin();
-          decayMode != decayModes_evt.end(); ++decayMode) {
-        EvtHistManager_2lss_1tau* selEvtHistManager_ptr = new EvtHistManager_2lss_1tau(makeHistManager_cfg(decayMode->data(),
-          Form("2lss_1tau_%s/sel/evt", charge_and_leptonSelection.data()), central_or_shift));
-        selEvtHistManager_ptr->bookHistograms(fs);
-        selEvtHistManager_decayMode[*decayMode] = selEvtHistManager_ptr;
+//--- initialize BDTs used to discriminate ttH vs. ttV and ttH vs. ttbar 
+//    in 2lss_1tau category of ttH multilepton analysis
+    std::vector<std::string> mvaInputVariables_2lss_ttV;
+    mvaInputVariables_2lss_ttV.push_back("max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))");
+    mvaInputVariables_2lss_ttV.push_back("MT_met_lep1");
+    mvaInputVariables_2lss_ttV.push_back("nJet25_Recl");
+    mvaInputVariables_2lss_ttV.push_back("mindr_lep1_jet");
+    mvaInputVariables_2lss_ttV.push_back("mindr_lep2_jet");
+    mvaInputVariables_2lss_ttV.push_back("LepGood_conePt[iF_Recl[0]]");
+    mvaInputVariables_2lss_ttV.push_back("LepGood_conePt[iF_Recl[1]]");
+    TMVAInterface mva_2lss_ttV(mvaFileName_2lss_ttV, mvaInputVariables_2lss_ttV, { "iF_Recl[0]", "iF_Recl[1]", "iF_Recl[2]" },
+                               getMVAInputLayout_2lss());
+
+    std::vector<std::string> mvaInputVariables_2lss_ttbar;
+    mvaInputVariables_2lss_ttbar.push_back("max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))");
+    mvaInputVariables_2lss_ttbar.push_back("nJet25_Recl");
+    mvaInputVariables_2lss_ttbar.push_back("mindr_lep1_jet");
+    mvaInputVariables_2lss_ttbar.push_back("mindr_lep2_jet");
+    mvaInputVariables_2lss_ttbar.push_back("min(met_pt,400)");
+    mvaInputVariables_2lss_ttbar.push_back("avg_dr_jet");
+    mvaInputVariables_2lss_ttbar.push_back("MT_met_lep1");
+    TMVAInterface mva_2lss_ttbar(mvaFileName_2lss_ttbar, mvaInputVariables_2lss_ttbar, { "iF_Recl[0]", "iF_Recl[1]", "iF_Recl[2]" },
+                                 getMVAInputLayout_2lss());
+
+    Float_t mvaInputs[kNumMVAInputs_2lss];
+
+    RunLumiEventSelector* run_lumi_eventSelector = 0;
+    if ( selEventsFileName_input != "" ) {
+      edm::ParameterSet cfgRunLumiEventSelector;
+      cfgRunLumiEventSelector.addParameter<std::string>("inputFileName", selEventsFileName_input);
+      cfgRunLumiEventSelector.addParameter<std::string>("separator", ":");
+      run_lumi_eventSelector = new RunLumiEventSelector(cfgRunLumiEventSelector);
     }
-  }
-  vstring categories_evt = { 
-    "2epp_1tau_bloose", "2epp_1tau_btight", "2emm_1tau_bloose", "2emm_1tau_btight",
-    "1e1mupp_1tau_bloose", "1e1mupp_1tau_btight", "1e1mumm_1tau_bloose", "1e1mumm_1tau_btight",
-    "2mupp_1tau_bloose", "2mupp_1tau_btight", "2mumm_1tau_bloose", "2mumm_1tau_btight" 
-  };
-  std::map<std::string, EvtHistManager_2lss_1tau*> selEvtHistManager_category; // key = category
-  for ( vstring::const_iterator category = categories_evt.begin();
-	category != categories_evt.end(); ++category ) {
-    EvtHistManager_2lss_1tau* selEvtHistManager_ptr = new EvtHistManager_2lss_1tau(makeHistManager_cfg(process_string,
-      Form("%s_%s/sel/evt", category->data(), charge_and_leptonSelection.data()), central_or_shift));
-    selEvtHistManager_ptr->bookHistograms(fs);
-    selEvtHistManager_category[*category] = selEvtHistManager_ptr;
-  }
 
-  int numEntries = inputTree->GetEntries();
-  int analyzedEntries = 0;
-  int selectedEntries = 0;
-  double selectedEntries_weighted = 0.;
-  for ( int idxEntry = 0; idxEntry < numEntries && (maxEvents == -1 || idxEntry < maxEvents); ++idxEntry ) {
-    if ( idxEntry > 0 && (idxEntry % reportEvery) == 0 ) {
-      std::cout << "processing Entry " << idxEntry << " (" << selectedEntries << " Entries selected)" << std::endl;
+//--- selected run:lumi:event numbers and counters of each thread are collected separately
+//    and combined once all threads have finished
+    std::ostream& selEventsFile = selEventsFiles_workers[idxWorker];
+    int& analyzedEntries = analyzedEntries_workers[idxWorker];
+    int& selectedEntries = selectedEntries_workers[idxWorker];
+    double& selectedEntries_weighted = selectedEntries_weighted_workers[idxWorker];
+    std::vector<histManagers_2lss_1tau*>& histManagers_shifts = histManagers_workers[idxWorker];
+    MVAOutputCache& mvaOutputCache = (*mvaOutputCaches_workers[idxWorker]);
+
+//--- disable all branches that are not read by any of the readers,
+//    so that TTree::GetEntry does not unzip them
+    eventSource.setBranchStatus();
+    if ( idxWorker == 0 ) eventSource.printManifest(std::cout);
+
+//--- open output file for skim of events passing preselection (optional)
+    SkimWriter* skimWriter = 0;
+    if ( cfg_analyze.exists("skim") ) {
+      edm::ParameterSet cfg_skim = cfg_analyze.getParameter<edm::ParameterSet>("skim");
+      if ( cfg_skim.getParameter<std::string>("outputFileName") != "" ) {
+        skimWriter = new SkimWriter(cfg_skim, eventSource);
+      }
     }
-    ++analyzedEntries;
-    
-    inputTree->GetEntry(idxEntry);
 
-    if ( run_lumi_eventSelector && !(*run_lumi_eventSelector)(run, lumi, event) ) continue;
+//--- read event numbers, trigger bits and object multiplicities first,
+//    and the remaining branches only for events passing the trigger and multiplicity requirements
+    StagedEntryLoader entryLoader(eventSource);
+    entryLoader.addEarlyBranch(RUN_KEY);
+    entryLoader.addEarlyBranch(LUMI_KEY);
+    entryLoader.addEarlyBranch(EVT_KEY);
+    entryLoader.addEarlyBranches(hltPaths_branchNames(triggers_1e));
+    entryLoader.addEarlyBranches(hltPaths_branchNames(triggers_2e));
+    entryLoader.addEarlyBranches(hltPaths_branchNames(triggers_1mu));
+    entryLoader.addEarlyBranches(hltPaths_branchNames(triggers_2mu));
+    entryLoader.addEarlyBranches(hltPaths_branchNames(triggers_1e1mu));
+    entryLoader.addEarlyBranch("nselLeptons");
+    entryLoader.addEarlyBranch("nTauGood");
+    entryLoader.addEarlyBranch("nJet");
+
+//--- declare the cuts of the event selection, in the order in which they are applied;
+//    the requirements on object multiplicities are independent of each other
+//    and are evaluated in order of decreasing rejection per CPU time
+    CutFlowTable& cutFlow = cutFlow_workers[idxWorker];
+    const int cut_runLumiEvent = cutFlow.addCut("run:lumi:event selection");
+    const int cut_trigger = cutFlow.addCut("trigger");
+    const int cut_triggerRanking = cutFlow.addCut("trigger ranking");
+    const int cut_multiplicities = cutFlow.addCutGroup("object multiplicities");
+    cutFlow.addCut(cut_multiplicities, "nselLeptons >= 2", [&entryLoader]() { return entryLoader.getValue("nselLeptons") >= 2; });
+    cutFlow.addCut(cut_multiplicities, "nTauGood >= 1", [&entryLoader]() { return entryLoader.getValue("nTauGood") >= 1; });
+    cutFlow.addCut(cut_multiplicities, "nJet >= 2", [&entryLoader]() { return entryLoader.getValue("nJet") >= 2; });
+    const int cut_preselLeptons = cutFlow.addCut("2 presel leptons");
+    const int cut_preselLeptons_3l = cutFlow.addCut("2 presel electrons + muons");
+    const int cut_preselLeptons_trigger = cutFlow.addCut("presel lepton trigger match");
+    const int cut_preselHadTaus = cutFlow.addCut("1 sel tau (presel)");
+    const int cut_preselJets = cutFlow.addCut(">= 2 jets (presel)");
+    const int cut_preselBJets = cutFlow.addCut(">= 2 loose b-jets || >= 1 medium b-jet (presel)");
+    const int cut_selLeptons = cutFlow.addCut("2 sel leptons");
+    const int cut_selLeptons_trigger = cutFlow.addCut("sel lepton trigger match");
+    const int cut_selJets = cutFlow.addCut(">= 4 jets");
+    const int cut_selBJets = cutFlow.addCut(">= 2 loose b-jets || >= 1 medium b-jet");
+    const int cut_selHadTaus = cutFlow.addCut("1 sel tau");
+    const int cut_lowMassVeto = cutFlow.addCut("m(ll) > 12 GeV");
+    const int cut_leptonPt = cutFlow.addCut("lepton pT");
+    const int cut_charge = cutFlow.addCut("lepton charge");
+    const int cut_ZbosonMassVeto = cutFlow.addCut("Z veto (ee)");
+    const int cut_metLD = cutFlow.addCut("met_LD > 0.2 (ee)");
+    const int cut_tightLeptonVeto = cutFlow.addCut("< 2 tight leptons (fakeable)");
+
+//--- declare collections of particles outside of the event loop,
+//    so that the memory allocated for them is reused from one event to the next
+    RecoMuonCollectionView muonView;
+    std::vector<int> preselMuonIndices;
+    std::vector<RecoMuon> muons;
+    std::vector<const RecoMuon*> muon_ptrs;
+    RecoMuonCollectionSelection muonSelection;
+    std::vector<const RecoMuon*> fakeableMuons;
+    std::vector<const RecoMuon*> tightMuons;
+    RecoElectronCollectionView electronView;
+    std::vector<int> preselElectronIndices;
+    std::vector<RecoElectron> electrons;
+    std::vector<const RecoElectron*> electron_ptrs;
+    std::vector<const RecoElectron*> cleanedElectrons;
+    RecoElectronCollectionSelection electronSelection;
+    std::vector<const RecoElectron*> fakeableElectrons;
+    std::vector<const RecoElectron*> tightElectrons;
+    RecoHadTauCollectionView hadTauView;
+    std::vector<int> selHadTauIndices;
+    std::vector<RecoHadTau> hadTaus;
+    std::vector<const RecoHadTau*> hadTau_ptrs;
+    std::vector<const RecoHadTau*> cleanedHadTaus;
+    std::vector<const RecoElectron*> preselElectrons_skim;
+    RecoElectronCollectionSelection electronSelection_skim;
+    std::vector<const RecoElectron*> selElectrons_skim;
+    std::vector<const RecoHadTau*> selHadTaus_skim;
+    std::vector<const RecoLepton*> preselLeptons;
+    std::vector<GenLepton> genLeptons;
+    std::vector<GenHadTau> genHadTaus;
+    std::vector<GenJet> genJets;
+    std::vector<RecoJet> jets;
+    std::vector<const RecoJet*> jet_ptrs;
+    std::vector<const RecoJet*> cleanedJets;
+    std::vector<const RecoJet*> selJets;
+    std::vector<const RecoJet*> selBJets_loose;
+    std::vector<const RecoJet*> selBJets_medium;
+    std::vector<const RecoLepton*> selLeptons;
+
+    lock.unlock();
+
+    for ( Long64_t idxEntry = entryRanges[idxWorker].firstEntry(); idxEntry < entryRanges[idxWorker].lastEntry(); ++idxEntry ) {
+      if ( analyzedEntries > 0 && (analyzedEntries % reportEvery) == 0 ) {
+        std::lock_guard<std::mutex> lock_cout(coutMutex);
+        std::cout << "processing Entry " << idxEntry << " (" << selectedEntries << " Entries selected)" << std::endl;
+      }
+      ++analyzedEntries;
+
+      cutFlow.startEvent();
+
+      entryLoader.loadEarly(idxEntry);
+
+      if ( !cutFlow(cut_runLumiEvent, !run_lumi_eventSelector || (*run_lumi_eventSelector)(run, lumi, event), lumiScale) ) continue;
 
-    bool isTriggered_1e = hltPaths_isTriggered(triggers_1e);
-    bool isTriggered_2e = hltPaths_isTriggered(triggers_2e);
-    bool isTriggered_1mu = hltPaths_isTriggered(triggers_1mu);
-    bool isTriggered_2mu = hltPaths_isTriggered(triggers_2mu);
-    bool isTriggered_1e1mu = hltPaths_isTriggered(triggers_1e1mu);
+      bool isTriggered_1e = hltPaths_isTriggered(triggers_1e);
+      bool isTriggered_2e = hltPaths_isTriggered(triggers_2e);
+      bool isTriggered_1mu = hltPaths_isTriggered(triggers_1mu);
+      bool isTriggered_2mu = hltPaths_isTriggered(triggers_2mu);
+      bool isTriggered_1e1mu = hltPaths_isTriggered(triggers_1e1mu);
 
-    bool selTrigger_1e = use_triggers_1e && isTriggered_1e;
-    bool selTrigger_2e = use_triggers_2e && isTriggered_2e;
-    bool selTrigger_1mu = use_triggers_1mu && isTriggered_1mu;
-    bool selTrigger_2mu = use_triggers_2mu && isTriggered_2mu;
-    bool selTrigger_1e1mu = use_triggers_1e1mu && isTriggered_1e1mu;
-    if ( !(selTrigger_1e || selTrigger_2e || selTrigger_1mu || selTrigger_2mu || selTrigger_1e1mu) ) continue;
+      bool selTrigger_1e = use_triggers_1e && isTriggered_1e;
+      bool selTrigger_2e = use_triggers_2e && isTriggered_2e;
+      bool selTrigger_1mu = use_triggers_1mu && isTriggered_1mu;
+      bool selTrigger_2mu = use_triggers_2mu && isTriggered_2mu;
+      bool selTrigger_1e1mu = use_triggers_1e1mu && isTriggered_1e1mu;
+      if ( !cutFlow(cut_trigger, selTrigger_1e || selTrigger_2e || selTrigger_1mu || selTrigger_2mu || selTrigger_1e1mu, lumiScale) ) continue;
 
 //--- rank triggers by priority and ignore triggers of lower priority if a trigger of higher priority has fired for given event;
 //    the ranking of the triggers is as follows: 2mu, 1e1mu, 2e, 1mu, 1e
 // CV: this logic is necessary to avoid that the same event is selected multiple times when processing different primary datasets
-    if ( selTrigger_1e && (isTriggered_2e || isTriggered_1mu || isTriggered_2mu || isTriggered_1e1mu) ) continue; 
-    if ( selTrigger_2e && (isTriggered_2mu || isTriggered_1e1mu) ) continue; 
-    if ( selTrigger_1mu && (isTriggered_2e || isTriggered_2mu || isTriggered_1e1mu) ) continue; 
-    if ( selTrigger_1e1mu && isTriggered_2mu ) continue; 
+      bool failsTriggerRanking = false;
+      if ( selTrigger_1e && (isTriggered_2e || isTriggered_1mu || isTriggered_2mu || isTriggered_1e1mu) ) failsTriggerRanking = true;
+      if ( selTrigger_2e && (isTriggered_2mu || isTriggered_1e1mu) ) failsTriggerRanking = true;
+      if ( selTrigger_1mu && (isTriggered_2e || isTriggered_2mu || isTriggered_1e1mu) ) failsTriggerRanking = true;
+      if ( selTrigger_1e1mu && isTriggered_2mu ) failsTriggerRanking = true;
+      if ( !cutFlow(cut_triggerRanking, !failsTriggerRanking, lumiScale) ) continue;
+
+//--- reject events with too few leptons, hadronic taus or jets before reading the object branches
+      if ( !cutFlow.passesCutGroup(cut_multiplicities, lumiScale) ) continue;
+
+      entryLoader.loadRemaining();
 
 //--- build collections of electrons, muons and hadronic taus;
 //    resolve overlaps in order of priority: muon, electron,
-    std::vector<RecoMuon> muons = muonReader->read();
-    std::vector<const RecoMuon*> muon_ptrs = convert_to_ptrs(muons);
-    std::vector<const RecoMuon*> cleanedMuons = muon_ptrs; // CV: no cleaning needed for muons, as they have the highest priority in the overlap removal
-    std::vector<const RecoMuon*> preselMuons = preselMuonSelector(cleanedMuons);
-    std::vector<const RecoMuon*> fakeableMuons = fakeableMuonSelector(preselMuons);
-    std::vector<const RecoMuon*> tightMuons = tightMuonSelector(preselMuons);
-    std::vector<const RecoMuon*> selMuons;
-    if      ( leptonSelection == kLoose    ) selMuons = preselMuons;
-    else if ( leptonSelection == kFakeable ) selMuons = fakeableMuons;
-    else if ( leptonSelection == kTight    ) selMuons = tightMuons;
-    else assert(0);
-
-    std::vector<RecoElectron> electrons = electronReader->read();
-    std::vector<const RecoElectron*> electron_ptrs = convert_to_ptrs(electrons);
-    std::vector<const RecoElectron*> cleanedElectrons = electronCleaner(electron_ptrs, selMuons);
-    std::vector<const RecoElectron*> preselElectrons = preselElectronSelector(cleanedElectrons);
-    std::vector<const RecoElectron*> fakeableElectrons = fakeableElectronSelector(preselElectrons);
-    std::vector<const RecoElectron*> tightElectrons = tightElectronSelector(preselElectrons);
-    std::vector<const RecoElectron*> selElectrons;
-    if      ( leptonSelection == kLoose    ) selElectrons = preselElectrons;
-    else if ( leptonSelection == kFakeable ) selElectrons = fakeableElectrons;
-    else if ( leptonSelection == kTight    ) selElectrons = tightElectrons;
-    else assert(0);
-
-    std::vector<RecoHadTau> hadTaus = hadTauReader->read();
-    std::vector<const RecoHadTau*> hadTau_ptrs = convert_to_ptrs(hadTaus);
-    std::vector<const RecoHadTau*> cleanedHadTaus = hadTauCleaner(hadTau_ptrs, selMuons, selElectrons);
-    std::vector<const RecoHadTau*> selHadTaus = hadTauSelector(cleanedHadTaus);
-    
-//--- build collections of jets and select subset of jets passing b-tagging criteria
-    std::vector<RecoJet> jets = jetReader->read();
-    std::vector<const RecoJet*> jet_ptrs = convert_to_ptrs(jets);
-    std::vector<const RecoJet*> cleanedJets = jetCleaner(jet_ptrs, selMuons, selElectrons, selHadTaus);
-    std::vector<const RecoJet*> selJets = jetSelector(cleanedJets);
-    std::vector<const RecoJet*> selBJets_loose = jetSelectorBtagLoose(cleanedJets);
-    std::vector<const RecoJet*> selBJets_medium = jetSelectorBtagMedium(cleanedJets);
+//    (the first selection stage is applied to views on the branch buffers, 
+//     so that RecoMuon, RecoElectron and RecoHadTau objects are built only for the particles passing it)
+      muonReader->readView(muonView);
+      preselMuonSelector(muonView, preselMuonIndices);
+      muonReader->read(preselMuonIndices, muons);
+      convert_to_ptrs(muons, muon_ptrs);
+      std::vector<const RecoMuon*>& cleanedMuons = muon_ptrs; // CV: no cleaning needed for muons, as they have the highest priority in the overlap removal
+      std::vector<const RecoMuon*>& preselMuons = cleanedMuons; // CV: preselection already applied to muonView
+      muonSelector(preselMuons, muonSelection);
+      muonSelection.filter(kSelectionFakeable, fakeableMuons);
+      muonSelection.filter(kSelectionTight, tightMuons);
+      const std::vector<const RecoMuon*>* selMuons_ptr = 0;
+      if      ( leptonSelection == kLoose    ) selMuons_ptr = &preselMuons;
+      else if ( leptonSelection == kFakeable ) selMuons_ptr = &fakeableMuons;
+      else if ( leptonSelection == kTight    ) selMuons_ptr = &tightMuons;
+      else assert(0);
+      const std::vector<const RecoMuon*>& selMuons = (*selMuons_ptr);
+
+      electronReader->readView(electronView);
+      preselElectronSelector(electronView, preselElectronIndices);
+      electronReader->read(preselElectronIndices, electrons);
+      convert_to_ptrs(electrons, electron_ptrs);
+      electronCleaner.clean(electron_ptrs, cleanedElectrons, selMuons);
+      std::vector<const RecoElectron*>& preselElectrons = cleanedElectrons; // CV: preselection already applied to electronView
+      electronSelector(preselElectrons, electronSelection);
+      electronSelection.filter(kSelectionFakeable, fakeableElectrons);
+      electronSelection.filter(kSelectionTight, tightElectrons);
+      const std::vector<const RecoElectron*>* selElectrons_ptr = 0;
+      if      ( leptonSelection == kLoose    ) selElectrons_ptr = &preselElectrons;
+      else if ( leptonSelection == kFakeable ) selElectrons_ptr = &fakeableElectrons;
+      else if ( leptonSelection == kTight    ) selElectrons_ptr = &tightElectrons;
+      else assert(0);
+      const std::vector<const RecoElectron*>& selElectrons = (*selElectrons_ptr);
+
+      hadTauReader->readView(hadTauView);
+      hadTauSelector(hadTauView, selHadTauIndices);
+      hadTauReader->read(selHadTauIndices, hadTaus);
+      convert_to_ptrs(hadTaus, hadTau_ptrs);
+      hadTauCleaner.clean(hadTau_ptrs, cleanedHadTaus, selMuons, selElectrons);
+      std::vector<const RecoHadTau*>& selHadTaus = cleanedHadTaus; // CV: selection already applied to hadTauView
+
+//--- write event to skim;
+//    the preselected electrons and the hadronic taus depend on leptonSelection via the overlap removal,
+//    so the event is written in case it passes the preselection for any choice of leptonSelection,
+//    in order for the skim to be usable for re-running the analysis with a different leptonSelection
+//    (the requirements on jets depend on the systematic shift and are not applied to the skim)
+      if ( skimWriter ) {
+        bool passesPreselection_skim = false;
+        for ( int leptonSelection_skim = kLoose; leptonSelection_skim <= kTight && !passesPreselection_skim; ++leptonSelection_skim ) {
+          const std::vector<const RecoMuon*>* selMuons_skim = 0;
+          if      ( leptonSelection_skim == kLoose    ) selMuons_skim = &preselMuons;
+          else if ( leptonSelection_skim == kFakeable ) selMuons_skim = &fakeableMuons;
+          else                                          selMuons_skim = &tightMuons;
+          electronCleaner.clean(electron_ptrs, preselElectrons_skim, *selMuons_skim);
+          if ( leptonSelection_skim == kLoose ) {
+            selElectrons_skim = preselElectrons_skim;
+          } else {
+            electronSelector(preselElectrons_skim, electronSelection_skim);
+            electronSelection_skim.filter(( leptonSelection_skim == kFakeable ) ? kSelectionFakeable : kSelectionTight, selElectrons_skim);
+          }
+          hadTauCleaner.clean(hadTau_ptrs, selHadTaus_skim, *selMuons_skim, selElectrons_skim);
+          // CV: same requirements as in the preselection below
+          int numElectrons = preselElectrons_skim.size();
+          int numMuons = preselMuons.size();
+          bool failsTriggerMatch_skim = false;
+          if ( numElectrons == 2                  && !(selTrigger_1e  || selTrigger_2e)                      ) failsTriggerMatch_skim = true;
+          if (                       numMuons == 2 && !(selTrigger_1mu || selTrigger_2mu)                     ) failsTriggerMatch_skim = true;
+          if ( numElectrons == 1 && numMuons == 1 && !(selTrigger_1e  || selTrigger_1mu || selTrigger_1e1mu) ) failsTriggerMatch_skim = true;
+          if ( numElectrons + numMuons == 2 && !failsTriggerMatch_skim && selHadTaus_skim.size() == 1 ) passesPreselection_skim = true;
+        }
+        if ( passesPreselection_skim ) skimWriter->fill();
+      }
+
+//--- apply preselection
+      preselLeptons.clear();
+      preselLeptons.insert(preselLeptons.end(), preselElectrons.begin(), preselElectrons.end());
+      preselLeptons.insert(preselLeptons.end(), preselMuons.begin(), preselMuons.end());
+      std::sort(preselLeptons.begin(), preselLeptons.end(), isHigherPt);
+      // require exactly two leptons passing loose preselection criteria
+      if ( !cutFlow(cut_preselLeptons, preselLeptons.size() == 2, lumiScale) ) continue;
+      const RecoLepton* preselLepton_lead = preselLeptons[0];
+      int preselLepton_lead_type = getLeptonType(preselLepton_lead->pdgId_);
+      const RecoLepton* preselLepton_sublead = preselLeptons[1];
+      int preselLepton_sublead_type = getLeptonType(preselLepton_sublead->pdgId_);
+
+      // require exactly two preselected leptons to avoid overlap with 3l category
+      if ( !cutFlow(cut_preselLeptons_3l, preselElectrons.size() + preselMuons.size() == 2, lumiScale) ) continue;
+
+      // require that trigger paths match event category (with event category based on preselLeptons);
+      bool failsTriggerMatch_presel = false;
+      if ( preselElectrons.size() == 2                            && !(selTrigger_1e  || selTrigger_2e)                      ) failsTriggerMatch_presel = true;
+      if (                                preselMuons.size() == 2 && !(selTrigger_1mu || selTrigger_2mu)                     ) failsTriggerMatch_presel = true;
+      if ( preselElectrons.size() == 1 && preselMuons.size() == 1 && !(selTrigger_1e  || selTrigger_1mu || selTrigger_1e1mu) ) failsTriggerMatch_presel = true;
+      if ( !cutFlow(cut_preselLeptons_trigger, !failsTriggerMatch_presel, lumiScale) ) continue;
+
+      // apply requirement on hadronic taus on preselection level
+      if ( !cutFlow(cut_preselHadTaus, selHadTaus.size() == 1, lumiScale) ) continue;
 
 //--- build collections of generator level particles
-    std::vector<GenLepton> genLeptons;
-    std::vector<GenLepton> genElectrons;
-    std::vector<GenLepton> genMuons;
-    std::vector<GenHadTau> genHadTaus;
-    std::vector<GenJet> genJets;
-    if ( isMC ) {
-      genLeptons = genLeptonReader->read();
-      for ( std::vector<GenLepton>::const_iterator genLepton = genLeptons.begin();
-	    genLepton != genLeptons.end(); ++genLepton ) {
-	int abs_pdgId = std::abs(genLepton->pdgId_);
-	if      ( abs_pdgId == 11 ) genElectrons.push_back(*genLepton);
-	else if ( abs_pdgId == 13 ) genMuons.push_back(*genLepton);
+      if ( isMC ) {
+        genLeptonReader->read(genLeptons);
+        genHadTauReader->read(genHadTaus);
+        genJetReader->read(genJets);
       }
-      genHadTaus = genHadTauReader->read();
-      genJets = genJetReader->read();
-    }
 
-//--- match reconstructed to generator level particles
-    if ( isMC ) {
-      muonGenMatcher.addGenLeptonMatch(preselMuons, genLeptons, 0.3);
-      muonGenMatcher.addGenHadTauMatch(preselMuons, genHadTaus, 0.3);
-      muonGenMatcher.addGenJetMatch(preselMuons, genJets, 0.5);
+//--- match reconstructed to generator level particles;
+//    the matches for muons, electrons and hadronic taus are computed in one pass
+      genMatchTable.clear();
+      if ( isMC ) {
+        genMatchTable.setGenParticles(genLeptons, genHadTaus, genJets);
+        genMatchTable.addRecParticles(muons, preselMuons);
+        genMatchTable.addRecParticles(electrons, preselElectrons);
+        genMatchTable.addRecParticles(hadTaus, selHadTaus);
+        genMatchTable.computeGenMatches();
+      }
 
-      electronGenMatcher.addGenLeptonMatch(preselElectrons, genLeptons, 0.3);
-      electronGenMatcher.addGenHadTauMatch(preselElectrons, genHadTaus, 0.3);
-      electronGenMatcher.addGenJetMatch(preselElectrons, genJets, 0.5);
+//--- process systematic shifts affecting jets, one group of shifts that differ in the b-tagging weights only at a time;
+//    everything above this point does not depend on the shift and is computed only once per event
+      for ( size_t idxShiftGroup = 0; idxShiftGroup < numShiftGroups; ++idxShiftGroup ) {
+        const std::vector<size_t>& shiftGroup = shiftGroups[idxShiftGroup];
+        size_t idxShift = shiftGroup.front();
+        histManagers_2lss_1tau* histManagers = histManagers_shifts[idxShiftGroup];
 
-      hadTauGenMatcher.addGenLeptonMatch(selHadTaus, genLeptons, 0.3);
-      hadTauGenMatcher.addGenHadTauMatch(selHadTaus, genHadTaus, 0.3);
-      hadTauGenMatcher.addGenJetMatch(selHadTaus, genJets, 0.5);
+        // CV: count events in the cut-flow table for the first systematic shift only
+        cutFlow.setActive(idxShift == 0);
 
-      jetGenMatcher.addGenLeptonMatch(selJets, genLeptons, 0.3);
-      jetGenMatcher.addGenHadTauMatch(selJets, genHadTaus, 0.3);
-      jetGenMatcher.addGenJetMatch(selJets, genJets, 0.5);
-    }
+//--- build collections of jets and select subset of jets passing b-tagging criteria
+        jetReader->read(jetPt_options[idxShift], jet_btagWeight_branches[idxShift], jets);
+        convert_to_ptrs(jets, jet_ptrs);
+        jetCleaner.clean(jet_ptrs, cleanedJets, selMuons, selElectrons, selHadTaus);
+        jetSelector(cleanedJets, selJets);
+        jetSelectorBtagLoose(cleanedJets, selBJets_loose);
+        jetSelectorBtagMedium(cleanedJets, selBJets_medium);
+
+        if ( isMC ) {
+          genMatchTable.addRecParticles(jets, selJets);
+          genMatchTable.computeGenMatches();
+        }
 
-//--- apply preselection
-    std::vector<const RecoLepton*> preselLeptons;    
-    preselLeptons.reserve(preselElectrons.size() + preselMuons.size());
-    preselLeptons.insert(preselLeptons.end(), preselElectrons.begin(), preselElectrons.end());
-    preselLeptons.insert(preselLeptons.end(), preselMuons.begin(), preselMuons.end());
-    std::sort(preselLeptons.begin(), preselLeptons.end(), isHigherPt);
-    // require exactly two leptons passing loose preselection criteria
-    if ( !(preselLeptons.size() == 2) ) continue;
-    const RecoLepton* preselLepton_lead = preselLeptons[0];
-    int preselLepton_lead_type = getLeptonType(preselLepton_lead->pdgId_);
-    const RecoLepton* preselLepton_sublead = preselLeptons[1];
-    int preselLepton_sublead_type = getLeptonType(preselLepton_sublead->pdgId_);
-
-    // require exactly two preselected leptons to avoid overlap with 3l category
-    if ( !(preselElectrons.size() + preselMuons.size() == 2) ) continue;
-
-    // require that trigger paths match event category (with event category based on preselLeptons);
-    if ( preselElectrons.size() == 2                            && !(selTrigger_1e  || selTrigger_2e)                      ) continue;
-    if (                                preselMuons.size() == 2 && !(selTrigger_1mu || selTrigger_2mu)                     ) continue;
-    if ( preselElectrons.size() == 1 && preselMuons.size() == 1 && !(selTrigger_1e  || selTrigger_1mu || selTrigger_1e1mu) ) continue;
-
-    // apply requirement on jets (incl. b-tagged jets) and hadronic taus on preselection level
-    if ( !(selJets.size() >= 2) ) continue;
-    if ( !(selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1) ) continue;
-    if ( !(selHadTaus.size() == 1) ) continue;
+        // apply requirement on jets (incl. b-tagged jets) on preselection level
+        if ( !cutFlow(cut_preselJets, selJets.size() >= 2, lumiScale) ) continue;
+        if ( !cutFlow(cut_preselBJets, selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1, lumiScale) ) continue;
 
 //--- compute MHT and linear MET discriminant (met_LD)
-    LV mht_p4(0,0,0,0);
-    for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
-	  jet != selJets.end(); ++jet ) {
-      mht_p4 += (*jet)->p4_;
-    }
-    for ( std::vector<const RecoLepton*>::const_iterator lepton = preselLeptons.begin();
-	  lepton != preselLeptons.end(); ++lepton ) {
-      mht_p4 += (*lepton)->p4_;
-    }
-    for ( std::vector<const RecoHadTau*>::const_iterator hadTau = selHadTaus.begin();
-	  hadTau != selHadTaus.end(); ++hadTau ) {
-      mht_p4 += (*hadTau)->p4_;
-    }
-    double met_LD = met_coef*met_p4.pt() + mht_coef*mht_p4.pt();    
+        LV mht_p4(0,0,0,0);
+        for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
+	      jet != selJets.end(); ++jet ) {
+          mht_p4 += (*jet)->p4();
+        }
+        for ( std::vector<const RecoLepton*>::const_iterator lepton = preselLeptons.begin();
+	      lepton != preselLeptons.end(); ++lepton ) {
+          mht_p4 += (*lepton)->p4();
+        }
+        for ( std::vector<const RecoHadTau*>::const_iterator hadTau = selHadTaus.begin();
+	      hadTau != selHadTaus.end(); ++hadTau ) {
+          mht_p4 += (*hadTau)->p4();
+        }
+        double met_LD = met_coef*met_p4.pt() + mht_coef*mht_p4.pt();    
 
 //--- compute event-level weight for data/MC correction of b-tagging efficiency and mistag rate
 //   (using the method "Event reweighting using scale factors calculated with a tag and probe method", 
 //    described on the BTV POG twiki https://twiki.cern.ch/twiki/bin/view/CMS/BTagShapeCalibration )
-    double evtWeight = lumiScale;
-    for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
-	  jet != selJets.end(); ++jet ) {
-      evtWeight *= (*jet)->BtagWeight_;
-    }
+//    for each shift in the group; the histograms of each shift are filled with evtWeight times the b-tagging weight of that shift,
+//    while evtWeight holds the part of the event weight that is common to all shifts in the group
+        for ( size_t idxShift_group = 0; idxShift_group < shiftGroup.size(); ++idxShift_group ) {
+          const Float_t* jet_btagWeights_shift = jetReader->getBtagWeights(jet_btagWeight_branches[shiftGroup[idxShift_group]]);
+          double btagWeight_shift = 1.;
+          for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
+		jet != selJets.end(); ++jet ) {
+            btagWeight_shift *= jet_btagWeights_shift[(*jet)->idx_];
+          }
+          histManagers->btagWeights_[idxShift_group] = btagWeight_shift;
+        }
+        // CV: b-tagging weight of the first shift in the group, used for the cut-flow table and the number of weighted events
+        double btagWeight = histManagers->btagWeights_[0];
+        double evtWeight = lumiScale;
 
 //--- apply data/MC corrections for trigger efficiency,
 //    and efficiencies for lepton to pass loose identification and isolation criteria
-    if ( isMC ) {
-      evtWeight *= sf_triggerEff(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
-      evtWeight *= sf_leptonID_and_Iso_loose(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
-    }
+        if ( isMC ) {
+          evtWeight *= sf_triggerEff(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
+          evtWeight *= sf_leptonID_and_Iso_loose(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
+        }
 
-    double evtWeight_pp = evtWeight;
-    double evtWeight_mm = evtWeight;
-    if ( chargeSelection == kOS ) {
-      double prob_chargeMisId_lead = prob_chargeMisId(getLeptonType(preselLepton_lead->pdgId_), preselLepton_lead->pt_, preselLepton_lead->eta_);
-      double prob_chargeMisId_sublead = prob_chargeMisId(getLeptonType(preselLepton_sublead->pdgId_), preselLepton_sublead->pt_, preselLepton_sublead->eta_);
+        double evtWeight_pp = evtWeight;
+        double evtWeight_mm = evtWeight;
+        if ( chargeSelection == kOS ) {
+          double prob_chargeMisId_lead = prob_chargeMisId(getLeptonType(preselLepton_lead->pdgId_), preselLepton_lead->pt_, preselLepton_lead->eta_);
+          double prob_chargeMisId_sublead = prob_chargeMisId(getLeptonType(preselLepton_sublead->pdgId_), preselLepton_sublead->pt_, preselLepton_sublead->eta_);
 
-      evtWeight *= ( prob_chargeMisId_lead + prob_chargeMisId_sublead);
+          evtWeight *= ( prob_chargeMisId_lead + prob_chargeMisId_sublead);
 
-      if ( preselLepton_lead->charge_ < 0 && preselLepton_sublead->charge_ > 0 ) {
-	evtWeight_pp *= prob_chargeMisId_lead;
-	evtWeight_mm *= prob_chargeMisId_sublead;
-      }
-      if ( preselLepton_lead->charge_ > 0 && preselLepton_sublead->charge_ < 0 ) {
-	evtWeight_pp *= prob_chargeMisId_sublead;
-	evtWeight_mm *= prob_chargeMisId_lead;
-      }
-    } 
+          if ( preselLepton_lead->charge_ < 0 && preselLepton_sublead->charge_ > 0 ) {
+	    evtWeight_pp *= prob_chargeMisId_lead;
+	    evtWeight_mm *= prob_chargeMisId_sublead;
+          }
+          if ( preselLepton_lead->charge_ > 0 && preselLepton_sublead->charge_ < 0 ) {
+	    evtWeight_pp *= prob_chargeMisId_sublead;
+	    evtWeight_mm *= prob_chargeMisId_lead;
+          }
+        } 
 
 //--- compute output of BDTs used to discriminate ttH vs. ttV and ttH vs. ttbar 
 //    in 2lss_1tau category of ttH multilepton analysis 
-    mvaInputs["max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))"] = std::max(std::fabs(preselLepton_lead->eta_), std::fabs(preselLepton_sublead->eta_));
-    mvaInputs["MT_met_lep1"]                = comp_MT_met_lep1(*preselLepton_lead, met_pt, met_phi);
-    mvaInputs["nJet25_Recl"]                = comp_n_jet25_recl(selJets);
-    mvaInputs["mindr_lep1_jet"]             = comp_mindr_lep1_jet(*preselLepton_lead, selJets);
-    mvaInputs["mindr_lep2_jet"]             = comp_mindr_lep2_jet(*preselLepton_sublead, selJets);
-    mvaInputs["LepGood_conePt[iF_Recl[0]]"] = comp_lep1_conePt(*preselLepton_lead);
-    mvaInputs["LepGood_conePt[iF_Recl[1]]"] = comp_lep2_conePt(*preselLepton_sublead);
-    mvaInputs["min(met_pt,400)"]            = std::min(met_pt, (Float_t)400.);
-    mvaInputs["avg_dr_jet"]                 = comp_avg_dr_jet(selJets);
-
-    double mvaOutput_2lss_ttV = mva_2lss_ttV(mvaInputs);
-    double mvaOutput_2lss_ttbar = mva_2lss_ttbar(mvaInputs);
+        mvaInputs[kMVAInput_2lss_max_lep_eta]    = std::max(std::fabs(preselLepton_lead->eta_), std::fabs(preselLepton_sublead->eta_));
+        mvaInputs[kMVAInput_2lss_MT_met_lep1]    = comp_MT_met_lep1(*preselLepton_lead, met_pt, met_phi);
+        mvaInputs[kMVAInput_2lss_nJet25_Recl]    = comp_n_jet25_recl(selJets);
+        mvaInputs[kMVAInput_2lss_mindr_lep1_jet] = comp_mindr_lep1_jet(*preselLepton_lead, selJets);
+        mvaInputs[kMVAInput_2lss_mindr_lep2_jet] = comp_mindr_lep2_jet(*preselLepton_sublead, selJets);
+        mvaInputs[kMVAInput_2lss_lep1_conePt]    = comp_lep1_conePt(*preselLepton_lead);
+        mvaInputs[kMVAInput_2lss_lep2_conePt]    = comp_lep2_conePt(*preselLepton_sublead);
+        mvaInputs[kMVAInput_2lss_met_pt]         = std::min(met_pt, (Float_t)400.);
+        mvaInputs[kMVAInput_2lss_avg_dr_jet]     = comp_avg_dr_jet(selJets);
+
+        double mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar;
+        const double* mvaOutputs_cached = mvaOutputCache.find(run, lumi, event, mvaInputs);
+        if ( mvaOutputs_cached ) {
+          mvaOutput_2lss_ttV = mvaOutputs_cached[kMVAOutput_2lss_ttV];
+          mvaOutput_2lss_ttbar = mvaOutputs_cached[kMVAOutput_2lss_ttbar];
+        } else {
+          mvaOutput_2lss_ttV = mva_2lss_ttV(mvaInputs);
+          mvaOutput_2lss_ttbar = mva_2lss_ttbar(mvaInputs);
+          double mvaOutputs[kNumMVAOutputs_2lss];
+          mvaOutputs[kMVAOutput_2lss_ttV] = mvaOutput_2lss_ttV;
+          mvaOutputs[kMVAOutput_2lss_ttbar] = mvaOutput_2lss_ttbar;
+          mvaOutputCache.insert(run, lumi, event, mvaInputs, mvaOutputs);
+        }
 
 //--- compute integer discriminant based on both BDT outputs,
 //    as defined in Table X of AN-2015/321
-    Double_t mvaDiscr_2lss = -1;
-    if      ( mvaOutput_2lss_ttbar > +0.3 && mvaOutput_2lss_ttV >  -0.1 ) mvaDiscr_2lss = 6.;
-    else if ( mvaOutput_2lss_ttbar > +0.3 && mvaOutput_2lss_ttV <= -0.1 ) mvaDiscr_2lss = 5.;
-    else if ( mvaOutput_2lss_ttbar > -0.2 && mvaOutput_2lss_ttV >  -0.1 ) mvaDiscr_2lss = 4.;
-    else if ( mvaOutput_2lss_ttbar > -0.2 && mvaOutput_2lss_ttV <= -0.1 ) mvaDiscr_2lss = 3.;
-    else if (                                mvaOutput_2lss_ttV >  -0.1 ) mvaDiscr_2lss = 2.;
-    else                                                                  mvaDiscr_2lss = 1.;
+        Double_t mvaDiscr_2lss = -1;
+        if      ( mvaOutput_2lss_ttbar > +0.3 && mvaOutput_2lss_ttV >  -0.1 ) mvaDiscr_2lss = 6.;
+        else if ( mvaOutput_2lss_ttbar > +0.3 && mvaOutput_2lss_ttV <= -0.1 ) mvaDiscr_2lss = 5.;
+        else if ( mvaOutput_2lss_ttbar > -0.2 && mvaOutput_2lss_ttV >  -0.1 ) mvaDiscr_2lss = 4.;
+        else if ( mvaOutput_2lss_ttbar > -0.2 && mvaOutput_2lss_ttV <= -0.1 ) mvaDiscr_2lss = 3.;
+        else if (                                mvaOutput_2lss_ttV >  -0.1 ) mvaDiscr_2lss = 2.;
+        else                                                                  mvaDiscr_2lss = 1.;
 
 //--- fill histograms with events passing preselection
-    preselMuonHistManager.fillHistograms(preselMuons, evtWeight);
-    preselElectronHistManager.fillHistograms(preselElectrons, evtWeight);
-    preselHadTauHistManager.fillHistograms(selHadTaus, evtWeight);
-    preselJetHistManager.fillHistograms(selJets, evtWeight);
-    selBJet_looseHistManager.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_mediumHistManager.fillHistograms(selBJets_medium, evtWeight);
-    preselMEtHistManager.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
-    preselEvtHistManager.fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight);
+        histManagers->preselMuonHistManager_.fillHistograms(preselMuons, genMatchTable, evtWeight);
+        histManagers->preselElectronHistManager_.fillHistograms(preselElectrons, genMatchTable, evtWeight);
+        histManagers->preselHadTauHistManager_.fillHistograms(selHadTaus, genMatchTable, evtWeight);
+        histManagers->preselJetHistManager_.fillHistograms(selJets, genMatchTable, evtWeight);
+        histManagers->selBJet_looseHistManager_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+        histManagers->selBJet_mediumHistManager_.fillHistograms(selBJets_medium, genMatchTable, evtWeight);
+        histManagers->preselMEtHistManager_.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
+        histManagers->preselEvtHistManager_.fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight);
 
 //--- apply final event selection 
-    std::vector<const RecoLepton*> selLeptons;    
-    selLeptons.reserve(selElectrons.size() + selMuons.size());
-    selLeptons.insert(selLeptons.end(), selElectrons.begin(), selElectrons.end());
-    selLeptons.insert(selLeptons.end(), selMuons.begin(), selMuons.end());
-    std::sort(selLeptons.begin(), selLeptons.end(), isHigherPt);
-    // require exactly two leptons passing tight selection criteria of final event selection 
-    if ( !(selLeptons.size() == 2) ) continue;
-    const RecoLepton* selLepton_lead = selLeptons[0];
-    const RecoLepton* selLepton_sublead = selLeptons[1];
-
-    // require that trigger paths match event category (with event category based on selLeptons);
-    if ( selElectrons.size() == 2 &&                         !(selTrigger_1e  || selTrigger_2e)                       ) continue;
-    if (                             selMuons.size() == 2 && !(selTrigger_1mu || selTrigger_2mu)                      ) continue;
-    if ( selElectrons.size() == 1 && selMuons.size() == 1 && !(selTrigger_1e  || selTrigger_1mu || selTrigger_1e1mu) ) continue;
-
-    // apply requirement on jets (incl. b-tagged jets) and hadronic taus on level of final event selection
-    if ( !(selJets.size() >= 4) ) continue;
-    if ( !(selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1) ) continue;
-    if ( !(selHadTaus.size() == 1) ) continue;
-     
-    bool failsLowMassVeto = false;
-    for ( std::vector<const RecoLepton*>::const_iterator lepton1 = selLeptons.begin();
-	  lepton1 != selLeptons.end(); ++lepton1 ) {
-      for ( std::vector<const RecoLepton*>::const_iterator lepton2 = lepton1 + 1;
-	    lepton2 != selLeptons.end(); ++lepton2 ) {
-	if ( ((*lepton1)->p4_ + (*lepton2)->p4_).mass() < 12. ) {
-	  failsLowMassVeto = true;
-	}
-      }
-    }
-    if ( failsLowMassVeto ) continue;
-
-    double minPt_lead = 20.;
-    double minPt_sublead = selLepton_sublead->is_electron() ? 15. : 10.;
-    if ( !(selLepton_lead->pt_ > minPt_lead && selLepton_sublead->pt_ > minPt_sublead) ) continue;
-
-    bool isCharge_SS = selLepton_lead->charge_*selLepton_sublead->charge_ > 0;
-    bool isCharge_OS = selLepton_lead->charge_*selLepton_sublead->charge_ < 0;
-    if ( chargeSelection == kOS && isCharge_SS ) continue;
-    if ( chargeSelection == kSS && isCharge_OS ) continue;
-
-    if ( selLepton_lead->is_electron() && selLepton_sublead->is_electron() ) {
-      bool failsZbosonMassVeto = false;
-      for ( std::vector<const RecoLepton*>::const_iterator lepton1 = selLeptons.begin();
-	    lepton1 != selLeptons.end(); ++lepton1 ) {
-	for ( std::vector<const RecoLepton*>::const_iterator lepton2 = lepton1 + 1;
-	      lepton2 != selLeptons.end(); ++lepton2 ) {
-	  if ( std::fabs(((*lepton1)->p4_ + (*lepton2)->p4_).mass() - z_mass) < z_window ) {
-	    failsZbosonMassVeto = true;
-	  }
-	}
-      }
-      if ( failsZbosonMassVeto ) continue;
-
-      if ( met_LD < 0.2 ) continue;
-    }
+        selLeptons.clear();
+        selLeptons.insert(selLeptons.end(), selElectrons.begin(), selElectrons.end());
+        selLeptons.insert(selLeptons.end(), selMuons.begin(), selMuons.end());
+        std::sort(selLeptons.begin(), selLeptons.end(), isHigherPt);
+        // require exactly two leptons passing tight selection criteria of final event selection 
+        if ( !cutFlow(cut_selLeptons, selLeptons.size() == 2, evtWeight*btagWeight) ) continue;
+        const RecoLepton* selLepton_lead = selLeptons[0];
+        const RecoLepton* selLepton_sublead = selLeptons[1];
+
+        // require that trigger paths match event category (with event category based on selLeptons);
+        bool failsTriggerMatch_sel = false;
+        if ( selElectrons.size() == 2 &&                         !(selTrigger_1e  || selTrigger_2e)                       ) failsTriggerMatch_sel = true;
+        if (                             selMuons.size() == 2 && !(selTrigger_1mu || selTrigger_2mu)                      ) failsTriggerMatch_sel = true;
+        if ( selElectrons.size() == 1 && selMuons.size() == 1 && !(selTrigger_1e  || selTrigger_1mu || selTrigger_1e1mu) ) failsTriggerMatch_sel = true;
+        if ( !cutFlow(cut_selLeptons_trigger, !failsTriggerMatch_sel, evtWeight*btagWeight) ) continue;
+
+        // apply requirement on jets (incl. b-tagged jets) and hadronic taus on level of final event selection
+        if ( !cutFlow(cut_selJets, selJets.size() >= 4, evtWeight*btagWeight) ) continue;
+        if ( !cutFlow(cut_selBJets, selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1, evtWeight*btagWeight) ) continue;
+        if ( !cutFlow(cut_selHadTaus, selHadTaus.size() == 1, evtWeight*btagWeight) ) continue;
+
+        bool failsLowMassVeto = false;
+        for ( std::vector<const RecoLepton*>::const_iterator lepton1 = selLeptons.begin();
+	      lepton1 != selLeptons.end(); ++lepton1 ) {
+          for ( std::vector<const RecoLepton*>::const_iterator lepton2 = lepton1 + 1;
+		lepton2 != selLeptons.end(); ++lepton2 ) {
+	    if ( ((*lepton1)->p4() + (*lepton2)->p4()).mass() < 12. ) {
+	      failsLowMassVeto = true;
+	    }
+          }
+        }
+        if ( !cutFlow(cut_lowMassVeto, !failsLowMassVeto, evtWeight*btagWeight) ) continue;
+
+        double minPt_lead = 20.;
+        double minPt_sublead = selLepton_sublead->is_electron() ? 15. : 10.;
+        if ( !cutFlow(cut_leptonPt, selLepton_lead->pt_ > minPt_lead && selLepton_sublead->pt_ > minPt_sublead, evtWeight*btagWeight) ) continue;
+
+        bool isCharge_SS = selLepton_lead->charge_*selLepton_sublead->charge_ > 0;
+        bool isCharge_OS = selLepton_lead->charge_*selLepton_sublead->charge_ < 0;
+        bool failsChargeSelection = (chargeSelection == kOS && isCharge_SS) || (chargeSelection == kSS && isCharge_OS);
+        if ( !cutFlow(cut_charge, !failsChargeSelection, evtWeight*btagWeight) ) continue;
+
+        bool isElectronPair = selLepton_lead->is_electron() && selLepton_sublead->is_electron();
+        bool failsZbosonMassVeto = false;
+        if ( isElectronPair ) {
+          for ( std::vector<const RecoLepton*>::const_iterator lepton1 = selLeptons.begin();
+		lepton1 != selLeptons.end(); ++lepton1 ) {
+	    for ( std::vector<const RecoLepton*>::const_iterator lepton2 = lepton1 + 1;
+		  lepton2 != selLeptons.end(); ++lepton2 ) {
+	      if ( std::fabs(((*lepton1)->p4() + (*lepton2)->p4()).mass() - z_mass) < z_window ) {
+		failsZbosonMassVeto = true;
+	      }
+	    }
+          }
+        }
+        if ( !cutFlow(cut_ZbosonMassVeto, !failsZbosonMassVeto, evtWeight*btagWeight) ) continue;
+        if ( !cutFlow(cut_metLD, !(isElectronPair && met_LD < 0.2), evtWeight*btagWeight) ) continue;
 
-    if ( leptonSelection == kFakeable && (tightMuons.size() + tightElectrons.size()) >= 2 ) continue; // CV: avoid overlap with signal region
+        // CV: avoid overlap with signal region
+        if ( !cutFlow(cut_tightLeptonVeto, !(leptonSelection == kFakeable && (tightMuons.size() + tightElectrons.size()) >= 2), evtWeight*btagWeight) ) continue;
 
 //--- apply data/MC corrections for efficiencies of leptons passing the loose identification and isolation criteria
 //    to also pass the tight identification and isolation criteria
-    if ( isMC ) {
-      double sf_tight_to_loose = 1.;
-      if ( leptonSelection == kFakeable ) {
-	sf_tight_to_loose = sf_leptonID_and_Iso_fakeable_to_loose(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
-      } else if ( leptonSelection == kTight ) {
-	sf_tight_to_loose = sf_leptonID_and_Iso_tight_to_loose(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
-      }
-      evtWeight *= sf_tight_to_loose;
-      evtWeight_pp *= sf_tight_to_loose;
-      evtWeight_mm *= sf_tight_to_loose;
-    }
+        if ( isMC ) {
+          double sf_tight_to_loose = 1.;
+          if ( leptonSelection == kFakeable ) {
+	    sf_tight_to_loose = sf_leptonID_and_Iso_fakeable_to_loose(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
+          } else if ( leptonSelection == kTight ) {
+	    sf_tight_to_loose = sf_leptonID_and_Iso_tight_to_loose(preselLepton_lead_type, preselLepton_lead->pt_, preselLepton_lead->eta_, preselLepton_sublead_type, preselLepton_sublead->pt_, preselLepton_sublead->eta_);
+          }
+          evtWeight *= sf_tight_to_loose;
+          evtWeight_pp *= sf_tight_to_loose;
+          evtWeight_mm *= sf_tight_to_loose;
+        }
 
-    if ( leptonSelection == kFakeable ) {
-      TH2* lutFakeRate_lead = 0;
-      if      ( std::abs(selLepton_lead->pdgId_) == 11 ) lutFakeRate_lead = lutFakeRate_e;
-      else if ( std::abs(selLepton_lead->pdgId_) == 13 ) lutFakeRate_lead = lutFakeRate_mu;
-      assert(lutFakeRate_lead);
-      double prob_fake_lead = get_sf_from_TH2(lutFakeRate_lead, selLepton_lead->pt_, selLepton_lead->eta_);
-      TH2* lutFakeRate_sublead = 0;
-      if      ( std::abs(selLepton_sublead->pdgId_) == 11 ) lutFakeRate_sublead = lutFakeRate_e;
-      else if ( std::abs(selLepton_sublead->pdgId_) == 13 ) lutFakeRate_sublead = lutFakeRate_mu;
-      assert(lutFakeRate_sublead);
-      double prob_fake_sublead = get_sf_from_TH2(lutFakeRate_sublead, selLepton_sublead->pt_, selLepton_sublead->eta_);
-
-      bool passesTight_lead = isMatched(*selLepton_lead, tightElectrons) || isMatched(*selLepton_lead, tightMuons);
-      bool passesTight_sublead = isMatched(*selLepton_sublead, tightElectrons) || isMatched(*selLepton_sublead, tightMuons);
-
-      double evtWeight_tight_to_loose = 0.;
-      if      (  passesTight_lead && !passesTight_sublead ) evtWeight_tight_to_loose =  prob_fake_sublead/(1. - prob_fake_sublead);
-      else if ( !passesTight_lead &&  passesTight_sublead ) evtWeight_tight_to_loose =  prob_fake_lead/(1. - prob_fake_lead);
-      else if ( !passesTight_lead && !passesTight_sublead ) evtWeight_tight_to_loose = -prob_fake_lead*prob_fake_sublead/((1. - prob_fake_lead)*(1. - prob_fake_sublead));
-
-      evtWeight *= evtWeight_tight_to_loose;
-      evtWeight_pp *= evtWeight_tight_to_loose;
-      evtWeight_mm *= evtWeight_tight_to_loose;
-    }
+        if ( leptonSelection == kFakeable ) {
+          TH2* lutFakeRate_lead = 0;
+          if      ( std::abs(selLepton_lead->pdgId_) == 11 ) lutFakeRate_lead = lutFakeRate_e;
+          else if ( std::abs(selLepton_lead->pdgId_) == 13 ) lutFakeRate_lead = lutFakeRate_mu;
+          assert(lutFakeRate_lead);
+          double prob_fake_lead = get_sf_from_TH2(lutFakeRate_lead, selLepton_lead->pt_, selLepton_lead->eta_);
+          TH2* lutFakeRate_sublead = 0;
+          if      ( std::abs(selLepton_sublead->pdgId_) == 11 ) lutFakeRate_sublead = lutFakeRate_e;
+          else if ( std::abs(selLepton_sublead->pdgId_) == 13 ) lutFakeRate_sublead = lutFakeRate_mu;
+          assert(lutFakeRate_sublead);
+          double prob_fake_sublead = get_sf_from_TH2(lutFakeRate_sublead, selLepton_sublead->pt_, selLepton_sublead->eta_);
+
+          bool passesTight_lead = isMatched(*selLepton_lead, tightElectrons) || isMatched(*selLepton_lead, tightMuons);
+          bool passesTight_sublead = isMatched(*selLepton_sublead, tightElectrons) || isMatched(*selLepton_sublead, tightMuons);
+
+          double evtWeight_tight_to_loose = 0.;
+          if      (  passesTight_lead && !passesTight_sublead ) evtWeight_tight_to_loose =  prob_fake_sublead/(1. - prob_fake_sublead);
+          else if ( !passesTight_lead &&  passesTight_sublead ) evtWeight_tight_to_loose =  prob_fake_lead/(1. - prob_fake_lead);
+          else if ( !passesTight_lead && !passesTight_sublead ) evtWeight_tight_to_loose = -prob_fake_lead*prob_fake_sublead/((1. - prob_fake_lead)*(1. - prob_fake_sublead));
+
+          evtWeight *= evtWeight_tight_to_loose;
+          evtWeight_pp *= evtWeight_tight_to_loose;
+          evtWeight_mm *= evtWeight_tight_to_loose;
+        }
 
 //--- fill histograms with events passing final selection 
-    selMuonHistManager.fillHistograms(selMuons, evtWeight);
-    selElectronHistManager.fillHistograms(selElectrons, evtWeight);
-    selHadTauHistManager.fillHistograms(selHadTaus, evtWeight);
-    selJetHistManager.fillHistograms(selJets, evtWeight);
-    selJetHistManager_lead.fillHistograms(selJets, evtWeight);
-    selJetHistManager_sublead.fillHistograms(selJets, evtWeight);
-    selBJet_looseHistManager.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_looseHistManager_lead.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_looseHistManager_sublead.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_mediumHistManager.fillHistograms(selBJets_medium, evtWeight);
-    selMEtHistManager.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
-    selEvtHistManager.fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight);
-    if(process_string != "data_obs") {
-      for ( const auto & kv: decayMode_idString ) {
-        if ( std::fabs(genHiggsDecayMode - kv.second) < EPS ) {
-          selEvtHistManager_decayMode[kv.first] -> fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight);
-          break;
+        histManagers->selMuonHistManager_.fillHistograms(selMuons, genMatchTable, evtWeight);
+        histManagers->selElectronHistManager_.fillHistograms(selElectrons, genMatchTable, evtWeight);
+        histManagers->selHadTauHistManager_.fillHistograms(selHadTaus, genMatchTable, evtWeight);
+        histManagers->selJetHistManager_.fillHistograms(selJets, genMatchTable, evtWeight);
+        histManagers->selJetHistManager_lead_.fillHistograms(selJets, genMatchTable, evtWeight);
+        histManagers->selJetHistManager_sublead_.fillHistograms(selJets, genMatchTable, evtWeight);
+        histManagers->selBJet_looseHistManager_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+        histManagers->selBJet_looseHistManager_lead_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+        histManagers->selBJet_looseHistManager_sublead_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+        histManagers->selBJet_mediumHistManager_.fillHistograms(selBJets_medium, genMatchTable, evtWeight);
+        histManagers->selMEtHistManager_.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
+        histManagers->selEvtHistManager_.fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight);
+        if(process_string != "data_obs") {
+          for ( const auto & kv: decayMode_idString ) {
+            if ( std::fabs(genHiggsDecayMode - kv.second) < EPS ) {
+              histManagers->selEvtHistManager_decayMode_[kv.first] -> fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight);
+              break;
+            }
+          }
+        }
+
+        bool isCharge_pp = selLepton_lead->pdgId_ < 0 && selLepton_sublead->pdgId_ < 0;
+        bool isCharge_mm = selLepton_lead->pdgId_ > 0 && selLepton_sublead->pdgId_ > 0;
+
+        // CV: events with leptons of opposite charge (chargeSelection = OS) are not assigned to any category
+        int category = getCategory_2lss_1tau(selElectrons.size(), selMuons.size(), isCharge_pp, isCharge_mm, selBJets_medium.size());
+        if ( category != kNoCategory_2lss_1tau ) {
+          double evtWeight_category = ( getCharge_2lss_1tau(category) > 0 ) ? evtWeight_pp : evtWeight_mm;
+          categoryHistManagers_2lss_1tau& histManagers_category = histManagers->selHistManagers_category_[category];
+          for ( std::vector<ElectronHistManager*>::iterator histManager = histManagers_category.selElectronHistManagers_.begin();
+		histManager != histManagers_category.selElectronHistManagers_.end(); ++histManager ) {
+            (*histManager)->fillHistograms(selElectrons, genMatchTable, evtWeight_category);
+          }
+          for ( std::vector<MuonHistManager*>::iterator histManager = histManagers_category.selMuonHistManagers_.begin();
+		histManager != histManagers_category.selMuonHistManagers_.end(); ++histManager ) {
+            (*histManager)->fillHistograms(selMuons, genMatchTable, evtWeight_category);
+          }
+          histManagers_category.selEvtHistManager_->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_category);
+        }
+
+        // CV: count each event only once, for the first systematic shift (the central value, unless configured otherwise)
+        if ( idxShift == 0 ) {
+          selEventsFile << run << ":" << lumi << ":" << event;
+
+          ++selectedEntries;
+          selectedEntries_weighted += evtWeight*btagWeight;
         }
       }
     }
 
-    bool isCharge_pp = selLepton_lead->pdgId_ < 0 && selLepton_sublead->pdgId_ < 0;
-    bool isCharge_mm = selLepton_lead->pdgId_ > 0 && selLepton_sublead->pdgId_ > 0;
-
-    int category = -1;
-    if      ( selElectrons.size() == 2 &&                         isCharge_pp && selBJets_medium.size() >= 1 ) category = k2epp_btight;
-    else if ( selElectrons.size() == 2 &&                         isCharge_pp                                ) category = k2epp_bloose;
-    else if ( selElectrons.size() == 2 &&                         isCharge_mm && selBJets_medium.size() >= 1 ) category = k2emm_btight;
-    else if ( selElectrons.size() == 2 &&                         isCharge_mm                                ) category = k2emm_bloose;
-    else if ( selElectrons.size() == 1 && selMuons.size() == 1 && isCharge_pp && selBJets_medium.size() >= 1 ) category = k1e1mupp_btight;
-    else if ( selElectrons.size() == 1 && selMuons.size() == 1 && isCharge_pp                                ) category = k1e1mupp_bloose;
-    else if ( selElectrons.size() == 1 && selMuons.size() == 1 && isCharge_mm && selBJets_medium.size() >= 1 ) category = k1e1mumm_btight;
-    else if ( selElectrons.size() == 1 && selMuons.size() == 1 && isCharge_mm                                ) category = k1e1mumm_bloose;
-    else if (                             selMuons.size() == 2 && isCharge_pp && selBJets_medium.size() >= 1 ) category = k2mupp_btight;
-    else if (                             selMuons.size() == 2 && isCharge_pp                                ) category = k2mupp_bloose;
-    else if (                             selMuons.size() == 2 && isCharge_mm && selBJets_medium.size() >= 1 ) category = k2mumm_btight;
-    else if (                             selMuons.size() == 2 && isCharge_mm                                ) category = k2mumm_bloose;
-    else assert(0);
-
-    if ( category == k2epp_btight ) {
-      selElectronHistManager_category["2epp_1tau_btight"]["leadElectron"]->fillHistograms(selElectrons, evtWeight_pp);
-      selElectronHistManager_category["2epp_1tau_btight"]["subleadElectron"]->fillHistograms(selElectrons, evtWeight_pp);
-      selEvtHistManager_category["2epp_1tau_btight"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_pp);
-    } else if ( category == k2epp_bloose ) {
-      selElectronHistManager_category["2epp_1tau_bloose"]["leadElectron"]->fillHistograms(selElectrons, evtWeight_pp);
-      selElectronHistManager_category["2epp_1tau_bloose"]["subleadElectron"]->fillHistograms(selElectrons, evtWeight_pp);
-      selEvtHistManager_category["2epp_1tau_bloose"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_pp);
-    } else if ( category == k2emm_btight ) {
-      selElectronHistManager_category["2emm_1tau_btight"]["leadElectron"]->fillHistograms(selElectrons, evtWeight_mm);
-      selElectronHistManager_category["2emm_1tau_btight"]["subleadElectron"]->fillHistograms(selElectrons, evtWeight_mm);
-      selEvtHistManager_category["2emm_1tau_btight"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_mm);
-    } else if ( category == k2emm_bloose ) {
-      selElectronHistManager_category["2emm_1tau_bloose"]["leadElectron"]->fillHistograms(selElectrons, evtWeight_mm);
-      selElectronHistManager_category["2emm_1tau_bloose"]["subleadElectron"]->fillHistograms(selElectrons, evtWeight_mm);
-      selEvtHistManager_category["2emm_1tau_bloose"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_mm);
-    } else if ( category == k1e1mupp_btight ) {
-      selElectronHistManager_category["1e1mupp_1tau_btight"]["electron"]->fillHistograms(selElectrons, evtWeight_pp);
-      selMuonHistManager_category["1e1mupp_1tau_btight"]["muon"]->fillHistograms(selMuons, evtWeight_pp);
-      selEvtHistManager_category["1e1mupp_1tau_btight"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_pp);
-    } else if ( category == k1e1mupp_bloose ) {
-      selElectronHistManager_category["1e1mupp_1tau_bloose"]["electron"]->fillHistograms(selElectrons, evtWeight_pp);
-      selMuonHistManager_category["1e1mupp_1tau_bloose"]["muon"]->fillHistograms(selMuons, evtWeight_pp);
-      selEvtHistManager_category["1e1mupp_1tau_bloose"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_pp);
-    } else if ( category == k1e1mumm_btight ) {
-      selElectronHistManager_category["1e1mumm_1tau_btight"]["electron"]->fillHistograms(selElectrons, evtWeight_mm);
-      selMuonHistManager_category["1e1mumm_1tau_btight"]["muon"]->fillHistograms(selMuons, evtWeight_mm);
-      selEvtHistManager_category["1e1mumm_1tau_btight"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_mm);
-    } else if ( category == k1e1mumm_bloose ) {
-      selElectronHistManager_category["1e1mumm_1tau_bloose"]["electron"]->fillHistograms(selElectrons, evtWeight_mm);
-      selMuonHistManager_category["1e1mumm_1tau_bloose"]["muon"]->fillHistograms(selMuons, evtWeight_mm);
-      selEvtHistManager_category["1e1mumm_1tau_bloose"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_mm);
-    } else if ( category == k2mupp_btight ) {
-      selMuonHistManager_category["2mupp_1tau_btight"]["leadMuon"]->fillHistograms(selMuons, evtWeight_pp);
-      selMuonHistManager_category["2mupp_1tau_btight"]["subleadMuon"]->fillHistograms(selMuons, evtWeight_pp);
-      selEvtHistManager_category["2mupp_1tau_btight"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_pp);
-    } else if ( category == k2mupp_bloose ) {
-      selMuonHistManager_category["2mupp_1tau_bloose"]["leadMuon"]->fillHistograms(selMuons, evtWeight_pp);
-      selMuonHistManager_category["2mupp_1tau_bloose"]["subleadMuon"]->fillHistograms(selMuons, evtWeight_pp);
-      selEvtHistManager_category["2mupp_1tau_bloose"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_pp);
-    } else if ( category == k2mumm_btight ) {
-      selMuonHistManager_category["2mumm_1tau_btight"]["leadMuon"]->fillHistograms(selMuons, evtWeight_mm);
-      selMuonHistManager_category["2mumm_1tau_btight"]["subleadMuon"]->fillHistograms(selMuons, evtWeight_mm);
-      selEvtHistManager_category["2mumm_1tau_btight"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_mm);
-    } else if ( category == k2mumm_bloose ) {
-      selMuonHistManager_category["2mumm_1tau_bloose"]["leadMuon"]->fillHistograms(selMuons, evtWeight_mm);
-      selMuonHistManager_category["2mumm_1tau_bloose"]["subleadMuon"]->fillHistograms(selMuons, evtWeight_mm);
-      selEvtHistManager_category["2mumm_1tau_bloose"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_mm);
-    } 
-
-    (*selEventsFile) << run << ":" << lumi << ":" << event;
-
-    ++selectedEntries;
-    selectedEntries_weighted += evtWeight;
+    lock.lock();
+
+    if ( skimWriter ) skimWriter->write();
+    delete skimWriter;
+
+    delete run_lumi_eventSelector;
+
+    delete muonReader;
+    delete electronReader;
+    delete hadTauReader;
+    delete jetReader;
+    delete genLeptonReader;
+    delete genHadTauReader;
+    delete genJetReader;
+
+    hltPaths_delete(triggers_1e);
+    hltPaths_delete(triggers_2e);
+    hltPaths_delete(triggers_1mu);
+    hltPaths_delete(triggers_2mu);
+    hltPaths_delete(triggers_1e1mu);
+
+    delete eventSource_ptr;
+    if ( inputTree_worker != inputTree ) delete inputTree_worker;
+    if ( inputCache_worker != inputCache ) delete inputCache_worker;
+  };
+
+  unsigned long numAllocations_begin = getNumAllocations();
+  if ( numThreads == 1 ) {
+    processEntries(0);
+  } else {
+    std::vector<std::exception_ptr> exceptions(numThreads);
+    std::vector<std::thread> workers;
+    for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+      workers.push_back(std::thread([&, idxWorker]() {
+        try {
+          processEntries(idxWorker);
+        } catch ( ... ) {
+          exceptions[idxWorker] = std::current_exception();
+        }
+      }));
+    }
+    for ( std::vector<std::thread>::iterator worker = workers.begin();
+	  worker != workers.end(); ++worker ) {
+      worker->join();
+    }
+    for ( std::vector<std::exception_ptr>::const_iterator exception = exceptions.begin();
+	  exception != exceptions.end(); ++exception ) {
+      if ( (*exception) ) std::rethrow_exception(*exception);
+    }
+  }
+  unsigned long numAllocations_end = getNumAllocations();
+
+//--- combine results of all threads, in order of the threads,
+//    so that the output does not depend on the order in which the threads have finished
+  int analyzedEntries = 0;
+  int selectedEntries = 0;
+  double selectedEntries_weighted = 0.;
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    (*selEventsFile) << selEventsFiles_workers[idxWorker].str();
+    analyzedEntries += analyzedEntries_workers[idxWorker];
+    selectedEntries += selectedEntries_workers[idxWorker];
+    selectedEntries_weighted += selectedEntries_weighted_workers[idxWorker];
+    if ( idxWorker > 0 ) {
+      cutFlow_workers[0].merge(cutFlow_workers[idxWorker]);
+      mvaOutputCaches_workers[0]->merge(*mvaOutputCaches_workers[idxWorker]);
+      for ( size_t idxShiftGroup = 0; idxShiftGroup < numShiftGroups; ++idxShiftGroup ) {
+        histManagers_workers[0][idxShiftGroup]->merge(*histManagers_workers[idxWorker][idxShiftGroup]);
+      }
+    }
   }
 
-  std::cout << "num. Entries = " << numEntries << std::endl;
+//--- add the events accumulated by the HistManagers to the booked histograms
+//    (the histograms of all threads have been merged into those of the first thread before)
+  HistManagerBase::flushAll();
+
+  std::cout << "num. Entries = " << entryRange.size() << std::endl;
   std::cout << " analyzed = " << analyzedEntries << std::endl;
   std::cout << " selected = " << selectedEntries << " (weighted = " << selectedEntries_weighted << ")" << std::endl;
+  if ( isAllocationCountingEnabled() && analyzedEntries > 0 ) {
+    std::cout << "num. heap allocations per analyzed Entry = " << (double)(numAllocations_end - numAllocations_begin)/analyzedEntries << std::endl;
+  }
+
+  const MVAOutputCache& mvaOutputCache = (*mvaOutputCaches_workers[0]);
+  std::cout << "BDT outputs taken from cache = " << mvaOutputCache.getNumHits() << ", computed = " << mvaOutputCache.getNumMisses() << std::endl;
+  if ( mvaOutputCacheFileName_output != "" ) {
+    // CV: keep the outputs read from the input file, so that the output file can be used as input for jobs processing any of the events
+    if ( mvaOutputCache_input ) mvaOutputCaches_workers[0]->merge(*mvaOutputCache_input);
+    mvaOutputCaches_workers[0]->write(mvaOutputCacheFileName_output);
+    std::cout << "wrote " << mvaOutputCache.size() << " BDT outputs to file = " << mvaOutputCacheFileName_output << std::endl;
+  }
 
-  delete run_lumi_eventSelector;
+  const CutFlowTable& cutFlow = cutFlow_workers[0];
+  cutFlow.print(std::cout);
+  if ( cutFlowFileName != "" ) {
+    std::ofstream cutFlowFile(cutFlowFileName.data(), std::ios::out);
+    CutFlowTable::writeHeader(cutFlowFile);
+    cutFlow.write(cutFlowFile);
+  }
 
   delete selEventsFile;
 
-  delete muonReader;
-  delete electronReader;
-  delete hadTauReader;
-  delete jetReader;
-  delete genLeptonReader;
-  delete genHadTauReader;
-  delete genJetReader;
-
-  hltPaths_delete(triggers_1e);
-  hltPaths_delete(triggers_2e);
-  hltPaths_delete(triggers_1mu);
-  hltPaths_delete(triggers_2mu);
-  hltPaths_delete(triggers_1e1mu);
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    for ( std::vector<histManagers_2lss_1tau*>::iterator histManagers = histManagers_workers[idxWorker].begin();
+	  histManagers != histManagers_workers[idxWorker].end(); ++histManagers ) {
+      delete (*histManagers);
+    }
+    // CV: remove copies of histograms filled by threads other than the first from the output file
+    if ( idxWorker > 0 ) fs.getBareDirectory()->rmdir(Form("shard%i", idxWorker));
+    delete mvaOutputCaches_workers[idxWorker];
+  }
+  delete mvaOutputCache_input;
+
+  delete inputTree;
+  delete inputCache;
 
   clock.Show("analyze_2lss_1tau");
 
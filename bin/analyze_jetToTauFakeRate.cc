@@ -14,6 +14,7 @@
 #include <TTree.h> // TTree
 #include <TBenchmark.h> // TBenchmark
 #include <TString.h> // TString, Form
+#include <TROOT.h> // ROOT::EnableThreadSafety
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoLepton.h" // RecoLepton
 #include "tthAnalysis/HiggsToTauTau/interface/RecoJet.h" // RecoJet
@@ -31,11 +32,17 @@
 #include "tthAnalysis/HiggsToTauTau/interface/GenLeptonReader.h" // GenLeptonReader
 #include "tthAnalysis/HiggsToTauTau/interface/GenHadTauReader.h" // GenHadTauReader
 #include "tthAnalysis/HiggsToTauTau/interface/GenJetReader.h" // GenJetReader
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource
+#include "tthAnalysis/HiggsToTauTau/interface/ColumnarCache.h" // ColumnarCacheReader
+#include "tthAnalysis/HiggsToTauTau/interface/EntryRange.h" // EntryRange, getClusterBoundaries, splitEntryRange
+#include "tthAnalysis/HiggsToTauTau/interface/StagedEntryLoader.h" // StagedEntryLoader
 #include "tthAnalysis/HiggsToTauTau/interface/convert_to_ptrs.h" // convert_to_ptrs
 #include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionCleaner.h" // RecoElectronCollectionCleaner, RecoMuonCollectionCleaner, RecoHadTauCollectionCleaner, RecoJetCollectionCleaner
-#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionGenMatcher.h" // RecoElectronCollectionGenMatcher, RecoMuonCollectionGenMatcher, RecoHadTauCollectionGenMatcher, RecoJetCollectionGenMatcher
+#include "tthAnalysis/HiggsToTauTau/interface/GenMatchTable.h" // GenMatchTable
 #include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionSelector.h" // RecoElectronSelectorTight, RecoMuonSelectorTight, RecoHadTauSelectorLoose, RecoHadTauSelectorTight
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionMultiSelector.h" // RecoMuonCollectionMultiSelector, RecoElectronCollectionMultiSelector, RecoHadTauCollectionMultiSelector
 #include "tthAnalysis/HiggsToTauTau/interface/RunLumiEventSelector.h" // RunLumiEventSelector
+#include "tthAnalysis/HiggsToTauTau/interface/CutFlowTable.h" // CutFlowTable
 #include "tthAnalysis/HiggsToTauTau/interface/ElectronHistManager.h" // ElectronHistManager
 #include "tthAnalysis/HiggsToTauTau/interface/MuonHistManager.h" // MuonHistManager
 #include "tthAnalysis/HiggsToTauTau/interface/HadTauHistManager.h" // HadTauHistManager
@@ -44,7 +51,7 @@
 #include "tthAnalysis/HiggsToTauTau/interface/EvtHistManager_jetToTauFakeRate.h" // EvtHistManager_jetToTauFakeRate
 #include "tthAnalysis/HiggsToTauTau/interface/leptonTypes.h" // getLeptonType, kElectron, kMuon
 #include "tthAnalysis/HiggsToTauTau/interface/backgroundEstimation.h" // prob_chargeMisId
-#include "tthAnalysis/HiggsToTauTau/interface/hltPath.h" // hltPath, create_hltPaths, hltPaths_setBranchAddresses, hltPaths_isTriggered, hltPaths_delete
+#include "tthAnalysis/HiggsToTauTau/interface/hltPath.h" // hltPath, create_hltPaths, hltPaths_setBranchAddresses, hltPaths_branchNames, hltPaths_isTriggered, hltPaths_delete
 #include "tthAnalysis/HiggsToTauTau/interface/data_to_MC_corrections.h"
 
 #include <iostream> // std::cerr, std::fixed
@@ -54,6 +61,10 @@
 #include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
 #include <algorithm> // std::sort
 #include <fstream> // std::ofstream
+#include <sstream> // std::ostringstream
+#include <thread> // std::thread
+#include <mutex> // std::mutex, std::unique_lock, std::lock_guard
+#include <exception> // std::exception_ptr, std::current_exception, std::rethrow_exception
 #include <assert.h> // assert
 
 typedef math::PtEtaPhiMLorentzVector LV;
@@ -77,6 +88,108 @@ bool isHigherPt(const GenParticle* particle1, const GenParticle* particle2)
   return (particle1->pt_ > particle2->pt_);
 }
 
+/**
+ * @brief Collection of all histograms booked and filled in the jet->tau fake-rate analysis
+ */
+struct histManagers_jetToTauFakeRate
+{
+  histManagers_jetToTauFakeRate(TFileDirectory& dir, const std::string& process_string, const std::string& hadTauSelection_string, const std::string& central_or_shift);
+
+  /**
+   * @brief Add histograms filled by another thread
+   */
+  void merge(const histManagers_jetToTauFakeRate& shard);
+
+  ElectronHistManager selElectronHistManager_;
+  MuonHistManager selMuonHistManager_;
+  HadTauHistManager selHadTauHistManager_;
+  HadTauHistManager selHadTauHistManager_genHadTau_;
+  HadTauHistManager selHadTauHistManager_genElectron_;
+  HadTauHistManager selHadTauHistManager_genMuon_;
+  HadTauHistManager selHadTauHistManager_genJet_;
+  JetHistManager selJetHistManager_;
+  JetHistManager selJetHistManager_lead_;
+  JetHistManager selJetHistManager_sublead_;
+  JetHistManager selBJet_looseHistManager_;
+  JetHistManager selBJet_looseHistManager_lead_;
+  JetHistManager selBJet_looseHistManager_sublead_;
+  JetHistManager selBJet_mediumHistManager_;
+  MEtHistManager selMEtHistManager_;
+  EvtHistManager_jetToTauFakeRate selEvtHistManager_;
+};
+
+histManagers_jetToTauFakeRate::histManagers_jetToTauFakeRate(TFileDirectory& dir, const std::string& process_string, const std::string& hadTauSelection_string, const std::string& central_or_shift)
+  : selElectronHistManager_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/electrons", hadTauSelection_string.data()), central_or_shift))
+  , selMuonHistManager_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/muons", hadTauSelection_string.data()), central_or_shift))
+  , selHadTauHistManager_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/hadTaus", hadTauSelection_string.data()), central_or_shift))
+  , selHadTauHistManager_genHadTau_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/hadTaus_genHadTau", hadTauSelection_string.data()), central_or_shift))
+  , selHadTauHistManager_genElectron_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/hadTaus_genElectron", hadTauSelection_string.data()), central_or_shift))
+  , selHadTauHistManager_genMuon_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/hadTaus_genMuon", hadTauSelection_string.data()), central_or_shift))
+  , selHadTauHistManager_genJet_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/hadTaus_genJet", hadTauSelection_string.data()), central_or_shift))
+  , selJetHistManager_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/jets", hadTauSelection_string.data()), central_or_shift))
+  , selJetHistManager_lead_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/leadJet", hadTauSelection_string.data()), central_or_shift, 0))
+  , selJetHistManager_sublead_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/subleadJet", hadTauSelection_string.data()), central_or_shift, 1))
+  , selBJet_looseHistManager_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/BJets_loose", hadTauSelection_string.data()), central_or_shift))
+  , selBJet_looseHistManager_lead_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/leadBJet_loose", hadTauSelection_string.data()), central_or_shift, 0))
+  , selBJet_looseHistManager_sublead_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/subleadBJet_loose", hadTauSelection_string.data()), central_or_shift, 1))
+  , selBJet_mediumHistManager_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/BJets_medium", hadTauSelection_string.data()), central_or_shift))
+  , selMEtHistManager_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/met", hadTauSelection_string.data()), central_or_shift))
+  , selEvtHistManager_(makeHistManager_cfg(process_string,
+      Form("jetToTauFakeRate/%s/evt", hadTauSelection_string.data()), central_or_shift))
+{
+  selElectronHistManager_.bookHistograms(dir);
+  selMuonHistManager_.bookHistograms(dir);
+  selHadTauHistManager_.bookHistograms(dir);
+  selHadTauHistManager_genHadTau_.bookHistograms(dir);
+  selHadTauHistManager_genElectron_.bookHistograms(dir);
+  selHadTauHistManager_genMuon_.bookHistograms(dir);
+  selHadTauHistManager_genJet_.bookHistograms(dir);
+  selJetHistManager_.bookHistograms(dir);
+  selJetHistManager_lead_.bookHistograms(dir);
+  selJetHistManager_sublead_.bookHistograms(dir);
+  selBJet_looseHistManager_.bookHistograms(dir);
+  selBJet_looseHistManager_lead_.bookHistograms(dir);
+  selBJet_looseHistManager_sublead_.bookHistograms(dir);
+  selBJet_mediumHistManager_.bookHistograms(dir);
+  selMEtHistManager_.bookHistograms(dir);
+  selEvtHistManager_.bookHistograms(dir);
+}
+
+void histManagers_jetToTauFakeRate::merge(const histManagers_jetToTauFakeRate& shard)
+{
+  selElectronHistManager_.merge(shard.selElectronHistManager_);
+  selMuonHistManager_.merge(shard.selMuonHistManager_);
+  selHadTauHistManager_.merge(shard.selHadTauHistManager_);
+  selHadTauHistManager_genHadTau_.merge(shard.selHadTauHistManager_genHadTau_);
+  selHadTauHistManager_genElectron_.merge(shard.selHadTauHistManager_genElectron_);
+  selHadTauHistManager_genMuon_.merge(shard.selHadTauHistManager_genMuon_);
+  selHadTauHistManager_genJet_.merge(shard.selHadTauHistManager_genJet_);
+  selJetHistManager_.merge(shard.selJetHistManager_);
+  selJetHistManager_lead_.merge(shard.selJetHistManager_lead_);
+  selJetHistManager_sublead_.merge(shard.selJetHistManager_sublead_);
+  selBJet_looseHistManager_.merge(shard.selBJet_looseHistManager_);
+  selBJet_looseHistManager_lead_.merge(shard.selBJet_looseHistManager_lead_);
+  selBJet_looseHistManager_sublead_.merge(shard.selBJet_looseHistManager_sublead_);
+  selBJet_mediumHistManager_.merge(shard.selBJet_mediumHistManager_);
+  selMEtHistManager_.merge(shard.selMEtHistManager_);
+  selEvtHistManager_.merge(shard.selEvtHistManager_);
+}
+
 /**
  * @brief Produce datacard and control plots for 2los_1tau categories.
  */
@@ -108,13 +221,10 @@ int main(int argc, char* argv[])
   std::string process_string = cfg_analyze.getParameter<std::string>("process");
 
   vstring triggerNames_1e = cfg_analyze.getParameter<vstring>("triggers_1e");
-  std::vector<hltPath*> triggers_1e = create_hltPaths(triggerNames_1e);
   bool use_triggers_1e = cfg_analyze.getParameter<bool>("use_triggers_1e");
   vstring triggerNames_1mu = cfg_analyze.getParameter<vstring>("triggers_1mu");
-  std::vector<hltPath*> triggers_1mu = create_hltPaths(triggerNames_1mu);
   bool use_triggers_1mu = cfg_analyze.getParameter<bool>("use_triggers_1mu");
   vstring triggerNames_1e1mu = cfg_analyze.getParameter<vstring>("triggers_1e1mu");
-  std::vector<hltPath*> triggers_1e1mu = create_hltPaths(triggerNames_1e1mu);
   bool use_triggers_1e1mu = cfg_analyze.getParameter<bool>("use_triggers_1e1mu");
 
   enum { kLoose, kFakeable, kTight };
@@ -132,6 +242,13 @@ int main(int argc, char* argv[])
   std::string central_or_shift = cfg_analyze.getParameter<std::string>("central_or_shift");
   double lumiScale = ( process_string != "data_obs" ) ? cfg_analyze.getParameter<double>("lumiScale") : 1.;
 
+//--- process the events in numThreads threads (optional)
+  int numThreads = ( cfg_analyze.exists("numThreads") ) ? cfg_analyze.getParameter<int>("numThreads") : 1;
+  if ( numThreads < 1 )
+    throw cms::Exception("analyze_jetToTauFakeRate") 
+      << "Invalid Configuration parameter 'numThreads' = " << numThreads << " !!\n";
+  if ( numThreads > 1 ) ROOT::EnableThreadSafety();
+
   std::string jet_btagWeight_branch = ( isMC ) ? "Jet_bTagWeight" : "";
 
   int jetPt_option = RecoJetReader::kJetPt_central;
@@ -161,16 +278,11 @@ int main(int argc, char* argv[])
 
   std::string selEventsFileName_input = cfg_analyze.getParameter<std::string>("selEventsFileName_input");
   std::cout << "selEventsFileName_input = " << selEventsFileName_input << std::endl;
-  RunLumiEventSelector* run_lumi_eventSelector = 0;
-  if ( selEventsFileName_input != "" ) {
-    edm::ParameterSet cfgRunLumiEventSelector;
-    cfgRunLumiEventSelector.addParameter<std::string>("inputFileName", selEventsFileName_input);
-    cfgRunLumiEventSelector.addParameter<std::string>("separator", ":");
-    run_lumi_eventSelector = new RunLumiEventSelector(cfgRunLumiEventSelector);
-  }
 
   std::string selEventsFileName_output = cfg_analyze.getParameter<std::string>("selEventsFileName_output");
 
+  std::string cutFlowFileName = ( cfg_analyze.exists("cutFlowFileName") ) ? cfg_analyze.getParameter<std::string>("cutFlowFileName") : "";
+
   fwlite::InputSource inputFiles(cfg); 
   int maxEvents = inputFiles.maxEvents();
   std::cout << " maxEvents = " << maxEvents << std::endl;
@@ -179,389 +291,535 @@ int main(int argc, char* argv[])
   fwlite::OutputFiles outputFile(cfg);
   fwlite::TFileService fs = fwlite::TFileService(outputFile.file().data());
 
-  TChain* inputTree = new TChain(treeName.data());
-  for ( std::vector<std::string>::const_iterator inputFileName = inputFiles.files().begin();
-	inputFileName != inputFiles.files().end(); ++inputFileName ) {
-    std::cout << "input Tree: adding file = " << (*inputFileName) << std::endl;
-    inputTree->AddFile(inputFileName->data());
-  }
+  edm::ParameterSet cfg_input = cfg.getParameter<edm::ParameterSet>("fwliteInput");
+  std::string inputFormat = "ROOT";
+  if ( cfg_input.exists("inputFormat") ) inputFormat = cfg_input.getParameter<std::string>("inputFormat");
+
+  TChain* inputTree = 0;
+  ColumnarCacheReader* inputCache = 0;
+  if ( inputFormat == "ROOT" ) {
+    inputTree = new TChain(treeName.data());
+    for ( std::vector<std::string>::const_iterator inputFileName = inputFiles.files().begin();
+	  inputFileName != inputFiles.files().end(); ++inputFileName ) {
+      std::cout << "input Tree: adding file = " << (*inputFileName) << std::endl;
+      inputTree->AddFile(inputFileName->data());
+    }
   
-  if ( !(inputTree->GetListOfFiles()->GetEntries() >= 1) ) {
-    throw cms::Exception("analyze_2los_1tau") 
-      << "Failed to identify input Tree !!\n";
-  }
+    if ( !(inputTree->GetListOfFiles()->GetEntries() >= 1) ) {
+      throw cms::Exception("analyze_2los_1tau") 
+        << "Failed to identify input Tree !!\n";
+    }
   
-  // CV: need to call TChain::LoadTree before processing first event 
-  //     in order to prevent ROOT causing a segmentation violation,
-  //     cf. http://root.cern.ch/phpBB3/viewtopic.php?t=10062
-  inputTree->LoadTree(0);
+    // CV: need to call TChain::LoadTree before processing first event 
+    //     in order to prevent ROOT causing a segmentation violation,
+    //     cf. http://root.cern.ch/phpBB3/viewtopic.php?t=10062
+    inputTree->LoadTree(0);
+
+    std::cout << "input Tree contains " << inputTree->GetEntries() << " Entries in " << inputTree->GetListOfFiles()->GetEntries() << " files." << std::endl;
+  } else if ( inputFormat == "columnarCache" ) {
+    inputCache = new ColumnarCacheReader(inputFiles.files());
+    std::cout << "input columnar cache contains " << inputCache->getEntries() << " Entries in " << inputFiles.files().size() << " files." << std::endl;
+  } else {
+    throw cms::Exception("analyze_jetToTauFakeRate") 
+      << "Invalid Configuration parameter 'inputFormat' = " << inputFormat << " !!\n";
+  }
+
+//--- split the range of entries into contiguous ranges, one per thread;
+//    the boundaries between the ranges are aligned to the cluster boundaries of the input files,
+//    so that the split is reproducible and no cluster of baskets is decompressed by more than one thread
+  EntryRange entryRange(cfg_input, ( inputCache ) ? inputCache->getEntries() : inputTree->GetEntries());
+  if ( maxEvents != -1 && entryRange.size() > maxEvents ) entryRange = EntryRange(entryRange.firstEntry(), entryRange.firstEntry() + maxEvents);
+  std::cout << "processing Entries " << entryRange.firstEntry() << " to " << entryRange.lastEntry() << "." << std::endl;
+  std::vector<Long64_t> clusterBoundaries;
+  if ( inputTree && numThreads > 1 ) clusterBoundaries = getClusterBoundaries(inputTree);
+  std::vector<EntryRange> entryRanges = splitEntryRange(entryRange, numThreads, clusterBoundaries);
+  if ( numThreads > 1 ) {
+    for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+      std::cout << " thread #" << idxWorker << ": Entries " << entryRanges[idxWorker].firstEntry() << " to " << entryRanges[idxWorker].lastEntry() << std::endl;
+    }
+  }
 
-  std::cout << "input Tree contains " << inputTree->GetEntries() << " Entries in " << inputTree->GetListOfFiles()->GetEntries() << " files." << std::endl;
+//--- open output file containing run:lumi:event numbers of events passing final event selection criteria
+  std::ostream* selEventsFile = new std::ofstream(selEventsFileName_output.data(), std::ios::out);
+
+//--- declare histograms;
+//    threads other than the first fill private copies of the histograms, booked in separate directories,
+//    which are added to the histograms of the first thread once all threads have finished
+  std::vector<histManagers_jetToTauFakeRate*> histManagers_workers;
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    TFileDirectory dir = ( idxWorker == 0 ) ? fs : fs.mkdir(Form("shard%i", idxWorker));
+    histManagers_workers.push_back(new histManagers_jetToTauFakeRate(dir, process_string, hadTauSelection_string, central_or_shift));
+  }
+
+  std::vector<std::ostringstream> selEventsFiles_workers(numThreads);
+  std::vector<int> analyzedEntries_workers(numThreads);
+  std::vector<int> selectedEntries_workers(numThreads);
+  std::vector<double> selectedEntries_weighted_workers(numThreads);
+  std::vector<CutFlowTable> cutFlow_workers(numThreads, CutFlowTable("analyze_jetToTauFakeRate"));
+  std::mutex workerMutex;
+  std::mutex coutMutex;
+
+//--- process the entries in range given by entryRanges[idxWorker];
+//    all objects that change their state while processing events (readers, selectors,...)
+//    are private to each thread
+  auto processEntries = [&](int idxWorker)
+  {
+//--- construct and destruct the objects used by each thread one thread at a time,
+//    as creating and deleting TChain and TBranch objects is not guaranteed to be thread-safe
+    std::unique_lock<std::mutex> lock(workerMutex);
+
+//--- each thread other than the first reads the input files through its own TChain or ColumnarCacheReader object
+    TChain* inputTree_worker = inputTree;
+    ColumnarCacheReader* inputCache_worker = inputCache;
+    if ( idxWorker > 0 ) {
+      if ( inputTree ) {
+        inputTree_worker = new TChain(treeName.data());
+        for ( std::vector<std::string>::const_iterator inputFileName = inputFiles.files().begin();
+	      inputFileName != inputFiles.files().end(); ++inputFileName ) {
+          inputTree_worker->AddFile(inputFileName->data());
+        }
+        inputTree_worker->LoadTree(0);
+      } else {
+        inputCache_worker = new ColumnarCacheReader(inputFiles.files());
+      }
+    }
 
 //--- declare event-level variables
-  RUN_TYPE run;
-  inputTree->SetBranchAddress(RUN_KEY, &run);
-  LUMI_TYPE lumi;
-  inputTree->SetBranchAddress(LUMI_KEY, &lumi);
-  EVT_TYPE event;
-  inputTree->SetBranchAddress(EVT_KEY, &event);
-
-  hltPaths_setBranchAddresses(inputTree, triggers_1e);
-  hltPaths_setBranchAddresses(inputTree, triggers_1mu);
-  hltPaths_setBranchAddresses(inputTree, triggers_1e1mu);
-
-  MET_PT_TYPE met_pt;
-  inputTree->SetBranchAddress(MET_PT_KEY, &met_pt);
-  MET_ETA_TYPE met_eta;
-  inputTree->SetBranchAddress(MET_ETA_KEY, &met_eta);
-  MET_PHI_TYPE met_phi;
-  inputTree->SetBranchAddress(MET_PHI_KEY, &met_phi);
-  LV met_p4(met_pt, met_eta, met_phi, 0.);
+    EventSource* eventSource_ptr = ( inputCache_worker ) ? new EventSource(inputCache_worker) : new EventSource(inputTree_worker);
+    EventSource& eventSource = (*eventSource_ptr);
+
+    RUN_TYPE run;
+    eventSource.setBranchAddress(RUN_KEY, &run);
+    LUMI_TYPE lumi;
+    eventSource.setBranchAddress(LUMI_KEY, &lumi);
+    EVT_TYPE event;
+    eventSource.setBranchAddress(EVT_KEY, &event);
+
+    std::vector<hltPath*> triggers_1e = create_hltPaths(triggerNames_1e);
+    std::vector<hltPath*> triggers_1mu = create_hltPaths(triggerNames_1mu);
+    std::vector<hltPath*> triggers_1e1mu = create_hltPaths(triggerNames_1e1mu);
+    hltPaths_setBranchAddresses(eventSource, triggers_1e);
+    hltPaths_setBranchAddresses(eventSource, triggers_1mu);
+    hltPaths_setBranchAddresses(eventSource, triggers_1e1mu);
+
+    MET_PT_TYPE met_pt;
+    eventSource.setBranchAddress(MET_PT_KEY, &met_pt);
+    MET_ETA_TYPE met_eta;
+    eventSource.setBranchAddress(MET_ETA_KEY, &met_eta);
+    MET_PHI_TYPE met_phi;
+    eventSource.setBranchAddress(MET_PHI_KEY, &met_phi);
+    LV met_p4(met_pt, met_eta, met_phi, 0.);
 
 //--- declare particle collections
-  RecoMuonReader* muonReader = new RecoMuonReader("nselLeptons", "selLeptons");
-  muonReader->setBranchAddresses(inputTree);
-  RecoMuonCollectionGenMatcher muonGenMatcher;
-  RecoMuonCollectionSelectorLoose preselMuonSelector;
-  RecoMuonCollectionSelectorTight tightMuonSelector;
-
-  RecoElectronReader* electronReader = new RecoElectronReader("nselLeptons", "selLeptons");
-  electronReader->setBranchAddresses(inputTree);
-  RecoElectronCollectionGenMatcher electronGenMatcher;
-  RecoElectronCollectionCleaner electronCleaner(0.3);
-  RecoElectronCollectionSelectorLoose preselElectronSelector;
-  RecoElectronCollectionSelectorTight tightElectronSelector;
-
-  RecoHadTauReader* hadTauReader = new RecoHadTauReader("nTauGood", "TauGood");
-  hadTauReader->setBranchAddresses(inputTree);
-  RecoHadTauCollectionGenMatcher hadTauGenMatcher;
-  RecoHadTauCollectionCleaner hadTauCleaner(0.3);
-  RecoHadTauCollectionSelectorLoose preselHadTauSelector;
-  RecoHadTauCollectionSelectorFakeable fakeableHadTauSelector;
-  RecoHadTauCollectionSelectorTight tightHadTauSelector;
+    RecoMuonReader* muonReader = new RecoMuonReader("nselLeptons", "selLeptons");
+    muonReader->setBranchAddresses(eventSource);
+    RecoMuonCollectionMultiSelector muonSelector;
+    RecoMuonCollectionSelection muonSelection;
+
+    RecoElectronReader* electronReader = new RecoElectronReader("nselLeptons", "selLeptons");
+    electronReader->setBranchAddresses(eventSource);
+    RecoElectronCollectionCleaner electronCleaner(0.3);
+    RecoElectronCollectionMultiSelector electronSelector;
+    RecoElectronCollectionSelection electronSelection;
+
+    RecoHadTauReader* hadTauReader = new RecoHadTauReader("nTauGood", "TauGood");
+    hadTauReader->setBranchAddresses(eventSource);
+    RecoHadTauCollectionCleaner hadTauCleaner(0.3);
+    RecoHadTauCollectionMultiSelector hadTauSelector;
+    RecoHadTauCollectionSelection hadTauSelectionResults;
   
-  RecoJetReader* jetReader = new RecoJetReader("nJet", "Jet");
-  jetReader->setJetPt_central_or_shift(jetPt_option);
-  jetReader->setBranchName_BtagWeight(jet_btagWeight_branch);
-  jetReader->setBranchAddresses(inputTree);
-  RecoJetCollectionGenMatcher jetGenMatcher;
-  RecoJetCollectionCleaner jetCleaner(0.5);
-  RecoJetCollectionSelector jetSelector;  
-  RecoJetCollectionSelectorBtagLoose jetSelectorBtagLoose;
-  RecoJetCollectionSelectorBtagMedium jetSelectorBtagMedium;
-
-  GenLeptonReader* genLeptonReader = 0;
-  GenHadTauReader* genHadTauReader = 0;
-  GenJetReader* genJetReader = 0;
-  if ( isMC ) {
-    genLeptonReader = new GenLeptonReader("nGenLep", "GenLep");
-    genLeptonReader->setBranchAddresses(inputTree);
-    genHadTauReader = new GenHadTauReader("nGenHadTaus", "GenHadTaus");
-    genHadTauReader->setBranchAddresses(inputTree);
-    genJetReader = new GenJetReader("nGenJet", "GenJet");
-    genJetReader->setBranchAddresses(inputTree);
-  }
+    RecoJetReader* jetReader = new RecoJetReader("nJet", "Jet");
+    jetReader->setJetPt_central_or_shift(jetPt_option);
+    jetReader->setBranchName_BtagWeight(jet_btagWeight_branch);
+    jetReader->setBranchAddresses(eventSource);
+    RecoJetCollectionCleaner jetCleaner(0.5);
+    RecoJetCollectionSelector jetSelector;  
+    RecoJetCollectionSelectorBtagLoose jetSelectorBtagLoose;
+    RecoJetCollectionSelectorBtagMedium jetSelectorBtagMedium;
+
+    GenLeptonReader* genLeptonReader = 0;
+    GenHadTauReader* genHadTauReader = 0;
+    GenJetReader* genJetReader = 0;
+    if ( isMC ) {
+      genLeptonReader = new GenLeptonReader("nGenLep", "GenLep");
+      genLeptonReader->setBranchAddresses(eventSource);
+      genHadTauReader = new GenHadTauReader("nGenHadTaus", "GenHadTaus");
+      genHadTauReader->setBranchAddresses(eventSource);
+      genJetReader = new GenJetReader("nGenJet", "GenJet");
+      genJetReader->setBranchAddresses(eventSource);
+    }
+    GenMatchTable genMatchTable;
 
-//--- open output file containing run:lumi:event numbers of events passing final event selection criteria
-  std::ostream* selEventsFile = new std::ofstream(selEventsFileName_output.data(), std::ios::out);
 
-  ElectronHistManager selElectronHistManager(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/electrons", hadTauSelection_string.data()), central_or_shift));
-  selElectronHistManager.bookHistograms(fs);
-
-  MuonHistManager selMuonHistManager(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/muons", hadTauSelection_string.data()), central_or_shift));
-  selMuonHistManager.bookHistograms(fs);
-
-  HadTauHistManager selHadTauHistManager(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/hadTaus", hadTauSelection_string.data()), central_or_shift));
-  selHadTauHistManager.bookHistograms(fs);
-  HadTauHistManager selHadTauHistManager_genHadTau(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/hadTaus_genHadTau", hadTauSelection_string.data()), central_or_shift));
-  selHadTauHistManager_genHadTau.bookHistograms(fs);
-  HadTauHistManager selHadTauHistManager_genElectron(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/hadTaus_genElectron", hadTauSelection_string.data()), central_or_shift));
-  selHadTauHistManager_genElectron.bookHistograms(fs);
-  HadTauHistManager selHadTauHistManager_genMuon(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/hadTaus_genMuon", hadTauSelection_string.data()), central_or_shift));
-  selHadTauHistManager_genMuon.bookHistograms(fs);
-  HadTauHistManager selHadTauHistManager_genJet(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/hadTaus_genJet", hadTauSelection_string.data()), central_or_shift));
-  selHadTauHistManager_genJet.bookHistograms(fs);
-
-  JetHistManager selJetHistManager(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/jets", hadTauSelection_string.data()), central_or_shift));
-  selJetHistManager.bookHistograms(fs);
-  JetHistManager selJetHistManager_lead(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/leadJet", hadTauSelection_string.data()), central_or_shift, 0));
-  selJetHistManager_lead.bookHistograms(fs);
-  JetHistManager selJetHistManager_sublead(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/subleadJet", hadTauSelection_string.data()), central_or_shift, 1));
-  selJetHistManager_sublead.bookHistograms(fs);
-
-  JetHistManager selBJet_looseHistManager(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/BJets_loose", hadTauSelection_string.data()), central_or_shift));
-  selBJet_looseHistManager.bookHistograms(fs);
-  JetHistManager selBJet_looseHistManager_lead(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/leadBJet_loose", hadTauSelection_string.data()), central_or_shift, 0));
-  selBJet_looseHistManager_lead.bookHistograms(fs);
-  JetHistManager selBJet_looseHistManager_sublead(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/subleadBJet_loose", hadTauSelection_string.data()), central_or_shift, 1));
-  selBJet_looseHistManager_sublead.bookHistograms(fs);
-  JetHistManager selBJet_mediumHistManager(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/BJets_medium", hadTauSelection_string.data()), central_or_shift));
-  selBJet_mediumHistManager.bookHistograms(fs);
-
-  MEtHistManager selMEtHistManager(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/met", hadTauSelection_string.data()), central_or_shift));
-  selMEtHistManager.bookHistograms(fs);
-
-  EvtHistManager_jetToTauFakeRate selEvtHistManager(makeHistManager_cfg(process_string, 
-    Form("jetToTauFakeRate/%s/evt", hadTauSelection_string.data()), central_or_shift));
-  selEvtHistManager.bookHistograms(fs);
-
-  int numEntries = inputTree->GetEntries();
-  int analyzedEntries = 0;
-  int selectedEntries = 0;
-  double selectedEntries_weighted = 0.;
-  for ( int idxEntry = 0; idxEntry < numEntries && (maxEvents == -1 || idxEntry < maxEvents); ++idxEntry ) {
-    if ( idxEntry > 0 && (idxEntry % reportEvery) == 0 ) {
-      std::cout << "processing Entry " << idxEntry << " (" << selectedEntries << " Entries selected)" << std::endl;
+    RunLumiEventSelector* run_lumi_eventSelector = 0;
+    if ( selEventsFileName_input != "" ) {
+      edm::ParameterSet cfgRunLumiEventSelector;
+      cfgRunLumiEventSelector.addParameter<std::string>("inputFileName", selEventsFileName_input);
+      cfgRunLumiEventSelector.addParameter<std::string>("separator", ":");
+      run_lumi_eventSelector = new RunLumiEventSelector(cfgRunLumiEventSelector);
     }
-    ++analyzedEntries;
+
+//--- selected run:lumi:event numbers and counters of each thread are collected separately
+//    and combined once all threads have finished
+    std::ostream& selEventsFile = selEventsFiles_workers[idxWorker];
+    int& analyzedEntries = analyzedEntries_workers[idxWorker];
+    int& selectedEntries = selectedEntries_workers[idxWorker];
+    double& selectedEntries_weighted = selectedEntries_weighted_workers[idxWorker];
+    histManagers_jetToTauFakeRate& histManagers = (*histManagers_workers[idxWorker]);
+
+//--- disable all branches that are not read by any of the readers,
+//    so that TTree::GetEntry does not unzip them
+    eventSource.setBranchStatus();
+    if ( idxWorker == 0 ) eventSource.printManifest(std::cout);
+
+//--- read event numbers, trigger bits and object multiplicities first,
+//    and the remaining branches only for events passing the trigger and multiplicity requirements
+    StagedEntryLoader entryLoader(eventSource);
+    entryLoader.addEarlyBranch(RUN_KEY);
+    entryLoader.addEarlyBranch(LUMI_KEY);
+    entryLoader.addEarlyBranch(EVT_KEY);
+    entryLoader.addEarlyBranches(hltPaths_branchNames(triggers_1e));
+    entryLoader.addEarlyBranches(hltPaths_branchNames(triggers_1mu));
+    entryLoader.addEarlyBranches(hltPaths_branchNames(triggers_1e1mu));
+    entryLoader.addEarlyBranch("nselLeptons");
+    entryLoader.addEarlyBranch("nTauGood");
+    entryLoader.addEarlyBranch("nJet");
+
+//--- declare the cuts of the event selection, in the order in which they are applied;
+//    the requirements on object multiplicities are independent of each other
+//    and are evaluated in order of decreasing rejection per CPU time
+    CutFlowTable& cutFlow = cutFlow_workers[idxWorker];
+    const int cut_runLumiEvent = cutFlow.addCut("run:lumi:event selection");
+    const int cut_trigger = cutFlow.addCut("trigger");
+    const int cut_multiplicities = cutFlow.addCutGroup("object multiplicities");
+    cutFlow.addCut(cut_multiplicities, "nselLeptons >= 2", [&entryLoader]() { return entryLoader.getValue("nselLeptons") >= 2; });
+    cutFlow.addCut(cut_multiplicities, "nTauGood >= 1", [&entryLoader]() { return entryLoader.getValue("nTauGood") >= 1; });
+    cutFlow.addCut(cut_multiplicities, "nJet >= 2", [&entryLoader]() { return entryLoader.getValue("nJet") >= 2; });
+    const int cut_preselLeptons = cutFlow.addCut("1 presel electron + 1 presel muon");
+    const int cut_selLeptons = cutFlow.addCut("1 sel electron + 1 sel muon");
+    const int cut_selLeptons_2 = cutFlow.addCut("2 sel leptons");
+    const int cut_selLeptons_trigger = cutFlow.addCut("sel lepton trigger match");
+    const int cut_selJets = cutFlow.addCut(">= 2 jets");
+    const int cut_selBJets = cutFlow.addCut(">= 2 loose b-jets || >= 1 medium b-jet");
+    const int cut_selHadTaus = cutFlow.addCut(">= 1 sel tau");
+    const int cut_lowMassVeto = cutFlow.addCut("m(ll) > 12 GeV");
+    const int cut_leptonPt = cutFlow.addCut("lepton pT");
+    const int cut_charge = cutFlow.addCut("lepton charge (OS)");
+    const int cut_metLD = cutFlow.addCut("met_LD > 0.2");
+
+    lock.unlock();
+
+    for ( Long64_t idxEntry = entryRanges[idxWorker].firstEntry(); idxEntry < entryRanges[idxWorker].lastEntry(); ++idxEntry ) {
+      if ( analyzedEntries > 0 && (analyzedEntries % reportEvery) == 0 ) {
+        std::lock_guard<std::mutex> lock_cout(coutMutex);
+        std::cout << "processing Entry " << idxEntry << " (" << selectedEntries << " Entries selected)" << std::endl;
+      }
+      ++analyzedEntries;
+
+      cutFlow.startEvent();
     
-    inputTree->GetEntry(idxEntry);
+      entryLoader.loadEarly(idxEntry);
+
+      if ( !cutFlow(cut_runLumiEvent, !run_lumi_eventSelector || (*run_lumi_eventSelector)(run, lumi, event), lumiScale) ) continue;
+
+      bool isTriggered_1e = use_triggers_1e && hltPaths_isTriggered(triggers_1e);
+      bool isTriggered_1mu = use_triggers_1mu && hltPaths_isTriggered(triggers_1mu);
+      bool isTriggered_1e1mu = use_triggers_1e1mu && hltPaths_isTriggered(triggers_1e1mu);
+      if ( !cutFlow(cut_trigger, isTriggered_1e || isTriggered_1mu || isTriggered_1e1mu, lumiScale) ) continue;
 
-    if ( run_lumi_eventSelector && !(*run_lumi_eventSelector)(run, lumi, event) ) continue;
+//--- reject events with too few leptons, hadronic taus or jets before reading the object branches
+      if ( !cutFlow.passesCutGroup(cut_multiplicities, lumiScale) ) continue;
 
-    bool isTriggered_1e = use_triggers_1e && hltPaths_isTriggered(triggers_1e);
-    bool isTriggered_1mu = use_triggers_1mu && hltPaths_isTriggered(triggers_1mu);
-    bool isTriggered_1e1mu = use_triggers_1e1mu && hltPaths_isTriggered(triggers_1e1mu);
-    if ( !(isTriggered_1e || isTriggered_1mu || isTriggered_1e1mu) ) continue;
+      entryLoader.loadRemaining();
 
 //--- build collections of electrons, muons and hadronic taus;
 //    resolve overlaps in order of priority: muon, electron,
-    std::vector<RecoMuon> muons = muonReader->read();
-    std::vector<const RecoMuon*> muon_ptrs = convert_to_ptrs(muons);
-    std::vector<const RecoMuon*> cleanedMuons = muon_ptrs; // CV: no cleaning needed for muons, as they have the highest priority in the overlap removal
-    std::vector<const RecoMuon*> preselMuons = preselMuonSelector(cleanedMuons);
-    std::vector<const RecoMuon*> selMuons = tightMuonSelector(preselMuons);
-
-    std::vector<RecoElectron> electrons = electronReader->read();
-    std::vector<const RecoElectron*> electron_ptrs = convert_to_ptrs(electrons);
-    std::vector<const RecoElectron*> cleanedElectrons = electronCleaner(electron_ptrs, selMuons);
-    std::vector<const RecoElectron*> preselElectrons = preselElectronSelector(cleanedElectrons);
-    std::vector<const RecoElectron*> selElectrons = tightElectronSelector(preselElectrons);
-
-    std::vector<RecoHadTau> hadTaus = hadTauReader->read();
-    std::vector<const RecoHadTau*> hadTau_ptrs = convert_to_ptrs(hadTaus);
-    std::vector<const RecoHadTau*> cleanedHadTaus = hadTauCleaner(hadTau_ptrs, selMuons, selElectrons);
-    std::vector<const RecoHadTau*> preselHadTaus = preselHadTauSelector(cleanedHadTaus);
-    std::vector<const RecoHadTau*> fakeableHadTaus = fakeableHadTauSelector(preselHadTaus);
-    std::vector<const RecoHadTau*> tightHadTaus = tightHadTauSelector(preselHadTaus);
-    std::vector<const RecoHadTau*> selHadTaus_woAbsEtaCut;
-    if      ( hadTauSelection == kLoose    ) selHadTaus_woAbsEtaCut = preselHadTaus;
-    else if ( hadTauSelection == kFakeable ) selHadTaus_woAbsEtaCut = fakeableHadTaus;
-    else if ( hadTauSelection == kTight    ) selHadTaus_woAbsEtaCut = tightHadTaus;
-    else assert(0);
-    std::vector<const RecoHadTau*> selHadTaus_wAbsEtaCut;
-    for ( std::vector<const RecoHadTau*>::const_iterator hadTau = selHadTaus_woAbsEtaCut.begin();
-	  hadTau != selHadTaus_woAbsEtaCut.end(); ++hadTau ) {
-      double absEta = std::fabs((*hadTau)->eta_);
-      if ( absEta > hadTau_minAbsEta && absEta <= hadTau_maxAbsEta ) selHadTaus_wAbsEtaCut.push_back(*hadTau);
-    }
-    std::sort(selHadTaus_wAbsEtaCut.begin(), selHadTaus_wAbsEtaCut.end(), isHigherPt);
+      std::vector<RecoMuon> muons = muonReader->read();
+      std::vector<const RecoMuon*> muon_ptrs = convert_to_ptrs(muons);
+      std::vector<const RecoMuon*> cleanedMuons = muon_ptrs; // CV: no cleaning needed for muons, as they have the highest priority in the overlap removal
+      muonSelector(cleanedMuons, muonSelection);
+      std::vector<const RecoMuon*> preselMuons = muonSelection.filter(kSelectionLoose);
+      std::vector<const RecoMuon*> selMuons = muonSelection.filter(kSelectionLoose | kSelectionTight);
+
+      std::vector<RecoElectron> electrons = electronReader->read();
+      std::vector<const RecoElectron*> electron_ptrs = convert_to_ptrs(electrons);
+      std::vector<const RecoElectron*> cleanedElectrons = electronCleaner(electron_ptrs, selMuons);
+      electronSelector(cleanedElectrons, electronSelection);
+      std::vector<const RecoElectron*> preselElectrons = electronSelection.filter(kSelectionLoose);
+      std::vector<const RecoElectron*> selElectrons = electronSelection.filter(kSelectionLoose | kSelectionTight);
+
+      std::vector<RecoHadTau> hadTaus = hadTauReader->read();
+      std::vector<const RecoHadTau*> hadTau_ptrs = convert_to_ptrs(hadTaus);
+      std::vector<const RecoHadTau*> cleanedHadTaus = hadTauCleaner(hadTau_ptrs, selMuons, selElectrons);
+      hadTauSelector(cleanedHadTaus, hadTauSelectionResults);
+      std::vector<const RecoHadTau*> preselHadTaus = hadTauSelectionResults.filter(kSelectionLoose);
+      std::vector<const RecoHadTau*> fakeableHadTaus = hadTauSelectionResults.filter(kSelectionLoose | kSelectionFakeable);
+      std::vector<const RecoHadTau*> tightHadTaus = hadTauSelectionResults.filter(kSelectionLoose | kSelectionTight);
+      std::vector<const RecoHadTau*> selHadTaus_woAbsEtaCut;
+      if      ( hadTauSelection == kLoose    ) selHadTaus_woAbsEtaCut = preselHadTaus;
+      else if ( hadTauSelection == kFakeable ) selHadTaus_woAbsEtaCut = fakeableHadTaus;
+      else if ( hadTauSelection == kTight    ) selHadTaus_woAbsEtaCut = tightHadTaus;
+      else assert(0);
+      std::vector<const RecoHadTau*> selHadTaus_wAbsEtaCut;
+      for ( std::vector<const RecoHadTau*>::const_iterator hadTau = selHadTaus_woAbsEtaCut.begin();
+	    hadTau != selHadTaus_woAbsEtaCut.end(); ++hadTau ) {
+        double absEta = std::fabs((*hadTau)->eta_);
+        if ( absEta > hadTau_minAbsEta && absEta <= hadTau_maxAbsEta ) selHadTaus_wAbsEtaCut.push_back(*hadTau);
+      }
+      std::sort(selHadTaus_wAbsEtaCut.begin(), selHadTaus_wAbsEtaCut.end(), isHigherPt);
 
-//--- split hadronic tau candidates into different collections,
-//    depending on whether they are genuine hadronic taus, e->tau fakes, mu->tau fakes, or jet->tau fakes
-    std::vector<const RecoHadTau*> selHadTaus_genHadTau;
-    std::vector<const RecoHadTau*> selHadTaus_genElectron;
-    std::vector<const RecoHadTau*> selHadTaus_genMuon;
-    std::vector<const RecoHadTau*> selHadTaus_genJet;
-    for ( std::vector<const RecoHadTau*>::const_iterator hadTau = selHadTaus_wAbsEtaCut.begin();
-	  hadTau != selHadTaus_wAbsEtaCut.end(); ++hadTau ) {
-      if      ( (*hadTau)->genHadTau_                                                  ) selHadTaus_genHadTau.push_back(*hadTau);   // generator level match to hadronic tau decay 
-      else if ( (*hadTau)->genLepton_ && std::abs((*hadTau)->genLepton_->pdgId_) == 11 ) selHadTaus_genElectron.push_back(*hadTau); // generator level match to electron 
-      else if ( (*hadTau)->genLepton_ && std::abs((*hadTau)->genLepton_->pdgId_) == 13 ) selHadTaus_genMuon.push_back(*hadTau);     // generator level match to muon
-      else                                                                               selHadTaus_genJet.push_back(*hadTau);      // generator level match to jet (or pileup)
-    }
-    
 //--- build collections of jets and select subset of jets passing b-tagging criteria
-    std::vector<RecoJet> jets = jetReader->read();
-    std::vector<const RecoJet*> jet_ptrs = convert_to_ptrs(jets);
-    std::vector<const RecoJet*> cleanedJets = jetCleaner(jet_ptrs, selMuons, selElectrons);
-    std::vector<const RecoJet*> selJets = jetSelector(cleanedJets);
-    std::vector<const RecoJet*> selBJets_loose = jetSelectorBtagLoose(cleanedJets);
-    std::vector<const RecoJet*> selBJets_medium = jetSelectorBtagMedium(cleanedJets);
+      std::vector<RecoJet> jets = jetReader->read();
+      std::vector<const RecoJet*> jet_ptrs = convert_to_ptrs(jets);
+      std::vector<const RecoJet*> cleanedJets = jetCleaner(jet_ptrs, selMuons, selElectrons);
+      std::vector<const RecoJet*> selJets = jetSelector(cleanedJets);
+      std::vector<const RecoJet*> selBJets_loose = jetSelectorBtagLoose(cleanedJets);
+      std::vector<const RecoJet*> selBJets_medium = jetSelectorBtagMedium(cleanedJets);
 
 //--- build collections of generator level particles
-    std::vector<GenLepton> genLeptons;
-    std::vector<GenLepton> genElectrons;
-    std::vector<GenLepton> genMuons;
-    std::vector<GenHadTau> genHadTaus;
-    std::vector<GenJet> genJets;
-    if ( isMC ) {
-      genLeptons = genLeptonReader->read();
-      for ( std::vector<GenLepton>::const_iterator genLepton = genLeptons.begin();
-	    genLepton != genLeptons.end(); ++genLepton ) {
-	int abs_pdgId = std::abs(genLepton->pdgId_);
-	if      ( abs_pdgId == 11 ) genElectrons.push_back(*genLepton);
-	else if ( abs_pdgId == 13 ) genMuons.push_back(*genLepton);
+      std::vector<GenLepton> genLeptons;
+      std::vector<GenLepton> genElectrons;
+      std::vector<GenLepton> genMuons;
+      std::vector<GenHadTau> genHadTaus;
+      std::vector<GenJet> genJets;
+      if ( isMC ) {
+        genLeptons = genLeptonReader->read();
+        for ( std::vector<GenLepton>::const_iterator genLepton = genLeptons.begin();
+	      genLepton != genLeptons.end(); ++genLepton ) {
+	  int abs_pdgId = std::abs(genLepton->pdgId_);
+	  if      ( abs_pdgId == 11 ) genElectrons.push_back(*genLepton);
+	  else if ( abs_pdgId == 13 ) genMuons.push_back(*genLepton);
+        }
+        genHadTaus = genHadTauReader->read();
+        genJets = genJetReader->read();
       }
-      genHadTaus = genHadTauReader->read();
-      genJets = genJetReader->read();
-    }
 
 //--- match reconstructed to generator level particles
-    if ( isMC ) {
-      muonGenMatcher.addGenLeptonMatch(preselMuons, genLeptons, 0.3);
-      muonGenMatcher.addGenHadTauMatch(preselMuons, genHadTaus, 0.3);
-      muonGenMatcher.addGenJetMatch(preselMuons, genJets, 0.5);
-
-      electronGenMatcher.addGenLeptonMatch(preselElectrons, genLeptons, 0.3);
-      electronGenMatcher.addGenHadTauMatch(preselElectrons, genHadTaus, 0.3);
-      electronGenMatcher.addGenJetMatch(preselElectrons, genJets, 0.5);
-
-      hadTauGenMatcher.addGenLeptonMatch(selHadTaus_woAbsEtaCut, genLeptons, 0.3);
-      hadTauGenMatcher.addGenHadTauMatch(selHadTaus_woAbsEtaCut, genHadTaus, 0.3);
-      hadTauGenMatcher.addGenJetMatch(selHadTaus_woAbsEtaCut, genJets, 0.5);
-
-      jetGenMatcher.addGenLeptonMatch(selJets, genLeptons, 0.3);
-      jetGenMatcher.addGenHadTauMatch(selJets, genHadTaus, 0.3);
-      jetGenMatcher.addGenJetMatch(selJets, genJets, 0.5);
-    }
+      genMatchTable.clear();
+      if ( isMC ) {
+        genMatchTable.setGenParticles(genLeptons, genHadTaus, genJets);
+        genMatchTable.addRecParticles(muons, preselMuons);
+        genMatchTable.addRecParticles(electrons, preselElectrons);
+        genMatchTable.addRecParticles(hadTaus, selHadTaus_woAbsEtaCut);
+        genMatchTable.addRecParticles(jets, selJets);
+        genMatchTable.computeGenMatches();
+      }
 
+//--- split hadronic tau candidates into different collections,
+//    depending on whether they are genuine hadronic taus, e->tau fakes, mu->tau fakes, or jet->tau fakes
+//   (needs to be done after the matching to generator level particles)
+      std::vector<const RecoHadTau*> selHadTaus_genHadTau;
+      std::vector<const RecoHadTau*> selHadTaus_genElectron;
+      std::vector<const RecoHadTau*> selHadTaus_genMuon;
+      std::vector<const RecoHadTau*> selHadTaus_genJet;
+      for ( std::vector<const RecoHadTau*>::const_iterator hadTau = selHadTaus_wAbsEtaCut.begin();
+	    hadTau != selHadTaus_wAbsEtaCut.end(); ++hadTau ) {
+        const GenMatch& genMatch = genMatchTable.getGenMatch(**hadTau);
+        if      ( genMatch.genHadTau_                                                 ) selHadTaus_genHadTau.push_back(*hadTau);   // generator level match to hadronic tau decay 
+        else if ( genMatch.genLepton_ && std::abs(genMatch.genLepton_->pdgId_) == 11 ) selHadTaus_genElectron.push_back(*hadTau); // generator level match to electron 
+        else if ( genMatch.genLepton_ && std::abs(genMatch.genLepton_->pdgId_) == 13 ) selHadTaus_genMuon.push_back(*hadTau);     // generator level match to muon
+        else                                                                            selHadTaus_genJet.push_back(*hadTau);      // generator level match to jet (or pileup)
+      }
+    
 //--- apply event selection
-    std::sort(preselElectrons.begin(), preselElectrons.end(), isHigherPt);
-    std::sort(preselMuons.begin(), preselMuons.end(), isHigherPt);
-    // require exactly one electron plus one muon passing loose preselection criteria
-    if ( !(preselElectrons.size() == 1 && preselMuons.size() == 1) ) continue;
-
-    std::sort(selElectrons.begin(), selElectrons.end(), isHigherPt);
-    std::sort(selMuons.begin(), selMuons.end(), isHigherPt);
-    // require exactly one electron plus one muon passing tight selection criteria of final event selection 
-    if ( !(selElectrons.size() == 1 && selMuons.size() == 1) ) continue;
-
-    std::vector<const RecoLepton*> selLeptons;    
-    selLeptons.reserve(selElectrons.size() + selMuons.size());
-    selLeptons.insert(selLeptons.end(), selElectrons.begin(), selElectrons.end());
-    selLeptons.insert(selLeptons.end(), selMuons.begin(), selMuons.end());
-    std::sort(selLeptons.begin(), selLeptons.end(), isHigherPt);
-    if ( !(selLeptons.size() == 2) ) continue;
-    const RecoLepton* selLepton_lead = selLeptons[0];
-    int selLepton_lead_type = getLeptonType(selLepton_lead->pdgId_);
-    const RecoLepton* selLepton_sublead = selLeptons[1];
-    int selLepton_sublead_type = getLeptonType(selLepton_sublead->pdgId_);
-
-    // require event to be selected by either single electron, single muon or electron plus muon "cross-trigger" paths
-    if ( !(isTriggered_1e || isTriggered_1mu || isTriggered_1e1mu) ) continue;    
-
-    // apply requirement on jets (incl. b-tagged jets) 
-    if ( !(selJets.size() >= 2) ) continue;
-    if ( !(selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1) ) continue;
+      std::sort(preselElectrons.begin(), preselElectrons.end(), isHigherPt);
+      std::sort(preselMuons.begin(), preselMuons.end(), isHigherPt);
+      // require exactly one electron plus one muon passing loose preselection criteria
+      if ( !cutFlow(cut_preselLeptons, preselElectrons.size() == 1 && preselMuons.size() == 1, lumiScale) ) continue;
+
+      std::sort(selElectrons.begin(), selElectrons.end(), isHigherPt);
+      std::sort(selMuons.begin(), selMuons.end(), isHigherPt);
+      // require exactly one electron plus one muon passing tight selection criteria of final event selection 
+      if ( !cutFlow(cut_selLeptons, selElectrons.size() == 1 && selMuons.size() == 1, lumiScale) ) continue;
+
+      std::vector<const RecoLepton*> selLeptons;    
+      selLeptons.reserve(selElectrons.size() + selMuons.size());
+      selLeptons.insert(selLeptons.end(), selElectrons.begin(), selElectrons.end());
+      selLeptons.insert(selLeptons.end(), selMuons.begin(), selMuons.end());
+      std::sort(selLeptons.begin(), selLeptons.end(), isHigherPt);
+      if ( !cutFlow(cut_selLeptons_2, selLeptons.size() == 2, lumiScale) ) continue;
+      const RecoLepton* selLepton_lead = selLeptons[0];
+      int selLepton_lead_type = getLeptonType(selLepton_lead->pdgId_);
+      const RecoLepton* selLepton_sublead = selLeptons[1];
+      int selLepton_sublead_type = getLeptonType(selLepton_sublead->pdgId_);
+
+      // require event to be selected by either single electron, single muon or electron plus muon "cross-trigger" paths
+      if ( !cutFlow(cut_selLeptons_trigger, isTriggered_1e || isTriggered_1mu || isTriggered_1e1mu, lumiScale) ) continue;    
+
+      // apply requirement on jets (incl. b-tagged jets) 
+      if ( !cutFlow(cut_selJets, selJets.size() >= 2, lumiScale) ) continue;
+      if ( !cutFlow(cut_selBJets, selBJets_loose.size() >= 2 || selBJets_medium.size() >= 1, lumiScale) ) continue;
     
-    // require at least one hadronic tau candidate
-    if ( !(selHadTaus_wAbsEtaCut.size() >= 1) ) continue;
-
-    bool failsLowMassVeto = false;
-    for ( std::vector<const RecoLepton*>::const_iterator lepton1 = selLeptons.begin();
-	  lepton1 != selLeptons.end(); ++lepton1 ) {
-      for ( std::vector<const RecoLepton*>::const_iterator lepton2 = lepton1 + 1;
-	    lepton2 != selLeptons.end(); ++lepton2 ) {
-	if ( ((*lepton1)->p4_ + (*lepton2)->p4_).mass() < 12. ) {
-	  failsLowMassVeto = true;
-	}
+      // require at least one hadronic tau candidate
+      if ( !cutFlow(cut_selHadTaus, selHadTaus_wAbsEtaCut.size() >= 1, lumiScale) ) continue;
+
+      bool failsLowMassVeto = false;
+      for ( std::vector<const RecoLepton*>::const_iterator lepton1 = selLeptons.begin();
+	    lepton1 != selLeptons.end(); ++lepton1 ) {
+        for ( std::vector<const RecoLepton*>::const_iterator lepton2 = lepton1 + 1;
+	      lepton2 != selLeptons.end(); ++lepton2 ) {
+	  if ( ((*lepton1)->p4() + (*lepton2)->p4()).mass() < 12. ) {
+	    failsLowMassVeto = true;
+	  }
+        }
       }
-    }
-    if ( failsLowMassVeto ) continue;
+      if ( !cutFlow(cut_lowMassVeto, !failsLowMassVeto, lumiScale) ) continue;
 
-    double minPt_lead = 20.;
-    double minPt_sublead = selLepton_sublead->is_electron() ? 15. : 10.;
-    if ( !(selLepton_lead->pt_ > minPt_lead && selLepton_sublead->pt_ > minPt_sublead) ) continue;
+      double minPt_lead = 20.;
+      double minPt_sublead = selLepton_sublead->is_electron() ? 15. : 10.;
+      if ( !cutFlow(cut_leptonPt, selLepton_lead->pt_ > minPt_lead && selLepton_sublead->pt_ > minPt_sublead, lumiScale) ) continue;
 
-    bool isCharge_OS = selLepton_lead->charge_*selLepton_sublead->charge_ < 0;
-    if ( !isCharge_OS ) continue;
+      bool isCharge_OS = selLepton_lead->charge_*selLepton_sublead->charge_ < 0;
+      if ( !cutFlow(cut_charge, isCharge_OS, lumiScale) ) continue;
 
 //--- compute MHT and linear MET discriminant (met_LD)
-    LV mht_p4(0,0,0,0);
-    for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin(); 
-	  jet != selJets.end(); ++jet ) {
-      mht_p4 += (*jet)->p4_;
-    }
-    for ( std::vector<const RecoLepton*>::const_iterator lepton = selLeptons.begin();
-	  lepton != selLeptons.end(); ++lepton ) {
-      mht_p4 += (*lepton)->p4_;
-    }
-    // CV: selJets collection has not been cleaned with respect to selHadTaus,
-    //     so no need to iterate over selHadTau collection when computing linear MET discriminant
-    double met_LD = met_coef*met_p4.pt() + mht_coef*mht_p4.pt();    
-    if ( met_LD < 0.2 ) continue;
+      LV mht_p4(0,0,0,0);
+      for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin(); 
+	    jet != selJets.end(); ++jet ) {
+        mht_p4 += (*jet)->p4();
+      }
+      for ( std::vector<const RecoLepton*>::const_iterator lepton = selLeptons.begin();
+	    lepton != selLeptons.end(); ++lepton ) {
+        mht_p4 += (*lepton)->p4();
+      }
+      // CV: selJets collection has not been cleaned with respect to selHadTaus,
+      //     so no need to iterate over selHadTau collection when computing linear MET discriminant
+      double met_LD = met_coef*met_p4.pt() + mht_coef*mht_p4.pt();    
+      if ( !cutFlow(cut_metLD, met_LD >= 0.2, lumiScale) ) continue;
 
 //--- compute event-level weight for data/MC correction of b-tagging efficiency and mistag rate
 //   (using the method "Event reweighting using scale factors calculated with a tag and probe method", 
 //    described on the BTV POG twiki https://twiki.cern.ch/twiki/bin/view/CMS/BTagShapeCalibration )
-    double evtWeight = lumiScale;
-    for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
-	  jet != selJets.end(); ++jet ) {
-      evtWeight *= (*jet)->BtagWeight_;
-    }
+      double evtWeight = lumiScale;
+      for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
+	    jet != selJets.end(); ++jet ) {
+        evtWeight *= (*jet)->BtagWeight_;
+      }
 
 //--- apply data/MC corrections for trigger efficiency,
 //    and efficiencies for lepton to pass loose identification and isolation criteria
-    if ( isMC ) {
-      evtWeight *= sf_triggerEff(selLepton_lead_type, selLepton_lead->pt_, selLepton_lead->eta_, selLepton_sublead_type, selLepton_sublead->pt_, selLepton_sublead->eta_);
-      evtWeight *= sf_leptonID_and_Iso_loose(selLepton_lead_type, selLepton_lead->pt_, selLepton_lead->eta_, selLepton_sublead_type, selLepton_sublead->pt_, selLepton_sublead->eta_);
-    }    
+      if ( isMC ) {
+        evtWeight *= sf_triggerEff(selLepton_lead_type, selLepton_lead->pt_, selLepton_lead->eta_, selLepton_sublead_type, selLepton_sublead->pt_, selLepton_sublead->eta_);
+        evtWeight *= sf_leptonID_and_Iso_loose(selLepton_lead_type, selLepton_lead->pt_, selLepton_lead->eta_, selLepton_sublead_type, selLepton_sublead->pt_, selLepton_sublead->eta_);
+      }    
 
 //--- apply data/MC corrections for efficiencies of leptons passing the loose identification and isolation criteria
 //    to also pass the tight identification and isolation criteria
-    if ( isMC ) {
-      evtWeight *= sf_leptonID_and_Iso_tight_to_loose(selLepton_lead_type, selLepton_lead->pt_, selLepton_lead->eta_, selLepton_sublead_type, selLepton_sublead->pt_, selLepton_sublead->eta_);
-    }
+      if ( isMC ) {
+        evtWeight *= sf_leptonID_and_Iso_tight_to_loose(selLepton_lead_type, selLepton_lead->pt_, selLepton_lead->eta_, selLepton_sublead_type, selLepton_sublead->pt_, selLepton_sublead->eta_);
+      }
 
 //--- fill histograms with events passing final selection 
-    selMuonHistManager.fillHistograms(selMuons, evtWeight);
-    selElectronHistManager.fillHistograms(selElectrons, evtWeight);
-    selHadTauHistManager.fillHistograms(selHadTaus_wAbsEtaCut, evtWeight);
-    selHadTauHistManager_genHadTau.fillHistograms(selHadTaus_genHadTau, evtWeight);
-    selHadTauHistManager_genElectron.fillHistograms(selHadTaus_genElectron, evtWeight);
-    selHadTauHistManager_genMuon.fillHistograms(selHadTaus_genMuon, evtWeight);
-    selHadTauHistManager_genJet.fillHistograms(selHadTaus_genJet, evtWeight);
-    selJetHistManager.fillHistograms(selJets, evtWeight);
-    selJetHistManager_lead.fillHistograms(selJets, evtWeight);
-    selJetHistManager_sublead.fillHistograms(selJets, evtWeight);
-    selBJet_looseHistManager.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_looseHistManager_lead.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_looseHistManager_sublead.fillHistograms(selBJets_loose, evtWeight);
-    selBJet_mediumHistManager.fillHistograms(selBJets_medium, evtWeight);
-    selMEtHistManager.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
-    selEvtHistManager.fillHistograms(selJets.size(), evtWeight);
-
-    (*selEventsFile) << run << ":" << lumi << ":" << event;
-
-    ++selectedEntries;
-    selectedEntries_weighted += evtWeight;
+      histManagers.selMuonHistManager_.fillHistograms(selMuons, genMatchTable, evtWeight);
+      histManagers.selElectronHistManager_.fillHistograms(selElectrons, genMatchTable, evtWeight);
+      histManagers.selHadTauHistManager_.fillHistograms(selHadTaus_wAbsEtaCut, genMatchTable, evtWeight);
+      histManagers.selHadTauHistManager_genHadTau_.fillHistograms(selHadTaus_genHadTau, genMatchTable, evtWeight);
+      histManagers.selHadTauHistManager_genElectron_.fillHistograms(selHadTaus_genElectron, genMatchTable, evtWeight);
+      histManagers.selHadTauHistManager_genMuon_.fillHistograms(selHadTaus_genMuon, genMatchTable, evtWeight);
+      histManagers.selHadTauHistManager_genJet_.fillHistograms(selHadTaus_genJet, genMatchTable, evtWeight);
+      histManagers.selJetHistManager_.fillHistograms(selJets, genMatchTable, evtWeight);
+      histManagers.selJetHistManager_lead_.fillHistograms(selJets, genMatchTable, evtWeight);
+      histManagers.selJetHistManager_sublead_.fillHistograms(selJets, genMatchTable, evtWeight);
+      histManagers.selBJet_looseHistManager_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+      histManagers.selBJet_looseHistManager_lead_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+      histManagers.selBJet_looseHistManager_sublead_.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+      histManagers.selBJet_mediumHistManager_.fillHistograms(selBJets_medium, genMatchTable, evtWeight);
+      histManagers.selMEtHistManager_.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
+      histManagers.selEvtHistManager_.fillHistograms(selJets.size(), evtWeight);
+
+      selEventsFile << run << ":" << lumi << ":" << event;
+
+      ++selectedEntries;
+      selectedEntries_weighted += evtWeight;
+    }
+
+    lock.lock();
+
+    delete run_lumi_eventSelector;
+
+    delete muonReader;
+    delete electronReader;
+    delete hadTauReader;
+    delete jetReader;
+    delete genLeptonReader;
+    delete genHadTauReader;
+    delete genJetReader;
+
+    hltPaths_delete(triggers_1e);
+    hltPaths_delete(triggers_1mu);
+    hltPaths_delete(triggers_1e1mu);
+
+    delete eventSource_ptr;
+    if ( inputTree_worker != inputTree ) delete inputTree_worker;
+    if ( inputCache_worker != inputCache ) delete inputCache_worker;
+  };
+
+  if ( numThreads == 1 ) {
+    processEntries(0);
+  } else {
+    std::vector<std::exception_ptr> exceptions(numThreads);
+    std::vector<std::thread> workers;
+    for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+      workers.push_back(std::thread([&, idxWorker]() {
+        try {
+          processEntries(idxWorker);
+        } catch ( ... ) {
+          exceptions[idxWorker] = std::current_exception();
+        }
+      }));
+    }
+    for ( std::vector<std::thread>::iterator worker = workers.begin();
+	  worker != workers.end(); ++worker ) {
+      worker->join();
+    }
+    for ( std::vector<std::exception_ptr>::const_iterator exception = exceptions.begin();
+	  exception != exceptions.end(); ++exception ) {
+      if ( (*exception) ) std::rethrow_exception(*exception);
+    }
   }
 
-  std::cout << "num. Entries = " << numEntries << std::endl;
+//--- combine results of all threads, in order of the threads,
+//    so that the output does not depend on the order in which the threads have finished
+  int analyzedEntries = 0;
+  int selectedEntries = 0;
+  double selectedEntries_weighted = 0.;
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    (*selEventsFile) << selEventsFiles_workers[idxWorker].str();
+    analyzedEntries += analyzedEntries_workers[idxWorker];
+    selectedEntries += selectedEntries_workers[idxWorker];
+    selectedEntries_weighted += selectedEntries_weighted_workers[idxWorker];
+    if ( idxWorker > 0 ) {
+      cutFlow_workers[0].merge(cutFlow_workers[idxWorker]);
+      histManagers_workers[0]->merge(*histManagers_workers[idxWorker]);
+    }
+  }
+
+//--- add the events accumulated by the HistManagers to the booked histograms
+//    (the histograms of all threads have been merged into those of the first thread before)
+  HistManagerBase::flushAll();
+
+  std::cout << "num. Entries = " << entryRange.size() << std::endl;
   std::cout << " analyzed = " << analyzedEntries << std::endl;
   std::cout << " selected = " << selectedEntries << " (weighted = " << selectedEntries_weighted << ")" << std::endl;
 
-  delete run_lumi_eventSelector;
+  const CutFlowTable& cutFlow = cutFlow_workers[0];
+  cutFlow.print(std::cout);
+  if ( cutFlowFileName != "" ) {
+    std::ofstream cutFlowFile(cutFlowFileName.data(), std::ios::out);
+    CutFlowTable::writeHeader(cutFlowFile);
+    cutFlow.write(cutFlowFile);
+  }
 
   delete selEventsFile;
 
-  delete muonReader;
-  delete electronReader;
-  delete hadTauReader;
-  delete jetReader;
-  delete genLeptonReader;
-  delete genHadTauReader;
-  delete genJetReader;
-
-  hltPaths_delete(triggers_1e);
-  hltPaths_delete(triggers_1mu);
-  hltPaths_delete(triggers_1e1mu);
+  for ( int idxWorker = 0; idxWorker < numThreads; ++idxWorker ) {
+    delete histManagers_workers[idxWorker];
+    // CV: remove copies of histograms filled by threads other than the first from the output file
+    if ( idxWorker > 0 ) fs.getBareDirectory()->rmdir(Form("shard%i", idxWorker));
+  }
+
+  delete inputTree;
+  delete inputCache;
 
   clock.Show("analyze_jetToTauFakeRate");
 
@@ -0,0 +1,204 @@
+#include "FWCore/ParameterSet/interface/ParameterSet.h" // edm::ParameterSet
+#include "FWCore/ParameterSet/interface/FileInPath.h" // edm::FileInPath
+#include "FWCore/PythonParameterSet/interface/MakeParameterSets.h" // edm::readPSetsFrom()
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <TBenchmark.h> // TBenchmark
+#include <TRandom3.h> // TRandom3
+#include <TXMLEngine.h> // TXMLEngine
+#include "TMVA/Reader.h" // TMVA::Reader
+#include "TMVA/MethodBase.h" // TMVA::MethodBase
+#include "TMVA/Tools.h" // TMVA::Tools
+
+#include "tthAnalysis/HiggsToTauTau/interface/BDTForest.h" // BDTForest
+#include "tthAnalysis/HiggsToTauTau/interface/compiledBDTs.h" // findCompiledBDT
+
+#include <iostream> // std::cout
+#include <string> // std::string
+#include <vector> // std::vector<>
+#include <cmath> // std::fabs
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE, std::atof
+
+typedef std::vector<std::string> vstring;
+
+/**
+ * @brief Read names and ranges of the input variables (nodeName = "Variables") or spectators (nodeName = "Spectators")
+ *        from TMVA weight file
+ */
+void readVariables(const std::string& mvaFileName, const std::string& nodeName, vstring& names, std::vector<double>& mins, std::vector<double>& maxs)
+{
+  TXMLEngine xml;
+  XMLDocPointer_t xmlDocument = xml.ParseFile(mvaFileName.data());
+  if ( !xmlDocument )
+    throw cms::Exception("benchmarkBDT")
+      << "Failed to parse file = " << mvaFileName << " !!\n";
+  for ( XMLNodePointer_t xmlNode = xml.GetChild(xml.DocGetRootElement(xmlDocument)); xmlNode; xmlNode = xml.GetNext(xmlNode) ) {
+    if ( nodeName != xml.GetNodeName(xmlNode) ) continue;
+    for ( XMLNodePointer_t xmlVariable = xml.GetChild(xmlNode); xmlVariable; xmlVariable = xml.GetNext(xmlVariable) ) {
+      names.push_back(xml.GetAttr(xmlVariable, "Expression"));
+      mins.push_back(std::atof(xml.GetAttr(xmlVariable, "Min")));
+      maxs.push_back(std::atof(xml.GetAttr(xmlVariable, "Max")));
+    }
+  }
+  xml.FreeDoc(xmlDocument);
+}
+
+/**
+ * @brief Print CPU time and number of events for which the output differs from the output computed by TMVA::Reader
+ */
+void printResult(const std::string& label, double cpuTime, double cpuTime_reference,
+		 const std::vector<double>& mvaOutputs, const std::vector<double>& mvaOutputs_reference)
+{
+  int numMismatches = 0;
+  double maxDiff = 0.;
+  for ( size_t idxEvent = 0; idxEvent < mvaOutputs.size(); ++idxEvent ) {
+    double diff = std::fabs(mvaOutputs[idxEvent] - mvaOutputs_reference[idxEvent]);
+    if ( diff > 0. ) ++numMismatches;
+    if ( diff > maxDiff ) maxDiff = diff;
+  }
+  std::cout << " " << label << ": CPU time = " << cpuTime << " s (speed-up = " << cpuTime_reference/cpuTime << "),"
+	    << " num. mismatches = " << numMismatches << " (out of " << mvaOutputs.size() << "), max. difference = " << maxDiff << std::endl;
+}
+
+/**
+ * @brief Compare the time it takes to book and evaluate the BDTs used in the analysis by TMVA::Reader
+ *        with the time taken by BDTForest and by the BDTs compiled into the library,
+ *        and check that all give the same output.
+ *
+ *        The input values are generated randomly, uniformly within the range of each input variable
+ *        seen in the TMVA training, before the timing starts.
+ */
+int main(int argc, char* argv[])
+{
+//--- parse command-line arguments
+  if ( argc < 2 ) {
+    std::cout << "Usage: " << argv[0] << " [parameters.py]" << std::endl;
+    return EXIT_SUCCESS;
+  }
+
+  std::cout << "<benchmarkBDT>:" << std::endl;
+
+//--- read python configuration parameters
+  if ( !edm::readPSetsFrom(argv[1])->existsAs<edm::ParameterSet>("process") )
+    throw cms::Exception("benchmarkBDT")
+      << "No ParameterSet 'process' found in configuration file = " << argv[1] << " !!\n";
+
+  edm::ParameterSet cfg = edm::readPSetsFrom(argv[1])->getParameter<edm::ParameterSet>("process");
+
+  edm::ParameterSet cfg_benchmark = cfg.getParameter<edm::ParameterSet>("benchmarkBDT");
+
+  vstring mvaFileNames = cfg_benchmark.getParameter<vstring>("mvaFileNames");
+  int numEvents = cfg_benchmark.getParameter<int>("numEvents");
+  int numRepetitions = cfg_benchmark.getParameter<int>("numRepetitions");
+  if ( numEvents <= 0 || numRepetitions <= 0 )
+    throw cms::Exception("benchmarkBDT")
+      << "Invalid Configuration parameters: numEvents = " << numEvents << ", numRepetitions = " << numRepetitions << " !!\n";
+  unsigned seed = cfg_benchmark.getParameter<unsigned>("seed");
+
+  TMVA::Tools::Instance();
+
+  TRandom3 rnd(seed);
+  TBenchmark clock;
+  double checksum = 0.; // CV: prevent the compiler from optimizing away the computations
+
+  for ( vstring::const_iterator mvaFileName = mvaFileNames.begin();
+	mvaFileName != mvaFileNames.end(); ++mvaFileName ) {
+    std::string mvaFileName_full = edm::FileInPath(*mvaFileName).fullPath();
+    std::cout << "MVA = " << (*mvaFileName) << ":" << std::endl;
+
+    vstring mvaInputVariables;
+    std::vector<double> mvaInputVariables_min;
+    std::vector<double> mvaInputVariables_max;
+    readVariables(mvaFileName_full, "Variables", mvaInputVariables, mvaInputVariables_min, mvaInputVariables_max);
+    vstring spectators;
+    std::vector<double> spectators_min;
+    std::vector<double> spectators_max;
+    readVariables(mvaFileName_full, "Spectators", spectators, spectators_min, spectators_max);
+    size_t numVariables = mvaInputVariables.size();
+
+//--- generate input values
+    std::vector<Float_t> mvaInputs(numEvents*numVariables);
+    for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+      for ( size_t idxVariable = 0; idxVariable < numVariables; ++idxVariable ) {
+	mvaInputs[idxEvent*numVariables + idxVariable] = rnd.Uniform(mvaInputVariables_min[idxVariable], mvaInputVariables_max[idxVariable]);
+      }
+    }
+
+//--- evaluate MVA by TMVA::Reader
+    std::vector<Float_t> mvaInputVariables_reader(numVariables);
+    std::vector<Float_t> spectators_reader(spectators.size());
+    TMVA::Reader reader("!V:Silent");
+    for ( size_t idxVariable = 0; idxVariable < numVariables; ++idxVariable ) {
+      reader.AddVariable(mvaInputVariables[idxVariable], &mvaInputVariables_reader[idxVariable]);
+    }
+    for ( size_t idxSpectator = 0; idxSpectator < spectators.size(); ++idxSpectator ) {
+      reader.AddSpectator(spectators[idxSpectator], &spectators_reader[idxSpectator]);
+    }
+    clock.Start("TMVA::Reader (booking)");
+    TMVA::MethodBase* method = dynamic_cast<TMVA::MethodBase*>(reader.BookMVA("BDTG", mvaFileName_full));
+    clock.Stop("TMVA::Reader (booking)");
+    if ( !method )
+      throw cms::Exception("benchmarkBDT")
+	<< "Failed to book MVA from file = " << mvaFileName_full << " !!\n";
+
+    std::vector<double> mvaOutputs_reference(numEvents);
+    clock.Start("TMVA::Reader");
+    for ( int idxRepetition = 0; idxRepetition < numRepetitions; ++idxRepetition ) {
+      for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+	for ( size_t idxVariable = 0; idxVariable < numVariables; ++idxVariable ) {
+	  mvaInputVariables_reader[idxVariable] = mvaInputs[idxEvent*numVariables + idxVariable];
+	}
+	mvaOutputs_reference[idxEvent] = reader.EvaluateMVA(method);
+	checksum += mvaOutputs_reference[idxEvent];
+      }
+    }
+    clock.Stop("TMVA::Reader");
+    double cpuTime_reference = clock.GetCpuTime("TMVA::Reader");
+
+//--- evaluate MVA by BDTForest
+    clock.Start("BDTForest (booking)");
+    BDTForest bdt(mvaFileName_full);
+    clock.Stop("BDTForest (booking)");
+    std::vector<double> mvaOutputs(numEvents);
+    clock.Start("BDTForest");
+    for ( int idxRepetition = 0; idxRepetition < numRepetitions; ++idxRepetition ) {
+      for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+	mvaOutputs[idxEvent] = bdt(&mvaInputs[idxEvent*numVariables]);
+	checksum += mvaOutputs[idxEvent];
+      }
+    }
+    clock.Stop("BDTForest");
+    double cpuTime = clock.GetCpuTime("BDTForest");
+
+    std::cout << " TMVA::Reader: CPU time = " << cpuTime_reference << " s (booking: " << clock.GetCpuTime("TMVA::Reader (booking)") << " s)" << std::endl;
+    std::cout << " BDTForest: booking CPU time = " << clock.GetCpuTime("BDTForest (booking)") << " s" << std::endl;
+    printResult("BDTForest", cpuTime, cpuTime_reference, mvaOutputs, mvaOutputs_reference);
+
+//--- evaluate MVA compiled into the library
+    clock.Start("compiled BDT (booking)");
+    const CompiledBDT* compiledBDT = findCompiledBDT(*mvaFileName, mvaFileName_full);
+    clock.Stop("compiled BDT (booking)");
+    if ( !compiledBDT ) {
+      std::cout << " compiled BDT: not available" << std::endl;
+      continue;
+    }
+    std::cout << " compiled BDT: booking CPU time = " << clock.GetCpuTime("compiled BDT (booking)") << " s" << std::endl;
+    std::vector<int> mvaInputIndices;
+    for ( size_t idxVariable = 0; idxVariable < numVariables; ++idxVariable ) {
+      mvaInputIndices.push_back(idxVariable);
+    }
+    clock.Start("compiled BDT");
+    for ( int idxRepetition = 0; idxRepetition < numRepetitions; ++idxRepetition ) {
+      for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+	mvaOutputs[idxEvent] = (*compiledBDT->function_)(&mvaInputs[idxEvent*numVariables], mvaInputIndices.data());
+	checksum += mvaOutputs[idxEvent];
+      }
+    }
+    clock.Stop("compiled BDT");
+    printResult("compiled BDT", clock.GetCpuTime("compiled BDT"), cpuTime_reference, mvaOutputs, mvaOutputs_reference);
+  }
+
+  std::cout << "(checksum = " << checksum << ")" << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,154 @@
+#include "FWCore/ParameterSet/interface/ParameterSet.h" // edm::ParameterSet
+#include "FWCore/PythonParameterSet/interface/MakeParameterSets.h" // edm::readPSetsFrom()
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+#include "DataFormats/Math/interface/deltaR.h" // deltaR
+
+#include <TBenchmark.h> // TBenchmark
+#include <TRandom3.h> // TRandom3
+#include <TMath.h> // TMath::Pi()
+
+#include "tthAnalysis/HiggsToTauTau/interface/deltaRKernels.h" // comp_deltaR2_min, comp_deltaR2_matrix, setDeltaRKernel
+
+#include <iostream> // std::cout
+#include <iomanip> // std::setw
+#include <string> // std::string
+#include <vector> // std::vector<>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+
+/**
+ * @brief Compare the time it takes to compute dR between two collections of particles
+ *        pair-by-pair (calling deltaR, as done by the analysis code before the vectorized kernels were introduced)
+ *        with the time taken by the scalar, AVX2 and AVX-512 implementations of the kernels.
+ *
+ *        The eta and phi values of the particles are generated randomly before the timing starts.
+ *        For each implementation of the kernels, the number of particles for which the index of the closest particle
+ *        differs from the pair-by-pair computation is reported also.
+ */
+int main(int argc, char* argv[])
+{
+//--- parse command-line arguments
+  if ( argc < 2 ) {
+    std::cout << "Usage: " << argv[0] << " [parameters.py]" << std::endl;
+    return EXIT_SUCCESS;
+  }
+
+  std::cout << "<benchmarkDeltaR>:" << std::endl;
+
+//--- read python configuration parameters
+  if ( !edm::readPSetsFrom(argv[1])->existsAs<edm::ParameterSet>("process") )
+    throw cms::Exception("benchmarkDeltaR")
+      << "No ParameterSet 'process' found in configuration file = " << argv[1] << " !!\n";
+
+  edm::ParameterSet cfg = edm::readPSetsFrom(argv[1])->getParameter<edm::ParameterSet>("process");
+
+  edm::ParameterSet cfg_benchmark = cfg.getParameter<edm::ParameterSet>("benchmarkDeltaR");
+
+  int numEvents = cfg_benchmark.getParameter<int>("numEvents");
+  int numParticles1 = cfg_benchmark.getParameter<int>("numParticles1");
+  int numParticles2 = cfg_benchmark.getParameter<int>("numParticles2");
+  int numRepetitions = cfg_benchmark.getParameter<int>("numRepetitions");
+  if ( numEvents <= 0 || numParticles1 <= 0 || numParticles2 <= 0 || numRepetitions <= 0 )
+    throw cms::Exception("benchmarkDeltaR")
+      << "Invalid Configuration parameters: numEvents = " << numEvents << ", numParticles1 = " << numParticles1 << ","
+      << " numParticles2 = " << numParticles2 << ", numRepetitions = " << numRepetitions << " !!\n";
+  unsigned seed = cfg_benchmark.getParameter<unsigned>("seed");
+
+//--- generate eta and phi of particles
+  TRandom3 rnd(seed);
+  std::vector<float> eta1(numEvents*numParticles1);
+  std::vector<float> phi1(numEvents*numParticles1);
+  for ( int idx = 0; idx < numEvents*numParticles1; ++idx ) {
+    eta1[idx] = rnd.Uniform(-2.5, +2.5);
+    phi1[idx] = rnd.Uniform(-TMath::Pi(), +TMath::Pi());
+  }
+  std::vector<float> eta2(numEvents*numParticles2);
+  std::vector<float> phi2(numEvents*numParticles2);
+  for ( int idx = 0; idx < numEvents*numParticles2; ++idx ) {
+    eta2[idx] = rnd.Uniform(-2.5, +2.5);
+    phi2[idx] = rnd.Uniform(-TMath::Pi(), +TMath::Pi());
+  }
+
+  std::vector<float> dR2min(numEvents*numParticles1);
+  std::vector<int> idxMin(numEvents*numParticles1);
+  std::vector<float> dR2(numParticles1*numParticles2);
+  double checksum = 0.; // CV: prevent the compiler from optimizing away the computations
+
+  TBenchmark clock;
+
+//--- compute dR pair-by-pair
+  std::vector<int> idxMin_reference(numEvents*numParticles1);
+  clock.Start("deltaR");
+  for ( int idxRepetition = 0; idxRepetition < numRepetitions; ++idxRepetition ) {
+    for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+      for ( int idxParticle1 = idxEvent*numParticles1; idxParticle1 < (idxEvent + 1)*numParticles1; ++idxParticle1 ) {
+	double dR_min = 1.e+3;
+	int idxParticle2_min = -1;
+	for ( int idxParticle2 = 0; idxParticle2 < numParticles2; ++idxParticle2 ) {
+	  double dR = deltaR(eta1[idxParticle1], phi1[idxParticle1], eta2[idxEvent*numParticles2 + idxParticle2], phi2[idxEvent*numParticles2 + idxParticle2]);
+	  if ( dR < dR_min ) {
+	    dR_min = dR;
+	    idxParticle2_min = idxParticle2;
+	  }
+	}
+	idxMin_reference[idxParticle1] = idxParticle2_min;
+	checksum += dR_min;
+      }
+    }
+  }
+  clock.Stop("deltaR");
+  double cpuTime_reference = clock.GetCpuTime("deltaR");
+  std::cout << "deltaR (pair-by-pair): CPU time = " << cpuTime_reference << " s" << std::endl;
+
+//--- compute dR using the vectorized kernels
+  const int kernels[] = { kDeltaRKernelScalar, kDeltaRKernelAVX2, kDeltaRKernelAVX512 };
+  for ( int idxKernel = 0; idxKernel < 3; ++idxKernel ) {
+    int kernel = kernels[idxKernel];
+    std::string kernelName = getDeltaRKernelName(kernel);
+    if ( !isDeltaRKernelSupported(kernel) ) {
+      std::cout << kernelName << ": not supported by CPU, skipping." << std::endl;
+      continue;
+    }
+    setDeltaRKernel(kernel);
+
+    std::string clockName_min = kernelName + "_min";
+    clock.Start(clockName_min.data());
+    for ( int idxRepetition = 0; idxRepetition < numRepetitions; ++idxRepetition ) {
+      for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+	comp_deltaR2_min(&eta1[idxEvent*numParticles1], &phi1[idxEvent*numParticles1], numParticles1,
+			 &eta2[idxEvent*numParticles2], &phi2[idxEvent*numParticles2], numParticles2,
+			 &dR2min[idxEvent*numParticles1], &idxMin[idxEvent*numParticles1]);
+	checksum += dR2min[idxEvent*numParticles1];
+      }
+    }
+    clock.Stop(clockName_min.data());
+    double cpuTime_min = clock.GetCpuTime(clockName_min.data());
+
+    int numMismatches = 0;
+    for ( int idxParticle1 = 0; idxParticle1 < numEvents*numParticles1; ++idxParticle1 ) {
+      if ( idxMin[idxParticle1] != idxMin_reference[idxParticle1] ) ++numMismatches;
+    }
+
+    std::string clockName_matrix = kernelName + "_matrix";
+    clock.Start(clockName_matrix.data());
+    for ( int idxRepetition = 0; idxRepetition < numRepetitions; ++idxRepetition ) {
+      for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+	comp_deltaR2_matrix(&eta1[idxEvent*numParticles1], &phi1[idxEvent*numParticles1], numParticles1,
+			    &eta2[idxEvent*numParticles2], &phi2[idxEvent*numParticles2], numParticles2,
+			    dR2.data());
+	checksum += dR2[0];
+      }
+    }
+    clock.Stop(clockName_matrix.data());
+    double cpuTime_matrix = clock.GetCpuTime(clockName_matrix.data());
+
+    std::cout << std::setw(8) << kernelName << ":"
+	      << " CPU time (row minima) = " << cpuTime_min << " s (speed-up = " << cpuTime_reference/cpuTime_min << "),"
+	      << " CPU time (matrix) = " << cpuTime_matrix << " s,"
+	      << " num. mismatches = " << numMismatches << " (out of " << numEvents*numParticles1 << ")" << std::endl;
+  }
+  setDeltaRKernel(kDeltaRKernelAuto);
+
+  std::cout << "(checksum = " << checksum << ")" << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,182 @@
+#include "FWCore/ParameterSet/interface/ParameterSet.h" // edm::ParameterSet
+#include "FWCore/PythonParameterSet/interface/MakeParameterSets.h" // edm::readPSetsFrom()
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+#include "DataFormats/FWLite/interface/InputSource.h" // fwlite::InputSource
+
+#include <Rtypes.h> // Int_t, Long64_t
+#include <TFile.h> // TFile
+#include <TTree.h> // TTree
+#include <TLeaf.h> // TLeaf
+#include <TObjArray.h> // TObjArray
+#include <TBenchmark.h> // TBenchmark
+
+#include "tthAnalysis/HiggsToTauTau/interface/ColumnarCache.h" // ColumnarCacheWriter, getColumnarCacheTypeSize
+
+#include <iostream> // std::cerr, std::fixed
+#include <string> // std::string
+#include <vector> // std::vector<>
+#include <memory> // std::shared_ptr<>
+#include <algorithm> // std::max
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <fnmatch.h> // fnmatch
+
+typedef std::vector<std::string> vstring;
+
+namespace
+{
+  bool isSelected(const std::string& branchName, const vstring& branchNamePatterns)
+  {
+    for ( vstring::const_iterator branchNamePattern = branchNamePatterns.begin();
+	  branchNamePattern != branchNamePatterns.end(); ++branchNamePattern ) {
+      if ( fnmatch(branchNamePattern->data(), branchName.data(), 0) == 0 ) return true;
+    }
+    return false;
+  }
+
+  struct columnType
+  {
+    std::string branchName_;
+    std::string type_;
+    std::string countBranchName_;
+    int length_;
+  };
+
+  void addColumn(std::vector<columnType>& columns, TLeaf* leaf)
+  {
+    std::string branchName = leaf->GetBranch()->GetName();
+    for ( std::vector<columnType>::const_iterator column = columns.begin();
+	  column != columns.end(); ++column ) {
+      if ( column->branchName_ == branchName ) return;
+    }
+    columnType column;
+    column.branchName_ = branchName;
+    column.type_ = leaf->GetTypeName();
+    column.length_ = leaf->GetLenStatic();
+    // CV: add branch holding the number of elements of variable-size arrays before the array itself
+    TLeaf* leafCount = leaf->GetLeafCount();
+    if ( leafCount ) {
+      addColumn(columns, leafCount);
+      column.countBranchName_ = leafCount->GetBranch()->GetName();
+    }
+    columns.push_back(column);
+  }
+}
+
+/**
+ * @brief Copy selected branches of flat Ntuples into a file in columnar cache format,
+ *        which the analyze_* executables can read instead of the Ntuples by setting fwliteInput.inputFormat = 'columnarCache'.
+ */
+int main(int argc, char* argv[])
+{
+//--- parse command-line arguments
+  if ( argc < 2 ) {
+    std::cout << "Usage: " << argv[0] << " [parameters.py]" << std::endl;
+    return EXIT_SUCCESS;
+  }
+
+  std::cout << "<convertToColumnarCache>:" << std::endl;
+
+//--- keep track of time it takes the macro to execute
+  TBenchmark clock;
+  clock.Start("convertToColumnarCache");
+
+//--- read python configuration parameters
+  if ( !edm::readPSetsFrom(argv[1])->existsAs<edm::ParameterSet>("process") )
+    throw cms::Exception("convertToColumnarCache")
+      << "No ParameterSet 'process' found in configuration file = " << argv[1] << " !!\n";
+
+  edm::ParameterSet cfg = edm::readPSetsFrom(argv[1])->getParameter<edm::ParameterSet>("process");
+
+  edm::ParameterSet cfg_convert = cfg.getParameter<edm::ParameterSet>("convertToColumnarCache");
+
+  std::string treeName = cfg_convert.getParameter<std::string>("treeName");
+  std::string outputFileName = cfg_convert.getParameter<std::string>("outputFileName");
+  vstring branchNamePatterns = cfg_convert.getParameter<vstring>("branchNames");
+  int blockSize = cfg_convert.getParameter<int>("blockSize");
+
+  fwlite::InputSource inputFiles(cfg);
+  int maxEvents = inputFiles.maxEvents();
+  std::cout << " maxEvents = " << maxEvents << std::endl;
+  unsigned reportEvery = inputFiles.reportAfter();
+
+  if ( inputFiles.files().empty() )
+    throw cms::Exception("convertToColumnarCache")
+      << "No input files given !!\n";
+
+  ColumnarCacheWriter writer(outputFileName, blockSize);
+  std::vector<columnType> columns;
+
+  int processedEntries = 0;
+  for ( vstring::const_iterator inputFileName = inputFiles.files().begin();
+	inputFileName != inputFiles.files().end() && (maxEvents == -1 || processedEntries < maxEvents); ++inputFileName ) {
+    std::cout << "input Tree: opening file = " << (*inputFileName) << std::endl;
+    TFile* inputFile = TFile::Open(inputFileName->data());
+    if ( !inputFile || inputFile->IsZombie() )
+      throw cms::Exception("convertToColumnarCache")
+	<< "Failed to open input file = " << (*inputFileName) << " !!\n";
+    TTree* inputTree = dynamic_cast<TTree*>(inputFile->Get(treeName.data()));
+    if ( !inputTree )
+      throw cms::Exception("convertToColumnarCache")
+	<< "Failed to find tree = " << treeName << " in input file = " << (*inputFileName) << " !!\n";
+
+//--- select columns based on the first file; all subsequent files need to contain the same branches
+    if ( columns.empty() ) {
+      TObjArray* leaves = inputTree->GetListOfLeaves();
+      for ( int idxLeaf = 0; idxLeaf < leaves->GetEntries(); ++idxLeaf ) {
+	TLeaf* leaf = dynamic_cast<TLeaf*>(leaves->At(idxLeaf));
+	if ( !leaf || !isSelected(leaf->GetBranch()->GetName(), branchNamePatterns) ) continue;
+	addColumn(columns, leaf);
+      }
+      if ( columns.empty() )
+	throw cms::Exception("convertToColumnarCache")
+	  << "No branches selected in input file = " << (*inputFileName) << " !!\n";
+      for ( std::vector<columnType>::const_iterator column = columns.begin();
+	    column != columns.end(); ++column ) {
+	writer.addColumn(column->branchName_, column->type_, column->countBranchName_, column->length_);
+      }
+      std::cout << "writing " << columns.size() << " columns to file = " << outputFileName << std::endl;
+    }
+
+//--- allocate buffers large enough to hold the largest collection stored in the current file
+    inputTree->SetBranchStatus("*", 0);
+    std::vector<std::shared_ptr<char> > buffers;
+    std::vector<const void*> data;
+    for ( std::vector<columnType>::const_iterator column = columns.begin();
+	  column != columns.end(); ++column ) {
+      TLeaf* leaf = inputTree->GetLeaf(column->branchName_.data());
+      if ( !leaf )
+	throw cms::Exception("convertToColumnarCache")
+	  << "No branch = " << column->branchName_ << " found in input file = " << (*inputFileName) << " !!\n";
+      if ( leaf->GetTypeName() != column->type_ )
+	throw cms::Exception("convertToColumnarCache")
+	  << "Type of branch = " << column->branchName_ << " in input file = " << (*inputFileName) << " does not match type of column !!\n";
+      TLeaf* leafCount = leaf->GetLeafCount();
+      int numElements = std::max(( leafCount ) ? leafCount->GetMaximum() : leaf->GetLenStatic(), 1);
+      buffers.push_back(std::shared_ptr<char>(new char[numElements*getColumnarCacheTypeSize(column->type_)](), std::default_delete<char[]>()));
+      data.push_back(buffers.back().get());
+      inputTree->SetBranchStatus(column->branchName_.data(), 1);
+      inputTree->SetBranchAddress(column->branchName_.data(), buffers.back().get());
+    }
+
+    Long64_t numEntries = inputTree->GetEntries();
+    for ( Long64_t idxEntry = 0; idxEntry < numEntries && (maxEvents == -1 || processedEntries < maxEvents); ++idxEntry ) {
+      if ( processedEntries > 0 && (processedEntries % reportEvery) == 0 ) {
+	std::cout << "processing Entry " << processedEntries << std::endl;
+      }
+      inputTree->GetEntry(idxEntry);
+      writer.fill(data);
+      ++processedEntries;
+    }
+
+    inputTree->ResetBranchAddresses();
+    delete inputFile;
+  }
+
+  writer.close();
+
+  std::cout << "num. Entries written = " << processedEntries << std::endl;
+
+  clock.Show("convertToColumnarCache");
+
+  return EXIT_SUCCESS;
+}
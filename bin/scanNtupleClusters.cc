@@ -0,0 +1,119 @@
+#include "FWCore/ParameterSet/interface/ParameterSet.h" // edm::ParameterSet
+#include "FWCore/PythonParameterSet/interface/MakeParameterSets.h" // edm::readPSetsFrom()
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+#include "DataFormats/FWLite/interface/InputSource.h" // fwlite::InputSource
+
+#include <Rtypes.h> // Long64_t
+#include <TFile.h> // TFile
+#include <TTree.h> // TTree
+#include <TBenchmark.h> // TBenchmark
+
+#include <iostream> // std::cout
+#include <fstream> // std::ofstream
+#include <string> // std::string
+#include <vector> // std::vector<>
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+
+typedef std::vector<std::string> vstring;
+
+/**
+ * @brief Report number of entries and cluster boundaries of each input file.
+ *
+ *        Only the tree headers are read, no baskets get decompressed, so the scan is fast even for large Ntuples.
+ *        The output (in JSON format) is used by tthAnalyzeRun.py to split the input into jobs of similar number of events,
+ *        with job boundaries aligned to the cluster boundaries, so that no cluster needs to be read by more than one job.
+ */
+int main(int argc, char* argv[])
+{
+//--- parse command-line arguments
+  if ( argc < 2 ) {
+    std::cout << "Usage: " << argv[0] << " [parameters.py]" << std::endl;
+    return EXIT_SUCCESS;
+  }
+
+  std::cout << "<scanNtupleClusters>:" << std::endl;
+
+//--- keep track of time it takes the macro to execute
+  TBenchmark clock;
+  clock.Start("scanNtupleClusters");
+
+//--- read python configuration parameters
+  if ( !edm::readPSetsFrom(argv[1])->existsAs<edm::ParameterSet>("process") )
+    throw cms::Exception("scanNtupleClusters")
+      << "No ParameterSet 'process' found in configuration file = " << argv[1] << " !!\n";
+
+  edm::ParameterSet cfg = edm::readPSetsFrom(argv[1])->getParameter<edm::ParameterSet>("process");
+
+  edm::ParameterSet cfg_scan = cfg.getParameter<edm::ParameterSet>("scanNtupleClusters");
+
+  std::string treeName = cfg_scan.getParameter<std::string>("treeName");
+  std::string outputFileName = cfg_scan.getParameter<std::string>("outputFileName");
+
+  fwlite::InputSource inputFiles(cfg);
+
+  std::ofstream* outputFile = 0;
+  if ( outputFileName != "" ) {
+    outputFile = new std::ofstream(outputFileName.data());
+    if ( !outputFile->good() )
+      throw cms::Exception("scanNtupleClusters")
+	<< "Failed to open output file = " << outputFileName << " !!\n";
+    (*outputFile) << "{" << std::endl;
+    (*outputFile) << "  \"treeName\" : \"" << treeName << "\"," << std::endl;
+    (*outputFile) << "  \"files\" : [" << std::endl;
+  }
+
+  Long64_t numEntries_total = 0;
+  for ( vstring::const_iterator inputFileName = inputFiles.files().begin();
+	inputFileName != inputFiles.files().end(); ++inputFileName ) {
+    TFile* inputFile = TFile::Open(inputFileName->data());
+    if ( !inputFile || inputFile->IsZombie() )
+      throw cms::Exception("scanNtupleClusters")
+	<< "Failed to open input file = " << (*inputFileName) << " !!\n";
+    TTree* inputTree = dynamic_cast<TTree*>(inputFile->Get(treeName.data()));
+    if ( !inputTree )
+      throw cms::Exception("scanNtupleClusters")
+	<< "Failed to find tree = " << treeName << " in input file = " << (*inputFileName) << " !!\n";
+
+    Long64_t numEntries = inputTree->GetEntries();
+    std::vector<Long64_t> clusterBoundaries;
+    // CV: TTree::TClusterIterator takes the cluster boundaries from the tree header (fAutoFlush and fClusterRangeEnd),
+    //     it does not need to read any baskets
+    TTree::TClusterIterator cluster = inputTree->GetClusterIterator(0);
+    Long64_t clusterStart;
+    while ( (clusterStart = cluster.Next()) < numEntries ) {
+      clusterBoundaries.push_back(clusterStart);
+    }
+    std::cout << (*inputFileName) << ": " << numEntries << " entries in " << clusterBoundaries.size() << " clusters" << std::endl;
+    numEntries_total += numEntries;
+
+    if ( outputFile ) {
+      (*outputFile) << "    {" << std::endl;
+      (*outputFile) << "      \"fileName\" : \"" << (*inputFileName) << "\"," << std::endl;
+      (*outputFile) << "      \"entries\" : " << numEntries << "," << std::endl;
+      (*outputFile) << "      \"clusters\" : [";
+      for ( std::vector<Long64_t>::const_iterator clusterBoundary = clusterBoundaries.begin();
+	    clusterBoundary != clusterBoundaries.end(); ++clusterBoundary ) {
+	if ( clusterBoundary != clusterBoundaries.begin() ) (*outputFile) << ", ";
+	(*outputFile) << (*clusterBoundary);
+      }
+      (*outputFile) << "]" << std::endl;
+      (*outputFile) << "    }";
+      if ( (inputFileName + 1) != inputFiles.files().end() ) (*outputFile) << ",";
+      (*outputFile) << std::endl;
+    }
+
+    delete inputFile;
+  }
+
+  if ( outputFile ) {
+    (*outputFile) << "  ]" << std::endl;
+    (*outputFile) << "}" << std::endl;
+    delete outputFile;
+  }
+
+  std::cout << "num. Entries = " << numEntries_total << " in " << inputFiles.files().size() << " files" << std::endl;
+
+  clock.Show("scanNtupleClusters");
+
+  return EXIT_SUCCESS;
+}
@@ -31,10 +31,12 @@
 //#include "tthAnalysis/HiggsToTauTau/interface/GenLeptonReader.h" // GenLeptonReader
 //#include "tthAnalysis/HiggsToTauTau/interface/GenHadTauReader.h" // GenHadTauReader
 //#include "tthAnalysis/HiggsToTauTau/interface/GenJetReader.h" // GenJetReader
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource
 #include "tthAnalysis/HiggsToTauTau/interface/convert_to_ptrs.h" // convert_to_ptrs
 #include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionCleaner.h" // RecoElectronCollectionCleaner, RecoMuonCollectionCleaner, RecoHadTauCollectionCleaner, RecoJetCollectionCleaner
-#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionGenMatcher.h" // RecoElectronCollectionGenMatcher, RecoMuonCollectionGenMatcher, RecoHadTauCollectionGenMatcher, RecoJetCollectionGenMatcher
-#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionSelector.h" // RecoElectronSelectorLoose, RecoElectronSelectorTight, RecoMuonSelectorLoose, RecoMuonSelectorTight, RecoHadTauSelectorTight
+#include "tthAnalysis/HiggsToTauTau/interface/GenMatchTable.h" // GenMatchTable
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionSelector.h" // RecoHadTauCollectionSelectorLoose, RecoJetCollectionSelector
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionMultiSelector.h" // RecoMuonCollectionMultiSelector, RecoElectronCollectionMultiSelector
 #include "tthAnalysis/HiggsToTauTau/interface/RunLumiEventSelector.h" // RunLumiEventSelector
 //#include "tthAnalysis/HiggsToTauTau/interface/ElectronHistManager.h" // ElectronHistManager
 //#include "tthAnalysis/HiggsToTauTau/interface/MuonHistManager.h" // MuonHistManager
@@ -214,48 +216,43 @@ int main(int argc, char* argv[])
   std::cout << "input Tree contains " << inputTree->GetEntries() << " Entries in " << inputTree->GetListOfFiles()->GetEntries() << " files." << std::endl;
 
 //--- declare event-level variables
+  EventSource eventSource(inputTree);
+
   RUN_TYPE run;
-  inputTree->SetBranchAddress(RUN_KEY, &run);
+  eventSource.setBranchAddress(RUN_KEY, &run);
   LUMI_TYPE lumi;
-  inputTree->SetBranchAddress(LUMI_KEY, &lumi);
+  eventSource.setBranchAddress(LUMI_KEY, &lumi);
   EVT_TYPE event;
-  inputTree->SetBranchAddress(EVT_KEY, &event);
+  eventSource.setBranchAddress(EVT_KEY, &event);
 
-//  hltPaths_setBranchAddresses(inputTree, triggers_1e);
-//  hltPaths_setBranchAddresses(inputTree, triggers_2e);
-//  hltPaths_setBranchAddresses(inputTree, triggers_1mu);
-//  hltPaths_setBranchAddresses(inputTree, triggers_2mu);
-//  hltPaths_setBranchAddresses(inputTree, triggers_1e1mu);
+//  hltPaths_setBranchAddresses(eventSource, triggers_1e);
+//  hltPaths_setBranchAddresses(eventSource, triggers_2e);
+//  hltPaths_setBranchAddresses(eventSource, triggers_1mu);
+//  hltPaths_setBranchAddresses(eventSource, triggers_2mu);
+//  hltPaths_setBranchAddresses(eventSource, triggers_1e1mu);
 
   MET_PT_TYPE met_pt;
-  inputTree->SetBranchAddress(MET_PT_KEY, &met_pt);
+  eventSource.setBranchAddress(MET_PT_KEY, &met_pt);
   MET_ETA_TYPE met_eta;
-  inputTree->SetBranchAddress(MET_ETA_KEY, &met_eta);
+  eventSource.setBranchAddress(MET_ETA_KEY, &met_eta);
   MET_PHI_TYPE met_phi;
-  inputTree->SetBranchAddress(MET_PHI_KEY, &met_phi);
+  eventSource.setBranchAddress(MET_PHI_KEY, &met_phi);
   LV met_p4(met_pt, met_eta, met_phi, 0.);
 
 //--- declare particle collections
   RecoMuonReader* muonReader = new RecoMuonReader("nselLeptons", "selLeptons");
-  muonReader->setBranchAddresses(inputTree);
-//  RecoMuonCollectionGenMatcher muonGenMatcher;
-  RecoMuonCollectionSelectorLoose preselMuonSelector;
-  RecoMuonCollectionSelectorFakeable fakeableMuonSelector;
-  RecoMuonCollectionSelectorCutBased cutBasedSelector;
-  RecoMuonCollectionSelectorMVABased mvaBasedSelector;
+  muonReader->setBranchAddresses(eventSource);
+  RecoMuonCollectionMultiSelector muonSelector;
+  RecoMuonCollectionSelection muonSelection;
 
   RecoElectronReader* electronReader = new RecoElectronReader("nselLeptons", "selLeptons");
-  electronReader->setBranchAddresses(inputTree);
-//  RecoElectronCollectionGenMatcher electronGenMatcher;
+  electronReader->setBranchAddresses(eventSource);
   RecoElectronCollectionCleaner electronCleaner(0.05); // KE: 0.3 -> 0.05
-  RecoElectronCollectionSelectorLoose preselElectronSelector;
-  RecoElectronCollectionSelectorFakeable fakeableElectronSelector;
-  RecoElectronCollectionSelectorCutBased cutBasedElectronSelector;
-  RecoElectronCollectionSelectorMVABased mvaBasedElectronSelector;
+  RecoElectronCollectionMultiSelector electronSelector;
+  RecoElectronCollectionSelection electronSelection;
 
   RecoHadTauReader* hadTauReader = new RecoHadTauReader("nTauGood", "TauGood");
-  hadTauReader->setBranchAddresses(inputTree);
-//  RecoHadTauCollectionGenMatcher hadTauGenMatcher;
+  hadTauReader->setBranchAddresses(eventSource);
   RecoHadTauCollectionCleaner hadTauCleaner(0.4); // KE: 0.3 -> 0.4
   RecoHadTauCollectionSelectorLoose hadTauSelector; // KE: Tight -> Loose
   
@@ -263,8 +260,7 @@ int main(int argc, char* argv[])
   jetReader->setJetPt_central_or_shift(jetPt_option);
 //  jetReader->setBranchName_BtagWeight(jet_btagWeight_branch);
   jetReader->setBranchName_BtagWeight("");
-  jetReader->setBranchAddresses(inputTree);
-//  RecoJetCollectionGenMatcher jetGenMatcher;
+  jetReader->setBranchAddresses(eventSource);
   RecoJetCollectionCleaner jetCleaner(0.4); // KE: 0.5 -> 0.4
   RecoJetCollectionSelector jetSelector;  
 //  RecoJetCollectionSelectorBtagLoose jetSelectorBtagLoose;
@@ -275,12 +271,13 @@ int main(int argc, char* argv[])
 //  GenJetReader* genJetReader = 0;
 //  if ( isMC ) {
 //    genLeptonReader = new GenLeptonReader("nGenLep", "GenLep");
-//    genLeptonReader->setBranchAddresses(inputTree);
+//    genLeptonReader->setBranchAddresses(eventSource);
 //    genHadTauReader = new GenHadTauReader("nGenHadTaus", "GenHadTaus");
-//    genHadTauReader->setBranchAddresses(inputTree);
+//    genHadTauReader->setBranchAddresses(eventSource);
 //    genJetReader = new GenJetReader("nGenJet", "GenJet");
-//    genJetReader->setBranchAddresses(inputTree);
+//    genJetReader->setBranchAddresses(eventSource);
 //  }
+//  GenMatchTable genMatchTable;
 
 //--- initialize BDTs used to discriminate ttH vs. ttV and ttH vs. ttbar 
 //    in 2lss_1tau category of ttH multilepton analysis
@@ -444,6 +441,11 @@ int main(int argc, char* argv[])
   SyncNtupleManager snm(outputFileName, outputTreeName);
   snm.initializeBranches();
 
+//--- disable all branches that are not read by any of the readers,
+//    so that TTree::GetEntry does not unzip them
+  eventSource.getManifest().setBranchStatus(inputTree);
+  eventSource.getManifest().print(inputTree, std::cout);
+
   int numEntries = inputTree->GetEntries();
   int analyzedEntries = 0;
   int selectedEntries = 0;
@@ -468,27 +470,25 @@ int main(int argc, char* argv[])
 
 //--- build collections of electrons, muons and hadronic taus;
 //    resolve overlaps in order of priority: muon, electron,
+//    (the loose, fakeable, cut-based and MVA-based lepton selections are evaluated in a single pass,
+//     the collections are sorted by pT before, as the selection keeps the order of the particles)
     std::vector<RecoMuon> muons = muonReader->read();
     std::vector<const RecoMuon*> muon_ptrs = convert_to_ptrs(muons);
     std::vector<const RecoMuon*> cleanedMuons = muon_ptrs; // CV: no cleaning needed for muons, as they have the highest priority in the overlap removal
-    std::vector<const RecoMuon*> preselMuons = preselMuonSelector(cleanedMuons);
-    std::vector<const RecoMuon*> fakeableMuons = fakeableMuonSelector(preselMuons);
-    std::vector<const RecoMuon*> cutBasedMuons = cutBasedSelector(preselMuons);
-    std::vector<const RecoMuon*> mvaBasedMuons = mvaBasedSelector(preselMuons);
+    std::sort(cleanedMuons.begin(), cleanedMuons.end(), isHigherPt);
+    muonSelector(cleanedMuons, muonSelection);
+    std::vector<const RecoMuon*> preselMuons = muonSelection.filter(kSelectionLoose);
     std::vector<const RecoMuon*> selMuons = preselMuons;
-    std::sort(preselMuons.begin(), preselMuons.end(), isHigherPt);
-    snm.read(preselMuons, fakeableMuons, cutBasedMuons, mvaBasedMuons);
+    snm.read(muonSelection);
 
     std::vector<RecoElectron> electrons = electronReader->read();
     std::vector<const RecoElectron*> electron_ptrs = convert_to_ptrs(electrons);
     std::vector<const RecoElectron*> cleanedElectrons = electronCleaner(electron_ptrs, selMuons);
-    std::vector<const RecoElectron*> preselElectrons = preselElectronSelector(cleanedElectrons);
-    std::vector<const RecoElectron*> fakeableElectrons = fakeableElectronSelector(preselElectrons);
-    std::vector<const RecoElectron*> cutBasedElectrons = cutBasedElectronSelector(preselElectrons);
-    std::vector<const RecoElectron*> mvaBasedElectrons = mvaBasedElectronSelector(preselElectrons);
+    std::sort(cleanedElectrons.begin(), cleanedElectrons.end(), isHigherPt);
+    electronSelector(cleanedElectrons, electronSelection);
+    std::vector<const RecoElectron*> preselElectrons = electronSelection.filter(kSelectionLoose);
     std::vector<const RecoElectron*> selElectrons = preselElectrons;
-    std::sort(preselElectrons.begin(), preselElectrons.end(), isHigherPt);
-    snm.read(preselElectrons, fakeableElectrons, cutBasedElectrons, mvaBasedElectrons);
+    snm.read(electronSelection);
 
     std::vector<RecoHadTau> hadTaus = hadTauReader->read();
     std::vector<const RecoHadTau*> hadTau_ptrs = convert_to_ptrs(hadTaus);
@@ -526,22 +526,14 @@ int main(int argc, char* argv[])
 //    }
 
 //--- match reconstructed to generator level particles
+//    genMatchTable.clear();
 //    if ( isMC ) {
-//      muonGenMatcher.addGenLeptonMatch(preselMuons, genLeptons, 0.3);
-//      muonGenMatcher.addGenHadTauMatch(preselMuons, genHadTaus, 0.3);
-//      muonGenMatcher.addGenJetMatch(preselMuons, genJets, 0.5);
-
-//      electronGenMatcher.addGenLeptonMatch(preselElectrons, genLeptons, 0.3);
-//      electronGenMatcher.addGenHadTauMatch(preselElectrons, genHadTaus, 0.3);
-//      electronGenMatcher.addGenJetMatch(preselElectrons, genJets, 0.5);
-
-//      hadTauGenMatcher.addGenLeptonMatch(selHadTaus, genLeptons, 0.3);
-//      hadTauGenMatcher.addGenHadTauMatch(selHadTaus, genHadTaus, 0.3);
-//      hadTauGenMatcher.addGenJetMatch(selHadTaus, genJets, 0.5);
-
-//      jetGenMatcher.addGenLeptonMatch(selJets, genLeptons, 0.3);
-//      jetGenMatcher.addGenHadTauMatch(selJets, genHadTaus, 0.3);
-//      jetGenMatcher.addGenJetMatch(selJets, genJets, 0.5);
+//      genMatchTable.setGenParticles(genLeptons, genHadTaus, genJets);
+//      genMatchTable.addRecParticles(muons, preselMuons);
+//      genMatchTable.addRecParticles(electrons, preselElectrons);
+//      genMatchTable.addRecParticles(hadTaus, selHadTaus);
+//      genMatchTable.addRecParticles(jets, selJets);
+//      genMatchTable.computeGenMatches();
 //    }
 
 //--- apply preselection
@@ -571,15 +563,15 @@ int main(int argc, char* argv[])
     LV mht_p4(0,0,0,0);
     for ( std::vector<const RecoJet*>::const_iterator jet = selJets.begin();
           jet != selJets.end(); ++jet ) {
-      mht_p4 += (*jet)->p4_;
+      mht_p4 += (*jet)->p4();
     }
     for ( std::vector<const RecoLepton*>::const_iterator lepton = preselLeptons.begin();
           lepton != preselLeptons.end(); ++lepton ) {
-      mht_p4 += (*lepton)->p4_;
+      mht_p4 += (*lepton)->p4();
     }
     for ( std::vector<const RecoHadTau*>::const_iterator hadTau = selHadTaus.begin();
           hadTau != selHadTaus.end(); ++hadTau ) {
-      mht_p4 += (*hadTau)->p4_;
+      mht_p4 += (*hadTau)->p4();
     }
     const Double_t met_LD = met_coef*met_p4.pt() + mht_coef*mht_p4.pt();
 
@@ -648,12 +640,12 @@ int main(int argc, char* argv[])
 //    else                                                                  mvaDiscr_2lss = 1.;
 
 //--- fill histograms with events passing preselection
-//    preselMuonHistManager.fillHistograms(preselMuons, evtWeight);
-//    preselElectronHistManager.fillHistograms(preselElectrons, evtWeight);
-//    preselHadTauHistManager.fillHistograms(selHadTaus, evtWeight);
-//    preselJetHistManager.fillHistograms(selJets, evtWeight);
-//    selBJet_looseHistManager.fillHistograms(selBJets_loose, evtWeight);
-//    selBJet_mediumHistManager.fillHistograms(selBJets_medium, evtWeight);
+//    preselMuonHistManager.fillHistograms(preselMuons, genMatchTable, evtWeight);
+//    preselElectronHistManager.fillHistograms(preselElectrons, genMatchTable, evtWeight);
+//    preselHadTauHistManager.fillHistograms(selHadTaus, genMatchTable, evtWeight);
+//    preselJetHistManager.fillHistograms(selJets, genMatchTable, evtWeight);
+//    selBJet_looseHistManager.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+//    selBJet_mediumHistManager.fillHistograms(selBJets_medium, genMatchTable, evtWeight);
 //    preselMEtHistManager.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
 //    preselEvtHistManager.fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight);
 
@@ -683,7 +675,7 @@ int main(int argc, char* argv[])
 //	  lepton1 != selLeptons.end(); ++lepton1 ) {
 //      for ( std::vector<const RecoLepton*>::const_iterator lepton2 = lepton1 + 1;
 //	    lepton2 != selLeptons.end(); ++lepton2 ) {
-//	if ( ((*lepton1)->p4_ + (*lepton2)->p4_).mass() < 12. ) {
+//	if ( ((*lepton1)->p4() + (*lepton2)->p4()).mass() < 12. ) {
 //	  failsLowMassVeto = true;
 //	}
 //      }
@@ -705,7 +697,7 @@ int main(int argc, char* argv[])
 //	    lepton1 != selLeptons.end(); ++lepton1 ) {
 //	for ( std::vector<const RecoLepton*>::const_iterator lepton2 = lepton1 + 1;
 //	      lepton2 != selLeptons.end(); ++lepton2 ) {
-//	  if ( std::fabs(((*lepton1)->p4_ + (*lepton2)->p4_).mass() - z_mass) < z_window ) {
+//	  if ( std::fabs(((*lepton1)->p4() + (*lepton2)->p4()).mass() - z_mass) < z_window ) {
 //	    failsZbosonMassVeto = true;
 //	  }
 //	}
@@ -732,16 +724,16 @@ int main(int argc, char* argv[])
 //    }
 
 //--- fill histograms with events passing final selection 
-//    selMuonHistManager.fillHistograms(selMuons, evtWeight);
-//    selElectronHistManager.fillHistograms(selElectrons, evtWeight);
-//    selHadTauHistManager.fillHistograms(selHadTaus, evtWeight);
-//    selJetHistManager.fillHistograms(selJets, evtWeight);
-//    selJetHistManager_lead.fillHistograms(selJets, evtWeight);
-//    selJetHistManager_sublead.fillHistograms(selJets, evtWeight);
-//    selBJet_looseHistManager.fillHistograms(selBJets_loose, evtWeight);
-//    selBJet_looseHistManager_lead.fillHistograms(selBJets_loose, evtWeight);
-//    selBJet_looseHistManager_sublead.fillHistograms(selBJets_loose, evtWeight);
-//    selBJet_mediumHistManager.fillHistograms(selBJets_medium, evtWeight);
+//    selMuonHistManager.fillHistograms(selMuons, genMatchTable, evtWeight);
+//    selElectronHistManager.fillHistograms(selElectrons, genMatchTable, evtWeight);
+//    selHadTauHistManager.fillHistograms(selHadTaus, genMatchTable, evtWeight);
+//    selJetHistManager.fillHistograms(selJets, genMatchTable, evtWeight);
+//    selJetHistManager_lead.fillHistograms(selJets, genMatchTable, evtWeight);
+//    selJetHistManager_sublead.fillHistograms(selJets, genMatchTable, evtWeight);
+//    selBJet_looseHistManager.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+//    selBJet_looseHistManager_lead.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+//    selBJet_looseHistManager_sublead.fillHistograms(selBJets_loose, genMatchTable, evtWeight);
+//    selBJet_mediumHistManager.fillHistograms(selBJets_medium, genMatchTable, evtWeight);
 //    selMEtHistManager.fillHistograms(met_p4, mht_p4, met_LD, evtWeight);
 //    selEvtHistManager.fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight);
 
@@ -764,52 +756,52 @@ int main(int argc, char* argv[])
 //    else assert(0);
 
 //    if ( category == k2epp_btight ) {
-//      selElectronHistManager_category["2epp_1tau_btight"]["leadElectron"]->fillHistograms(selElectrons, evtWeight_pp);
-//      selElectronHistManager_category["2epp_1tau_btight"]["subleadElectron"]->fillHistograms(selElectrons, evtWeight_pp);
+//      selElectronHistManager_category["2epp_1tau_btight"]["leadElectron"]->fillHistograms(selElectrons, genMatchTable, evtWeight_pp);
+//      selElectronHistManager_category["2epp_1tau_btight"]["subleadElectron"]->fillHistograms(selElectrons, genMatchTable, evtWeight_pp);
 //      selEvtHistManager_category["2epp_1tau_btight"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_pp);
 //    } else if ( category == k2epp_bloose ) {
-//      selElectronHistManager_category["2epp_1tau_bloose"]["leadElectron"]->fillHistograms(selElectrons, evtWeight_pp);
-//      selElectronHistManager_category["2epp_1tau_bloose"]["subleadElectron"]->fillHistograms(selElectrons, evtWeight_pp);
+//      selElectronHistManager_category["2epp_1tau_bloose"]["leadElectron"]->fillHistograms(selElectrons, genMatchTable, evtWeight_pp);
+//      selElectronHistManager_category["2epp_1tau_bloose"]["subleadElectron"]->fillHistograms(selElectrons, genMatchTable, evtWeight_pp);
 //      selEvtHistManager_category["2epp_1tau_bloose"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_pp);
 //    } else if ( category == k2emm_btight ) {
-//      selElectronHistManager_category["2emm_1tau_btight"]["leadElectron"]->fillHistograms(selElectrons, evtWeight_mm);
-//      selElectronHistManager_category["2emm_1tau_btight"]["subleadElectron"]->fillHistograms(selElectrons, evtWeight_mm);
+//      selElectronHistManager_category["2emm_1tau_btight"]["leadElectron"]->fillHistograms(selElectrons, genMatchTable, evtWeight_mm);
+//      selElectronHistManager_category["2emm_1tau_btight"]["subleadElectron"]->fillHistograms(selElectrons, genMatchTable, evtWeight_mm);
 //      selEvtHistManager_category["2emm_1tau_btight"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_mm);
 //    } else if ( category == k2emm_bloose ) {
-//      selElectronHistManager_category["2emm_1tau_bloose"]["leadElectron"]->fillHistograms(selElectrons, evtWeight_mm);
-//      selElectronHistManager_category["2emm_1tau_bloose"]["subleadElectron"]->fillHistograms(selElectrons, evtWeight_mm);
+//      selElectronHistManager_category["2emm_1tau_bloose"]["leadElectron"]->fillHistograms(selElectrons, genMatchTable, evtWeight_mm);
+//      selElectronHistManager_category["2emm_1tau_bloose"]["subleadElectron"]->fillHistograms(selElectrons, genMatchTable, evtWeight_mm);
 //      selEvtHistManager_category["2emm_1tau_bloose"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_mm);
 //    } else if ( category == k1e1mupp_btight ) {
-//      selElectronHistManager_category["1e1mupp_1tau_btight"]["electron"]->fillHistograms(selElectrons, evtWeight_pp);
-//      selMuonHistManager_category["1e1mupp_1tau_btight"]["muon"]->fillHistograms(selMuons, evtWeight_pp);
+//      selElectronHistManager_category["1e1mupp_1tau_btight"]["electron"]->fillHistograms(selElectrons, genMatchTable, evtWeight_pp);
+//      selMuonHistManager_category["1e1mupp_1tau_btight"]["muon"]->fillHistograms(selMuons, genMatchTable, evtWeight_pp);
 //      selEvtHistManager_category["1e1mupp_1tau_btight"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_pp);
 //    } else if ( category == k1e1mupp_bloose ) {
-//      selElectronHistManager_category["1e1mupp_1tau_bloose"]["electron"]->fillHistograms(selElectrons, evtWeight_pp);
-//      selMuonHistManager_category["1e1mupp_1tau_bloose"]["muon"]->fillHistograms(selMuons, evtWeight_pp);
+//      selElectronHistManager_category["1e1mupp_1tau_bloose"]["electron"]->fillHistograms(selElectrons, genMatchTable, evtWeight_pp);
+//      selMuonHistManager_category["1e1mupp_1tau_bloose"]["muon"]->fillHistograms(selMuons, genMatchTable, evtWeight_pp);
 //      selEvtHistManager_category["1e1mupp_1tau_bloose"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_pp);
 //    } else if ( category == k1e1mumm_btight ) {
-//      selElectronHistManager_category["1e1mumm_1tau_btight"]["electron"]->fillHistograms(selElectrons, evtWeight_mm);
-//      selMuonHistManager_category["1e1mumm_1tau_btight"]["muon"]->fillHistograms(selMuons, evtWeight_mm);
+//      selElectronHistManager_category["1e1mumm_1tau_btight"]["electron"]->fillHistograms(selElectrons, genMatchTable, evtWeight_mm);
+//      selMuonHistManager_category["1e1mumm_1tau_btight"]["muon"]->fillHistograms(selMuons, genMatchTable, evtWeight_mm);
 //      selEvtHistManager_category["1e1mumm_1tau_btight"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_mm);
 //    } else if ( category == k1e1mumm_bloose ) {
-//      selElectronHistManager_category["1e1mumm_1tau_bloose"]["electron"]->fillHistograms(selElectrons, evtWeight_mm);
-//      selMuonHistManager_category["1e1mumm_1tau_bloose"]["muon"]->fillHistograms(selMuons, evtWeight_mm);
+//      selElectronHistManager_category["1e1mumm_1tau_bloose"]["electron"]->fillHistograms(selElectrons, genMatchTable, evtWeight_mm);
+//      selMuonHistManager_category["1e1mumm_1tau_bloose"]["muon"]->fillHistograms(selMuons, genMatchTable, evtWeight_mm);
 //      selEvtHistManager_category["1e1mumm_1tau_bloose"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_mm);
 //    } else if ( category == k2mupp_btight ) {
-//      selMuonHistManager_category["2mupp_1tau_btight"]["leadMuon"]->fillHistograms(selMuons, evtWeight_pp);
-//      selMuonHistManager_category["2mupp_1tau_btight"]["subleadMuon"]->fillHistograms(selMuons, evtWeight_pp);
+//      selMuonHistManager_category["2mupp_1tau_btight"]["leadMuon"]->fillHistograms(selMuons, genMatchTable, evtWeight_pp);
+//      selMuonHistManager_category["2mupp_1tau_btight"]["subleadMuon"]->fillHistograms(selMuons, genMatchTable, evtWeight_pp);
 //      selEvtHistManager_category["2mupp_1tau_btight"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_pp);
 //    } else if ( category == k2mupp_bloose ) {
-//      selMuonHistManager_category["2mupp_1tau_bloose"]["leadMuon"]->fillHistograms(selMuons, evtWeight_pp);
-//      selMuonHistManager_category["2mupp_1tau_bloose"]["subleadMuon"]->fillHistograms(selMuons, evtWeight_pp);
+//      selMuonHistManager_category["2mupp_1tau_bloose"]["leadMuon"]->fillHistograms(selMuons, genMatchTable, evtWeight_pp);
+//      selMuonHistManager_category["2mupp_1tau_bloose"]["subleadMuon"]->fillHistograms(selMuons, genMatchTable, evtWeight_pp);
 //      selEvtHistManager_category["2mupp_1tau_bloose"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_pp);
 //    } else if ( category == k2mumm_btight ) {
-//      selMuonHistManager_category["2mumm_1tau_btight"]["leadMuon"]->fillHistograms(selMuons, evtWeight_mm);
-//      selMuonHistManager_category["2mumm_1tau_btight"]["subleadMuon"]->fillHistograms(selMuons, evtWeight_mm);
+//      selMuonHistManager_category["2mumm_1tau_btight"]["leadMuon"]->fillHistograms(selMuons, genMatchTable, evtWeight_mm);
+//      selMuonHistManager_category["2mumm_1tau_btight"]["subleadMuon"]->fillHistograms(selMuons, genMatchTable, evtWeight_mm);
 //      selEvtHistManager_category["2mumm_1tau_btight"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_mm);
 //    } else if ( category == k2mumm_bloose ) {
-//      selMuonHistManager_category["2mumm_1tau_bloose"]["leadMuon"]->fillHistograms(selMuons, evtWeight_mm);
-//      selMuonHistManager_category["2mumm_1tau_bloose"]["subleadMuon"]->fillHistograms(selMuons, evtWeight_mm);
+//      selMuonHistManager_category["2mumm_1tau_bloose"]["leadMuon"]->fillHistograms(selMuons, genMatchTable, evtWeight_mm);
+//      selMuonHistManager_category["2mumm_1tau_bloose"]["subleadMuon"]->fillHistograms(selMuons, genMatchTable, evtWeight_mm);
 //      selEvtHistManager_category["2mumm_1tau_bloose"]->fillHistograms(mvaOutput_2lss_ttV, mvaOutput_2lss_ttbar, mvaDiscr_2lss, evtWeight_mm);
 //    }
 
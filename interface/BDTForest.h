@@ -0,0 +1,81 @@
+#ifndef tthAnalysis_HiggsToTauTau_BDTForest_h
+#define tthAnalysis_HiggsToTauTau_BDTForest_h
+
+/** \class BDTForest
+ *
+ * Evaluate boosted decision trees trained with TMVA using gradient boosting (BoostType = Grad),
+ * without the overhead of TMVA::Reader.
+ *
+ * The trees are read from the TMVA weight file (XML format) and stored in one contiguous array of nodes.
+ * The nodes of each tree are stored in depth-first order: the daughter taken in case the input value is below the cut
+ * directly follows its mother, and each internal node stores the offset of the other daughter.
+ * The cuts and responses are stored with single precision, as in TMVA::DecisionTreeNode,
+ * so that the output is the same as computed by TMVA::Reader.
+ *
+ * \author Christian Veelken, Tallinn
+ *
+ */
+
+#include <Rtypes.h> // Float_t
+#include <TXMLEngine.h> // TXMLEngine, XMLNodePointer_t
+
+#include <string> // std::string
+#include <vector> // std::vector
+
+class BDTForest
+{
+ public:
+  /**
+   * @brief Read trees from TMVA weight file (given by full path)
+   *
+   *        A cms::Exception is thrown in case the file contains an MVA that is not supported:
+   *        only classification BDTs with gradient boosting, without variable transformations and without Fisher cuts are supported.
+   */
+  BDTForest(const std::string& mvaFileName);
+  ~BDTForest() {}
+
+  /**
+   * @brief Names of the MVA input variables (attribute 'Expression' in the weight file), in the order used for the TMVA training
+   */
+  const std::vector<std::string>& getInputVariables() const { return inputVariables_; }
+
+  /**
+   * @brief Set position of each MVA input variable in the array of input values passed to operator()
+   *        (by default, the input values are expected in the order used for the TMVA training)
+   */
+  void setInputIndices(const std::vector<int>& inputIndices);
+
+  /**
+   * @brief Compute BDT output, in the range -1..+1
+   * @param mvaInputs Values of MVA input variables
+   * @return          BDT output (-999 in case any input value is NaN, as for TMVA::Reader)
+   */
+  double operator()(const Float_t* mvaInputs) const;
+
+  size_t getNumTrees() const { return roots_.size(); }
+  size_t getNumNodes() const { return nodes_.size(); }
+
+ protected:
+  struct Node
+  {
+    int idxVariable_; // position of input variable in the array of input values (-1 for leaf nodes)
+    float value_;     // cut for internal nodes, response for leaf nodes
+    int offset_;      // offset of the daughter taken in case the input value is greater or equal to the cut
+  };
+
+  /**
+   * @brief Add node read from weight file and (recursively) all its daughters
+   * @return Index of the node in nodes_
+   */
+  int addNode(TXMLEngine& xml, XMLNodePointer_t xmlNode);
+
+  std::string mvaFileName_;
+
+  std::vector<std::string> inputVariables_;
+  std::vector<int> inputIndices_; // position of each input variable in the array of input values
+
+  std::vector<Node> nodes_;
+  std::vector<int> roots_; // index of first node of each tree in nodes_
+};
+
+#endif // tthAnalysis_HiggsToTauTau_BDTForest_h
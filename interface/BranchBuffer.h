@@ -0,0 +1,68 @@
+#ifndef tthAnalysis_HiggsToTauTau_BranchBuffer_h
+#define tthAnalysis_HiggsToTauTau_BranchBuffer_h
+
+#include <memory> // std::shared_ptr<>, std::default_delete<>
+#include <typeinfo> // std::type_info
+
+/**
+ * @brief Branch buffer owned by the EventSource.
+ *
+ *        The memory of array buffers may be reallocated by the EventSource,
+ *        when a file containing a larger collection is opened by a TChain.
+ */
+struct BranchBufferEntry
+{
+  BranchBufferEntry()
+    : data_(0)
+    , type_(0)
+    , size_(0)
+    , isArray_(false)
+    , allocate_(0)
+  {}
+
+  void* data_;
+  std::shared_ptr<void> owner_;
+  const std::type_info* type_;
+  int size_;
+  bool isArray_;
+  std::shared_ptr<void> (*allocate_)(int);
+};
+
+/**
+ * @brief Allocate zero-initialized array of given type and size
+ */
+template <typename T>
+std::shared_ptr<void> allocateBranchBuffer(int size)
+{
+  return std::shared_ptr<void>(new T[size](), std::default_delete<T[]>());
+}
+
+/**
+ * @brief Handle to an array buffer owned by the EventSource.
+ *
+ *        Readers keep the handle instead of a pointer to the buffer,
+ *        so that they pick up the new memory location when the EventSource resizes the buffer.
+ *        The handle converts to a pointer to the first element of the buffer,
+ *        so it can be indexed like a plain array.
+ */
+template <typename T>
+class BranchBuffer
+{
+ public:
+  BranchBuffer(const BranchBufferEntry* entry = 0)
+    : entry_(entry)
+  {}
+  ~BranchBuffer() {}
+
+  operator T*() const { return ( entry_ ) ? static_cast<T*>(entry_->data_) : 0; }
+
+  /**
+   * @brief Return number of elements the buffer can hold
+   */
+  int size() const { return ( entry_ ) ? entry_->size_ : 0; }
+
+ protected:
+  const BranchBufferEntry* entry_;
+};
+
+#endif // tthAnalysis_HiggsToTauTau_BranchBuffer_h
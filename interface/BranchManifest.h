@@ -0,0 +1,48 @@
+#ifndef tthAnalysis_HiggsToTauTau_BranchManifest_h
+#define tthAnalysis_HiggsToTauTau_BranchManifest_h
+
+#include <TTree.h> // TTree
+
+#include <string> // std::string
+#include <set> // std::set<>
+#include <ostream> // std::ostream
+
+/**
+ * @brief Book-keeping of all branches that are read from the input tree.
+ *
+ *        The EventSource registers every branch for which TTree::SetBranchAddress is called,
+ *        so that all other branches can be disabled before the event loop 
+ *        and are not unzipped by TTree::GetEntry.
+ */
+class BranchManifest
+{
+ public:
+  BranchManifest();
+  ~BranchManifest();
+
+  /**
+   * @brief Register branch as needed by the analysis
+   */
+  void addBranch(const std::string& branchName);
+
+  /**
+   * @brief Return names of all registered branches
+   */
+  const std::set<std::string>& branchNames() const { return branchNames_; }
+
+  /**
+   * @brief Disable all branches of the tree, then re-enable the registered ones
+   */
+  void setBranchStatus(TTree* tree) const;
+
+  /**
+   * @brief Print number of registered branches and number of bytes per entry that are read from the tree,
+   *        compared to the number of bytes per entry stored in all branches of the tree
+   */
+  void print(TTree* tree, std::ostream& stream) const;
+
+ protected:
+  std::set<std::string> branchNames_;
+};
+
+#endif // tthAnalysis_HiggsToTauTau_BranchManifest_h
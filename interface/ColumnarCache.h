@@ -0,0 +1,184 @@
+#ifndef tthAnalysis_HiggsToTauTau_ColumnarCache_h
+#define tthAnalysis_HiggsToTauTau_ColumnarCache_h
+
+#include <Rtypes.h> // Int_t, Long64_t
+
+#include <string> // std::string
+#include <vector> // std::vector<>
+#include <map> // std::map<,>
+#include <fstream> // std::ofstream
+#include <typeinfo> // std::type_info
+
+/**
+ * @brief Flat, uncompressed columnar file format for caching the branches of the Ntuples that are read by the analysis,
+ *        so that repeated processing of the same events does not need ROOT decompression and TBranch bookkeeping.
+ *
+ *        Layout of the file (all numbers in native byte order):
+ *          - magic string "TTHCOL01" (8 bytes), followed by the file offset of the footer (Long64_t)
+ *          - blocks of consecutive entries; within each block, the values of one column are stored contiguously
+ *            (for variable-size arrays, the elements of all entries in the block are concatenated),
+ *            the data of each column starts at an offset aligned to 8 bytes
+ *          - footer: number of entries, column descriptors and block descriptors
+ *
+ *        The number of elements per entry of variable-size arrays is taken from the column holding the "count" branch,
+ *        which is always stored in the file together with the array.
+ */
+struct ColumnarCacheColumn
+{
+  std::string name_;  ///< name of the branch
+  std::string type_;  ///< ROOT type name (e.g. "Float_t")
+  int elementSize_;   ///< size of one element in bytes
+  int countColumn_;   ///< index of the column holding the number of elements per entry (-1 for columns with a fixed number of elements)
+  int length_;        ///< number of elements per entry for columns with a fixed number of elements
+};
+
+struct ColumnarCacheBlock
+{
+  Long64_t firstEntry_;           ///< index of the first entry in the block (counting from the start of the file)
+  Long64_t numEntries_;           ///< number of entries in the block
+  std::vector<Long64_t> offsets_; ///< file offset of the data of each column
+};
+
+/**
+ * @brief Return size in bytes of given ROOT type, zero in case the type is not supported by the columnar cache format
+ */
+int getColumnarCacheTypeSize(const std::string& type);
+
+/**
+ * @brief Return ROOT type name corresponding to given C++ type, empty string in case the type is not supported by the columnar cache format
+ */
+std::string getColumnarCacheType(const std::type_info& type);
+
+/**
+ * @brief Write events to a file in columnar cache format
+ */
+class ColumnarCacheWriter
+{
+ public:
+  ColumnarCacheWriter(const std::string& fileName, int blockSize);
+  ~ColumnarCacheWriter();
+
+  /**
+   * @brief Add column to the file;
+   *        for variable-size arrays, the column holding the number of elements needs to be added before
+   */
+  void addColumn(const std::string& name, const std::string& type, const std::string& countColumnName, int length);
+
+  /**
+   * @brief Return index of column with given name, -1 in case no such column exists
+   */
+  int getColumn(const std::string& name) const;
+
+  /**
+   * @brief Append one entry to the file;
+   *        the vector contains the address of the data for each column, in the order in which the columns have been added
+   */
+  void fill(const std::vector<const void*>& data);
+
+  /**
+   * @brief Write the remaining entries and the footer, then close the file
+   */
+  void close();
+
+ protected:
+  void writeBlock();
+
+  std::string fileName_;
+  std::ofstream file_;
+  int blockSize_;
+
+  std::vector<ColumnarCacheColumn> columns_;
+  std::map<std::string, int> columnIndices_; // key = column name
+  std::vector<ColumnarCacheBlock> blocks_;
+  std::vector<std::vector<char> > blockData_; // data of entries in current block for each column
+
+  Long64_t numEntries_;
+  Long64_t numEntries_block_;
+  bool isClosed_;
+};
+
+/**
+ * @brief Read events from one or more files in columnar cache format.
+ *
+ *        The files are mapped into memory, so that the data of each column is accessed in place, without copying or decompression.
+ *        All files need to contain the same columns.
+ */
+class ColumnarCacheReader
+{
+ public:
+  ColumnarCacheReader(const std::vector<std::string>& fileNames);
+  ~ColumnarCacheReader();
+
+  /**
+   * @brief Return total number of entries in all files
+   */
+  Long64_t getEntries() const { return numEntries_; }
+
+  /**
+   * @brief Return index of column with given name, -1 in case no such column exists
+   */
+  int getColumn(const std::string& name) const;
+
+  const ColumnarCacheColumn& getColumnDescriptor(int column) const { return columns_[column]; }
+  int getNumColumns() const { return columns_.size(); }
+
+  /**
+   * @brief Position all columns at given entry
+   * @return Number of bytes available for the entry in all columns, -1 in case the entry does not exist
+   */
+  Int_t loadEntry(Long64_t entry);
+
+  /**
+   * @brief Return address of the data of given column for the current entry, and the number of elements stored for the entry
+   */
+  const void* getData(int column) const;
+  int getLength(int column) const;
+
+  /**
+   * @brief Return value of the first element of given column for the current entry, converted to double
+   */
+  double getValue(int column) const;
+
+ protected:
+  struct fileEntryType
+  {
+    std::string fileName_;
+    int fd_;
+    char* data_;
+    size_t size_;
+    Long64_t firstEntry_; ///< index of first entry of the file (counting from the start of the first file)
+    Long64_t numEntries_;
+    std::vector<ColumnarCacheBlock> blocks_;
+    std::vector<Long64_t> firstEntries_blocks_; ///< index of first entry of each block (counting from the start of the file)
+  };
+
+  /**
+   * @brief Map file into memory and read its footer
+   */
+  void openFile(const std::string& fileName);
+
+  /**
+   * @brief Read footer of file mapped into memory and check that all offsets and column indices stored in it are within range
+   */
+  void readFooter(fileEntryType& file);
+
+  /**
+   * @brief Compute offsets of the elements of each entry in the current block for the variable-size arrays
+   */
+  void updateElementOffsets();
+
+  std::vector<ColumnarCacheColumn> columns_;
+  std::map<std::string, int> columnIndices_; // key = column name
+  std::vector<bool> isCountColumn_;
+
+  std::vector<fileEntryType> files_;
+  std::vector<Long64_t> firstEntries_files_; ///< index of first entry of each file (counting from the start of the first file)
+  Long64_t numEntries_;
+
+  int currentFile_;
+  int currentBlock_;
+  Long64_t localEntry_; ///< index of current entry within current block
+  std::vector<std::vector<Long64_t> > elementOffsets_; // key = index of count column
+};
+
+#endif // tthAnalysis_HiggsToTauTau_ColumnarCache_h
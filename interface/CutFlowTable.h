@@ -0,0 +1,157 @@
+#ifndef tthAnalysis_HiggsToTauTau_CutFlowTable_h
+#define tthAnalysis_HiggsToTauTau_CutFlowTable_h
+
+/** \class CutFlowTable
+ *
+ * Count events passing each cut of an event selection (unweighted and weighted)
+ * and measure the CPU time spent on each cut.
+ *
+ * The cuts are declared once, before the event loop, and applied by calling
+ *   if ( !cutFlow(idxCut, condition, evtWeight) ) continue;
+ * The time attributed to a cut is the time elapsed since the previous cut has been applied
+ * (or since the call to startEvent for the first cut), i.e. it includes the time needed to compute the condition.
+ *
+ * Independent cuts that are cheap to compute can be declared as a group and given as functions.
+ * The cuts in a group are evaluated in order of decreasing rejection per unit of CPU time,
+ * which is measured while the events are processed.
+ * As the order changes during the job, the numbers of events passing the individual cuts of a group refer
+ * to the events for which the cut has been evaluated; only the number of events passing the whole group
+ * does not depend on the order.
+ *
+ * \author Christian Veelken, Tallinn
+ *
+ */
+
+#include <Rtypes.h> // Long64_t
+
+#include <chrono> // std::chrono::steady_clock
+#include <functional> // std::function
+#include <ostream> // std::ostream
+#include <string> // std::string
+#include <vector> // std::vector
+
+class CutFlowTable
+{
+ public:
+  typedef std::function<bool()> CutFunction;
+
+  CutFlowTable(const std::string& name);
+  ~CutFlowTable() {}
+
+  /**
+   * @brief Declare cut (the cuts are listed in the table in the order in which they are declared)
+   * @return Index of the cut, to be passed to operator()
+   */
+  int addCut(const std::string& label);
+
+  /**
+   * @brief Declare group of independent cuts, which are evaluated by calling passesCutGroup
+   * @param reorderInterval Number of evaluations of the group after which the order of the cuts is updated
+   *                        (0 = keep the order in which the cuts are declared)
+   * @return Index of the group
+   */
+  int addCutGroup(const std::string& label, unsigned reorderInterval = 1000);
+
+  /**
+   * @brief Add cut to group declared before
+   */
+  void addCut(int idxCutGroup, const std::string& label, const CutFunction& cut);
+
+  /**
+   * @brief Reset the timer and enable counting (to be called at the start of each event)
+   */
+  void startEvent();
+
+  /**
+   * @brief Enable or disable counting
+   *       (used to count events for the central value only when processing several systematic shifts in one pass)
+   */
+  void setActive(bool active) { active_ = active; }
+
+  /**
+   * @brief Record the outcome of a cut
+   * @return The value of passes, so that the call can be used as condition of an if-statement
+   */
+  bool operator()(int idxCut, bool passes, double evtWeight = 1.);
+
+  /**
+   * @brief Evaluate all cuts in group, stopping at the first cut that fails
+   * @return True in case the event passes all cuts in the group
+   */
+  bool passesCutGroup(int idxCutGroup, double evtWeight = 1.);
+
+  /**
+   * @brief Add the counts and times of another instance with the same cuts
+   *        (used to combine the tables filled by different threads)
+   */
+  void merge(const CutFlowTable& other);
+
+  const std::string& getName() const { return name_; }
+  size_t getNumCuts() const { return cuts_.size(); }
+  const std::string& getLabel(int idxCut) const { return cuts_[idxCut].label_; }
+  Long64_t getNumPassed(int idxCut) const { return cuts_[idxCut].numPassed_; }
+  double getNumPassed_weighted(int idxCut) const { return cuts_[idxCut].numPassed_weighted_; }
+
+  /**
+   * @brief Print table in human readable form
+   */
+  void print(std::ostream& stream) const;
+
+  /**
+   * @brief Write table in machine readable form: one line per cut, with the fields
+   *          table;cut;group;position;numEvaluated;numPassed;numPassed_weighted;time
+   *        separated by semicolons. The field 'group' is empty for cuts that are not part of a group,
+   *        'position' is the position in the order of evaluation at the end of the job, and 'time' is given in seconds.
+   */
+  void write(std::ostream& stream) const;
+  static void writeHeader(std::ostream& stream);
+
+ protected:
+  typedef std::chrono::steady_clock Clock;
+
+  struct Counter
+  {
+    Counter(const std::string& label)
+      : label_(label)
+      , numEvaluated_(0)
+      , numPassed_(0)
+      , numPassed_weighted_(0.)
+      , time_(0)
+    {}
+    void add(const Counter& other);
+    std::string label_;
+    Long64_t numEvaluated_;
+    Long64_t numPassed_;
+    double numPassed_weighted_;
+    Clock::duration time_;
+  };
+
+  struct CutGroup
+  {
+    CutGroup(unsigned reorderInterval)
+      : reorderInterval_(reorderInterval)
+      , numEvaluated_sinceReorder_(0)
+    {}
+    std::vector<Counter> counters_;         // in the order in which the cuts are declared
+    std::vector<CutFunction> cutFunctions_; // in the order in which the cuts are declared
+    std::vector<int> order_;                // indices of the cuts in the order of evaluation
+    unsigned reorderInterval_;
+    unsigned numEvaluated_sinceReorder_;
+  };
+
+  /**
+   * @brief Sort the cuts in given group by decreasing number of rejected events per unit of CPU time
+   */
+  void reorder(CutGroup& cutGroup);
+
+  std::string name_;
+
+  std::vector<Counter> cuts_;
+  std::vector<int> idxCutGroups_; // index in cutGroups_ of each cut (-1 for cuts that are not groups)
+  std::vector<CutGroup> cutGroups_;
+
+  bool active_;
+  Clock::time_point lastTime_;
+};
+
+#endif // tthAnalysis_HiggsToTauTau_CutFlowTable_h
@@ -11,6 +11,7 @@
 
 #include "tthAnalysis/HiggsToTauTau/interface/HistManagerBase.h" // HistManagerBase
 #include "tthAnalysis/HiggsToTauTau/interface/RecoElectron.h"
+#include "tthAnalysis/HiggsToTauTau/interface/GenMatchTable.h" // GenMatchTable
 
 class ElectronHistManager
   : public HistManagerBase
@@ -21,33 +22,33 @@ class ElectronHistManager
 
   /// book and fill histograms
   void bookHistograms(TFileDirectory& dir);
-  void fillHistograms(const std::vector<const RecoElectron*>& electrons, double evtWeight);
+  void fillHistograms(const std::vector<const RecoElectron*>& electrons, const GenMatchTable& genMatchTable, double evtWeight);
 
  private:
-  TH1* histogram_pt_;
-  TH1* histogram_eta_;
-  TH1* histogram_phi_;
-  TH1* histogram_charge_;
-
-  TH1* histogram_dxy_;
-  TH1* histogram_dz_;     
-  TH1* histogram_relIso_;  
-  TH1* histogram_sip3d_;
-  TH1* histogram_mvaRawTTH_; 
-  TH1* histogram_jetPtRatio_;  
-  TH1* histogram_jetBtagCSV_; 
-  TH1* histogram_tightCharge_;      
-  TH1* histogram_mvaRawPOG_; 
-  TH1* histogram_sigmaEtaEta_; 
-  TH1* histogram_HoE_;   
-  TH1* histogram_deltaEta_;  
-  TH1* histogram_deltaPhi_; 
-  TH1* histogram_OoEminusOoP_;
-  TH1* histogram_nLostHits_;  
-  TH1* histogram_passesConversionVeto_;
-
-  TH1* histogram_abs_genPdgId_;
-  TH1* histogram_gen_times_recCharge_;
+  HistogramAccumulator* histogram_pt_;
+  HistogramAccumulator* histogram_eta_;
+  HistogramAccumulator* histogram_phi_;
+  HistogramAccumulator* histogram_charge_;
+
+  HistogramAccumulator* histogram_dxy_;
+  HistogramAccumulator* histogram_dz_;     
+  HistogramAccumulator* histogram_relIso_;  
+  HistogramAccumulator* histogram_sip3d_;
+  HistogramAccumulator* histogram_mvaRawTTH_; 
+  HistogramAccumulator* histogram_jetPtRatio_;  
+  HistogramAccumulator* histogram_jetBtagCSV_; 
+  HistogramAccumulator* histogram_tightCharge_;      
+  HistogramAccumulator* histogram_mvaRawPOG_; 
+  HistogramAccumulator* histogram_sigmaEtaEta_; 
+  HistogramAccumulator* histogram_HoE_;   
+  HistogramAccumulator* histogram_deltaEta_;  
+  HistogramAccumulator* histogram_deltaPhi_; 
+  HistogramAccumulator* histogram_OoEminusOoP_;
+  HistogramAccumulator* histogram_nLostHits_;  
+  HistogramAccumulator* histogram_passesConversionVeto_;
+
+  HistogramAccumulator* histogram_abs_genPdgId_;
+  HistogramAccumulator* histogram_gen_times_recCharge_;
 
   std::vector<TH1*> histograms_;
 
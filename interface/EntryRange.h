@@ -0,0 +1,56 @@
+#ifndef tthAnalysis_HiggsToTauTau_EntryRange_h
+#define tthAnalysis_HiggsToTauTau_EntryRange_h
+
+#include "FWCore/ParameterSet/interface/ParameterSet.h" // edm::ParameterSet
+
+#include <Rtypes.h> // Long64_t
+#include <TChain.h> // TChain
+
+#include <vector> // std::vector<>
+
+/**
+ * @brief Range [firstEntry, lastEntry) of entries in the chain of input files that is processed by one job.
+ *
+ *        The range is taken from the optional parameters 'firstEntry' (default = 0) and 'lastEntry' (default = -1, meaning all entries)
+ *        of the fwliteInput ParameterSet, so that jobs can be balanced by number of events rather than by number of files
+ *        (cf. scanNtupleClusters executable).
+ */
+class EntryRange
+{
+ public:
+  EntryRange(const edm::ParameterSet& cfg_input, Long64_t numEntries);
+  EntryRange(Long64_t firstEntry, Long64_t lastEntry);
+  ~EntryRange() {}
+
+  Long64_t firstEntry() const { return firstEntry_; }
+  Long64_t lastEntry() const { return lastEntry_; }
+
+  /**
+   * @brief Return number of entries in range
+   */
+  Long64_t size() const { return lastEntry_ - firstEntry_; }
+
+ protected:
+  Long64_t firstEntry_;
+  Long64_t lastEntry_; // CV: first entry that is not processed any more
+};
+
+/**
+ * @brief Return entry numbers (in the numbering of the chain) at which a new cluster of baskets starts.
+ *
+ *        The cluster boundaries are taken from the tree headers, no baskets are read.
+ *        The last element of the vector is the total number of entries in the chain.
+ */
+std::vector<Long64_t> getClusterBoundaries(TChain* inputTree);
+
+/**
+ * @brief Split range of entries into numRanges contiguous ranges of similar size,
+ *        with the boundaries between the ranges aligned to the given cluster boundaries (if any),
+ *        so that no cluster needs to be decompressed by more than one thread.
+ *
+ *        The split depends on the range and the cluster boundaries only, so that results are reproducible.
+ *        Some of the returned ranges may be empty in case the range contains fewer clusters than numRanges.
+ */
+std::vector<EntryRange> splitEntryRange(const EntryRange& entryRange, int numRanges, const std::vector<Long64_t>& clusterBoundaries);
+
+#endif // tthAnalysis_HiggsToTauTau_EntryRange_h
@@ -0,0 +1,208 @@
+#ifndef tthAnalysis_HiggsToTauTau_EventSource_h
+#define tthAnalysis_HiggsToTauTau_EventSource_h
+
+#include "tthAnalysis/HiggsToTauTau/interface/BranchManifest.h" // BranchManifest
+#include "tthAnalysis/HiggsToTauTau/interface/BranchBuffer.h" // BranchBuffer, BranchBufferEntry, allocateBranchBuffer
+#include "tthAnalysis/HiggsToTauTau/interface/ColumnarCache.h" // ColumnarCacheReader
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <TObject.h> // TObject
+#include <TTree.h> // TTree
+
+#include <string> // std::string
+#include <map> // std::map<,>
+#include <set> // std::set<>
+#include <vector> // std::vector<>
+#include <ostream> // std::ostream
+#include <typeinfo> // typeid, std::type_info
+
+/**
+ * @brief Owner of the branch buffers for one TTree or TChain.
+ *
+ *        Readers do not allocate branch buffers themselves, but request them from the EventSource,
+ *        so that several readers of the same branch share one buffer 
+ *        (ROOT cannot handle multiple TTree::SetBranchAddress calls for the same branch).
+ *        Readers for different EventSource objects are independent of each other,
+ *        e.g. when running one event loop per thread.
+ *
+ *        Array buffers are sized according to the maximum number of elements stored in the current file
+ *        (taken from the leaf holding the number of elements) and are enlarged 
+ *        in case a TChain opens a file that contains larger collections.
+ *
+ *        Alternatively, the events can be read from files in columnar cache format (cf. ColumnarCache.h).
+ *        In this case, the array buffers point directly to the memory-mapped files and no ROOT I/O is involved.
+ */
+class EventSource
+{
+ public:
+  EventSource(TTree* tree);
+  EventSource(ColumnarCacheReader* cache);
+  ~EventSource();
+
+  /**
+   * @brief Return input tree, null pointer in case events are read from columnar cache files
+   */
+  TTree* getTree() const { return tree_; }
+
+  /**
+   * @brief Return columnar cache reader, null pointer in case events are read from a TTree
+   */
+  ColumnarCacheReader* getCache() const { return cache_; }
+
+  /**
+   * @brief Return manifest of all branches read from the tree
+   */
+  BranchManifest& getManifest() { return manifest_; }
+  const BranchManifest& getManifest() const { return manifest_; }
+
+  /**
+   * @brief Return buffer of given type for given branch holding a single value (e.g. the number of particles in a collection);
+   *        the buffer is allocated and TTree::SetBranchAddress is called on the first request for the branch,
+   *        subsequent requests return the same buffer
+   */
+  template <typename T>
+  T* getBuffer(const std::string& branchName)
+  {
+    const BranchBufferEntry* entry = getBufferEntry<T>(branchName, false);
+    return static_cast<T*>(entry->data_);
+  }
+
+  /**
+   * @brief Return buffer of given type for given array branch (e.g. the pT of all particles in a collection).
+   *
+   *        The size of the buffer is determined automatically and the buffer may be reallocated when the next file is opened,
+   *        so the caller needs to keep the handle returned by this function rather than a pointer to the buffer.
+   */
+  template <typename T>
+  BranchBuffer<T> getArrayBuffer(const std::string& branchName)
+  {
+    return BranchBuffer<T>(getBufferEntry<T>(branchName, true));
+  }
+
+  /**
+   * @brief Call TTree::SetBranchAddress for a buffer owned by the caller (e.g. event-level variables)
+   */
+  template <typename T>
+  void setBranchAddress(const std::string& branchName, T* address)
+  {
+    checkUnique(branchName);
+    externalBranchNames_.insert(branchName);
+    if ( cache_ ) bindColumn(branchName, typeid(T), false, 0, address);
+    else tree_->SetBranchAddress(branchName.data(), address);
+    manifest_.addBranch(branchName);
+  }
+
+  /**
+   * @brief Return number of entries in the input tree or columnar cache files
+   */
+  Long64_t getEntries() const;
+
+  /**
+   * @brief Read given entry into the branch buffers
+   * @return Number of bytes read, -1 in case the entry does not exist
+   */
+  Int_t getEntry(Long64_t entry);
+
+  /**
+   * @brief Disable all branches that are not needed by the analysis (no-op for columnar cache files)
+   */
+  void setBranchStatus() const;
+
+  /**
+   * @brief Print branches read by the analysis
+   */
+  void printManifest(std::ostream& stream) const;
+
+  /**
+   * @brief Enlarge array buffers in case the current file contains larger collections than the previous ones;
+   *        called automatically by the TChain whenever it opens the next file
+   */
+  void updateBufferSizes();
+
+ protected:
+  /**
+   * @brief Return entry for buffer of given type for given branch, allocate the buffer on the first request for the branch
+   */
+  template <typename T>
+  const BranchBufferEntry* getBufferEntry(const std::string& branchName, bool isArray)
+  {
+    std::map<std::string, BranchBufferEntry>::const_iterator buffer = buffers_.find(branchName);
+    if ( buffer != buffers_.end() ) {
+      if ( *buffer->second.type_ != typeid(T) || buffer->second.isArray_ != isArray ) 
+	throw cms::Exception("EventSource") 
+	  << "Type requested for branch = " << branchName << " does not match type of existing buffer !!\n";
+      return &buffer->second;
+    }
+    checkUnique(branchName);
+    BranchBufferEntry& entry = buffers_[branchName];
+    entry.type_ = &typeid(T);
+    entry.size_ = ( isArray ) ? getArraySize(branchName) : 1;
+    entry.isArray_ = isArray;
+    entry.allocate_ = &allocateBranchBuffer<T>;
+    entry.owner_ = entry.allocate_(entry.size_);
+    entry.data_ = entry.owner_.get();
+    if ( cache_ ) bindColumn(branchName, typeid(T), isArray, &entry, 0);
+    else tree_->SetBranchAddress(branchName.data(), entry.data_);
+    manifest_.addBranch(branchName);
+    return &entry;
+  }
+
+  /**
+   * @brief Associate buffer with column of the same name in the columnar cache files;
+   *        array buffers are pointed to the memory-mapped data on each getEntry call, 
+   *        the values of single-value branches are copied to the address given as argument
+   */
+  void bindColumn(const std::string& branchName, const std::type_info& type, bool isArray, BranchBufferEntry* entry, void* address);
+
+  /**
+   * @brief Throw exception if the branch address has already been set
+   */
+  void checkUnique(const std::string& branchName) const;
+
+  /**
+   * @brief Return maximum number of elements stored in given array branch in the current file
+   */
+  int getArraySize(const std::string& branchName) const;
+
+  TTree* tree_;
+  ColumnarCacheReader* cache_;
+
+  struct columnBinding
+  {
+    int column_;
+    BranchBufferEntry* entry_; // CV: set for array buffers only
+    void* address_;            // CV: set for single-value branches only
+    int numBytes_;
+  };
+  std::vector<columnBinding> columnBindings_;
+
+  BranchManifest manifest_;
+
+  std::map<std::string, BranchBufferEntry> buffers_; // key = branchName
+  std::set<std::string> externalBranchNames_;
+
+  /**
+   * @brief Auxiliary class to get notified by the TChain when it opens the next file
+   */
+  class fileSwitchNotifier 
+    : public TObject
+  {
+   public:
+    fileSwitchNotifier(EventSource* eventSource, TObject* previousNotify)
+      : eventSource_(eventSource)
+      , previousNotify_(previousNotify)
+    {}
+    Bool_t Notify()
+    {
+      eventSource_->updateBufferSizes();
+      if ( previousNotify_ ) previousNotify_->Notify();
+      return kTRUE;
+    }
+    EventSource* eventSource_;
+    TObject* previousNotify_; // CV: notify object set before the EventSource was created, called as well
+  };
+  fileSwitchNotifier* notifier_;
+};
+
+#endif // tthAnalysis_HiggsToTauTau_EventSource_h
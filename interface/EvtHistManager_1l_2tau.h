@@ -24,11 +24,11 @@ class EvtHistManager_1l_2tau
   void fillHistograms(int numJets, double mTauTauVis, double evtWeight);
 
  private:
-  TH1* histogram_numJets_;
+  HistogramAccumulator* histogram_numJets_;
 
-  TH1* histogram_mTauTauVis_;
+  HistogramAccumulator* histogram_mTauTauVis_;
 
-  TH1* histogram_EventCounter_;
+  HistogramAccumulator* histogram_EventCounter_;
 
   std::vector<TH1*> histograms_;
 };
@@ -24,13 +24,13 @@ class EvtHistManager_2los_1tau
   void fillHistograms(double mvaOutput_2los_ttV, double mvaOutput_2los_ttbar, double mvaDiscr_2los, int numJets, double evtWeight);
 
  private:
-  TH1* histogram_mvaOutput_2los_ttV_;
-  TH1* histogram_mvaOutput_2los_ttbar_;
-  TH1* histogram_mvaDiscr_2los_;
+  HistogramAccumulator* histogram_mvaOutput_2los_ttV_;
+  HistogramAccumulator* histogram_mvaOutput_2los_ttbar_;
+  HistogramAccumulator* histogram_mvaDiscr_2los_;
 
-  TH1* histogram_numJets_;
+  HistogramAccumulator* histogram_numJets_;
 
-  TH1* histogram_EventCounter_;
+  HistogramAccumulator* histogram_EventCounter_;
 
   std::vector<TH1*> histograms_;
 };
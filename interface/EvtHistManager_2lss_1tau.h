@@ -24,11 +24,11 @@ class EvtHistManager_2lss_1tau
   void fillHistograms(double mvaOutput_2lss_ttV, double mvaOutput_2lss_ttbar, double mvaDiscr_2lss, double evtWeight);
 
  private:
-  TH1* histogram_mvaOutput_2lss_ttV_;
-  TH1* histogram_mvaOutput_2lss_ttbar_;
-  TH1* histogram_mvaDiscr_2lss_;
+  HistogramAccumulator* histogram_mvaOutput_2lss_ttV_;
+  HistogramAccumulator* histogram_mvaOutput_2lss_ttbar_;
+  HistogramAccumulator* histogram_mvaDiscr_2lss_;
 
-  TH1* histogram_EventCounter_;
+  HistogramAccumulator* histogram_EventCounter_;
 
   std::vector<TH1*> histograms_;
 };
@@ -24,9 +24,9 @@ class EvtHistManager_jetToTauFakeRate
   void fillHistograms(int numJets, double evtWeight);
 
  private:
-  TH1* histogram_numJets_;
+  HistogramAccumulator* histogram_numJets_;
 
-  TH1* histogram_EventCounter_;
+  HistogramAccumulator* histogram_EventCounter_;
 
   std::vector<TH1*> histograms_;
 };
@@ -14,7 +14,7 @@ class GenHadTau
 	    Double_t mass, 
 	    Int_t charge);
 
-  Int_t charge_; ///< charge of hadronic tau (either +1 or -1)
+  Int_t charge_ PACKED_FLAG(2); ///< charge of hadronic tau (either +1 or -1)
 };
 
 #endif // tthAnalysis_HiggsToTauTau_GenHadTau_h
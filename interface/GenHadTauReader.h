@@ -2,9 +2,9 @@
 #define tthAnalysis_HiggsToTauTau_GenHadTauReader_h
 
 #include "tthAnalysis/HiggsToTauTau/interface/GenHadTau.h" // GenHadTau
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource, BranchBuffer
 
 #include <Rtypes.h> // Int_t, Float_t
-#include <TTree.h> // TTree
 
 #include <string>
 #include <vector>
@@ -18,15 +18,21 @@ class GenHadTauReader
   ~GenHadTauReader();
 
   /**
-   * @brief Call tree->SetBranchAddress for all GenHadTau branches
+   * @brief Get buffers from the EventSource for all GenHadTau branches
    */
-  void setBranchAddresses(TTree* tree);
+  void setBranchAddresses(EventSource& eventSource);
 
   /**
    * @brief Read branches from tree and use information to fill collection of GenHadTau objects
    * @return Collection of GenHadTau objects
    */
   std::vector<GenHadTau> read() const;
+
+  /**
+   * @brief Same as above, but fill the collection given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   */
+  void read(std::vector<GenHadTau>& hadTaus) const;
   
  protected: 
  /**
@@ -34,7 +40,6 @@ class GenHadTauReader
    */
   void setBranchNames();
 
-  const int max_nHadTaus_;
   std::string branchName_num_;
   std::string branchName_obj_;
 
@@ -44,17 +49,12 @@ class GenHadTauReader
   std::string branchName_mass_;
   std::string branchName_charge_;
 
-  Int_t nHadTaus_;
-  Float_t* hadTau_pt_;
-  Float_t* hadTau_eta_;
-  Float_t* hadTau_phi_;
-  Float_t* hadTau_mass_;
-  Int_t* hadTau_charge_;
-
-  // CV: make sure that only one GenHadTauReader instance exists for a given branchName,
-  //     as ROOT cannot handle multiple TTree::SetBranchAddress calls for the same branch.
-  static std::map<std::string, int> numInstances_;
-  static std::map<std::string, GenHadTauReader*> instances_;
+  Int_t* nHadTaus_;
+  BranchBuffer<Float_t> hadTau_pt_;
+  BranchBuffer<Float_t> hadTau_eta_;
+  BranchBuffer<Float_t> hadTau_phi_;
+  BranchBuffer<Float_t> hadTau_mass_;
+  BranchBuffer<Int_t> hadTau_charge_;
 };
 
 #endif // tthAnalysis_HiggsToTauTau_GenHadTauReader_h
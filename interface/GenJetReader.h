@@ -2,9 +2,9 @@
 #define tthAnalysis_HiggsToTauTau_GenJetReader_h
 
 #include "tthAnalysis/HiggsToTauTau/interface/GenJet.h" // GenJet
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource, BranchBuffer
 
 #include <Rtypes.h> // Int_t, Double_t
-#include <TTree.h> // TTree
 
 #include <string>
 #include <vector>
@@ -18,15 +18,21 @@ class GenJetReader
   ~GenJetReader();
 
   /**
-   * @brief Call tree->SetBranchAddress for all GenJet branches
+   * @brief Get buffers from the EventSource for all GenJet branches
    */
-  void setBranchAddresses(TTree* tree);
+  void setBranchAddresses(EventSource& eventSource);
 
   /**
    * @brief Read branches from tree and use information to fill collection of GenJet objects
    * @return Collection of GenJet objects
    */
   std::vector<GenJet> read() const;
+
+  /**
+   * @brief Same as above, but fill the collection given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   */
+  void read(std::vector<GenJet>& jets) const;
   
  protected: 
  /**
@@ -34,7 +40,6 @@ class GenJetReader
    */
   void setBranchNames();
 
-  const int max_nJets_;
   std::string branchName_num_;
   std::string branchName_obj_;
 
@@ -43,16 +48,11 @@ class GenJetReader
   std::string branchName_phi_;
   std::string branchName_mass_;
 
-  Int_t nJets_;
-  Float_t* jet_pt_;
-  Float_t* jet_eta_;
-  Float_t* jet_phi_;
-  Float_t* jet_mass_;
-
-  // CV: make sure that only one RecoJetReader instance exists for a given branchName,
-  //     as ROOT cannot handle multiple TTree::SetBranchAddress calls for the same branch.
-  static std::map<std::string, int> numInstances_;
-  static std::map<std::string, GenJetReader*> instances_;
+  Int_t* nJets_;
+  BranchBuffer<Float_t> jet_pt_;
+  BranchBuffer<Float_t> jet_eta_;
+  BranchBuffer<Float_t> jet_phi_;
+  BranchBuffer<Float_t> jet_mass_;
 };
 
 #endif // tthAnalysis_HiggsToTauTau_GenJetReader_h
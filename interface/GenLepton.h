@@ -14,8 +14,8 @@ class GenLepton
             Double_t mass,
             Int_t pdgId);
 
-  Int_t pdgId_;  ///< PDG id of the lepton (signed)
-  Int_t charge_; ///< charge of lepton (either +1 or -1, depending on pdgId)
+  Int_t pdgId_ PACKED_FLAG(8);  ///< PDG id of the lepton (signed)
+  Int_t charge_ PACKED_FLAG(2); ///< charge of lepton (either +1 or -1, depending on pdgId)
 };
 
 #endif // tthAnalysis_HiggsToTauTau_GenLepton_h
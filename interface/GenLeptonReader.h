@@ -2,9 +2,9 @@
 #define tthAnalysis_HiggsToTauTau_GenLeptonReader_h
 
 #include "tthAnalysis/HiggsToTauTau/interface/GenLepton.h" // GenLepton
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource, BranchBuffer
 
 #include <Rtypes.h> // Int_t, Double_t
-#include <TTree.h> // TTree
 
 #include <string>
 #include <vector>
@@ -18,15 +18,21 @@ class GenLeptonReader
   ~GenLeptonReader();
 
   /**
-   * @brief Call tree->SetBranchAddress for all GenLepton branches
+   * @brief Get buffers from the EventSource for all GenLepton branches
    */
-  void setBranchAddresses(TTree* tree);
+  void setBranchAddresses(EventSource& eventSource);
 
   /**
    * @brief Read branches from tree and use information to fill collection of GenLepton objects
    * @return Collection of GenLepton objects
    */
   std::vector<GenLepton> read() const;
+
+  /**
+   * @brief Same as above, but fill the collection given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   */
+  void read(std::vector<GenLepton>& leptons) const;
   
  protected: 
  /**
@@ -34,7 +40,6 @@ class GenLeptonReader
    */
   void setBranchNames();
 
-  const int max_nLeptons_;
   std::string branchName_num_;
   std::string branchName_obj_;
 
@@ -44,17 +49,12 @@ class GenLeptonReader
   std::string branchName_mass_;
   std::string branchName_pdgId_;
 
-  Int_t nLeptons_;
-  Float_t* lepton_pt_;
-  Float_t* lepton_eta_;
-  Float_t* lepton_phi_;
-  Float_t* lepton_mass_;
-  Int_t* lepton_pdgId_;
-
-  // CV: make sure that only one GenLeptonReader instance exists for a given branchName,
-  //     as ROOT cannot handle multiple TTree::SetBranchAddress calls for the same branch.
-  static std::map<std::string, int> numInstances_;
-  static std::map<std::string, GenLeptonReader*> instances_;
+  Int_t* nLeptons_;
+  BranchBuffer<Float_t> lepton_pt_;
+  BranchBuffer<Float_t> lepton_eta_;
+  BranchBuffer<Float_t> lepton_phi_;
+  BranchBuffer<Float_t> lepton_mass_;
+  BranchBuffer<Int_t> lepton_pdgId_;
 };
 
 #endif // tthAnalysis_HiggsToTauTau_GenLeptonReader_h
@@ -0,0 +1,162 @@
+#ifndef tthAnalysis_HiggsToTauTau_GenMatchTable_h
+#define tthAnalysis_HiggsToTauTau_GenMatchTable_h
+
+/** \class GenMatchTable
+ *
+ * Per-event table of matches between reconstructed particles and generator level electrons, muons, hadronic tau decays and jets.
+ *
+ * The matches for all reconstructed particles added to the table since the last call to computeGenMatches
+ * are computed in one pass, from a single matrix of dR^2 values between all reconstructed and all generator level particles.
+ * The results are stored by index of the reconstructed particle in the collection read from the Ntuple,
+ * so that the reconstructed particles do not need to be modified and the table can be used by many threads,
+ * each thread processing different events with its own instance of GenMatchTable.
+ *
+ * \author Christian Veelken, Tallinn
+ *
+ */
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include "tthAnalysis/HiggsToTauTau/interface/GenLepton.h" // GenLepton
+#include "tthAnalysis/HiggsToTauTau/interface/GenHadTau.h" // GenHadTau
+#include "tthAnalysis/HiggsToTauTau/interface/GenJet.h" // GenJet
+#include "tthAnalysis/HiggsToTauTau/interface/RecoMuon.h" // RecoMuon
+#include "tthAnalysis/HiggsToTauTau/interface/RecoElectron.h" // RecoElectron
+#include "tthAnalysis/HiggsToTauTau/interface/RecoHadTau.h" // RecoHadTau
+#include "tthAnalysis/HiggsToTauTau/interface/RecoJet.h" // RecoJet
+#include "tthAnalysis/HiggsToTauTau/interface/deltaRKernels.h" // EtaPhiArrays
+
+#include <vector> // std::vector
+#include <cstddef> // size_t
+
+/**
+ * @brief Generator level particles matched to one reconstructed particle (null pointers in case of no match)
+ */
+struct GenMatch
+{
+  GenMatch()
+    : genLepton_(0)
+    , genHadTau_(0)
+    , genJet_(0)
+  {}
+  const GenLepton* genLepton_;
+  const GenHadTau* genHadTau_;
+  const GenJet* genJet_;
+};
+
+class GenMatchTable
+{
+ public:
+  GenMatchTable(double dRmax_genLepton = 0.3, double dRmax_genHadTau = 0.3, double dRmax_genJet = 0.5);
+  ~GenMatchTable() {}
+
+  /**
+   * @brief Remove all generator level particles and all matches (to be called at the start of each event)
+   */
+  void clear();
+
+  /**
+   * @brief Set collections of generator level particles to which reconstructed particles are matched
+   *
+   *        The collections need to stay in memory while the table is in use.
+   */
+  void setGenParticles(const std::vector<GenLepton>& genLeptons, const std::vector<GenHadTau>& genHadTaus, const std::vector<GenJet>& genJets);
+
+  /**
+   * @brief Add reconstructed particles to be matched to generator level particles
+   * @param particles      Collection of reconstructed particles read from the Ntuple
+   *                       (the matches are stored by index of the particle in this collection)
+   * @param recParticles   Subset of particles to be matched
+   *
+   *        Any matches stored previously for the same type of reconstructed particles are removed
+   *        (needed in case the collection of jets is read again for a different systematic shift)
+   */
+  void addRecParticles(const std::vector<RecoMuon>& particles, const std::vector<const RecoMuon*>& recParticles);
+  void addRecParticles(const std::vector<RecoElectron>& particles, const std::vector<const RecoElectron*>& recParticles);
+  void addRecParticles(const std::vector<RecoHadTau>& particles, const std::vector<const RecoHadTau*>& recParticles);
+  void addRecParticles(const std::vector<RecoJet>& particles, const std::vector<const RecoJet*>& recParticles);
+
+  /**
+   * @brief Compute matches for all reconstructed particles added since the last call to this function
+   *
+   *        For each reconstructed particle, the closest generator level electron or muon, hadronic tau decay and jet is stored,
+   *        provided that it is within dRmax_genLepton, dRmax_genHadTau and dRmax_genJet, respectively.
+   */
+  void computeGenMatches();
+
+  /**
+   * @brief Return generator level particles matched to given reconstructed particle
+   *        (a GenMatch holding null pointers in case the reconstructed particle has not been matched)
+   */
+  const GenMatch& getGenMatch(const RecoMuon& particle) const;
+  const GenMatch& getGenMatch(const RecoElectron& particle) const;
+  const GenMatch& getGenMatch(const RecoLepton& particle) const;
+  const GenMatch& getGenMatch(const RecoHadTau& particle) const;
+  const GenMatch& getGenMatch(const RecoJet& particle) const;
+
+ protected:
+  enum { kMuon, kElectron, kHadTau, kJet, kNumRecTypes };
+
+  /**
+   * @brief Matches for one type of reconstructed particles, stored by index of the particle in the collection read from the Ntuple
+   */
+  struct RecMatches
+  {
+    RecMatches()
+      : begin_(0)
+      , numParticles_(0)
+    {}
+    const void* begin_;
+    size_t numParticles_;
+    std::vector<GenMatch> genMatches_;
+  };
+  RecMatches recMatches_[kNumRecTypes];
+
+  template <typename T>
+  void addRecParticles_impl(int recType, const std::vector<T>& particles, const std::vector<const T*>& recParticles)
+  {
+    RecMatches& recMatches = recMatches_[recType];
+    recMatches.begin_ = particles.data();
+    recMatches.numParticles_ = particles.size();
+    recMatches.genMatches_.assign(particles.size(), GenMatch());
+    for ( typename std::vector<const T*>::const_iterator recParticle = recParticles.begin();
+	  recParticle != recParticles.end(); ++recParticle ) {
+      if ( !((*recParticle) >= particles.data() && (*recParticle) < particles.data() + particles.size()) )
+	throw cms::Exception("GenMatchTable")
+	  << "Reconstructed particle not contained in collection given as function argument !!\n";
+      recParticles_etaPhi_.push_back((*recParticle)->eta_, (*recParticle)->phi_);
+      recParticles_type_.push_back(recType);
+      recParticles_idx_.push_back((*recParticle) - particles.data());
+    }
+  }
+
+  template <typename T>
+  const GenMatch& getGenMatch_impl(int recType, const T& particle) const
+  {
+    const RecMatches& recMatches = recMatches_[recType];
+    const T* begin = static_cast<const T*>(recMatches.begin_);
+    if ( begin && &particle >= begin && &particle < begin + recMatches.numParticles_ ) {
+      return recMatches.genMatches_[&particle - begin];
+    }
+    return noGenMatch_;
+  }
+
+  double dR2max_genLepton_;
+  double dR2max_genHadTau_;
+  double dR2max_genJet_;
+
+  const std::vector<GenLepton>* genLeptons_;
+  const std::vector<GenHadTau>* genHadTaus_;
+  const std::vector<GenJet>* genJets_;
+
+  // CV: kept as data members, so that the memory is reused from one event to the next
+  EtaPhiArrays genParticles_etaPhi_;
+  EtaPhiArrays recParticles_etaPhi_;
+  std::vector<int> recParticles_type_;
+  std::vector<size_t> recParticles_idx_;
+  std::vector<float> dR2_;
+
+  GenMatch noGenMatch_;
+};
+
+#endif // tthAnalysis_HiggsToTauTau_GenMatchTable_h
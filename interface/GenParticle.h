@@ -2,7 +2,25 @@
 #define tthAnalysis_HiggsToTauTau_GenParticle_h
 
 #include <Rtypes.h> // Int_t, Long64_t, Double_t
-#include "DataFormats/Math/interface/LorentzVector.h" // math::PtEtaPhiMLorentzVector
+#include "DataFormats/Math/interface/LorentzVector.h" // math::PtEtaPhiMLorentzVector, math::XYZTLorentzVectorD, math::XYZTLorentzVectorF
+
+// CV: set the following flag to 1 in order to use the compact object layout,
+//     in which observables are stored in single precision (as they are in the Ntuple)
+//     and integer-valued flags are packed into bit-fields
+#define COMPACT_OBJECTS_FLAG 0
+#if COMPACT_OBJECTS_FLAG == 1
+#define COMPACT_OBJECTS
+#endif
+
+#ifdef COMPACT_OBJECTS
+typedef Float_t Observable_t;
+typedef math::XYZTLorentzVectorF P4_t;
+#define PACKED_FLAG(numBits) : numBits
+#else
+typedef Double_t Observable_t;
+typedef math::XYZTLorentzVectorD P4_t;
+#define PACKED_FLAG(numBits)
+#endif
 
 class GenParticle
 {
@@ -13,14 +31,32 @@ public:
               Double_t phi,
               Double_t mass);
 
-  Double_t pt_;   ///< pT of the particle
-  Double_t eta_;  ///< eta of the particle
-  Double_t phi_;  ///< phi of the particle
-  Double_t mass_; ///< mass of the particle
+  Observable_t pt_;   ///< pT of the particle
+  Observable_t eta_;  ///< eta of the particle
+  Observable_t phi_;  ///< phi of the particle
+  Observable_t mass_; ///< mass of the particle
 
-  Double_t absEta_; ///< |eta| of the particle
+  Observable_t absEta_; ///< |eta| of the particle
 
-  math::PtEtaPhiMLorentzVector p4_; ///< 4-momentum constructed from the pT, eta, phi and mass
+  /**
+   * @brief Return 4-momentum constructed from the pT, eta, phi and mass.
+   *
+   *        The Cartesian components of the 4-momentum are computed on the first call and cached,
+   *        so that particles which fail the selection never pay for the trigonometric functions
+   *        and particles that enter several invariant masses or pT sums pay for them only once.
+   *
+   *        NOTE: the cache is not reset when pt_, eta_, phi_ or mass_ are modified;
+   *              the particles are filled by the readers and not modified afterwards.
+   */
+  const P4_t &
+  p4() const
+  {
+    if ( !p4_isValid_ ) {
+      p4_ = P4_t(math::PtEtaPhiMLorentzVector(pt_, eta_, phi_, mass_));
+      p4_isValid_ = true;
+    }
+    return p4_;
+  }
 
   /**
    * @brief Calculates dR between our and the other particle.
@@ -49,6 +85,10 @@ public:
   bool
   is_overlap(const GenParticle & other,
              double dR_min) const;
+
+protected:
+  mutable P4_t p4_;                  ///< 4-momentum in Cartesian coordinates (cached)
+  mutable bool p4_isValid_ = false;  ///< flag indicating if p4_ has been computed
 };
 
 #endif // tthAnalysis_HiggsToTauTau_GenParticle_h
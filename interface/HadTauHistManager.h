@@ -11,6 +11,7 @@
 
 #include "tthAnalysis/HiggsToTauTau/interface/HistManagerBase.h" // HistManagerBase
 #include "tthAnalysis/HiggsToTauTau/interface/RecoHadTau.h"
+#include "tthAnalysis/HiggsToTauTau/interface/GenMatchTable.h" // GenMatchTable
 
 class HadTauHistManager
   : public HistManagerBase
@@ -21,25 +22,25 @@ class HadTauHistManager
 
   /// book and fill histograms
   void bookHistograms(TFileDirectory& dir);
-  void fillHistograms(const std::vector<const RecoHadTau*>& hadTau_ptrs, double evtWeight);
+  void fillHistograms(const std::vector<const RecoHadTau*>& hadTau_ptrs, const GenMatchTable& genMatchTable, double evtWeight);
 
  private:
-  TH1* histogram_pt_;
-  TH1* histogram_eta_;
-  TH1* histogram_phi_;
-  TH1* histogram_mass_;
-  TH1* histogram_charge_;
-
-  TH1* histogram_dz_; 
-  TH1* histogram_decayModeFinding_;
-  TH1* histogram_id_mva_dR03_;     
-  TH1* histogram_id_mva_dR05_;  
-  TH1* histogram_id_cut_dR03_;   
-  TH1* histogram_id_cut_dR05_;   
-  TH1* histogram_antiElectron_;
-  TH1* histogram_antiMuon_;   
-
-  TH1* histogram_abs_genPdgId_;
+  HistogramAccumulator* histogram_pt_;
+  HistogramAccumulator* histogram_eta_;
+  HistogramAccumulator* histogram_phi_;
+  HistogramAccumulator* histogram_mass_;
+  HistogramAccumulator* histogram_charge_;
+
+  HistogramAccumulator* histogram_dz_; 
+  HistogramAccumulator* histogram_decayModeFinding_;
+  HistogramAccumulator* histogram_id_mva_dR03_;     
+  HistogramAccumulator* histogram_id_mva_dR05_;  
+  HistogramAccumulator* histogram_id_cut_dR03_;   
+  HistogramAccumulator* histogram_id_cut_dR05_;   
+  HistogramAccumulator* histogram_antiElectron_;
+  HistogramAccumulator* histogram_antiMuon_;   
+
+  HistogramAccumulator* histogram_abs_genPdgId_;
 
   std::vector<TH1*> histograms_;
 
@@ -13,6 +13,8 @@
 
 #include "CommonTools/Utils/interface/TFileDirectory.h" // TFileDirectory
 
+#include "tthAnalysis/HiggsToTauTau/interface/HistogramAccumulator.h" // HistogramAccumulator, fillWithOverFlow, fillWithOverFlow2d
+
 #include <TH1.h> // TH1D
 #include <TH2.h> // TH2D
 #include <TString.h> // Form
@@ -25,26 +27,73 @@ class HistManagerBase
 {
  public:
   HistManagerBase(const edm::ParameterSet& cfg);
-  ~HistManagerBase() {}
+  HistManagerBase(const HistManagerBase&) = delete;
+  HistManagerBase& operator=(const HistManagerBase&) = delete;
+  virtual ~HistManagerBase();
+
+  /**
+   * @brief Fill histograms for several systematic shifts that differ in the event weight only, in one pass
+   * @param central_or_shifts Names of the shifts, the first one replacing the central_or_shift value given in the cfg
+   * @param weights           Weight of the event for each shift, multiplied by the event weight passed to fillHistograms
+   *                          (owned by the caller, updated for each event)
+   *
+   *        One histogram per shift is booked for each distribution and all shifts are filled by one call to fillHistograms.
+   *        Needs to be called before bookHistograms.
+   */
+  void setWeightShifts(const std::vector<std::string>& central_or_shifts, const double* weights);
 
   /// book and fill histograms
   virtual void bookHistograms(TFileDirectory& dir) = 0;
+
+  /**
+   * @brief Add histograms filled by another instance of the same HistManager class
+   *        (used to merge the histograms filled by different threads)
+   */
+  void merge(const HistManagerBase& shard);
+
+  /**
+   * @brief Add the events accumulated since the last call to this function to the booked histograms
+   */
+  void flush();
+
+  /**
+   * @brief Call flush for all existing instances of HistManager classes
+   *       (to be called once at the end of the job, before the output file is written)
+   */
+  static void flushAll();
   
  protected:
-  TH1* book1D(TFileDirectory& dir, const std::string& distribution, const std::string& title, int numBins, double min, double max);
-  TH1* book1D(TFileDirectory& dir, const std::string& distribution, const std::string& title, int numBins, float* binning);
-  TH2* book2D(TFileDirectory& dir, const std::string& distribution, const std::string& title, int numBinsX, double xMin, double xMax, int numBinsY, double yMin, double yMax);
-  TH2* book2D(TFileDirectory& dir, const std::string& distribution, const std::string& title, int numBinsX, float* binningX, int numBinsY, float* binningY);
+  /**
+   * @brief Book histogram in given directory
+   * @return Accumulator for the histogram, to be passed to the fill and fillWithOverFlow functions
+   *
+   *        The events are added to the booked histogram only when flush is called.
+   */
+  HistogramAccumulator* book1D(TFileDirectory& dir, const std::string& distribution, const std::string& title, int numBins, double min, double max);
+  HistogramAccumulator* book1D(TFileDirectory& dir, const std::string& distribution, const std::string& title, int numBins, float* binning);
+  HistogramAccumulator* book2D(TFileDirectory& dir, const std::string& distribution, const std::string& title, int numBinsX, double xMin, double xMax, int numBinsY, double yMin, double yMax);
+  HistogramAccumulator* book2D(TFileDirectory& dir, const std::string& distribution, const std::string& title, int numBinsX, float* binningX, int numBinsY, float* binningY);
+
+  /**
+   * @brief Create accumulator for the histograms booked for all systematic shifts of one distribution
+   */
+  HistogramAccumulator* addAccumulator(const std::vector<TH1*>& histograms);
 
   TDirectory* createHistogramSubdirectory(TFileDirectory&);
 
-  std::string getHistogramName(const std::string&) const;
+  std::string getHistogramName(const std::string& distribution, const std::string& central_or_shift) const;
 
   std::string process_;
   std::string category_;
   std::string central_or_shift_;
+  std::vector<std::string> central_or_shifts_; // all shifts filled in one pass (first element = central_or_shift_)
+  const double* weights_shift_;                // null in case only central_or_shift_ is filled
 
   std::vector<TH1*> histograms_;
+  std::vector<HistogramAccumulator*> accumulators_;
+
+  // CV: HistManager instances are created by the main thread only, before the event loop is started
+  static std::vector<HistManagerBase*> instances_;
 };
 
 edm::ParameterSet makeHistManager_cfg(const std::string& process, const std::string& category, const std::string& central_or_shift, int idx = -1);
@@ -0,0 +1,171 @@
+#ifndef tthAnalysis_HiggsToTauTau_HistogramAccumulator_h
+#define tthAnalysis_HiggsToTauTau_HistogramAccumulator_h
+
+/** \class HistogramAccumulator
+ *
+ * Accumulate the sum of weights and the sum of squared weights per bin of a booked TH1 or TH2 histogram
+ * in plain arrays, and add them to the histogram once, at the end of the job.
+ *
+ * The bin is computed arithmetically for axes with bins of equal width and by binary search for axes with variable bin widths,
+ * using the same convention as TAxis::FindBin, so that the content of the histogram is the same
+ * as if it had been filled directly by the fill and fillWithOverFlow functions defined in histogramAuxFunctions.h.
+ *
+ * Systematic shifts that change the event weight only (e.g. the shifts of the b-tagging weights) can be accumulated
+ * by the same instance: the bin is computed once per fill, and the sums of weights for the N shifts are stored next to each other
+ * and added to N separate histograms, one per shift, when flush is called.
+ * The weight of each shift is the product of the event weight passed to the fill functions, which is common to all shifts,
+ * and the weight given for that shift, so that the weights of the shifts do not depend on each other.
+ *
+ * \author Christian Veelken, Tallinn
+ *
+ */
+
+#include <TH1.h> // TH1
+#include <TAxis.h> // TAxis
+
+#include <vector> // std::vector
+#include <algorithm> // std::upper_bound
+
+class HistogramAccumulator
+{
+ public:
+  HistogramAccumulator(TH1* histogram);
+
+  /**
+   * @brief Accumulate events for several systematic shifts that differ in the event weight only
+   * @param histograms One histogram per shift, all with the same binning
+   * @param weights    Weight of the event for each shift, multiplied by the event weight passed to the fill functions
+   *
+   *        The weights are owned by the caller and may change from one event to the next.
+   */
+  HistogramAccumulator(const std::vector<TH1*>& histograms, const double* weights);
+  HistogramAccumulator(const HistogramAccumulator&) = delete;
+  HistogramAccumulator& operator=(const HistogramAccumulator&) = delete;
+  ~HistogramAccumulator() {}
+
+  /**
+   * @brief Add event to histogram, discarding underflow and overflow
+   */
+  void fill(double x, double evtWeight, double evtWeightErr)
+  {
+    int binX = xAxis_.findBin(x);
+    if ( !(binX >= 1 && binX <= xAxis_.numBins_) ) return;
+    add(binX, evtWeight, evtWeightErr);
+  }
+  void fill2d(double x, double y, double evtWeight, double evtWeightErr)
+  {
+    int binX = xAxis_.findBin(x);
+    if ( !(binX >= 1 && binX <= xAxis_.numBins_) ) return;
+    int binY = yAxis_.findBin(y);
+    if ( !(binY >= 1 && binY <= yAxis_.numBins_) ) return;
+    add(binX + (xAxis_.numBins_ + 2)*binY, evtWeight, evtWeightErr);
+  }
+
+  /**
+   * @brief Add event to histogram, adding underflow (overflow) to the first (last) bin
+   */
+  void fillWithOverFlow(double x, double evtWeight, double evtWeightErr)
+  {
+    add(xAxis_.findBin_clamped(x), evtWeight, evtWeightErr);
+  }
+  void fillWithOverFlow2d(double x, double y, double evtWeight, double evtWeightErr)
+  {
+    add(xAxis_.findBin_clamped(x) + (xAxis_.numBins_ + 2)*yAxis_.findBin_clamped(y), evtWeight, evtWeightErr);
+  }
+
+  /**
+   * @brief Add the sums accumulated by another instance for a histogram with the same binning
+   *        (used to merge the histograms filled by different threads)
+   */
+  void add(const HistogramAccumulator& other);
+
+  /**
+   * @brief Add the accumulated sums to the booked histogram and reset them to zero
+   */
+  void flush();
+
+  int getNumShifts() const { return numShifts_; }
+  TH1* getHistogram(int idxShift = 0) const { return histograms_[idxShift]; }
+
+ protected:
+  /**
+   * @brief Binning of one axis, copied from the TAxis of the booked histogram
+   */
+  struct Axis
+  {
+    Axis(const TAxis* axis);
+    int findBin(double x) const
+    {
+      // CV: same convention as TAxis::FindBin (NaN values are counted as overflow)
+      if ( x < min_ ) return 0;
+      if ( !(x < max_) ) return numBins_ + 1;
+      if ( binEdges_.empty() ) return 1 + int(numBins_*(x - min_)/(max_ - min_));
+      return std::upper_bound(binEdges_.begin(), binEdges_.end(), x) - binEdges_.begin();
+    }
+    int findBin_clamped(double x) const
+    {
+      int bin = findBin(x);
+      if ( bin < 1        ) bin = 1;
+      if ( bin > numBins_ ) bin = numBins_;
+      return bin;
+    }
+    int numBins_;
+    double min_;
+    double max_;
+    std::vector<double> binEdges_; // empty for bins of equal width
+  };
+
+  /**
+   * @brief Allocate the arrays for the sums of weights, after checking that all histograms have the same binning
+   */
+  void initialize();
+
+  void add(int bin, double evtWeight, double evtWeightErr)
+  {
+    double* sumw = &sumw_[bin*numShifts_];
+    double* sumw2 = &sumw2_[bin*numShifts_];
+    for ( int idxShift = 0; idxShift < numShifts_; ++idxShift ) {
+      double evtWeight_shift = evtWeight*weights_[idxShift];
+      double evtWeightErr_shift = evtWeightErr*weights_[idxShift];
+      sumw[idxShift] += evtWeight_shift;
+      sumw2[idxShift] += evtWeight_shift*evtWeight_shift + evtWeightErr_shift*evtWeightErr_shift;
+    }
+    ++numEntries_;
+  }
+
+  std::vector<TH1*> histograms_;
+  int numShifts_;
+  const double* weights_;
+  double weight_unity_; // used in case of a single histogram
+
+  Axis xAxis_;
+  Axis yAxis_; // not used for one-dimensional histograms
+
+  // CV: indexed by numShifts*bin + idxShift, with bin the global bin number in the same layout as TH1::GetBin
+  std::vector<double> sumw_;
+  std::vector<double> sumw2_;
+  long numEntries_;
+};
+
+/**
+ * @brief Overloads of the functions defined in histogramAuxFunctions.h,
+ *        so that the HistManager classes fill accumulators and histograms in the same way
+ */
+inline void fill(HistogramAccumulator* histogram, double x, double evtWeight, double evtWeightErr)
+{
+  histogram->fill(x, evtWeight, evtWeightErr);
+}
+inline void fillWithOverFlow(HistogramAccumulator* histogram, double x, double evtWeight, double evtWeightErr)
+{
+  histogram->fillWithOverFlow(x, evtWeight, evtWeightErr);
+}
+inline void fill2d(HistogramAccumulator* histogram, double x, double y, double evtWeight, double evtWeightErr)
+{
+  histogram->fill2d(x, y, evtWeight, evtWeightErr);
+}
+inline void fillWithOverFlow2d(HistogramAccumulator* histogram, double x, double y, double evtWeight, double evtWeightErr)
+{
+  histogram->fillWithOverFlow2d(x, y, evtWeight, evtWeightErr);
+}
+
+#endif // tthAnalysis_HiggsToTauTau_HistogramAccumulator_h
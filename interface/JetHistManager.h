@@ -11,6 +11,7 @@
 
 #include "tthAnalysis/HiggsToTauTau/interface/HistManagerBase.h" // HistManagerBase
 #include "tthAnalysis/HiggsToTauTau/interface/RecoJet.h"
+#include "tthAnalysis/HiggsToTauTau/interface/GenMatchTable.h" // GenMatchTable
 
 class JetHistManager
   : public HistManagerBase
@@ -21,17 +22,17 @@ class JetHistManager
 
   /// book and fill histograms
   void bookHistograms(TFileDirectory& dir);
-  void fillHistograms(const std::vector<const RecoJet*>& jets, double evtWeight);
+  void fillHistograms(const std::vector<const RecoJet*>& jets, const GenMatchTable& genMatchTable, double evtWeight);
 
  private:
-  TH1* histogram_pt_;
-  TH1* histogram_eta_;
-  TH1* histogram_phi_;
-  TH1* histogram_mass_;
+  HistogramAccumulator* histogram_pt_;
+  HistogramAccumulator* histogram_eta_;
+  HistogramAccumulator* histogram_phi_;
+  HistogramAccumulator* histogram_mass_;
 
-  TH1* histogram_BtagCSV_; 
+  HistogramAccumulator* histogram_BtagCSV_; 
 
-  TH1* histogram_abs_genPdgId_;
+  HistogramAccumulator* histogram_abs_genPdgId_;
 
   std::vector<TH1*> histograms_;
 
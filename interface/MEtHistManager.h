@@ -26,14 +26,14 @@ class MEtHistManager
   void fillHistograms(const LV& met_p4, const LV& mht_p4, double met_LD, double evtWeight);
 
  private:
-  TH1* histogram_met_pt_;
-  TH1* histogram_met_phi_;
-  TH1* histogram_mht_pt_;
-  TH1* histogram_mht_phi_;
+  HistogramAccumulator* histogram_met_pt_;
+  HistogramAccumulator* histogram_met_phi_;
+  HistogramAccumulator* histogram_mht_pt_;
+  HistogramAccumulator* histogram_mht_phi_;
   
-  TH2* histogram_mhtPt_vs_metPt_;
+  HistogramAccumulator* histogram_mhtPt_vs_metPt_;
 
-  TH1* histogram_met_LD_;
+  HistogramAccumulator* histogram_met_LD_;
 
   std::vector<TH1*> histograms_;
 };
@@ -0,0 +1,143 @@
+#ifndef tthAnalysis_HiggsToTauTau_MVAOutputCache_h
+#define tthAnalysis_HiggsToTauTau_MVAOutputCache_h
+
+#include "tthAnalysis/HiggsToTauTau/interface/KeyTypes.h" // RUN_TYPE, LUMI_TYPE, EVT_TYPE
+
+#include <Rtypes.h> // Float_t, Long64_t
+
+#include <string> // std::string
+#include <vector> // std::vector<>
+#include <unordered_map> // std::unordered_map<,>
+
+/**
+ * @brief Memoize the outputs of a set of MVAs that are computed from the same array of input values,
+ *        keyed on run, lumi and event number and on a hash of the input values.
+ *
+ *        When several systematic shifts are processed for the same event, the MVAs need to be evaluated again
+ *        only for the shifts that change the input values (e.g. JES shifts that change the set of jets passing the jet selection).
+ *        The input values of each entry are stored and compared bit by bit, so that a collision of the hash values cannot return wrong outputs.
+ *
+ *        The entries can be written to a "sidecar" file at the end of a job and read back by later jobs processing the same events.
+ *        Layout of the file (all numbers in native byte order):
+ *          - magic string "TTHMVA01" (8 bytes)
+ *          - tag identifying the MVAs (length as Int_t, followed by the characters), number of input values and number of outputs (Int_t)
+ *          - number of entries (Long64_t), followed by run, lumi and event number, input values and outputs of each entry
+ *        Files written for a different tag, i.e. for different MVAs or a different layout of the input values, are ignored.
+ */
+class MVAOutputCache
+{
+ public:
+  /**
+   * @param tag           Identifies the MVAs and the layout of the input values (see getMVAOutputCacheTag)
+   * @param keepAllEvents If false, only the entries of the most recent event are kept (sufficient for sharing the outputs across systematic shifts);
+   *                      if true, the entries of all events are kept, so that they can be written to a file
+   */
+  MVAOutputCache(const std::string& tag, int numInputs, int numOutputs, bool keepAllEvents);
+  MVAOutputCache(const MVAOutputCache&) = delete;
+  MVAOutputCache& operator=(const MVAOutputCache&) = delete;
+  ~MVAOutputCache() {}
+
+  /**
+   * @brief Return outputs cached for given event and input values,
+   *        null pointer in case no outputs have been cached for them (neither in this cache nor in the cache given to setFallback)
+   */
+  const double* find(RUN_TYPE run, LUMI_TYPE lumi, EVT_TYPE event, const Float_t* mvaInputs);
+
+  /**
+   * @brief Add outputs computed for given event and input values
+   */
+  void insert(RUN_TYPE run, LUMI_TYPE lumi, EVT_TYPE event, const Float_t* mvaInputs, const double* mvaOutputs);
+
+  /**
+   * @brief Search the entries of another cache in case no entry is found in this cache
+   *        (used to share the entries read from a sidecar file between threads: the other cache is not modified by find)
+   */
+  void setFallback(const MVAOutputCache* fallback);
+
+  /**
+   * @brief Add the entries of another cache with the same tag
+   *        (used to merge the entries of the caches of different threads before writing them to a file)
+   */
+  void merge(const MVAOutputCache& other);
+
+  /**
+   * @brief Read entries from a sidecar file
+   * @return false in case the file does not exist or has been written for a different tag
+   */
+  bool read(const std::string& fileName);
+
+  /**
+   * @brief Write all entries to a sidecar file
+   */
+  void write(const std::string& fileName) const;
+
+  size_t size() const { return entries_.size(); }
+  long getNumHits() const { return numHits_; }
+  long getNumMisses() const { return numMisses_; }
+
+ protected:
+  struct Key
+  {
+    RUN_TYPE run_;
+    LUMI_TYPE lumi_;
+    EVT_TYPE event_;
+    unsigned long long inputHash_;
+    bool operator==(const Key& other) const
+    {
+      return inputHash_ == other.inputHash_ && event_ == other.event_ && lumi_ == other.lumi_ && run_ == other.run_;
+    }
+  };
+  struct KeyHash
+  {
+    size_t operator()(const Key& key) const { return key.inputHash_ ^ (key.event_*0x9e3779b97f4a7c15ULL); }
+  };
+
+  Key makeKey(RUN_TYPE run, LUMI_TYPE lumi, EVT_TYPE event, const Float_t* mvaInputs) const;
+
+  /**
+   * @brief Return outputs of entry with given key and input values, null pointer in case no such entry exists
+   */
+  const double* findEntry(const Key& key, const Float_t* mvaInputs) const;
+
+  /**
+   * @brief Add entry, unless an entry with the same key exists already
+   *        (in the unlikely case of two sets of input values with the same hash value, only the first one is cached)
+   */
+  void addEntry(const Key& key, const Float_t* mvaInputs, const double* mvaOutputs);
+
+  /**
+   * @brief Remove all entries, unless keepAllEvents is set or the entries belong to the given event
+   */
+  void startEvent(RUN_TYPE run, LUMI_TYPE lumi, EVT_TYPE event);
+
+  std::string tag_;
+  int numInputs_;
+  int numOutputs_;
+  bool keepAllEvents_;
+
+  const MVAOutputCache* fallback_;
+
+  // CV: the map holds the index of each entry in the arrays of input values and outputs,
+  //     in which the values of all entries are stored contiguously
+  std::unordered_map<Key, size_t, KeyHash> entries_;
+  std::vector<Key> keys_;
+  std::vector<Float_t> inputs_;
+  std::vector<double> outputs_;
+
+  RUN_TYPE lastRun_;
+  LUMI_TYPE lastLumi_;
+  EVT_TYPE lastEvent_;
+
+  long numHits_;
+  long numMisses_;
+};
+
+/**
+ * @brief Build tag identifying the MVAs and the layout of their input values,
+ *        from the names and the checksums of the weight files and from the names of the input values
+ * @param mvaFileNames   Names of the weight files, as passed to edm::FileInPath, in the order of the outputs
+ * @param mvaInputLayout Names of the input values, in the order in which they are stored
+ */
+std::string getMVAOutputCacheTag(const std::vector<std::string>& mvaFileNames, const std::vector<std::string>& mvaInputLayout);
+
+#endif // tthAnalysis_HiggsToTauTau_MVAOutputCache_h
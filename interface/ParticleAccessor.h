@@ -0,0 +1,164 @@
+#ifndef tthAnalysis_HiggsToTauTau_ParticleAccessor_h
+#define tthAnalysis_HiggsToTauTau_ParticleAccessor_h
+
+#include "tthAnalysis/HiggsToTauTau/interface/RecoMuon.h" // RecoMuon
+#include "tthAnalysis/HiggsToTauTau/interface/RecoElectron.h" // RecoElectron
+#include "tthAnalysis/HiggsToTauTau/interface/RecoHadTau.h" // RecoHadTau
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionView.h" // RecoMuonCollectionView, RecoElectronCollectionView, RecoHadTauCollectionView
+
+#include <Rtypes.h> // Int_t, Double_t
+
+#include <cmath> // std::fabs
+
+/**
+ * @brief Accessors to the observables of one particle,
+ *        either stored in a particle object (e.g. RecoMuonAccessor) or in the branch buffers of a view (e.g. RecoMuonViewAccessor).
+ *
+ *        Selectors implement their cuts once, as template function taking an accessor as argument,
+ *        and apply the same cuts to particle objects and to views.
+ *        Only the observables used by selectors that support views are provided.
+ */
+
+class RecoMuonAccessor
+{
+ public:
+  RecoMuonAccessor(const RecoMuon& muon)
+    : muon_(muon)
+  {}
+
+  Double_t pt() const { return muon_.pt_; }
+  Double_t absEta() const { return muon_.absEta_; }
+  Double_t dxy() const { return muon_.dxy_; }
+  Double_t dz() const { return muon_.dz_; }
+  Double_t relIso() const { return muon_.relIso_; }
+  Double_t sip3d() const { return muon_.sip3d_; }
+  Int_t passesLooseIdPOG() const { return muon_.passesLooseIdPOG_; }
+  Int_t passesMediumIdPOG() const { return muon_.passesMediumIdPOG_; }
+
+ protected:
+  const RecoMuon& muon_;
+};
+
+class RecoMuonViewAccessor
+{
+ public:
+  RecoMuonViewAccessor(const RecoMuonCollectionView& muons, int idx)
+    : muons_(muons)
+    , idx_(idx)
+  {}
+
+  Double_t pt() const { return muons_.pt_[idx_]; }
+  Double_t absEta() const { return std::fabs(muons_.eta_[idx_]); }
+  Double_t dxy() const { return muons_.dxy_[idx_]; }
+  Double_t dz() const { return muons_.dz_[idx_]; }
+  Double_t relIso() const { return muons_.relIso_[idx_]; }
+  Double_t sip3d() const { return muons_.sip3d_[idx_]; }
+  Int_t passesLooseIdPOG() const { return muons_.passesLooseIdPOG_[idx_]; }
+  Int_t passesMediumIdPOG() const { return muons_.passesMediumIdPOG_[idx_]; }
+
+ protected:
+  const RecoMuonCollectionView& muons_;
+  int idx_;
+};
+
+class RecoElectronAccessor
+{
+ public:
+  RecoElectronAccessor(const RecoElectron& electron)
+    : electron_(electron)
+  {}
+
+  Double_t pt() const { return electron_.pt_; }
+  Double_t absEta() const { return electron_.absEta_; }
+  Double_t dxy() const { return electron_.dxy_; }
+  Double_t dz() const { return electron_.dz_; }
+  Double_t relIso() const { return electron_.relIso_; }
+  Double_t sip3d() const { return electron_.sip3d_; }
+  Int_t tightCharge() const { return electron_.tightCharge_; }
+  Int_t passesConversionVeto() const { return electron_.passesConversionVeto_; }
+  Int_t nLostHits() const { return electron_.nLostHits_; }
+  Double_t mvaRawPOG() const { return electron_.mvaRawPOG_; }
+
+ protected:
+  const RecoElectron& electron_;
+};
+
+class RecoElectronViewAccessor
+{
+ public:
+  RecoElectronViewAccessor(const RecoElectronCollectionView& electrons, int idx)
+    : electrons_(electrons)
+    , idx_(idx)
+  {}
+
+  Double_t pt() const { return electrons_.pt_[idx_]; }
+  Double_t absEta() const { return std::fabs(electrons_.eta_[idx_]); }
+  Double_t dxy() const { return electrons_.dxy_[idx_]; }
+  Double_t dz() const { return electrons_.dz_[idx_]; }
+  Double_t relIso() const { return electrons_.relIso_[idx_]; }
+  Double_t sip3d() const { return electrons_.sip3d_[idx_]; }
+  Int_t tightCharge() const { return electrons_.tightCharge_[idx_]; }
+  Int_t passesConversionVeto() const { return electrons_.passesConversionVeto_[idx_]; }
+  Int_t nLostHits() const { return electrons_.nLostHits_[idx_]; }
+  Double_t mvaRawPOG() const { return electrons_.mvaRawPOG_[idx_]; }
+
+ protected:
+  const RecoElectronCollectionView& electrons_;
+  int idx_;
+};
+
+class RecoHadTauAccessor
+{
+ public:
+  RecoHadTauAccessor(const RecoHadTau& hadTau)
+    : hadTau_(hadTau)
+  {}
+
+  Double_t pt() const { return hadTau_.pt_; }
+  Double_t absEta() const { return hadTau_.absEta_; }
+  Double_t dz() const { return hadTau_.dz_; }
+  Int_t decayModeFinding() const { return hadTau_.decayModeFinding_; }
+  Int_t id_mva_dR03() const { return hadTau_.id_mva_dR03_; }
+  Double_t raw_mva_dR03() const { return hadTau_.raw_mva_dR03_; }
+  Int_t id_mva_dR05() const { return hadTau_.id_mva_dR05_; }
+  Double_t raw_mva_dR05() const { return hadTau_.raw_mva_dR05_; }
+  Int_t id_cut_dR03() const { return hadTau_.id_cut_dR03_; }
+  Double_t raw_cut_dR03() const { return hadTau_.raw_cut_dR03_; }
+  Int_t id_cut_dR05() const { return hadTau_.id_cut_dR05_; }
+  Double_t raw_cut_dR05() const { return hadTau_.raw_cut_dR05_; }
+  Int_t antiElectron() const { return hadTau_.antiElectron_; }
+  Int_t antiMuon() const { return hadTau_.antiMuon_; }
+
+ protected:
+  const RecoHadTau& hadTau_;
+};
+
+class RecoHadTauViewAccessor
+{
+ public:
+  RecoHadTauViewAccessor(const RecoHadTauCollectionView& hadTaus, int idx)
+    : hadTaus_(hadTaus)
+    , idx_(idx)
+  {}
+
+  Double_t pt() const { return hadTaus_.pt_[idx_]; }
+  Double_t absEta() const { return std::fabs(hadTaus_.eta_[idx_]); }
+  Double_t dz() const { return hadTaus_.dz_[idx_]; }
+  Int_t decayModeFinding() const { return hadTaus_.decayModeFinding_[idx_]; }
+  Int_t id_mva_dR03() const { return hadTaus_.id_mva_dR03_[idx_]; }
+  Double_t raw_mva_dR03() const { return hadTaus_.raw_mva_dR03_[idx_]; }
+  Int_t id_mva_dR05() const { return hadTaus_.id_mva_dR05_[idx_]; }
+  Double_t raw_mva_dR05() const { return hadTaus_.raw_mva_dR05_[idx_]; }
+  Int_t id_cut_dR03() const { return hadTaus_.id_cut_dR03_[idx_]; }
+  Double_t raw_cut_dR03() const { return hadTaus_.raw_cut_dR03_[idx_]; }
+  Int_t id_cut_dR05() const { return hadTaus_.id_cut_dR05_[idx_]; }
+  Double_t raw_cut_dR05() const { return hadTaus_.raw_cut_dR05_[idx_]; }
+  Int_t antiElectron() const { return hadTaus_.antiElectron_[idx_]; }
+  Int_t antiMuon() const { return hadTaus_.antiMuon_[idx_]; }
+
+ protected:
+  const RecoHadTauCollectionView& hadTaus_;
+  int idx_;
+};
+
+#endif // tthAnalysis_HiggsToTauTau_ParticleAccessor_h
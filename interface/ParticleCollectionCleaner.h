@@ -1,7 +1,9 @@
 #ifndef tthAnalysis_HiggsToTauTau_ParticleCollectionCleaner_h
 #define tthAnalysis_HiggsToTauTau_ParticleCollectionCleaner_h
 
-#include "DataFormats/Math/interface/deltaR.h" // deltaR
+#include "tthAnalysis/HiggsToTauTau/interface/deltaRKernels.h" // comp_deltaR2_min, EtaPhiArrays
+
+#include <vector> // std::vector
 
 template <typename T>
 class ParticleCollectionCleaner
@@ -16,51 +18,61 @@ class ParticleCollectionCleaner
    * @brief Select subset of particles not overlapping with any of the other particles passed as function argument
    * @return Collection of non-overlapping particles
    */
-  template <typename Toverlap>
-  std::vector<const T*> operator()(const std::vector<const T*>& particles, const std::vector<const Toverlap*>& overlaps)
+  template <typename... Args>
+  std::vector<const T*> operator()(const std::vector<const T*>& particles, const Args&... overlaps)
   {
     std::vector<const T*> cleanedParticles;
-    for ( typename std::vector<const T*>::const_iterator particle = particles.begin();
-	  particle != particles.end(); ++particle ) {
-      bool isOverlap = false;
-      for ( typename std::vector<const Toverlap*>::const_iterator overlap = overlaps.begin();
-	    overlap != overlaps.end(); ++overlap ) {
-	double dRoverlap = deltaR((*particle)->eta_, (*particle)->phi_, (*overlap)->eta_, (*overlap)->phi_);
-	if ( dRoverlap < dR_ ) {
-	  isOverlap = true;
-	  break;
-	}
-      }
-      if ( !isOverlap ) {
-	cleanedParticles.push_back(*particle);
-      }
-    }
+    clean(particles, cleanedParticles, overlaps...);
     return cleanedParticles;
   }
-  template <typename Toverlap, typename... Args>
-  std::vector<const T*> operator()(const std::vector<const T*>& particles, const std::vector<const Toverlap*>& overlaps, Args... args)
+
+  /**
+   * @brief Same as above, but fill the collection of non-overlapping particles given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   *
+   *        The eta and phi of the particles and of all overlapping particles are first copied into contiguous arrays,
+   *        so that the minimal dR^2 of each particle to any of the overlapping particles is computed by a single call to the vectorized kernel
+   *        and compared to dR^2, avoiding one sqrt per pair of particles.
+   */
+  template <typename... Args>
+  void clean(const std::vector<const T*>& particles, std::vector<const T*>& cleanedParticles, const Args&... overlaps)
   {
-    std::vector<const T*> cleanedParticles;
-    for ( typename std::vector<const T*>::const_iterator particle = particles.begin();
-	  particle != particles.end(); ++particle ) {
-      bool isOverlap = false;
-      for ( typename std::vector<const Toverlap*>::const_iterator overlap = overlaps.begin();
-	    overlap != overlaps.end(); ++overlap ) {
-	double dRoverlap = deltaR((*particle)->eta_, (*particle)->phi_, (*overlap)->eta_, (*overlap)->phi_);
-	if ( dRoverlap < dR_ ) {
-	  isOverlap = true;
-	  break;
-	}
-      }
-      if ( !isOverlap ) {
-	cleanedParticles.push_back(*particle);
+    particles_etaPhi_.clear();
+    particles_etaPhi_.push_back(particles);
+    overlaps_etaPhi_.clear();
+    fillOverlaps(overlaps...);
+    dR2min_.resize(particles.size());
+    comp_deltaR2_min(particles_etaPhi_.eta(), particles_etaPhi_.phi(), particles_etaPhi_.size(),
+		     overlaps_etaPhi_.eta(), overlaps_etaPhi_.phi(), overlaps_etaPhi_.size(),
+		     dR2min_.data());
+    const float dR2 = dR_*dR_;
+    cleanedParticles.clear();
+    cleanedParticles.reserve(particles.size());
+    for ( size_t idxParticle = 0; idxParticle < particles.size(); ++idxParticle ) {
+      if ( !(dR2min_[idxParticle] < dR2) ) {
+	cleanedParticles.push_back(particles[idxParticle]);
       }
     }
-    return this->operator()(cleanedParticles, args...);
   }
   
  protected: 
+  /**
+   * @brief Append eta and phi of the overlapping particles passed as function argument to the contiguous arrays overlaps_etaPhi_
+   */
+  void fillOverlaps() {}
+  template <typename Toverlap, typename... Args>
+  void fillOverlaps(const std::vector<const Toverlap*>& overlaps, const Args&... args)
+  {
+    overlaps_etaPhi_.push_back(overlaps);
+    fillOverlaps(args...);
+  }
+
   double dR_;
+
+  // CV: kept as data members, so that the memory is reused from one event to the next
+  EtaPhiArrays particles_etaPhi_;
+  EtaPhiArrays overlaps_etaPhi_;
+  std::vector<float> dR2min_;
 };
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoElectron.h"
@@ -0,0 +1,136 @@
+#ifndef tthAnalysis_HiggsToTauTau_ParticleCollectionMultiSelector_h
+#define tthAnalysis_HiggsToTauTau_ParticleCollectionMultiSelector_h
+
+#include "tthAnalysis/HiggsToTauTau/interface/selectionFlags.h" // kSelectionLoose, kSelectionFakeable, kSelectionTight, kSelectionCutBased, kSelectionMVABased
+
+#include <Rtypes.h> // UChar_t
+
+#include <vector> // std::vector<>
+
+/**
+ * @brief Particles passing at least one selection, together with the bitmask of selections passed by each particle.
+ *
+ *        The particles are kept in the order of the collection the selection was applied to.
+ *        Subsets of particles passing given selections are obtained by testing the bitmasks,
+ *        without applying any selector again.
+ */
+template <typename Tobj>
+class ParticleCollectionSelection
+{
+ public:
+  ParticleCollectionSelection() {}
+  ~ParticleCollectionSelection() {}
+
+  void clear() 
+  { 
+    particles_.clear(); 
+    selectionFlags_.clear(); 
+  }
+
+  void push_back(const Tobj* particle, UChar_t selectionFlags)
+  {
+    particles_.push_back(particle);
+    selectionFlags_.push_back(selectionFlags);
+  }
+
+  /**
+   * @brief Return number of particles passing at least one selection
+   */
+  int size() const { return particles_.size(); }
+
+  const Tobj* particle(int idx) const { return particles_[idx]; }
+  UChar_t selectionFlags(int idx) const { return selectionFlags_[idx]; }
+
+  /**
+   * @brief Check if particle with given index passes all selections given as bitmask
+   */
+  bool passes(int idx, UChar_t selectionFlags) const 
+  { 
+    return (selectionFlags_[idx] & selectionFlags) == selectionFlags; 
+  }
+
+  /**
+   * @brief Return number of particles passing all selections given as bitmask
+   */
+  int count(UChar_t selectionFlags) const
+  {
+    int numParticles = 0;
+    for ( int idx = 0; idx < size(); ++idx ) {
+      if ( passes(idx, selectionFlags) ) ++numParticles;
+    }
+    return numParticles;
+  }
+
+  /**
+   * @brief Fill the particles passing all selections given as bitmask into the collection given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   */
+  void filter(UChar_t selectionFlags, std::vector<const Tobj*>& selParticles) const
+  {
+    selParticles.clear();
+    for ( int idx = 0; idx < size(); ++idx ) {
+      if ( passes(idx, selectionFlags) ) selParticles.push_back(particles_[idx]);
+    }
+  }
+
+  /**
+   * @brief Same as above, but return the collection of selected particles
+   */
+  std::vector<const Tobj*> filter(UChar_t selectionFlags) const
+  {
+    std::vector<const Tobj*> selParticles;
+    filter(selectionFlags, selParticles);
+    return selParticles;
+  }
+
+ protected:
+  std::vector<const Tobj*> particles_;
+  std::vector<UChar_t> selectionFlags_;
+};
+
+template <typename Tobj, typename Tsel>
+class ParticleCollectionMultiSelector
+{
+ public:
+  ParticleCollectionMultiSelector() {}
+  ~ParticleCollectionMultiSelector() {}
+
+  /**
+   * @brief Apply all selections of the selector specified as template parameter to each particle in the collection passed as function argument,
+   *        in a single pass over the collection; particles failing all selections are dropped
+   */
+  void operator()(const std::vector<const Tobj*>& particles, ParticleCollectionSelection<Tobj>& selection) const
+  {
+    selection.clear();
+    for ( typename std::vector<const Tobj*>::const_iterator particle = particles.begin();
+	  particle != particles.end(); ++particle ) {
+      UChar_t selectionFlags = selector_(**particle);
+      if ( selectionFlags ) {
+	selection.push_back(*particle, selectionFlags);
+      }
+    }
+  }
+
+ protected: 
+  Tsel selector_;
+};
+
+#include "tthAnalysis/HiggsToTauTau/interface/RecoElectron.h"
+#include "tthAnalysis/HiggsToTauTau/interface/RecoElectronSelectorMultiTier.h"
+
+typedef ParticleCollectionSelection<RecoElectron> RecoElectronCollectionSelection;
+typedef ParticleCollectionMultiSelector<RecoElectron, RecoElectronSelectorMultiTier> RecoElectronCollectionMultiSelector;
+
+#include "tthAnalysis/HiggsToTauTau/interface/RecoMuon.h"
+#include "tthAnalysis/HiggsToTauTau/interface/RecoMuonSelectorMultiTier.h"
+
+typedef ParticleCollectionSelection<RecoMuon> RecoMuonCollectionSelection;
+typedef ParticleCollectionMultiSelector<RecoMuon, RecoMuonSelectorMultiTier> RecoMuonCollectionMultiSelector;
+
+#include "tthAnalysis/HiggsToTauTau/interface/RecoHadTau.h"
+#include "tthAnalysis/HiggsToTauTau/interface/RecoHadTauSelectorMultiTier.h"
+
+typedef ParticleCollectionSelection<RecoHadTau> RecoHadTauCollectionSelection;
+typedef ParticleCollectionMultiSelector<RecoHadTau, RecoHadTauSelectorMultiTier> RecoHadTauCollectionMultiSelector;
+
+#endif // tthAnalysis_HiggsToTauTau_ParticleCollectionMultiSelector_h
@@ -23,6 +23,55 @@ class ParticleCollectionSelector
     }
     return selParticles;
   }
+
+  /**
+   * @brief Same as above, but fill the collection of selected particles given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   */
+  void operator()(const std::vector<const Tobj*>& particles, std::vector<const Tobj*>& selParticles) const
+  {
+    selParticles.clear();
+    for ( typename std::vector<const Tobj*>::const_iterator particle = particles.begin();
+	  particle != particles.end(); ++particle ) {
+      if ( selector_(**particle) ) {
+	selParticles.push_back(*particle);
+      }
+    }
+  }
+
+  /**
+   * @brief Select subset of particles passing selection, by applying selector specified as template parameter to each particle in the view passed as function argument,
+   *        without building the particle objects (the selector needs to support views)
+   * @return Indices of selected particles
+   */
+  template <typename Tview>
+  std::vector<int> operator()(const Tview& particles) const
+  {
+    std::vector<int> selIndices;
+    for ( std::vector<int>::const_iterator idx = particles.indices_.begin();
+	  idx != particles.indices_.end(); ++idx ) {
+      if ( selector_(particles, *idx) ) {
+	selIndices.push_back(*idx);
+      }
+    }
+    return selIndices;
+  }
+
+  /**
+   * @brief Same as above, but fill the indices of selected particles given as function argument,
+   *        so that the memory allocated for them is reused from one event to the next
+   */
+  template <typename Tview>
+  void operator()(const Tview& particles, std::vector<int>& selIndices) const
+  {
+    selIndices.clear();
+    for ( std::vector<int>::const_iterator idx = particles.indices_.begin();
+	  idx != particles.indices_.end(); ++idx ) {
+      if ( selector_(particles, *idx) ) {
+	selIndices.push_back(*idx);
+      }
+    }
+  }
   
  protected: 
   Tsel selector_;
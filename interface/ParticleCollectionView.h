@@ -0,0 +1,132 @@
+#ifndef tthAnalysis_HiggsToTauTau_ParticleCollectionView_h
+#define tthAnalysis_HiggsToTauTau_ParticleCollectionView_h
+
+#include "tthAnalysis/HiggsToTauTau/interface/RecoMuon.h" // DPT_DIV_PT
+
+#include <Rtypes.h> // Int_t, Float_t
+
+#include <vector> // std::vector<>
+
+/**
+ * @brief Read-only view on the branch buffer of one observable (one array element per particle)
+ */
+template <typename T>
+class ColumnSpan
+{
+ public:
+  ColumnSpan()
+    : data_(0)
+    , size_(0)
+  {}
+  ColumnSpan(const T* data, int size)
+    : data_(data)
+    , size_(size)
+  {}
+  ~ColumnSpan() {}
+
+  const T& operator[](int idx) const { return data_[idx]; }
+
+  const T* data() const { return data_; }
+  int size() const { return size_; }
+
+ protected:
+  const T* data_;
+  int size_;
+};
+
+/**
+ * @brief Zero-copy view on the branch buffers of a reader, in structure-of-arrays layout.
+ *
+ *        The view consists of one ColumnSpan per observable and of a list of indices of the particles that are part of the collection.
+ *        Selectors are applied to the list of indices, so that the reader needs to build
+ *        full particle objects only for the few particles that pass the selection.
+ *
+ *        NOTE: the view does not own the branch buffers and is valid only until the next entry is read from the tree.
+ */
+class ParticleCollectionView
+{
+ public:
+  ParticleCollectionView() {}
+  ~ParticleCollectionView() {}
+
+  /**
+   * @brief Return number of particles in collection
+   */
+  int size() const { return indices_.size(); }
+
+  std::vector<int> indices_; ///< indices (in the branch buffers) of particles in collection
+
+  ColumnSpan<Float_t> pt_;
+  ColumnSpan<Float_t> eta_;
+  ColumnSpan<Float_t> phi_;
+  ColumnSpan<Float_t> mass_;
+};
+
+class RecoLeptonCollectionView
+  : public ParticleCollectionView
+{
+ public:
+  ColumnSpan<Int_t> pdgId_;
+  ColumnSpan<Float_t> dxy_;
+  ColumnSpan<Float_t> dz_;
+  ColumnSpan<Float_t> relIso_;
+  ColumnSpan<Float_t> miniIsoCharged_;
+  ColumnSpan<Float_t> miniIsoNeutral_;
+  ColumnSpan<Float_t> sip3d_;
+  ColumnSpan<Float_t> mvaRawTTH_;
+  ColumnSpan<Float_t> jetNDauChargedMVASel_;
+  ColumnSpan<Float_t> jetPtRel_;
+  ColumnSpan<Float_t> jetPtRatio_;
+  ColumnSpan<Float_t> jetBtagCSV_;
+  ColumnSpan<Int_t> tightCharge_;
+  ColumnSpan<Int_t> charge_;
+};
+
+class RecoMuonCollectionView
+  : public RecoLeptonCollectionView
+{
+ public:
+  ColumnSpan<Int_t> passesLooseIdPOG_;
+  ColumnSpan<Int_t> passesMediumIdPOG_;
+#ifdef DPT_DIV_PT
+  ColumnSpan<Float_t> dpt_div_pt_;
+#endif
+  ColumnSpan<Float_t> segmentCompatibility_;
+};
+
+class RecoElectronCollectionView
+  : public RecoLeptonCollectionView
+{
+ public:
+  ColumnSpan<Float_t> mvaRawPOG_;
+  ColumnSpan<Float_t> sigmaEtaEta_;
+  ColumnSpan<Float_t> HoE_;
+  ColumnSpan<Float_t> deltaEta_;
+  ColumnSpan<Float_t> deltaPhi_;
+  ColumnSpan<Float_t> OoEminusOoP_;
+  ColumnSpan<Int_t> nLostHits_;
+  ColumnSpan<Int_t> passesConversionVeto_;
+};
+
+class RecoHadTauCollectionView
+  : public ParticleCollectionView
+{
+ public:
+  ColumnSpan<Int_t> charge_;
+  ColumnSpan<Float_t> dxy_;
+  ColumnSpan<Float_t> dz_;
+  ColumnSpan<Int_t> decayModeFinding_;
+  ColumnSpan<Int_t> decayModeFindingNew_;
+  ColumnSpan<Int_t> id_mva_dR03_;
+  ColumnSpan<Float_t> raw_mva_dR03_;
+  ColumnSpan<Int_t> id_mva_dR05_;
+  ColumnSpan<Float_t> raw_mva_dR05_;
+  ColumnSpan<Int_t> id_cut_dR03_;
+  ColumnSpan<Float_t> raw_cut_dR03_;
+  ColumnSpan<Int_t> id_cut_dR05_;
+  ColumnSpan<Float_t> raw_cut_dR05_;
+  ColumnSpan<Int_t> antiElectron_;
+  ColumnSpan<Int_t> antiMuon_;
+};
+
+#endif // tthAnalysis_HiggsToTauTau_ParticleCollectionView_h
@@ -50,14 +50,14 @@ class RecoElectron
   is_muon() const { return false; }
 
 //--- observables specific to electrons
-  Double_t mvaRawPOG_;         ///< raw output value of EGamma POG electron id MVA 
-  Double_t sigmaEtaEta_;       ///< second shower moment in eta-direction
-  Double_t HoE_;               ///< ratio of energy deposits in hadronic/electromagnetic section of calorimeter
-  Double_t deltaEta_;          ///< difference in eta between impact position of track and electron cluster
-  Double_t deltaPhi_;          ///< difference in phi between impact position of track and electron cluster
-  Double_t OoEminusOoP_;       ///< difference between calorimeter energy and track momentum (1/E - 1/P)
-  Int_t nLostHits_;            ///< number of operational tracker layers between interaction point and innermost hit on track
-  Int_t passesConversionVeto_; ///< Flag indicating if electron passes (1) or fails (0) photon conversion veto
+  Observable_t mvaRawPOG_;     ///< raw output value of EGamma POG electron id MVA 
+  Observable_t sigmaEtaEta_;   ///< second shower moment in eta-direction
+  Observable_t HoE_;           ///< ratio of energy deposits in hadronic/electromagnetic section of calorimeter
+  Observable_t deltaEta_;      ///< difference in eta between impact position of track and electron cluster
+  Observable_t deltaPhi_;      ///< difference in phi between impact position of track and electron cluster
+  Observable_t OoEminusOoP_;   ///< difference between calorimeter energy and track momentum (1/E - 1/P)
+  Int_t nLostHits_ PACKED_FLAG(8);            ///< number of operational tracker layers between interaction point and innermost hit on track
+  Int_t passesConversionVeto_ PACKED_FLAG(2); ///< Flag indicating if electron passes (1) or fails (0) photon conversion veto
 };
 
 #endif // tthAnalysis_HiggsToTauTau_RecoElectron_h
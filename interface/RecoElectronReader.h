@@ -3,9 +3,9 @@
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoElectron.h" // RecoElectron
 #include "tthAnalysis/HiggsToTauTau/interface/RecoLeptonReader.h" // RecoLeptonReader
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource, BranchBuffer
 
 #include <Rtypes.h> // Int_t, Float_t
-#include <TTree.h> // TTree
 
 #include <string>
 #include <vector>
@@ -19,15 +19,38 @@ class RecoElectronReader
   ~RecoElectronReader();
 
   /**
-   * @brief Call tree->SetBranchAddress for all lepton branches specific to RecoElectrons
+   * @brief Get buffers from the EventSource for all lepton branches specific to RecoElectrons
    */
-  void setBranchAddresses(TTree* tree);
+  void setBranchAddresses(EventSource& eventSource);
 
   /**
    * @brief Read branches from tree and use information to fill collection of RecoElectron objects
    * @return Collection of RecoElectron objects
    */
   std::vector<RecoElectron> read() const;
+
+  /**
+   * @brief Return zero-copy view on the branch buffers, containing the indices of all electrons stored in the tree
+   */
+  RecoElectronCollectionView readView() const;
+
+  /**
+   * @brief Same as above, but fill the view given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   */
+  void readView(RecoElectronCollectionView& view) const;
+
+  /**
+   * @brief Use information in branches to build RecoElectron objects for the electrons with given indices only (e.g. the electrons passing selection)
+   * @return Collection of RecoElectron objects
+   */
+  std::vector<RecoElectron> read(const std::vector<int>& indices) const;
+
+  /**
+   * @brief Same as above, but fill the collection given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   */
+  void read(const std::vector<int>& indices, std::vector<RecoElectron>& electrons) const;
   
  protected: 
  /**
@@ -49,19 +72,14 @@ class RecoElectronReader
   std::string branchName_lostHits_;
   std::string branchName_conversionVeto_;
 
-  Float_t* mvaRawPOG_; 
-  Float_t* sigmaEtaEta_;
-  Float_t* HoE_;
-  Float_t* deltaEta_;
-  Float_t* deltaPhi_;
-  Float_t* OoEminusOoP_;
-  Int_t* lostHits_; 
-  Int_t* conversionVeto_;
-
-  // CV: make sure that only one RecoElectronReader instance exists for a given branchName,
-  //     as ROOT cannot handle multiple TTree::SetBranchAddress calls for the same branch.
-  static std::map<std::string, int> numInstances_;
-  static std::map<std::string, RecoElectronReader*> instances_;
+  BranchBuffer<Float_t> mvaRawPOG_; 
+  BranchBuffer<Float_t> sigmaEtaEta_;
+  BranchBuffer<Float_t> HoE_;
+  BranchBuffer<Float_t> deltaEta_;
+  BranchBuffer<Float_t> deltaPhi_;
+  BranchBuffer<Float_t> OoEminusOoP_;
+  BranchBuffer<Int_t> lostHits_; 
+  BranchBuffer<Int_t> conversionVeto_;
 };
 
 #endif // tthAnalysis_HiggsToTauTau_RecoElectronReader_h
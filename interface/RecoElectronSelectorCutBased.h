@@ -21,6 +21,9 @@ class RecoElectronSelectorCutBased
    */
   bool operator()(const RecoElectron& electron) const;
 
+  // CV: RecoElectronSelectorMultiTier takes the cut values from this class
+  friend class RecoElectronSelectorMultiTier;
+
  protected:
   Double_t min_pt_;                   ///< lower cut threshold on pT
   Double_t max_relIso_;               ///< upper cut threshold on relative isolation
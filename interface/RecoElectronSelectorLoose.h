@@ -2,10 +2,14 @@
 #define tthAnalysis_HiggsToTauTau_RecoElectronSelectorLoose_h
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoElectron.h" // RecoElectron
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionView.h" // RecoElectronCollectionView
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleAccessor.h" // RecoElectronAccessor, RecoElectronViewAccessor
 
 #include <Rtypes.h> // Int_t, Double_t
 
 #include <vector> // std::vector<>
+#include <cmath> // std::fabs
+#include <assert.h> // assert
 
 class RecoElectronSelectorLoose
 {
@@ -19,7 +23,43 @@ class RecoElectronSelectorLoose
    */
   bool operator()(const RecoElectron& electron) const;
 
+  /**
+   * @brief Check if electron with given index in the view given as function argument passes "loose" electron selection,
+   *        without building the RecoElectron object
+   * @return True if electron passes selection; false otherwise
+   */
+  bool operator()(const RecoElectronCollectionView& electrons, int idx) const;
+
+  // CV: RecoElectronSelectorMultiTier takes the cut values from this class
+  friend class RecoElectronSelectorMultiTier;
+
  protected: 
+  /**
+   * @brief Apply the cuts to the observables of the electron given by the accessor (RecoElectronAccessor or RecoElectronViewAccessor)
+   */
+  template <typename Taccessor>
+  bool passesCuts(const Taccessor& electron) const
+  {
+    Double_t absEta = electron.absEta();
+    if ( electron.pt() >= min_pt_ &&
+	 absEta <= max_absEta_ &&
+	 std::fabs(electron.dxy()) <= max_dxy_ &&
+	 std::fabs(electron.dz()) <= max_dz_ &&
+	 electron.relIso() <= max_relIso_ &&
+	 electron.sip3d() <= max_sip3d_ &&
+	 (electron.tightCharge() >= 2 || !apply_tightCharge_) && 
+	 (electron.passesConversionVeto() > 0 || !apply_conversionVeto_) &&
+	 electron.nLostHits() <= max_nLostHits_ ) {
+      int idxBin = -1;
+      if      ( absEta <= binning_absEta_[0] ) idxBin = 0;
+      else if ( absEta <= binning_absEta_[1] ) idxBin = 1;
+      else                                     idxBin = 2;
+      assert(idxBin >= 0 && idxBin <= 2);
+      if ( electron.mvaRawPOG() >= min_mvaRawPOG_[idxBin] ) return true;
+    }
+    return false;
+  }
+
   Double_t min_pt_;                   ///< lower cut threshold on pT
   Double_t max_absEta_;               ///< upper cut threshold on absolute value of eta
   Double_t max_dxy_;                  ///< upper cut threshold on d_{xy}, distance in the transverse plane w.r.t PV
@@ -20,6 +20,9 @@ class RecoElectronSelectorMVABased
    */
   bool operator()(const RecoElectron& electron) const;
 
+  // CV: RecoElectronSelectorMultiTier takes the cut values from this class
+  friend class RecoElectronSelectorMultiTier;
+
  protected:
   Double_t min_pt_;                   ///< lower cut threshold on pT
 //--- define cuts that dependent on eta
@@ -0,0 +1,71 @@
+#ifndef tthAnalysis_HiggsToTauTau_RecoElectronSelectorMultiTier_h
+#define tthAnalysis_HiggsToTauTau_RecoElectronSelectorMultiTier_h
+
+#include "tthAnalysis/HiggsToTauTau/interface/RecoElectron.h" // RecoElectron
+#include "tthAnalysis/HiggsToTauTau/interface/selectionFlags.h" // kSelectionLoose, kSelectionFakeable, kSelectionTight, kSelectionCutBased, kSelectionMVABased
+
+#include <Rtypes.h> // Int_t, UChar_t, Double_t
+
+#include <vector> // std::vector<>
+
+/**
+ * @brief Evaluate the "loose", "fakeable", "tight", "cut-based" and "MVA-based" electron selections in a single pass,
+ *        testing the cuts shared between the selections (including the trigger emulation cuts) only once.
+ *
+ *        The cut values are taken from RecoElectronSelectorLoose, RecoElectronSelectorFakeable, RecoElectronSelectorTight,
+ *        RecoElectronSelectorCutBased and RecoElectronSelectorMVABased; the constructor throws an exception
+ *        in case these classes are changed such that a cut tested only once differs between the selections.
+ */
+class RecoElectronSelectorMultiTier
+{
+ public:
+  RecoElectronSelectorMultiTier();
+  ~RecoElectronSelectorMultiTier() {}
+
+  /**
+   * @brief Check which selections the electron given as function argument passes
+   * @return Bitmask of kSelectionLoose, kSelectionFakeable, kSelectionTight, kSelectionCutBased and kSelectionMVABased flags
+   */
+  UChar_t operator()(const RecoElectron& electron) const;
+
+ protected: 
+  typedef std::vector<Double_t> vDouble_t;  
+  vDouble_t binning_absEta_;           ///< eta values separating barrel, endcap 1 and endcap 2 regions
+//--- cuts shared by loose, fakeable and tight selections
+  Double_t max_absEta_;                ///< upper cut threshold on absolute value of eta
+  Double_t max_dxy_;                   ///< upper cut threshold on d_{xy}, distance in the transverse plane w.r.t PV
+  Double_t max_dz_;                    ///< upper cut threshold on d_{z}, distance on the z axis w.r.t PV
+  Double_t max_relIso_;                ///< upper cut threshold on relative isolation
+  Double_t max_sip3d_;                 ///< upper cut threshold on significance of IP
+  vDouble_t min_mvaRawPOG_;            ///< lower cut on MVA-based POG electron id value, in bins of eta
+//--- loose selection
+  Double_t min_pt_loose_;              ///< lower cut threshold on pT
+  Int_t max_nLostHits_loose_;          ///< upper cut threshold on lost hits in the track
+//--- fakeable selection
+  Double_t min_pt_fakeable_;           ///< lower cut threshold on pT
+  vDouble_t binning_mvaTTH_;           ///< lepton MVA threshold
+  vDouble_t min_jetPtRatio_;           ///< lower cut on ratio of lepton pT to pT of nearby jet
+  vDouble_t max_jetBtagCSV_fakeable_;  ///< upper cut threshold on CSV b-tagging discriminator value of nearby jet
+//--- fakeable, tight, cut-based and MVA-based selections
+  Int_t max_nLostHits_;                ///< upper cut threshold on lost hits in the track
+//--- tight, cut-based and MVA-based selections
+  Double_t min_pt_;                    ///< lower cut threshold on pT
+//--- tight and MVA-based selections
+  Double_t min_mvaTTH_;                ///< lower cut threshold on lepton MVA of ttH multilepton analysis
+//--- MVA-based selection
+  Double_t max_jetBtagCSV_;            ///< upper cut threshold on CSV b-tagging discriminator value of nearby jet
+//--- cut-based selection
+  Double_t max_relIso_cutBased_;       ///< upper cut threshold on relative isolation
+  Double_t max_sip3d_cutBased_;        ///< upper cut threshold on significance of IP
+  vDouble_t min_mvaRawPOG_cutBased_;   ///< lower cut on MVA-based POG electron id value, in bins of eta
+//--- cuts emulating the trigger selection (fakeable, tight and MVA-based selections)
+  Double_t min_pt_trig_;               ///< apply cuts to electrons with pT above this threshold only
+  vDouble_t max_sigmaEtaEta_trig_;     ///< upper cut threshold on second shower moment in eta-direction 
+  vDouble_t max_HoE_trig_;             ///< upper cut threshold on ratio of energy deposits in hadronic/electromagnetic section of calorimeter
+  vDouble_t max_deltaEta_trig_;        ///< upper cut threshold on difference in eta between impact position of track and electron cluster
+  vDouble_t max_deltaPhi_trig_;        ///< upper cut threshold on difference in phi between impact position of track and electron cluster
+  Double_t min_OoEminusOoP_trig_;      ///< lower cut threshold on difference between calorimeter energy and track momentum (1/E - 1/P)
+  vDouble_t max_OoEminusOoP_trig_;     ///< upper cut threshold on difference between calorimeter energy and track momentum (1/E - 1/P)
+};
+
+#endif // tthAnalysis_HiggsToTauTau_RecoElectronSelectorMultiTier_h
@@ -20,6 +20,9 @@ class RecoElectronSelectorTight
    */
   bool operator()(const RecoElectron& electron) const;
 
+  // CV: RecoElectronSelectorMultiTier takes the cut values from this class
+  friend class RecoElectronSelectorMultiTier;
+
  protected: 
   Double_t min_pt_;                   ///< lower cut threshold on pT
   Double_t max_absEta_;               ///< upper cut threshold on absolute value of eta
@@ -31,26 +31,21 @@ class RecoHadTau
 	     Int_t antiElectron,
 	     Int_t antiMuon);
 
-  Int_t charge_;
-  Double_t dxy_;              ///< d_{xy}, distance in the transverse plane w.r.t PV
-  Double_t dz_;               ///< d_{z}, distance on the z axis w.r.t PV
-  Int_t decayModeFinding_;    ///< decayModeFinding discriminator
-  Int_t decayModeFindingNew_; ///< new decayModeFinding discriminator
-  Int_t id_mva_dR03_;         ///< MVA-based tau id computed with dR=0.3 isolation cone
-  Double_t raw_mva_dR03_;     ///< raw output of MVA-based tau id computed with dR=0.3 isolation cone
-  Int_t id_mva_dR05_;         ///< MVA-based tau id computed with dR=0.5 isolation cone
-  Double_t raw_mva_dR05_;     ///< raw output of MVA-based tau id computed with dR=0.5 isolation cone
-  Int_t id_cut_dR03_;         ///< cut-based tau id computed with dR=0.3 isolation cone
-  Double_t raw_cut_dR03_;     ///< raw isolation pT-sum of cut-based tau id computed with dR=0.3 isolation cone
-  Int_t id_cut_dR05_;         ///< cut-based tau id computed with dR=0.5 isolation cone
-  Double_t raw_cut_dR05_;     ///< raw isolation pT-sum of cut-based tau id computed with dR=0.5 isolation cone
-  Int_t antiElectron_;        ///< discriminator against electrons
-  Int_t antiMuon_;            ///< discriminator against muons
-
-//--- matching to generator level particles
-  const GenLepton* genLepton_;
-  const GenHadTau* genHadTau_;
-  const GenJet* genJet_;
+  Int_t charge_ PACKED_FLAG(2);
+  Observable_t dxy_;                         ///< d_{xy}, distance in the transverse plane w.r.t PV
+  Observable_t dz_;                          ///< d_{z}, distance on the z axis w.r.t PV
+  Int_t decayModeFinding_ PACKED_FLAG(2);    ///< decayModeFinding discriminator
+  Int_t decayModeFindingNew_ PACKED_FLAG(2); ///< new decayModeFinding discriminator
+  Int_t id_mva_dR03_ PACKED_FLAG(4);         ///< MVA-based tau id computed with dR=0.3 isolation cone
+  Observable_t raw_mva_dR03_;                ///< raw output of MVA-based tau id computed with dR=0.3 isolation cone
+  Int_t id_mva_dR05_ PACKED_FLAG(4);         ///< MVA-based tau id computed with dR=0.5 isolation cone
+  Observable_t raw_mva_dR05_;                ///< raw output of MVA-based tau id computed with dR=0.5 isolation cone
+  Int_t id_cut_dR03_ PACKED_FLAG(4);         ///< cut-based tau id computed with dR=0.3 isolation cone
+  Observable_t raw_cut_dR03_;                ///< raw isolation pT-sum of cut-based tau id computed with dR=0.3 isolation cone
+  Int_t id_cut_dR05_ PACKED_FLAG(4);         ///< cut-based tau id computed with dR=0.5 isolation cone
+  Observable_t raw_cut_dR05_;                ///< raw isolation pT-sum of cut-based tau id computed with dR=0.5 isolation cone
+  Int_t antiElectron_ PACKED_FLAG(4);        ///< discriminator against electrons
+  Int_t antiMuon_ PACKED_FLAG(4);            ///< discriminator against muons
 };
 
 #endif // tthAnalysis_HiggsToTauTau_RecoHadTau_h
@@ -2,9 +2,10 @@
 #define tthAnalysis_HiggsToTauTau_RecoHadTauReader_h
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoHadTau.h" // RecoHadTau
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource, BranchBuffer
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionView.h" // RecoHadTauCollectionView
 
 #include <Rtypes.h> // Int_t, Float_t
-#include <TTree.h> // TTree
 
 #include <string>
 #include <vector>
@@ -18,15 +19,38 @@ class RecoHadTauReader
   ~RecoHadTauReader();
 
   /**
-   * @brief Call tree->SetBranchAddress for all RecoHadTau branches
+   * @brief Get buffers from the EventSource for all RecoHadTau branches
    */
-  void setBranchAddresses(TTree* tree);
+  void setBranchAddresses(EventSource& eventSource);
 
   /**
    * @brief Read branches from tree and use information to fill collection of RecoHadTau objects
    * @return Collection of RecoHadTau objects
    */
   std::vector<RecoHadTau> read() const;
+
+  /**
+   * @brief Return zero-copy view on the branch buffers, containing the indices of all hadronic taus stored in the tree
+   */
+  RecoHadTauCollectionView readView() const;
+
+  /**
+   * @brief Same as above, but fill the view given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   */
+  void readView(RecoHadTauCollectionView& view) const;
+
+  /**
+   * @brief Use information in branches to build RecoHadTau objects for the hadronic taus with given indices only (e.g. the hadronic taus passing selection)
+   * @return Collection of RecoHadTau objects
+   */
+  std::vector<RecoHadTau> read(const std::vector<int>& indices) const;
+
+  /**
+   * @brief Same as above, but fill the collection given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   */
+  void read(const std::vector<int>& indices, std::vector<RecoHadTau>& hadTaus) const;
   
  protected: 
  /**
@@ -34,7 +58,12 @@ class RecoHadTauReader
    */
   void setBranchNames();
 
-  const int max_nHadTaus_;
+  /**
+   * @brief Return buffer holding raw isolation pT-sum of cut-based tau id computed with dR=0.3 isolation cone
+   *        (filled with zeros, as long as the branch does not exist in the Ntuple)
+   */
+  const Float_t* get_rawCombIso_dR03() const;
+
   std::string branchName_num_;
   std::string branchName_obj_;
 
@@ -58,31 +87,27 @@ class RecoHadTauReader
   std::string branchName_idAgainstElec_;
   std::string branchName_idAgainstMu_;
   
-  Int_t nHadTaus_;
-  Float_t* hadTau_pt_;
-  Float_t* hadTau_eta_;
-  Float_t* hadTau_phi_;
-  Float_t* hadTau_mass_;
-  Int_t* hadTau_charge_;
-  Float_t* hadTau_dxy_;
-  Float_t* hadTau_dz_;
-  Int_t* hadTau_idDecayMode_;
-  Int_t* hadTau_idDecayModeNewDMs_;
-  Int_t* hadTau_idMVA_dR03_;
-  Float_t* hadTau_rawMVA_dR03_;
-  Int_t* hadTau_idMVA_dR05_;
-  Float_t* hadTau_rawMVA_dR05_;
-  Int_t* hadTau_idCombIso_dR03_;
-  Float_t* hadTau_rawCombIso_dR03_;
-  Int_t* hadTau_idCombIso_dR05_;
-  Float_t* hadTau_rawCombIso_dR05_;
-  Int_t* hadTau_idAgainstElec_;
-  Int_t* hadTau_idAgainstMu_;
-
-  // CV: make sure that only one RecoHadronicTauReader instance exists for a given branchName,
-  //     as ROOT cannot handle multiple TTree::SetBranchAddress calls for the same branch.
-  static std::map<std::string, int> numInstances_;
-  static std::map<std::string, RecoHadTauReader*> instances_;
+  Int_t* nHadTaus_;
+  BranchBuffer<Float_t> hadTau_pt_;
+  BranchBuffer<Float_t> hadTau_eta_;
+  BranchBuffer<Float_t> hadTau_phi_;
+  BranchBuffer<Float_t> hadTau_mass_;
+  BranchBuffer<Int_t> hadTau_charge_;
+  BranchBuffer<Float_t> hadTau_dxy_;
+  BranchBuffer<Float_t> hadTau_dz_;
+  BranchBuffer<Int_t> hadTau_idDecayMode_;
+  BranchBuffer<Int_t> hadTau_idDecayModeNewDMs_;
+  BranchBuffer<Int_t> hadTau_idMVA_dR03_;
+  BranchBuffer<Float_t> hadTau_rawMVA_dR03_;
+  BranchBuffer<Int_t> hadTau_idMVA_dR05_;
+  BranchBuffer<Float_t> hadTau_rawMVA_dR05_;
+  BranchBuffer<Int_t> hadTau_idCombIso_dR03_;
+  BranchBuffer<Float_t> hadTau_rawCombIso_dR03_;
+  mutable std::vector<Float_t> hadTau_rawCombIso_dR03_default_; // CV: branch does not exist in VHbb Ntuples yet, set to zero
+  BranchBuffer<Int_t> hadTau_idCombIso_dR05_;
+  BranchBuffer<Float_t> hadTau_rawCombIso_dR05_;
+  BranchBuffer<Int_t> hadTau_idAgainstElec_;
+  BranchBuffer<Int_t> hadTau_idAgainstMu_;
 };
 
 #endif // tthAnalysis_HiggsToTauTau_RecoHadTauReader_h
@@ -21,6 +21,9 @@ class RecoHadTauSelectorFakeable
    */
   bool operator()(const RecoHadTau& hadTau) const;
 
+  // CV: RecoHadTauSelectorMultiTier takes the cut values from this class
+  friend class RecoHadTauSelectorMultiTier;
+
  protected: 
   Double_t min_pt_;            ///< lower cut threshold on pT
   Double_t max_absEta_;        ///< upper cut threshold on absolute value of eta
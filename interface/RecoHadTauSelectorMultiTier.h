@@ -0,0 +1,51 @@
+#ifndef tthAnalysis_HiggsToTauTau_RecoHadTauSelectorMultiTier_h
+#define tthAnalysis_HiggsToTauTau_RecoHadTauSelectorMultiTier_h
+
+#include "tthAnalysis/HiggsToTauTau/interface/RecoHadTau.h" // RecoHadTau
+#include "tthAnalysis/HiggsToTauTau/interface/selectionFlags.h" // kSelectionLoose, kSelectionFakeable, kSelectionTight
+
+#include <Rtypes.h> // Int_t, UChar_t, Double_t
+
+/**
+ * @brief Evaluate the "loose", "fakeable" and "tight" hadronic tau selections in a single pass,
+ *        testing the cuts shared between the selections only once.
+ *
+ *        The cut values are taken from RecoHadTauSelectorLoose, RecoHadTauSelectorFakeable and RecoHadTauSelectorTight;
+ *        the constructor throws an exception in case these classes are changed such that a cut tested only once differs between the selections.
+ */
+class RecoHadTauSelectorMultiTier
+{
+ public:
+  RecoHadTauSelectorMultiTier();
+  ~RecoHadTauSelectorMultiTier() {}
+
+  /**
+   * @brief Check which selections the hadronic tau given as function argument passes
+   * @return Bitmask of kSelectionLoose, kSelectionFakeable and kSelectionTight flags
+   */
+  UChar_t operator()(const RecoHadTau& hadTau) const;
+
+ protected: 
+//--- cuts shared by loose, fakeable and tight selections
+  Double_t min_pt_;                ///< lower cut threshold on pT
+  Double_t max_absEta_;            ///< upper cut threshold on absolute value of eta
+  Double_t max_dz_;                ///< upper cut threshold on d_{z}, distance on the z axis w.r.t PV
+  Int_t min_decayModeFinding_;     ///< lower cut threshold on decayModeFinding discriminator
+  Int_t min_id_mva_dR03_;          ///< lower cut threshold on MVA-based tau id computed with dR=0.3 isolation cone
+  Double_t min_raw_mva_dR03_;      ///< lower cut threshold on raw output of MVA-based tau id computed with dR=0.3 isolation cone
+  Int_t min_id_mva_dR05_;          ///< lower cut threshold on MVA-based tau id computed with dR=0.5 isolation cone
+  Double_t min_raw_mva_dR05_;      ///< lower cut threshold on raw output of MVA-based tau id computed with dR=0.5 isolation cone
+  Int_t min_id_cut_dR03_;          ///< lower cut threshold on cut-based tau id computed with dR=0.3 isolation cone
+  Double_t max_raw_cut_dR03_;      ///< upper cut threshold on raw output of cut-based tau id computed with dR=0.3 isolation cone
+  Int_t min_antiElectron_;         ///< lower cut threshold on discriminator against electrons
+  Int_t min_antiMuon_;             ///< lower cut threshold on discriminator against muons
+//--- isolation cuts, applied separately for loose, fakeable and tight selections
+  Int_t min_id_cut_dR05_loose_;       ///< lower cut threshold on cut-based tau id computed with dR=0.5 isolation cone
+  Double_t max_raw_cut_dR05_loose_;   ///< upper cut threshold on raw output of cut-based tau id computed with dR=0.5 isolation cone
+  Int_t min_id_cut_dR05_fakeable_;
+  Double_t max_raw_cut_dR05_fakeable_;
+  Int_t min_id_cut_dR05_tight_;
+  Double_t max_raw_cut_dR05_tight_;
+};
+
+#endif // tthAnalysis_HiggsToTauTau_RecoHadTauSelectorMultiTier_h
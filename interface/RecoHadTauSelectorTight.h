@@ -2,11 +2,14 @@
 #define tthAnalysis_HiggsToTauTau_RecoHadTauSelectorTight_h
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoHadTau.h" // RecoHadTau
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionView.h" // RecoHadTauCollectionView
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleAccessor.h" // RecoHadTauAccessor, RecoHadTauViewAccessor
 
 #include <Rtypes.h> // Int_t, Double_t
 
 #include <string>
 #include <map>
+#include <cmath> // std::fabs
 
 class RecoHadTauSelectorTight
 {
@@ -20,7 +23,42 @@ class RecoHadTauSelectorTight
    */
   bool operator()(const RecoHadTau& hadTau) const;
 
+  /**
+   * @brief Check if hadronic tau with given index in the view given as function argument passes "tight" tau selection,
+   *        without building the RecoHadTau object
+   * @return True if hadronic tau passes selection; false otherwise
+   */
+  bool operator()(const RecoHadTauCollectionView& hadTaus, int idx) const;
+
+  // CV: RecoHadTauSelectorMultiTier takes the cut values from this class
+  friend class RecoHadTauSelectorMultiTier;
+
  protected: 
+  /**
+   * @brief Apply the cuts to the observables of the hadronic tau given by the accessor (RecoHadTauAccessor or RecoHadTauViewAccessor)
+   */
+  template <typename Taccessor>
+  bool passesCuts(const Taccessor& hadTau) const
+  {
+    if ( hadTau.pt() >= min_pt_ &&
+	 hadTau.absEta() <= max_absEta_ &&
+	 std::fabs(hadTau.dz()) <= max_dz_ &&
+	 hadTau.decayModeFinding() >= min_decayModeFinding_ &&
+	 hadTau.id_mva_dR03() >= min_id_mva_dR03_ &&
+	 hadTau.raw_mva_dR03() >= min_raw_mva_dR03_ &&
+	 hadTau.id_mva_dR05() >= min_id_mva_dR05_ &&
+	 hadTau.raw_mva_dR05() >= min_raw_mva_dR05_ &&
+	 hadTau.id_cut_dR03() >= min_id_cut_dR03_ &&
+	 hadTau.raw_cut_dR03() <= max_raw_cut_dR03_ &&
+	 hadTau.id_cut_dR05() >= min_id_cut_dR05_ &&
+	 hadTau.raw_cut_dR05() <= max_raw_cut_dR05_ &&
+	 hadTau.antiElectron() >= min_antiElectron_ &&
+	 hadTau.antiMuon() >= min_antiMuon_ ) {
+      return true;
+    } 
+    return false;
+  }
+
   Double_t min_pt_;            ///< lower cut threshold on pT
   Double_t max_absEta_;        ///< upper cut threshold on absolute value of eta
   Double_t max_dz_;            ///< upper cut threshold on d_{z}, distance on the z axis w.r.t PV
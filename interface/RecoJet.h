@@ -22,17 +22,12 @@ public:
 	  Double_t BtagWeight,
           Int_t idx);
 
-  Double_t corr_;         ///< nominal jet energy correction (L1FastL2L3 for MC, L1FastL2L3Residual for data)
-  Double_t corr_JECUp_;   ///< +1 sigma (upward shifted) jet energy correction
-  Double_t corr_JECDown_; ///< -1 sigma (downward shifted) jet energy correction
-  Double_t BtagCSV_;      ///< CSV b-tagging discriminator value
-  Double_t BtagWeight_;   ///< weight for data/MC correction of b-tagging efficiency and mistag rate
-  Int_t idx_;             ///< index of jet in the ntuple
-
-//--- matching to generator level particles
-  const GenLepton* genLepton_;
-  const GenHadTau* genHadTau_;
-  const GenJet* genJet_;
+  Observable_t corr_;         ///< nominal jet energy correction (L1FastL2L3 for MC, L1FastL2L3Residual for data)
+  Observable_t corr_JECUp_;   ///< +1 sigma (upward shifted) jet energy correction
+  Observable_t corr_JECDown_; ///< -1 sigma (downward shifted) jet energy correction
+  Observable_t BtagCSV_;      ///< CSV b-tagging discriminator value
+  Observable_t BtagWeight_;   ///< weight for data/MC correction of b-tagging efficiency and mistag rate
+  Int_t idx_;                 ///< index of jet in the ntuple
 };
 
 #endif // tthAnalysis_HiggsToTauTau_RecoJet_h
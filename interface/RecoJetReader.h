@@ -2,9 +2,9 @@
 #define tthAnalysis_HiggsToTauTau_RecoJetReader_h
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoJet.h" // RecoJet
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource, BranchBuffer
 
 #include <Rtypes.h> // Int_t, Float_t
-#include <TTree.h> // TTree
 
 #include <string>
 #include <vector>
@@ -23,15 +23,41 @@ class RecoJetReader
   void setBranchName_BtagWeight(const std::string& branchName_BtagWeight) { branchName_BtagWeight_ = branchName_BtagWeight; }
 
   /**
-   * @brief Call tree->SetBranchAddress for all RecoJet branches
+   * @brief Read additional b-tagging weight branches (for systematic shifts), 
+   *        so that all of them can be evaluated in a single pass over the tree
    */
-  void setBranchAddresses(TTree* tree);
+  void setBranchNames_BtagWeight_shifts(const std::vector<std::string>& branchNames_BtagWeight_shifts) { branchNames_BtagWeight_shifts_ = branchNames_BtagWeight_shifts; }
+
+  /**
+   * @brief Get buffers from the EventSource for all RecoJet branches
+   */
+  void setBranchAddresses(EventSource& eventSource);
 
   /**
    * @brief Read branches from tree and use information to fill collection of RecoJet objects
    * @return Collection of RecoJet objects
    */
   std::vector<RecoJet> read() const;
+
+  /**
+   * @brief Read branches from tree and use information to fill collection of RecoJet objects, 
+   *        for given shift of jet pT and given b-tagging weight branch
+   * @return Collection of RecoJet objects
+   */
+  std::vector<RecoJet> read(int jetPt_option, const std::string& branchName_BtagWeight) const;
+
+  /**
+   * @brief Same as above, but fill the collection given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   */
+  void read(int jetPt_option, const std::string& branchName_BtagWeight, std::vector<RecoJet>& jets) const;
+
+  /**
+   * @brief Return b-tagging weights stored in given branch for the jets of the current event, indexed by RecoJet::idx_
+   *       (used to compute the event weight for systematic shifts that change the b-tagging weights only,
+   *        without reading the collection of jets again)
+   */
+  const Float_t* getBtagWeights(const std::string& branchName_BtagWeight) const;
   
  protected: 
  /**
@@ -39,7 +65,6 @@ class RecoJetReader
    */
   void setBranchNames();
 
-  const int max_nJets_;
   std::string branchName_num_;
   std::string branchName_obj_;
 
@@ -52,24 +77,22 @@ class RecoJetReader
   std::string branchName_corr_JECDown_;
   std::string branchName_BtagCSV_;
   std::string branchName_BtagWeight_;
+  std::vector<std::string> branchNames_BtagWeight_shifts_;
 
   int jetPt_option_;
 
-  Int_t nJets_;
-  Float_t* jet_pt_;
-  Float_t* jet_eta_;
-  Float_t* jet_phi_;
-  Float_t* jet_mass_;
-  Float_t* jet_corr_;
-  Float_t* jet_corr_JECUp_;
-  Float_t* jet_corr_JECDown_;
-  Float_t* jet_BtagCSV_;
-  Float_t* jet_BtagWeight_;
-
-  // CV: make sure that only one RecoJetReader instance exists for a given branchName,
-  //     as ROOT cannot handle multiple TTree::SetBranchAddress calls for the same branch.
-  static std::map<std::string, int> numInstances_;
-  static std::map<std::string, RecoJetReader*> instances_;
+  Int_t* nJets_;
+  BranchBuffer<Float_t> jet_pt_;
+  BranchBuffer<Float_t> jet_eta_;
+  BranchBuffer<Float_t> jet_phi_;
+  BranchBuffer<Float_t> jet_mass_;
+  BranchBuffer<Float_t> jet_corr_;
+  BranchBuffer<Float_t> jet_corr_JECUp_;
+  BranchBuffer<Float_t> jet_corr_JECDown_;
+  BranchBuffer<Float_t> jet_BtagCSV_;
+  std::map<std::string, BranchBuffer<Float_t> > jet_BtagWeights_; // key = branchName_BtagWeight
+  mutable std::vector<Float_t> jet_BtagWeight_default_; // used in case b-tagging weight branch name is empty, set to one
+
 };
 
 #endif // tthAnalysis_HiggsToTauTau_RecoJetReader_h
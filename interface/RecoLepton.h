@@ -45,24 +45,19 @@ public:
   is_muon() const { return false; }
 
 //--- common observables for electrons and muons
-  Double_t dxy_;                        ///< d_{xy}, distance in the transverse plane w.r.t PV
-  Double_t dz_;                         ///< d_{z}, distance on the z axis w.r.t PV
-  Double_t relIso_;                     ///< relative isolation
-  Double_t miniIsoCharged_;             ///< absolute charged isolation
-  Double_t miniIsoNeutral_;             ///< absolute neutral isolation (PU corrected)
-  Double_t sip3d_;                      ///< significance of IP
-  Double_t mvaRawTTH_;                  ///< raw output of lepton MVA of ttH multilepton analysis
-  Double_t jetNDauChargedMVASel_;       ///< number of charged constituents in the closest jet
-  Double_t jetPtRel_;                   ///< relative pT of the lepton wrt the closest jet
-  Double_t jetPtRatio_;                 ///< ratio of lepton pT to pT of nearby jet
-  Double_t jetBtagCSV_;                 ///< CSV b-tagging discriminator value of nearby jet
-  Int_t tightCharge_;                   ///< Flag indicating if lepton passes (>= 2) or fails (< 2) tight charge requirement
-  Int_t charge_;                        ///< lepton charge
-
-//--- matching to generator level particles
-  const GenLepton* genLepton_;
-  const GenHadTau* genHadTau_;
-  const GenJet* genJet_;
+  Observable_t dxy_;                    ///< d_{xy}, distance in the transverse plane w.r.t PV
+  Observable_t dz_;                     ///< d_{z}, distance on the z axis w.r.t PV
+  Observable_t relIso_;                 ///< relative isolation
+  Observable_t miniIsoCharged_;         ///< absolute charged isolation
+  Observable_t miniIsoNeutral_;         ///< absolute neutral isolation (PU corrected)
+  Observable_t sip3d_;                  ///< significance of IP
+  Observable_t mvaRawTTH_;              ///< raw output of lepton MVA of ttH multilepton analysis
+  Observable_t jetNDauChargedMVASel_;   ///< number of charged constituents in the closest jet
+  Observable_t jetPtRel_;               ///< relative pT of the lepton wrt the closest jet
+  Observable_t jetPtRatio_;             ///< ratio of lepton pT to pT of nearby jet
+  Observable_t jetBtagCSV_;             ///< CSV b-tagging discriminator value of nearby jet
+  Int_t tightCharge_ PACKED_FLAG(3);    ///< Flag indicating if lepton passes (>= 2) or fails (< 2) tight charge requirement
+  Int_t charge_ PACKED_FLAG(2);         ///< lepton charge
 };
 
 #endif // tthAnalysis_HiggsToTauTau_RecoLepton_h
@@ -2,9 +2,10 @@
 #define tthAnalysis_HiggsToTauTau_RecoLeptonReader_h
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoLepton.h" // RecoLepton
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource, BranchBuffer
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionView.h" // RecoLeptonCollectionView
 
 #include <Rtypes.h> // Int_t, Float_t
-#include <TTree.h> // TTree
 
 #include <string>
 #include <vector>
@@ -18,9 +19,9 @@ class RecoLeptonReader
   ~RecoLeptonReader();
 
   /**
-   * @brief Call tree->SetBranchAddress for all lepton branches common to RecoElectrons and RecoMuons
+   * @brief Get buffers from the EventSource for all lepton branches common to RecoElectrons and RecoMuons
    */
-  void setBranchAddresses(TTree* tree);
+  void setBranchAddresses(EventSource& eventSource);
 
   friend class RecoElectronReader;
   friend class RecoMuonReader;
@@ -31,7 +32,12 @@ class RecoLeptonReader
    */
   void setBranchNames();
 
-  const int max_nLeptons_;
+  /**
+   * @brief Set column spans common to RecoElectrons and RecoMuons to the branch buffers
+   *        and fill list of indices with all leptons of given (absolute) PDG id
+   */
+  void fillView(RecoLeptonCollectionView& view, int absPdgId) const;
+
   std::string branchName_num_;
   std::string branchName_obj_;
 
@@ -54,30 +60,25 @@ class RecoLeptonReader
   std::string branchName_tightCharge_;
   std::string branchName_charge_;
 
-  Int_t nLeptons_;
-  Float_t* pt_;
-  Float_t* eta_;
-  Float_t* phi_;
-  Float_t* mass_;
-  Int_t* pdgId_;
-  Float_t* dxy_;
-  Float_t* dz_;
-  Float_t* relIso_;
-  Float_t* miniIsoCharged_;
-  Float_t* miniIsoNeutral_;
-  Float_t* sip3d_;
-  Float_t* mvaRawTTH_;
-  Float_t* jetNDauChargedMVASel_;
-  Float_t* jetPtRel_;
-  Float_t* jetPtRatio_;
-  Float_t* jetBtagCSV_;
-  Int_t* tightCharge_;
-  Int_t* charge_;
-
-  // CV: make sure that only one RecoLeptonReader instance exists for a given branchName,
-  //     as ROOT cannot handle multiple TTree::SetBranchAddress calls for the same branch.
-  static std::map<std::string, int> numInstances_;
-  static std::map<std::string, RecoLeptonReader*> instances_;
+  Int_t* nLeptons_;
+  BranchBuffer<Float_t> pt_;
+  BranchBuffer<Float_t> eta_;
+  BranchBuffer<Float_t> phi_;
+  BranchBuffer<Float_t> mass_;
+  BranchBuffer<Int_t> pdgId_;
+  BranchBuffer<Float_t> dxy_;
+  BranchBuffer<Float_t> dz_;
+  BranchBuffer<Float_t> relIso_;
+  BranchBuffer<Float_t> miniIsoCharged_;
+  BranchBuffer<Float_t> miniIsoNeutral_;
+  BranchBuffer<Float_t> sip3d_;
+  BranchBuffer<Float_t> mvaRawTTH_;
+  BranchBuffer<Float_t> jetNDauChargedMVASel_;
+  BranchBuffer<Float_t> jetPtRel_;
+  BranchBuffer<Float_t> jetPtRatio_;
+  BranchBuffer<Float_t> jetBtagCSV_;
+  BranchBuffer<Int_t> tightCharge_;
+  BranchBuffer<Int_t> charge_;
 };
 
 #endif // tthAnalysis_HiggsToTauTau_RecoLeptonReader_h
@@ -55,12 +55,12 @@ public:
   is_muon() const { return true; }
 
 //--- observables specific to muons
-  Int_t passesLooseIdPOG_;       ///< flag indicating if muon passes (1) or fails (0) loose PFMuon id
-  Int_t passesMediumIdPOG_;      ///< flag indicating if muon passes (1) or fails (0) medium PFMuon id
+  Int_t passesLooseIdPOG_ PACKED_FLAG(2);  ///< flag indicating if muon passes (1) or fails (0) loose PFMuon id
+  Int_t passesMediumIdPOG_ PACKED_FLAG(2); ///< flag indicating if muon passes (1) or fails (0) medium PFMuon id
 #ifdef DPT_DIV_PT
-  Float_t dpt_div_pt_;           ///< relative pT error
+  Float_t dpt_div_pt_;                     ///< relative pT error
 #endif
-  Float_t segmentCompatibility_; ///< muon segment compatibility
+  Float_t segmentCompatibility_;           ///< muon segment compatibility
 };
 
 #endif // tthAnalysis_HiggsToTauTau_RecoMuon_h
@@ -3,9 +3,9 @@
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoMuon.h" // RecoMuon
 #include "tthAnalysis/HiggsToTauTau/interface/RecoLeptonReader.h" // RecoLeptonReader
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource, BranchBuffer
 
 #include <Rtypes.h> // Int_t
-#include <TTree.h> // TTree
 
 #include <string>
 #include <vector>
@@ -19,15 +19,38 @@ class RecoMuonReader
   ~RecoMuonReader();
 
   /**
-   * @brief Call tree->SetBranchAddress for all lepton branches specific to RecoMuons
+   * @brief Get buffers from the EventSource for all lepton branches specific to RecoMuons
    */
-  void setBranchAddresses(TTree* tree);
+  void setBranchAddresses(EventSource& eventSource);
 
   /**
    * @brief Read branches from tree and use information to fill collection of RecoMuon objects
    * @return Collection of RecoMuon objects
    */
   std::vector<RecoMuon> read() const;
+
+  /**
+   * @brief Return zero-copy view on the branch buffers, containing the indices of all muons stored in the tree
+   */
+  RecoMuonCollectionView readView() const;
+
+  /**
+   * @brief Same as above, but fill the view given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   */
+  void readView(RecoMuonCollectionView& view) const;
+
+  /**
+   * @brief Use information in branches to build RecoMuon objects for the muons with given indices only (e.g. the muons passing selection)
+   * @return Collection of RecoMuon objects
+   */
+  std::vector<RecoMuon> read(const std::vector<int>& indices) const;
+
+  /**
+   * @brief Same as above, but fill the collection given as function argument,
+   *        so that the memory allocated for it is reused from one event to the next
+   */
+  void read(const std::vector<int>& indices, std::vector<RecoMuon>& muons) const;
   
  protected: 
  /**
@@ -47,17 +70,12 @@ class RecoMuonReader
 #endif
   std::string branchName_segmentCompatibility_;
 
-  Int_t* looseIdPOG_;
-  Int_t* mediumIdPOG_;
+  BranchBuffer<Int_t> looseIdPOG_;
+  BranchBuffer<Int_t> mediumIdPOG_;
 #ifdef DPT_DIV_PT
-  Float_t* dpt_div_pt_;
+  BranchBuffer<Float_t> dpt_div_pt_;
 #endif
-  Float_t* segmentCompatibility_;
-
-  // CV: make sure that only one RecoMuonReader instance exists for a given branchName,
-  //     as ROOT cannot handle multiple TTree::SetBranchAddress calls for the same branch.
-  static std::map<std::string, int> numInstances_;
-  static std::map<std::string, RecoMuonReader*> instances_;
+  BranchBuffer<Float_t> segmentCompatibility_;
 };
 
 #endif // tthAnalysis_HiggsToTauTau_RecoMuonReader_h
@@ -19,6 +19,9 @@ class RecoMuonSelectorCutBased
    */
   bool operator()(const RecoMuon& muon) const;
 
+  // CV: RecoMuonSelectorMultiTier takes the cut values from this class
+  friend class RecoMuonSelectorMultiTier;
+
  protected:
   Double_t min_pt_;         ///< lower cut threshold on pT
   Double_t max_relIso_;     ///< upper cut threshold on relative isolation
@@ -2,11 +2,14 @@
 #define tthAnalysis_HiggsToTauTau_RecoMuonSelectorLoose_h
 
 #include "tthAnalysis/HiggsToTauTau/interface/RecoMuon.h" // RecoMuon
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionView.h" // RecoMuonCollectionView
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleAccessor.h" // RecoMuonAccessor, RecoMuonViewAccessor
 
 #include <Rtypes.h> // Int_t, Double_t
 
 #include <string>
 #include <map>
+#include <cmath> // std::fabs
 
 class RecoMuonSelectorLoose
 {
@@ -20,7 +23,36 @@ class RecoMuonSelectorLoose
    */
   bool operator()(const RecoMuon& muon) const;
 
+  /**
+   * @brief Check if muon with given index in the view given as function argument passes "loose" muon selection,
+   *        without building the RecoMuon object
+   * @return True if muon passes selection; false otherwise
+   */
+  bool operator()(const RecoMuonCollectionView& muons, int idx) const;
+
+  // CV: RecoMuonSelectorMultiTier takes the cut values from this class
+  friend class RecoMuonSelectorMultiTier;
+
  protected: 
+  /**
+   * @brief Apply the cuts to the observables of the muon given by the accessor (RecoMuonAccessor or RecoMuonViewAccessor)
+   */
+  template <typename Taccessor>
+  bool passesCuts(const Taccessor& muon) const
+  {
+    if ( muon.pt() >= min_pt_ &&
+	 muon.absEta() <= max_absEta_ &&
+	 std::fabs(muon.dxy()) <= max_dxy_ &&
+	 std::fabs(muon.dz()) <= max_dz_ &&
+	 muon.relIso() <= max_relIso_ &&
+	 muon.sip3d() <= max_sip3d_ &&
+	 (muon.passesLooseIdPOG() || !apply_looseIdPOG_) && 
+	 (muon.passesMediumIdPOG() || !apply_mediumIdPOG_) ) {
+      return true;
+    }
+    return false;
+  }
+
   Double_t min_pt_;        ///< lower cut threshold on pT
   Double_t max_absEta_;    ///< upper cut threshold on absolute value of eta
   Double_t max_dxy_;       ///< upper cut threshold on d_{xy}, distance in the transverse plane w.r.t PV
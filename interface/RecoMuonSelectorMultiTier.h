@@ -0,0 +1,55 @@
+#ifndef tthAnalysis_HiggsToTauTau_RecoMuonSelectorMultiTier_h
+#define tthAnalysis_HiggsToTauTau_RecoMuonSelectorMultiTier_h
+
+#include "tthAnalysis/HiggsToTauTau/interface/RecoMuon.h" // RecoMuon
+#include "tthAnalysis/HiggsToTauTau/interface/selectionFlags.h" // kSelectionLoose, kSelectionFakeable, kSelectionTight, kSelectionCutBased, kSelectionMVABased
+
+#include <Rtypes.h> // UChar_t, Double_t
+
+#include <vector> // std::vector<>
+
+/**
+ * @brief Evaluate the "loose", "fakeable", "tight", "cut-based" and "MVA-based" muon selections in a single pass,
+ *        testing the cuts shared between the selections only once.
+ *
+ *        The cut values are taken from RecoMuonSelectorLoose, RecoMuonSelectorFakeable, RecoMuonSelectorTight,
+ *        RecoMuonSelectorCutBased and RecoMuonSelectorMVABased; the constructor throws an exception
+ *        in case these classes are changed such that a cut tested only once differs between the selections.
+ */
+class RecoMuonSelectorMultiTier
+{
+ public:
+  RecoMuonSelectorMultiTier();
+  ~RecoMuonSelectorMultiTier() {}
+
+  /**
+   * @brief Check which selections the muon given as function argument passes
+   * @return Bitmask of kSelectionLoose, kSelectionFakeable, kSelectionTight, kSelectionCutBased and kSelectionMVABased flags
+   */
+  UChar_t operator()(const RecoMuon& muon) const;
+
+ protected: 
+//--- cuts shared by loose, fakeable and tight selections
+  Double_t max_absEta_;              ///< upper cut threshold on absolute value of eta
+  Double_t max_dxy_;                 ///< upper cut threshold on d_{xy}, distance in the transverse plane w.r.t PV
+  Double_t max_dz_;                  ///< upper cut threshold on d_{z}, distance on the z axis w.r.t PV
+  Double_t max_relIso_;              ///< upper cut threshold on relative isolation
+  Double_t max_sip3d_;               ///< upper cut threshold on significance of IP
+//--- loose selection
+  Double_t min_pt_loose_;            ///< lower cut threshold on pT
+//--- fakeable, tight, cut-based and MVA-based selections
+  Double_t min_pt_;                  ///< lower cut threshold on pT
+//--- fakeable selection
+  typedef std::vector<Double_t> vDouble_t;  
+  vDouble_t binning_mvaTTH_;         ///< lepton MVA threshold
+  vDouble_t min_jetPtRatio_;         ///< lower cut on ratio of lepton pT to pT of nearby jet
+  vDouble_t max_jetBtagCSV_fakeable_;///< upper cut threshold on CSV b-tagging discriminator value of nearby jet
+//--- tight and MVA-based selections
+  Double_t max_jetBtagCSV_;          ///< upper cut threshold on CSV b-tagging discriminator value of nearby jet
+  Double_t min_mvaTTH_;              ///< lower cut threshold on lepton MVA of ttH multilepton analysis
+//--- cut-based selection
+  Double_t max_relIso_cutBased_;     ///< upper cut threshold on relative isolation
+  Double_t max_sip3d_cutBased_;      ///< upper cut threshold on significance of IP
+};
+
+#endif // tthAnalysis_HiggsToTauTau_RecoMuonSelectorMultiTier_h
@@ -20,6 +20,9 @@ class RecoMuonSelectorTight
    */
   bool operator()(const RecoMuon& muon) const;
 
+  // CV: RecoMuonSelectorMultiTier takes the cut values from this class
+  friend class RecoMuonSelectorMultiTier;
+
  protected: 
   Double_t min_pt_;         ///< lower cut threshold on pT
   Double_t max_absEta_;     ///< upper cut threshold on absolute value of eta
@@ -0,0 +1,57 @@
+#ifndef tthAnalysis_HiggsToTauTau_SkimWriter_h
+#define tthAnalysis_HiggsToTauTau_SkimWriter_h
+
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource
+
+#include "FWCore/ParameterSet/interface/ParameterSet.h" // edm::ParameterSet
+
+#include <Rtypes.h> // Int_t, Long64_t
+#include <TFile.h> // TFile
+#include <TTree.h> // TTree
+
+#include <string> // std::string
+
+/**
+ * @brief Write selected events to a slimmed copy of the input tree ("skim").
+ *
+ *        Only the branches registered in the BranchManifest of the EventSource are copied,
+ *        so the skim can be used as input for re-running the same analysis with different selection criteria.
+ *        The output tree is written with large baskets and a configurable compression algorithm (LZ4 by default).
+ *
+ *        NOTE: the SkimWriter needs to be created after BranchManifest::setBranchStatus has been called,
+ *              as only active branches are copied.
+ */
+class SkimWriter
+{
+ public:
+  SkimWriter(const edm::ParameterSet& cfg, EventSource& eventSource);
+  ~SkimWriter();
+
+  /**
+   * @brief Copy the current entry of the input tree to the skim;
+   *        all branches registered in the BranchManifest need to be read for the entry before
+   */
+  void fill();
+
+  /**
+   * @brief Write the skim to the output file and close it
+   */
+  void write();
+
+ protected:
+  /**
+   * @brief Convert name of compression algorithm ("ZLIB", "LZMA", "LZ4" or "ZSTD") to the ROOT enum value
+   */
+  int getCompressionAlgorithm(const std::string& compressionAlgorithm) const;
+
+  EventSource& eventSource_;
+
+  std::string outputFileName_;
+  TFile* outputFile_;
+  TTree* outputTree_;
+
+  int treeNumber_;
+  Long64_t numEntries_;
+};
+
+#endif // tthAnalysis_HiggsToTauTau_SkimWriter_h
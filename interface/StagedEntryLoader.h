@@ -0,0 +1,82 @@
+#ifndef tthAnalysis_HiggsToTauTau_StagedEntryLoader_h
+#define tthAnalysis_HiggsToTauTau_StagedEntryLoader_h
+
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource
+
+#include <Rtypes.h> // Int_t, Long64_t, Double_t
+#include <TTree.h> // TTree
+#include <TBranch.h> // TBranch
+#include <TLeaf.h> // TLeaf
+
+#include <string> // std::string
+#include <vector> // std::vector<>
+#include <map> // std::map<,>
+
+/**
+ * @brief Load the branches of an entry in two stages:
+ *
+ *        In the first stage, only the branches needed for a fast rejection of the event
+ *        (e.g. run, lumi and event numbers, trigger bits and object multiplicities) are read.
+ *        The remaining branches registered in the BranchManifest of the EventSource are read in the second stage,
+ *        for events that survive the cuts applied after the first stage.
+ *
+ *        The TBranch pointers are cached and updated whenever a new file of a TChain gets opened.
+ *
+ *        When the events are read from columnar cache files, all columns are available once the entry has been positioned,
+ *        so both stages reduce to a single EventSource::getEntry call.
+ */
+class StagedEntryLoader
+{
+ public:
+  StagedEntryLoader(EventSource& eventSource);
+  ~StagedEntryLoader();
+
+  /**
+   * @brief Add branch(es) to the list of branches read in the first stage
+   */
+  void addEarlyBranch(const std::string& branchName);
+  void addEarlyBranches(const std::vector<std::string>& branchNames);
+
+  /**
+   * @brief Read branches of the first stage for given entry
+   * @return Number of bytes read, -1 in case the entry does not exist
+   */
+  Int_t loadEarly(Long64_t entry);
+
+  /**
+   * @brief Return value of branch read in the first stage (e.g. object multiplicities)
+   */
+  Double_t getValue(const std::string& branchName) const;
+
+  /**
+   * @brief Read all remaining branches registered in the BranchManifest of the EventSource for the entry passed to the last loadEarly call
+   * @return Number of bytes read
+   */
+  Int_t loadRemaining();
+
+ protected:
+  /**
+   * @brief Update cached TBranch and TLeaf pointers after TChain has opened a new file
+   */
+  void updateBranches(TTree* currentTree);
+
+  /**
+   * @brief Look up columns of branches read in the first stage in the columnar cache files
+   */
+  void updateColumns();
+
+  EventSource& eventSource_;
+  TTree* tree_;
+  ColumnarCacheReader* cache_;
+
+  std::vector<std::string> earlyBranchNames_;
+  std::vector<TBranch*> earlyBranches_;
+  std::map<std::string, TLeaf*> earlyLeaves_; // key = branchName
+  std::vector<TBranch*> remainingBranches_;
+  std::map<std::string, int> earlyColumns_; // key = branchName
+
+  int treeNumber_;
+  Long64_t localEntry_;
+};
+
+#endif // tthAnalysis_HiggsToTauTau_StagedEntryLoader_h
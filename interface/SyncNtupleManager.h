@@ -12,6 +12,7 @@
 #include "tthAnalysis/HiggsToTauTau/interface/RecoElectron.h"
 #include "tthAnalysis/HiggsToTauTau/interface/RecoHadTau.h"
 #include "tthAnalysis/HiggsToTauTau/interface/RecoJet.h"
+#include "tthAnalysis/HiggsToTauTau/interface/ParticleCollectionMultiSelector.h" // RecoMuonCollectionSelection, RecoElectronCollectionSelection
 
 enum FloatVariableType { PFMET, PFMETphi, MHT, metLD };
 
@@ -50,14 +51,8 @@ public:
   void readRunLumiEvent(UInt_t run,
                         UInt_t lumi,
                         ULong64_t event);
-  void read(std::vector<const RecoMuon *> & muons,
-            std::vector<const RecoMuon *> & fakeable_muons,
-            std::vector<const RecoMuon *> & cutbased_muons,
-            std::vector<const RecoMuon *> & mvabased_muons);
-  void read(std::vector<const RecoElectron *> & electrons,
-            std::vector<const RecoElectron *> & fakeable_electrons,
-            std::vector<const RecoElectron *> & cutbased_electrons,
-            std::vector<const RecoElectron *> & mvabased_electrons);
+  void read(const RecoMuonCollectionSelection & muons);
+  void read(const RecoElectronCollectionSelection & electrons);
   void read(std::vector<const RecoHadTau *> & hadtaus);
   void read(std::vector<const RecoJet *> & jets);
   void read(Float_t value,
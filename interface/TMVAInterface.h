@@ -2,30 +2,52 @@
 #define tthAnalysis_HiggsToTauTau_TMVAInterface_h
 
 #include "TMVA/Reader.h"
+#include "TMVA/MethodBase.h"
 #include <TROOT.h> // for Float_t
 
+#include "tthAnalysis/HiggsToTauTau/interface/BDTForest.h" // BDTForest
+#include "tthAnalysis/HiggsToTauTau/interface/compiledBDTs.h" // CompiledBDT
+
 #include <vector>
 #include <string>
 
 class TMVAInterface
 {
  public:
-  TMVAInterface(const std::string& mvaFileName, const std::vector<std::string>& mvaInputVariables, const std::vector<std::string>& spectators);
+  /**
+   * @brief Book MVA
+   * @param mvaInputVariables Names of MVA input variables, in the order used for the TMVA training
+   * @param spectators        Names of variables declared as "spectators" during the TMVA training
+   * @param mvaInputLayout    Names of the values stored in the array of input values passed to operator(), in the order in which they are stored
+   *                          (allows to use one array for several MVAs with different input variables;
+   *                           if empty, the values are expected in the order given by mvaInputVariables)
+   *
+   *        The position of each MVA input variable in the array is resolved once, when the MVA is booked.
+   *        BDTs compiled into the library (see compiledBDTs.h) are used without reading the weight file,
+   *        other BDTs trained with gradient boosting are evaluated by BDTForest and all other MVAs by TMVA::Reader.
+   */
+  TMVAInterface(const std::string& mvaFileName, const std::vector<std::string>& mvaInputVariables, const std::vector<std::string>& spectators,
+		const std::vector<std::string>& mvaInputLayout = std::vector<std::string>());
   ~TMVAInterface();
 
   /**
    * @brief Calculates MVA output.
-   * @param mvaInputs Values of MVA input variables (stored in std::map with key = MVA input variable name)
+   * @param mvaInputs Values of MVA input variables (stored in array in the order given by mvaInputLayout)
    * @return          MVA output
    */
   double
-  operator()(const std::map<std::string, double>& mvaInputs) const;
+  operator()(const Float_t* mvaInputs) const;
 
  private:
+  const CompiledBDT* compiledBDT_;
+  BDTForest* bdt_;
+
   TMVA::Reader* mva_;
+  TMVA::MethodBase* method_;
 
-  mutable std::map<std::string, Float_t> mvaInputVariables_; // key = MVA input variable name
-  mutable std::map<std::string, Float_t> spectators_; // we do not really care about variables declared as "spectators" during TMVA training, but TMVA requires that we keep track of these variables...
+  std::vector<int> mvaInputIndices_; // position of each MVA input variable in the array passed to operator()
+  mutable std::vector<Float_t> mvaInputVariables_; // in the order used for the TMVA training (the TMVA::Reader keeps pointers to the elements)
+  mutable std::vector<Float_t> spectators_; // we do not really care about variables declared as "spectators" during TMVA training, but TMVA requires that we keep track of these variables...
 };
 
 #endif // TMVAInterface_h
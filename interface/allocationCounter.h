@@ -0,0 +1,19 @@
+#ifndef tthAnalysis_HiggsToTauTau_allocationCounter_h
+#define tthAnalysis_HiggsToTauTau_allocationCounter_h
+
+/**
+ * @brief Return number of heap allocations made by the program so far.
+ *
+ *        The allocations are counted only in case the package is compiled with COUNT_ALLOCATIONS defined
+ *        (uncomment the corresponding line in the BuildFile.xml of the package),
+ *        as the counting replaces the global operator new and delete.
+ *        Otherwise, the function returns zero.
+ */
+unsigned long getNumAllocations();
+
+/**
+ * @brief Return true in case the package is compiled with COUNT_ALLOCATIONS defined, false otherwise
+ */
+bool isAllocationCountingEnabled();
+
+#endif // tthAnalysis_HiggsToTauTau_allocationCounter_h
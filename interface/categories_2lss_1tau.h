@@ -0,0 +1,40 @@
+#ifndef tthAnalysis_HiggsToTauTau_categories_2lss_1tau_h
+#define tthAnalysis_HiggsToTauTau_categories_2lss_1tau_h
+
+#include <cstddef> // size_t
+
+/**
+ * @brief Event categories of the 2lss_1tau channel,
+ *        defined by the flavour and charge of the two leptons and by the number of medium b-tagged jets
+ */
+enum { 
+  k2epp_btight, k2epp_bloose, k2emm_btight, k2emm_bloose, 
+  k1e1mupp_btight, k1e1mupp_bloose, k1e1mumm_btight, k1e1mumm_bloose, 
+  k2mupp_btight, k2mupp_bloose, k2mumm_btight, k2mumm_bloose,
+  kNumCategories_2lss_1tau
+};
+const int kNoCategory_2lss_1tau = -1;
+
+/**
+ * @brief Return index of event category
+ * @param numElectrons, numMuons Number of selected electrons and muons (two leptons in total)
+ *        isCharge_pp, isCharge_mm True if both leptons have positive (negative) charge
+ *        numBJets_medium Number of jets passing the medium b-tagging working point
+ * @return Index of category, computed by table lookup;
+ *         kNoCategory_2lss_1tau for events with two leptons of opposite charge or with a number of leptons different from two
+ */
+int getCategory_2lss_1tau(size_t numElectrons, size_t numMuons, bool isCharge_pp, bool isCharge_mm, size_t numBJets_medium);
+
+/**
+ * @brief Return name of event category, e.g. "2epp_1tau_btight", as used in the names of histogram directories
+ */
+const char* getCategoryName_2lss_1tau(int category);
+
+/**
+ * @brief Return number of electrons and muons and the sign of the lepton charges (+1 or -1) in given event category
+ */
+int getNumElectrons_2lss_1tau(int category);
+int getNumMuons_2lss_1tau(int category);
+int getCharge_2lss_1tau(int category);
+
+#endif // tthAnalysis_HiggsToTauTau_categories_2lss_1tau_h
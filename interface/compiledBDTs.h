@@ -0,0 +1,52 @@
+#ifndef tthAnalysis_HiggsToTauTau_compiledBDTs_h
+#define tthAnalysis_HiggsToTauTau_compiledBDTs_h
+
+/**
+ * @brief BDTs compiled into the library.
+ *
+ *        The code of the BDTs is generated from the TMVA weight files in data/ by test/generateCompiledBDTs.py
+ *        and stored in src/compiledBDTs_generated.cc: each BDT is one function, with the cuts and responses of all trees written as constants.
+ *        The functions return the same output as BDTForest and TMVA::Reader, without parsing the weight file at runtime.
+ */
+
+#include <Rtypes.h> // Float_t
+
+#include <string> // std::string
+#include <cstddef> // size_t
+
+/**
+ * @brief Function computing the BDT output
+ * @param mvaInputs       Array of input values
+ * @param mvaInputIndices Position of each MVA input variable (in the order used for the TMVA training) in the array of input values
+ * @return                BDT output, in the range -1..+1 (-999 in case any input value is NaN, as for TMVA::Reader)
+ */
+typedef double (*CompiledBDTFunction)(const Float_t* mvaInputs, const int* mvaInputIndices);
+
+struct CompiledBDT
+{
+  const char* mvaFileName_;            // name of the weight file, as passed to edm::FileInPath
+  unsigned long long mvaFileChecksum_; // checksum of the weight file the code has been generated from (computed by computeFileChecksum)
+  const char* const* inputVariables_;  // names of the MVA input variables, in the order used for the TMVA training
+  int numInputVariables_;
+  CompiledBDTFunction function_;
+};
+
+/**
+ * @brief Return the BDT compiled from the given weight file
+ * @param mvaFileName      Name of the weight file, as passed to edm::FileInPath
+ * @param mvaFileName_full Full path of the weight file
+ * @return                 Pointer to the compiled BDT, or null pointer in case no BDT has been compiled from the weight file
+ *                         or the weight file has changed since the code was generated
+ */
+const CompiledBDT* findCompiledBDT(const std::string& mvaFileName, const std::string& mvaFileName_full);
+
+/**
+ * @brief Compute 64-bit FNV-1a hash of the content of a file (same hash as computed by test/generateCompiledBDTs.py)
+ */
+unsigned long long computeFileChecksum(const std::string& fileName);
+
+// CV: defined in src/compiledBDTs_generated.cc
+extern const CompiledBDT compiledBDTs[];
+extern const size_t numCompiledBDTs;
+
+#endif // tthAnalysis_HiggsToTauTau_compiledBDTs_h
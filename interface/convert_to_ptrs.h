@@ -16,4 +16,18 @@ std::vector<const T*> convert_to_ptrs(const std::vector<T>& particles)
   return particle_ptrs;
 }
 
+/**
+ * @brief Same as above, but fill the std::vector of const pointers given as function argument,
+ *        so that the memory allocated for it is reused from one event to the next
+ */
+template <typename T> 
+void convert_to_ptrs(const std::vector<T>& particles, std::vector<const T*>& particle_ptrs)
+{
+  particle_ptrs.clear();
+  for ( typename std::vector<T>::const_iterator particle = particles.begin();
+	particle != particles.end(); ++particle ) {
+    particle_ptrs.push_back(&(*particle));
+  }
+}
+
 #endif // tthAnalysis_HiggsToTauTau_convert_to_ptrs_h
@@ -0,0 +1,126 @@
+#ifndef tthAnalysis_HiggsToTauTau_deltaRKernels_h
+#define tthAnalysis_HiggsToTauTau_deltaRKernels_h
+
+/**
+ * @brief Vectorized computation of distances in (eta,phi) space between two collections of particles.
+ *
+ *        The kernels operate on contiguous arrays of eta and phi values (in single precision)
+ *        and return squared distances dR^2, with the difference in phi wrapped into the range [-pi,+pi].
+ *        AVX2 and AVX-512 implementations are selected at runtime, depending on the instruction sets supported by the CPU,
+ *        with a scalar implementation as fallback.
+ */
+
+#include <cmath> // std::nearbyint()
+#include <cstddef> // size_t
+#include <string> // std::string
+#include <vector> // std::vector
+
+const float deltaRKernels_twoPi = 6.28318530717958648f;
+const float deltaRKernels_invTwoPi = 0.159154943091895336f;
+
+/**
+ * @brief Compute dR^2 for a single pair of particles
+ *        (same computation as performed by the vectorized kernels)
+ */
+inline float comp_deltaR2(float eta1, float phi1, float eta2, float phi2)
+{
+  float dEta = eta1 - eta2;
+  float dPhi = phi1 - phi2;
+  dPhi = dPhi - deltaRKernels_twoPi*std::nearbyint(dPhi*deltaRKernels_invTwoPi);
+  return dEta*dEta + dPhi*dPhi;
+}
+
+/**
+ * @brief Compute dR^2 between all pairs of particles in the first and second collection
+ * @param dR2 Output matrix, stored in row-major order (element [idx1*n2 + idx2] holds dR^2 between particles idx1 and idx2);
+ *            the memory for n1*n2 elements needs to be allocated by the caller
+ */
+void comp_deltaR2_matrix(const float* eta1, const float* phi1, size_t n1,
+			 const float* eta2, const float* phi2, size_t n2,
+			 float* dR2);
+
+/**
+ * @brief Compute for each particle in the first collection the minimal dR^2 to any particle in the second collection
+ * @param dR2min Output array of n1 elements, holding the minimal dR^2 (set to FLT_MAX in case the second collection is empty)
+ * @param idxMin Output array of n1 elements, holding the index of the closest particle in the second collection
+ *               (set to -1 in case the second collection is empty; in case of ties, the lowest index is taken).
+ *               Pass a null pointer in case the indices are not needed.
+ */
+void comp_deltaR2_min(const float* eta1, const float* phi1, size_t n1,
+		      const float* eta2, const float* phi2, size_t n2,
+		      float* dR2min, int* idxMin = 0);
+
+enum { kDeltaRKernelAuto, kDeltaRKernelScalar, kDeltaRKernelAVX2, kDeltaRKernelAVX512 };
+
+/**
+ * @brief Force use of given implementation of the kernels (kDeltaRKernelAuto restores the runtime detection).
+ *
+ *        Intended for benchmarking and validation; throws an exception in case the CPU does not support the requested instruction set.
+ */
+void setDeltaRKernel(int kernel);
+
+/**
+ * @brief Return implementation of the kernels currently in use
+ */
+int getDeltaRKernel();
+
+/**
+ * @brief Return true in case the given implementation of the kernels is supported by the CPU (and by the compiler)
+ */
+bool isDeltaRKernelSupported(int kernel);
+
+std::string getDeltaRKernelName(int kernel);
+
+/**
+ * @brief Contiguous arrays of eta and phi values, filled from collections of particles before calling the kernels.
+ *
+ *        The memory allocated for the arrays is reused in case the same instance is filled again.
+ */
+class EtaPhiArrays
+{
+ public:
+  EtaPhiArrays() {}
+  ~EtaPhiArrays() {}
+
+  void clear()
+  {
+    eta_.clear();
+    phi_.clear();
+  }
+
+  void push_back(float eta, float phi)
+  {
+    eta_.push_back(eta);
+    phi_.push_back(phi);
+  }
+
+  /**
+   * @brief Append eta and phi of all particles in the given collection
+   */
+  template <typename T>
+  void push_back(const std::vector<const T*>& particles)
+  {
+    for ( typename std::vector<const T*>::const_iterator particle = particles.begin();
+	  particle != particles.end(); ++particle ) {
+      push_back((*particle)->eta_, (*particle)->phi_);
+    }
+  }
+  template <typename T>
+  void push_back(const std::vector<T>& particles)
+  {
+    for ( typename std::vector<T>::const_iterator particle = particles.begin();
+	  particle != particles.end(); ++particle ) {
+      push_back(particle->eta_, particle->phi_);
+    }
+  }
+
+  size_t size() const { return eta_.size(); }
+  const float* eta() const { return eta_.data(); }
+  const float* phi() const { return phi_.data(); }
+
+ protected:
+  std::vector<float> eta_;
+  std::vector<float> phi_;
+};
+
+#endif // tthAnalysis_HiggsToTauTau_deltaRKernels_h
@@ -2,7 +2,8 @@
 #define tthAnalysis_HiggsToTauTau_hltPath_h
 
 #include <Rtypes.h> // Int_t
-#include <TTree.h> // TTree
+
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h" // EventSource
 
 #include <string> // std::string
 #include <vector> // std::vector<>
@@ -14,18 +15,21 @@ struct hltPath
 {
   hltPath(const std::string& branchName)
     : branchName_(branchName)
+    , value_(0)
   {}
   ~hltPath() {}
-  void setBranchAddress(TTree* tree)
+  void setBranchAddress(EventSource& eventSource)
   {
-    tree->SetBranchAddress(branchName_.data(), &value_);
+    // CV: buffer is shared in case the same trigger path is used by multiple hltPath objects
+    value_ = eventSource.getBuffer<Int_t>(branchName_);
   } 
   std::string branchName_;
-  Int_t value_;
+  Int_t* value_;
 };
 
 std::vector<hltPath*> create_hltPaths(std::vector<std::string>& branchNames);
-void hltPaths_setBranchAddresses(TTree* tree, const std::vector<hltPath*>& hltPaths);
+void hltPaths_setBranchAddresses(EventSource& eventSource, const std::vector<hltPath*>& hltPaths);
+std::vector<std::string> hltPaths_branchNames(const std::vector<hltPath*>& hltPaths);
 bool hltPaths_isTriggered(const std::vector<hltPath*>& hltPaths);
 void hltPaths_delete(const std::vector<hltPath*>& hltPaths);
 
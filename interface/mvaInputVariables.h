@@ -9,6 +9,9 @@
 #include "tthAnalysis/HiggsToTauTau/interface/RecoJet.h" // RecoJet
 #include "tthAnalysis/HiggsToTauTau/interface/RecoLepton.h" // RecoJet
 
+#include <string> // std::string
+#include <vector> // std::vector
+
 double comp_MT_met_lep1(const GenParticle& lepton, double met_pt, double met_phi);
 double comp_n_jet25_recl(const std::vector<const RecoJet*>& jets_cleaned);
 double comp_mindr_lep1_jet(const GenParticle& lepton, const std::vector<const RecoJet*>& jets_cleaned);
@@ -17,4 +20,27 @@ double comp_lep1_conePt(const RecoLepton& lepton);
 double comp_lep2_conePt(const RecoLepton& lepton);
 double comp_avg_dr_jet(const std::vector<const RecoJet*>& jets_cleaned);
 
+/**
+ * @brief Positions of the input variables of the BDTs used to discriminate ttH vs. ttV and ttH vs. ttbar in the 2lss categories
+ *        in the array of input values passed to TMVAInterface
+ */
+enum {
+  kMVAInput_2lss_max_lep_eta,    // max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))
+  kMVAInput_2lss_MT_met_lep1,    // MT_met_lep1
+  kMVAInput_2lss_nJet25_Recl,    // nJet25_Recl
+  kMVAInput_2lss_mindr_lep1_jet, // mindr_lep1_jet
+  kMVAInput_2lss_mindr_lep2_jet, // mindr_lep2_jet
+  kMVAInput_2lss_lep1_conePt,    // LepGood_conePt[iF_Recl[0]]
+  kMVAInput_2lss_lep2_conePt,    // LepGood_conePt[iF_Recl[1]]
+  kMVAInput_2lss_met_pt,         // min(met_pt,400)
+  kMVAInput_2lss_avg_dr_jet,     // avg_dr_jet
+  kNumMVAInputs_2lss
+};
+
+/**
+ * @brief Names of the input variables used in the TMVA training, in the order of the enum above
+ *       (to be passed as mvaInputLayout to the constructor of TMVAInterface)
+ */
+std::vector<std::string> getMVAInputLayout_2lss();
+
 #endif // mvaInputVariables_h
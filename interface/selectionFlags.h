@@ -0,0 +1,31 @@
+#ifndef tthAnalysis_HiggsToTauTau_selectionFlags_h
+#define tthAnalysis_HiggsToTauTau_selectionFlags_h
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <string> // std::string
+
+/**
+ * @brief Bits of the selection mask computed for each particle by the Reco*SelectorMultiTier classes
+ */
+enum { 
+  kSelectionLoose    = 1 << 0, 
+  kSelectionFakeable = 1 << 1, 
+  kSelectionTight    = 1 << 2, 
+  kSelectionCutBased = 1 << 3, 
+  kSelectionMVABased = 1 << 4 
+};
+
+/**
+ * @brief Check that a cut has the value assumed by a Reco*SelectorMultiTier class,
+ *        e.g. that a cut tested only once for several selections has the same value in the single-tier selectors of all of them
+ */
+template <typename T>
+void checkMultiTierCut(const std::string& selector, const std::string& cut, const T& value, const T& value_expected)
+{
+  if ( value != value_expected )
+    throw cms::Exception(selector.data())
+      << "Cut = " << cut << " does not match the structure of the multi-tier selection, update " << selector << " !!\n";
+}
+
+#endif // tthAnalysis_HiggsToTauTau_selectionFlags_h
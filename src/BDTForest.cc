@@ -0,0 +1,160 @@
+#include "tthAnalysis/HiggsToTauTau/interface/BDTForest.h"
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <TMath.h> // TMath::IsNaN
+
+#include <algorithm> // std::find
+#include <cmath> // std::exp
+#include <cstdlib> // std::atoi, std::strtof
+#include <cstring> // std::strcmp
+
+namespace
+{
+  /**
+   * @brief Return value of attribute with given name, throw exception if the attribute does not exist
+   */
+  const char* getAttribute(TXMLEngine& xml, XMLNodePointer_t xmlNode, const char* attrName, const std::string& mvaFileName)
+  {
+    const char* attrValue = xml.GetAttr(xmlNode, attrName);
+    if ( !attrValue )
+      throw cms::Exception("BDTForest")
+	<< "Node = " << xml.GetNodeName(xmlNode) << " has no attribute = " << attrName << " in file = " << mvaFileName << " !!\n";
+    return attrValue;
+  }
+}
+
+BDTForest::BDTForest(const std::string& mvaFileName)
+  : mvaFileName_(mvaFileName)
+{
+  TXMLEngine xml;
+  XMLDocPointer_t xmlDocument = xml.ParseFile(mvaFileName.data());
+  if ( !xmlDocument )
+    throw cms::Exception("BDTForest")
+      << "Failed to parse file = " << mvaFileName << " !!\n";
+  XMLNodePointer_t xmlMethodSetup = xml.DocGetRootElement(xmlDocument);
+  std::string method = ( xmlMethodSetup ) ? getAttribute(xml, xmlMethodSetup, "Method", mvaFileName_) : "";
+  std::string error = "";
+  if ( method.find("BDT::") != 0 ) error = "Method = " + method + " is not a BDT";
+  bool isGradBoost = false;
+  bool hasWeights = false;
+  for ( XMLNodePointer_t xmlNode = xml.GetChild(xmlMethodSetup); xmlNode && error == ""; xmlNode = xml.GetNext(xmlNode) ) {
+    std::string nodeName = xml.GetNodeName(xmlNode);
+    if ( nodeName == "GeneralInfo" ) {
+      for ( XMLNodePointer_t xmlInfo = xml.GetChild(xmlNode); xmlInfo; xmlInfo = xml.GetNext(xmlInfo) ) {
+	if ( std::strcmp(getAttribute(xml, xmlInfo, "name", mvaFileName_), "AnalysisType") == 0 &&
+	     std::strcmp(getAttribute(xml, xmlInfo, "value", mvaFileName_), "Classification") != 0 ) error = "AnalysisType is not Classification";
+      }
+    } else if ( nodeName == "Options" ) {
+      for ( XMLNodePointer_t xmlOption = xml.GetChild(xmlNode); xmlOption; xmlOption = xml.GetNext(xmlOption) ) {
+	if ( std::strcmp(getAttribute(xml, xmlOption, "name", mvaFileName_), "BoostType") == 0 ) {
+	  const char* boostType = xml.GetNodeContent(xmlOption);
+	  isGradBoost = ( boostType && std::strcmp(boostType, "Grad") == 0 );
+	}
+      }
+    } else if ( nodeName == "Variables" ) {
+      for ( XMLNodePointer_t xmlVariable = xml.GetChild(xmlNode); xmlVariable; xmlVariable = xml.GetNext(xmlVariable) ) {
+	int idxVariable = std::atoi(getAttribute(xml, xmlVariable, "VarIndex", mvaFileName_));
+	if ( idxVariable != (int)inputVariables_.size() ) error = "Variables are not stored in order of VarIndex";
+	inputVariables_.push_back(getAttribute(xml, xmlVariable, "Expression", mvaFileName_));
+	inputIndices_.push_back(idxVariable);
+      }
+    } else if ( nodeName == "Transformations" ) {
+      if ( std::atoi(getAttribute(xml, xmlNode, "NTransformations", mvaFileName_)) != 0 ) error = "Variable transformations are not supported";
+    } else if ( nodeName == "Weights" ) {
+      hasWeights = true;
+      for ( XMLNodePointer_t xmlTree = xml.GetChild(xmlNode); xmlTree && error == ""; xmlTree = xml.GetNext(xmlTree) ) {
+	XMLNodePointer_t xmlRoot = xml.GetChild(xmlTree);
+	if ( !xmlRoot ) {
+	  error = "Tree without nodes";
+	  break;
+	}
+	try {
+	  roots_.push_back(addNode(xml, xmlRoot));
+	} catch ( ... ) {
+	  xml.FreeDoc(xmlDocument);
+	  throw;
+	}
+      }
+    }
+  }
+  xml.FreeDoc(xmlDocument);
+  if ( error == "" && !isGradBoost ) error = "BoostType is not Grad";
+  if ( error == "" && (!hasWeights || roots_.empty()) ) error = "No trees found";
+  if ( error != "" )
+    throw cms::Exception("BDTForest")
+      << "Unsupported MVA in file = " << mvaFileName << ": " << error << " !!\n";
+}
+
+int BDTForest::addNode(TXMLEngine& xml, XMLNodePointer_t xmlNode)
+{
+  int idxNode = nodes_.size();
+  nodes_.push_back(Node());
+  XMLNodePointer_t xmlDaughter_left = 0;
+  XMLNodePointer_t xmlDaughter_right = 0;
+  for ( XMLNodePointer_t xmlDaughter = xml.GetChild(xmlNode); xmlDaughter; xmlDaughter = xml.GetNext(xmlDaughter) ) {
+    const char* pos = getAttribute(xml, xmlDaughter, "pos", mvaFileName_);
+    if      ( std::strcmp(pos, "l") == 0 ) xmlDaughter_left = xmlDaughter;
+    else if ( std::strcmp(pos, "r") == 0 ) xmlDaughter_right = xmlDaughter;
+  }
+  if ( !xmlDaughter_left && !xmlDaughter_right ) {
+    // CV: responses are stored as Float_t in TMVA::DecisionTreeNode
+    nodes_[idxNode].idxVariable_ = -1;
+    nodes_[idxNode].value_ = std::strtof(getAttribute(xml, xmlNode, "res", mvaFileName_), 0);
+    nodes_[idxNode].offset_ = 0;
+    return idxNode;
+  }
+  if ( !(xmlDaughter_left && xmlDaughter_right) )
+    throw cms::Exception("BDTForest")
+      << "Unsupported MVA in file = " << mvaFileName_ << ": Node with only one daughter !!\n";
+  if ( std::atoi(getAttribute(xml, xmlNode, "NCoef", mvaFileName_)) != 0 )
+    throw cms::Exception("BDTForest")
+      << "Unsupported MVA in file = " << mvaFileName_ << ": Fisher cuts are not supported !!\n";
+  int idxVariable = std::atoi(getAttribute(xml, xmlNode, "IVar", mvaFileName_));
+  if ( !(idxVariable >= 0 && idxVariable < (int)inputVariables_.size()) )
+    throw cms::Exception("BDTForest")
+      << "Invalid index of input variable = " << idxVariable << " in file = " << mvaFileName_ << " !!\n";
+  // CV: TMVA sends events to the right daughter if value >= cut for cType = 1 and if value < cut for cType = 0;
+  //     the daughter taken in case value < cut is stored directly after its mother
+  bool cutType = ( std::atoi(getAttribute(xml, xmlNode, "cType", mvaFileName_)) != 0 );
+  addNode(xml, ( cutType ) ? xmlDaughter_left : xmlDaughter_right);
+  int idxDaughter_geq = addNode(xml, ( cutType ) ? xmlDaughter_right : xmlDaughter_left);
+  nodes_[idxNode].idxVariable_ = idxVariable;
+  nodes_[idxNode].value_ = std::strtof(getAttribute(xml, xmlNode, "Cut", mvaFileName_), 0);
+  nodes_[idxNode].offset_ = idxDaughter_geq - idxNode;
+  return idxNode;
+}
+
+void BDTForest::setInputIndices(const std::vector<int>& inputIndices)
+{
+  if ( inputIndices.size() != inputVariables_.size() )
+    throw cms::Exception("BDTForest")
+      << "Number of input indices = " << inputIndices.size() << " does not match number of input variables = " << inputVariables_.size()
+      << " of MVA in file = " << mvaFileName_ << " !!\n";
+  for ( std::vector<Node>::iterator node = nodes_.begin();
+	node != nodes_.end(); ++node ) {
+    if ( node->idxVariable_ < 0 ) continue;
+    int idxVariable = std::find(inputIndices_.begin(), inputIndices_.end(), node->idxVariable_) - inputIndices_.begin();
+    node->idxVariable_ = inputIndices[idxVariable];
+  }
+  inputIndices_ = inputIndices;
+}
+
+double BDTForest::operator()(const Float_t* mvaInputs) const
+{
+  for ( std::vector<int>::const_iterator inputIndex = inputIndices_.begin();
+	inputIndex != inputIndices_.end(); ++inputIndex ) {
+    if ( TMath::IsNaN(mvaInputs[*inputIndex]) ) return -999.;
+  }
+  double sum = 0.;
+  for ( std::vector<int>::const_iterator root = roots_.begin();
+	root != roots_.end(); ++root ) {
+    const Node* node = &nodes_[*root];
+    while ( node->idxVariable_ >= 0 ) {
+      node += ( mvaInputs[node->idxVariable_] >= node->value_ ) ? node->offset_ : 1;
+    }
+    sum += node->value_;
+  }
+  // CV: same transformation of the sum of responses as in TMVA::MethodBDT::GetGradBoostMVA
+  return 2./(1. + std::exp(-2.*sum)) - 1.;
+}
@@ -0,0 +1,53 @@
+#include "tthAnalysis/HiggsToTauTau/interface/BranchManifest.h"
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <TBranch.h> // TBranch
+
+#include <iomanip> // std::setprecision(), std::fixed
+
+BranchManifest::BranchManifest()
+{}
+
+BranchManifest::~BranchManifest()
+{}
+
+void BranchManifest::addBranch(const std::string& branchName)
+{
+  branchNames_.insert(branchName);
+}
+
+void BranchManifest::setBranchStatus(TTree* tree) const
+{
+  if ( branchNames_.empty() ) 
+    throw cms::Exception("BranchManifest") 
+      << "No branches registered, refusing to disable all branches of the tree !!\n";
+  tree->SetBranchStatus("*", 0);
+  for ( std::set<std::string>::const_iterator branchName = branchNames_.begin();
+	branchName != branchNames_.end(); ++branchName ) {
+    tree->SetBranchStatus(branchName->data(), 1);
+  }
+}
+
+void BranchManifest::print(TTree* tree, std::ostream& stream) const
+{
+  // CV: in case of TChain, the numbers refer to the file that is currently loaded
+  TTree* currentTree = tree->GetTree();
+  if ( !currentTree ) currentTree = tree;
+  Long64_t numEntries = currentTree->GetEntries();
+  if ( numEntries <= 0 ) return;
+  Long64_t totBytes = 0;
+  Long64_t zipBytes = 0;
+  for ( std::set<std::string>::const_iterator branchName = branchNames_.begin();
+	branchName != branchNames_.end(); ++branchName ) {
+    TBranch* branch = currentTree->GetBranch(branchName->data());
+    if ( !branch ) continue;
+    totBytes += branch->GetTotBytes("*");
+    zipBytes += branch->GetZipBytes("*");
+  }
+  stream << "reading " << branchNames_.size() << " branches:" 
+	 << " " << std::fixed << std::setprecision(1) << (double)totBytes/numEntries << " bytes/entry"
+	 << " (" << (double)zipBytes/numEntries << " compressed)," 
+	 << " out of " << (double)currentTree->GetTotBytes()/numEntries << " bytes/entry"
+	 << " (" << (double)currentTree->GetZipBytes()/numEntries << " compressed) stored in the tree" << std::endl;
+}
@@ -0,0 +1,491 @@
+#include "tthAnalysis/HiggsToTauTau/interface/ColumnarCache.h"
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <cstring> // std::memcpy, std::strncmp
+#include <cassert> // assert
+#include <algorithm> // std::upper_bound
+#include <sys/mman.h> // mmap, munmap, madvise
+#include <sys/stat.h> // fstat
+#include <fcntl.h> // open
+#include <unistd.h> // close
+
+namespace
+{
+  const char* magic = "TTHCOL01";
+  const int magicSize = 8;
+  const int alignment = 8;
+
+  void writeLong64(std::ofstream& file, Long64_t value) { file.write(reinterpret_cast<const char*>(&value), sizeof(Long64_t)); }
+  void writeInt(std::ofstream& file, Int_t value) { file.write(reinterpret_cast<const char*>(&value), sizeof(Int_t)); }
+  void writeString(std::ofstream& file, const std::string& value)
+  {
+    writeInt(file, value.size());
+    file.write(value.data(), value.size());
+  }
+
+  /**
+   * @brief Auxiliary class to read the footer of a file mapped into memory
+   */
+  class footerReader
+  {
+   public:
+    footerReader(const char* data, size_t size, size_t offset, const std::string& fileName)
+      : data_(data)
+      , size_(size)
+      , offset_(offset)
+      , fileName_(fileName)
+    {}
+    template <typename T>
+    T read()
+    {
+      if ( offset_ + sizeof(T) > size_ )
+	throw cms::Exception("ColumnarCacheReader")
+	  << "File = " << fileName_ << " is truncated !!\n";
+      T value;
+      std::memcpy(&value, data_ + offset_, sizeof(T));
+      offset_ += sizeof(T);
+      return value;
+    }
+    std::string readString()
+    {
+      Int_t length = read<Int_t>();
+      if ( length < 0 || offset_ + length > size_ )
+	throw cms::Exception("ColumnarCacheReader")
+	  << "File = " << fileName_ << " is truncated !!\n";
+      std::string value(data_ + offset_, length);
+      offset_ += length;
+      return value;
+    }
+   private:
+    const char* data_;
+    size_t size_;
+    size_t offset_;
+    std::string fileName_;
+  };
+
+  Long64_t getCount(const void* data, const std::string& type)
+  {
+    if      ( type == "Int_t"     ) return *static_cast<const Int_t*>(data);
+    else if ( type == "UInt_t"    ) return *static_cast<const UInt_t*>(data);
+    else if ( type == "Short_t"   ) return *static_cast<const Short_t*>(data);
+    else if ( type == "UShort_t"  ) return *static_cast<const UShort_t*>(data);
+    else if ( type == "Char_t"    ) return *static_cast<const Char_t*>(data);
+    else if ( type == "UChar_t"   ) return *static_cast<const UChar_t*>(data);
+    else if ( type == "Long64_t"  ) return *static_cast<const Long64_t*>(data);
+    else if ( type == "ULong64_t" ) return *static_cast<const ULong64_t*>(data);
+    else throw cms::Exception("ColumnarCache")
+      << "Invalid type = " << type << " for number of elements of variable-size array !!\n";
+  }
+}
+
+int getColumnarCacheTypeSize(const std::string& type)
+{
+  if      ( type == "Char_t"    || type == "UChar_t"  || type == "Bool_t"   ) return 1;
+  else if ( type == "Short_t"   || type == "UShort_t"                       ) return 2;
+  else if ( type == "Int_t"     || type == "UInt_t"   || type == "Float_t"  ) return 4;
+  else if ( type == "Long64_t"  || type == "ULong64_t" || type == "Double_t" ) return 8;
+  else return 0;
+}
+
+std::string getColumnarCacheType(const std::type_info& type)
+{
+  if      ( type == typeid(Char_t)    ) return "Char_t";
+  else if ( type == typeid(UChar_t)   ) return "UChar_t";
+  else if ( type == typeid(Bool_t)    ) return "Bool_t";
+  else if ( type == typeid(Short_t)   ) return "Short_t";
+  else if ( type == typeid(UShort_t)  ) return "UShort_t";
+  else if ( type == typeid(Int_t)     ) return "Int_t";
+  else if ( type == typeid(UInt_t)    ) return "UInt_t";
+  else if ( type == typeid(Float_t)   ) return "Float_t";
+  else if ( type == typeid(Long64_t)  ) return "Long64_t";
+  else if ( type == typeid(ULong64_t) ) return "ULong64_t";
+  else if ( type == typeid(Double_t)  ) return "Double_t";
+  else return "";
+}
+
+//-------------------------------------------------------------------------------
+ColumnarCacheWriter::ColumnarCacheWriter(const std::string& fileName, int blockSize)
+  : fileName_(fileName)
+  , blockSize_(blockSize)
+  , numEntries_(0)
+  , numEntries_block_(0)
+  , isClosed_(false)
+{
+  if ( blockSize_ <= 0 )
+    throw cms::Exception("ColumnarCacheWriter")
+      << "Invalid block size = " << blockSize_ << " !!\n";
+  file_.open(fileName_.data(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if ( !file_.good() )
+    throw cms::Exception("ColumnarCacheWriter")
+      << "Failed to open output file = " << fileName_ << " !!\n";
+  file_.write(magic, magicSize);
+  writeLong64(file_, 0); // CV: offset of footer, set when closing the file
+}
+
+ColumnarCacheWriter::~ColumnarCacheWriter()
+{
+  if ( !isClosed_ ) close();
+}
+
+void ColumnarCacheWriter::addColumn(const std::string& name, const std::string& type, const std::string& countColumnName, int length)
+{
+  if ( numEntries_ > 0 )
+    throw cms::Exception("ColumnarCacheWriter")
+      << "Cannot add column = " << name << " after entries have been written !!\n";
+  if ( columnIndices_.find(name) != columnIndices_.end() )
+    throw cms::Exception("ColumnarCacheWriter")
+      << "Column = " << name << " has already been added !!\n";
+  ColumnarCacheColumn column;
+  column.name_ = name;
+  column.type_ = type;
+  column.elementSize_ = getColumnarCacheTypeSize(type);
+  if ( column.elementSize_ <= 0 )
+    throw cms::Exception("ColumnarCacheWriter")
+      << "Type = " << type << " of column = " << name << " is not supported !!\n";
+  column.countColumn_ = -1;
+  if ( countColumnName != "" ) {
+    column.countColumn_ = getColumn(countColumnName);
+    if ( column.countColumn_ == -1 )
+      throw cms::Exception("ColumnarCacheWriter")
+	<< "Column = " << countColumnName << " holding number of elements of column = " << name << " needs to be added first !!\n";
+  }
+  column.length_ = length;
+  columnIndices_[name] = columns_.size();
+  columns_.push_back(column);
+  blockData_.push_back(std::vector<char>());
+}
+
+int ColumnarCacheWriter::getColumn(const std::string& name) const
+{
+  std::map<std::string, int>::const_iterator column = columnIndices_.find(name);
+  return ( column != columnIndices_.end() ) ? column->second : -1;
+}
+
+void ColumnarCacheWriter::fill(const std::vector<const void*>& data)
+{
+  assert(data.size() == columns_.size());
+  size_t numColumns = columns_.size();
+  for ( size_t idxColumn = 0; idxColumn < numColumns; ++idxColumn ) {
+    const ColumnarCacheColumn& column = columns_[idxColumn];
+    Long64_t numElements = ( column.countColumn_ >= 0 ) ?
+      getCount(data[column.countColumn_], columns_[column.countColumn_].type_) : column.length_;
+    const char* columnData = static_cast<const char*>(data[idxColumn]);
+    blockData_[idxColumn].insert(blockData_[idxColumn].end(), columnData, columnData + numElements*column.elementSize_);
+  }
+  ++numEntries_;
+  ++numEntries_block_;
+  if ( numEntries_block_ >= blockSize_ ) writeBlock();
+}
+
+void ColumnarCacheWriter::writeBlock()
+{
+  if ( numEntries_block_ == 0 ) return;
+  ColumnarCacheBlock block;
+  block.firstEntry_ = numEntries_ - numEntries_block_;
+  block.numEntries_ = numEntries_block_;
+  size_t numColumns = columns_.size();
+  for ( size_t idxColumn = 0; idxColumn < numColumns; ++idxColumn ) {
+    Long64_t offset = file_.tellp();
+    if ( (offset % alignment) != 0 ) {
+      std::vector<char> padding(alignment - (offset % alignment), 0);
+      file_.write(padding.data(), padding.size());
+      offset = file_.tellp();
+    }
+    block.offsets_.push_back(offset);
+    file_.write(blockData_[idxColumn].data(), blockData_[idxColumn].size());
+    blockData_[idxColumn].clear();
+  }
+  blocks_.push_back(block);
+  numEntries_block_ = 0;
+}
+
+void ColumnarCacheWriter::close()
+{
+  if ( isClosed_ ) return;
+  writeBlock();
+  Long64_t footerOffset = file_.tellp();
+  writeLong64(file_, numEntries_);
+  writeInt(file_, columns_.size());
+  for ( std::vector<ColumnarCacheColumn>::const_iterator column = columns_.begin();
+	column != columns_.end(); ++column ) {
+    writeString(file_, column->name_);
+    writeString(file_, column->type_);
+    writeInt(file_, column->countColumn_);
+    writeInt(file_, column->length_);
+  }
+  writeInt(file_, blocks_.size());
+  for ( std::vector<ColumnarCacheBlock>::const_iterator block = blocks_.begin();
+	block != blocks_.end(); ++block ) {
+    writeLong64(file_, block->firstEntry_);
+    writeLong64(file_, block->numEntries_);
+    for ( std::vector<Long64_t>::const_iterator offset = block->offsets_.begin();
+	  offset != block->offsets_.end(); ++offset ) {
+      writeLong64(file_, *offset);
+    }
+  }
+  file_.seekp(magicSize);
+  writeLong64(file_, footerOffset);
+  file_.close();
+  if ( file_.fail() )
+    throw cms::Exception("ColumnarCacheWriter")
+      << "Failed to write output file = " << fileName_ << " !!\n";
+  isClosed_ = true;
+}
+
+//-------------------------------------------------------------------------------
+ColumnarCacheReader::ColumnarCacheReader(const std::vector<std::string>& fileNames)
+  : numEntries_(0)
+  , currentFile_(-1)
+  , currentBlock_(-1)
+  , localEntry_(-1)
+{
+  if ( fileNames.empty() )
+    throw cms::Exception("ColumnarCacheReader")
+      << "No input files given !!\n";
+  for ( std::vector<std::string>::const_iterator fileName = fileNames.begin();
+	fileName != fileNames.end(); ++fileName ) {
+    openFile(*fileName);
+  }
+}
+
+ColumnarCacheReader::~ColumnarCacheReader()
+{
+  for ( std::vector<fileEntryType>::iterator file = files_.begin();
+	file != files_.end(); ++file ) {
+    munmap(file->data_, file->size_);
+    ::close(file->fd_);
+  }
+}
+
+void ColumnarCacheReader::openFile(const std::string& fileName)
+{
+  fileEntryType file;
+  file.fileName_ = fileName;
+  file.fd_ = ::open(fileName.data(), O_RDONLY);
+  if ( file.fd_ < 0 )
+    throw cms::Exception("ColumnarCacheReader")
+      << "Failed to open input file = " << fileName << " !!\n";
+  struct stat fileStatus;
+  if ( fstat(file.fd_, &fileStatus) != 0 || fileStatus.st_size < (off_t)(magicSize + sizeof(Long64_t)) ) {
+    ::close(file.fd_);
+    throw cms::Exception("ColumnarCacheReader")
+      << "Input file = " << fileName << " is not in columnar cache format !!\n";
+  }
+  file.size_ = fileStatus.st_size;
+  void* data = mmap(0, file.size_, PROT_READ, MAP_SHARED, file.fd_, 0);
+  if ( data == MAP_FAILED ) {
+    ::close(file.fd_);
+    throw cms::Exception("ColumnarCacheReader")
+      << "Failed to map input file = " << fileName << " into memory !!\n";
+  }
+  file.data_ = static_cast<char*>(data);
+  madvise(file.data_, file.size_, MADV_SEQUENTIAL);
+  if ( std::strncmp(file.data_, magic, magicSize) != 0 ) {
+    munmap(file.data_, file.size_);
+    ::close(file.fd_);
+    throw cms::Exception("ColumnarCacheReader")
+      << "Input file = " << fileName << " is not in columnar cache format !!\n";
+  }
+  file.firstEntry_ = numEntries_;
+  try {
+    readFooter(file);
+  } catch ( ... ) {
+    munmap(file.data_, file.size_);
+    ::close(file.fd_);
+    throw;
+  }
+  files_.push_back(file);
+  firstEntries_files_.push_back(file.firstEntry_);
+  numEntries_ += file.numEntries_;
+}
+
+void ColumnarCacheReader::readFooter(fileEntryType& file)
+{
+  const std::string& fileName = file.fileName_;
+  const Long64_t headerSize = magicSize + sizeof(Long64_t);
+  Long64_t footerOffset;
+  std::memcpy(&footerOffset, file.data_ + magicSize, sizeof(Long64_t));
+  if ( footerOffset < headerSize || footerOffset > (Long64_t)file.size_ )
+    throw cms::Exception("ColumnarCacheReader")
+      << "Invalid offset of footer = " << footerOffset << " in input file = " << fileName << " (file size = " << file.size_ << ") !!\n";
+  footerReader footer(file.data_, file.size_, footerOffset, fileName);
+  file.numEntries_ = footer.read<Long64_t>();
+  if ( file.numEntries_ < 0 )
+    throw cms::Exception("ColumnarCacheReader")
+      << "Invalid number of entries = " << file.numEntries_ << " in input file = " << fileName << " !!\n";
+  Int_t numColumns = footer.read<Int_t>();
+  if ( numColumns < 0 )
+    throw cms::Exception("ColumnarCacheReader")
+      << "Invalid number of columns = " << numColumns << " in input file = " << fileName << " !!\n";
+  std::vector<ColumnarCacheColumn> columns;
+  for ( Int_t idxColumn = 0; idxColumn < numColumns; ++idxColumn ) {
+    ColumnarCacheColumn column;
+    column.name_ = footer.readString();
+    column.type_ = footer.readString();
+    column.elementSize_ = getColumnarCacheTypeSize(column.type_);
+    if ( column.elementSize_ <= 0 )
+      throw cms::Exception("ColumnarCacheReader")
+	<< "Type = " << column.type_ << " of column = " << column.name_ << " in input file = " << fileName << " is not supported !!\n";
+    column.countColumn_ = footer.read<Int_t>();
+    // CV: the writer requires the column holding the number of elements to be added before the variable-size array
+    if ( column.countColumn_ < -1 || column.countColumn_ >= idxColumn )
+      throw cms::Exception("ColumnarCacheReader")
+	<< "Invalid index = " << column.countColumn_ << " of column holding number of elements of column = " << column.name_ << " in input file = " << fileName << " !!\n";
+    if ( column.countColumn_ >= 0 && (columns[column.countColumn_].countColumn_ != -1 || columns[column.countColumn_].length_ < 1) )
+      throw cms::Exception("ColumnarCacheReader")
+	<< "Column = " << columns[column.countColumn_].name_ << " in input file = " << fileName << " cannot hold number of elements of column = " << column.name_ << " !!\n";
+    column.length_ = footer.read<Int_t>();
+    if ( column.countColumn_ == -1 && column.length_ < 0 )
+      throw cms::Exception("ColumnarCacheReader")
+	<< "Invalid number of elements = " << column.length_ << " of column = " << column.name_ << " in input file = " << fileName << " !!\n";
+    columns.push_back(column);
+  }
+  if ( files_.empty() ) {
+    columns_ = columns;
+    isCountColumn_.assign(columns_.size(), false);
+    for ( size_t idxColumn = 0; idxColumn < columns_.size(); ++idxColumn ) {
+      columnIndices_[columns_[idxColumn].name_] = idxColumn;
+      if ( columns_[idxColumn].countColumn_ >= 0 ) isCountColumn_[columns_[idxColumn].countColumn_] = true;
+    }
+    elementOffsets_.resize(columns_.size());
+  } else {
+    bool isCompatible = ( columns.size() == columns_.size() );
+    for ( size_t idxColumn = 0; isCompatible && idxColumn < columns.size(); ++idxColumn ) {
+      if ( columns[idxColumn].name_        != columns_[idxColumn].name_        ||
+	   columns[idxColumn].type_        != columns_[idxColumn].type_        ||
+	   columns[idxColumn].countColumn_ != columns_[idxColumn].countColumn_ ||
+	   columns[idxColumn].length_      != columns_[idxColumn].length_      ) isCompatible = false;
+    }
+    if ( !isCompatible )
+      throw cms::Exception("ColumnarCacheReader")
+	<< "Columns of input file = " << fileName << " do not match columns of input file = " << files_.front().fileName_ << " !!\n";
+  }
+  Int_t numBlocks = footer.read<Int_t>();
+  if ( numBlocks < 0 )
+    throw cms::Exception("ColumnarCacheReader")
+      << "Invalid number of blocks = " << numBlocks << " in input file = " << fileName << " !!\n";
+  Long64_t numEntries_blocks = 0;
+  std::vector<Long64_t> numElements(numColumns);
+  for ( Int_t idxBlock = 0; idxBlock < numBlocks; ++idxBlock ) {
+    ColumnarCacheBlock block;
+    block.firstEntry_ = footer.read<Long64_t>();
+    block.numEntries_ = footer.read<Long64_t>();
+    // CV: blocks need to be contiguous for the binary search in loadEntry
+    if ( block.firstEntry_ != numEntries_blocks || block.numEntries_ <= 0 || block.numEntries_ > (file.numEntries_ - numEntries_blocks) )
+      throw cms::Exception("ColumnarCacheReader")
+	<< "Invalid entries = " << block.firstEntry_ << ".." << (block.firstEntry_ + block.numEntries_) << " of block #" << idxBlock << " in input file = " << fileName << " !!\n";
+    for ( Int_t idxColumn = 0; idxColumn < numColumns; ++idxColumn ) {
+      const ColumnarCacheColumn& column = columns[idxColumn];
+      Long64_t offset = footer.read<Long64_t>();
+      if ( column.countColumn_ >= 0 ) {
+	const char* countData = file.data_ + block.offsets_[column.countColumn_];
+	int countSize = columns[column.countColumn_].elementSize_;
+	numElements[idxColumn] = 0;
+	for ( Long64_t idxEntry = 0; idxEntry < block.numEntries_; ++idxEntry ) {
+	  Long64_t count = getCount(countData + idxEntry*countSize, columns[column.countColumn_].type_);
+	  if ( count < 0 )
+	    throw cms::Exception("ColumnarCacheReader")
+	      << "Invalid number of elements = " << count << " of column = " << column.name_ << " in block #" << idxBlock << " of input file = " << fileName << " !!\n";
+	  numElements[idxColumn] += count;
+	}
+      } else {
+	numElements[idxColumn] = block.numEntries_*column.length_;
+      }
+      if ( offset < headerSize || offset > footerOffset || (offset % alignment) != 0 || numElements[idxColumn] > (footerOffset - offset)/column.elementSize_ )
+	throw cms::Exception("ColumnarCacheReader")
+	  << "Data of column = " << column.name_ << " in block #" << idxBlock << " exceeds range of input file = " << fileName << " !!\n";
+      block.offsets_.push_back(offset);
+    }
+    numEntries_blocks += block.numEntries_;
+    file.blocks_.push_back(block);
+    file.firstEntries_blocks_.push_back(block.firstEntry_);
+  }
+  if ( numEntries_blocks != file.numEntries_ )
+    throw cms::Exception("ColumnarCacheReader")
+      << "Blocks of input file = " << fileName << " contain " << numEntries_blocks << " entries, expected " << file.numEntries_ << " !!\n";
+}
+
+int ColumnarCacheReader::getColumn(const std::string& name) const
+{
+  std::map<std::string, int>::const_iterator column = columnIndices_.find(name);
+  return ( column != columnIndices_.end() ) ? column->second : -1;
+}
+
+namespace
+{
+  bool isBeforeFile(Long64_t entry, const Long64_t& firstEntry) { return entry < firstEntry; }
+}
+
+Int_t ColumnarCacheReader::loadEntry(Long64_t entry)
+{
+  if ( entry < 0 || entry >= numEntries_ ) return -1;
+  bool isInCurrentBlock = false;
+  if ( currentFile_ >= 0 && currentBlock_ >= 0 ) {
+    const fileEntryType& file = files_[currentFile_];
+    const ColumnarCacheBlock& block = file.blocks_[currentBlock_];
+    Long64_t firstEntry = file.firstEntry_ + block.firstEntry_;
+    if ( entry >= firstEntry && entry < (firstEntry + block.numEntries_) ) isInCurrentBlock = true;
+  }
+  if ( !isInCurrentBlock ) {
+    currentFile_ = std::upper_bound(firstEntries_files_.begin(), firstEntries_files_.end(), entry, isBeforeFile) - firstEntries_files_.begin() - 1;
+    const fileEntryType& file = files_[currentFile_];
+    currentBlock_ = std::upper_bound(file.firstEntries_blocks_.begin(), file.firstEntries_blocks_.end(), entry - file.firstEntry_, isBeforeFile) - file.firstEntries_blocks_.begin() - 1;
+    updateElementOffsets();
+  }
+  const fileEntryType& file = files_[currentFile_];
+  localEntry_ = entry - file.firstEntry_ - file.blocks_[currentBlock_].firstEntry_;
+  Int_t numBytes = 0;
+  for ( size_t idxColumn = 0; idxColumn < columns_.size(); ++idxColumn ) {
+    numBytes += getLength(idxColumn)*columns_[idxColumn].elementSize_;
+  }
+  return numBytes;
+}
+
+void ColumnarCacheReader::updateElementOffsets()
+{
+  const fileEntryType& file = files_[currentFile_];
+  const ColumnarCacheBlock& block = file.blocks_[currentBlock_];
+  for ( size_t idxColumn = 0; idxColumn < columns_.size(); ++idxColumn ) {
+    if ( !isCountColumn_[idxColumn] ) continue;
+    const ColumnarCacheColumn& column = columns_[idxColumn];
+    const char* data = file.data_ + block.offsets_[idxColumn];
+    std::vector<Long64_t>& elementOffsets = elementOffsets_[idxColumn];
+    elementOffsets.resize(block.numEntries_ + 1);
+    elementOffsets[0] = 0;
+    for ( Long64_t idxEntry = 0; idxEntry < block.numEntries_; ++idxEntry ) {
+      elementOffsets[idxEntry + 1] = elementOffsets[idxEntry] + getCount(data + idxEntry*column.elementSize_, column.type_);
+    }
+  }
+}
+
+const void* ColumnarCacheReader::getData(int column) const
+{
+  assert(currentFile_ >= 0 && currentBlock_ >= 0);
+  const ColumnarCacheColumn& descriptor = columns_[column];
+  const fileEntryType& file = files_[currentFile_];
+  const char* data = file.data_ + file.blocks_[currentBlock_].offsets_[column];
+  if ( descriptor.countColumn_ >= 0 ) return data + elementOffsets_[descriptor.countColumn_][localEntry_]*descriptor.elementSize_;
+  else return data + localEntry_*descriptor.length_*descriptor.elementSize_;
+}
+
+int ColumnarCacheReader::getLength(int column) const
+{
+  const ColumnarCacheColumn& descriptor = columns_[column];
+  if ( descriptor.countColumn_ >= 0 ) {
+    const std::vector<Long64_t>& elementOffsets = elementOffsets_[descriptor.countColumn_];
+    return elementOffsets[localEntry_ + 1] - elementOffsets[localEntry_];
+  } else {
+    return descriptor.length_;
+  }
+}
+
+double ColumnarCacheReader::getValue(int column) const
+{
+  const std::string& type = columns_[column].type_;
+  const void* data = getData(column);
+  if      ( type == "Float_t"  ) return *static_cast<const Float_t*>(data);
+  else if ( type == "Double_t" ) return *static_cast<const Double_t*>(data);
+  else if ( type == "Bool_t"   ) return *static_cast<const Bool_t*>(data);
+  else return getCount(data, type);
+}
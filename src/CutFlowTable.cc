@@ -0,0 +1,235 @@
+#include "tthAnalysis/HiggsToTauTau/interface/CutFlowTable.h"
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <algorithm> // std::stable_sort, std::max
+#include <iomanip> // std::setw, std::setprecision
+
+void CutFlowTable::Counter::add(const Counter& other)
+{
+  numEvaluated_ += other.numEvaluated_;
+  numPassed_ += other.numPassed_;
+  numPassed_weighted_ += other.numPassed_weighted_;
+  time_ += other.time_;
+}
+
+CutFlowTable::CutFlowTable(const std::string& name)
+  : name_(name)
+  , active_(true)
+  , lastTime_(Clock::now())
+{}
+
+int CutFlowTable::addCut(const std::string& label)
+{
+  cuts_.push_back(Counter(label));
+  idxCutGroups_.push_back(-1);
+  return cuts_.size() - 1;
+}
+
+int CutFlowTable::addCutGroup(const std::string& label, unsigned reorderInterval)
+{
+  cuts_.push_back(Counter(label));
+  idxCutGroups_.push_back(cutGroups_.size());
+  cutGroups_.push_back(CutGroup(reorderInterval));
+  return cuts_.size() - 1;
+}
+
+void CutFlowTable::addCut(int idxCutGroup, const std::string& label, const CutFunction& cut)
+{
+  if ( !(idxCutGroup >= 0 && idxCutGroup < (int)cuts_.size() && idxCutGroups_[idxCutGroup] != -1) )
+    throw cms::Exception("CutFlowTable")
+      << "Invalid index of cut group = " << idxCutGroup << " given for cut = '" << label << "' of table = '" << name_ << "' !!\n";
+  CutGroup& cutGroup = cutGroups_[idxCutGroups_[idxCutGroup]];
+  cutGroup.order_.push_back(cutGroup.counters_.size());
+  cutGroup.counters_.push_back(Counter(label));
+  cutGroup.cutFunctions_.push_back(cut);
+}
+
+void CutFlowTable::startEvent()
+{
+  active_ = true;
+  lastTime_ = Clock::now();
+}
+
+bool CutFlowTable::operator()(int idxCut, bool passes, double evtWeight)
+{
+  if ( !active_ ) return passes;
+  if ( idxCutGroups_[idxCut] != -1 )
+    throw cms::Exception("CutFlowTable")
+      << "Cut = '" << cuts_[idxCut].label_ << "' of table = '" << name_ << "' is a group of cuts, use passesCutGroup function to apply it !!\n";
+  Clock::time_point time = Clock::now();
+  Counter& cut = cuts_[idxCut];
+  ++cut.numEvaluated_;
+  if ( passes ) {
+    ++cut.numPassed_;
+    cut.numPassed_weighted_ += evtWeight;
+  }
+  cut.time_ += time - lastTime_;
+  lastTime_ = time;
+  return passes;
+}
+
+bool CutFlowTable::passesCutGroup(int idxCutGroup, double evtWeight)
+{
+  if ( idxCutGroups_[idxCutGroup] == -1 )
+    throw cms::Exception("CutFlowTable")
+      << "Cut = '" << cuts_[idxCutGroup].label_ << "' of table = '" << name_ << "' is not a group of cuts !!\n";
+  CutGroup& cutGroup = cutGroups_[idxCutGroups_[idxCutGroup]];
+  if ( !active_ ) {
+    for ( std::vector<int>::const_iterator idxCut = cutGroup.order_.begin();
+	  idxCut != cutGroup.order_.end(); ++idxCut ) {
+      if ( !cutGroup.cutFunctions_[*idxCut]() ) return false;
+    }
+    return true;
+  }
+  bool passes = true;
+  Clock::time_point time = Clock::now();
+  for ( std::vector<int>::const_iterator idxCut = cutGroup.order_.begin();
+	idxCut != cutGroup.order_.end(); ++idxCut ) {
+    bool passes_cut = cutGroup.cutFunctions_[*idxCut]();
+    Clock::time_point time_cut = Clock::now();
+    Counter& cut = cutGroup.counters_[*idxCut];
+    ++cut.numEvaluated_;
+    cut.time_ += time_cut - time;
+    time = time_cut;
+    if ( passes_cut ) {
+      ++cut.numPassed_;
+      cut.numPassed_weighted_ += evtWeight;
+    } else {
+      passes = false;
+      break;
+    }
+  }
+  Counter& group = cuts_[idxCutGroup];
+  ++group.numEvaluated_;
+  if ( passes ) {
+    ++group.numPassed_;
+    group.numPassed_weighted_ += evtWeight;
+  }
+  group.time_ += time - lastTime_;
+  lastTime_ = time;
+  if ( cutGroup.reorderInterval_ > 0 ) {
+    ++cutGroup.numEvaluated_sinceReorder_;
+    if ( cutGroup.numEvaluated_sinceReorder_ >= cutGroup.reorderInterval_ ) {
+      reorder(cutGroup);
+      cutGroup.numEvaluated_sinceReorder_ = 0;
+    }
+  }
+  return passes;
+}
+
+namespace
+{
+  /**
+   * @brief Number of rejected events per nanosecond of CPU time spent on evaluating the cut
+   *       (cuts that have not been evaluated yet are ranked first, so that their rejection gets measured)
+   */
+  double getRejectionPerTime(Long64_t numEvaluated, Long64_t numPassed, std::chrono::steady_clock::duration time)
+  {
+    if ( numEvaluated == 0 ) return 1.e+30;
+    double time_ns = std::chrono::duration<double, std::nano>(time).count();
+    if ( time_ns < 1. ) time_ns = 1.; // CV: protect against time measurements below the resolution of the clock
+    return (numEvaluated - numPassed)/time_ns;
+  }
+}
+
+void CutFlowTable::reorder(CutGroup& cutGroup)
+{
+  std::vector<double> rejectionPerTime;
+  for ( std::vector<Counter>::const_iterator cut = cutGroup.counters_.begin();
+	cut != cutGroup.counters_.end(); ++cut ) {
+    rejectionPerTime.push_back(getRejectionPerTime(cut->numEvaluated_, cut->numPassed_, cut->time_));
+  }
+  std::stable_sort(cutGroup.order_.begin(), cutGroup.order_.end(),
+    [&rejectionPerTime](int idxCut1, int idxCut2) { return rejectionPerTime[idxCut1] > rejectionPerTime[idxCut2]; });
+}
+
+void CutFlowTable::merge(const CutFlowTable& other)
+{
+  bool isCompatible = ( cuts_.size() == other.cuts_.size() && cutGroups_.size() == other.cutGroups_.size() );
+  for ( size_t idxCut = 0; idxCut < cuts_.size() && isCompatible; ++idxCut ) {
+    if ( cuts_[idxCut].label_ != other.cuts_[idxCut].label_ ) isCompatible = false;
+  }
+  for ( size_t idxCutGroup = 0; idxCutGroup < cutGroups_.size() && isCompatible; ++idxCutGroup ) {
+    if ( cutGroups_[idxCutGroup].counters_.size() != other.cutGroups_[idxCutGroup].counters_.size() ) isCompatible = false;
+  }
+  if ( !isCompatible )
+    throw cms::Exception("CutFlowTable")
+      << "Cannot merge table = '" << other.name_ << "' into table = '" << name_ << "', because they contain different cuts !!\n";
+  for ( size_t idxCut = 0; idxCut < cuts_.size(); ++idxCut ) {
+    cuts_[idxCut].add(other.cuts_[idxCut]);
+  }
+  for ( size_t idxCutGroup = 0; idxCutGroup < cutGroups_.size(); ++idxCutGroup ) {
+    for ( size_t idxCut = 0; idxCut < cutGroups_[idxCutGroup].counters_.size(); ++idxCut ) {
+      cutGroups_[idxCutGroup].counters_[idxCut].add(other.cutGroups_[idxCutGroup].counters_[idxCut]);
+    }
+  }
+}
+
+namespace
+{
+  void printRow(std::ostream& stream, const std::string& label, Long64_t numEvaluated, Long64_t numPassed, double numPassed_weighted,
+		std::chrono::steady_clock::duration time)
+  {
+    double time_us = std::chrono::duration<double, std::micro>(time).count();
+    stream << " " << std::setw(48) << std::left << label << std::right
+	   << std::setw(12) << numPassed << " (" << std::setw(5) << std::setprecision(3) << 100.*numPassed/std::max(numEvaluated, (Long64_t)1) << "%)"
+	   << std::setw(14) << std::setprecision(6) << numPassed_weighted
+	   << std::setw(12) << std::setprecision(3) << time_us/std::max(numEvaluated, (Long64_t)1) << std::endl;
+  }
+}
+
+void CutFlowTable::print(std::ostream& stream) const
+{
+  std::streamsize precision = stream.precision();
+  stream << "<CutFlowTable::print>: " << name_ << std::endl;
+  stream << " " << std::setw(48) << std::left << "cut" << std::right
+	 << std::setw(21) << "passed (eff.)" << std::setw(14) << "weighted" << std::setw(12) << "time [us]" << std::endl;
+  for ( size_t idxCut = 0; idxCut < cuts_.size(); ++idxCut ) {
+    const Counter& cut = cuts_[idxCut];
+    printRow(stream, cut.label_, cut.numEvaluated_, cut.numPassed_, cut.numPassed_weighted_, cut.time_);
+    if ( idxCutGroups_[idxCut] != -1 ) {
+      const CutGroup& cutGroup = cutGroups_[idxCutGroups_[idxCut]];
+      for ( std::vector<int>::const_iterator idxCut_group = cutGroup.order_.begin();
+	    idxCut_group != cutGroup.order_.end(); ++idxCut_group ) {
+	const Counter& cut_group = cutGroup.counters_[*idxCut_group];
+	printRow(stream, "  " + cut_group.label_, cut_group.numEvaluated_, cut_group.numPassed_, cut_group.numPassed_weighted_, cut_group.time_);
+      }
+    }
+  }
+  stream.precision(precision);
+}
+
+void CutFlowTable::writeHeader(std::ostream& stream)
+{
+  stream << "table;cut;group;position;numEvaluated;numPassed;numPassed_weighted;time" << std::endl;
+}
+
+namespace
+{
+  void writeRow(std::ostream& stream, const std::string& table, const std::string& label, const std::string& group, int position,
+		Long64_t numEvaluated, Long64_t numPassed, double numPassed_weighted, std::chrono::steady_clock::duration time)
+  {
+    stream << table << ";" << label << ";" << group << ";" << position << ";"
+	   << numEvaluated << ";" << numPassed << ";" << std::setprecision(12) << numPassed_weighted << ";"
+	   << std::setprecision(6) << std::chrono::duration<double>(time).count() << std::endl;
+  }
+}
+
+void CutFlowTable::write(std::ostream& stream) const
+{
+  std::streamsize precision = stream.precision();
+  for ( size_t idxCut = 0; idxCut < cuts_.size(); ++idxCut ) {
+    const Counter& cut = cuts_[idxCut];
+    writeRow(stream, name_, cut.label_, "", idxCut, cut.numEvaluated_, cut.numPassed_, cut.numPassed_weighted_, cut.time_);
+    if ( idxCutGroups_[idxCut] != -1 ) {
+      const CutGroup& cutGroup = cutGroups_[idxCutGroups_[idxCut]];
+      for ( size_t position = 0; position < cutGroup.order_.size(); ++position ) {
+	const Counter& cut_group = cutGroup.counters_[cutGroup.order_[position]];
+	writeRow(stream, name_, cut_group.label_, cut.label_, position,
+		 cut_group.numEvaluated_, cut_group.numPassed_, cut_group.numPassed_weighted_, cut_group.time_);
+      }
+    }
+  }
+  stream.precision(precision);
+}
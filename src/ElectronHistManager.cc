@@ -38,7 +38,7 @@ void ElectronHistManager::bookHistograms(TFileDirectory& dir)
   histogram_gen_times_recCharge_ = book1D(dir, "gen_times_recCharge", "gen_times_recCharge", 3, -1.5, +1.5);
 }
 
-void ElectronHistManager::fillHistograms(const std::vector<const RecoElectron*>& electron_ptrs, double evtWeight)
+void ElectronHistManager::fillHistograms(const std::vector<const RecoElectron*>& electron_ptrs, const GenMatchTable& genMatchTable, double evtWeight)
 {
   double evtWeightErr = 0.;
   
@@ -70,14 +70,15 @@ void ElectronHistManager::fillHistograms(const std::vector<const RecoElectron*>&
     fillWithOverFlow(histogram_nLostHits_, electron->nLostHits_, evtWeight, evtWeightErr);
     fillWithOverFlow(histogram_passesConversionVeto_, electron->passesConversionVeto_, evtWeight, evtWeightErr);
 
+    const GenMatch& genMatch = genMatchTable.getGenMatch(*electron);
     int abs_genPdgId = 0;
-    if      ( electron->genLepton_ ) abs_genPdgId = std::abs(electron->genLepton_->pdgId_); // generator level match to electron or muon
-    else if ( electron->genHadTau_ ) abs_genPdgId = 15;                                     // generator level match to hadronic tau decay 
-    else if ( electron->genJet_    ) abs_genPdgId = 21;                                     // generator level match to jet; fill histogram with pdgId of gluon
-    else                             abs_genPdgId = 0;                                      // no match to any generator level particle (reconstructed electron most likely due to pileup)
+    if      ( genMatch.genLepton_ ) abs_genPdgId = std::abs(genMatch.genLepton_->pdgId_); // generator level match to electron or muon
+    else if ( genMatch.genHadTau_ ) abs_genPdgId = 15;                                    // generator level match to hadronic tau decay 
+    else if ( genMatch.genJet_    ) abs_genPdgId = 21;                                    // generator level match to jet; fill histogram with pdgId of gluon
+    else                            abs_genPdgId = 0;                                     // no match to any generator level particle (reconstructed electron most likely due to pileup)
     fillWithOverFlow(histogram_abs_genPdgId_, abs_genPdgId, evtWeight, evtWeightErr);
     if ( abs_genPdgId == 11 ) {
-      fillWithOverFlow(histogram_gen_times_recCharge_, electron->charge_*electron->genLepton_->charge_, evtWeight, evtWeightErr);
+      fillWithOverFlow(histogram_gen_times_recCharge_, electron->charge_*genMatch.genLepton_->charge_, evtWeight, evtWeightErr);
     }
   }
 }
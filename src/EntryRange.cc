@@ -0,0 +1,87 @@
+#include "tthAnalysis/HiggsToTauTau/interface/EntryRange.h"
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <TFile.h> // TFile
+#include <TTree.h> // TTree
+#include <TObjArray.h> // TObjArray
+
+#include <algorithm> // std::lower_bound, std::min, std::max
+#include <memory> // std::unique_ptr<>
+#include <string> // std::string
+
+EntryRange::EntryRange(const edm::ParameterSet& cfg_input, Long64_t numEntries)
+  : firstEntry_(0)
+  , lastEntry_(numEntries)
+{
+  if ( cfg_input.exists("firstEntry") ) firstEntry_ = cfg_input.getParameter<long long>("firstEntry");
+  if ( cfg_input.exists("lastEntry") ) {
+    Long64_t lastEntry = cfg_input.getParameter<long long>("lastEntry");
+    if ( lastEntry != -1 ) lastEntry_ = lastEntry;
+  }
+  if ( firstEntry_ < 0 || firstEntry_ > numEntries ) 
+    throw cms::Exception("EntryRange") 
+      << "Invalid Configuration parameter 'firstEntry' = " << firstEntry_ << ", input contains " << numEntries << " entries !!\n";
+  if ( lastEntry_ < firstEntry_ || lastEntry_ > numEntries ) 
+    throw cms::Exception("EntryRange") 
+      << "Invalid Configuration parameter 'lastEntry' = " << lastEntry_ << ", input contains " << numEntries << " entries !!\n";
+}
+
+EntryRange::EntryRange(Long64_t firstEntry, Long64_t lastEntry)
+  : firstEntry_(firstEntry)
+  , lastEntry_(lastEntry)
+{
+  if ( firstEntry_ < 0 || lastEntry_ < firstEntry_ ) 
+    throw cms::Exception("EntryRange") 
+      << "Invalid range of entries = [" << firstEntry_ << ", " << lastEntry_ << ") !!\n";
+}
+
+std::vector<Long64_t> getClusterBoundaries(TChain* inputTree)
+{
+  std::vector<Long64_t> clusterBoundaries;
+  Long64_t chainOffset = 0;
+  TObjArray* inputFiles = inputTree->GetListOfFiles();
+  for ( int idxInputFile = 0; idxInputFile < inputFiles->GetEntries(); ++idxInputFile ) {
+    // CV: TChain::AddFile stores the file names as titles of TChainElement objects
+    std::string inputFileName = inputFiles->At(idxInputFile)->GetTitle();
+    std::unique_ptr<TFile> inputFile(TFile::Open(inputFileName.data()));
+    if ( !inputFile || inputFile->IsZombie() )
+      throw cms::Exception("getClusterBoundaries") 
+	<< "Failed to open input file = " << inputFileName << " !!\n";
+    TTree* tree = dynamic_cast<TTree*>(inputFile->Get(inputTree->GetName()));
+    if ( !tree )
+      throw cms::Exception("getClusterBoundaries") 
+	<< "Failed to find tree = " << inputTree->GetName() << " in input file = " << inputFileName << " !!\n";
+    Long64_t numEntries = tree->GetEntries();
+    TTree::TClusterIterator cluster = tree->GetClusterIterator(0);
+    Long64_t clusterStart;
+    while ( (clusterStart = cluster.Next()) < numEntries ) {
+      clusterBoundaries.push_back(chainOffset + clusterStart);
+    }
+    chainOffset += numEntries;
+  }
+  clusterBoundaries.push_back(chainOffset);
+  return clusterBoundaries;
+}
+
+std::vector<EntryRange> splitEntryRange(const EntryRange& entryRange, int numRanges, const std::vector<Long64_t>& clusterBoundaries)
+{
+  if ( numRanges < 1 )
+    throw cms::Exception("splitEntryRange") 
+      << "Invalid number of ranges = " << numRanges << " !!\n";
+  std::vector<EntryRange> entryRanges;
+  Long64_t firstEntry = entryRange.firstEntry();
+  for ( int idxRange = 0; idxRange < numRanges; ++idxRange ) {
+    Long64_t lastEntry = entryRange.lastEntry();
+    if ( idxRange < (numRanges - 1) ) {
+      lastEntry = entryRange.firstEntry() + (entryRange.size()*(idxRange + 1))/numRanges;
+      // CV: move boundary to start of next cluster
+      std::vector<Long64_t>::const_iterator clusterBoundary = std::lower_bound(clusterBoundaries.begin(), clusterBoundaries.end(), lastEntry);
+      if ( clusterBoundary != clusterBoundaries.end() ) lastEntry = std::min(*clusterBoundary, entryRange.lastEntry());
+      lastEntry = std::max(lastEntry, firstEntry);
+    }
+    entryRanges.push_back(EntryRange(firstEntry, lastEntry));
+    firstEntry = lastEntry;
+  }
+  return entryRanges;
+}
@@ -0,0 +1,142 @@
+#include "tthAnalysis/HiggsToTauTau/interface/EventSource.h"
+
+#include <TLeaf.h> // TLeaf
+
+#include <algorithm> // std::max
+#include <cstring> // std::memcpy
+
+EventSource::EventSource(TTree* tree)
+  : tree_(tree)
+  , cache_(0)
+  , notifier_(0)
+{
+  if ( !tree_ ) 
+    throw cms::Exception("EventSource") 
+      << "Invalid tree !!\n";
+  notifier_ = new fileSwitchNotifier(this, tree_->GetNotify());
+  tree_->SetNotify(notifier_);
+}
+
+EventSource::EventSource(ColumnarCacheReader* cache)
+  : tree_(0)
+  , cache_(cache)
+  , notifier_(0)
+{
+  if ( !cache_ ) 
+    throw cms::Exception("EventSource") 
+      << "Invalid columnar cache !!\n";
+}
+
+EventSource::~EventSource()
+{
+  if ( notifier_ ) {
+    if ( tree_->GetNotify() == notifier_ ) tree_->SetNotify(notifier_->previousNotify_);
+    delete notifier_;
+  }
+}
+
+void EventSource::checkUnique(const std::string& branchName) const
+{
+  if ( buffers_.find(branchName) != buffers_.end() || externalBranchNames_.find(branchName) != externalBranchNames_.end() ) 
+    throw cms::Exception("EventSource") 
+      << "Branch address for branch = " << branchName << " has already been set !!\n";
+}
+
+int EventSource::getArraySize(const std::string& branchName) const
+{
+  if ( cache_ ) {
+    int column = cache_->getColumn(branchName);
+    if ( column == -1 ) 
+      throw cms::Exception("EventSource") 
+	<< "No column found for branch = " << branchName << " !!\n";
+    // CV: for variable-size arrays, the size of the buffer is set to the number of elements of the current entry by getEntry
+    const ColumnarCacheColumn& descriptor = cache_->getColumnDescriptor(column);
+    return ( descriptor.countColumn_ == -1 ) ? std::max(descriptor.length_, 1) : 1;
+  }
+  TLeaf* leaf = tree_->GetLeaf(branchName.data());
+  if ( !leaf ) 
+    throw cms::Exception("EventSource") 
+      << "No leaf found for branch = " << branchName << " !!\n";
+  // CV: for variable-size arrays, TLeaf::GetMaximum of the leaf holding the number of elements 
+  //     returns the largest number of elements stored in any entry of the current file
+  TLeaf* leafCount = leaf->GetLeafCount();
+  int size = ( leafCount ) ? leafCount->GetMaximum() : leaf->GetLenStatic();
+  return std::max(size, 1);
+}
+
+void EventSource::updateBufferSizes()
+{
+  if ( cache_ ) return;
+  for ( std::map<std::string, BranchBufferEntry>::iterator buffer = buffers_.begin();
+	buffer != buffers_.end(); ++buffer ) {
+    BranchBufferEntry& entry = buffer->second;
+    if ( !entry.isArray_ ) continue;
+    int size = getArraySize(buffer->first);
+    if ( size > entry.size_ ) {
+      entry.owner_ = entry.allocate_(size);
+      entry.data_ = entry.owner_.get();
+      entry.size_ = size;
+      tree_->SetBranchAddress(buffer->first.data(), entry.data_);
+    }
+  }
+}
+
+void EventSource::bindColumn(const std::string& branchName, const std::type_info& type, bool isArray, BranchBufferEntry* entry, void* address)
+{
+  int column = cache_->getColumn(branchName);
+  if ( column == -1 ) 
+    throw cms::Exception("EventSource") 
+      << "No column found for branch = " << branchName << " !!\n";
+  const ColumnarCacheColumn& descriptor = cache_->getColumnDescriptor(column);
+  if ( getColumnarCacheType(type) != descriptor.type_ ) 
+    throw cms::Exception("EventSource") 
+      << "Type requested for branch = " << branchName << " does not match type = " << descriptor.type_ << " of column !!\n";
+  if ( !isArray && (descriptor.countColumn_ != -1 || descriptor.length_ != 1) ) 
+    throw cms::Exception("EventSource") 
+      << "Branch = " << branchName << " holds an array, but is requested as single value !!\n";
+  columnBinding binding;
+  binding.column_ = column;
+  binding.entry_ = ( isArray ) ? entry : 0;
+  binding.address_ = ( isArray ) ? 0 : ( entry ) ? entry->data_ : address;
+  binding.numBytes_ = descriptor.elementSize_;
+  columnBindings_.push_back(binding);
+}
+
+Long64_t EventSource::getEntries() const
+{
+  if ( cache_ ) return cache_->getEntries();
+  else return tree_->GetEntries();
+}
+
+Int_t EventSource::getEntry(Long64_t entry)
+{
+  if ( !cache_ ) return tree_->GetEntry(entry);
+  Int_t numBytes = cache_->loadEntry(entry);
+  if ( numBytes < 0 ) return -1;
+  for ( std::vector<columnBinding>::iterator binding = columnBindings_.begin();
+	binding != columnBindings_.end(); ++binding ) {
+    if ( binding->entry_ ) {
+      // CV: readers access array buffers via BranchBuffer handles only, so the data does not need to be copied;
+      //     the memory is mapped read-only, as the buffers are never written to by the readers
+      binding->entry_->data_ = const_cast<void*>(cache_->getData(binding->column_));
+      binding->entry_->size_ = cache_->getLength(binding->column_);
+    } else {
+      std::memcpy(binding->address_, cache_->getData(binding->column_), binding->numBytes_);
+    }
+  }
+  return numBytes;
+}
+
+void EventSource::setBranchStatus() const
+{
+  if ( tree_ ) manifest_.setBranchStatus(tree_);
+}
+
+void EventSource::printManifest(std::ostream& stream) const
+{
+  if ( tree_ ) {
+    manifest_.print(tree_, stream);
+  } else {
+    stream << "reading " << manifest_.branchNames().size() << " out of " << cache_->getNumColumns() << " columns from columnar cache files." << std::endl;
+  }
+}
@@ -4,13 +4,10 @@
 
 #include <TString.h> // Form
 
-std::map<std::string, int> GenJetReader::numInstances_;
-std::map<std::string, GenJetReader*> GenJetReader::instances_;
-
 GenJetReader::GenJetReader()
-  : max_nJets_(32)
-  , branchName_num_("nGenJet")
+  : branchName_num_("nGenJet")
   , branchName_obj_("GenJet")
+  , nJets_(0)
   , jet_pt_(0)
   , jet_eta_(0)
   , jet_phi_(0)
@@ -20,9 +17,9 @@ GenJetReader::GenJetReader()
 }
 
 GenJetReader::GenJetReader(const std::string& branchName_num, const std::string& branchName_obj)
-  : max_nJets_(32)
-  , branchName_num_(branchName_num)
+  : branchName_num_(branchName_num)
   , branchName_obj_(branchName_obj)
+  , nJets_(0)
   , jet_pt_(0)
   , jet_eta_(0)
   , jet_phi_(0)
@@ -32,71 +29,46 @@ GenJetReader::GenJetReader(const std::string& branchName_num, const std::string&
 }
 
 GenJetReader::~GenJetReader()
-{
-  --numInstances_[branchName_obj_];
-  assert(numInstances_[branchName_obj_] >= 0);
-  if ( numInstances_[branchName_obj_] == 0 ) {
-    GenJetReader* gInstance = instances_[branchName_obj_];
-    assert(gInstance);
-    delete gInstance->jet_pt_;
-    delete gInstance->jet_eta_;
-    delete gInstance->jet_phi_;
-    delete gInstance->jet_mass_;
-    instances_[branchName_obj_] = 0;
-  }
-}
+{}
 
 void GenJetReader::setBranchNames()
 {
-  if ( numInstances_[branchName_obj_] == 0 ) {
-    branchName_pt_ = Form("%s_%s", branchName_obj_.data(), "pt");
-    branchName_eta_ = Form("%s_%s", branchName_obj_.data(), "eta");
-    branchName_phi_ = Form("%s_%s", branchName_obj_.data(), "phi");
-    branchName_mass_ = Form("%s_%s", branchName_obj_.data(), "mass");
-    instances_[branchName_obj_] = this;
-  } else {
-    if ( branchName_num_ != instances_[branchName_obj_]->branchName_num_ ) {
-      throw cms::Exception("GenJetReader") 
-	<< "Association between configuration parameters 'branchName_num' and 'branchName_obj' must be unique:"
-	<< " present association 'branchName_num' = " << branchName_num_ << " with 'branchName_obj' = " << branchName_obj_ 
-	<< " does not match previous association 'branchName_num' = " << instances_[branchName_obj_]->branchName_num_ << " with 'branchName_obj' = " << instances_[branchName_obj_]->branchName_obj_ << " !!\n";
-    }
-  }
-  ++numInstances_[branchName_obj_];
+  branchName_pt_ = Form("%s_%s", branchName_obj_.data(), "pt");
+  branchName_eta_ = Form("%s_%s", branchName_obj_.data(), "eta");
+  branchName_phi_ = Form("%s_%s", branchName_obj_.data(), "phi");
+  branchName_mass_ = Form("%s_%s", branchName_obj_.data(), "mass");
 }
 
-void GenJetReader::setBranchAddresses(TTree* tree)
+void GenJetReader::setBranchAddresses(EventSource& eventSource)
 {
-  if ( instances_[branchName_obj_] == this ) {
-    tree->SetBranchAddress(branchName_num_.data(), &nJets_);   
-    jet_pt_ = new Float_t[max_nJets_];
-    tree->SetBranchAddress(branchName_pt_.data(), jet_pt_); 
-    jet_eta_ = new Float_t[max_nJets_];
-    tree->SetBranchAddress(branchName_eta_.data(), jet_eta_); 
-    jet_phi_ = new Float_t[max_nJets_];
-    tree->SetBranchAddress(branchName_phi_.data(), jet_phi_); 
-    jet_mass_ = new Float_t[max_nJets_];
-    tree->SetBranchAddress(branchName_mass_.data(), jet_mass_); 
-  }
+  nJets_ = eventSource.getBuffer<Int_t>(branchName_num_);
+  jet_pt_ = eventSource.getArrayBuffer<Float_t>(branchName_pt_);
+  jet_eta_ = eventSource.getArrayBuffer<Float_t>(branchName_eta_);
+  jet_phi_ = eventSource.getArrayBuffer<Float_t>(branchName_phi_);
+  jet_mass_ = eventSource.getArrayBuffer<Float_t>(branchName_mass_);
 }
 
 std::vector<GenJet> GenJetReader::read() const
 {
-  GenJetReader* gInstance = instances_[branchName_obj_];
-  assert(gInstance);
   std::vector<GenJet> jets;
-  Int_t nJets = gInstance->nJets_;
-  if ( nJets > max_nJets_ ) {
+  read(jets);
+  return jets;
+}
+
+void GenJetReader::read(std::vector<GenJet>& jets) const
+{
+  Int_t nJets = (*nJets_);
+  if ( nJets > jet_pt_.size() ) {
     throw cms::Exception("GenJetReader") 
-      << "Number of jets stored in Ntuple = " << nJets << ", exceeds max_nJets = " << max_nJets_ << " !!\n";
+      << "Number of jets stored in Ntuple = " << nJets << ", exceeds size of branch buffers = " << jet_pt_.size() << " !!\n";
   }
+  jets.clear();
   jets.reserve(nJets);
   for ( Int_t idxJet = 0; idxJet < nJets; ++idxJet ) {
     jets.push_back(GenJet({ 
-      gInstance->jet_pt_[idxJet],
-      gInstance->jet_eta_[idxJet],
-      gInstance->jet_phi_[idxJet],
-      gInstance->jet_mass_[idxJet]}));
+      jet_pt_[idxJet],
+      jet_eta_[idxJet],
+      jet_phi_[idxJet],
+      jet_mass_[idxJet]}));
   }
-  return jets;
 }
@@ -0,0 +1,136 @@
+#include "tthAnalysis/HiggsToTauTau/interface/GenMatchTable.h"
+
+GenMatchTable::GenMatchTable(double dRmax_genLepton, double dRmax_genHadTau, double dRmax_genJet)
+  : dR2max_genLepton_(dRmax_genLepton*dRmax_genLepton)
+  , dR2max_genHadTau_(dRmax_genHadTau*dRmax_genHadTau)
+  , dR2max_genJet_(dRmax_genJet*dRmax_genJet)
+  , genLeptons_(0)
+  , genHadTaus_(0)
+  , genJets_(0)
+{}
+
+void GenMatchTable::clear()
+{
+  for ( int recType = 0; recType < kNumRecTypes; ++recType ) {
+    recMatches_[recType].begin_ = 0;
+    recMatches_[recType].numParticles_ = 0;
+    recMatches_[recType].genMatches_.clear();
+  }
+  genLeptons_ = 0;
+  genHadTaus_ = 0;
+  genJets_ = 0;
+  genParticles_etaPhi_.clear();
+  recParticles_etaPhi_.clear();
+  recParticles_type_.clear();
+  recParticles_idx_.clear();
+}
+
+void GenMatchTable::setGenParticles(const std::vector<GenLepton>& genLeptons, const std::vector<GenHadTau>& genHadTaus, const std::vector<GenJet>& genJets)
+{
+  genLeptons_ = &genLeptons;
+  genHadTaus_ = &genHadTaus;
+  genJets_ = &genJets;
+  // CV: store eta and phi of generator level electrons and muons, hadronic tau decays and jets in one array,
+  //     so that dR^2 to all of them is computed by a single call to the vectorized kernel
+  genParticles_etaPhi_.clear();
+  genParticles_etaPhi_.push_back(genLeptons);
+  genParticles_etaPhi_.push_back(genHadTaus);
+  genParticles_etaPhi_.push_back(genJets);
+}
+
+void GenMatchTable::addRecParticles(const std::vector<RecoMuon>& particles, const std::vector<const RecoMuon*>& recParticles)
+{
+  addRecParticles_impl(kMuon, particles, recParticles);
+}
+
+void GenMatchTable::addRecParticles(const std::vector<RecoElectron>& particles, const std::vector<const RecoElectron*>& recParticles)
+{
+  addRecParticles_impl(kElectron, particles, recParticles);
+}
+
+void GenMatchTable::addRecParticles(const std::vector<RecoHadTau>& particles, const std::vector<const RecoHadTau*>& recParticles)
+{
+  addRecParticles_impl(kHadTau, particles, recParticles);
+}
+
+void GenMatchTable::addRecParticles(const std::vector<RecoJet>& particles, const std::vector<const RecoJet*>& recParticles)
+{
+  addRecParticles_impl(kJet, particles, recParticles);
+}
+
+namespace
+{
+  /**
+   * @brief Return index of generator level particle with smallest dR^2 within given range of the dR^2 array
+   *        (-1 in case no generator level particle is within dR2max)
+   */
+  int findClosest(const float* dR2, size_t idxBegin, size_t idxEnd, double dR2max)
+  {
+    int idxClosest = -1;
+    float dR2_closest = dR2max;
+    for ( size_t idx = idxBegin; idx < idxEnd; ++idx ) {
+      if ( dR2[idx] < dR2_closest ) {
+	idxClosest = idx - idxBegin;
+	dR2_closest = dR2[idx];
+      }
+    }
+    return idxClosest;
+  }
+}
+
+void GenMatchTable::computeGenMatches()
+{
+  size_t numRecParticles = recParticles_etaPhi_.size();
+  size_t numGenParticles = genParticles_etaPhi_.size();
+  if ( numRecParticles > 0 && numGenParticles > 0 ) {
+    dR2_.resize(numRecParticles*numGenParticles);
+    comp_deltaR2_matrix(recParticles_etaPhi_.eta(), recParticles_etaPhi_.phi(), numRecParticles,
+			genParticles_etaPhi_.eta(), genParticles_etaPhi_.phi(), numGenParticles,
+			dR2_.data());
+    size_t numGenLeptons = genLeptons_->size();
+    size_t numGenHadTaus = genHadTaus_->size();
+    for ( size_t idxRecParticle = 0; idxRecParticle < numRecParticles; ++idxRecParticle ) {
+      const float* dR2_row = dR2_.data() + idxRecParticle*numGenParticles;
+      GenMatch& genMatch = recMatches_[recParticles_type_[idxRecParticle]].genMatches_[recParticles_idx_[idxRecParticle]];
+      int idxGenLepton = findClosest(dR2_row, 0, numGenLeptons, dR2max_genLepton_);
+      genMatch.genLepton_ = ( idxGenLepton != -1 ) ? &(*genLeptons_)[idxGenLepton] : 0;
+      int idxGenHadTau = findClosest(dR2_row, numGenLeptons, numGenLeptons + numGenHadTaus, dR2max_genHadTau_);
+      genMatch.genHadTau_ = ( idxGenHadTau != -1 ) ? &(*genHadTaus_)[idxGenHadTau] : 0;
+      int idxGenJet = findClosest(dR2_row, numGenLeptons + numGenHadTaus, numGenParticles, dR2max_genJet_);
+      genMatch.genJet_ = ( idxGenJet != -1 ) ? &(*genJets_)[idxGenJet] : 0;
+    }
+  }
+  recParticles_etaPhi_.clear();
+  recParticles_type_.clear();
+  recParticles_idx_.clear();
+}
+
+const GenMatch& GenMatchTable::getGenMatch(const RecoMuon& particle) const
+{
+  return getGenMatch_impl(kMuon, particle);
+}
+
+const GenMatch& GenMatchTable::getGenMatch(const RecoElectron& particle) const
+{
+  return getGenMatch_impl(kElectron, particle);
+}
+
+const GenMatch& GenMatchTable::getGenMatch(const RecoLepton& particle) const
+{
+  if ( particle.is_muon() ) {
+    return getGenMatch_impl(kMuon, static_cast<const RecoMuon&>(particle));
+  } else if ( particle.is_electron() ) {
+    return getGenMatch_impl(kElectron, static_cast<const RecoElectron&>(particle));
+  }
+  return noGenMatch_;
+}
+
+const GenMatch& GenMatchTable::getGenMatch(const RecoHadTau& particle) const
+{
+  return getGenMatch_impl(kHadTau, particle);
+}
+
+const GenMatch& GenMatchTable::getGenMatch(const RecoJet& particle) const
+{
+  return getGenMatch_impl(kJet, particle);
+}
@@ -1,6 +1,7 @@
 #include "tthAnalysis/HiggsToTauTau/interface/GenParticle.h" // GenParticle
 
 #include "DataFormats/Math/interface/deltaR.h" // deltaR
+#include "tthAnalysis/HiggsToTauTau/interface/deltaRKernels.h" // comp_deltaR2
 
 #include <cmath> // std::abs(), std::fabs(), std::sqrt(), std::pow()
 
@@ -14,7 +15,6 @@ GenParticle::GenParticle(Double_t pt,
   , mass_(mass)
 {
   absEta_ = std::fabs(eta_);
-  p4_ = math::PtEtaPhiMLorentzVector(pt_, eta_, phi_, mass_);
 }
 
 inline double
@@ -36,5 +36,5 @@ bool
 GenParticle::is_overlap(const GenParticle & other,
                         double dR_min) const
 {
-  return dR(other) < dR_min;
+  return comp_deltaR2(eta_, phi_, other.eta_, other.phi_) < dR_min*dR_min;
 }
@@ -30,7 +30,7 @@ void HadTauHistManager::bookHistograms(TFileDirectory& dir)
   histogram_abs_genPdgId_ = book1D(dir, "abs_genPdgId", "abs_genPdgId", 22, -0.5, +21.5);
 }
 
-void HadTauHistManager::fillHistograms(const std::vector<const RecoHadTau*>& hadTau_ptrs, double evtWeight)
+void HadTauHistManager::fillHistograms(const std::vector<const RecoHadTau*>& hadTau_ptrs, const GenMatchTable& genMatchTable, double evtWeight)
 {
   double evtWeightErr = 0.;
   
@@ -55,11 +55,12 @@ void HadTauHistManager::fillHistograms(const std::vector<const RecoHadTau*>& had
     fillWithOverFlow(histogram_antiElectron_, hadTau->antiElectron_, evtWeight, evtWeightErr);
     fillWithOverFlow(histogram_antiMuon_, hadTau->antiMuon_, evtWeight, evtWeightErr);
   
+    const GenMatch& genMatch = genMatchTable.getGenMatch(*hadTau);
     int abs_genPdgId = 0;
-    if      ( hadTau->genHadTau_ ) abs_genPdgId = 15;                                   // generator level match to hadronic tau decay 
-    else if ( hadTau->genLepton_ ) abs_genPdgId = std::abs(hadTau->genLepton_->pdgId_); // generator level match to electron or muon
-    else if ( hadTau->genJet_    ) abs_genPdgId = 21;                                   // generator level match to jet; fill histogram with pdgId of gluon
-    else                           abs_genPdgId = 0;                                    // no match to any generator level particle (reconstructed tauh most likely due to pileup)
+    if      ( genMatch.genHadTau_ ) abs_genPdgId = 15;                                    // generator level match to hadronic tau decay 
+    else if ( genMatch.genLepton_ ) abs_genPdgId = std::abs(genMatch.genLepton_->pdgId_); // generator level match to electron or muon
+    else if ( genMatch.genJet_    ) abs_genPdgId = 21;                                    // generator level match to jet; fill histogram with pdgId of gluon
+    else                            abs_genPdgId = 0;                                     // no match to any generator level particle (reconstructed tauh most likely due to pileup)
     fillWithOverFlow(histogram_abs_genPdgId_, abs_genPdgId, evtWeight, evtWeightErr);
   }
 }
@@ -1,56 +1,139 @@
 #include "tthAnalysis/HiggsToTauTau/interface/HistManagerBase.h"
 
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
 #include "tthAnalysis/HiggsToTauTau/interface/histogramAuxFunctions.h"
 
+#include <algorithm> // std::find
+
+std::vector<HistManagerBase*> HistManagerBase::instances_;
+
 HistManagerBase::HistManagerBase(const edm::ParameterSet& cfg)
 {
   process_ = cfg.getParameter<std::string>("process");
   category_ = cfg.getParameter<std::string>("category");
   central_or_shift_ = cfg.getParameter<std::string>("central_or_shift");
+  central_or_shifts_.push_back(central_or_shift_);
+  weights_shift_ = 0;
+  instances_.push_back(this);
 }
 
-TH1* HistManagerBase::book1D(TFileDirectory& dir,
-			     const std::string& distribution, const std::string& title, int numBins, double min, double max)
+HistManagerBase::~HistManagerBase()
+{
+  for ( std::vector<HistogramAccumulator*>::iterator accumulator = accumulators_.begin();
+	accumulator != accumulators_.end(); ++accumulator ) {
+    delete (*accumulator);
+  }
+  std::vector<HistManagerBase*>::iterator instance = std::find(instances_.begin(), instances_.end(), this);
+  if ( instance != instances_.end() ) instances_.erase(instance);
+}
+
+void HistManagerBase::setWeightShifts(const std::vector<std::string>& central_or_shifts, const double* weights)
+{
+  if ( !histograms_.empty() )
+    throw cms::Exception("HistManagerBase") 
+      << "Systematic shifts for category = " << category_ << " need to be set before histograms are booked !!\n";
+  if ( central_or_shifts.empty() || !weights )
+    throw cms::Exception("HistManagerBase") 
+      << "Invalid systematic shifts given for category = " << category_ << " !!\n";
+  central_or_shift_ = central_or_shifts.front();
+  central_or_shifts_ = central_or_shifts;
+  weights_shift_ = weights;
+}
+
+HistogramAccumulator* HistManagerBase::addAccumulator(const std::vector<TH1*>& histograms)
+{
+  for ( std::vector<TH1*>::const_iterator histogram = histograms.begin();
+	histogram != histograms.end(); ++histogram ) {
+    if ( !(*histogram)->GetSumw2N() ) (*histogram)->Sumw2();
+    histograms_.push_back(*histogram);
+  }
+  HistogramAccumulator* accumulator = ( weights_shift_ ) ? 
+    new HistogramAccumulator(histograms, weights_shift_) : new HistogramAccumulator(histograms.front());
+  accumulators_.push_back(accumulator);
+  return accumulator;
+}
+
+HistogramAccumulator* HistManagerBase::book1D(TFileDirectory& dir,
+					      const std::string& distribution, const std::string& title, int numBins, double min, double max)
 {
   TDirectory* subdir = createHistogramSubdirectory(dir);
   subdir->cd();
-  TH1* retVal = new TH1D(getHistogramName(distribution).data(), title.data(), numBins, min, max);
-  if ( !retVal->GetSumw2N() ) retVal->Sumw2();
-  histograms_.push_back(retVal);
-  return retVal;
+  std::vector<TH1*> histograms;
+  for ( std::vector<std::string>::const_iterator central_or_shift = central_or_shifts_.begin();
+	central_or_shift != central_or_shifts_.end(); ++central_or_shift ) {
+    histograms.push_back(new TH1D(getHistogramName(distribution, *central_or_shift).data(), title.data(), numBins, min, max));
+  }
+  return addAccumulator(histograms);
 }
  
-TH1* HistManagerBase::book1D(TFileDirectory& dir,
-			     const std::string& distribution, const std::string& title, int numBins, float* binning)
+HistogramAccumulator* HistManagerBase::book1D(TFileDirectory& dir,
+					      const std::string& distribution, const std::string& title, int numBins, float* binning)
 {
   TDirectory* subdir = createHistogramSubdirectory(dir);
   subdir->cd();
-  TH1* retVal = new TH1D(getHistogramName(distribution).data(), title.data(), numBins, binning);
-  if ( !retVal->GetSumw2N() ) retVal->Sumw2();
-  histograms_.push_back(retVal);
-  return retVal;
+  std::vector<TH1*> histograms;
+  for ( std::vector<std::string>::const_iterator central_or_shift = central_or_shifts_.begin();
+	central_or_shift != central_or_shifts_.end(); ++central_or_shift ) {
+    histograms.push_back(new TH1D(getHistogramName(distribution, *central_or_shift).data(), title.data(), numBins, binning));
+  }
+  return addAccumulator(histograms);
 }
 
-TH2* HistManagerBase::book2D(TFileDirectory& dir,
-			     const std::string& distribution, const std::string& title, int numBinsX, double xMin, double xMax, int numBinsY, double yMin, double yMax)
+HistogramAccumulator* HistManagerBase::book2D(TFileDirectory& dir,
+					      const std::string& distribution, const std::string& title, int numBinsX, double xMin, double xMax, int numBinsY, double yMin, double yMax)
 {
   TDirectory* subdir = createHistogramSubdirectory(dir);
   subdir->cd();
-  TH2* retVal = new TH2D(getHistogramName(distribution).data(), title.data(), numBinsX, xMin, xMax, numBinsY, yMin, yMax);
-  if ( !retVal->GetSumw2N() ) retVal->Sumw2();
-  histograms_.push_back(retVal);
-  return retVal;
+  std::vector<TH1*> histograms;
+  for ( std::vector<std::string>::const_iterator central_or_shift = central_or_shifts_.begin();
+	central_or_shift != central_or_shifts_.end(); ++central_or_shift ) {
+    histograms.push_back(new TH2D(getHistogramName(distribution, *central_or_shift).data(), title.data(), numBinsX, xMin, xMax, numBinsY, yMin, yMax));
+  }
+  return addAccumulator(histograms);
 }
  
-TH2* HistManagerBase::book2D(TFileDirectory& dir,
-			     const std::string& distribution, const std::string& title, int numBinsX, float* binningX, int numBinsY, float* binningY)
+HistogramAccumulator* HistManagerBase::book2D(TFileDirectory& dir,
+					      const std::string& distribution, const std::string& title, int numBinsX, float* binningX, int numBinsY, float* binningY)
 {
   TDirectory* subdir = createHistogramSubdirectory(dir);
   subdir->cd();
-  TH2* retVal = new TH2D(getHistogramName(distribution).data(), title.data(), numBinsX, binningX, numBinsY, binningY);
-  if ( !retVal->GetSumw2N() ) retVal->Sumw2();
-  histograms_.push_back(retVal);
-  return retVal;
+  std::vector<TH1*> histograms;
+  for ( std::vector<std::string>::const_iterator central_or_shift = central_or_shifts_.begin();
+	central_or_shift != central_or_shifts_.end(); ++central_or_shift ) {
+    histograms.push_back(new TH2D(getHistogramName(distribution, *central_or_shift).data(), title.data(), numBinsX, binningX, numBinsY, binningY));
+  }
+  return addAccumulator(histograms);
+}
+
+void HistManagerBase::merge(const HistManagerBase& shard)
+{
+  if ( shard.histograms_.size() != histograms_.size() || shard.accumulators_.size() != accumulators_.size() )
+    throw cms::Exception("HistManagerBase") 
+      << "Cannot merge histograms of category = " << shard.category_ << " into category = " << category_ << " !!\n";
+  // CV: add the events already flushed into the histograms of the shard as well as the events not flushed yet
+  for ( size_t idxHistogram = 0; idxHistogram < histograms_.size(); ++idxHistogram ) {
+    histograms_[idxHistogram]->Add(shard.histograms_[idxHistogram]);
+  }
+  for ( size_t idxAccumulator = 0; idxAccumulator < accumulators_.size(); ++idxAccumulator ) {
+    accumulators_[idxAccumulator]->add(*shard.accumulators_[idxAccumulator]);
+  }
+}
+
+void HistManagerBase::flush()
+{
+  for ( std::vector<HistogramAccumulator*>::iterator accumulator = accumulators_.begin();
+	accumulator != accumulators_.end(); ++accumulator ) {
+    (*accumulator)->flush();
+  }
+}
+
+void HistManagerBase::flushAll()
+{
+  for ( std::vector<HistManagerBase*>::iterator instance = instances_.begin();
+	instance != instances_.end(); ++instance ) {
+    (*instance)->flush();
+  }
 }
 
 TDirectory* HistManagerBase::createHistogramSubdirectory(TFileDirectory& dir)
@@ -60,10 +143,10 @@ TDirectory* HistManagerBase::createHistogramSubdirectory(TFileDirectory& dir)
   return subdir;
 }
  
-std::string HistManagerBase::getHistogramName(const std::string& distribution) const
+std::string HistManagerBase::getHistogramName(const std::string& distribution, const std::string& central_or_shift) const
 {
   std::string retVal = "";
-  if ( !(central_or_shift_ == "" || central_or_shift_ == "central") ) retVal = central_or_shift_;
+  if ( !(central_or_shift == "" || central_or_shift == "central") ) retVal = central_or_shift;
   if ( retVal != "" ) retVal.append("_");
   retVal.append(distribution);
   return retVal;
@@ -0,0 +1,97 @@
+#include "tthAnalysis/HiggsToTauTau/interface/HistogramAccumulator.h"
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <TArrayD.h> // TArrayD
+#include <TMath.h> // TMath::Sqrt
+
+HistogramAccumulator::Axis::Axis(const TAxis* axis)
+  : numBins_(axis->GetNbins())
+  , min_(axis->GetXmin())
+  , max_(axis->GetXmax())
+{
+  const TArrayD* binEdges = axis->GetXbins();
+  if ( binEdges->GetSize() > 0 ) {
+    binEdges_.assign(binEdges->GetArray(), binEdges->GetArray() + binEdges->GetSize());
+  }
+}
+
+HistogramAccumulator::HistogramAccumulator(TH1* histogram)
+  : histograms_(1, histogram)
+  , numShifts_(1)
+  , weights_(&weight_unity_)
+  , weight_unity_(1.)
+  , xAxis_(histogram->GetXaxis())
+  , yAxis_(histogram->GetYaxis())
+  , numEntries_(0)
+{
+  initialize();
+}
+
+HistogramAccumulator::HistogramAccumulator(const std::vector<TH1*>& histograms, const double* weights)
+  : histograms_(histograms)
+  , numShifts_(histograms.size())
+  , weights_(weights)
+  , weight_unity_(1.)
+  , xAxis_(histograms.front()->GetXaxis())
+  , yAxis_(histograms.front()->GetYaxis())
+  , numEntries_(0)
+{
+  if ( !weights_ )
+    throw cms::Exception("HistogramAccumulator")
+      << "No weights given for histogram = " << histograms.front()->GetName() << " !!\n";
+  initialize();
+}
+
+void HistogramAccumulator::initialize()
+{
+  const TH1* histogram = histograms_.front();
+  if ( histogram->GetDimension() > 2 )
+    throw cms::Exception("HistogramAccumulator")
+      << "Histogram = " << histogram->GetName() << " has more than two dimensions !!\n";
+  int numCells = xAxis_.numBins_ + 2;
+  if ( histogram->GetDimension() == 2 ) numCells *= (yAxis_.numBins_ + 2);
+  for ( std::vector<TH1*>::const_iterator histogram_shift = histograms_.begin();
+	histogram_shift != histograms_.end(); ++histogram_shift ) {
+    if ( (*histogram_shift)->GetNcells() != numCells )
+      throw cms::Exception("HistogramAccumulator")
+	<< "Binning of histogram = " << (*histogram_shift)->GetName() << " differs from binning of histogram = " << histogram->GetName() << " !!\n";
+  }
+  sumw_.assign(numCells*numShifts_, 0.);
+  sumw2_.assign(numCells*numShifts_, 0.);
+}
+
+void HistogramAccumulator::add(const HistogramAccumulator& other)
+{
+  if ( !(other.sumw_.size() == sumw_.size() && other.numShifts_ == numShifts_ && other.xAxis_.numBins_ == xAxis_.numBins_ && other.yAxis_.numBins_ == yAxis_.numBins_) )
+    throw cms::Exception("HistogramAccumulator")
+      << "Cannot add histogram = " << other.histograms_.front()->GetName() << " to histogram = " << histograms_.front()->GetName() << ", because the binning differs !!\n";
+  for ( size_t idxCell = 0; idxCell < sumw_.size(); ++idxCell ) {
+    sumw_[idxCell] += other.sumw_[idxCell];
+    sumw2_[idxCell] += other.sumw2_[idxCell];
+  }
+  numEntries_ += other.numEntries_;
+}
+
+void HistogramAccumulator::flush()
+{
+  if ( numEntries_ == 0 ) return;
+  for ( int idxShift = 0; idxShift < numShifts_; ++idxShift ) {
+    TH1* histogram = histograms_[idxShift];
+    // CV: TH1::SetBinContent increments the number of entries,
+    //     so restore it afterwards to the value it would have had after filling the histogram event by event
+    double numEntries = histogram->GetEntries() + numEntries_;
+    for ( size_t idxCell = idxShift; idxCell < sumw_.size(); idxCell += numShifts_ ) {
+      if ( sumw_[idxCell] == 0. && sumw2_[idxCell] == 0. ) continue;
+      int bin = idxCell/numShifts_;
+      double binContent = histogram->GetBinContent(bin);
+      double binError = histogram->GetBinError(bin);
+      histogram->SetBinContent(bin, binContent + sumw_[idxCell]);
+      histogram->SetBinError(bin, TMath::Sqrt(binError*binError + sumw2_[idxCell]));
+      sumw_[idxCell] = 0.;
+      sumw2_[idxCell] = 0.;
+    }
+    histogram->SetEntries(numEntries);
+  }
+  numEntries_ = 0;
+}
@@ -22,7 +22,7 @@ void JetHistManager::bookHistograms(TFileDirectory& dir)
   histogram_abs_genPdgId_ = book1D(dir, "abs_genPdgId", "abs_genPdgId", 22, -0.5, +21.5);
 }
 
-void JetHistManager::fillHistograms(const std::vector<const RecoJet*>& jet_ptrs, double evtWeight)
+void JetHistManager::fillHistograms(const std::vector<const RecoJet*>& jet_ptrs, const GenMatchTable& genMatchTable, double evtWeight)
 {
   double evtWeightErr = 0.;
   
@@ -39,11 +39,12 @@ void JetHistManager::fillHistograms(const std::vector<const RecoJet*>& jet_ptrs,
 
     fillWithOverFlow(histogram_BtagCSV_, jet->BtagCSV_, evtWeight, evtWeightErr);
   
+    const GenMatch& genMatch = genMatchTable.getGenMatch(*jet);
     int abs_genPdgId = 0;
-    if      ( jet->genLepton_ ) abs_genPdgId = std::abs(jet->genLepton_->pdgId_); // generator level match to electron or muon
-    else if ( jet->genHadTau_ ) abs_genPdgId = 15;                                // generator level match to hadronic tau decay 
-    else if ( jet->genJet_    ) abs_genPdgId = 21;                                // generator level match to jet; fill histogram with pdgId of gluon
-    else                        abs_genPdgId = 0;                                 // no match to any generator level particle (reconstructed jet most likely due to pileup)
+    if      ( genMatch.genLepton_ ) abs_genPdgId = std::abs(genMatch.genLepton_->pdgId_); // generator level match to electron or muon
+    else if ( genMatch.genHadTau_ ) abs_genPdgId = 15;                                    // generator level match to hadronic tau decay 
+    else if ( genMatch.genJet_    ) abs_genPdgId = 21;                                    // generator level match to jet; fill histogram with pdgId of gluon
+    else                            abs_genPdgId = 0;                                     // no match to any generator level particle (reconstructed jet most likely due to pileup)
     fillWithOverFlow(histogram_abs_genPdgId_, abs_genPdgId, evtWeight, evtWeightErr);
   }
 }
@@ -0,0 +1,209 @@
+#include "tthAnalysis/HiggsToTauTau/interface/MVAOutputCache.h"
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+#include "FWCore/ParameterSet/interface/FileInPath.h" // edm::FileInPath
+
+#include "tthAnalysis/HiggsToTauTau/interface/compiledBDTs.h" // computeFileChecksum
+
+#include <iostream> // std::cout
+#include <fstream> // std::ifstream, std::ofstream
+#include <sstream> // std::ostringstream
+#include <cstring> // std::memcmp, std::strncmp
+
+namespace
+{
+  const char* magic = "TTHMVA01";
+  const int magicSize = 8;
+
+  template <typename T>
+  void writeValue(std::ofstream& file, const T& value) { file.write(reinterpret_cast<const char*>(&value), sizeof(T)); }
+
+  template <typename T>
+  T readValue(std::ifstream& file, const std::string& fileName)
+  {
+    T value;
+    if ( !file.read(reinterpret_cast<char*>(&value), sizeof(T)) )
+      throw cms::Exception("MVAOutputCache")
+	<< "File = " << fileName << " is truncated !!\n";
+    return value;
+  }
+}
+
+MVAOutputCache::MVAOutputCache(const std::string& tag, int numInputs, int numOutputs, bool keepAllEvents)
+  : tag_(tag)
+  , numInputs_(numInputs)
+  , numOutputs_(numOutputs)
+  , keepAllEvents_(keepAllEvents)
+  , fallback_(0)
+  , lastRun_(0)
+  , lastLumi_(0)
+  , lastEvent_(0)
+  , numHits_(0)
+  , numMisses_(0)
+{
+  if ( numInputs_ <= 0 || numOutputs_ <= 0 )
+    throw cms::Exception("MVAOutputCache")
+      << "Invalid number of input values = " << numInputs_ << " or outputs = " << numOutputs_ << " !!\n";
+}
+
+MVAOutputCache::Key MVAOutputCache::makeKey(RUN_TYPE run, LUMI_TYPE lumi, EVT_TYPE event, const Float_t* mvaInputs) const
+{
+  Key key;
+  key.run_ = run;
+  key.lumi_ = lumi;
+  key.event_ = event;
+  // CV: 64-bit FNV-1a hash of the bytes of the input values
+  key.inputHash_ = 14695981039346656037ULL;
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(mvaInputs);
+  for ( size_t idxByte = 0; idxByte < numInputs_*sizeof(Float_t); ++idxByte ) {
+    key.inputHash_ ^= bytes[idxByte];
+    key.inputHash_ *= 1099511628211ULL;
+  }
+  return key;
+}
+
+const double* MVAOutputCache::findEntry(const Key& key, const Float_t* mvaInputs) const
+{
+  std::unordered_map<Key, size_t, KeyHash>::const_iterator entry = entries_.find(key);
+  if ( entry != entries_.end() && std::memcmp(&inputs_[entry->second*numInputs_], mvaInputs, numInputs_*sizeof(Float_t)) == 0 ) {
+    return &outputs_[entry->second*numOutputs_];
+  }
+  if ( fallback_ ) return fallback_->findEntry(key, mvaInputs);
+  return 0;
+}
+
+void MVAOutputCache::addEntry(const Key& key, const Float_t* mvaInputs, const double* mvaOutputs)
+{
+  if ( !entries_.insert(std::make_pair(key, keys_.size())).second ) return;
+  keys_.push_back(key);
+  inputs_.insert(inputs_.end(), mvaInputs, mvaInputs + numInputs_);
+  outputs_.insert(outputs_.end(), mvaOutputs, mvaOutputs + numOutputs_);
+}
+
+void MVAOutputCache::startEvent(RUN_TYPE run, LUMI_TYPE lumi, EVT_TYPE event)
+{
+  if ( keepAllEvents_ || (event == lastEvent_ && lumi == lastLumi_ && run == lastRun_) ) return;
+  entries_.clear();
+  keys_.clear();
+  inputs_.clear();
+  outputs_.clear();
+  lastRun_ = run;
+  lastLumi_ = lumi;
+  lastEvent_ = event;
+}
+
+const double* MVAOutputCache::find(RUN_TYPE run, LUMI_TYPE lumi, EVT_TYPE event, const Float_t* mvaInputs)
+{
+  startEvent(run, lumi, event);
+  const double* mvaOutputs = findEntry(makeKey(run, lumi, event, mvaInputs), mvaInputs);
+  if ( mvaOutputs ) ++numHits_;
+  else ++numMisses_;
+  return mvaOutputs;
+}
+
+void MVAOutputCache::insert(RUN_TYPE run, LUMI_TYPE lumi, EVT_TYPE event, const Float_t* mvaInputs, const double* mvaOutputs)
+{
+  startEvent(run, lumi, event);
+  addEntry(makeKey(run, lumi, event, mvaInputs), mvaInputs, mvaOutputs);
+}
+
+void MVAOutputCache::setFallback(const MVAOutputCache* fallback)
+{
+  if ( fallback && !(fallback->tag_ == tag_ && fallback->numInputs_ == numInputs_ && fallback->numOutputs_ == numOutputs_) )
+    throw cms::Exception("MVAOutputCache")
+      << "Cannot use cache with tag = " << fallback->tag_ << " as fallback for cache with tag = " << tag_ << " !!\n";
+  fallback_ = fallback;
+}
+
+void MVAOutputCache::merge(const MVAOutputCache& other)
+{
+  if ( !(other.tag_ == tag_ && other.numInputs_ == numInputs_ && other.numOutputs_ == numOutputs_) )
+    throw cms::Exception("MVAOutputCache")
+      << "Cannot merge cache with tag = " << other.tag_ << " into cache with tag = " << tag_ << " !!\n";
+  for ( size_t idxEntry = 0; idxEntry < other.keys_.size(); ++idxEntry ) {
+    addEntry(other.keys_[idxEntry], &other.inputs_[idxEntry*numInputs_], &other.outputs_[idxEntry*numOutputs_]);
+  }
+  numHits_ += other.numHits_;
+  numMisses_ += other.numMisses_;
+}
+
+bool MVAOutputCache::read(const std::string& fileName)
+{
+  std::ifstream file(fileName.data(), std::ios::in | std::ios::binary);
+  if ( !file ) {
+    std::cout << "<MVAOutputCache::read>: file = " << fileName << " does not exist, all MVA outputs will be computed." << std::endl;
+    return false;
+  }
+  char fileMagic[magicSize];
+  if ( !file.read(fileMagic, magicSize) || std::strncmp(fileMagic, magic, magicSize) != 0 )
+    throw cms::Exception("MVAOutputCache")
+      << "File = " << fileName << " is not an MVA output cache !!\n";
+  Int_t tagLength = readValue<Int_t>(file, fileName);
+  if ( tagLength < 0 )
+    throw cms::Exception("MVAOutputCache")
+      << "File = " << fileName << " is corrupted !!\n";
+  std::string tag(tagLength, ' ');
+  if ( !file.read(&tag[0], tagLength) )
+    throw cms::Exception("MVAOutputCache")
+      << "File = " << fileName << " is truncated !!\n";
+  Int_t numInputs = readValue<Int_t>(file, fileName);
+  Int_t numOutputs = readValue<Int_t>(file, fileName);
+  if ( tag != tag_ || numInputs != numInputs_ || numOutputs != numOutputs_ ) {
+    std::cout << "<MVAOutputCache::read>: file = " << fileName << " has been written for different MVAs, all MVA outputs will be computed." << std::endl;
+    return false;
+  }
+  Long64_t numEntries = readValue<Long64_t>(file, fileName);
+  std::vector<Float_t> mvaInputs(numInputs_);
+  std::vector<double> mvaOutputs(numOutputs_);
+  for ( Long64_t idxEntry = 0; idxEntry < numEntries; ++idxEntry ) {
+    RUN_TYPE run = readValue<RUN_TYPE>(file, fileName);
+    LUMI_TYPE lumi = readValue<LUMI_TYPE>(file, fileName);
+    EVT_TYPE event = readValue<EVT_TYPE>(file, fileName);
+    for ( int idxInput = 0; idxInput < numInputs_; ++idxInput ) {
+      mvaInputs[idxInput] = readValue<Float_t>(file, fileName);
+    }
+    for ( int idxOutput = 0; idxOutput < numOutputs_; ++idxOutput ) {
+      mvaOutputs[idxOutput] = readValue<double>(file, fileName);
+    }
+    addEntry(makeKey(run, lumi, event, mvaInputs.data()), mvaInputs.data(), mvaOutputs.data());
+  }
+  return true;
+}
+
+void MVAOutputCache::write(const std::string& fileName) const
+{
+  std::ofstream file(fileName.data(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if ( !file )
+    throw cms::Exception("MVAOutputCache")
+      << "Failed to open output file = " << fileName << " !!\n";
+  file.write(magic, magicSize);
+  writeValue<Int_t>(file, tag_.size());
+  file.write(tag_.data(), tag_.size());
+  writeValue<Int_t>(file, numInputs_);
+  writeValue<Int_t>(file, numOutputs_);
+  writeValue<Long64_t>(file, keys_.size());
+  for ( size_t idxEntry = 0; idxEntry < keys_.size(); ++idxEntry ) {
+    writeValue<RUN_TYPE>(file, keys_[idxEntry].run_);
+    writeValue<LUMI_TYPE>(file, keys_[idxEntry].lumi_);
+    writeValue<EVT_TYPE>(file, keys_[idxEntry].event_);
+    file.write(reinterpret_cast<const char*>(&inputs_[idxEntry*numInputs_]), numInputs_*sizeof(Float_t));
+    file.write(reinterpret_cast<const char*>(&outputs_[idxEntry*numOutputs_]), numOutputs_*sizeof(double));
+  }
+  if ( !file )
+    throw cms::Exception("MVAOutputCache")
+      << "Failed to write output file = " << fileName << " !!\n";
+}
+
+std::string getMVAOutputCacheTag(const std::vector<std::string>& mvaFileNames, const std::vector<std::string>& mvaInputLayout)
+{
+  std::ostringstream tag;
+  for ( std::vector<std::string>::const_iterator mvaFileName = mvaFileNames.begin();
+	mvaFileName != mvaFileNames.end(); ++mvaFileName ) {
+    tag << (*mvaFileName) << ":" << std::hex << computeFileChecksum(edm::FileInPath(*mvaFileName).fullPath()) << std::dec << ";";
+  }
+  for ( std::vector<std::string>::const_iterator mvaInput = mvaInputLayout.begin();
+	mvaInput != mvaInputLayout.end(); ++mvaInput ) {
+    tag << (*mvaInput) << ";";
+  }
+  return tag.str();
+}
@@ -32,7 +32,7 @@ void MuonHistManager::bookHistograms(TFileDirectory& dir)
   histogram_gen_times_recCharge_ = book1D(dir, "gen_times_recCharge", "gen_times_recCharge", 3, -1.5, +1.5);
 }
 
-void MuonHistManager::fillHistograms(const std::vector<const RecoMuon*>& muon_ptrs, double evtWeight)
+void MuonHistManager::fillHistograms(const std::vector<const RecoMuon*>& muon_ptrs, const GenMatchTable& genMatchTable, double evtWeight)
 {
   double evtWeightErr = 0.;
   
@@ -58,14 +58,15 @@ void MuonHistManager::fillHistograms(const std::vector<const RecoMuon*>& muon_pt
     fillWithOverFlow(histogram_passesLooseIdPOG_, muon->passesLooseIdPOG_, evtWeight, evtWeightErr);
     fillWithOverFlow(histogram_passesMediumIdPOG_, muon->passesMediumIdPOG_, evtWeight, evtWeightErr);
 
+    const GenMatch& genMatch = genMatchTable.getGenMatch(*muon);
     int abs_genPdgId = 0;
-    if      ( muon->genLepton_ ) abs_genPdgId = std::abs(muon->genLepton_->pdgId_); // generator level match to electron or muon
-    else if ( muon->genHadTau_ ) abs_genPdgId = 15;                                 // generator level match to hadronic tau decay 
-    else if ( muon->genJet_    ) abs_genPdgId = 21;                                 // generator level match to jet; fill histogram with pdgId of gluon
-    else                         abs_genPdgId = 0;                                  // no match to any generator level particle (reconstructed muon most likely due to pileup)
+    if      ( genMatch.genLepton_ ) abs_genPdgId = std::abs(genMatch.genLepton_->pdgId_); // generator level match to electron or muon
+    else if ( genMatch.genHadTau_ ) abs_genPdgId = 15;                                    // generator level match to hadronic tau decay 
+    else if ( genMatch.genJet_    ) abs_genPdgId = 21;                                    // generator level match to jet; fill histogram with pdgId of gluon
+    else                            abs_genPdgId = 0;                                     // no match to any generator level particle (reconstructed muon most likely due to pileup)
     fillWithOverFlow(histogram_abs_genPdgId_, abs_genPdgId, evtWeight, evtWeightErr);
     if ( abs_genPdgId == 13 ) {
-      fillWithOverFlow(histogram_gen_times_recCharge_, muon->charge_*muon->genLepton_->charge_, evtWeight, evtWeightErr);
+      fillWithOverFlow(histogram_gen_times_recCharge_, muon->charge_*genMatch.genLepton_->charge_, evtWeight, evtWeightErr);
     }
   }
 }
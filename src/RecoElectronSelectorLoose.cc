@@ -1,7 +1,5 @@
 #include "tthAnalysis/HiggsToTauTau/interface/RecoElectronSelectorLoose.h" // RecoElectronSelectorLoose
 
-#include <cmath> // std::fabs()
-
 RecoElectronSelectorLoose::RecoElectronSelectorLoose()
   : min_pt_(7.)
   , max_absEta_(2.5)
@@ -21,21 +19,10 @@ RecoElectronSelectorLoose::RecoElectronSelectorLoose()
 
 bool RecoElectronSelectorLoose::operator()(const RecoElectron& electron) const
 {
-  if ( electron.pt_ >= min_pt_ &&
-       electron.absEta_ <= max_absEta_ &&
-       std::fabs(electron.dxy_) <= max_dxy_ &&
-       std::fabs(electron.dz_) <= max_dz_ &&
-       electron.relIso_ <= max_relIso_ &&
-       electron.sip3d_ <= max_sip3d_ &&
-       (electron.tightCharge_ >= 2 || !apply_tightCharge_) && 
-       (electron.passesConversionVeto_ > 0 || !apply_conversionVeto_) &&
-       electron.nLostHits_ <= max_nLostHits_ ) {
-    int idxBin = -1;
-    if      ( electron.absEta_ <= binning_absEta_[0] ) idxBin = 0;
-    else if ( electron.absEta_ <= binning_absEta_[1] ) idxBin = 1;
-    else                                               idxBin = 2;
-    assert(idxBin >= 0 && idxBin <= 2);
-    if ( electron.mvaRawPOG_ >= min_mvaRawPOG_[idxBin] ) return true;
-  }
-  return false;
+  return passesCuts(RecoElectronAccessor(electron));
+}
+
+bool RecoElectronSelectorLoose::operator()(const RecoElectronCollectionView& electrons, int idx) const
+{
+  return passesCuts(RecoElectronViewAccessor(electrons, idx));
 }
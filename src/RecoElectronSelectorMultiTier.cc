@@ -0,0 +1,153 @@
+#include "tthAnalysis/HiggsToTauTau/interface/RecoElectronSelectorMultiTier.h" // RecoElectronSelectorMultiTier
+
+#include "tthAnalysis/HiggsToTauTau/interface/RecoElectronSelectorLoose.h" // RecoElectronSelectorLoose
+#include "tthAnalysis/HiggsToTauTau/interface/RecoElectronSelectorFakeable.h" // RecoElectronSelectorFakeable
+#include "tthAnalysis/HiggsToTauTau/interface/RecoElectronSelectorTight.h" // RecoElectronSelectorTight
+#include "tthAnalysis/HiggsToTauTau/interface/RecoElectronSelectorCutBased.h" // RecoElectronSelectorCutBased
+#include "tthAnalysis/HiggsToTauTau/interface/RecoElectronSelectorMVABased.h" // RecoElectronSelectorMVABased
+
+#include <cmath> // fabs
+#include <assert.h> // assert
+
+RecoElectronSelectorMultiTier::RecoElectronSelectorMultiTier()
+{
+//--- take the cut values from the single-tier selectors,
+//    so that each cut value is defined in one place only
+  RecoElectronSelectorLoose selectorLoose;
+  RecoElectronSelectorFakeable selectorFakeable;
+  RecoElectronSelectorTight selectorTight;
+  RecoElectronSelectorCutBased selectorCutBased;
+  RecoElectronSelectorMVABased selectorMVABased;
+
+  binning_absEta_ = selectorLoose.binning_absEta_;
+  max_absEta_ = selectorLoose.max_absEta_;
+  max_dxy_ = selectorLoose.max_dxy_;
+  max_dz_ = selectorLoose.max_dz_;
+  max_relIso_ = selectorLoose.max_relIso_;
+  max_sip3d_ = selectorLoose.max_sip3d_;
+  min_mvaRawPOG_ = selectorLoose.min_mvaRawPOG_;
+  min_pt_loose_ = selectorLoose.min_pt_;
+  max_nLostHits_loose_ = selectorLoose.max_nLostHits_;
+  min_pt_fakeable_ = selectorFakeable.min_pt_;
+  binning_mvaTTH_ = selectorFakeable.binning_mvaTTH_;
+  min_jetPtRatio_ = selectorFakeable.min_jetPtRatio_;
+  max_jetBtagCSV_fakeable_ = selectorFakeable.max_jetBtagCSV_;
+  max_nLostHits_ = selectorFakeable.max_nLostHits_;
+  min_pt_ = selectorTight.min_pt_;
+  min_mvaTTH_ = selectorTight.min_mvaTTH_;
+  max_jetBtagCSV_ = selectorMVABased.max_jetBtagCSV_;
+  max_relIso_cutBased_ = selectorCutBased.max_relIso_;
+  max_sip3d_cutBased_ = selectorCutBased.max_sip3d_;
+  min_mvaRawPOG_cutBased_ = selectorCutBased.min_mvaRawPOG_;
+  min_pt_trig_ = selectorTight.min_pt_trig_;
+  max_sigmaEtaEta_trig_ = selectorTight.max_sigmaEtaEta_trig_;
+  max_HoE_trig_ = selectorTight.max_HoE_trig_;
+  max_deltaEta_trig_ = selectorTight.max_deltaEta_trig_;
+  max_deltaPhi_trig_ = selectorTight.max_deltaPhi_trig_;
+  min_OoEminusOoP_trig_ = selectorTight.min_OoEminusOoP_trig_;
+  max_OoEminusOoP_trig_ = selectorTight.max_OoEminusOoP_trig_;
+
+//--- check that the single-tier selectors have the structure assumed by operator(),
+//    i.e. that cuts tested only once for several selections have the same value in all of them
+  const std::string selector = "RecoElectronSelectorMultiTier";
+  checkMultiTierCut(selector, "binning_absEta", selectorFakeable.binning_absEta_, binning_absEta_);
+  checkMultiTierCut(selector, "binning_absEta", selectorTight.binning_absEta_, binning_absEta_);
+  checkMultiTierCut(selector, "binning_absEta", selectorCutBased.binning_absEta_, binning_absEta_);
+  checkMultiTierCut(selector, "binning_absEta", selectorMVABased.binning_absEta_, binning_absEta_);
+  checkMultiTierCut(selector, "max_absEta", selectorFakeable.max_absEta_, max_absEta_);
+  checkMultiTierCut(selector, "max_absEta", selectorTight.max_absEta_, max_absEta_);
+  checkMultiTierCut(selector, "max_dxy", selectorFakeable.max_dxy_, max_dxy_);
+  checkMultiTierCut(selector, "max_dxy", selectorTight.max_dxy_, max_dxy_);
+  checkMultiTierCut(selector, "max_dz", selectorFakeable.max_dz_, max_dz_);
+  checkMultiTierCut(selector, "max_dz", selectorTight.max_dz_, max_dz_);
+  checkMultiTierCut(selector, "max_relIso", selectorFakeable.max_relIso_, max_relIso_);
+  checkMultiTierCut(selector, "max_relIso", selectorTight.max_relIso_, max_relIso_);
+  checkMultiTierCut(selector, "max_sip3d", selectorFakeable.max_sip3d_, max_sip3d_);
+  checkMultiTierCut(selector, "max_sip3d", selectorTight.max_sip3d_, max_sip3d_);
+  checkMultiTierCut(selector, "min_mvaRawPOG", selectorFakeable.min_mvaRawPOG_, min_mvaRawPOG_);
+  checkMultiTierCut(selector, "min_mvaRawPOG", selectorTight.min_mvaRawPOG_, min_mvaRawPOG_);
+  checkMultiTierCut(selector, "max_nLostHits", selectorTight.max_nLostHits_, max_nLostHits_);
+  checkMultiTierCut(selector, "max_nLostHits", selectorCutBased.max_nLostHits_, max_nLostHits_);
+  checkMultiTierCut(selector, "max_nLostHits", selectorMVABased.max_nLostHits_, max_nLostHits_);
+  checkMultiTierCut(selector, "min_pt", selectorCutBased.min_pt_, min_pt_);
+  checkMultiTierCut(selector, "min_pt", selectorMVABased.min_pt_, min_pt_);
+  checkMultiTierCut(selector, "min_mvaTTH", selectorMVABased.min_mvaTTH_, min_mvaTTH_);
+  checkMultiTierCut(selector, "apply_tightCharge", selectorLoose.apply_tightCharge_, false);
+  checkMultiTierCut(selector, "apply_tightCharge", selectorFakeable.apply_tightCharge_, false);
+  checkMultiTierCut(selector, "apply_tightCharge", selectorTight.apply_tightCharge_, false);
+  checkMultiTierCut(selector, "apply_tightCharge", selectorCutBased.apply_tightCharge_, true);
+  checkMultiTierCut(selector, "apply_tightCharge", selectorMVABased.apply_tightCharge_, true);
+  checkMultiTierCut(selector, "apply_conversionVeto", selectorLoose.apply_conversionVeto_, false);
+  checkMultiTierCut(selector, "apply_conversionVeto", selectorFakeable.apply_conversionVeto_, false);
+  checkMultiTierCut(selector, "apply_conversionVeto", selectorTight.apply_conversionVeto_, false);
+  checkMultiTierCut(selector, "apply_conversionVeto", selectorCutBased.apply_conversionVeto_, true);
+  checkMultiTierCut(selector, "apply_conversionVeto", selectorMVABased.apply_conversionVeto_, true);
+  checkMultiTierCut(selector, "min_pt_trig", selectorFakeable.min_pt_trig_, min_pt_trig_);
+  checkMultiTierCut(selector, "min_pt_trig", selectorMVABased.min_pt_trig_, min_pt_trig_);
+  checkMultiTierCut(selector, "max_sigmaEtaEta_trig", selectorFakeable.max_sigmaEtaEta_trig_, max_sigmaEtaEta_trig_);
+  checkMultiTierCut(selector, "max_sigmaEtaEta_trig", selectorMVABased.max_sigmaEtaEta_trig_, max_sigmaEtaEta_trig_);
+  checkMultiTierCut(selector, "max_HoE_trig", selectorFakeable.max_HoE_trig_, max_HoE_trig_);
+  checkMultiTierCut(selector, "max_HoE_trig", selectorMVABased.max_HoE_trig_, max_HoE_trig_);
+  checkMultiTierCut(selector, "max_deltaEta_trig", selectorFakeable.max_deltaEta_trig_, max_deltaEta_trig_);
+  checkMultiTierCut(selector, "max_deltaEta_trig", selectorMVABased.max_deltaEta_trig_, max_deltaEta_trig_);
+  checkMultiTierCut(selector, "max_deltaPhi_trig", selectorFakeable.max_deltaPhi_trig_, max_deltaPhi_trig_);
+  checkMultiTierCut(selector, "max_deltaPhi_trig", selectorMVABased.max_deltaPhi_trig_, max_deltaPhi_trig_);
+  checkMultiTierCut(selector, "min_OoEminusOoP_trig", selectorFakeable.min_OoEminusOoP_trig_, min_OoEminusOoP_trig_);
+  checkMultiTierCut(selector, "min_OoEminusOoP_trig", selectorMVABased.min_OoEminusOoP_trig_, min_OoEminusOoP_trig_);
+  checkMultiTierCut(selector, "max_OoEminusOoP_trig", selectorFakeable.max_OoEminusOoP_trig_, max_OoEminusOoP_trig_);
+  checkMultiTierCut(selector, "max_OoEminusOoP_trig", selectorMVABased.max_OoEminusOoP_trig_, max_OoEminusOoP_trig_);
+  assert(binning_absEta_.size() == 2);
+  assert(min_mvaRawPOG_.size() == 3);
+  assert(binning_mvaTTH_.size() == 1);
+  assert(min_jetPtRatio_.size() == 2);
+  assert(max_jetBtagCSV_fakeable_.size() == 2);
+  assert(min_mvaRawPOG_cutBased_.size() == 3);
+}
+
+UChar_t RecoElectronSelectorMultiTier::operator()(const RecoElectron& electron) const
+{
+  int idxBin_absEta = -1;
+  if      ( electron.absEta_ <= binning_absEta_[0] ) idxBin_absEta = 0;
+  else if ( electron.absEta_ <= binning_absEta_[1] ) idxBin_absEta = 1;
+  else                                               idxBin_absEta = 2;
+
+  UChar_t selectionFlags = 0;
+  bool passesCommonCuts = 
+    electron.absEta_ <= max_absEta_ &&
+    std::fabs(electron.dxy_) <= max_dxy_ &&
+    std::fabs(electron.dz_) <= max_dz_ &&
+    electron.relIso_ <= max_relIso_ &&
+    electron.sip3d_ <= max_sip3d_ &&
+    electron.mvaRawPOG_ >= min_mvaRawPOG_[idxBin_absEta];
+  if ( passesCommonCuts && electron.pt_ >= min_pt_loose_ && electron.nLostHits_ <= max_nLostHits_loose_ ) selectionFlags |= kSelectionLoose;
+
+  // CV: all other selections require no lost hits
+  if ( !(electron.nLostHits_ <= max_nLostHits_) ) return selectionFlags;
+
+  bool passesTrigCuts = 
+    electron.pt_ <= min_pt_trig_ || 
+    (electron.sigmaEtaEta_ <= max_sigmaEtaEta_trig_[idxBin_absEta] &&
+     electron.HoE_ <= max_HoE_trig_[idxBin_absEta] &&
+     electron.deltaEta_ <= max_deltaEta_trig_[idxBin_absEta] &&
+     electron.deltaPhi_ <= max_deltaPhi_trig_[idxBin_absEta] &&
+     electron.OoEminusOoP_ >= min_OoEminusOoP_trig_ && electron.OoEminusOoP_ <= max_OoEminusOoP_trig_[idxBin_absEta]);
+  if ( passesCommonCuts && passesTrigCuts ) {
+    if ( electron.pt_ >= min_pt_fakeable_ ) {
+      int idxBin_mvaTTH = -1;
+      if   ( electron.mvaRawTTH_ >= binning_mvaTTH_[0] ) idxBin_mvaTTH = 0;
+      else                                               idxBin_mvaTTH = 1;
+      if ( electron.jetPtRatio_ >= min_jetPtRatio_[idxBin_mvaTTH] &&
+	   electron.jetBtagCSV_ <= max_jetBtagCSV_fakeable_[idxBin_mvaTTH] ) selectionFlags |= kSelectionFakeable;
+    }
+    if ( electron.pt_ >= min_pt_ && electron.mvaRawTTH_ >= min_mvaTTH_ ) selectionFlags |= kSelectionTight;
+  }
+  if ( electron.pt_ >= min_pt_ && electron.tightCharge_ >= 2 && electron.passesConversionVeto_ ) {
+    if ( passesTrigCuts && 
+	 electron.mvaRawTTH_ >= min_mvaTTH_ && 
+	 electron.jetBtagCSV_ <= max_jetBtagCSV_ ) selectionFlags |= kSelectionMVABased;
+    if ( electron.relIso_ <= max_relIso_cutBased_ && 
+	 electron.sip3d_ <= max_sip3d_cutBased_ && 
+	 electron.mvaRawPOG_ >= min_mvaRawPOG_cutBased_[idxBin_absEta] ) selectionFlags |= kSelectionCutBased;
+  }
+  return selectionFlags;
+}
@@ -35,7 +35,4 @@ RecoHadTau::RecoHadTau(Double_t pt,
   , raw_cut_dR05_(raw_cut_dR05)   
   , antiElectron_(antiElectron)
   , antiMuon_(antiMuon)
-  , genLepton_(0)
-  , genHadTau_(0)
-  , genJet_(0)
 {}
@@ -4,13 +4,10 @@
 
 #include <TString.h> // Form
 
-std::map<std::string, int> RecoHadTauReader::numInstances_;
-std::map<std::string, RecoHadTauReader*> RecoHadTauReader::instances_;
-
 RecoHadTauReader::RecoHadTauReader()
-  : max_nHadTaus_(32)
-  , branchName_num_("nTauGood")
+  : branchName_num_("nTauGood")
   , branchName_obj_("TauGood")
+  , nHadTaus_(0)
   , hadTau_pt_(0)
   , hadTau_eta_(0)
   , hadTau_phi_(0)
@@ -35,9 +32,9 @@ RecoHadTauReader::RecoHadTauReader()
 }
 
 RecoHadTauReader::RecoHadTauReader(const std::string& branchName_num, const std::string& branchName_obj)
-  : max_nHadTaus_(32)
-  , branchName_num_(branchName_num)
+  : branchName_num_(branchName_num)
   , branchName_obj_(branchName_obj)
+  , nHadTaus_(0)
   , hadTau_pt_(0)
   , hadTau_eta_(0)
   , hadTau_phi_(0)
@@ -62,146 +59,141 @@ RecoHadTauReader::RecoHadTauReader(const std::string& branchName_num, const std:
 }
 
 RecoHadTauReader::~RecoHadTauReader()
-{
-  --numInstances_[branchName_obj_];
-  assert(numInstances_[branchName_obj_] >= 0);
-  if ( numInstances_[branchName_obj_] == 0 ) {
-    RecoHadTauReader* gInstance = instances_[branchName_obj_];
-    assert(gInstance);
-    delete gInstance->hadTau_pt_;
-    delete gInstance->hadTau_eta_;
-    delete gInstance->hadTau_phi_;
-    delete gInstance->hadTau_mass_;
-    delete gInstance->hadTau_dxy_;
-    delete gInstance->hadTau_dz_;
-    delete gInstance->hadTau_idDecayMode_;
-    delete gInstance->hadTau_idDecayModeNewDMs_;
-    delete gInstance->hadTau_idMVA_dR03_;
-    delete gInstance->hadTau_rawMVA_dR03_;
-    delete gInstance->hadTau_idMVA_dR05_;
-    delete gInstance->hadTau_rawMVA_dR05_;
-    delete gInstance->hadTau_idCombIso_dR03_;
-    delete gInstance->hadTau_rawCombIso_dR03_;
-    delete gInstance->hadTau_idCombIso_dR05_;
-    delete gInstance->hadTau_rawCombIso_dR05_;
-    delete gInstance->hadTau_idAgainstElec_;
-    delete gInstance->hadTau_idAgainstMu_;
-    delete gInstance->hadTau_charge_;
-    instances_[branchName_obj_] = 0;
-  }
-}
+{}
 
 void RecoHadTauReader::setBranchNames()
 {
-  if ( numInstances_[branchName_obj_] == 0 ) {
-    branchName_pt_ = Form("%s_%s", branchName_obj_.data(), "pt");
-    branchName_eta_ = Form("%s_%s", branchName_obj_.data(), "eta");
-    branchName_phi_ = Form("%s_%s", branchName_obj_.data(), "phi");
-    branchName_mass_ = Form("%s_%s", branchName_obj_.data(), "mass");
-    branchName_charge_ = Form("%s_%s", branchName_obj_.data(), "charge");
-    branchName_dxy_ = Form("%s_%s", branchName_obj_.data(), "dxy");
-    branchName_dz_ = Form("%s_%s", branchName_obj_.data(), "dz");
-    branchName_idDecayMode_ = Form("%s_%s", branchName_obj_.data(), "idDecayMode");
-    branchName_idDecayModeNewDMs_ = Form("%s_%s", branchName_obj_.data(), "idDecayModeNewDMs");
-    branchName_idMVA_dR03_ = Form("%s_%s", branchName_obj_.data(), "idMVArun2dR03");
-    branchName_rawMVA_dR03_ = Form("%s_%s", branchName_obj_.data(), "rawMVArun2dR03");
-    branchName_idMVA_dR05_ = Form("%s_%s", branchName_obj_.data(), "idMVArun2");
-    branchName_rawMVA_dR05_ = Form("%s_%s", branchName_obj_.data(), "rawMVArun2");
-    branchName_idCombIso_dR03_ = Form("%s_%s", branchName_obj_.data(), "idCI3hitdR03");
-    branchName_rawCombIso_dR03_ = Form("%s_%s", branchName_obj_.data(), "isoCI3hitdR03"); // CV: branch does not exist in VHbb Ntuples yet
-    branchName_idCombIso_dR05_ = Form("%s_%s", branchName_obj_.data(), "idCI3hit");
-    branchName_rawCombIso_dR05_ = Form("%s_%s", branchName_obj_.data(), "isoCI3hit"); 
-    branchName_idAgainstElec_ = Form("%s_%s", branchName_obj_.data(), "idAntiErun2");
-    branchName_idAgainstMu_ = Form("%s_%s", branchName_obj_.data(), "idAntiMu");
-    instances_[branchName_obj_] = this;
-  } else {
-    if ( branchName_num_ != instances_[branchName_obj_]->branchName_num_ ) {
-      throw cms::Exception("RecoHadTauReader") 
-	<< "Association between configuration parameters 'branchName_num' and 'branchName_obj' must be unique:"
-	<< " present association 'branchName_num' = " << branchName_num_ << " with 'branchName_obj' = " << branchName_obj_ 
-	<< " does not match previous association 'branchName_num' = " << instances_[branchName_obj_]->branchName_num_ << " with 'branchName_obj' = " << instances_[branchName_obj_]->branchName_obj_ << " !!\n";
-    }
-  }
-  ++numInstances_[branchName_obj_];
+  branchName_pt_ = Form("%s_%s", branchName_obj_.data(), "pt");
+  branchName_eta_ = Form("%s_%s", branchName_obj_.data(), "eta");
+  branchName_phi_ = Form("%s_%s", branchName_obj_.data(), "phi");
+  branchName_mass_ = Form("%s_%s", branchName_obj_.data(), "mass");
+  branchName_charge_ = Form("%s_%s", branchName_obj_.data(), "charge");
+  branchName_dxy_ = Form("%s_%s", branchName_obj_.data(), "dxy");
+  branchName_dz_ = Form("%s_%s", branchName_obj_.data(), "dz");
+  branchName_idDecayMode_ = Form("%s_%s", branchName_obj_.data(), "idDecayMode");
+  branchName_idDecayModeNewDMs_ = Form("%s_%s", branchName_obj_.data(), "idDecayModeNewDMs");
+  branchName_idMVA_dR03_ = Form("%s_%s", branchName_obj_.data(), "idMVArun2dR03");
+  branchName_rawMVA_dR03_ = Form("%s_%s", branchName_obj_.data(), "rawMVArun2dR03");
+  branchName_idMVA_dR05_ = Form("%s_%s", branchName_obj_.data(), "idMVArun2");
+  branchName_rawMVA_dR05_ = Form("%s_%s", branchName_obj_.data(), "rawMVArun2");
+  branchName_idCombIso_dR03_ = Form("%s_%s", branchName_obj_.data(), "idCI3hitdR03");
+  branchName_rawCombIso_dR03_ = Form("%s_%s", branchName_obj_.data(), "isoCI3hitdR03"); // CV: branch does not exist in VHbb Ntuples yet
+  branchName_idCombIso_dR05_ = Form("%s_%s", branchName_obj_.data(), "idCI3hit");
+  branchName_rawCombIso_dR05_ = Form("%s_%s", branchName_obj_.data(), "isoCI3hit"); 
+  branchName_idAgainstElec_ = Form("%s_%s", branchName_obj_.data(), "idAntiErun2");
+  branchName_idAgainstMu_ = Form("%s_%s", branchName_obj_.data(), "idAntiMu");
 }
 
-void RecoHadTauReader::setBranchAddresses(TTree* tree)
+void RecoHadTauReader::setBranchAddresses(EventSource& eventSource)
 {
-  if ( instances_[branchName_obj_] == this ) {
-    tree->SetBranchAddress(branchName_num_.data(), &nHadTaus_);   
-    hadTau_pt_ = new Float_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_pt_.data(), hadTau_pt_); 
-    hadTau_eta_ = new Float_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_eta_.data(), hadTau_eta_); 
-    hadTau_phi_ = new Float_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_phi_.data(), hadTau_phi_); 
-    hadTau_mass_ = new Float_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_mass_.data(), hadTau_mass_); 
-    hadTau_charge_ = new Int_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_charge_.data(), hadTau_charge_); 
-    hadTau_dxy_ = new Float_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_dxy_.data(), hadTau_dxy_);
-    hadTau_dz_ = new Float_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_dz_.data(), hadTau_dz_);
-    hadTau_idDecayMode_ = new Int_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_idDecayMode_.data(), hadTau_idDecayMode_);
-    hadTau_idDecayModeNewDMs_ = new Int_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_idDecayModeNewDMs_.data(), hadTau_idDecayModeNewDMs_);
-    hadTau_idMVA_dR03_ = new Int_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_idMVA_dR03_.data(), hadTau_idMVA_dR03_); 
-    hadTau_rawMVA_dR03_ = new Float_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_rawMVA_dR03_.data(), hadTau_rawMVA_dR03_); 
-    hadTau_idMVA_dR05_ = new Int_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_idMVA_dR05_.data(), hadTau_idMVA_dR05_); 
-    hadTau_rawMVA_dR05_ = new Float_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_rawMVA_dR05_.data(), hadTau_rawMVA_dR05_); 
-    hadTau_idCombIso_dR03_ = new Int_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_idCombIso_dR03_.data(), hadTau_idCombIso_dR03_); 
-    hadTau_rawCombIso_dR03_ = new Float_t[max_nHadTaus_];
-    //tree->SetBranchAddress(branchName_rawCombIso_dR03_.data(), hadTau_rawCombIso_dR03_); // CV: branch does not exist in VHbb Ntuples yet
-    hadTau_idCombIso_dR05_ = new Int_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_idCombIso_dR05_.data(), hadTau_idCombIso_dR05_); 
-    hadTau_rawCombIso_dR05_ = new Float_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_rawCombIso_dR05_.data(), hadTau_rawCombIso_dR05_);
-    hadTau_idAgainstElec_ = new Int_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_idAgainstElec_.data(), hadTau_idAgainstElec_); 
-    hadTau_idAgainstMu_ = new Int_t[max_nHadTaus_];
-    tree->SetBranchAddress(branchName_idAgainstMu_.data(), hadTau_idAgainstMu_);
-  }
+  nHadTaus_ = eventSource.getBuffer<Int_t>(branchName_num_);
+  hadTau_pt_ = eventSource.getArrayBuffer<Float_t>(branchName_pt_);
+  hadTau_eta_ = eventSource.getArrayBuffer<Float_t>(branchName_eta_);
+  hadTau_phi_ = eventSource.getArrayBuffer<Float_t>(branchName_phi_);
+  hadTau_mass_ = eventSource.getArrayBuffer<Float_t>(branchName_mass_);
+  hadTau_charge_ = eventSource.getArrayBuffer<Int_t>(branchName_charge_);
+  hadTau_dxy_ = eventSource.getArrayBuffer<Float_t>(branchName_dxy_);
+  hadTau_dz_ = eventSource.getArrayBuffer<Float_t>(branchName_dz_);
+  hadTau_idDecayMode_ = eventSource.getArrayBuffer<Int_t>(branchName_idDecayMode_);
+  hadTau_idDecayModeNewDMs_ = eventSource.getArrayBuffer<Int_t>(branchName_idDecayModeNewDMs_);
+  hadTau_idMVA_dR03_ = eventSource.getArrayBuffer<Int_t>(branchName_idMVA_dR03_);
+  hadTau_rawMVA_dR03_ = eventSource.getArrayBuffer<Float_t>(branchName_rawMVA_dR03_);
+  hadTau_idMVA_dR05_ = eventSource.getArrayBuffer<Int_t>(branchName_idMVA_dR05_);
+  hadTau_rawMVA_dR05_ = eventSource.getArrayBuffer<Float_t>(branchName_rawMVA_dR05_);
+  hadTau_idCombIso_dR03_ = eventSource.getArrayBuffer<Int_t>(branchName_idCombIso_dR03_);
+  //hadTau_rawCombIso_dR03_ = eventSource.getArrayBuffer<Float_t>(branchName_rawCombIso_dR03_); // CV: branch does not exist in VHbb Ntuples yet
+  hadTau_idCombIso_dR05_ = eventSource.getArrayBuffer<Int_t>(branchName_idCombIso_dR05_);
+  hadTau_rawCombIso_dR05_ = eventSource.getArrayBuffer<Float_t>(branchName_rawCombIso_dR05_);
+  hadTau_idAgainstElec_ = eventSource.getArrayBuffer<Int_t>(branchName_idAgainstElec_);
+  hadTau_idAgainstMu_ = eventSource.getArrayBuffer<Int_t>(branchName_idAgainstMu_);
 }
 
 std::vector<RecoHadTau> RecoHadTauReader::read() const
 {
-  RecoHadTauReader* gInstance = instances_[branchName_obj_];
-  assert(gInstance);
-  std::vector<RecoHadTau> hadTaus;
-  Int_t nHadTaus = gInstance->nHadTaus_;
-  if ( nHadTaus > max_nHadTaus_ ) {
+  return read(readView().indices_);
+}
+
+RecoHadTauCollectionView RecoHadTauReader::readView() const
+{
+  RecoHadTauCollectionView view;
+  readView(view);
+  return view;
+}
+
+void RecoHadTauReader::readView(RecoHadTauCollectionView& view) const
+{
+  Int_t nHadTaus = (*nHadTaus_);
+  if ( nHadTaus > hadTau_pt_.size() ) {
     throw cms::Exception("RecoHadTauReader") 
-      << "Number of hadronic taus stored in Ntuple = " << nHadTaus << ", exceeds max_nHadTaus = " << max_nHadTaus_ << " !!\n";
+      << "Number of hadronic taus stored in Ntuple = " << nHadTaus << ", exceeds size of branch buffers = " << hadTau_pt_.size() << " !!\n";
   }
-  hadTaus.reserve(nHadTaus);
+  view.pt_ = ColumnSpan<Float_t>(hadTau_pt_, nHadTaus);
+  view.eta_ = ColumnSpan<Float_t>(hadTau_eta_, nHadTaus);
+  view.phi_ = ColumnSpan<Float_t>(hadTau_phi_, nHadTaus);
+  view.mass_ = ColumnSpan<Float_t>(hadTau_mass_, nHadTaus);
+  view.charge_ = ColumnSpan<Int_t>(hadTau_charge_, nHadTaus);
+  view.dxy_ = ColumnSpan<Float_t>(hadTau_dxy_, nHadTaus);
+  view.dz_ = ColumnSpan<Float_t>(hadTau_dz_, nHadTaus);
+  view.decayModeFinding_ = ColumnSpan<Int_t>(hadTau_idDecayMode_, nHadTaus);
+  view.decayModeFindingNew_ = ColumnSpan<Int_t>(hadTau_idDecayModeNewDMs_, nHadTaus);
+  view.id_mva_dR03_ = ColumnSpan<Int_t>(hadTau_idMVA_dR03_, nHadTaus);
+  view.raw_mva_dR03_ = ColumnSpan<Float_t>(hadTau_rawMVA_dR03_, nHadTaus);
+  view.id_mva_dR05_ = ColumnSpan<Int_t>(hadTau_idMVA_dR05_, nHadTaus);
+  view.raw_mva_dR05_ = ColumnSpan<Float_t>(hadTau_rawMVA_dR05_, nHadTaus);
+  view.id_cut_dR03_ = ColumnSpan<Int_t>(hadTau_idCombIso_dR03_, nHadTaus);
+  view.raw_cut_dR03_ = ColumnSpan<Float_t>(get_rawCombIso_dR03(), nHadTaus);
+  view.id_cut_dR05_ = ColumnSpan<Int_t>(hadTau_idCombIso_dR05_, nHadTaus);
+  view.raw_cut_dR05_ = ColumnSpan<Float_t>(hadTau_rawCombIso_dR05_, nHadTaus);
+  view.antiElectron_ = ColumnSpan<Int_t>(hadTau_idAgainstElec_, nHadTaus);
+  view.antiMuon_ = ColumnSpan<Int_t>(hadTau_idAgainstMu_, nHadTaus);
+  view.indices_.clear();
+  view.indices_.reserve(nHadTaus);
   for ( Int_t idxHadTau = 0; idxHadTau < nHadTaus; ++idxHadTau ) {
-    hadTaus.push_back(RecoHadTau(
-      gInstance->hadTau_pt_[idxHadTau],
-      gInstance->hadTau_eta_[idxHadTau],
-      gInstance->hadTau_phi_[idxHadTau],
-      gInstance->hadTau_mass_[idxHadTau],
-      gInstance->hadTau_charge_[idxHadTau],
-      gInstance->hadTau_dxy_[idxHadTau],
-      gInstance->hadTau_dz_[idxHadTau],
-      gInstance->hadTau_idDecayMode_[idxHadTau],
-      gInstance->hadTau_idDecayModeNewDMs_[idxHadTau],
-      gInstance->hadTau_idMVA_dR03_[idxHadTau],
-      gInstance->hadTau_rawMVA_dR03_[idxHadTau],
-      gInstance->hadTau_idMVA_dR05_[idxHadTau],
-      gInstance->hadTau_rawMVA_dR05_[idxHadTau],	
-      gInstance->hadTau_idCombIso_dR03_[idxHadTau],
-      gInstance->hadTau_rawCombIso_dR03_[idxHadTau],
-      gInstance->hadTau_idCombIso_dR05_[idxHadTau],
-      gInstance->hadTau_rawCombIso_dR05_[idxHadTau],	
-      gInstance->hadTau_idAgainstElec_[idxHadTau],
-      gInstance->hadTau_idAgainstMu_[idxHadTau] ));
+    view.indices_.push_back(idxHadTau);
   }
+}
+
+std::vector<RecoHadTau> RecoHadTauReader::read(const std::vector<int>& indices) const
+{
+  std::vector<RecoHadTau> hadTaus;
+  read(indices, hadTaus);
   return hadTaus;
 }
+
+void RecoHadTauReader::read(const std::vector<int>& indices, std::vector<RecoHadTau>& hadTaus) const
+{
+  const Float_t* hadTau_rawCombIso_dR03 = get_rawCombIso_dR03();
+  hadTaus.clear();
+  hadTaus.reserve(indices.size());
+  for ( std::vector<int>::const_iterator idxHadTau = indices.begin();
+	idxHadTau != indices.end(); ++idxHadTau ) {
+    hadTaus.push_back(RecoHadTau(
+      hadTau_pt_[*idxHadTau],
+      hadTau_eta_[*idxHadTau],
+      hadTau_phi_[*idxHadTau],
+      hadTau_mass_[*idxHadTau],
+      hadTau_charge_[*idxHadTau],
+      hadTau_dxy_[*idxHadTau],
+      hadTau_dz_[*idxHadTau],
+      hadTau_idDecayMode_[*idxHadTau],
+      hadTau_idDecayModeNewDMs_[*idxHadTau],
+      hadTau_idMVA_dR03_[*idxHadTau],
+      hadTau_rawMVA_dR03_[*idxHadTau],
+      hadTau_idMVA_dR05_[*idxHadTau],
+      hadTau_rawMVA_dR05_[*idxHadTau],
+      hadTau_idCombIso_dR03_[*idxHadTau],
+      hadTau_rawCombIso_dR03[*idxHadTau],
+      hadTau_idCombIso_dR05_[*idxHadTau],
+      hadTau_rawCombIso_dR05_[*idxHadTau],
+      hadTau_idAgainstElec_[*idxHadTau],
+      hadTau_idAgainstMu_[*idxHadTau] ));
+  }
+}
+
+const Float_t* RecoHadTauReader::get_rawCombIso_dR03() const
+{
+  if ( hadTau_rawCombIso_dR03_ ) return hadTau_rawCombIso_dR03_;
+  // CV: branch does not exist in VHbb Ntuples yet, set to zero
+  if ( (int)hadTau_rawCombIso_dR03_default_.size() < hadTau_pt_.size() ) hadTau_rawCombIso_dR03_default_.resize(hadTau_pt_.size(), 0.);
+  return hadTau_rawCombIso_dR03_default_.data();
+}
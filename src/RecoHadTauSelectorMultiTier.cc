@@ -0,0 +1,86 @@
+#include "tthAnalysis/HiggsToTauTau/interface/RecoHadTauSelectorMultiTier.h" // RecoHadTauSelectorMultiTier
+
+#include "tthAnalysis/HiggsToTauTau/interface/RecoHadTauSelectorLoose.h" // RecoHadTauSelectorLoose
+#include "tthAnalysis/HiggsToTauTau/interface/RecoHadTauSelectorFakeable.h" // RecoHadTauSelectorFakeable
+#include "tthAnalysis/HiggsToTauTau/interface/RecoHadTauSelectorTight.h" // RecoHadTauSelectorTight
+
+#include <cmath> // fabs
+
+RecoHadTauSelectorMultiTier::RecoHadTauSelectorMultiTier()
+{
+//--- take the cut values from the single-tier selectors,
+//    so that each cut value is defined in one place only
+  RecoHadTauSelectorLoose selectorLoose;
+  RecoHadTauSelectorFakeable selectorFakeable;
+  RecoHadTauSelectorTight selectorTight;
+
+  min_pt_ = selectorLoose.min_pt_;
+  max_absEta_ = selectorLoose.max_absEta_;
+  max_dz_ = selectorLoose.max_dz_;
+  min_decayModeFinding_ = selectorLoose.min_decayModeFinding_;
+  min_id_mva_dR03_ = selectorLoose.min_id_mva_dR03_;
+  min_raw_mva_dR03_ = selectorLoose.min_raw_mva_dR03_;
+  min_id_mva_dR05_ = selectorLoose.min_id_mva_dR05_;
+  min_raw_mva_dR05_ = selectorLoose.min_raw_mva_dR05_;
+  min_id_cut_dR03_ = selectorLoose.min_id_cut_dR03_;
+  max_raw_cut_dR03_ = selectorLoose.max_raw_cut_dR03_;
+  min_antiElectron_ = selectorLoose.min_antiElectron_;
+  min_antiMuon_ = selectorLoose.min_antiMuon_;
+  min_id_cut_dR05_loose_ = selectorLoose.min_id_cut_dR05_;
+  max_raw_cut_dR05_loose_ = selectorLoose.max_raw_cut_dR05_;
+  min_id_cut_dR05_fakeable_ = selectorFakeable.min_id_cut_dR05_;
+  max_raw_cut_dR05_fakeable_ = selectorFakeable.max_raw_cut_dR05_;
+  min_id_cut_dR05_tight_ = selectorTight.min_id_cut_dR05_;
+  max_raw_cut_dR05_tight_ = selectorTight.max_raw_cut_dR05_;
+
+//--- check that the single-tier selectors have the structure assumed by operator(),
+//    i.e. that cuts tested only once for all selections have the same value in all of them
+  const std::string selector = "RecoHadTauSelectorMultiTier";
+  checkMultiTierCut(selector, "min_pt", selectorFakeable.min_pt_, min_pt_);
+  checkMultiTierCut(selector, "min_pt", selectorTight.min_pt_, min_pt_);
+  checkMultiTierCut(selector, "max_absEta", selectorFakeable.max_absEta_, max_absEta_);
+  checkMultiTierCut(selector, "max_absEta", selectorTight.max_absEta_, max_absEta_);
+  checkMultiTierCut(selector, "max_dz", selectorFakeable.max_dz_, max_dz_);
+  checkMultiTierCut(selector, "max_dz", selectorTight.max_dz_, max_dz_);
+  checkMultiTierCut(selector, "min_decayModeFinding", selectorFakeable.min_decayModeFinding_, min_decayModeFinding_);
+  checkMultiTierCut(selector, "min_decayModeFinding", selectorTight.min_decayModeFinding_, min_decayModeFinding_);
+  checkMultiTierCut(selector, "min_id_mva_dR03", selectorFakeable.min_id_mva_dR03_, min_id_mva_dR03_);
+  checkMultiTierCut(selector, "min_id_mva_dR03", selectorTight.min_id_mva_dR03_, min_id_mva_dR03_);
+  checkMultiTierCut(selector, "min_raw_mva_dR03", selectorFakeable.min_raw_mva_dR03_, min_raw_mva_dR03_);
+  checkMultiTierCut(selector, "min_raw_mva_dR03", selectorTight.min_raw_mva_dR03_, min_raw_mva_dR03_);
+  checkMultiTierCut(selector, "min_id_mva_dR05", selectorFakeable.min_id_mva_dR05_, min_id_mva_dR05_);
+  checkMultiTierCut(selector, "min_id_mva_dR05", selectorTight.min_id_mva_dR05_, min_id_mva_dR05_);
+  checkMultiTierCut(selector, "min_raw_mva_dR05", selectorFakeable.min_raw_mva_dR05_, min_raw_mva_dR05_);
+  checkMultiTierCut(selector, "min_raw_mva_dR05", selectorTight.min_raw_mva_dR05_, min_raw_mva_dR05_);
+  checkMultiTierCut(selector, "min_id_cut_dR03", selectorFakeable.min_id_cut_dR03_, min_id_cut_dR03_);
+  checkMultiTierCut(selector, "min_id_cut_dR03", selectorTight.min_id_cut_dR03_, min_id_cut_dR03_);
+  checkMultiTierCut(selector, "max_raw_cut_dR03", selectorFakeable.max_raw_cut_dR03_, max_raw_cut_dR03_);
+  checkMultiTierCut(selector, "max_raw_cut_dR03", selectorTight.max_raw_cut_dR03_, max_raw_cut_dR03_);
+  checkMultiTierCut(selector, "min_antiElectron", selectorFakeable.min_antiElectron_, min_antiElectron_);
+  checkMultiTierCut(selector, "min_antiElectron", selectorTight.min_antiElectron_, min_antiElectron_);
+  checkMultiTierCut(selector, "min_antiMuon", selectorFakeable.min_antiMuon_, min_antiMuon_);
+  checkMultiTierCut(selector, "min_antiMuon", selectorTight.min_antiMuon_, min_antiMuon_);
+}
+
+UChar_t RecoHadTauSelectorMultiTier::operator()(const RecoHadTau& hadTau) const
+{
+  UChar_t selectionFlags = 0;
+  if ( hadTau.pt_ >= min_pt_ &&
+       hadTau.absEta_ <= max_absEta_ &&
+       std::fabs(hadTau.dz_) <= max_dz_ &&
+       hadTau.decayModeFinding_ >= min_decayModeFinding_ &&
+       hadTau.id_mva_dR03_ >= min_id_mva_dR03_ &&
+       hadTau.raw_mva_dR03_ >= min_raw_mva_dR03_ &&
+       hadTau.id_mva_dR05_ >= min_id_mva_dR05_ &&
+       hadTau.raw_mva_dR05_ >= min_raw_mva_dR05_ &&
+       hadTau.id_cut_dR03_ >= min_id_cut_dR03_ &&
+       hadTau.raw_cut_dR03_ <= max_raw_cut_dR03_ &&
+       hadTau.antiElectron_ >= min_antiElectron_ &&
+       hadTau.antiMuon_ >= min_antiMuon_ ) {
+    // CV: the selections differ in the isolation cuts only
+    if ( hadTau.id_cut_dR05_ >= min_id_cut_dR05_loose_ && hadTau.raw_cut_dR05_ <= max_raw_cut_dR05_loose_ ) selectionFlags |= kSelectionLoose;
+    if ( hadTau.id_cut_dR05_ >= min_id_cut_dR05_fakeable_ && hadTau.raw_cut_dR05_ <= max_raw_cut_dR05_fakeable_ ) selectionFlags |= kSelectionFakeable;
+    if ( hadTau.id_cut_dR05_ >= min_id_cut_dR05_tight_ && hadTau.raw_cut_dR05_ <= max_raw_cut_dR05_tight_ ) selectionFlags |= kSelectionTight;
+  }
+  return selectionFlags;
+}
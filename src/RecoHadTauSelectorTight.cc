@@ -1,7 +1,5 @@
 #include "tthAnalysis/HiggsToTauTau/interface/RecoHadTauSelectorTight.h" // RecoHadTauSelectorTight
 
-#include <cmath> // fabs
-
 RecoHadTauSelectorTight::RecoHadTauSelectorTight()
   : min_pt_(20.)
   , max_absEta_(2.3)
@@ -21,21 +19,10 @@ RecoHadTauSelectorTight::RecoHadTauSelectorTight()
 
 bool RecoHadTauSelectorTight::operator()(const RecoHadTau& hadTau) const
 {
-  if ( hadTau.pt_ >= min_pt_ &&
-       hadTau.absEta_ <= max_absEta_ &&
-       std::fabs(hadTau.dz_) <= max_dz_ &&
-       hadTau.decayModeFinding_ >= min_decayModeFinding_ &&
-       hadTau.id_mva_dR03_ >= min_id_mva_dR03_ &&
-       hadTau.raw_mva_dR03_ >= min_raw_mva_dR03_ &&
-       hadTau.id_mva_dR05_ >= min_id_mva_dR05_ &&
-       hadTau.raw_mva_dR05_ >= min_raw_mva_dR05_ &&
-       hadTau.id_cut_dR03_ >= min_id_cut_dR03_ &&
-       hadTau.raw_cut_dR03_ <= max_raw_cut_dR03_ &&
-       hadTau.id_cut_dR05_ >= min_id_cut_dR05_ &&
-       hadTau.raw_cut_dR05_ <= max_raw_cut_dR05_ &&
-       hadTau.antiElectron_ >= min_antiElectron_ &&
-       hadTau.antiMuon_ >= min_antiMuon_ ) {
-    return true;
-  } 
-  return false;
+  return passesCuts(RecoHadTauAccessor(hadTau));
+}
+
+bool RecoHadTauSelectorTight::operator()(const RecoHadTauCollectionView& hadTaus, int idx) const
+{
+  return passesCuts(RecoHadTauViewAccessor(hadTaus, idx));
 }
@@ -4,13 +4,11 @@
 
 #include <TString.h> // Form
 
-std::map<std::string, int> RecoJetReader::numInstances_;
-std::map<std::string, RecoJetReader*> RecoJetReader::instances_;
-
 RecoJetReader::RecoJetReader()
-  : max_nJets_(32)
-  , branchName_num_("nJet")
+  : branchName_num_("nJet")
   , branchName_obj_("Jet")
+  , jetPt_option_(kJetPt_central)
+  , nJets_(0)
   , jet_pt_(0)
   , jet_eta_(0)
   , jet_phi_(0)
@@ -19,15 +17,15 @@ RecoJetReader::RecoJetReader()
   , jet_corr_JECUp_(0)
   , jet_corr_JECDown_(0) 
   , jet_BtagCSV_(0)
-  , jet_BtagWeight_(0)
 {
   setBranchNames();
 }
 
 RecoJetReader::RecoJetReader(const std::string& branchName_num, const std::string& branchName_obj)
-  : max_nJets_(32)
-  , branchName_num_(branchName_num)
+  : branchName_num_(branchName_num)
   , branchName_obj_(branchName_obj)
+  , jetPt_option_(kJetPt_central)
+  , nJets_(0)
   , jet_pt_(0)
   , jet_eta_(0)
   , jet_phi_(0)
@@ -36,121 +34,104 @@ RecoJetReader::RecoJetReader(const std::string& branchName_num, const std::strin
   , jet_corr_JECUp_(0)
   , jet_corr_JECDown_(0) 
   , jet_BtagCSV_(0)
-  , jet_BtagWeight_(0)
 {
   setBranchNames();
 }
 
 RecoJetReader::~RecoJetReader()
+{}
+
+void RecoJetReader::setBranchNames()
 {
-  --numInstances_[branchName_obj_];
-  assert(numInstances_[branchName_obj_] >= 0);
-  if ( numInstances_[branchName_obj_] == 0 ) {
-    RecoJetReader* gInstance = instances_[branchName_obj_];
-    assert(gInstance);
-    delete gInstance->jet_pt_;    
-    delete gInstance->jet_eta_;
-    delete gInstance->jet_phi_;
-    delete gInstance->jet_mass_;
-    delete gInstance->jet_corr_;
-    delete gInstance->jet_corr_JECUp_;
-    delete gInstance->jet_corr_JECDown_;
-    delete gInstance->jet_BtagCSV_;
-    delete gInstance->jet_BtagWeight_;
-    instances_[branchName_obj_] = 0;
-  }
+  branchName_pt_ = Form("%s_%s", branchName_obj_.data(), "pt");    
+  branchName_eta_ = Form("%s_%s", branchName_obj_.data(), "eta");
+  branchName_phi_ = Form("%s_%s", branchName_obj_.data(), "phi");
+  branchName_mass_ = Form("%s_%s", branchName_obj_.data(), "mass");
+  branchName_corr_ = Form("%s_%s", branchName_obj_.data(), "corr");
+  branchName_corr_JECUp_ = Form("%s_%s_%s", branchName_obj_.data(), "corr", "JECUp");
+  branchName_corr_JECDown_ = Form("%s_%s_%s", branchName_obj_.data(), "corr", "JECDown");
+  branchName_BtagCSV_ = Form("%s_%s", branchName_obj_.data(), "btagCSV");
+  branchName_BtagWeight_ = Form("%s_%s", branchName_obj_.data(), "bTagWeight");
 }
 
-void RecoJetReader::setBranchNames()
+void RecoJetReader::setBranchAddresses(EventSource& eventSource)
 {
-  if ( numInstances_[branchName_obj_] == 0 ) {
-    branchName_pt_ = Form("%s_%s", branchName_obj_.data(), "pt");    
-    branchName_eta_ = Form("%s_%s", branchName_obj_.data(), "eta");
-    branchName_phi_ = Form("%s_%s", branchName_obj_.data(), "phi");
-    branchName_mass_ = Form("%s_%s", branchName_obj_.data(), "mass");
-    branchName_corr_ = Form("%s_%s", branchName_obj_.data(), "corr");
-    branchName_corr_JECUp_ = Form("%s_%s_%s", branchName_obj_.data(), "corr", "JECUp");
-    branchName_corr_JECDown_ = Form("%s_%s_%s", branchName_obj_.data(), "corr", "JECDown");
-    branchName_BtagCSV_ = Form("%s_%s", branchName_obj_.data(), "btagCSV");
-    branchName_BtagWeight_ = Form("%s_%s", branchName_obj_.data(), "bTagWeight");
-    instances_[branchName_obj_] = this;
-  } else {
-    if ( branchName_num_ != instances_[branchName_obj_]->branchName_num_ ) {
-      throw cms::Exception("RecoJetReader") 
-	<< "Association between configuration parameters 'branchName_num' and 'branchName_obj' must be unique:"
-	<< " present association 'branchName_num' = " << branchName_num_ << " with 'branchName_obj' = " << branchName_obj_ 
-	<< " does not match previous association 'branchName_num' = " << instances_[branchName_obj_]->branchName_num_ << " with 'branchName_obj' = " << instances_[branchName_obj_]->branchName_obj_ << " !!\n";
+  nJets_ = eventSource.getBuffer<Int_t>(branchName_num_);
+  jet_pt_ = eventSource.getArrayBuffer<Float_t>(branchName_pt_);
+  jet_eta_ = eventSource.getArrayBuffer<Float_t>(branchName_eta_);
+  jet_phi_ = eventSource.getArrayBuffer<Float_t>(branchName_phi_);
+  jet_mass_ = eventSource.getArrayBuffer<Float_t>(branchName_mass_);
+  jet_corr_ = eventSource.getArrayBuffer<Float_t>(branchName_corr_);
+  jet_corr_JECUp_ = eventSource.getArrayBuffer<Float_t>(branchName_corr_JECUp_);
+  jet_corr_JECDown_ = eventSource.getArrayBuffer<Float_t>(branchName_corr_JECDown_);
+  jet_BtagCSV_ = eventSource.getArrayBuffer<Float_t>(branchName_BtagCSV_);
+  std::vector<std::string> branchNames_BtagWeight;
+  branchNames_BtagWeight.push_back(branchName_BtagWeight_);
+  branchNames_BtagWeight.insert(branchNames_BtagWeight.end(), branchNames_BtagWeight_shifts_.begin(), branchNames_BtagWeight_shifts_.end());
+  for ( std::vector<std::string>::const_iterator branchName_BtagWeight = branchNames_BtagWeight.begin();
+	branchName_BtagWeight != branchNames_BtagWeight.end(); ++branchName_BtagWeight ) {
+    if ( jet_BtagWeights_.find(*branchName_BtagWeight) != jet_BtagWeights_.end() ) continue;
+    BranchBuffer<Float_t> jet_BtagWeight; // CV: no buffer in case b-tagging weight branch name is empty, weights set to one in that case
+    if ( (*branchName_BtagWeight) != "" ) {
+      jet_BtagWeight = eventSource.getArrayBuffer<Float_t>(*branchName_BtagWeight);
     }
+    jet_BtagWeights_[*branchName_BtagWeight] = jet_BtagWeight;
   }
-  ++numInstances_[branchName_obj_];
 }
 
-namespace
+std::vector<RecoJet> RecoJetReader::read() const
 {
-  void initializeArray(Float_t* array, int numElements, double value = 0.)
-  {
-    for ( int idxElement = 0; idxElement < numElements; ++idxElement ) {
-      array[idxElement] = value;
-    }
-  }
+  return read(jetPt_option_, branchName_BtagWeight_);
 }
 
-void RecoJetReader::setBranchAddresses(TTree* tree)
+std::vector<RecoJet> RecoJetReader::read(int jetPt_option, const std::string& branchName_BtagWeight) const
 {
-  if ( instances_[branchName_obj_] == this ) {
-    tree->SetBranchAddress(branchName_num_.data(), &nJets_);   
-    jet_pt_ = new Float_t[max_nJets_];
-    tree->SetBranchAddress(branchName_pt_.data(), jet_pt_); 
-    jet_eta_ = new Float_t[max_nJets_];
-    tree->SetBranchAddress(branchName_eta_.data(), jet_eta_); 
-    jet_phi_ = new Float_t[max_nJets_];
-    tree->SetBranchAddress(branchName_phi_.data(), jet_phi_); 
-    jet_mass_ = new Float_t[max_nJets_];
-    tree->SetBranchAddress(branchName_mass_.data(), jet_mass_); 
-    jet_corr_ = new Float_t[max_nJets_];
-    tree->SetBranchAddress(branchName_corr_.data(), jet_corr_); 
-    jet_corr_JECUp_ = new Float_t[max_nJets_];
-    tree->SetBranchAddress(branchName_corr_JECUp_.data(), jet_corr_JECUp_); 
-    jet_corr_JECDown_ = new Float_t[max_nJets_];
-    tree->SetBranchAddress(branchName_corr_JECDown_.data(), jet_corr_JECDown_);     
-    jet_BtagCSV_ = new Float_t[max_nJets_];
-    tree->SetBranchAddress(branchName_BtagCSV_.data(), jet_BtagCSV_); 
-    jet_BtagWeight_ = new Float_t[max_nJets_];
-    if ( branchName_BtagWeight_ != "" ) {
-      tree->SetBranchAddress(branchName_BtagWeight_.data(), jet_BtagWeight_); 
-    } else {
-      initializeArray(jet_BtagWeight_, max_nJets_, 1.);
-    }
+  std::vector<RecoJet> jets;
+  read(jetPt_option, branchName_BtagWeight, jets);
+  return jets;
+}
+
+const Float_t* RecoJetReader::getBtagWeights(const std::string& branchName_BtagWeight) const
+{
+  std::map<std::string, BranchBuffer<Float_t> >::const_iterator jet_BtagWeight_buffer = jet_BtagWeights_.find(branchName_BtagWeight);
+  if ( jet_BtagWeight_buffer == jet_BtagWeights_.end() ) {
+    throw cms::Exception("RecoJetReader") 
+      << "No branch address set for b-tagging weight branch = " << branchName_BtagWeight << " !!\n";
   }
+  const Float_t* jet_BtagWeight = jet_BtagWeight_buffer->second;
+  if ( !jet_BtagWeight ) {
+    Int_t nJets = (*nJets_);
+    if ( (int)jet_BtagWeight_default_.size() < nJets ) jet_BtagWeight_default_.resize(nJets, 1.);
+    jet_BtagWeight = jet_BtagWeight_default_.data();
+  }
+  return jet_BtagWeight;
 }
 
-std::vector<RecoJet> RecoJetReader::read() const
+void RecoJetReader::read(int jetPt_option, const std::string& branchName_BtagWeight, std::vector<RecoJet>& jets) const
 {
-  RecoJetReader* gInstance = instances_[branchName_obj_];
-  assert(gInstance);
-  std::vector<RecoJet> jets;
-  Int_t nJets = gInstance->nJets_;
-  if ( nJets > max_nJets_ ) {
+  Int_t nJets = (*nJets_);
+  if ( nJets > jet_pt_.size() ) {
     throw cms::Exception("RecoJetReader") 
-      << "Number of jets stored in Ntuple = " << nJets << ", exceeds max_nJets = " << max_nJets_ << " !!\n";
+      << "Number of jets stored in Ntuple = " << nJets << ", exceeds size of branch buffers = " << jet_pt_.size() << " !!\n";
   }
+  const Float_t* jet_BtagWeight = getBtagWeights(branchName_BtagWeight);
+  jets.clear();
   jets.reserve(nJets);
   for ( Int_t idxJet = 0; idxJet < nJets; ++idxJet ) {
     Float_t jet_pt = -1.;
-    if      ( jetPt_option_ == kJetPt_central ) jet_pt = jet_pt_[idxJet];
-    else if ( jetPt_option_ == kJetPt_jecUp   ) jet_pt = jet_pt_[idxJet]*jet_corr_JECUp_[idxJet]/jet_corr_[idxJet];
-    else if ( jetPt_option_ == kJetPt_jecDown ) jet_pt = jet_pt_[idxJet]*jet_corr_JECDown_[idxJet]/jet_corr_[idxJet];    
+    if      ( jetPt_option == kJetPt_central ) jet_pt = jet_pt_[idxJet];
+    else if ( jetPt_option == kJetPt_jecUp   ) jet_pt = jet_pt_[idxJet]*jet_corr_JECUp_[idxJet]/jet_corr_[idxJet];
+    else if ( jetPt_option == kJetPt_jecDown ) jet_pt = jet_pt_[idxJet]*jet_corr_JECDown_[idxJet]/jet_corr_[idxJet];    
     jets.push_back(RecoJet(
       jet_pt,      
-      gInstance->jet_eta_[idxJet],
-      gInstance->jet_phi_[idxJet],
-      gInstance->jet_mass_[idxJet],
-      gInstance->jet_corr_[idxJet],
-      gInstance->jet_corr_JECUp_[idxJet],
-      gInstance->jet_corr_JECDown_[idxJet],
-      gInstance->jet_BtagCSV_[idxJet],
-      gInstance->jet_BtagWeight_[idxJet],	
+      jet_eta_[idxJet],
+      jet_phi_[idxJet],
+      jet_mass_[idxJet],
+      jet_corr_[idxJet],
+      jet_corr_JECUp_[idxJet],
+      jet_corr_JECDown_[idxJet],
+      jet_BtagCSV_[idxJet],
+      jet_BtagWeight[idxJet],	
       idxJet ));
   }
-  return jets;
 }
@@ -32,7 +32,4 @@ RecoLepton::RecoLepton(Double_t pt,
   , jetBtagCSV_(jetBtagCSV)  
   , tightCharge_(tightCharge)
   , charge_(charge)
-  , genLepton_(0)
-  , genHadTau_(0)
-  , genJet_(0)
 {}
@@ -4,13 +4,12 @@
 
 #include <TString.h> // Form
 
-std::map<std::string, int> RecoLeptonReader::numInstances_;
-std::map<std::string, RecoLeptonReader*> RecoLeptonReader::instances_;
+#include <cstdlib> // std::abs()
 
 RecoLeptonReader::RecoLeptonReader()
-  : max_nLeptons_(32)
-  , branchName_num_("nselLeptons")
+  : branchName_num_("nselLeptons")
   , branchName_obj_("selLeptons")
+  , nLeptons_(0)
   , pt_(0)
   , eta_(0)
   , phi_(0)
@@ -34,9 +33,9 @@ RecoLeptonReader::RecoLeptonReader()
 }
 
 RecoLeptonReader::RecoLeptonReader(const std::string& branchName_num, const std::string& branchName_obj)
-  : max_nLeptons_(32)
-  , branchName_num_(branchName_num)
+  : branchName_num_(branchName_num)
   , branchName_obj_(branchName_obj)
+  , nLeptons_(0)
   , pt_(0)
   , eta_(0)
   , phi_(0)
@@ -60,109 +59,84 @@ RecoLeptonReader::RecoLeptonReader(const std::string& branchName_num, const std:
 }
 
 RecoLeptonReader::~RecoLeptonReader()
+{}
+
+void RecoLeptonReader::setBranchNames()
 {
-  --numInstances_[branchName_obj_];
-  assert(numInstances_[branchName_obj_] >= 0);
-  if ( numInstances_[branchName_obj_] == 0 ) {
-    RecoLeptonReader* gInstance = instances_[branchName_obj_];
-    assert(gInstance);
-    delete gInstance->pt_;
-    delete gInstance->eta_;
-    delete gInstance->phi_;
-    delete gInstance->mass_;
-    delete gInstance->pdgId_;
-    delete gInstance->dxy_;
-    delete gInstance->dz_;
-    delete gInstance->relIso_;
-    delete gInstance->miniIsoCharged_;
-    delete gInstance->miniIsoNeutral_;
-    delete gInstance->sip3d_;
-    delete gInstance->mvaRawTTH_;
-    delete gInstance->jetNDauChargedMVASel_;
-    delete gInstance->jetPtRel_;
-    delete gInstance->jetPtRatio_;
-    delete gInstance->jetBtagCSV_;
-    delete gInstance->tightCharge_;
-    delete gInstance->charge_;
-    instances_[branchName_obj_] = 0;
-  }
+  branchName_pt_ = Form("%s_%s", branchName_obj_.data(), "pt");
+  branchName_eta_ = Form("%s_%s", branchName_obj_.data(), "eta");
+  branchName_phi_ = Form("%s_%s", branchName_obj_.data(), "phi");
+  branchName_mass_ = Form("%s_%s", branchName_obj_.data(), "mass");
+  branchName_pdgId_ = Form("%s_%s", branchName_obj_.data(), "pdgId");
+  branchName_dxy_ = Form("%s_%s", branchName_obj_.data(), "dxy");
+  branchName_dz_ = Form("%s_%s", branchName_obj_.data(), "dz");
+  branchName_relIso_ = Form("%s_%s", branchName_obj_.data(), "miniRelIso");
+  branchName_miniIsoCharged_ = Form("%s_%s", branchName_obj_.data(), "miniIsoCharged");
+  branchName_miniIsoNeutral_ = Form("%s_%s", branchName_obj_.data(), "miniIsoNeutral");
+  branchName_sip3d_ = Form("%s_%s", branchName_obj_.data(), "sip3d");
+  branchName_mvaRawTTH_ = Form("%s_%s", branchName_obj_.data(), "mvaTTH");
+  branchName_jetNDauChargedMVASel_ = Form("%s_%s", branchName_obj_.data(), "mvaTTHjetNDauChargedMVASel");
+  branchName_jetPtRel_ = Form("%s_%s", branchName_obj_.data(), "mvaTTHjetPtRel");
+  branchName_jetPtRatio_ = Form("%s_%s", branchName_obj_.data(), "jetPtRatio");
+  branchName_jetBtagCSV_ = Form("%s_%s", branchName_obj_.data(), "jetBTagCSV");
+  branchName_tightCharge_ = Form("%s_%s", branchName_obj_.data(), "tightCharge");
+  branchName_charge_ = Form("%s_%s", branchName_obj_.data(), "charge");
 }
 
-void RecoLeptonReader::setBranchNames()
+void RecoLeptonReader::setBranchAddresses(EventSource& eventSource)
 {
-  if ( numInstances_[branchName_obj_] == 0 ) {
-    branchName_pt_ = Form("%s_%s", branchName_obj_.data(), "pt");
-    branchName_eta_ = Form("%s_%s", branchName_obj_.data(), "eta");
-    branchName_phi_ = Form("%s_%s", branchName_obj_.data(), "phi");
-    branchName_mass_ = Form("%s_%s", branchName_obj_.data(), "mass");
-    branchName_pdgId_ = Form("%s_%s", branchName_obj_.data(), "pdgId");
-    branchName_dxy_ = Form("%s_%s", branchName_obj_.data(), "dxy");
-    branchName_dz_ = Form("%s_%s", branchName_obj_.data(), "dz");
-    branchName_relIso_ = Form("%s_%s", branchName_obj_.data(), "miniRelIso");
-    branchName_miniIsoCharged_ = Form("%s_%s", branchName_obj_.data(), "miniIsoCharged");
-    branchName_miniIsoNeutral_ = Form("%s_%s", branchName_obj_.data(), "miniIsoNeutral");
-    branchName_sip3d_ = Form("%s_%s", branchName_obj_.data(), "sip3d");
-    branchName_mvaRawTTH_ = Form("%s_%s", branchName_obj_.data(), "mvaTTH");
-    branchName_jetNDauChargedMVASel_ = Form("%s_%s", branchName_obj_.data(), "mvaTTHjetNDauChargedMVASel");
-    branchName_jetPtRel_ = Form("%s_%s", branchName_obj_.data(), "mvaTTHjetPtRel");
-    branchName_jetPtRatio_ = Form("%s_%s", branchName_obj_.data(), "jetPtRatio");
-    branchName_jetBtagCSV_ = Form("%s_%s", branchName_obj_.data(), "jetBTagCSV");
-    branchName_tightCharge_ = Form("%s_%s", branchName_obj_.data(), "tightCharge");
-    branchName_charge_ = Form("%s_%s", branchName_obj_.data(), "charge");
-    instances_[branchName_obj_] = this;
-  } else {
-    if ( branchName_num_ != instances_[branchName_obj_]->branchName_num_ ) {
-      throw cms::Exception("RecoLeptonReader") 
-	<< "Association between configuration parameters 'branchName_num' and 'branchName_obj' must be unique:"
-	<< " present association 'branchName_num' = " << branchName_num_ << " with 'branchName_obj' = " << branchName_obj_ 
-	<< " does not match previous association 'branchName_num' = " << instances_[branchName_obj_]->branchName_num_ << " with 'branchName_obj' = " << instances_[branchName_obj_]->branchName_obj_ << " !!\n";
-    }
-  }
-  ++numInstances_[branchName_obj_];
+  //std::cout << "<RecoLeptonReader::setBranchAddresses>:" << std::endl;
+  //std::cout << " branchName_num = " << branchName_num_ << std::endl;
+  //std::cout << " branchName_obj = " << branchName_obj_ << std::endl;
+  nLeptons_ = eventSource.getBuffer<Int_t>(branchName_num_);
+  pt_ = eventSource.getArrayBuffer<Float_t>(branchName_pt_);
+  eta_ = eventSource.getArrayBuffer<Float_t>(branchName_eta_);
+  phi_ = eventSource.getArrayBuffer<Float_t>(branchName_phi_);
+  mass_ = eventSource.getArrayBuffer<Float_t>(branchName_mass_);
+  pdgId_ = eventSource.getArrayBuffer<Int_t>(branchName_pdgId_);
+  dxy_ = eventSource.getArrayBuffer<Float_t>(branchName_dxy_);
+  dz_ = eventSource.getArrayBuffer<Float_t>(branchName_dz_);
+  relIso_ = eventSource.getArrayBuffer<Float_t>(branchName_relIso_);
+  miniIsoCharged_ = eventSource.getArrayBuffer<Float_t>(branchName_miniIsoCharged_);
+  miniIsoNeutral_ = eventSource.getArrayBuffer<Float_t>(branchName_miniIsoNeutral_);
+  sip3d_ = eventSource.getArrayBuffer<Float_t>(branchName_sip3d_);
+  mvaRawTTH_ = eventSource.getArrayBuffer<Float_t>(branchName_mvaRawTTH_);
+  jetNDauChargedMVASel_ = eventSource.getArrayBuffer<Float_t>(branchName_jetNDauChargedMVASel_);
+  jetPtRel_ = eventSource.getArrayBuffer<Float_t>(branchName_jetPtRel_);
+  jetPtRatio_ = eventSource.getArrayBuffer<Float_t>(branchName_jetPtRatio_);
+  jetBtagCSV_ = eventSource.getArrayBuffer<Float_t>(branchName_jetBtagCSV_);
+  tightCharge_ = eventSource.getArrayBuffer<Int_t>(branchName_tightCharge_);
+  charge_ = eventSource.getArrayBuffer<Int_t>(branchName_charge_);
 }
 
-void RecoLeptonReader::setBranchAddresses(TTree* tree)
+void RecoLeptonReader::fillView(RecoLeptonCollectionView& view, int absPdgId) const
 {
-  if ( instances_[branchName_obj_] == this ) {
-    //std::cout << "<RecoLeptonReader::setBranchAddresses>:" << std::endl;
-    //std::cout << " branchName_num = " << branchName_num_ << std::endl;
-    //std::cout << " branchName_obj = " << branchName_obj_ << std::endl;
-    tree->SetBranchAddress(branchName_num_.data(), &nLeptons_);   
-    pt_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_pt_.data(), pt_); 
-    eta_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_eta_.data(), eta_); 
-    phi_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_phi_.data(), phi_); 
-    mass_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_mass_.data(), mass_); 
-    pdgId_ = new Int_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_pdgId_.data(), pdgId_); 
-    dxy_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_dxy_.data(), dxy_); 
-    dz_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_dz_.data(), dz_); 
-    relIso_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_relIso_.data(), relIso_);
-    miniIsoCharged_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_miniIsoCharged_.data(), miniIsoCharged_);
-    miniIsoNeutral_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_miniIsoNeutral_.data(), miniIsoNeutral_);
-    sip3d_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_sip3d_.data(), sip3d_); 
-    mvaRawTTH_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_mvaRawTTH_.data(), mvaRawTTH_); 
-    jetNDauChargedMVASel_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_jetNDauChargedMVASel_.data(), jetNDauChargedMVASel_);
-    jetPtRel_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_jetPtRel_.data(), jetPtRel_);
-    jetPtRatio_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_jetPtRatio_.data(), jetPtRatio_);
-    jetBtagCSV_ = new Float_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_jetBtagCSV_.data(), jetBtagCSV_);
-    tightCharge_ = new Int_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_tightCharge_.data(), tightCharge_);
-    charge_ = new Int_t[max_nLeptons_];
-    tree->SetBranchAddress(branchName_charge_.data(), charge_);
+  Int_t nLeptons = (*nLeptons_);
+  if ( nLeptons > pt_.size() ) {
+    throw cms::Exception("RecoLeptonReader") 
+      << "Number of leptons stored in Ntuple = " << nLeptons << ", exceeds size of branch buffers = " << pt_.size() << " !!\n";
+  }
+  view.pt_ = ColumnSpan<Float_t>(pt_, nLeptons);
+  view.eta_ = ColumnSpan<Float_t>(eta_, nLeptons);
+  view.phi_ = ColumnSpan<Float_t>(phi_, nLeptons);
+  view.mass_ = ColumnSpan<Float_t>(mass_, nLeptons);
+  view.pdgId_ = ColumnSpan<Int_t>(pdgId_, nLeptons);
+  view.dxy_ = ColumnSpan<Float_t>(dxy_, nLeptons);
+  view.dz_ = ColumnSpan<Float_t>(dz_, nLeptons);
+  view.relIso_ = ColumnSpan<Float_t>(relIso_, nLeptons);
+  view.miniIsoCharged_ = ColumnSpan<Float_t>(miniIsoCharged_, nLeptons);
+  view.miniIsoNeutral_ = ColumnSpan<Float_t>(miniIsoNeutral_, nLeptons);
+  view.sip3d_ = ColumnSpan<Float_t>(sip3d_, nLeptons);
+  view.mvaRawTTH_ = ColumnSpan<Float_t>(mvaRawTTH_, nLeptons);
+  view.jetNDauChargedMVASel_ = ColumnSpan<Float_t>(jetNDauChargedMVASel_, nLeptons);
+  view.jetPtRel_ = ColumnSpan<Float_t>(jetPtRel_, nLeptons);
+  view.jetPtRatio_ = ColumnSpan<Float_t>(jetPtRatio_, nLeptons);
+  view.jetBtagCSV_ = ColumnSpan<Float_t>(jetBtagCSV_, nLeptons);
+  view.tightCharge_ = ColumnSpan<Int_t>(tightCharge_, nLeptons);
+  view.charge_ = ColumnSpan<Int_t>(charge_, nLeptons);
+  view.indices_.clear();
+  view.indices_.reserve(nLeptons);
+  for ( Int_t idxLepton = 0; idxLepton < nLeptons; ++idxLepton ) {
+    if ( std::abs(pdgId_[idxLepton]) == absPdgId ) view.indices_.push_back(idxLepton);
   }
 }
@@ -4,9 +4,6 @@
 
 #include <TString.h> // Form
 
-std::map<std::string, int> RecoMuonReader::numInstances_;
-std::map<std::string, RecoMuonReader*> RecoMuonReader::instances_;
-
 RecoMuonReader::RecoMuonReader()
   : branchName_num_("nselLeptons")
   , branchName_obj_("selLeptons")
@@ -41,101 +38,91 @@ RecoMuonReader::RecoMuonReader(const std::string& branchName_num, const std::str
 
 RecoMuonReader::~RecoMuonReader()
 {
-  --numInstances_[branchName_obj_];
-  assert(numInstances_[branchName_obj_] >= 0);
-  if ( numInstances_[branchName_obj_] == 0 ) {
-    RecoMuonReader* gInstance = instances_[branchName_obj_];
-    assert(gInstance);
-    delete gInstance->looseIdPOG_;
-    delete gInstance->mediumIdPOG_;
-#ifdef DPT_DIV_PT
-    delete gInstance->dpt_div_pt_;
-#endif
-    delete gInstance->segmentCompatibility_;
-    instances_[branchName_obj_] = 0;
-  }
+  delete leptonReader_;
 }
 
 void RecoMuonReader::setBranchNames()
 {
-  if ( numInstances_[branchName_obj_] == 0 ) {
-    branchName_looseIdPOG_ = Form("%s_%s", branchName_obj_.data(), "looseIdPOG");
-    branchName_mediumIdPOG_ = Form("%s_%s", branchName_obj_.data(), "mediumMuonId");
+  branchName_looseIdPOG_ = Form("%s_%s", branchName_obj_.data(), "looseIdPOG");
+  branchName_mediumIdPOG_ = Form("%s_%s", branchName_obj_.data(), "mediumMuonId");
 #ifdef DPT_DIV_PT
-    branchName_dpt_div_pt_ = Form("%s_%s", branchName_obj_.data(), "dpt_div_pt");
+  branchName_dpt_div_pt_ = Form("%s_%s", branchName_obj_.data(), "dpt_div_pt");
 #endif
-    branchName_segmentCompatibility_ = Form("%s_%s", branchName_obj_.data(), "segmentCompatibility");
-    instances_[branchName_obj_] = this;
-  } else {
-    if ( branchName_num_ != instances_[branchName_obj_]->branchName_num_ ) {
-      throw cms::Exception("RecoMuonReader") 
-	<< "Association between configuration parameters 'branchName_num' and 'branchName_obj' must be unique:"
-	<< " present association 'branchName_num' = " << branchName_num_ << " with 'branchName_obj' = " << branchName_obj_ 
-	<< " does not match previous association 'branchName_num' = " << instances_[branchName_obj_]->branchName_num_ << " with 'branchName_obj' = " << instances_[branchName_obj_]->branchName_obj_ << " !!\n";
-    }
-  }
-  ++numInstances_[branchName_obj_];
+  branchName_segmentCompatibility_ = Form("%s_%s", branchName_obj_.data(), "segmentCompatibility");
 }
 
-void RecoMuonReader::setBranchAddresses(TTree* tree)
+void RecoMuonReader::setBranchAddresses(EventSource& eventSource)
 {
-  if ( instances_[branchName_obj_] == this ) {
-    leptonReader_->setBranchAddresses(tree);
-    int max_nLeptons = leptonReader_->max_nLeptons_;
-    looseIdPOG_ = new Int_t[max_nLeptons];
-    tree->SetBranchAddress(branchName_looseIdPOG_.data(), looseIdPOG_);
-    mediumIdPOG_ = new Int_t[max_nLeptons];
-    tree->SetBranchAddress(branchName_mediumIdPOG_.data(), mediumIdPOG_);
+  leptonReader_->setBranchAddresses(eventSource);
+  looseIdPOG_ = eventSource.getArrayBuffer<Int_t>(branchName_looseIdPOG_);
+  mediumIdPOG_ = eventSource.getArrayBuffer<Int_t>(branchName_mediumIdPOG_);
 #ifdef DPT_DIV_PT
-    dpt_div_pt_ = new Float_t[max_nLeptons];
-    tree->SetBranchAddress(branchName_dpt_div_pt_.data(), dpt_div_pt_);
+  dpt_div_pt_ = eventSource.getArrayBuffer<Float_t>(branchName_dpt_div_pt_);
 #endif
-    segmentCompatibility_ = new Float_t[max_nLeptons];
-    tree->SetBranchAddress(branchName_segmentCompatibility_.data(), segmentCompatibility_);
-  }
+  segmentCompatibility_ = eventSource.getArrayBuffer<Float_t>(branchName_segmentCompatibility_);
 }
 
 std::vector<RecoMuon> RecoMuonReader::read() const
 {
-  RecoLeptonReader* gLeptonReader = leptonReader_->instances_[branchName_obj_];
-  assert(gLeptonReader);
-  RecoMuonReader* gMuonReader = instances_[branchName_obj_];
-  assert(gMuonReader);
+  return read(readView().indices_);
+}
+
+RecoMuonCollectionView RecoMuonReader::readView() const
+{
+  RecoMuonCollectionView view;
+  readView(view);
+  return view;
+}
+
+void RecoMuonReader::readView(RecoMuonCollectionView& view) const
+{
+  leptonReader_->fillView(view, 13);
+  Int_t nLeptons = (*leptonReader_->nLeptons_);
+  view.passesLooseIdPOG_ = ColumnSpan<Int_t>(looseIdPOG_, nLeptons);
+  view.passesMediumIdPOG_ = ColumnSpan<Int_t>(mediumIdPOG_, nLeptons);
+#ifdef DPT_DIV_PT
+  view.dpt_div_pt_ = ColumnSpan<Float_t>(dpt_div_pt_, nLeptons);
+#endif
+  view.segmentCompatibility_ = ColumnSpan<Float_t>(segmentCompatibility_, nLeptons);
+}
+
+std::vector<RecoMuon> RecoMuonReader::read(const std::vector<int>& indices) const
+{
   std::vector<RecoMuon> muons;
-  Int_t nLeptons = gLeptonReader->nLeptons_;
-  if ( nLeptons > leptonReader_->max_nLeptons_ ) {
-    throw cms::Exception("RecoMuonReader") 
-      << "Number of leptons stored in Ntuple = " << nLeptons << ", exceeds max_nLeptons = " << leptonReader_->max_nLeptons_ << " !!\n";
-  }
-  muons.reserve(nLeptons);
-  for ( Int_t idxLepton = 0; idxLepton < nLeptons; ++idxLepton ) {
-    if ( std::abs(gLeptonReader->pdgId_[idxLepton]) == 13 ) {
-      muons.push_back(RecoMuon({ 
-        gLeptonReader->pt_[idxLepton],
-        gLeptonReader->eta_[idxLepton],
-        gLeptonReader->phi_[idxLepton],
-        gLeptonReader->mass_[idxLepton],
-        gLeptonReader->pdgId_[idxLepton],
-        gLeptonReader->dxy_[idxLepton],
-        gLeptonReader->dz_[idxLepton],
-        gLeptonReader->relIso_[idxLepton],
-        gLeptonReader->miniIsoCharged_[idxLepton],
-        gLeptonReader->miniIsoNeutral_[idxLepton],
-        gLeptonReader->sip3d_[idxLepton],
-        gLeptonReader->mvaRawTTH_[idxLepton],
-        gLeptonReader->jetNDauChargedMVASel_[idxLepton],
-        gLeptonReader->jetPtRel_[idxLepton],
-        gLeptonReader->jetPtRatio_[idxLepton],
-        gLeptonReader->jetBtagCSV_[idxLepton],
-        gLeptonReader->tightCharge_[idxLepton],
-        gLeptonReader->charge_[idxLepton],
-        gMuonReader->looseIdPOG_[idxLepton],
-        gMuonReader->mediumIdPOG_[idxLepton],
+  read(indices, muons);
+  return muons;
+}
+
+void RecoMuonReader::read(const std::vector<int>& indices, std::vector<RecoMuon>& muons) const
+{
+  muons.clear();
+  muons.reserve(indices.size());
+  for ( std::vector<int>::const_iterator idxLepton = indices.begin();
+	idxLepton != indices.end(); ++idxLepton ) {
+    muons.push_back(RecoMuon({ 
+      leptonReader_->pt_[*idxLepton],
+      leptonReader_->eta_[*idxLepton],
+      leptonReader_->phi_[*idxLepton],
+      leptonReader_->mass_[*idxLepton],
+      leptonReader_->pdgId_[*idxLepton],
+      leptonReader_->dxy_[*idxLepton],
+      leptonReader_->dz_[*idxLepton],
+      leptonReader_->relIso_[*idxLepton],
+      leptonReader_->miniIsoCharged_[*idxLepton],
+      leptonReader_->miniIsoNeutral_[*idxLepton],
+      leptonReader_->sip3d_[*idxLepton],
+      leptonReader_->mvaRawTTH_[*idxLepton],
+      leptonReader_->jetNDauChargedMVASel_[*idxLepton],
+      leptonReader_->jetPtRel_[*idxLepton],
+      leptonReader_->jetPtRatio_[*idxLepton],
+      leptonReader_->jetBtagCSV_[*idxLepton],
+      leptonReader_->tightCharge_[*idxLepton],
+      leptonReader_->charge_[*idxLepton],
+      looseIdPOG_[*idxLepton],
+      mediumIdPOG_[*idxLepton],
 #ifdef DPT_DIV_PT
-        gMuonReader->dpt_div_pt_[idxLepton],
+      dpt_div_pt_[*idxLepton],
 #endif
-        gMuonReader->segmentCompatibility_[idxLepton] }));
-    }
+      segmentCompatibility_[*idxLepton] }));
   }
-  return muons;
 }
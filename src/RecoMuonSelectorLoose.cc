@@ -1,7 +1,5 @@
 #include "tthAnalysis/HiggsToTauTau/interface/RecoMuonSelectorLoose.h" // RecoMuonSelectorLoose
 
-#include <cmath> // fabs
-
 RecoMuonSelectorLoose::RecoMuonSelectorLoose()
   : min_pt_(5.)
   , max_absEta_(2.4)
@@ -16,15 +14,10 @@ RecoMuonSelectorLoose::RecoMuonSelectorLoose()
 
 bool RecoMuonSelectorLoose::operator()(const RecoMuon& muon) const
 {
-  if ( muon.pt_ >= min_pt_ &&
-       muon.absEta_ <= max_absEta_ &&
-       std::fabs(muon.dxy_) <= max_dxy_ &&
-       std::fabs(muon.dz_) <= max_dz_ &&
-       muon.relIso_ <= max_relIso_ &&
-       muon.sip3d_ <= max_sip3d_ &&
-       (muon.passesLooseIdPOG_ || !apply_looseIdPOG_) && 
-       (muon.passesMediumIdPOG_ || !apply_mediumIdPOG_) ) {
-    return true;
-  }
-  return false;
+  return passesCuts(RecoMuonAccessor(muon));
+}
+
+bool RecoMuonSelectorLoose::operator()(const RecoMuonCollectionView& muons, int idx) const
+{
+  return passesCuts(RecoMuonViewAccessor(muons, idx));
 }
@@ -0,0 +1,101 @@
+#include "tthAnalysis/HiggsToTauTau/interface/RecoMuonSelectorMultiTier.h" // RecoMuonSelectorMultiTier
+
+#include "tthAnalysis/HiggsToTauTau/interface/RecoMuonSelectorLoose.h" // RecoMuonSelectorLoose
+#include "tthAnalysis/HiggsToTauTau/interface/RecoMuonSelectorFakeable.h" // RecoMuonSelectorFakeable
+#include "tthAnalysis/HiggsToTauTau/interface/RecoMuonSelectorTight.h" // RecoMuonSelectorTight
+#include "tthAnalysis/HiggsToTauTau/interface/RecoMuonSelectorCutBased.h" // RecoMuonSelectorCutBased
+#include "tthAnalysis/HiggsToTauTau/interface/RecoMuonSelectorMVABased.h" // RecoMuonSelectorMVABased
+
+#include <cmath> // fabs
+#include <assert.h> // assert
+
+RecoMuonSelectorMultiTier::RecoMuonSelectorMultiTier()
+{
+//--- take the cut values from the single-tier selectors,
+//    so that each cut value is defined in one place only
+  RecoMuonSelectorLoose selectorLoose;
+  RecoMuonSelectorFakeable selectorFakeable;
+  RecoMuonSelectorTight selectorTight;
+  RecoMuonSelectorCutBased selectorCutBased;
+  RecoMuonSelectorMVABased selectorMVABased;
+
+  max_absEta_ = selectorLoose.max_absEta_;
+  max_dxy_ = selectorLoose.max_dxy_;
+  max_dz_ = selectorLoose.max_dz_;
+  max_relIso_ = selectorLoose.max_relIso_;
+  max_sip3d_ = selectorLoose.max_sip3d_;
+  min_pt_loose_ = selectorLoose.min_pt_;
+  min_pt_ = selectorFakeable.min_pt_;
+  binning_mvaTTH_ = selectorFakeable.binning_mvaTTH_;
+  min_jetPtRatio_ = selectorFakeable.min_jetPtRatio_;
+  max_jetBtagCSV_fakeable_ = selectorFakeable.max_jetBtagCSV_;
+  max_jetBtagCSV_ = selectorTight.max_jetBtagCSV_;
+  min_mvaTTH_ = selectorTight.min_mvaTTH_;
+  max_relIso_cutBased_ = selectorCutBased.max_relIso_;
+  max_sip3d_cutBased_ = selectorCutBased.max_sip3d_;
+
+//--- check that the single-tier selectors have the structure assumed by operator(),
+//    i.e. that cuts tested only once for several selections have the same value in all of them
+  const std::string selector = "RecoMuonSelectorMultiTier";
+  checkMultiTierCut(selector, "max_absEta", selectorFakeable.max_absEta_, max_absEta_);
+  checkMultiTierCut(selector, "max_absEta", selectorTight.max_absEta_, max_absEta_);
+  checkMultiTierCut(selector, "max_dxy", selectorFakeable.max_dxy_, max_dxy_);
+  checkMultiTierCut(selector, "max_dxy", selectorTight.max_dxy_, max_dxy_);
+  checkMultiTierCut(selector, "max_dz", selectorFakeable.max_dz_, max_dz_);
+  checkMultiTierCut(selector, "max_dz", selectorTight.max_dz_, max_dz_);
+  checkMultiTierCut(selector, "max_relIso", selectorFakeable.max_relIso_, max_relIso_);
+  checkMultiTierCut(selector, "max_relIso", selectorTight.max_relIso_, max_relIso_);
+  checkMultiTierCut(selector, "max_sip3d", selectorFakeable.max_sip3d_, max_sip3d_);
+  checkMultiTierCut(selector, "max_sip3d", selectorTight.max_sip3d_, max_sip3d_);
+  checkMultiTierCut(selector, "apply_looseIdPOG", selectorLoose.apply_looseIdPOG_, true);
+  checkMultiTierCut(selector, "apply_looseIdPOG", selectorFakeable.apply_looseIdPOG_, true);
+  checkMultiTierCut(selector, "apply_looseIdPOG", selectorTight.apply_looseIdPOG_, true);
+  checkMultiTierCut(selector, "apply_mediumIdPOG", selectorLoose.apply_mediumIdPOG_, false);
+  checkMultiTierCut(selector, "apply_mediumIdPOG", selectorFakeable.apply_mediumIdPOG_, false);
+  checkMultiTierCut(selector, "apply_mediumIdPOG", selectorTight.apply_mediumIdPOG_, true);
+  checkMultiTierCut(selector, "apply_mediumIdPOG", selectorCutBased.apply_mediumIdPOG_, true);
+  checkMultiTierCut(selector, "apply_mediumIdPOG", selectorMVABased.apply_mediumIdPOG_, true);
+  checkMultiTierCut(selector, "apply_tightCharge", selectorFakeable.apply_tightCharge_, false);
+  checkMultiTierCut(selector, "apply_tightCharge", selectorTight.apply_tightCharge_, true);
+  checkMultiTierCut(selector, "apply_tightCharge", selectorCutBased.apply_tightCharge_, true);
+  checkMultiTierCut(selector, "apply_tightCharge", selectorMVABased.apply_tightCharge_, true);
+  checkMultiTierCut(selector, "min_pt", selectorTight.min_pt_, min_pt_);
+  checkMultiTierCut(selector, "min_pt", selectorCutBased.min_pt_, min_pt_);
+  checkMultiTierCut(selector, "min_pt", selectorMVABased.min_pt_, min_pt_);
+  checkMultiTierCut(selector, "max_jetBtagCSV", selectorMVABased.max_jetBtagCSV_, max_jetBtagCSV_);
+  checkMultiTierCut(selector, "min_mvaTTH", selectorMVABased.min_mvaTTH_, min_mvaTTH_);
+  assert(binning_mvaTTH_.size() == 1);
+  assert(min_jetPtRatio_.size() == 2);
+  assert(max_jetBtagCSV_fakeable_.size() == 2);
+}
+
+UChar_t RecoMuonSelectorMultiTier::operator()(const RecoMuon& muon) const
+{
+  UChar_t selectionFlags = 0;
+  bool passesCommonCuts = 
+    muon.absEta_ <= max_absEta_ &&
+    std::fabs(muon.dxy_) <= max_dxy_ &&
+    std::fabs(muon.dz_) <= max_dz_ &&
+    muon.relIso_ <= max_relIso_ &&
+    muon.sip3d_ <= max_sip3d_ &&
+    muon.passesLooseIdPOG_;
+  if ( passesCommonCuts ) {
+    if ( muon.pt_ >= min_pt_loose_ ) selectionFlags |= kSelectionLoose;
+    if ( muon.pt_ >= min_pt_ ) {
+      int idxBin = -1;
+      if   ( muon.mvaRawTTH_ >= binning_mvaTTH_[0] ) idxBin = 0;
+      else                                           idxBin = 1;
+      if ( muon.jetPtRatio_ >= min_jetPtRatio_[idxBin] &&
+	   muon.jetBtagCSV_ <= max_jetBtagCSV_fakeable_[idxBin] ) selectionFlags |= kSelectionFakeable;
+    }
+  }
+  if ( muon.pt_ >= min_pt_ && muon.passesMediumIdPOG_ && muon.tightCharge_ >= 2 ) {
+    if ( muon.mvaRawTTH_ >= min_mvaTTH_ && muon.jetBtagCSV_ <= max_jetBtagCSV_ ) {
+      selectionFlags |= kSelectionMVABased;
+      // CV: the tight selection is the MVA-based selection plus the cuts shared with the loose selection
+      if ( passesCommonCuts ) selectionFlags |= kSelectionTight;
+    }
+    if ( muon.relIso_ <= max_relIso_cutBased_ && muon.sip3d_ <= max_sip3d_cutBased_ ) selectionFlags |= kSelectionCutBased;
+  }
+  return selectionFlags;
+}
@@ -0,0 +1,78 @@
+#include "tthAnalysis/HiggsToTauTau/interface/SkimWriter.h"
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <TDirectory.h> // TDirectory, gDirectory
+
+#include <iostream> // std::cout
+
+SkimWriter::SkimWriter(const edm::ParameterSet& cfg, EventSource& eventSource)
+  : eventSource_(eventSource)
+  , outputFile_(0)
+  , outputTree_(0)
+  , treeNumber_(-1)
+  , numEntries_(0)
+{
+  if ( !eventSource_.getTree() ) 
+    throw cms::Exception("SkimWriter") 
+      << "Writing skims is supported for events read from a TTree only !!\n";
+  outputFileName_ = cfg.getParameter<std::string>("outputFileName");
+  int compressionAlgorithm = getCompressionAlgorithm(cfg.getParameter<std::string>("compressionAlgorithm"));
+  int compressionLevel = cfg.getParameter<int>("compressionLevel");
+  int basketSize = cfg.getParameter<int>("basketSize");
+
+  TDirectory* dir = gDirectory;
+  outputFile_ = new TFile(outputFileName_.data(), "RECREATE");
+  if ( !outputFile_ || outputFile_->IsZombie() ) 
+    throw cms::Exception("SkimWriter") 
+      << "Failed to open output file = " << outputFileName_ << " !!\n";
+  // CV: ROOT encodes the compression algorithm and level as 100*algorithm + level
+  outputFile_->SetCompressionSettings(100*compressionAlgorithm + compressionLevel);
+  outputFile_->cd();
+  outputTree_ = eventSource_.getTree()->CloneTree(0);
+  outputTree_->SetDirectory(outputFile_);
+  outputTree_->SetBasketSize("*", basketSize);
+  dir->cd();
+}
+
+SkimWriter::~SkimWriter()
+{
+  if ( outputFile_ ) write();
+}
+
+int SkimWriter::getCompressionAlgorithm(const std::string& compressionAlgorithm) const
+{
+  if      ( compressionAlgorithm == "ZLIB" ) return 1;
+  else if ( compressionAlgorithm == "LZMA" ) return 2;
+  else if ( compressionAlgorithm == "LZ4"  ) return 4;
+  else if ( compressionAlgorithm == "ZSTD" ) return 5;
+  else throw cms::Exception("SkimWriter") 
+    << "Invalid Configuration parameter 'compressionAlgorithm' = " << compressionAlgorithm << " !!\n";
+}
+
+void SkimWriter::fill()
+{
+  TTree* inputTree = eventSource_.getTree();
+  // CV: the TChain updates the branch addresses of the skim when it opens the next file,
+  //     but the EventSource may enlarge its buffers afterwards, so copy the addresses once more
+  if ( inputTree->GetTreeNumber() != treeNumber_ ) {
+    inputTree->GetTree()->CopyAddresses(outputTree_);
+    treeNumber_ = inputTree->GetTreeNumber();
+  }
+  outputTree_->Fill();
+  ++numEntries_;
+}
+
+void SkimWriter::write()
+{
+  if ( !outputFile_ ) return;
+  TDirectory* dir = gDirectory;
+  outputFile_->cd();
+  outputTree_->Write();
+  std::cout << "wrote " << numEntries_ << " Entries to skim file = " << outputFileName_ << std::endl;
+  outputFile_->Close();
+  delete outputFile_;
+  outputFile_ = 0;
+  outputTree_ = 0; // CV: tree deleted when closing the output file
+  dir->cd();
+}
@@ -0,0 +1,126 @@
+#include "tthAnalysis/HiggsToTauTau/interface/StagedEntryLoader.h"
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <TObjArray.h> // TObjArray
+
+#include <set> // std::set<>
+#include <algorithm> // std::find
+#include <assert.h> // assert
+
+StagedEntryLoader::StagedEntryLoader(EventSource& eventSource)
+  : eventSource_(eventSource)
+  , tree_(eventSource.getTree())
+  , cache_(eventSource.getCache())
+  , treeNumber_(-1)
+  , localEntry_(-1)
+{}
+
+StagedEntryLoader::~StagedEntryLoader()
+{}
+
+void StagedEntryLoader::addEarlyBranch(const std::string& branchName)
+{
+  if ( std::find(earlyBranchNames_.begin(), earlyBranchNames_.end(), branchName) != earlyBranchNames_.end() ) return;
+  earlyBranchNames_.push_back(branchName);
+  treeNumber_ = -1; // CV: force update of cached branches
+}
+
+void StagedEntryLoader::addEarlyBranches(const std::vector<std::string>& branchNames)
+{
+  for ( std::vector<std::string>::const_iterator branchName = branchNames.begin();
+	branchName != branchNames.end(); ++branchName ) {
+    addEarlyBranch(*branchName);
+  }
+}
+
+void StagedEntryLoader::updateBranches(TTree* currentTree)
+{
+  earlyBranches_.clear();
+  earlyLeaves_.clear();
+  for ( std::vector<std::string>::const_iterator branchName = earlyBranchNames_.begin();
+	branchName != earlyBranchNames_.end(); ++branchName ) {
+    TBranch* branch = currentTree->GetBranch(branchName->data());
+    if ( !branch ) 
+      throw cms::Exception("StagedEntryLoader") 
+	<< "No branch = " << (*branchName) << " found in tree !!\n";
+    earlyBranches_.push_back(branch);
+    TLeaf* leaf = branch->GetLeaf(branchName->data());
+    if ( !leaf ) leaf = dynamic_cast<TLeaf*>(branch->GetListOfLeaves()->At(0));
+    earlyLeaves_[*branchName] = leaf;
+  }
+  remainingBranches_.clear();
+  const std::set<std::string>& branchNames = eventSource_.getManifest().branchNames();
+  for ( std::set<std::string>::const_iterator branchName = branchNames.begin();
+	branchName != branchNames.end(); ++branchName ) {
+    if ( std::find(earlyBranchNames_.begin(), earlyBranchNames_.end(), *branchName) != earlyBranchNames_.end() ) continue;
+    TBranch* branch = currentTree->GetBranch(branchName->data());
+    // CV: skip branches that do not exist in the tree, as TTree::GetEntry would
+    if ( branch ) remainingBranches_.push_back(branch);
+  }
+}
+
+void StagedEntryLoader::updateColumns()
+{
+  earlyColumns_.clear();
+  for ( std::vector<std::string>::const_iterator branchName = earlyBranchNames_.begin();
+	branchName != earlyBranchNames_.end(); ++branchName ) {
+    int column = cache_->getColumn(*branchName);
+    if ( column == -1 ) 
+      throw cms::Exception("StagedEntryLoader") 
+	<< "No column = " << (*branchName) << " found in columnar cache !!\n";
+    earlyColumns_[*branchName] = column;
+  }
+}
+
+Int_t StagedEntryLoader::loadEarly(Long64_t entry)
+{
+  if ( cache_ ) {
+    if ( treeNumber_ == -1 ) {
+      updateColumns();
+      treeNumber_ = 0;
+    }
+    localEntry_ = entry;
+    return eventSource_.getEntry(entry);
+  }
+  localEntry_ = tree_->LoadTree(entry);
+  if ( localEntry_ < 0 ) return -1;
+  if ( tree_->GetTreeNumber() != treeNumber_ ) {
+    updateBranches(tree_->GetTree());
+    treeNumber_ = tree_->GetTreeNumber();
+  }
+  Int_t numBytes = 0;
+  for ( std::vector<TBranch*>::iterator branch = earlyBranches_.begin();
+	branch != earlyBranches_.end(); ++branch ) {
+    numBytes += (*branch)->GetEntry(localEntry_);
+  }
+  return numBytes;
+}
+
+Double_t StagedEntryLoader::getValue(const std::string& branchName) const
+{
+  if ( cache_ ) {
+    std::map<std::string, int>::const_iterator column = earlyColumns_.find(branchName);
+    if ( column == earlyColumns_.end() ) 
+      throw cms::Exception("StagedEntryLoader") 
+	<< "Branch = " << branchName << " is not read in the first stage !!\n";
+    return cache_->getValue(column->second);
+  }
+  std::map<std::string, TLeaf*>::const_iterator leaf = earlyLeaves_.find(branchName);
+  if ( leaf == earlyLeaves_.end() || !leaf->second ) 
+    throw cms::Exception("StagedEntryLoader") 
+      << "Branch = " << branchName << " is not read in the first stage !!\n";
+  return leaf->second->GetValue();
+}
+
+Int_t StagedEntryLoader::loadRemaining()
+{
+  assert(localEntry_ >= 0);
+  if ( cache_ ) return 0;
+  Int_t numBytes = 0;
+  for ( std::vector<TBranch*>::iterator branch = remainingBranches_.begin();
+	branch != remainingBranches_.end(); ++branch ) {
+    numBytes += (*branch)->GetEntry(localEntry_);
+  }
+  return numBytes;
+}
@@ -260,23 +260,22 @@ SyncNtupleManager::readRunLumiEvent(UInt_t run_,
 }
 
 void
-SyncNtupleManager::read(std::vector<const RecoMuon *> & muons,
-                        std::vector<const RecoMuon *> & fakeable_muons,
-                        std::vector<const RecoMuon *> & cutbased_muons,
-                        std::vector<const RecoMuon *> & mvabased_muons)
+SyncNtupleManager::read(const RecoMuonCollectionSelection & muons)
 {
-  n_presel_mu = muons.size();
-  n_fakeablesel_mu = fakeable_muons.size();
-  n_cutsel_mu = cutbased_muons.size();
-  n_mvasel_mu = mvabased_muons.size();
-  const Int_t nof_iterations = std::min(n_presel_mu, nof_mus);
-  for(Int_t i = 0; i < nof_iterations; ++i)
+  n_presel_mu = muons.count(kSelectionLoose);
+  n_fakeablesel_mu = muons.count(kSelectionLoose | kSelectionFakeable);
+  n_cutsel_mu = muons.count(kSelectionLoose | kSelectionCutBased);
+  n_mvasel_mu = muons.count(kSelectionLoose | kSelectionMVABased);
+  Int_t i = 0;
+  for(Int_t idx = 0; idx < muons.size() && i < nof_mus; ++idx)
   {
-    const RecoMuon * const muon = muons[i];
+    if(! muons.passes(idx, kSelectionLoose))
+      continue;
+    const RecoMuon * const muon = muons.particle(idx);
     mu_pt[i] = muon -> pt_;
     mu_eta[i] = muon -> eta_;
     mu_phi[i] = muon -> phi_;
-    mu_E[i] = (muon -> p4_).E();
+    mu_E[i] = (muon -> p4()).E();
     mu_charge[i] = muon -> charge_;
     mu_miniRelIso[i] = muon -> relIso_;
     mu_miniIsoCharged[i] = muon -> miniIsoCharged_;
@@ -294,48 +293,30 @@ SyncNtupleManager::read(std::vector<const RecoMuon *> & muons,
 #ifdef DPT_DIV_PT
     mu_dpt_div_pt[i] = muon -> dpt_div_pt_;
 #endif
-    mu_isfakeablesel[i] = 0;
-    for(const auto & fakeable_muon: fakeable_muons)
-      if(muon == fakeable_muon)
-      {
-        mu_isfakeablesel[i] = 1;
-        break;
-      }
-    mu_iscutsel[i] = 0;
-    for(const auto & cutbased_muon: cutbased_muons)
-      if(muon == cutbased_muon)
-      {
-        mu_iscutsel[i] = 1;
-        break;
-      }
-    mu_ismvasel[i] = 0;
-    for(const auto & mvabased_muon: mvabased_muons)
-      if(muon == mvabased_muon)
-      {
-        mu_ismvasel[i] = 1;
-        break;
-      }
+    mu_isfakeablesel[i] = muons.passes(idx, kSelectionFakeable) ? 1 : 0;
+    mu_iscutsel[i] = muons.passes(idx, kSelectionCutBased) ? 1 : 0;
+    mu_ismvasel[i] = muons.passes(idx, kSelectionMVABased) ? 1 : 0;
+    ++i;
   }
 }
 
 void
-SyncNtupleManager::read(std::vector<const RecoElectron *> & electrons,
-                        std::vector<const RecoElectron *> & fakeable_electrons,
-                        std::vector<const RecoElectron *> & cutbased_electrons,
-                        std::vector<const RecoElectron *> & mvabased_electrons)
+SyncNtupleManager::read(const RecoElectronCollectionSelection & electrons)
 {
-  n_presel_ele = electrons.size();
-  n_fakeablesel_ele = fakeable_electrons.size();
-  n_cutsel_ele = cutbased_electrons.size();
-  n_mvasel_ele = mvabased_electrons.size();
-  const Int_t nof_iterations = std::min(n_presel_ele, nof_eles);
-  for(Int_t i = 0; i < nof_iterations; ++i)
+  n_presel_ele = electrons.count(kSelectionLoose);
+  n_fakeablesel_ele = electrons.count(kSelectionLoose | kSelectionFakeable);
+  n_cutsel_ele = electrons.count(kSelectionLoose | kSelectionCutBased);
+  n_mvasel_ele = electrons.count(kSelectionLoose | kSelectionMVABased);
+  Int_t i = 0;
+  for(Int_t idx = 0; idx < electrons.size() && i < nof_eles; ++idx)
   {
-    const RecoElectron * const electron = electrons[i];
+    if(! electrons.passes(idx, kSelectionLoose))
+      continue;
+    const RecoElectron * const electron = electrons.particle(idx);
     ele_pt[i] = electron -> pt_;
     ele_eta[i] = electron -> eta_;
     ele_phi[i] = electron -> phi_;
-    ele_E[i] = (electron -> p4_).E();
+    ele_E[i] = (electron -> p4()).E();
     ele_charge[i] = electron -> charge_;
     ele_miniRelIso[i] = electron -> relIso_;
     ele_miniIsoCharged[i] = electron -> miniIsoCharged_;
@@ -352,27 +333,10 @@ SyncNtupleManager::read(std::vector<const RecoElectron *> & electrons,
     ele_isChargeConsistent[i] = electron -> tightCharge_ == 2 ? 1 : 0;
     ele_passesConversionVeto[i] = electron -> passesConversionVeto_;
     ele_nMissingHits[i] = electron -> nLostHits_;
-    ele_isfakeablesel[i] = 0;
-    for(const auto & fakeable_electron: fakeable_electrons)
-      if(electron == fakeable_electron)
-      {
-        ele_isfakeablesel[i] = 1;
-        break;
-      }
-    ele_iscutsel[i] = 0;
-    for(const auto & cutbased_electron: cutbased_electrons)
-      if(electron == cutbased_electron)
-      {
-        ele_iscutsel[i] = 1;
-        break;
-      }
-    ele_ismvasel[i] = 0;
-    for(const auto & mvabased_electron: mvabased_electrons)
-      if(electron == mvabased_electron)
-      {
-        ele_ismvasel[i] = 1;
-        break;
-      }
+    ele_isfakeablesel[i] = electrons.passes(idx, kSelectionFakeable) ? 1 : 0;
+    ele_iscutsel[i] = electrons.passes(idx, kSelectionCutBased) ? 1 : 0;
+    ele_ismvasel[i] = electrons.passes(idx, kSelectionMVABased) ? 1 : 0;
+    ++i;
   }
 }
 
@@ -387,7 +351,7 @@ SyncNtupleManager::read(std::vector<const RecoHadTau *> & hadtaus)
     tau_pt[i] = hadtau -> pt_;
     tau_eta[i] = hadtau -> eta_;
     tau_phi[i] = hadtau -> phi_;
-    tau_E[i] = (hadtau -> p4_).E();
+    tau_E[i] = (hadtau -> p4()).E();
     tau_charge[i] = hadtau -> charge_;
     tau_dxy[i] = hadtau -> dxy_;
     tau_dz[i] = hadtau -> dz_;
@@ -434,7 +398,7 @@ SyncNtupleManager::read(std::vector<const RecoJet *> & jets)
     jet_pt[i] = jet -> pt_;
     jet_eta[i] = jet -> eta_;
     jet_phi[i] = jet -> phi_;
-    jet_E[i] = (jet -> p4_).E();
+    jet_E[i] = (jet -> p4()).E();
     jet_CSV[i] = jet -> BtagCSV_;
   }
 }
@@ -6,45 +6,87 @@
 #include "TMVA/Factory.h"
 #include "TMVA/Tools.h"
 
-TMVAInterface::TMVAInterface(const std::string& mvaFileName, const std::vector<std::string>& mvaInputVariables, const std::vector<std::string>& spectators)
-  : mva_(0)
+#include <iostream> // std::cout
+#include <algorithm> // std::find
+
+TMVAInterface::TMVAInterface(const std::string& mvaFileName, const std::vector<std::string>& mvaInputVariables, const std::vector<std::string>& spectators,
+			     const std::vector<std::string>& mvaInputLayout)
+  : compiledBDT_(0)
+  , bdt_(0)
+  , mva_(0)
+  , method_(0)
+  , mvaInputVariables_(mvaInputVariables.size(), -1.)
+  , spectators_(spectators.size(), -1.)
 {
   edm::FileInPath mvaFileName_fip(mvaFileName);
   std::string mvaFileName_full = mvaFileName_fip.fullPath();
+  for ( size_t idxVariable = 0; idxVariable < mvaInputVariables.size(); ++idxVariable ) {
+    const std::string& mvaInputVariable = mvaInputVariables[idxVariable];
+    int mvaInputIndex = idxVariable;
+    if ( !mvaInputLayout.empty() ) {
+      std::vector<std::string>::const_iterator mvaInput = std::find(mvaInputLayout.begin(), mvaInputLayout.end(), mvaInputVariable);
+      if ( mvaInput == mvaInputLayout.end() )
+	throw cms::Exception("TMVAInterface")
+	  << "No value given for MVA input variable = " << mvaInputVariable << " !!\n";
+      mvaInputIndex = mvaInput - mvaInputLayout.begin();
+    }
+    mvaInputIndices_.push_back(mvaInputIndex);
+  }
+
+  compiledBDT_ = findCompiledBDT(mvaFileName, mvaFileName_full);
+  if ( compiledBDT_ ) {
+    if ( std::vector<std::string>(compiledBDT_->inputVariables_, compiledBDT_->inputVariables_ + compiledBDT_->numInputVariables_) != mvaInputVariables )
+      throw cms::Exception("TMVAInterface")
+	<< "MVA input variables given do not match the variables used for the TMVA training in file = " << mvaFileName_full << " !!\n";
+    return;
+  }
+
+  try {
+    bdt_ = new BDTForest(mvaFileName_full);
+  } catch ( const cms::Exception& exception ) {
+    std::cout << "<TMVAInterface>: evaluating MVA in file = " << mvaFileName_full << " by TMVA::Reader, reason:" << std::endl;
+    std::cout << exception.what() << std::endl;
+    bdt_ = 0;
+  }
+  if ( bdt_ ) {
+    if ( bdt_->getInputVariables() != mvaInputVariables )
+      throw cms::Exception("TMVAInterface")
+	<< "MVA input variables given do not match the variables used for the TMVA training in file = " << mvaFileName_full << " !!\n";
+    bdt_->setInputIndices(mvaInputIndices_);
+    return;
+  }
+
   TMVA::Tools::Instance();
   mva_ = new TMVA::Reader("!V:!Silent");
-  for ( std::vector<std::string>::const_iterator mvaInputVariable = mvaInputVariables.begin();
-	mvaInputVariable != mvaInputVariables.end(); ++mvaInputVariable ) {
-    mvaInputVariables_[*mvaInputVariable] = -1.;
-    mva_->AddVariable(*mvaInputVariable, &mvaInputVariables_[*mvaInputVariable]);
+  for ( size_t idxVariable = 0; idxVariable < mvaInputVariables.size(); ++idxVariable ) {
+    mva_->AddVariable(mvaInputVariables[idxVariable], &mvaInputVariables_[idxVariable]);
   }
-  for ( std::vector<std::string>::const_iterator spectator = spectators.begin();
-	spectator != spectators.end(); ++spectator ) {
-    mva_->AddSpectator(*spectator, &spectators_[*spectator]);
+  for ( size_t idxSpectator = 0; idxSpectator < spectators.size(); ++idxSpectator ) {
+    mva_->AddSpectator(spectators[idxSpectator], &spectators_[idxSpectator]);
   }
-  mva_->BookMVA("BDTG", mvaFileName_full);
+  // CV: keep pointer to the booked method, so that TMVA does not need to look up the method by name for each event
+  method_ = dynamic_cast<TMVA::MethodBase*>(mva_->BookMVA("BDTG", mvaFileName_full));
+  if ( !method_ )
+    throw cms::Exception("TMVAInterface")
+      << "Failed to book MVA from file = " << mvaFileName_full << " !!\n";
 }
 
 TMVAInterface::~TMVAInterface()
 {
+  delete bdt_;
   delete mva_;
 }
 
 double
-TMVAInterface::operator()(const std::map<std::string, double>& mvaInputs) const
+TMVAInterface::operator()(const Float_t* mvaInputs) const
 {
-  for ( std::map<std::string, Float_t>::iterator mvaInputVariable = mvaInputVariables_.begin();
-	mvaInputVariable != mvaInputVariables_.end(); ++mvaInputVariable ) {
-    std::map<std::string, double>::const_iterator mvaInput = mvaInputs.find(mvaInputVariable->first);
-    if ( mvaInput != mvaInputs.end() ) {
-      mvaInputVariable->second = mvaInput->second;
-    } else {
-      throw cms::Exception("TMVAInterface::operator()")
-	<< "Missing value for MVA input variable = " << mvaInputVariable->first << " !!\n";
-    }
+  if ( compiledBDT_ ) return (*compiledBDT_->function_)(mvaInputs, mvaInputIndices_.data());
+  if ( bdt_ ) return (*bdt_)(mvaInputs);
+
+  for ( size_t idxVariable = 0; idxVariable < mvaInputIndices_.size(); ++idxVariable ) {
+    mvaInputVariables_[idxVariable] = mvaInputs[mvaInputIndices_[idxVariable]];
   }
 
-  double mvaOutput = mva_->EvaluateMVA("BDTG");
+  double mvaOutput = mva_->EvaluateMVA(method_);
   return mvaOutput;
 }
-
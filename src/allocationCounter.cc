@@ -0,0 +1,49 @@
+#include "tthAnalysis/HiggsToTauTau/interface/allocationCounter.h"
+
+#ifdef COUNT_ALLOCATIONS
+
+#include <atomic> // std::atomic<>
+#include <new> // std::bad_alloc
+#include <stdlib.h> // malloc, free
+
+namespace
+{
+  std::atomic<unsigned long> numAllocations(0);
+
+  void* countedMalloc(std::size_t size)
+  {
+    ++numAllocations;
+    void* ptr = malloc(size > 0 ? size : 1);
+    if ( !ptr ) throw std::bad_alloc();
+    return ptr;
+  }
+}
+
+void* operator new(std::size_t size) { return countedMalloc(size); }
+void* operator new[](std::size_t size) { return countedMalloc(size); }
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+
+unsigned long getNumAllocations()
+{
+  return numAllocations;
+}
+
+bool isAllocationCountingEnabled()
+{
+  return true;
+}
+
+#else
+
+unsigned long getNumAllocations()
+{
+  return 0;
+}
+
+bool isAllocationCountingEnabled()
+{
+  return false;
+}
+
+#endif
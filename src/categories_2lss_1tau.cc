@@ -0,0 +1,70 @@
+#include "tthAnalysis/HiggsToTauTau/interface/categories_2lss_1tau.h"
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+namespace
+{
+  // CV: index = [number of muons][0 for positive, 1 for negative charge][0 for >= 1 medium b-tagged jet, 1 otherwise]
+  const int categoryTable[3][2][2] = {
+    { { k2epp_btight,    k2epp_bloose    }, { k2emm_btight,    k2emm_bloose    } },
+    { { k1e1mupp_btight, k1e1mupp_bloose }, { k1e1mumm_btight, k1e1mumm_bloose } },
+    { { k2mupp_btight,   k2mupp_bloose   }, { k2mumm_btight,   k2mumm_bloose   } }
+  };
+
+  struct categoryEntryType
+  {
+    const char* name_;
+    int numElectrons_;
+    int numMuons_;
+    int charge_;
+  };
+  // CV: in the same order as the enum defined in categories_2lss_1tau.h
+  const categoryEntryType categoryEntries[kNumCategories_2lss_1tau] = {
+    { "2epp_1tau_btight",    2, 0, +1 },
+    { "2epp_1tau_bloose",    2, 0, +1 },
+    { "2emm_1tau_btight",    2, 0, -1 },
+    { "2emm_1tau_bloose",    2, 0, -1 },
+    { "1e1mupp_1tau_btight", 1, 1, +1 },
+    { "1e1mupp_1tau_bloose", 1, 1, +1 },
+    { "1e1mumm_1tau_btight", 1, 1, -1 },
+    { "1e1mumm_1tau_bloose", 1, 1, -1 },
+    { "2mupp_1tau_btight",   0, 2, +1 },
+    { "2mupp_1tau_bloose",   0, 2, +1 },
+    { "2mumm_1tau_btight",   0, 2, -1 },
+    { "2mumm_1tau_bloose",   0, 2, -1 }
+  };
+
+  const categoryEntryType& getCategoryEntry(int category)
+  {
+    if ( !(category >= 0 && category < kNumCategories_2lss_1tau) )
+      throw cms::Exception("categories_2lss_1tau")
+	<< "Invalid category = " << category << " !!\n";
+    return categoryEntries[category];
+  }
+}
+
+int getCategory_2lss_1tau(size_t numElectrons, size_t numMuons, bool isCharge_pp, bool isCharge_mm, size_t numBJets_medium)
+{
+  if ( !(numElectrons + numMuons == 2) || isCharge_pp == isCharge_mm ) return kNoCategory_2lss_1tau;
+  return categoryTable[numMuons][isCharge_mm ? 1 : 0][numBJets_medium >= 1 ? 0 : 1];
+}
+
+const char* getCategoryName_2lss_1tau(int category)
+{
+  return getCategoryEntry(category).name_;
+}
+
+int getNumElectrons_2lss_1tau(int category)
+{
+  return getCategoryEntry(category).numElectrons_;
+}
+
+int getNumMuons_2lss_1tau(int category)
+{
+  return getCategoryEntry(category).numMuons_;
+}
+
+int getCharge_2lss_1tau(int category)
+{
+  return getCategoryEntry(category).charge_;
+}
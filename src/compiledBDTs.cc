@@ -0,0 +1,40 @@
+#include "tthAnalysis/HiggsToTauTau/interface/compiledBDTs.h"
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <iostream> // std::cout
+#include <fstream> // std::ifstream
+
+unsigned long long computeFileChecksum(const std::string& fileName)
+{
+  std::ifstream file(fileName.data(), std::ios::in | std::ios::binary);
+  if ( !file )
+    throw cms::Exception("computeFileChecksum")
+      << "Failed to open file = " << fileName << " !!\n";
+  unsigned long long checksum = 14695981039346656037ULL;
+  char buffer[65536];
+  while ( file.read(buffer, sizeof(buffer)) || file.gcount() > 0 ) {
+    std::streamsize numBytes = file.gcount();
+    for ( std::streamsize idxByte = 0; idxByte < numBytes; ++idxByte ) {
+      checksum ^= (unsigned char)buffer[idxByte];
+      checksum *= 1099511628211ULL;
+    }
+  }
+  return checksum;
+}
+
+const CompiledBDT* findCompiledBDT(const std::string& mvaFileName, const std::string& mvaFileName_full)
+{
+  for ( size_t idxBDT = 0; idxBDT < numCompiledBDTs; ++idxBDT ) {
+    const CompiledBDT* compiledBDT = &compiledBDTs[idxBDT];
+    if ( mvaFileName != compiledBDT->mvaFileName_ ) continue;
+    // CV: make sure the compiled BDT is not used in case the weight file has been changed without regenerating the code
+    if ( computeFileChecksum(mvaFileName_full) != compiledBDT->mvaFileChecksum_ ) {
+      std::cout << "<findCompiledBDT>: file = " << mvaFileName_full << " has changed since the code of the compiled BDT was generated,"
+		<< " rerun test/generateCompiledBDTs.py to update the code !!" << std::endl;
+      return 0;
+    }
+    return compiledBDT;
+  }
+  return 0;
+}
@@ -0,0 +1,11323 @@
+// CV: this file has been generated by test/generateCompiledBDTs.py from the BDT weight files in data/, do not edit it by hand !!
+
+#include "tthAnalysis/HiggsToTauTau/interface/compiledBDTs.h"
+
+#include <TMath.h> // TMath::IsNaN
+
+#include <cmath> // std::exp
+
+namespace
+{
+//--- BDT read from file = tthAnalysis/HiggsToTauTau/data/2lss_ttV_BDTG.weights.xml
+  const char* inputVariables_2lss_ttV_BDTG[] = {
+    "max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))",
+    "MT_met_lep1",
+    "nJet25_Recl",
+    "mindr_lep1_jet",
+    "mindr_lep2_jet",
+    "LepGood_conePt[iF_Recl[0]]",
+    "LepGood_conePt[iF_Recl[1]]"
+  };
+
+  double compiledBDT_2lss_ttV_BDTG(const Float_t* mvaInputs, const int* mvaInputIndices)
+  {
+    const Float_t x0 = mvaInputs[mvaInputIndices[0]];
+    const Float_t x1 = mvaInputs[mvaInputIndices[1]];
+    const Float_t x2 = mvaInputs[mvaInputIndices[2]];
+    const Float_t x3 = mvaInputs[mvaInputIndices[3]];
+    const Float_t x4 = mvaInputs[mvaInputIndices[4]];
+    const Float_t x5 = mvaInputs[mvaInputIndices[5]];
+    const Float_t x6 = mvaInputs[mvaInputIndices[6]];
+    if ( TMath::IsNaN(x0) || TMath::IsNaN(x1) || TMath::IsNaN(x2) || TMath::IsNaN(x3) || TMath::IsNaN(x4) || TMath::IsNaN(x5) || TMath::IsNaN(x6) ) return -999.;
+    double sum = 0.;
+    // tree 0
+    if ( x2 >= 5.0298509597778320e+00f ) {
+      if ( x0 >= 1.3185336589813232e+00f ) {
+        sum += 5.7580713182687759e-03f;
+      } else {
+        sum += 1.5215060673654079e-02f;
+      }
+    } else {
+      if ( x5 >= 1.1198130798339844e+02f ) {
+        sum += -2.3086531087756157e-02f;
+      } else {
+        sum += -2.0366359967738390e-03f;
+      }
+    }
+    // tree 1
+    if ( x2 >= 5.0298509597778320e+00f ) {
+      if ( x0 >= 1.6293962001800537e+00f ) {
+        sum += 2.9993026982992887e-03f;
+      } else {
+        sum += 1.3663549907505512e-02f;
+      }
+    } else {
+      if ( x5 >= 8.7453216552734375e+01f ) {
+        sum += -1.6599861904978752e-02f;
+      } else {
+        sum += -5.7577545521780849e-04f;
+      }
+    }
+    // tree 2
+    if ( x2 >= 5.0298509597778320e+00f ) {
+      if ( x0 >= 1.3185336589813232e+00f ) {
+        sum += 5.2114930003881454e-03f;
+      } else {
+        sum += 1.4146306551992893e-02f;
+      }
+    } else {
+      if ( x5 >= 1.1811332702636719e+02f ) {
+        sum += -2.1976875141263008e-02f;
+      } else {
+        sum += -1.9963681697845459e-03f;
+      }
+    }
+    // tree 3
+    if ( x2 >= 5.0298509597778320e+00f ) {
+      if ( x2 >= 7.0099501609802246e+00f ) {
+        sum += 1.8683206290006638e-02f;
+      } else {
+        sum += 8.1233363598585129e-03f;
+      }
+    } else {
+      if ( x5 >= 7.5189170837402344e+01f ) {
+        sum += -1.2819007039070129e-02f;
+      } else {
+        sum += 4.5474155922420323e-04f;
+      }
+    }
+    // tree 4
+    if ( x2 >= 4.0447759628295898e+00f ) {
+      if ( x2 >= 6.0348258018493652e+00f ) {
+        sum += 1.4262393116950989e-02f;
+      } else {
+        sum += 3.0116250272840261e-03f;
+      }
+    } else {
+      if ( x6 >= 4.5535560607910156e+01f ) {
+        sum += -2.2200768813490868e-02f;
+      } else {
+        sum += -5.5972393602132797e-03f;
+      }
+    }
+    // tree 5
+    if ( x2 >= 5.0298509597778320e+00f ) {
+      if ( x0 >= 1.6293962001800537e+00f ) {
+        sum += 1.8311231397092342e-03f;
+      } else {
+        sum += 1.2046673335134983e-02f;
+      }
+    } else {
+      if ( x5 >= 1.1811332702636719e+02f ) {
+        sum += -1.9292747601866722e-02f;
+      } else {
+        sum += -1.5036930562928319e-03f;
+      }
+    }
+    // tree 6
+    if ( x2 >= 4.0447759628295898e+00f ) {
+      if ( x3 >= 1.4234299659729004e+00f ) {
+        sum += -6.4851427450776100e-03f;
+      } else {
+        sum += 7.8282020986080170e-03f;
+      }
+    } else {
+      if ( x6 >= 4.5535560607910156e+01f ) {
+        sum += -2.0235488191246986e-02f;
+      } else {
+        sum += -5.1014879718422890e-03f;
+      }
+    }
+    // tree 7
+    if ( x2 >= 5.0298509597778320e+00f ) {
+      if ( x5 >= 9.7403213500976562e+01f ) {
+        sum += 1.2160268379375339e-03f;
+      } else {
+        sum += 1.1447265744209290e-02f;
+      }
+    } else {
+      if ( x0 >= 1.3700752258300781e+00f ) {
+        sum += -1.1178832501173019e-02f;
+      } else {
+        sum += 8.2520506111904979e-04f;
+      }
+    }
+    // tree 8
+    if ( x2 >= 4.0447759628295898e+00f ) {
+      if ( x2 >= 6.0348258018493652e+00f ) {
+        sum += 1.2926493771374226e-02f;
+      } else {
+        sum += 2.6552400086075068e-03f;
+      }
+    } else {
+      if ( x5 >= 1.1198130798339844e+02f ) {
+        sum += -2.1704507991671562e-02f;
+      } else {
+        sum += -4.8988834023475647e-03f;
+      }
+    }
+    // tree 9
+    if ( x2 >= 5.0298509597778320e+00f ) {
+      if ( x0 >= 1.3185336589813232e+00f ) {
+        sum += 3.0793221667408943e-03f;
+      } else {
+        sum += 1.1818598955869675e-02f;
+      }
+    } else {
+      if ( x0 >= 1.3700752258300781e+00f ) {
+        sum += -1.0328215546905994e-02f;
+      } else {
+        sum += 9.8851940128952265e-04f;
+      }
+    }
+    // tree 10
+    if ( x2 >= 4.0447759628295898e+00f ) {
+      if ( x5 >= 7.8051803588867188e+01f ) {
+        sum += -1.1750481789931655e-03f;
+      } else {
+        sum += 8.6604170501232147e-03f;
+      }
+    } else {
+      if ( x6 >= 5.1458141326904297e+01f ) {
+        sum += -2.0007954910397530e-02f;
+      } else {
+        sum += -4.4215568341314793e-03f;
+      }
+    }
+    // tree 11
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x0 >= 1.6417983770370483e+00f ) {
+        sum += 5.8352495543658733e-03f;
+      } else {
+        sum += 1.4169006608426571e-02f;
+      }
+    } else {
+      if ( x3 >= 1.4147627353668213e+00f ) {
+        sum += -1.1260245926678181e-02f;
+      } else {
+        sum += 1.5466634649783373e-03f;
+      }
+    }
+    // tree 12
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x0 >= 1.6417983770370483e+00f ) {
+        sum += 5.5962428450584412e-03f;
+      } else {
+        sum += 1.3718435540795326e-02f;
+      }
+    } else {
+      if ( x5 >= 7.8051033020019531e+01f ) {
+        sum += -8.1667779013514519e-03f;
+      } else {
+        sum += 2.7471962384879589e-03f;
+      }
+    }
+    // tree 13
+    if ( x2 >= 4.0447759628295898e+00f ) {
+      if ( x0 >= 1.3931406736373901e+00f ) {
+        sum += -1.3212787453085184e-03f;
+      } else {
+        sum += 8.2174409180879593e-03f;
+      }
+    } else {
+      if ( x0 >= 1.5190738439559937e+00f ) {
+        sum += -1.4136728830635548e-02f;
+      } else {
+        sum += -2.8930751141160727e-03f;
+      }
+    }
+    // tree 14
+    if ( x3 >= 1.4147627353668213e+00f ) {
+      if ( x5 >= 1.4577748107910156e+02f ) {
+        sum += -3.7039879709482193e-02f;
+      } else {
+        sum += -6.5371054224669933e-03f;
+      }
+    } else {
+      if ( x2 >= 6.0149254798889160e+00f ) {
+        sum += 1.2251258827745914e-02f;
+      } else {
+        sum += 1.5819719992578030e-03f;
+      }
+    }
+    // tree 15
+    if ( x2 >= 5.0298509597778320e+00f ) {
+      if ( x5 >= 9.7403213500976562e+01f ) {
+        sum += 5.1068760512862355e-05f;
+      } else {
+        sum += 9.6042416989803314e-03f;
+      }
+    } else {
+      if ( x6 >= 4.2910572052001953e+01f ) {
+        sum += -1.1659601703286171e-02f;
+      } else {
+        sum += 5.1105662714689970e-04f;
+      }
+    }
+    // tree 16
+    if ( x3 >= 1.1201860904693604e+00f ) {
+      if ( x1 >= 1.4478614807128906e+02f ) {
+        sum += -2.4315493181347847e-02f;
+      } else {
+        sum += -2.8219870291650295e-03f;
+      }
+    } else {
+      if ( x2 >= 6.0149254798889160e+00f ) {
+        sum += 1.2439307756721973e-02f;
+      } else {
+        sum += 2.8031899128109217e-03f;
+      }
+    }
+    // tree 17
+    if ( x2 >= 4.0447759628295898e+00f ) {
+      if ( x0 >= 1.3185336589813232e+00f ) {
+        sum += -9.2251587193459272e-04f;
+      } else {
+        sum += 8.0428486689925194e-03f;
+      }
+    } else {
+      if ( x0 >= 1.3700752258300781e+00f ) {
+        sum += -1.1797380633652210e-02f;
+      } else {
+        sum += -1.7488795565441251e-03f;
+      }
+    }
+    // tree 18
+    if ( x3 >= 1.4989274740219116e+00f ) {
+      if ( x5 >= 5.8702465057373047e+01f ) {
+        sum += -1.5705542638897896e-02f;
+      } else {
+        sum += -1.5680204378440976e-03f;
+      }
+    } else {
+      if ( x4 >= 1.3766725063323975e+00f ) {
+        sum += -4.9989200197160244e-03f;
+      } else {
+        sum += 5.3815217688679695e-03f;
+      }
+    }
+    // tree 19
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x2 >= 7.0298509597778320e+00f ) {
+        sum += 1.4297724701464176e-02f;
+      } else {
+        sum += 7.3354952037334442e-03f;
+      }
+    } else {
+      if ( x6 >= 3.6328472137451172e+01f ) {
+        sum += -7.5184181332588196e-03f;
+      } else {
+        sum += 2.5245028082281351e-03f;
+      }
+    }
+    // tree 20
+    if ( x3 >= 1.0781036615371704e+00f ) {
+      if ( x5 >= 8.7727470397949219e+01f ) {
+        sum += -1.3776058331131935e-02f;
+      } else {
+        sum += -3.7236255593597889e-04f;
+      }
+    } else {
+      if ( x2 >= 5.0298509597778320e+00f ) {
+        sum += 8.9491251856088638e-03f;
+      } else {
+        sum += 1.5257138293236494e-03f;
+      }
+    }
+    // tree 21
+    if ( x0 >= 1.3186233043670654e+00f ) {
+      if ( x6 >= 3.2278285980224609e+01f ) {
+        sum += -1.2652010656893253e-02f;
+      } else {
+        sum += 3.2620198908261955e-04f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 7.5907576829195023e-03f;
+      } else {
+        sum += -1.1982277501374483e-03f;
+      }
+    }
+    // tree 22
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x2 >= 7.0298509597778320e+00f ) {
+        sum += 1.3663070276379585e-02f;
+      } else {
+        sum += 6.8399519659578800e-03f;
+      }
+    } else {
+      if ( x5 >= 1.6512611389160156e+02f ) {
+        sum += -2.0974004641175270e-02f;
+      } else {
+        sum += 5.2702403627336025e-04f;
+      }
+    }
+    // tree 23
+    if ( x0 >= 1.5175888538360596e+00f ) {
+      if ( x6 >= 2.9958602905273438e+01f ) {
+        sum += -1.3240642845630646e-02f;
+      } else {
+        sum += -4.1649711783975363e-04f;
+      }
+    } else {
+      if ( x5 >= 1.1675560760498047e+02f ) {
+        sum += -5.5399448610842228e-03f;
+      } else {
+        sum += 5.8253328315913677e-03f;
+      }
+    }
+    // tree 24
+    if ( x3 >= 1.0781036615371704e+00f ) {
+      if ( x1 >= 1.3674253845214844e+02f ) {
+        sum += -1.8682707101106644e-02f;
+      } else {
+        sum += -1.6310113715007901e-03f;
+      }
+    } else {
+      if ( x4 >= 1.3719704151153564e+00f ) {
+        sum += -3.2933421898633242e-03f;
+      } else {
+        sum += 6.5133012831211090e-03f;
+      }
+    }
+    // tree 25
+    if ( x2 >= 4.0447759628295898e+00f ) {
+      if ( x5 >= 7.8051803588867188e+01f ) {
+        sum += -1.0878376197069883e-03f;
+      } else {
+        sum += 6.9271661341190338e-03f;
+      }
+    } else {
+      if ( x0 >= 9.1066282987594604e-01f ) {
+        sum += -7.7684950083494186e-03f;
+      } else {
+        sum += 1.1382510419934988e-03f;
+      }
+    }
+    // tree 26
+    if ( x3 >= 1.6462157964706421e+00f ) {
+      if ( x1 >= 1.0457060241699219e+02f ) {
+        sum += -2.4448333308100700e-02f;
+      } else {
+        sum += -6.4811208285391331e-03f;
+      }
+    } else {
+      if ( x6 >= 4.9492710113525391e+01f ) {
+        sum += -5.6122234091162682e-03f;
+      } else {
+        sum += 4.3127005919814110e-03f;
+      }
+    }
+    // tree 27
+    if ( x0 >= 1.2440112829208374e+00f ) {
+      if ( x6 >= 3.0987014770507812e+01f ) {
+        sum += -9.8791606724262238e-03f;
+      } else {
+        sum += 7.0440955460071564e-04f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 7.2163939476013184e-03f;
+      } else {
+        sum += -6.4821698470041156e-04f;
+      }
+    }
+    // tree 28
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x2 >= 8.0149250030517578e+00f ) {
+        sum += 1.6654297709465027e-02f;
+      } else {
+        sum += 7.6491511426866055e-03f;
+      }
+    } else {
+      if ( x5 >= 1.6512611389160156e+02f ) {
+        sum += -1.8499745056033134e-02f;
+      } else {
+        sum += 5.0666567403823137e-04f;
+      }
+    }
+    // tree 29
+    if ( x0 >= 1.7165545225143433e+00f ) {
+      if ( x6 >= 3.6611415863037109e+01f ) {
+        sum += -1.7314299941062927e-02f;
+      } else {
+        sum += -2.5165101978927851e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 5.7219704613089561e-03f;
+      } else {
+        sum += -2.0782176870852709e-03f;
+      }
+    }
+    // tree 30
+    if ( x3 >= 1.1412272453308105e+00f ) {
+      if ( x6 >= 4.4502891540527344e+01f ) {
+        sum += -1.3722817413508892e-02f;
+      } else {
+        sum += -1.1259786551818252e-03f;
+      }
+    } else {
+      if ( x4 >= 1.2117969989776611e+00f ) {
+        sum += -1.8735140329226851e-03f;
+      } else {
+        sum += 6.3538285903632641e-03f;
+      }
+    }
+    // tree 31
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x2 >= 7.0298509597778320e+00f ) {
+        sum += 1.2530922889709473e-02f;
+      } else {
+        sum += 5.8505092747509480e-03f;
+      }
+    } else {
+      if ( x0 >= 1.2583262920379639e+00f ) {
+        sum += -4.7243307344615459e-03f;
+      } else {
+        sum += 2.8994444292038679e-03f;
+      }
+    }
+    // tree 32
+    if ( x6 >= 5.9365814208984375e+01f ) {
+      if ( x4 >= 8.9913797378540039e-01f ) {
+        sum += -1.6829753294587135e-02f;
+      } else {
+        sum += -2.4324925616383553e-03f;
+      }
+    } else {
+      if ( x0 >= 1.5190738439559937e+00f ) {
+        sum += -2.7746406849473715e-03f;
+      } else {
+        sum += 4.8104156740009785e-03f;
+      }
+    }
+    // tree 33
+    if ( x2 >= 5.0298509597778320e+00f ) {
+      if ( x5 >= 9.7403213500976562e+01f ) {
+        sum += -5.2926538046449423e-04f;
+      } else {
+        sum += 7.4914577417075634e-03f;
+      }
+    } else {
+      if ( x5 >= 6.2925128936767578e+01f ) {
+        sum += -5.0979000516235828e-03f;
+      } else {
+        sum += 2.1770130842924118e-03f;
+      }
+    }
+    // tree 34
+    if ( x3 >= 1.0781036615371704e+00f ) {
+      if ( x1 >= 1.4478614807128906e+02f ) {
+        sum += -1.7689583823084831e-02f;
+      } else {
+        sum += -1.3687529135495424e-03f;
+      }
+    } else {
+      if ( x4 >= 1.1298940181732178e+00f ) {
+        sum += -7.6355080818757415e-04f;
+      } else {
+        sum += 6.5276664681732655e-03f;
+      }
+    }
+    // tree 35
+    if ( x3 >= 1.6462157964706421e+00f ) {
+      if ( x1 >= 1.0457060241699219e+02f ) {
+        sum += -2.0981395617127419e-02f;
+      } else {
+        sum += -5.4953000508248806e-03f;
+      }
+    } else {
+      if ( x4 >= 1.3766725063323975e+00f ) {
+        sum += -4.1483431123197079e-03f;
+      } else {
+        sum += 4.1130348108708858e-03f;
+      }
+    }
+    // tree 36
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x2 >= 8.0149250030517578e+00f ) {
+        sum += 1.5549710020422935e-02f;
+      } else {
+        sum += 6.6393618471920490e-03f;
+      }
+    } else {
+      if ( x5 >= 1.6512611389160156e+02f ) {
+        sum += -1.6467405483126640e-02f;
+      } else {
+        sum += 5.5920466547831893e-04f;
+      }
+    }
+    // tree 37
+    if ( x0 >= 1.7165545225143433e+00f ) {
+      if ( x6 >= 2.9958602905273438e+01f ) {
+        sum += -1.2922883965075016e-02f;
+      } else {
+        sum += -1.2586996890604496e-03f;
+      }
+    } else {
+      if ( x5 >= 1.1675183105468750e+02f ) {
+        sum += -4.8278947360813618e-03f;
+      } else {
+        sum += 4.3547893874347210e-03f;
+      }
+    }
+    // tree 38
+    if ( x2 >= 4.0447759628295898e+00f ) {
+      if ( x5 >= 7.8051803588867188e+01f ) {
+        sum += -8.6680887034162879e-04f;
+      } else {
+        sum += 5.7914434000849724e-03f;
+      }
+    } else {
+      if ( x0 >= 9.1066282987594604e-01f ) {
+        sum += -6.1615668237209320e-03f;
+      } else {
+        sum += 1.2126883957535028e-03f;
+      }
+    }
+    // tree 39
+    if ( x0 >= 1.1196577548980713e+00f ) {
+      if ( x6 >= 3.0987014770507812e+01f ) {
+        sum += -7.1207368746399879e-03f;
+      } else {
+        sum += 1.0764892213046551e-03f;
+      }
+    } else {
+      if ( x6 >= 6.9238960266113281e+01f ) {
+        sum += -6.8871872499585152e-03f;
+      } else {
+        sum += 5.3599267266690731e-03f;
+      }
+    }
+    // tree 40
+    if ( x4 >= 1.0881404876708984e+00f ) {
+      if ( x5 >= 6.2390853881835938e+01f ) {
+        sum += -7.4884416535496712e-03f;
+      } else {
+        sum += 1.6976182814687490e-03f;
+      }
+    } else {
+      if ( x3 >= 1.4085675477981567e+00f ) {
+        sum += -3.5805439110845327e-03f;
+      } else {
+        sum += 5.2702235989272594e-03f;
+      }
+    }
+    // tree 41
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x2 >= 7.0298509597778320e+00f ) {
+        sum += 1.1454370804131031e-02f;
+      } else {
+        sum += 4.8873331397771835e-03f;
+      }
+    } else {
+      if ( x0 >= 9.4791245460510254e-01f ) {
+        sum += -2.7737414930015802e-03f;
+      } else {
+        sum += 3.7071739789098501e-03f;
+      }
+    }
+    // tree 42
+    if ( x3 >= 1.0781036615371704e+00f ) {
+      if ( x1 >= 1.6087336730957031e+02f ) {
+        sum += -1.8684968352317810e-02f;
+      } else {
+        sum += -1.4053052291274071e-03f;
+      }
+    } else {
+      if ( x4 >= 1.3719704151153564e+00f ) {
+        sum += -2.4544447660446167e-03f;
+      } else {
+        sum += 5.0868312828242779e-03f;
+      }
+    }
+    // tree 43
+    if ( x6 >= 5.2783718109130859e+01f ) {
+      if ( x4 >= 7.8111147880554199e-01f ) {
+        sum += -1.1279777623713017e-02f;
+      } else {
+        sum += 1.1113379150629044e-03f;
+      }
+    } else {
+      if ( x0 >= 1.7425717115402222e+00f ) {
+        sum += -3.4452697727829218e-03f;
+      } else {
+        sum += 3.9138379506766796e-03f;
+      }
+    }
+    // tree 44
+    if ( x2 >= 4.0447759628295898e+00f ) {
+      if ( x5 >= 1.3610183715820312e+02f ) {
+        sum += -6.0190856456756592e-03f;
+      } else {
+        sum += 4.2021623812615871e-03f;
+      }
+    } else {
+      if ( x5 >= 1.9169760131835938e+02f ) {
+        sum += -2.3608857765793800e-02f;
+      } else {
+        sum += -2.6294055860489607e-03f;
+      }
+    }
+    // tree 45
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x2 >= 8.0149250030517578e+00f ) {
+        sum += 1.4648754149675369e-02f;
+      } else {
+        sum += 5.8323009870946407e-03f;
+      }
+    } else {
+      if ( x0 >= 9.4791245460510254e-01f ) {
+        sum += -2.5709914043545723e-03f;
+      } else {
+        sum += 3.4869452938437462e-03f;
+      }
+    }
+    // tree 46
+    if ( x4 >= 1.0263121128082275e+00f ) {
+      if ( x5 >= 6.2390853881835938e+01f ) {
+        sum += -6.3416897319257259e-03f;
+      } else {
+        sum += 1.7693348927423358e-03f;
+      }
+    } else {
+      if ( x3 >= 1.3528705835342407e+00f ) {
+        sum += -2.2443600464612246e-03f;
+      } else {
+        sum += 5.1480410620570183e-03f;
+      }
+    }
+    // tree 47
+    if ( x3 >= 1.6462157964706421e+00f ) {
+      if ( x1 >= 9.6527008056640625e+01f ) {
+        sum += -1.6236558556556702e-02f;
+      } else {
+        sum += -4.2657125741243362e-03f;
+      }
+    } else {
+      if ( x1 >= 1.2161978149414062e+02f ) {
+        sum += -3.2291559036821127e-03f;
+      } else {
+        sum += 3.5373361315578222e-03f;
+      }
+    }
+    // tree 48
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 8.0248756408691406e+00f ) {
+        sum += 1.4224474318325520e-02f;
+      } else {
+        sum += 8.6629642173647881e-03f;
+      }
+    } else {
+      if ( x6 >= 3.6328472137451172e+01f ) {
+        sum += -4.0766983292996883e-03f;
+      } else {
+        sum += 2.2494897712022066e-03f;
+      }
+    }
+    // tree 49
+    if ( x0 >= 1.7165545225143433e+00f ) {
+      if ( x6 >= 2.9958602905273438e+01f ) {
+        sum += -1.0808406397700310e-02f;
+      } else {
+        sum += -1.1217450955882668e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 4.4337240979075432e-03f;
+      } else {
+        sum += -1.5242850640788674e-03f;
+      }
+    }
+    // tree 50
+    if ( x3 >= 9.0977412462234497e-01f ) {
+      if ( x1 >= 1.2065532684326172e+02f ) {
+        sum += -8.9710364118218422e-03f;
+      } else {
+        sum += 1.5993406123016030e-04f;
+      }
+    } else {
+      if ( x4 >= 1.7754309177398682e+00f ) {
+        sum += -7.1689742617309093e-03f;
+      } else {
+        sum += 4.6362527646124363e-03f;
+      }
+    }
+    // tree 51
+    if ( x6 >= 6.2656864166259766e+01f ) {
+      if ( x4 >= 8.9913797378540039e-01f ) {
+        sum += -1.4038811437785625e-02f;
+      } else {
+        sum += -2.3426120169460773e-03f;
+      }
+    } else {
+      if ( x0 >= 1.3949083089828491e+00f ) {
+        sum += -1.6897144960239530e-03f;
+      } else {
+        sum += 3.9231632836163044e-03f;
+      }
+    }
+    // tree 52
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 8.0248756408691406e+00f ) {
+        sum += 1.3803513720631599e-02f;
+      } else {
+        sum += 8.2759046927094460e-03f;
+      }
+    } else {
+      if ( x5 >= 1.9415115356445312e+02f ) {
+        sum += -1.7530417069792747e-02f;
+      } else {
+        sum += 7.4701354606077075e-04f;
+      }
+    }
+    // tree 53
+    if ( x4 >= 1.0263121128082275e+00f ) {
+      if ( x6 >= 2.4806529998779297e+01f ) {
+        sum += -5.3654382936656475e-03f;
+      } else {
+        sum += 1.8580121686682105e-03f;
+      }
+    } else {
+      if ( x3 >= 1.7613148689270020e+00f ) {
+        sum += -7.2932718321681023e-03f;
+      } else {
+        sum += 4.0916888974606991e-03f;
+      }
+    }
+    // tree 54
+    if ( x0 >= 1.9901320934295654e+00f ) {
+      if ( x6 >= 2.4246074676513672e+01f ) {
+        sum += -1.1729939840734005e-02f;
+      } else {
+        sum += -2.1291410084813833e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0298509597778320e+00f ) {
+        sum += 5.2631283178925514e-03f;
+      } else {
+        sum += -1.3645128638017923e-04f;
+      }
+    }
+    // tree 55
+    if ( x3 >= 9.0977412462234497e-01f ) {
+      if ( x1 >= 1.6087336730957031e+02f ) {
+        sum += -1.3500987552106380e-02f;
+      } else {
+        sum += -4.1581800905987620e-04f;
+      }
+    } else {
+      if ( x4 >= 1.7754309177398682e+00f ) {
+        sum += -6.5308897756040096e-03f;
+      } else {
+        sum += 4.3314816430211067e-03f;
+      }
+    }
+    // tree 56
+    if ( x0 >= 9.4556289911270142e-01f ) {
+      if ( x6 >= 2.9746456146240234e+01f ) {
+        sum += -4.8481700941920280e-03f;
+      } else {
+        sum += 1.4702311018481851e-03f;
+      }
+    } else {
+      if ( x5 >= 1.9660771179199219e+02f ) {
+        sum += -1.1481644585728645e-02f;
+      } else {
+        sum += 4.6998825855553150e-03f;
+      }
+    }
+    // tree 57
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 8.0248756408691406e+00f ) {
+        sum += 1.3320431113243103e-02f;
+      } else {
+        sum += 7.8097735531628132e-03f;
+      }
+    } else {
+      if ( x5 >= 1.5545111083984375e+02f ) {
+        sum += -1.0364746674895287e-02f;
+      } else {
+        sum += 9.2711119214072824e-04f;
+      }
+    }
+    // tree 58
+    if ( x4 >= 1.2530158758163452e+00f ) {
+      if ( x5 >= 5.0279880523681641e+01f ) {
+        sum += -6.0759293846786022e-03f;
+      } else {
+        sum += 2.0289055537432432e-03f;
+      }
+    } else {
+      if ( x3 >= 1.3343049287796021e+00f ) {
+        sum += -2.3635793477296829e-03f;
+      } else {
+        sum += 3.8698217831552029e-03f;
+      }
+    }
+    // tree 59
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x2 >= 8.0149250030517578e+00f ) {
+        sum += 1.2977445498108864e-02f;
+      } else {
+        sum += 4.9162413924932480e-03f;
+      }
+    } else {
+      if ( x0 >= 9.1066282987594604e-01f ) {
+        sum += -2.0540249533951283e-03f;
+      } else {
+        sum += 3.0793673358857632e-03f;
+      }
+    }
+    // tree 60
+    if ( x2 >= 4.0447759628295898e+00f ) {
+      if ( x0 >= 1.9651278257369995e+00f ) {
+        sum += -4.7101238742470741e-03f;
+      } else {
+        sum += 3.5031435545533895e-03f;
+      }
+    } else {
+      if ( x0 >= 6.8716490268707275e-01f ) {
+        sum += -3.9103431627154350e-03f;
+      } else {
+        sum += 1.8296123016625643e-03f;
+      }
+    }
+    // tree 61
+    if ( x6 >= 7.2530014038085938e+01f ) {
+      if ( x4 >= 6.1007094383239746e-01f ) {
+        sum += -1.2676231563091278e-02f;
+      } else {
+        sum += 9.8727119620889425e-04f;
+      }
+    } else {
+      if ( x4 >= 1.3766725063323975e+00f ) {
+        sum += -2.9604570008814335e-03f;
+      } else {
+        sum += 2.8087790124118328e-03f;
+      }
+    }
+    // tree 62
+    if ( x1 >= 1.2065532684326172e+02f ) {
+      if ( x3 >= 7.7342545986175537e-01f ) {
+        sum += -6.8820952437818050e-03f;
+      } else {
+        sum += 9.4103213632479310e-04f;
+      }
+    } else {
+      if ( x6 >= 3.1901451110839844e+01f ) {
+        sum += -1.0897278552874923e-03f;
+      } else {
+        sum += 3.8885972462594509e-03f;
+      }
+    }
+    // tree 63
+    if ( x3 >= 1.0781036615371704e+00f ) {
+      if ( x1 >= 9.6524497985839844e+01f ) {
+        sum += -6.6178310662508011e-03f;
+      } else {
+        sum += -7.4126226536463946e-05f;
+      }
+    } else {
+      if ( x2 >= 5.0298509597778320e+00f ) {
+        sum += 5.3079649806022644e-03f;
+      } else {
+        sum += 8.7531999452039599e-04f;
+      }
+    }
+    // tree 64
+    if ( x0 >= 1.6419423818588257e+00f ) {
+      if ( x6 >= 2.9958602905273438e+01f ) {
+        sum += -8.0983275547623634e-03f;
+      } else {
+        sum += -6.8193784682080150e-04f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 3.8008596748113632e-03f;
+      } else {
+        sum += -1.1195214465260506e-03f;
+      }
+    }
+    // tree 65
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.5879001468420029e-02f;
+      } else {
+        sum += 8.0502666532993317e-03f;
+      }
+    } else {
+      if ( x5 >= 1.9415115356445312e+02f ) {
+        sum += -1.4929964207112789e-02f;
+      } else {
+        sum += 6.2866584630683064e-04f;
+      }
+    }
+    // tree 66
+    if ( x4 >= 9.8509329557418823e-01f ) {
+      if ( x5 >= 6.2390853881835938e+01f ) {
+        sum += -4.7880820930004120e-03f;
+      } else {
+        sum += 1.4996135141700506e-03f;
+      }
+    } else {
+      if ( x1 >= 1.6087336730957031e+02f ) {
+        sum += -3.7669304292649031e-03f;
+      } else {
+        sum += 3.8441927172243595e-03f;
+      }
+    }
+    // tree 67
+    if ( x0 >= 1.2067052125930786e+00f ) {
+      if ( x6 >= 2.5740303039550781e+01f ) {
+        sum += -4.4009652920067310e-03f;
+      } else {
+        sum += 1.0327704949304461e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0298509597778320e+00f ) {
+        sum += 5.8542047627270222e-03f;
+      } else {
+        sum += 1.2226749677211046e-03f;
+      }
+    }
+    // tree 68
+    if ( x3 >= 1.7724629640579224e+00f ) {
+      if ( x3 >= 2.2586174011230469e+00f ) {
+        sum += -1.5997871756553650e-02f;
+      } else {
+        sum += -4.9485145136713982e-03f;
+      }
+    } else {
+      if ( x4 >= 1.7476421594619751e+00f ) {
+        sum += -6.3519012182950974e-03f;
+      } else {
+        sum += 2.1184813231229782e-03f;
+      }
+    }
+    // tree 69
+    if ( x0 >= 1.9901320934295654e+00f ) {
+      if ( x6 >= 2.2211050033569336e+01f ) {
+        sum += -9.0899374336004257e-03f;
+      } else {
+        sum += -1.5680153155699372e-03f;
+      }
+    } else {
+      if ( x5 >= 1.2642607879638672e+02f ) {
+        sum += -4.5418646186590195e-03f;
+      } else {
+        sum += 2.4286857806146145e-03f;
+      }
+    }
+    // tree 70
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.5513463877141476e-02f;
+      } else {
+        sum += 7.6926136389374733e-03f;
+      }
+    } else {
+      if ( x6 >= 7.2530014038085938e+01f ) {
+        sum += -9.4296298921108246e-03f;
+      } else {
+        sum += 7.3118926957249641e-04f;
+      }
+    }
+    // tree 71
+    if ( x3 >= 9.0977412462234497e-01f ) {
+      if ( x1 >= 9.6524497985839844e+01f ) {
+        sum += -5.2339397370815277e-03f;
+      } else {
+        sum += 5.4075208026915789e-04f;
+      }
+    } else {
+      if ( x4 >= 1.8964689970016479e+00f ) {
+        sum += -7.5534558854997158e-03f;
+      } else {
+        sum += 3.5590224433690310e-03f;
+      }
+    }
+    // tree 72
+    if ( x4 >= 9.8509329557418823e-01f ) {
+      if ( x6 >= 2.1845241546630859e+01f ) {
+        sum += -3.6813002079725266e-03f;
+      } else {
+        sum += 2.2372889798134565e-03f;
+      }
+    } else {
+      if ( x1 >= 9.6524497985839844e+01f ) {
+        sum += -1.3689789921045303e-04f;
+      } else {
+        sum += 4.3672421015799046e-03f;
+      }
+    }
+    // tree 73
+    if ( x0 >= 9.4556289911270142e-01f ) {
+      if ( x5 >= 5.8701011657714844e+01f ) {
+        sum += -3.2643191516399384e-03f;
+      } else {
+        sum += 1.6543185338377953e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0348258018493652e+00f ) {
+        sum += 6.2606404535472393e-03f;
+      } else {
+        sum += 1.8188472604379058e-03f;
+      }
+    }
+    // tree 74
+    if ( x3 >= 8.0456823110580444e-01f ) {
+      if ( x1 >= 1.6087336730957031e+02f ) {
+        sum += -9.9439984187483788e-03f;
+      } else {
+        sum += -4.7547520807711408e-05f;
+      }
+    } else {
+      if ( x5 >= 1.2062556457519531e+02f ) {
+        sum += -1.0708367917686701e-03f;
+      } else {
+        sum += 4.3705762363970280e-03f;
+      }
+    }
+    // tree 75
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 8.0248756408691406e+00f ) {
+        sum += 1.1824170127511024e-02f;
+      } else {
+        sum += 6.3536209054291248e-03f;
+      }
+    } else {
+      if ( x0 >= 2.0033192634582520e+00f ) {
+        sum += -6.0510090552270412e-03f;
+      } else {
+        sum += 8.5107679478824139e-04f;
+      }
+    }
+    // tree 76
+    if ( x3 >= 1.7724629640579224e+00f ) {
+      if ( x3 >= 2.2586174011230469e+00f ) {
+        sum += -1.4591428451240063e-02f;
+      } else {
+        sum += -4.4711199589073658e-03f;
+      }
+    } else {
+      if ( x4 >= 1.3766725063323975e+00f ) {
+        sum += -2.5955718010663986e-03f;
+      } else {
+        sum += 2.3833769373595715e-03f;
+      }
+    }
+    // tree 77
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.4930410310626030e-02f;
+      } else {
+        sum += 7.0697036571800709e-03f;
+      }
+    } else {
+      if ( x5 >= 1.9415115356445312e+02f ) {
+        sum += -1.2995067052543163e-02f;
+      } else {
+        sum += 5.2432098891586065e-04f;
+      }
+    }
+    // tree 78
+    if ( x0 >= 8.4608012437820435e-01f ) {
+      if ( x6 >= 2.9746456146240234e+01f ) {
+        sum += -3.5182973369956017e-03f;
+      } else {
+        sum += 1.2817585375159979e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 4.9663265235722065e-03f;
+      } else {
+        sum += 7.3074694955721498e-04f;
+      }
+    }
+    // tree 79
+    if ( x3 >= 8.0456823110580444e-01f ) {
+      if ( x6 >= 4.1848831176757812e+01f ) {
+        sum += -5.2363057620823383e-03f;
+      } else {
+        sum += 5.8357184752821922e-04f;
+      }
+    } else {
+      if ( x4 >= 1.9950120449066162e+00f ) {
+        sum += -8.3958394825458527e-03f;
+      } else {
+        sum += 3.5989114549010992e-03f;
+      }
+    }
+    // tree 80
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x2 >= 8.0149250030517578e+00f ) {
+        sum += 1.1272639036178589e-02f;
+      } else {
+        sum += 3.8452332373708487e-03f;
+      }
+    } else {
+      if ( x1 >= 8.8480888366699219e+01f ) {
+        sum += -2.5502566713839769e-03f;
+      } else {
+        sum += 1.3868625974282622e-03f;
+      }
+    }
+    // tree 81
+    if ( x0 >= 1.7165545225143433e+00f ) {
+      if ( x6 >= 3.8829017639160156e+01f ) {
+        sum += -9.0567814186215401e-03f;
+      } else {
+        sum += -1.4595873653888702e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 3.0561818275600672e-03f;
+      } else {
+        sum += -1.1014847550541162e-03f;
+      }
+    }
+    // tree 82
+    if ( x4 >= 7.5838953256607056e-01f ) {
+      if ( x6 >= 5.1458141326904297e+01f ) {
+        sum += -6.9655054248869419e-03f;
+      } else {
+        sum += 4.1415862506255507e-04f;
+      }
+    } else {
+      if ( x6 >= 9.2276344299316406e+01f ) {
+        sum += -6.5387100912630558e-03f;
+      } else {
+        sum += 3.8750981912016869e-03f;
+      }
+    }
+    // tree 83
+    if ( x3 >= 1.0781036615371704e+00f ) {
+      if ( x1 >= 5.6306449890136719e+01f ) {
+        sum += -3.6156319547444582e-03f;
+      } else {
+        sum += 1.2758487137034535e-03f;
+      }
+    } else {
+      if ( x1 >= 1.2162000274658203e+02f ) {
+        sum += -1.1524237925186753e-03f;
+      } else {
+        sum += 3.2774638384580612e-03f;
+      }
+    }
+    // tree 84
+    if ( x0 >= 1.1196577548980713e+00f ) {
+      if ( x1 >= 7.2393669128417969e+01f ) {
+        sum += -3.3132121898233891e-03f;
+      } else {
+        sum += 1.0219556279480457e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0298509597778320e+00f ) {
+        sum += 5.1956507377326488e-03f;
+      } else {
+        sum += 1.1046663857996464e-03f;
+      }
+    }
+    // tree 85
+    if ( x4 >= 1.0263121128082275e+00f ) {
+      if ( x6 >= 2.1845241546630859e+01f ) {
+        sum += -3.4190677106380463e-03f;
+      } else {
+        sum += 1.8966782372444868e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 3.5031500738114119e-03f;
+      } else {
+        sum += -7.0913945091888309e-04f;
+      }
+    }
+    // tree 86
+    if ( x0 >= 1.9901320934295654e+00f ) {
+      if ( x4 >= 2.2072615623474121e+00f ) {
+        sum += -1.8506580963730812e-02f;
+      } else {
+        sum += -3.8450441788882017e-03f;
+      }
+    } else {
+      if ( x5 >= 1.9415115356445312e+02f ) {
+        sum += -1.0275371372699738e-02f;
+      } else {
+        sum += 1.6212118789553642e-03f;
+      }
+    }
+    // tree 87
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.4331820420920849e-02f;
+      } else {
+        sum += 6.4577232114970684e-03f;
+      }
+    } else {
+      if ( x6 >= 7.2530014038085938e+01f ) {
+        sum += -7.8680692240595818e-03f;
+      } else {
+        sum += 5.7981116697192192e-04f;
+      }
+    }
+    // tree 88
+    if ( x3 >= 7.4144464731216431e-01f ) {
+      if ( x1 >= 1.6087336730957031e+02f ) {
+        sum += -8.0388700589537621e-03f;
+      } else {
+        sum += 1.0828969971043989e-04f;
+      }
+    } else {
+      if ( x4 >= 1.9997034072875977e+00f ) {
+        sum += -8.3435866981744766e-03f;
+      } else {
+        sum += 3.6543577443808317e-03f;
+      }
+    }
+    // tree 89
+    if ( x0 >= 8.4608012437820435e-01f ) {
+      if ( x6 >= 2.6455408096313477e+01f ) {
+        sum += -2.6570353657007217e-03f;
+      } else {
+        sum += 1.2953339610248804e-03f;
+      }
+    } else {
+      if ( x5 >= 1.9660771179199219e+02f ) {
+        sum += -7.3488084599375725e-03f;
+      } else {
+        sum += 3.5480037331581116e-03f;
+      }
+    }
+    // tree 90
+    if ( x3 >= 1.8355864286422729e+00f ) {
+      if ( x3 >= 2.5874214172363281e+00f ) {
+        sum += -2.0882671698927879e-02f;
+      } else {
+        sum += -5.4118996486067772e-03f;
+      }
+    } else {
+      if ( x4 >= 1.7476421594619751e+00f ) {
+        sum += -5.1278504543006420e-03f;
+      } else {
+        sum += 1.6051934799179435e-03f;
+      }
+    }
+    // tree 91
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 8.0248756408691406e+00f ) {
+        sum += 1.0633445344865322e-02f;
+      } else {
+        sum += 5.2474671974778175e-03f;
+      }
+    } else {
+      if ( x0 >= 2.1274847984313965e+00f ) {
+        sum += -6.5578795038163662e-03f;
+      } else {
+        sum += 5.5684038670733571e-04f;
+      }
+    }
+    // tree 92
+    if ( x4 >= 7.5838953256607056e-01f ) {
+      if ( x5 >= 5.0279880523681641e+01f ) {
+        sum += -2.2418496664613485e-03f;
+      } else {
+        sum += 2.2467891685664654e-03f;
+      }
+    } else {
+      if ( x1 >= 2.2522225952148438e+02f ) {
+        sum += -5.6774043478071690e-03f;
+      } else {
+        sum += 3.4949858672916889e-03f;
+      }
+    }
+    // tree 93
+    if ( x3 >= 8.0456823110580444e-01f ) {
+      if ( x5 >= 3.9350990295410156e+01f ) {
+        sum += -1.7640246078372002e-03f;
+      } else {
+        sum += 2.9040123336017132e-03f;
+      }
+    } else {
+      if ( x6 >= 8.8985298156738281e+01f ) {
+        sum += -6.7292246967554092e-03f;
+      } else {
+        sum += 3.1453473493456841e-03f;
+      }
+    }
+    // tree 94
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x2 >= 8.0149250030517578e+00f ) {
+        sum += 1.0357861407101154e-02f;
+      } else {
+        sum += 3.2983096316456795e-03f;
+      }
+    } else {
+      if ( x0 >= 9.1066282987594604e-01f ) {
+        sum += -1.4232973335310817e-03f;
+      } else {
+        sum += 2.0278261508792639e-03f;
+      }
+    }
+    // tree 95
+    if ( x1 >= 9.6524497985839844e+01f ) {
+      if ( x1 >= 2.7804629516601562e+02f ) {
+        sum += -1.3657598756253719e-02f;
+      } else {
+        sum += -1.2255018809810281e-03f;
+      }
+    } else {
+      if ( x6 >= 4.0114837646484375e+01f ) {
+        sum += -1.6711474163457751e-03f;
+      } else {
+        sum += 2.7844423893839121e-03f;
+      }
+    }
+    // tree 96
+    if ( x3 >= 1.6462157964706421e+00f ) {
+      if ( x3 >= 2.2539074420928955e+00f ) {
+        sum += -1.2047997675836086e-02f;
+      } else {
+        sum += -2.9341715853661299e-03f;
+      }
+    } else {
+      if ( x4 >= 1.8506894111633301e+00f ) {
+        sum += -5.9642805717885494e-03f;
+      } else {
+        sum += 1.5583238564431667e-03f;
+      }
+    }
+    // tree 97
+    if ( x4 >= 7.5838953256607056e-01f ) {
+      if ( x6 >= 2.4806529998779297e+01f ) {
+        sum += -2.4489865172654390e-03f;
+      } else {
+        sum += 1.6670458717271686e-03f;
+      }
+    } else {
+      if ( x3 >= 8.5159802436828613e-01f ) {
+        sum += 1.5799609245732427e-03f;
+      } else {
+        sum += 4.7755353152751923e-03f;
+      }
+    }
+    // tree 98
+    if ( x0 >= 1.3186233043670654e+00f ) {
+      if ( x1 >= 7.5158531188964844e+01f ) {
+        sum += -3.6370861344039440e-03f;
+      } else {
+        sum += 5.8049702784046531e-04f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 3.0702885705977678e-03f;
+      } else {
+        sum += -5.5046950001269579e-04f;
+      }
+    }
+    // tree 99
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.3611562550067902e-02f;
+      } else {
+        sum += 5.7167974300682545e-03f;
+      }
+    } else {
+      if ( x5 >= 1.6512611389160156e+02f ) {
+        sum += -7.5491857714951038e-03f;
+      } else {
+        sum += 4.9031438538804650e-04f;
+      }
+    }
+    // tree 100
+    if ( x0 >= 2.1269209384918213e+00f ) {
+      if ( x4 >= 2.2072615623474121e+00f ) {
+        sum += -1.8595313653349876e-02f;
+      } else {
+        sum += -4.6283937990665436e-03f;
+      }
+    } else {
+      if ( x1 >= 1.6087336730957031e+02f ) {
+        sum += -3.9406274445354939e-03f;
+      } else {
+        sum += 1.4750676928088069e-03f;
+      }
+    }
+    // tree 101
+    if ( x3 >= 7.4144464731216431e-01f ) {
+      if ( x6 >= 5.2465080261230469e+01f ) {
+        sum += -5.5598369799554348e-03f;
+      } else {
+        sum += 2.7908248011954129e-04f;
+      }
+    } else {
+      if ( x2 >= 5.0298509597778320e+00f ) {
+        sum += 4.7890301793813705e-03f;
+      } else {
+        sum += 1.4342793729156256e-03f;
+      }
+    }
+    // tree 102
+    if ( x0 >= 8.4608012437820435e-01f ) {
+      if ( x1 >= 5.6306449890136719e+01f ) {
+        sum += -1.9168885191902518e-03f;
+      } else {
+        sum += 1.6933672595769167e-03f;
+      }
+    } else {
+      if ( x1 >= 2.7724642944335938e+02f ) {
+        sum += -1.0760914534330368e-02f;
+      } else {
+        sum += 2.9863053932785988e-03f;
+      }
+    }
+    // tree 103
+    if ( x4 >= 9.8509329557418823e-01f ) {
+      if ( x6 >= 2.1845241546630859e+01f ) {
+        sum += -2.7615297585725784e-03f;
+      } else {
+        sum += 1.6401368193328381e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 3.0375649221241474e-03f;
+      } else {
+        sum += -5.6492740986868739e-04f;
+      }
+    }
+    // tree 104
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.3326919637620449e-02f;
+      } else {
+        sum += 5.4448689334094524e-03f;
+      }
+    } else {
+      if ( x6 >= 8.2403160095214844e+01f ) {
+        sum += -8.4808776155114174e-03f;
+      } else {
+        sum += 3.8423421210609376e-04f;
+      }
+    }
+    // tree 105
+    if ( x3 >= 1.0781036615371704e+00f ) {
+      if ( x5 >= 2.3285250854492188e+02f ) {
+        sum += -2.5734504684805870e-02f;
+      } else {
+        sum += -1.0551318991929293e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 2.6932815089821815e-03f;
+      } else {
+        sum += -6.9872895255684853e-04f;
+      }
+    }
+    // tree 106
+    if ( x0 >= 1.6419423818588257e+00f ) {
+      if ( x3 >= 1.9997395277023315e+00f ) {
+        sum += -1.1861657723784447e-02f;
+      } else {
+        sum += -1.5047522028908134e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 2.4267600383609533e-03f;
+      } else {
+        sum += -7.7303987927734852e-04f;
+      }
+    }
+    // tree 107
+    if ( x4 >= 7.5838953256607056e-01f ) {
+      if ( x5 >= 6.8446334838867188e+01f ) {
+        sum += -2.7199699543416500e-03f;
+      } else {
+        sum += 1.1445229174569249e-03f;
+      }
+    } else {
+      if ( x0 >= 4.7298571467399597e-01f ) {
+        sum += 2.0681547466665506e-03f;
+      } else {
+        sum += 6.5391338430345058e-03f;
+      }
+    }
+    // tree 108
+    if ( x3 >= 6.7832106351852417e-01f ) {
+      if ( x1 >= 8.0437278747558594e+01f ) {
+        sum += -2.2166399285197258e-03f;
+      } else {
+        sum += 1.1015335330739617e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0348258018493652e+00f ) {
+        sum += 4.9421167932450771e-03f;
+      } else {
+        sum += 1.5906967455521226e-03f;
+      }
+    }
+    // tree 109
+    if ( x0 >= 5.6006711721420288e-01f ) {
+      if ( x6 >= 8.2403160095214844e+01f ) {
+        sum += -9.3695754185318947e-03f;
+      } else {
+        sum += 1.2904639879707247e-04f;
+      }
+    } else {
+      if ( x1 >= 2.8106744384765625e+02f ) {
+        sum += -8.8058756664395332e-03f;
+      } else {
+        sum += 4.0016649290919304e-03f;
+      }
+    }
+    // tree 110
+    if ( x0 >= 2.1269209384918213e+00f ) {
+      if ( x6 >= 1.4070947647094727e+01f ) {
+        sum += -6.3949506729841232e-03f;
+      } else {
+        sum += 1.6479120822623372e-03f;
+      }
+    } else {
+      if ( x2 >= 6.0149254798889160e+00f ) {
+        sum += 4.1229641065001488e-03f;
+      } else {
+        sum += 2.0904584380332381e-04f;
+      }
+    }
+    // tree 111
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.2974181212484837e-02f;
+      } else {
+        sum += 5.0504757091403008e-03f;
+      }
+    } else {
+      if ( x0 >= 6.8716490268707275e-01f ) {
+        sum += -7.0145493373274803e-04f;
+      } else {
+        sum += 2.6514984201639891e-03f;
+      }
+    }
+    // tree 112
+    if ( x3 >= 6.3623869419097900e-01f ) {
+      if ( x1 >= 1.6087336730957031e+02f ) {
+        sum += -5.6314645335078239e-03f;
+      } else {
+        sum += 2.7017798856832087e-04f;
+      }
+    } else {
+      if ( x2 >= 5.0348258018493652e+00f ) {
+        sum += 5.3466898389160633e-03f;
+      } else {
+        sum += 1.5967865474522114e-03f;
+      }
+    }
+    // tree 113
+    if ( x4 >= 1.0881404876708984e+00f ) {
+      if ( x6 >= 1.8883951187133789e+01f ) {
+        sum += -2.5836019776761532e-03f;
+      } else {
+        sum += 2.0496367942541838e-03f;
+      }
+    } else {
+      if ( x3 >= 1.8727087974548340e+00f ) {
+        sum += -6.3796336762607098e-03f;
+      } else {
+        sum += 1.9809701479971409e-03f;
+      }
+    }
+    // tree 114
+    if ( x4 >= 7.5838953256607056e-01f ) {
+      if ( x5 >= 5.0279880523681641e+01f ) {
+        sum += -1.7986253369599581e-03f;
+      } else {
+        sum += 1.7852162709459662e-03f;
+      }
+    } else {
+      if ( x5 >= 2.8122622680664062e+02f ) {
+        sum += -1.2795932590961456e-02f;
+      } else {
+        sum += 2.6361462660133839e-03f;
+      }
+    }
+    // tree 115
+    if ( x0 >= 1.9901320934295654e+00f ) {
+      if ( x4 >= 2.2072615623474121e+00f ) {
+        sum += -1.4614008367061615e-02f;
+      } else {
+        sum += -2.8477548621594906e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 1.8949724035337567e-03f;
+      } else {
+        sum += -1.0521471267566085e-03f;
+      }
+    }
+    // tree 116
+    if ( x3 >= 1.4147627353668213e+00f ) {
+      if ( x3 >= 2.2553703784942627e+00f ) {
+        sum += -1.0106367059051991e-02f;
+      } else {
+        sum += -1.5990182291716337e-03f;
+      }
+    } else {
+      if ( x4 >= 1.5415478944778442e+00f ) {
+        sum += -2.7370902244001627e-03f;
+      } else {
+        sum += 1.7196439439430833e-03f;
+      }
+    }
+    // tree 117
+    if ( x1 >= 7.2393669128417969e+01f ) {
+      if ( x0 >= 9.5794516801834106e-01f ) {
+        sum += -2.2436382714658976e-03f;
+      } else {
+        sum += 1.2202231446281075e-03f;
+      }
+    } else {
+      if ( x6 >= 4.9812068939208984e+01f ) {
+        sum += -2.6122708804905415e-03f;
+      } else {
+        sum += 2.5375802069902420e-03f;
+      }
+    }
+    // tree 118
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 8.0248756408691406e+00f ) {
+        sum += 9.1580385342240334e-03f;
+      } else {
+        sum += 3.8239296991378069e-03f;
+      }
+    } else {
+      if ( x5 >= 2.5220121765136719e+02f ) {
+        sum += -1.5303056687116623e-02f;
+      } else {
+        sum += 1.9673207134474069e-04f;
+      }
+    }
+    // tree 119
+    if ( x3 >= 7.4144464731216431e-01f ) {
+      if ( x5 >= 3.9350990295410156e+01f ) {
+        sum += -1.2855224777013063e-03f;
+      } else {
+        sum += 2.4499753490090370e-03f;
+      }
+    } else {
+      if ( x4 >= 1.9997034072875977e+00f ) {
+        sum += -6.6581130959093571e-03f;
+      } else {
+        sum += 2.6807854883372784e-03f;
+      }
+    }
+    // tree 120
+    if ( x0 >= 5.2276104688644409e-01f ) {
+      if ( x6 >= 8.8985252380371094e+01f ) {
+        sum += -9.7306631505489349e-03f;
+      } else {
+        sum += 1.0446456872159615e-04f;
+      }
+    } else {
+      if ( x1 >= 2.7508752441406250e+02f ) {
+        sum += -8.4337797015905380e-03f;
+      } else {
+        sum += 3.8196819368749857e-03f;
+      }
+    }
+    // tree 121
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 8.0248756408691406e+00f ) {
+        sum += 8.9321127161383629e-03f;
+      } else {
+        sum += 3.6757700145244598e-03f;
+      }
+    } else {
+      if ( x0 >= 2.1771509647369385e+00f ) {
+        sum += -5.5402615107595921e-03f;
+      } else {
+        sum += 3.4654352930374444e-04f;
+      }
+    }
+    // tree 122
+    if ( x1 >= 9.6524497985839844e+01f ) {
+      if ( x1 >= 3.2342663574218750e+02f ) {
+        sum += -1.5195266343653202e-02f;
+      } else {
+        sum += -1.0754867689684033e-03f;
+      }
+    } else {
+      if ( x6 >= 4.0114837646484375e+01f ) {
+        sum += -1.4775195159018040e-03f;
+      } else {
+        sum += 2.1780745591968298e-03f;
+      }
+    }
+    // tree 123
+    if ( x3 >= 6.3623869419097900e-01f ) {
+      if ( x0 >= 6.8716490268707275e-01f ) {
+        sum += -9.9257240071892738e-04f;
+      } else {
+        sum += 2.3488053120672703e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0348258018493652e+00f ) {
+        sum += 4.9269297160208225e-03f;
+      } else {
+        sum += 1.4114230871200562e-03f;
+      }
+    }
+    // tree 124
+    if ( x4 >= 7.5838953256607056e-01f ) {
+      if ( x6 >= 2.4806529998779297e+01f ) {
+        sum += -1.9762907177209854e-03f;
+      } else {
+        sum += 1.3290132628753781e-03f;
+      }
+    } else {
+      if ( x3 >= 2.1697590351104736e+00f ) {
+        sum += -9.2718936502933502e-03f;
+      } else {
+        sum += 2.4485788308084011e-03f;
+      }
+    }
+    // tree 125
+    if ( x1 >= 4.8262840270996094e+01f ) {
+      if ( x3 >= 1.1412272453308105e+00f ) {
+        sum += -2.6431863661855459e-03f;
+      } else {
+        sum += 6.7085289629176259e-04f;
+      }
+    } else {
+      if ( x6 >= 6.3082351684570312e+01f ) {
+        sum += -3.4005863126367331e-03f;
+      } else {
+        sum += 2.6813216973096132e-03f;
+      }
+    }
+    // tree 126
+    if ( x0 >= 1.3186233043670654e+00f ) {
+      if ( x3 >= 8.0846983194351196e-01f ) {
+        sum += -2.2990396246314049e-03f;
+      } else {
+        sum += 1.1864022817462683e-03f;
+      }
+    } else {
+      if ( x1 >= 2.8152752685546875e+02f ) {
+        sum += -1.0421535000205040e-02f;
+      } else {
+        sum += 1.5686993720009923e-03f;
+      }
+    }
+    // tree 127
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.2301636859774590e-02f;
+      } else {
+        sum += 4.3422817252576351e-03f;
+      }
+    } else {
+      if ( x5 >= 1.9415115356445312e+02f ) {
+        sum += -7.9955970868468285e-03f;
+      } else {
+        sum += 2.6445934781804681e-04f;
+      }
+    }
+    // tree 128
+    if ( x4 >= 7.1717071533203125e-01f ) {
+      if ( x5 >= 5.0279880523681641e+01f ) {
+        sum += -1.5162120107561350e-03f;
+      } else {
+        sum += 1.6084958333522081e-03f;
+      }
+    } else {
+      if ( x3 >= 1.3567156791687012e+00f ) {
+        sum += -1.9663122657220811e-04f;
+      } else {
+        sum += 3.0043395236134529e-03f;
+      }
+    }
+    // tree 129
+    if ( x0 >= 1.7165545225143433e+00f ) {
+      if ( x6 >= 1.4435374259948730e+01f ) {
+        sum += -2.7492998633533716e-03f;
+      } else {
+        sum += 2.1907822228968143e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 1.8765946151688695e-03f;
+      } else {
+        sum += -7.3487835470587015e-04f;
+      }
+    }
+    // tree 130
+    if ( x1 >= 5.6306449890136719e+01f ) {
+      if ( x3 >= 1.1258590221405029e+00f ) {
+        sum += -2.6071250904351473e-03f;
+      } else {
+        sum += 5.6014623260125518e-04f;
+      }
+    } else {
+      if ( x6 >= 7.1044525146484375e+01f ) {
+        sum += -4.6486500650644302e-03f;
+      } else {
+        sum += 2.2307247854769230e-03f;
+      }
+    }
+    // tree 131
+    if ( x0 >= 5.2276104688644409e-01f ) {
+      if ( x1 >= 1.6087336730957031e+02f ) {
+        sum += -4.0904697962105274e-03f;
+      } else {
+        sum += 2.9112503398209810e-04f;
+      }
+    } else {
+      if ( x4 >= 6.3849496841430664e-01f ) {
+        sum += 2.5002153124660254e-03f;
+      } else {
+        sum += 5.8019375428557396e-03f;
+      }
+    }
+    // tree 132
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 8.0248756408691406e+00f ) {
+        sum += 8.4573281928896904e-03f;
+      } else {
+        sum += 3.2679489813745022e-03f;
+      }
+    } else {
+      if ( x0 >= 2.2019841670989990e+00f ) {
+        sum += -5.3713689558207989e-03f;
+      } else {
+        sum += 2.8355463291518390e-04f;
+      }
+    }
+    // tree 133
+    if ( x3 >= 6.3623869419097900e-01f ) {
+      if ( x6 >= 1.9873228073120117e+01f ) {
+        sum += -1.0712291114032269e-03f;
+      } else {
+        sum += 1.6726088942959905e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0348258018493652e+00f ) {
+        sum += 4.5540598221123219e-03f;
+      } else {
+        sum += 1.2261737138032913e-03f;
+      }
+    }
+    // tree 134
+    if ( x4 >= 9.2326498031616211e-01f ) {
+      if ( x6 >= 2.1845241546630859e+01f ) {
+        sum += -1.9972359295934439e-03f;
+      } else {
+        sum += 1.3931836001574993e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 2.3952675983309746e-03f;
+      } else {
+        sum += -3.7731550401076674e-04f;
+      }
+    }
+    // tree 135
+    if ( x3 >= 1.7093393802642822e+00f ) {
+      if ( x3 >= 2.5798828601837158e+00f ) {
+        sum += -1.5223933383822441e-02f;
+      } else {
+        sum += -2.7043158188462257e-03f;
+      }
+    } else {
+      if ( x4 >= 1.9949554204940796e+00f ) {
+        sum += -6.4849033951759338e-03f;
+      } else {
+        sum += 9.8515185527503490e-04f;
+      }
+    }
+    // tree 136
+    if ( x1 >= 4.8262840270996094e+01f ) {
+      if ( x0 >= 2.1765418052673340e+00f ) {
+        sum += -6.3703511841595173e-03f;
+      } else {
+        sum += -1.2001040886389092e-04f;
+      }
+    } else {
+      if ( x6 >= 6.3082351684570312e+01f ) {
+        sum += -3.0564337503165007e-03f;
+      } else {
+        sum += 2.4084791075438261e-03f;
+      }
+    }
+    // tree 137
+    if ( x5 >= 2.8122622680664062e+02f ) {
+      if ( x4 >= 5.5172979831695557e-01f ) {
+        sum += -2.0192425698041916e-02f;
+      } else {
+        sum += 2.4163168563973159e-04f;
+      }
+    } else {
+      if ( x2 >= 6.0149254798889160e+00f ) {
+        sum += 3.0193491838872433e-03f;
+      } else {
+        sum += -6.9767818786203861e-05f;
+      }
+    }
+    // tree 138
+    if ( x0 >= 5.2276104688644409e-01f ) {
+      if ( x6 >= 8.2403160095214844e+01f ) {
+        sum += -7.1744527667760849e-03f;
+      } else {
+        sum += 1.0885609663091600e-04f;
+      }
+    } else {
+      if ( x1 >= 2.7508752441406250e+02f ) {
+        sum += -6.9210552610456944e-03f;
+      } else {
+        sum += 3.2439068891108036e-03f;
+      }
+    }
+    // tree 139
+    if ( x3 >= 6.3623869419097900e-01f ) {
+      if ( x5 >= 3.9350990295410156e+01f ) {
+        sum += -8.6458399891853333e-04f;
+      } else {
+        sum += 2.0270200911909342e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0348258018493652e+00f ) {
+        sum += 4.3176501058042049e-03f;
+      } else {
+        sum += 1.1708276579156518e-03f;
+      }
+    }
+    // tree 140
+    if ( x4 >= 7.1717071533203125e-01f ) {
+      if ( x5 >= 1.2294570922851562e+02f ) {
+        sum += -4.5008035376667976e-03f;
+      } else {
+        sum += 2.3405087995342910e-04f;
+      }
+    } else {
+      if ( x6 >= 1.3176892089843750e+02f ) {
+        sum += -1.2437152676284313e-02f;
+      } else {
+        sum += 2.2515433374792337e-03f;
+      }
+    }
+    // tree 141
+    if ( x0 >= 1.2315758466720581e+00f ) {
+      if ( x6 >= 1.5246877670288086e+01f ) {
+        sum += -1.5199541812762618e-03f;
+      } else {
+        sum += 2.1261735819280148e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0298509597778320e+00f ) {
+        sum += 2.9643764719367027e-03f;
+      } else {
+        sum += 4.4119899393990636e-04f;
+      }
+    }
+    // tree 142
+    if ( x2 >= 8.0298509597778320e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.1778381653130054e-02f;
+      } else {
+        sum += 6.3207750208675861e-03f;
+      }
+    } else {
+      if ( x0 >= 8.4608012437820435e-01f ) {
+        sum += -5.9938739286735654e-04f;
+      } else {
+        sum += 1.6783599276095629e-03f;
+      }
+    }
+    // tree 143
+    if ( x1 >= 9.6524497985839844e+01f ) {
+      if ( x0 >= 2.1896555423736572e+00f ) {
+        sum += -8.8175963610410690e-03f;
+      } else {
+        sum += -8.2992436364293098e-04f;
+      }
+    } else {
+      if ( x6 >= 4.0114837646484375e+01f ) {
+        sum += -1.2902838643640280e-03f;
+      } else {
+        sum += 1.8092894461005926e-03f;
+      }
+    }
+    // tree 144
+    if ( x4 >= 1.5415478944778442e+00f ) {
+      if ( x0 >= 2.2526559829711914e+00f ) {
+        sum += -9.6171265468001366e-03f;
+      } else {
+        sum += -1.6683683497831225e-03f;
+      }
+    } else {
+      if ( x3 >= 2.1091220378875732e+00f ) {
+        sum += -9.2359958216547966e-03f;
+      } else {
+        sum += 9.6866436069831252e-04f;
+      }
+    }
+    // tree 145
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.1568292044103146e-02f;
+      } else {
+        sum += 3.7075937725603580e-03f;
+      }
+    } else {
+      if ( x1 >= 4.8262840270996094e+01f ) {
+        sum += -6.8085326347500086e-04f;
+      } else {
+        sum += 1.5532457036897540e-03f;
+      }
+    }
+    // tree 146
+    if ( x3 >= 6.3623869419097900e-01f ) {
+      if ( x1 >= 1.6087336730957031e+02f ) {
+        sum += -4.1968626901507378e-03f;
+      } else {
+        sum += 1.6983444220386446e-04f;
+      }
+    } else {
+      if ( x4 >= 2.2595245838165283e+00f ) {
+        sum += -1.3835133053362370e-02f;
+      } else {
+        sum += 2.6144848670810461e-03f;
+      }
+    }
+    // tree 147
+    if ( x3 >= 9.0977412462234497e-01f ) {
+      if ( x5 >= 2.9090124511718750e+02f ) {
+        sum += -2.7663821354508400e-02f;
+      } else {
+        sum += -5.2529311506077647e-04f;
+      }
+    } else {
+      if ( x4 >= 1.9973341226577759e+00f ) {
+        sum += -5.6061865761876106e-03f;
+      } else {
+        sum += 1.6261138953268528e-03f;
+      }
+    }
+    // tree 148
+    if ( x0 >= 4.8545500636100769e-01f ) {
+      if ( x6 >= 8.8985252380371094e+01f ) {
+        sum += -7.6544028706848621e-03f;
+      } else {
+        sum += 9.2958674940746278e-05f;
+      }
+    } else {
+      if ( x1 >= 2.8705554199218750e+02f ) {
+        sum += -7.7582583762705326e-03f;
+      } else {
+        sum += 3.1638422515243292e-03f;
+      }
+    }
+    // tree 149
+    if ( x4 >= 7.5838953256607056e-01f ) {
+      if ( x6 >= 2.4806529998779297e+01f ) {
+        sum += -1.6142525710165501e-03f;
+      } else {
+        sum += 1.0734108509495854e-03f;
+      }
+    } else {
+      if ( x0 >= 3.8594454526901245e-01f ) {
+        sum += 1.4336029998958111e-03f;
+      } else {
+        sum += 5.3598042577505112e-03f;
+      }
+    }
+    // tree 150
+    if ( x2 >= 8.0298509597778320e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.1350207030773163e-02f;
+      } else {
+        sum += 6.0027008876204491e-03f;
+      }
+    } else {
+      if ( x0 >= 1.1196577548980713e+00f ) {
+        sum += -8.2683307118713856e-04f;
+      } else {
+        sum += 1.1301684426143765e-03f;
+      }
+    }
+    // tree 151
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.1158482171595097e-02f;
+      } else {
+        sum += 3.5070120356976986e-03f;
+      }
+    } else {
+      if ( x1 >= 4.8262840270996094e+01f ) {
+        sum += -6.4420275157317519e-04f;
+      } else {
+        sum += 1.4539600815623999e-03f;
+      }
+    }
+    // tree 152
+    if ( x4 >= 1.2530158758163452e+00f ) {
+      if ( x5 >= 5.0279880523681641e+01f ) {
+        sum += -2.6088615413755178e-03f;
+      } else {
+        sum += 1.0802272008731961e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 1.7258006846532226e-03f;
+      } else {
+        sum += -9.1834319755434990e-04f;
+      }
+    }
+    // tree 153
+    if ( x3 >= 6.3623869419097900e-01f ) {
+      if ( x5 >= 3.9350990295410156e+01f ) {
+        sum += -7.6500762952491641e-04f;
+      } else {
+        sum += 1.7673878464847803e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0348258018493652e+00f ) {
+        sum += 3.8801103364676237e-03f;
+      } else {
+        sum += 9.8839262500405312e-04f;
+      }
+    }
+    // tree 154
+    if ( x3 >= 1.8355864286422729e+00f ) {
+      if ( x3 >= 2.6533713340759277e+00f ) {
+        sum += -1.5578317455947399e-02f;
+      } else {
+        sum += -2.9131078626960516e-03f;
+      }
+    } else {
+      if ( x4 >= 2.3659250736236572e+00f ) {
+        sum += -1.1041891761124134e-02f;
+      } else {
+        sum += 6.4394070068374276e-04f;
+      }
+    }
+    // tree 155
+    if ( x1 >= 2.8152752685546875e+02f ) {
+      if ( x2 >= 4.0348258018493652e+00f ) {
+        sum += -1.1183371767401695e-02f;
+      } else {
+        sum += -4.7381306067109108e-03f;
+      }
+    } else {
+      if ( x0 >= 1.9901320934295654e+00f ) {
+        sum += -2.4685470853000879e-03f;
+      } else {
+        sum += 7.3354446794837713e-04f;
+      }
+    }
+    // tree 156
+    if ( x2 >= 8.0298509597778320e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.0925905779004097e-02f;
+      } else {
+        sum += 5.6808432564139366e-03f;
+      }
+    } else {
+      if ( x5 >= 2.3285119628906250e+02f ) {
+        sum += -9.0193059295415878e-03f;
+      } else {
+        sum += 2.2462572087533772e-04f;
+      }
+    }
+    // tree 157
+    if ( x4 >= 7.1717071533203125e-01f ) {
+      if ( x6 >= 1.8883951187133789e+01f ) {
+        sum += -1.0587908327579498e-03f;
+      } else {
+        sum += 1.6615262720733881e-03f;
+      }
+    } else {
+      if ( x6 >= 1.3176892089843750e+02f ) {
+        sum += -1.0904378257691860e-02f;
+      } else {
+        sum += 1.9353326642885804e-03f;
+      }
+    }
+    // tree 158
+    if ( x0 >= 4.8545500636100769e-01f ) {
+      if ( x3 >= 5.9415632486343384e-01f ) {
+        sum += -5.3225684678182006e-04f;
+      } else {
+        sum += 2.3373921867460012e-03f;
+      }
+    } else {
+      if ( x4 >= 6.3849496841430664e-01f ) {
+        sum += 2.1082635503262281e-03f;
+      } else {
+        sum += 5.0235567614436150e-03f;
+      }
+    }
+    // tree 159
+    if ( x1 >= 7.2393669128417969e+01f ) {
+      if ( x0 >= 9.0820652246475220e-01f ) {
+        sum += -1.5230058925226331e-03f;
+      } else {
+        sum += 9.2009629588574171e-04f;
+      }
+    } else {
+      if ( x6 >= 4.9812068939208984e+01f ) {
+        sum += -2.0657116547226906e-03f;
+      } else {
+        sum += 1.7609909409657121e-03f;
+      }
+    }
+    // tree 160
+    if ( x2 >= 6.0149254798889160e+00f ) {
+      if ( x5 >= 8.3516090393066406e+01f ) {
+        sum += -1.8281486700288951e-04f;
+      } else {
+        sum += 3.7745214067399502e-03f;
+      }
+    } else {
+      if ( x0 >= 2.2019841670989990e+00f ) {
+        sum += -4.2364499531686306e-03f;
+      } else {
+        sum += 4.7196190280374140e-05f;
+      }
+    }
+    // tree 161
+    if ( x3 >= 9.0977412462234497e-01f ) {
+      if ( x1 >= 5.6306449890136719e+01f ) {
+        sum += -1.5024148160591722e-03f;
+      } else {
+        sum += 8.6569006089121103e-04f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 1.9004900241270661e-03f;
+      } else {
+        sum += -4.4880251516588032e-04f;
+      }
+    }
+    // tree 162
+    if ( x2 >= 8.0298509597778320e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.0664172470569611e-02f;
+      } else {
+        sum += 5.4254350252449512e-03f;
+      }
+    } else {
+      if ( x6 >= 9.2276306152343750e+01f ) {
+        sum += -6.4767869189381599e-03f;
+      } else {
+        sum += 2.4281007063109428e-04f;
+      }
+    }
+    // tree 163
+    if ( x4 >= 9.8509329557418823e-01f ) {
+      if ( x6 >= 1.8883951187133789e+01f ) {
+        sum += -1.5103142941370606e-03f;
+      } else {
+        sum += 1.4730095863342285e-03f;
+      }
+    } else {
+      if ( x1 >= 9.6524497985839844e+01f ) {
+        sum += -2.9446641565300524e-04f;
+      } else {
+        sum += 1.9074765732511878e-03f;
+      }
+    }
+    // tree 164
+    if ( x3 >= 1.6462157964706421e+00f ) {
+      if ( x3 >= 2.4658887386322021e+00f ) {
+        sum += -1.0181571356952190e-02f;
+      } else {
+        sum += -1.7732203705236316e-03f;
+      }
+    } else {
+      if ( x4 >= 1.9537365436553955e+00f ) {
+        sum += -4.6456726267933846e-03f;
+      } else {
+        sum += 7.9485541209578514e-04f;
+      }
+    }
+    // tree 165
+    if ( x0 >= 5.4763174057006836e-01f ) {
+      if ( x3 >= 5.9415632486343384e-01f ) {
+        sum += -5.4236745927482843e-04f;
+      } else {
+        sum += 2.1713513415306807e-03f;
+      }
+    } else {
+      if ( x1 >= 2.7508752441406250e+02f ) {
+        sum += -6.7285536788403988e-03f;
+      } else {
+        sum += 2.4749550502747297e-03f;
+      }
+    }
+    // tree 166
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x0 >= 1.0449540615081787e+00f ) {
+        sum += 1.9815384875983000e-03f;
+      } else {
+        sum += 6.6162287257611752e-03f;
+      }
+    } else {
+      if ( x5 >= 2.8122622680664062e+02f ) {
+        sum += -1.3335312716662884e-02f;
+      } else {
+        sum += 7.3934883403126150e-05f;
+      }
+    }
+    // tree 167
+    if ( x0 >= 1.5175888538360596e+00f ) {
+      if ( x6 >= 1.4435374259948730e+01f ) {
+        sum += -1.6162601532414556e-03f;
+      } else {
+        sum += 1.9160893280059099e-03f;
+      }
+    } else {
+      if ( x2 >= 6.0149254798889160e+00f ) {
+        sum += 3.1795476097613573e-03f;
+      } else {
+        sum += 4.0309995529241860e-04f;
+      }
+    }
+    // tree 168
+    if ( x1 >= 4.8262840270996094e+01f ) {
+      if ( x3 >= 1.1412272453308105e+00f ) {
+        sum += -1.7950664041563869e-03f;
+      } else {
+        sum += 4.1602319106459618e-04f;
+      }
+    } else {
+      if ( x6 >= 6.3082351684570312e+01f ) {
+        sum += -2.5504620280116796e-03f;
+      } else {
+        sum += 1.8450808711349964e-03f;
+      }
+    }
+    // tree 169
+    if ( x4 >= 7.1717071533203125e-01f ) {
+      if ( x5 >= 1.3505667114257812e+02f ) {
+        sum += -4.3531628325581551e-03f;
+      } else {
+        sum += 1.3778453285340220e-04f;
+      }
+    } else {
+      if ( x6 >= 1.3176892089843750e+02f ) {
+        sum += -9.6588665619492531e-03f;
+      } else {
+        sum += 1.7414110479876399e-03f;
+      }
+    }
+    // tree 170
+    if ( x2 >= 8.0298509597778320e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.0348765179514885e-02f;
+      } else {
+        sum += 5.0952956080436707e-03f;
+      }
+    } else {
+      if ( x0 >= 4.2327827215194702e-01f ) {
+        sum += -2.0131503697484732e-04f;
+      } else {
+        sum += 2.6703830808401108e-03f;
+      }
+    }
+    // tree 171
+    if ( x0 >= 2.2015330791473389e+00f ) {
+      if ( x4 >= 7.2049152851104736e-01f ) {
+        sum += -4.7708461061120033e-03f;
+      } else {
+        sum += 1.2945880880579352e-03f;
+      }
+    } else {
+      if ( x1 >= 2.2522225952148438e+02f ) {
+        sum += -4.6148365363478661e-03f;
+      } else {
+        sum += 5.8029202045872808e-04f;
+      }
+    }
+    // tree 172
+    if ( x3 >= 7.4144464731216431e-01f ) {
+      if ( x5 >= 3.9350990295410156e+01f ) {
+        sum += -8.6829933570697904e-04f;
+      } else {
+        sum += 1.6485272208228707e-03f;
+      }
+    } else {
+      if ( x4 >= 2.2565274238586426e+00f ) {
+        sum += -8.8741807267069817e-03f;
+      } else {
+        sum += 1.6114824684336782e-03f;
+      }
+    }
+    // tree 173
+    if ( x2 >= 8.0298509597778320e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 1.0165172629058361e-02f;
+      } else {
+        sum += 4.9436725676059723e-03f;
+      }
+    } else {
+      if ( x6 >= 9.8858398437500000e+01f ) {
+        sum += -6.7023639567196369e-03f;
+      } else {
+        sum += 1.9509470439516008e-04f;
+      }
+    }
+    // tree 174
+    if ( x2 >= 4.0447759628295898e+00f ) {
+      if ( x1 >= 1.9304803466796875e+02f ) {
+        sum += -4.6027279458940029e-03f;
+      } else {
+        sum += 1.1298133758828044e-03f;
+      }
+    } else {
+      if ( x0 >= 4.1400074958801270e-01f ) {
+        sum += -1.2660324573516846e-03f;
+      } else {
+        sum += 2.3630396462976933e-03f;
+      }
+    }
+    // tree 175
+    if ( x3 >= 2.0039160251617432e+00f ) {
+      if ( x4 >= 2.3530130386352539e+00f ) {
+        sum += 8.0367485061287880e-03f;
+      } else {
+        sum += -5.0934571772813797e-03f;
+      }
+    } else {
+      if ( x4 >= 2.3865344524383545e+00f ) {
+        sum += -9.8697775974869728e-03f;
+      } else {
+        sum += 4.7919069766066968e-04f;
+      }
+    }
+    // tree 176
+    if ( x1 >= 4.8262840270996094e+01f ) {
+      if ( x0 >= 2.1516723632812500e+00f ) {
+        sum += -4.3964413926005363e-03f;
+      } else {
+        sum += -8.1485566624905914e-05f;
+      }
+    } else {
+      if ( x5 >= 5.9044715881347656e+01f ) {
+        sum += 3.7853344110772014e-04f;
+      } else {
+        sum += 2.4026129394769669e-03f;
+      }
+    }
+    // tree 177
+    if ( x4 >= 7.1717071533203125e-01f ) {
+      if ( x6 >= 2.1845241546630859e+01f ) {
+        sum += -1.0849358513951302e-03f;
+      } else {
+        sum += 1.1435059132054448e-03f;
+      }
+    } else {
+      if ( x3 >= 1.3567156791687012e+00f ) {
+        sum += -2.6203130255453289e-04f;
+      } else {
+        sum += 1.9868654198944569e-03f;
+      }
+    }
+    // tree 178
+    if ( x3 >= 4.8895037174224854e-01f ) {
+      if ( x0 >= 5.6299936771392822e-01f ) {
+        sum += -3.6149437073618174e-04f;
+      } else {
+        sum += 1.9285040907561779e-03f;
+      }
+    } else {
+      if ( x3 >= 3.8300955295562744e-01f ) {
+        sum += 3.2220198772847652e-03f;
+      } else {
+        sum += 1.5074249356985092e-02f;
+      }
+    }
+    // tree 179
+    if ( x2 >= 8.0298509597778320e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 9.9509144201874733e-03f;
+      } else {
+        sum += 4.7604823485016823e-03f;
+      }
+    } else {
+      if ( x1 >= 3.2978918457031250e+02f ) {
+        sum += -1.1098392307758331e-02f;
+      } else {
+        sum += 1.3163893891032785e-04f;
+      }
+    }
+    // tree 180
+    if ( x3 >= 6.7832106351852417e-01f ) {
+      if ( x6 >= 5.2783718109130859e+01f ) {
+        sum += -2.7892393991351128e-03f;
+      } else {
+        sum += 1.8871595966629684e-04f;
+      }
+    } else {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 2.2788015194237232e-03f;
+      } else {
+        sum += -2.6552946656011045e-04f;
+      }
+    }
+    // tree 181
+    if ( x0 >= 1.3932354450225830e+00f ) {
+      if ( x3 >= 8.0846983194351196e-01f ) {
+        sum += -1.6127621056511998e-03f;
+      } else {
+        sum += 8.1426685210317373e-04f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 1.4577147085219622e-03f;
+      } else {
+        sum += -4.6038645086809993e-04f;
+      }
+    }
+    // tree 182
+    if ( x1 >= 4.8262840270996094e+01f ) {
+      if ( x0 >= 1.2315076589584351e+00f ) {
+        sum += -1.3114615576341748e-03f;
+      } else {
+        sum += 5.1671831170096993e-04f;
+      }
+    } else {
+      if ( x6 >= 7.1044525146484375e+01f ) {
+        sum += -3.2701431773602962e-03f;
+      } else {
+        sum += 1.5803142450749874e-03f;
+      }
+    }
+    // tree 183
+    if ( x4 >= 9.2326498031616211e-01f ) {
+      if ( x6 >= 1.5922660827636719e+01f ) {
+        sum += -1.0437873424962163e-03f;
+      } else {
+        sum += 1.9500778289511800e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 1.6373646212741733e-03f;
+      } else {
+        sum += -4.1651300853118300e-04f;
+      }
+    }
+    // tree 184
+    if ( x2 >= 8.0298509597778320e+00f ) {
+      if ( x0 >= 1.7342350482940674e+00f ) {
+        sum += 1.9069788977503777e-03f;
+      } else {
+        sum += 7.4474979192018509e-03f;
+      }
+    } else {
+      if ( x5 >= 2.8122622680664062e+02f ) {
+        sum += -1.1507147923111916e-02f;
+      } else {
+        sum += 1.3096978364046663e-04f;
+      }
+    }
+    // tree 185
+    if ( x0 >= 4.2327827215194702e-01f ) {
+      if ( x3 >= 5.9415632486343384e-01f ) {
+        sum += -3.8051072624512017e-04f;
+      } else {
+        sum += 1.8046674085780978e-03f;
+      }
+    } else {
+      if ( x4 >= 6.3403153419494629e-01f ) {
+        sum += 1.8168896203860641e-03f;
+      } else {
+        sum += 4.8613580875098705e-03f;
+      }
+    }
+    // tree 186
+    if ( x1 >= 1.2869892883300781e+02f ) {
+      if ( x4 >= 6.4183843135833740e-01f ) {
+        sum += -2.0959270186722279e-03f;
+      } else {
+        sum += 1.5062756137922406e-03f;
+      }
+    } else {
+      if ( x6 >= 3.7376430511474609e+01f ) {
+        sum += -1.0695022065192461e-03f;
+      } else {
+        sum += 1.1868578149005771e-03f;
+      }
+    }
+    // tree 187
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x3 >= 1.5808639526367188e+00f ) {
+        sum += -6.2960055656731129e-03f;
+      } else {
+        sum += 3.7347285542637110e-03f;
+      }
+    } else {
+      if ( x4 >= 5.1107639074325562e-01f ) {
+        sum += -2.2580899531021714e-04f;
+      } else {
+        sum += 2.4966625496745110e-03f;
+      }
+    }
+    // tree 188
+    if ( x0 >= 2.2015330791473389e+00f ) {
+      if ( x6 >= 1.4374342918395996e+01f ) {
+        sum += -4.1913026943802834e-03f;
+      } else {
+        sum += 1.5947805950418115e-03f;
+      }
+    } else {
+      if ( x3 >= 4.8895037174224854e-01f ) {
+        sum += 1.4982558786869049e-04f;
+      } else {
+        sum += 3.5252056550234556e-03f;
+      }
+    }
+    // tree 189
+    if ( x4 >= 1.5415478944778442e+00f ) {
+      if ( x0 >= 2.4010512828826904e+00f ) {
+        sum += -1.7448872327804565e-02f;
+      } else {
+        sum += -1.3307256158441305e-03f;
+      }
+    } else {
+      if ( x3 >= 2.1932866573333740e+00f ) {
+        sum += -8.7985927239060402e-03f;
+      } else {
+        sum += 6.4186681993305683e-04f;
+      }
+    }
+    // tree 190
+    if ( x1 >= 4.8262840270996094e+01f ) {
+      if ( x3 >= 1.1412272453308105e+00f ) {
+        sum += -1.4951847260817885e-03f;
+      } else {
+        sum += 3.3498468110337853e-04f;
+      }
+    } else {
+      if ( x5 >= 7.3685821533203125e+01f ) {
+        sum += -1.8260985598317347e-05f;
+      } else {
+        sum += 1.9397629657760262e-03f;
+      }
+    }
+    // tree 191
+    if ( x2 >= 8.0298509597778320e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 9.5417052507400513e-03f;
+      } else {
+        sum += 4.2953453958034515e-03f;
+      }
+    } else {
+      if ( x1 >= 2.8152752685546875e+02f ) {
+        sum += -6.7949821241199970e-03f;
+      } else {
+        sum += 1.4702904445584863e-04f;
+      }
+    }
+    // tree 192
+    if ( x0 >= 4.2327827215194702e-01f ) {
+      if ( x5 >= 6.8376022338867188e+01f ) {
+        sum += -8.8084884919226170e-04f;
+      } else {
+        sum += 5.9197528753429651e-04f;
+      }
+    } else {
+      if ( x4 >= 2.3712725639343262e+00f ) {
+        sum += 1.9094854593276978e-02f;
+      } else {
+        sum += 2.2301229182630777e-03f;
+      }
+    }
+    // tree 193
+    if ( x4 >= 1.0881404876708984e+00f ) {
+      if ( x6 >= 1.8883951187133789e+01f ) {
+        sum += -1.4419553335756063e-03f;
+      } else {
+        sum += 1.3451074482873082e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 1.4175286050885916e-03f;
+      } else {
+        sum += -7.4899912578985095e-04f;
+      }
+    }
+    // tree 194
+    if ( x6 >= 9.8858398437500000e+01f ) {
+      if ( x4 >= 6.0111731290817261e-01f ) {
+        sum += -8.5134105756878853e-03f;
+      } else {
+        sum += 3.2443751115351915e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0447759628295898e+00f ) {
+        sum += 8.0391525989398360e-04f;
+      } else {
+        sum += -7.2433706372976303e-04f;
+      }
+    }
+    // tree 195
+    if ( x0 >= 1.7165545225143433e+00f ) {
+      if ( x4 >= 2.0632097721099854e+00f ) {
+        sum += -5.9324493631720543e-03f;
+      } else {
+        sum += -7.6669704867526889e-04f;
+      }
+    } else {
+      if ( x4 >= 5.0623214244842529e-01f ) {
+        sum += 3.0822737608104944e-04f;
+      } else {
+        sum += 3.2585570588707924e-03f;
+      }
+    }
+    // tree 196
+    if ( x2 >= 8.0298509597778320e+00f ) {
+      if ( x2 >= 9.0199003219604492e+00f ) {
+        sum += 9.3416199088096619e-03f;
+      } else {
+        sum += 4.1307080537080765e-03f;
+      }
+    } else {
+      if ( x5 >= 2.3285119628906250e+02f ) {
+        sum += -6.5944157540798187e-03f;
+      } else {
+        sum += 1.5074314433149993e-04f;
+      }
+    }
+    // tree 197
+    if ( x1 >= 7.2393669128417969e+01f ) {
+      if ( x0 >= 9.0820652246475220e-01f ) {
+        sum += -1.1403798125684261e-03f;
+      } else {
+        sum += 7.1204750565811992e-04f;
+      }
+    } else {
+      if ( x6 >= 4.9812068939208984e+01f ) {
+        sum += -1.7252526013180614e-03f;
+      } else {
+        sum += 1.3199292588979006e-03f;
+      }
+    }
+    // tree 198
+    if ( x3 >= 4.8895037174224854e-01f ) {
+      if ( x4 >= 6.3702863454818726e-01f ) {
+        sum += -3.5353412386029959e-04f;
+      } else {
+        sum += 1.5083012403920293e-03f;
+      }
+    } else {
+      if ( x3 >= 3.8300955295562744e-01f ) {
+        sum += 2.7515424881130457e-03f;
+      } else {
+        sum += 1.4463555999100208e-02f;
+      }
+    }
+    // tree 199
+    if ( x2 >= 7.0447759628295898e+00f ) {
+      if ( x0 >= 1.0449540615081787e+00f ) {
+        sum += 1.2663283850997686e-03f;
+      } else {
+        sum += 5.7236882857978344e-03f;
+      }
+    } else {
+      if ( x5 >= 3.3927630615234375e+02f ) {
+        sum += -1.5932040289044380e-02f;
+      } else {
+        sum += 2.2739846826880239e-05f;
+      }
+    }
+    // CV: same transformation of the sum of responses as in TMVA::MethodBDT::GetGradBoostMVA
+    return 2./(1. + std::exp(-2.*sum)) - 1.;
+  }
+
+//--- BDT read from file = tthAnalysis/HiggsToTauTau/data/2lss_ttbar_BDTG.weights.xml
+  const char* inputVariables_2lss_ttbar_BDTG[] = {
+    "max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))",
+    "nJet25_Recl",
+    "mindr_lep1_jet",
+    "mindr_lep2_jet",
+    "min(met_pt,400)",
+    "avg_dr_jet",
+    "MT_met_lep1"
+  };
+
+  double compiledBDT_2lss_ttbar_BDTG(const Float_t* mvaInputs, const int* mvaInputIndices)
+  {
+    const Float_t x0 = mvaInputs[mvaInputIndices[0]];
+    const Float_t x1 = mvaInputs[mvaInputIndices[1]];
+    const Float_t x2 = mvaInputs[mvaInputIndices[2]];
+    const Float_t x3 = mvaInputs[mvaInputIndices[3]];
+    const Float_t x4 = mvaInputs[mvaInputIndices[4]];
+    const Float_t x5 = mvaInputs[mvaInputIndices[5]];
+    const Float_t x6 = mvaInputs[mvaInputIndices[6]];
+    if ( TMath::IsNaN(x0) || TMath::IsNaN(x1) || TMath::IsNaN(x2) || TMath::IsNaN(x3) || TMath::IsNaN(x4) || TMath::IsNaN(x5) || TMath::IsNaN(x6) ) return -999.;
+    double sum = 0.;
+    // tree 0
+    if ( x0 >= 1.5194113254547119e+00f ) {
+      if ( x1 >= 5.0447759628295898e+00f ) {
+        sum += 2.4941593874245882e-03f;
+      } else {
+        sum += -2.7876248583197594e-02f;
+      }
+    } else {
+      if ( x1 >= 4.0547266006469727e+00f ) {
+        sum += 2.5192122906446457e-02f;
+      } else {
+        sum += -3.9757038466632366e-03f;
+      }
+    }
+    // tree 1
+    if ( x0 >= 1.5194113254547119e+00f ) {
+      if ( x1 >= 4.0497512817382812e+00f ) {
+        sum += -6.6232853569090366e-03f;
+      } else {
+        sum += -3.2623749226331711e-02f;
+      }
+    } else {
+      if ( x1 >= 4.0547266006469727e+00f ) {
+        sum += 2.3366032168269157e-02f;
+      } else {
+        sum += -3.6743704695254564e-03f;
+      }
+    }
+    // tree 2
+    if ( x0 >= 1.3704712390899658e+00f ) {
+      if ( x6 >= 1.0666347503662109e+02f ) {
+        sum += 1.0288187302649021e-02f;
+      } else {
+        sum += -2.1224224939942360e-02f;
+      }
+    } else {
+      if ( x6 >= 1.1144809722900391e+02f ) {
+        sum += 3.6155018955469131e-02f;
+      } else {
+        sum += 6.5292501822113991e-03f;
+      }
+    }
+    // tree 3
+    if ( x0 >= 1.5938813686370850e+00f ) {
+      if ( x4 >= 8.7723091125488281e+01f ) {
+        sum += -1.3468164252117276e-04f;
+      } else {
+        sum += -2.5723863393068314e-02f;
+      }
+    } else {
+      if ( x1 >= 5.0398011207580566e+00f ) {
+        sum += 2.9459225013852119e-02f;
+      } else {
+        sum += 1.6382305184379220e-03f;
+      }
+    }
+    // tree 4
+    if ( x6 >= 1.1227733612060547e+02f ) {
+      if ( x0 >= 1.6683540344238281e+00f ) {
+        sum += 6.6528241150081158e-03f;
+      } else {
+        sum += 3.1001003459095955e-02f;
+      }
+    } else {
+      if ( x1 >= 5.0447759628295898e+00f ) {
+        sum += 1.5015610493719578e-02f;
+      } else {
+        sum += -1.4786296524107456e-02f;
+      }
+    }
+    // tree 5
+    if ( x4 >= 8.9712112426757812e+01f ) {
+      if ( x0 >= 1.4857897758483887e+00f ) {
+        sum += 1.9439974566921592e-03f;
+      } else {
+        sum += 2.5443509221076965e-02f;
+      }
+    } else {
+      if ( x1 >= 4.0547266006469727e+00f ) {
+        sum += 2.2164261899888515e-03f;
+      } else {
+        sum += -2.3085672408342361e-02f;
+      }
+    }
+    // tree 6
+    if ( x0 >= 1.3580596446990967e+00f ) {
+      if ( x4 >= 1.1159138488769531e+02f ) {
+        sum += 9.1445017606019974e-03f;
+      } else {
+        sum += -1.7838774248957634e-02f;
+      }
+    } else {
+      if ( x4 >= 1.0165093231201172e+02f ) {
+        sum += 2.7235805988311768e-02f;
+      } else {
+        sum += 4.2834277264773846e-03f;
+      }
+    }
+    // tree 7
+    if ( x6 >= 1.0666347503662109e+02f ) {
+      if ( x0 >= 1.6683540344238281e+00f ) {
+        sum += 5.3522279486060143e-03f;
+      } else {
+        sum += 2.6445334777235985e-02f;
+      }
+    } else {
+      if ( x1 >= 4.0497512817382812e+00f ) {
+        sum += 4.5436532236635685e-03f;
+      } else {
+        sum += -2.0152986049652100e-02f;
+      }
+    }
+    // tree 8
+    if ( x0 >= 1.7304097414016724e+00f ) {
+      if ( x6 >= 1.0648146820068359e+02f ) {
+        sum += 4.0541552007198334e-03f;
+      } else {
+        sum += -2.1525664255023003e-02f;
+      }
+    } else {
+      if ( x1 >= 5.0398011207580566e+00f ) {
+        sum += 2.3298731073737144e-02f;
+      } else {
+        sum += 4.8972055083140731e-04f;
+      }
+    }
+    // tree 9
+    if ( x4 >= 7.5788940429687500e+01f ) {
+      if ( x0 >= 1.6684447526931763e+00f ) {
+        sum += -2.6555720251053572e-03f;
+      } else {
+        sum += 1.8050804734230042e-02f;
+      }
+    } else {
+      if ( x1 >= 5.0398011207580566e+00f ) {
+        sum += 8.9416187256574631e-03f;
+      } else {
+        sum += -1.6038455069065094e-02f;
+      }
+    }
+    // tree 10
+    if ( x6 >= 1.1227733612060547e+02f ) {
+      if ( x0 >= 1.1844018697738647e+00f ) {
+        sum += 1.1612427420914173e-02f;
+      } else {
+        sum += 2.8759406879544258e-02f;
+      }
+    } else {
+      if ( x1 >= 4.0497512817382812e+00f ) {
+        sum += 4.3436912819743156e-03f;
+      } else {
+        sum += -1.7229231074452400e-02f;
+      }
+    }
+    // tree 11
+    if ( x4 >= 1.1358041381835938e+02f ) {
+      if ( x0 >= 1.9062827825546265e+00f ) {
+        sum += -7.9912104411050677e-04f;
+      } else {
+        sum += 2.2001417353749275e-02f;
+      }
+    } else {
+      if ( x0 >= 1.2339428663253784e+00f ) {
+        sum += -1.3723157346248627e-02f;
+      } else {
+        sum += 6.1463015154004097e-03f;
+      }
+    }
+    // tree 12
+    if ( x6 >= 1.0666347503662109e+02f ) {
+      if ( x0 >= 1.1719927787780762e+00f ) {
+        sum += 9.6872299909591675e-03f;
+      } else {
+        sum += 2.5644643232226372e-02f;
+      }
+    } else {
+      if ( x1 >= 5.0447759628295898e+00f ) {
+        sum += 1.0912770405411720e-02f;
+      } else {
+        sum += -1.1069317348301411e-02f;
+      }
+    }
+    // tree 13
+    if ( x5 >= 2.3690595626831055e+00f ) {
+      if ( x4 >= 9.7668212890625000e+01f ) {
+        sum += 2.2734813392162323e-03f;
+      } else {
+        sum += -2.0801572129130363e-02f;
+      }
+    } else {
+      if ( x3 >= 1.5051621198654175e+00f ) {
+        sum += -1.2339380569756031e-02f;
+      } else {
+        sum += 1.1543357744812965e-02f;
+      }
+    }
+    // tree 14
+    if ( x0 >= 1.2463545799255371e+00f ) {
+      if ( x4 >= 7.1810890197753906e+01f ) {
+        sum += 1.5043478924781084e-03f;
+      } else {
+        sum += -1.6302691772580147e-02f;
+      }
+    } else {
+      if ( x5 >= 2.4753756523132324e+00f ) {
+        sum += -8.5029713809490204e-03f;
+      } else {
+        sum += 1.3939343392848969e-02f;
+      }
+    }
+    // tree 15
+    if ( x1 >= 4.0547266006469727e+00f ) {
+      if ( x5 >= 2.2670164108276367e+00f ) {
+        sum += -3.5437978804111481e-03f;
+      } else {
+        sum += 1.4781409874558449e-02f;
+      }
+    } else {
+      if ( x6 >= 1.1227733612060547e+02f ) {
+        sum += 9.5133325085043907e-03f;
+      } else {
+        sum += -1.4785213395953178e-02f;
+      }
+    }
+    // tree 16
+    if ( x2 >= 1.0571997165679932e+00f ) {
+      if ( x4 >= 1.1955187988281250e+02f ) {
+        sum += 9.1355154290795326e-03f;
+      } else {
+        sum += -1.2368870899081230e-02f;
+      }
+    } else {
+      if ( x3 >= 1.3770304918289185e+00f ) {
+        sum += -5.4233041591942310e-03f;
+      } else {
+        sum += 1.3561978936195374e-02f;
+      }
+    }
+    // tree 17
+    if ( x0 >= 1.7428214550018311e+00f ) {
+      if ( x3 >= 1.7400701045989990e+00f ) {
+        sum += -2.9270470142364502e-02f;
+      } else {
+        sum += -7.7758370898663998e-03f;
+      }
+    } else {
+      if ( x4 >= 1.0761333465576172e+02f ) {
+        sum += 1.8644642084836960e-02f;
+      } else {
+        sum += 9.5894624246284366e-04f;
+      }
+    }
+    // tree 18
+    if ( x6 >= 1.0666347503662109e+02f ) {
+      if ( x0 >= 2.1274881362915039e+00f ) {
+        sum += -7.1194292977452278e-03f;
+      } else {
+        sum += 1.6965830698609352e-02f;
+      }
+    } else {
+      if ( x1 >= 5.0447759628295898e+00f ) {
+        sum += 9.2606972903013229e-03f;
+      } else {
+        sum += -9.3816891312599182e-03f;
+      }
+    }
+    // tree 19
+    if ( x5 >= 2.2735559940338135e+00f ) {
+      if ( x4 >= 8.3745040893554688e+01f ) {
+        sum += 1.4980386476963758e-03f;
+      } else {
+        sum += -1.6349688172340393e-02f;
+      }
+    } else {
+      if ( x3 >= 1.5478726625442505e+00f ) {
+        sum += -9.9874734878540039e-03f;
+      } else {
+        sum += 1.1094083078205585e-02f;
+      }
+    }
+    // tree 20
+    if ( x0 >= 1.1222378015518188e+00f ) {
+      if ( x5 >= 2.2735559940338135e+00f ) {
+        sum += -1.5144376084208488e-02f;
+      } else {
+        sum += 2.5637832004576921e-04f;
+      }
+    } else {
+      if ( x1 >= 4.0547266006469727e+00f ) {
+        sum += 1.5707368031144142e-02f;
+      } else {
+        sum += 1.3899815967306495e-03f;
+      }
+    }
+    // tree 21
+    if ( x2 >= 1.0571997165679932e+00f ) {
+      if ( x4 >= 6.7838035583496094e+01f ) {
+        sum += 1.4695052232127637e-04f;
+      } else {
+        sum += -1.5082438476383686e-02f;
+      }
+    } else {
+      if ( x4 >= 1.0363528442382812e+02f ) {
+        sum += 1.8774896860122681e-02f;
+      } else {
+        sum += 3.2357147429138422e-03f;
+      }
+    }
+    // tree 22
+    if ( x3 >= 1.3770304918289185e+00f ) {
+      if ( x4 >= 1.3351263427734375e+02f ) {
+        sum += 9.9041834473609924e-03f;
+      } else {
+        sum += -1.4717155136168003e-02f;
+      }
+    } else {
+      if ( x5 >= 2.4273097515106201e+00f ) {
+        sum += -9.4121294096112251e-03f;
+      } else {
+        sum += 9.2007787898182869e-03f;
+      }
+    }
+    // tree 23
+    if ( x1 >= 5.0398011207580566e+00f ) {
+      if ( x0 >= 2.0165133476257324e+00f ) {
+        sum += -6.6491579636931419e-03f;
+      } else {
+        sum += 1.4643095433712006e-02f;
+      }
+    } else {
+      if ( x6 >= 1.2350506591796875e+02f ) {
+        sum += 1.3306199572980404e-02f;
+      } else {
+        sum += -7.5565287843346596e-03f;
+      }
+    }
+    // tree 24
+    if ( x0 >= 1.7428214550018311e+00f ) {
+      if ( x3 >= 1.8254911899566650e+00f ) {
+        sum += -2.6368012651801109e-02f;
+      } else {
+        sum += -6.8810069933533669e-03f;
+      }
+    } else {
+      if ( x5 >= 2.4327287673950195e+00f ) {
+        sum += -8.3684967830777168e-03f;
+      } else {
+        sum += 8.4947478026151657e-03f;
+      }
+    }
+    // tree 25
+    if ( x6 >= 1.0666347503662109e+02f ) {
+      if ( x2 >= 8.8599282503128052e-01f ) {
+        sum += 6.9905617274343967e-03f;
+      } else {
+        sum += 1.9545057788491249e-02f;
+      }
+    } else {
+      if ( x1 >= 6.0398011207580566e+00f ) {
+        sum += 1.4850260689854622e-02f;
+      } else {
+        sum += -6.0149785131216049e-03f;
+      }
+    }
+    // tree 26
+    if ( x1 >= 4.0547266006469727e+00f ) {
+      if ( x5 >= 2.1827974319458008e+00f ) {
+        sum += -1.0334342950955033e-03f;
+      } else {
+        sum += 1.3071152381598949e-02f;
+      }
+    } else {
+      if ( x4 >= 1.3947877502441406e+02f ) {
+        sum += 1.2455330230295658e-02f;
+      } else {
+        sum += -1.0263058356940746e-02f;
+      }
+    }
+    // tree 27
+    if ( x0 >= 1.1222378015518188e+00f ) {
+      if ( x5 >= 2.1303005218505859e+00f ) {
+        sum += -1.0670488700270653e-02f;
+      } else {
+        sum += 2.6844302192330360e-03f;
+      }
+    } else {
+      if ( x5 >= 2.5359599590301514e+00f ) {
+        sum += -6.7763612605631351e-03f;
+      } else {
+        sum += 1.1038925498723984e-02f;
+      }
+    }
+    // tree 28
+    if ( x2 >= 1.0770140886306763e+00f ) {
+      if ( x4 >= 1.4540879821777344e+02f ) {
+        sum += 1.1528925970196724e-02f;
+      } else {
+        sum += -8.8014369830489159e-03f;
+      }
+    } else {
+      if ( x3 >= 1.7614253759384155e+00f ) {
+        sum += -1.2114346027374268e-02f;
+      } else {
+        sum += 8.7018832564353943e-03f;
+      }
+    }
+    // tree 29
+    if ( x4 >= 6.9821861267089844e+01f ) {
+      if ( x0 >= 2.0407359600067139e+00f ) {
+        sum += -8.3461506292223930e-03f;
+      } else {
+        sum += 9.0754376724362373e-03f;
+      }
+    } else {
+      if ( x3 >= 1.3340734243392944e+00f ) {
+        sum += -1.6361398622393608e-02f;
+      } else {
+        sum += -1.3340946752578020e-03f;
+      }
+    }
+    // tree 30
+    if ( x6 >= 1.0104961395263672e+02f ) {
+      if ( x0 >= 2.1276073455810547e+00f ) {
+        sum += -6.9432584568858147e-03f;
+      } else {
+        sum += 1.2436319142580032e-02f;
+      }
+    } else {
+      if ( x1 >= 6.0398011207580566e+00f ) {
+        sum += 1.3379319570958614e-02f;
+      } else {
+        sum += -5.7332580909132957e-03f;
+      }
+    }
+    // tree 31
+    if ( x0 >= 9.4847440719604492e-01f ) {
+      if ( x1 >= 4.0497512817382812e+00f ) {
+        sum += 1.8073982791975141e-03f;
+      } else {
+        sum += -1.0940287262201309e-02f;
+      }
+    } else {
+      if ( x5 >= 2.2330377101898193e+00f ) {
+        sum += 3.0142876785248518e-03f;
+      } else {
+        sum += 1.4144716784358025e-02f;
+      }
+    }
+    // tree 32
+    if ( x2 >= 9.1849893331527710e-01f ) {
+      if ( x4 >= 7.3805015563964844e+01f ) {
+        sum += 2.0184251479804516e-03f;
+      } else {
+        sum += -1.0054578073322773e-02f;
+      }
+    } else {
+      if ( x5 >= 2.2742571830749512e+00f ) {
+        sum += -6.9574962253682315e-05f;
+      } else {
+        sum += 1.1995134875178337e-02f;
+      }
+    }
+    // tree 33
+    if ( x5 >= 2.4486460685729980e+00f ) {
+      if ( x4 >= 1.4540481567382812e+02f ) {
+        sum += 9.1570075601339340e-03f;
+      } else {
+        sum += -1.3347629457712173e-02f;
+      }
+    } else {
+      if ( x3 >= 1.5265173912048340e+00f ) {
+        sum += -8.2995677366852760e-03f;
+      } else {
+        sum += 6.4753317274153233e-03f;
+      }
+    }
+    // tree 34
+    if ( x6 >= 1.2350506591796875e+02f ) {
+      if ( x2 >= 2.1056036949157715e+00f ) {
+        sum += -2.0764125511050224e-02f;
+      } else {
+        sum += 1.4371138997375965e-02f;
+      }
+    } else {
+      if ( x5 >= 2.1417212486267090e+00f ) {
+        sum += -7.5422138907015324e-03f;
+      } else {
+        sum += 4.2500994168221951e-03f;
+      }
+    }
+    // tree 35
+    if ( x0 >= 1.8545265197753906e+00f ) {
+      if ( x3 >= 2.2098860740661621e+00f ) {
+        sum += -3.1336057931184769e-02f;
+      } else {
+        sum += -7.6732248999178410e-03f;
+      }
+    } else {
+      if ( x1 >= 4.0547266006469727e+00f ) {
+        sum += 8.1952260807156563e-03f;
+      } else {
+        sum += -3.2699357252568007e-03f;
+      }
+    }
+    // tree 36
+    if ( x4 >= 1.1358041381835938e+02f ) {
+      if ( x2 >= 1.0375818014144897e+00f ) {
+        sum += 4.5584938488900661e-03f;
+      } else {
+        sum += 1.5471978113055229e-02f;
+      }
+    } else {
+      if ( x1 >= 6.0248756408691406e+00f ) {
+        sum += 1.2371133081614971e-02f;
+      } else {
+        sum += -4.7279847785830498e-03f;
+      }
+    }
+    // tree 37
+    if ( x0 >= 9.4847440719604492e-01f ) {
+      if ( x5 >= 2.1143832206726074e+00f ) {
+        sum += -7.7916663140058517e-03f;
+      } else {
+        sum += 3.3845142461359501e-03f;
+      }
+    } else {
+      if ( x6 >= 1.2736910247802734e+02f ) {
+        sum += 2.0583210512995720e-02f;
+      } else {
+        sum += 6.2875724397599697e-03f;
+      }
+    }
+    // tree 38
+    if ( x2 >= 1.1562715768814087e+00f ) {
+      if ( x4 >= 1.4540879821777344e+02f ) {
+        sum += 9.2950761318206787e-03f;
+      } else {
+        sum += -7.8702047467231750e-03f;
+      }
+    } else {
+      if ( x1 >= 5.0398011207580566e+00f ) {
+        sum += 1.1723979376256466e-02f;
+      } else {
+        sum += 9.5023331232368946e-04f;
+      }
+    }
+    // tree 39
+    if ( x0 >= 1.9910548925399780e+00f ) {
+      if ( x3 >= 2.2098860740661621e+00f ) {
+        sum += -3.1854644417762756e-02f;
+      } else {
+        sum += -8.7892618030309677e-03f;
+      }
+    } else {
+      if ( x1 >= 4.0547266006469727e+00f ) {
+        sum += 6.8647698499262333e-03f;
+      } else {
+        sum += -3.3487498294562101e-03f;
+      }
+    }
+    // tree 40
+    if ( x6 >= 1.0104961395263672e+02f ) {
+      if ( x5 >= 2.4880242347717285e+00f ) {
+        sum += -1.3144592521712184e-03f;
+      } else {
+        sum += 1.1240444146096706e-02f;
+      }
+    } else {
+      if ( x5 >= 2.1417212486267090e+00f ) {
+        sum += -7.7525922097265720e-03f;
+      } else {
+        sum += 3.0839806422591209e-03f;
+      }
+    }
+    // tree 41
+    if ( x3 >= 1.3770304918289185e+00f ) {
+      if ( x6 >= 1.0800907135009766e+02f ) {
+        sum += 4.6950234100222588e-03f;
+      } else {
+        sum += -1.0560018941760063e-02f;
+      }
+    } else {
+      if ( x5 >= 2.4879961013793945e+00f ) {
+        sum += -7.5829280540347099e-03f;
+      } else {
+        sum += 5.7962452992796898e-03f;
+      }
+    }
+    // tree 42
+    if ( x4 >= 6.7832839965820312e+01f ) {
+      if ( x2 >= 1.2346212863922119e+00f ) {
+        sum += -1.4228415675461292e-03f;
+      } else {
+        sum += 8.4885265678167343e-03f;
+      }
+    } else {
+      if ( x5 >= 2.1303005218505859e+00f ) {
+        sum += -9.3145323917269707e-03f;
+      } else {
+        sum += 1.4654562110081315e-03f;
+      }
+    }
+    // tree 43
+    if ( x0 >= 9.8570942878723145e-01f ) {
+      if ( x1 >= 6.0398011207580566e+00f ) {
+        sum += 1.0497516021132469e-02f;
+      } else {
+        sum += -4.8609981313347816e-03f;
+      }
+    } else {
+      if ( x5 >= 2.5359599590301514e+00f ) {
+        sum += -3.7050684913992882e-03f;
+      } else {
+        sum += 8.9578237384557724e-03f;
+      }
+    }
+    // tree 44
+    if ( x4 >= 1.3943772888183594e+02f ) {
+      if ( x0 >= 2.0671048164367676e+00f ) {
+        sum += -2.8483159840106964e-03f;
+      } else {
+        sum += 1.3668962754309177e-02f;
+      }
+    } else {
+      if ( x3 >= 1.9109122753143311e+00f ) {
+        sum += -1.7744174227118492e-02f;
+      } else {
+        sum += -5.9519123169593513e-05f;
+      }
+    }
+    // tree 45
+    if ( x2 >= 8.1942695379257202e-01f ) {
+      if ( x4 >= 6.7832839965820312e+01f ) {
+        sum += 1.6176465433090925e-03f;
+      } else {
+        sum += -7.6620671898126602e-03f;
+      }
+    } else {
+      if ( x1 >= 4.0547266006469727e+00f ) {
+        sum += 1.0206619277596474e-02f;
+      } else {
+        sum += 9.6222391584888101e-04f;
+      }
+    }
+    // tree 46
+    if ( x0 >= 2.0034666061401367e+00f ) {
+      if ( x3 >= 2.2098860740661621e+00f ) {
+        sum += -2.8445811942219734e-02f;
+      } else {
+        sum += -7.8724930062890053e-03f;
+      }
+    } else {
+      if ( x5 >= 2.2098867893218994e+00f ) {
+        sum += -2.5896725710481405e-03f;
+      } else {
+        sum += 6.2483074143528938e-03f;
+      }
+    }
+    // tree 47
+    if ( x6 >= 1.2911892700195312e+02f ) {
+      if ( x2 >= 2.1056036949157715e+00f ) {
+        sum += -1.9024012610316277e-02f;
+      } else {
+        sum += 1.2272280640900135e-02f;
+      }
+    } else {
+      if ( x1 >= 6.0398011207580566e+00f ) {
+        sum += 1.0693549178540707e-02f;
+      } else {
+        sum += -3.3178851008415222e-03f;
+      }
+    }
+    // tree 48
+    if ( x0 >= 9.2365103960037231e-01f ) {
+      if ( x2 >= 8.3924132585525513e-01f ) {
+        sum += -5.4070940241217613e-03f;
+      } else {
+        sum += 4.0431409142911434e-03f;
+      }
+    } else {
+      if ( x5 >= 2.5359599590301514e+00f ) {
+        sum += -2.9495484195649624e-03f;
+      } else {
+        sum += 8.5322111845016479e-03f;
+      }
+    }
+    // tree 49
+    if ( x6 >= 1.0104961395263672e+02f ) {
+      if ( x2 >= 1.7571434974670410e+00f ) {
+        sum += -6.9642816670238972e-03f;
+      } else {
+        sum += 8.5968775674700737e-03f;
+      }
+    } else {
+      if ( x5 >= 2.0942780971527100e+00f ) {
+        sum += -5.8998172171413898e-03f;
+      } else {
+        sum += 3.2878564670681953e-03f;
+      }
+    }
+    // tree 50
+    if ( x1 >= 5.0398011207580566e+00f ) {
+      if ( x1 >= 7.0298509597778320e+00f ) {
+        sum += 1.6804307699203491e-02f;
+      } else {
+        sum += 4.7781178727746010e-03f;
+      }
+    } else {
+      if ( x4 >= 1.5137188720703125e+02f ) {
+        sum += 1.0474282316863537e-02f;
+      } else {
+        sum += -3.9074616506695747e-03f;
+      }
+    }
+    // tree 51
+    if ( x3 >= 1.3129646778106689e+00f ) {
+      if ( x4 >= 1.3351263427734375e+02f ) {
+        sum += 5.7809748686850071e-03f;
+      } else {
+        sum += -7.8068282455205917e-03f;
+      }
+    } else {
+      if ( x5 >= 2.3817949295043945e+00f ) {
+        sum += -4.1069444268941879e-03f;
+      } else {
+        sum += 5.6642442941665649e-03f;
+      }
+    }
+    // tree 52
+    if ( x0 >= 1.3704712390899658e+00f ) {
+      if ( x5 >= 2.1143832206726074e+00f ) {
+        sum += -7.8010219149291515e-03f;
+      } else {
+        sum += 1.4475743519142270e-03f;
+      }
+    } else {
+      if ( x6 >= 1.3267610168457031e+02f ) {
+        sum += 1.4268768951296806e-02f;
+      } else {
+        sum += 2.4964378681033850e-03f;
+      }
+    }
+    // tree 53
+    if ( x1 >= 4.0547266006469727e+00f ) {
+      if ( x5 >= 2.3793082237243652e+00f ) {
+        sum += -3.3982996828854084e-03f;
+      } else {
+        sum += 6.0584372840821743e-03f;
+      }
+    } else {
+      if ( x4 >= 1.1959165191650391e+02f ) {
+        sum += 4.8360470682382584e-03f;
+      } else {
+        sum += -6.5408940427005291e-03f;
+      }
+    }
+    // tree 54
+    if ( x0 >= 2.0407016277313232e+00f ) {
+      if ( x0 >= 2.4016931056976318e+00f ) {
+        sum += -2.6200527325272560e-02f;
+      } else {
+        sum += -7.4223978444933891e-03f;
+      }
+    } else {
+      if ( x2 >= 8.0559301376342773e-01f ) {
+        sum += -6.5486942185088992e-04f;
+      } else {
+        sum += 7.5318808667361736e-03f;
+      }
+    }
+    // tree 55
+    if ( x6 >= 1.0104961395263672e+02f ) {
+      if ( x4 >= 5.8940990447998047e+01f ) {
+        sum += 8.4898965433239937e-03f;
+      } else {
+        sum += -1.6823776531964540e-03f;
+      }
+    } else {
+      if ( x6 >= 4.3737400054931641e+01f ) {
+        sum += -5.3151641041040421e-03f;
+      } else {
+        sum += 3.5528137814253569e-03f;
+      }
+    }
+    // tree 56
+    if ( x3 >= 1.5478726625442505e+00f ) {
+      if ( x3 >= 2.5515708923339844e+00f ) {
+        sum += -2.5646012276411057e-02f;
+      } else {
+        sum += -5.6116897612810135e-03f;
+      }
+    } else {
+      if ( x5 >= 2.4818789958953857e+00f ) {
+        sum += -6.0529909096658230e-03f;
+      } else {
+        sum += 3.9576655253767967e-03f;
+      }
+    }
+    // tree 57
+    if ( x1 >= 6.0248756408691406e+00f ) {
+      if ( x0 >= 1.9425880908966064e+00f ) {
+        sum += 3.9941142313182354e-04f;
+      } else {
+        sum += 1.2209999375045300e-02f;
+      }
+    } else {
+      if ( x5 >= 2.0507140159606934e+00f ) {
+        sum += -3.9963237941265106e-03f;
+      } else {
+        sum += 4.0703411214053631e-03f;
+      }
+    }
+    // tree 58
+    if ( x2 >= 1.2949724197387695e+00f ) {
+      if ( x5 >= 1.9024169445037842e+00f ) {
+        sum += -7.3404409922659397e-03f;
+      } else {
+        sum += 3.1125831883400679e-03f;
+      }
+    } else {
+      if ( x3 >= 1.7614253759384155e+00f ) {
+        sum += -8.1054801121354103e-03f;
+      } else {
+        sum += 4.0087895467877388e-03f;
+      }
+    }
+    // tree 59
+    if ( x4 >= 6.3854789733886719e+01f ) {
+      if ( x6 >= 1.1227733612060547e+02f ) {
+        sum += 9.1070216149091721e-03f;
+      } else {
+        sum += 1.1110652703791857e-03f;
+      }
+    } else {
+      if ( x2 >= 6.3687998056411743e-01f ) {
+        sum += -5.4832850582897663e-03f;
+      } else {
+        sum += 5.2936370484530926e-03f;
+      }
+    }
+    // tree 60
+    if ( x0 >= 9.2365103960037231e-01f ) {
+      if ( x1 >= 6.0398011207580566e+00f ) {
+        sum += 7.5943791307508945e-03f;
+      } else {
+        sum += -3.4017015714198351e-03f;
+      }
+    } else {
+      if ( x4 >= 6.3860050201416016e+01f ) {
+        sum += 8.7229199707508087e-03f;
+      } else {
+        sum += 2.0114348735660315e-03f;
+      }
+    }
+    // tree 61
+    if ( x4 >= 1.5336091613769531e+02f ) {
+      if ( x0 >= 2.4008381366729736e+00f ) {
+        sum += -3.0364759266376495e-02f;
+      } else {
+        sum += 1.0557909496128559e-02f;
+      }
+    } else {
+      if ( x3 >= 1.9109122753143311e+00f ) {
+        sum += -1.3013697229325771e-02f;
+      } else {
+        sum += 1.2879197311121970e-04f;
+      }
+    }
+    // tree 62
+    if ( x1 >= 4.0547266006469727e+00f ) {
+      if ( x5 >= 2.0845422744750977e+00f ) {
+        sum += 2.2626812278758734e-04f;
+      } else {
+        sum += 8.0250902101397514e-03f;
+      }
+    } else {
+      if ( x0 >= 9.3606269359588623e-01f ) {
+        sum += -6.1761578544974327e-03f;
+      } else {
+        sum += 2.1213789004832506e-03f;
+      }
+    }
+    // tree 63
+    if ( x0 >= 2.1275832653045654e+00f ) {
+      if ( x0 >= 2.4017589092254639e+00f ) {
+        sum += -2.3580528795719147e-02f;
+      } else {
+        sum += -7.4454094283282757e-03f;
+      }
+    } else {
+      if ( x6 >= 9.5435752868652344e+01f ) {
+        sum += 6.4634946174919605e-03f;
+      } else {
+        sum += -7.7277567470446229e-04f;
+      }
+    }
+    // tree 64
+    if ( x5 >= 2.5123150348663330e+00f ) {
+      if ( x4 >= 1.4540481567382812e+02f ) {
+        sum += 5.2361460402607918e-03f;
+      } else {
+        sum += -8.9218709617853165e-03f;
+      }
+    } else {
+      if ( x3 >= 1.9963333606719971e+00f ) {
+        sum += -1.0449959896504879e-02f;
+      } else {
+        sum += 2.5669725146144629e-03f;
+      }
+    }
+    // tree 65
+    if ( x2 >= 1.4138587713241577e+00f ) {
+      if ( x5 >= 1.8871679306030273e+00f ) {
+        sum += -7.8044570982456207e-03f;
+      } else {
+        sum += 2.8743806760758162e-03f;
+      }
+    } else {
+      if ( x5 >= 2.7167470455169678e+00f ) {
+        sum += -1.0633518919348717e-02f;
+      } else {
+        sum += 2.8603116516023874e-03f;
+      }
+    }
+    // tree 66
+    if ( x1 >= 5.0398011207580566e+00f ) {
+      if ( x1 >= 7.0298509597778320e+00f ) {
+        sum += 1.3738822191953659e-02f;
+      } else {
+        sum += 3.3721788786351681e-03f;
+      }
+    } else {
+      if ( x4 >= 1.5137188720703125e+02f ) {
+        sum += 7.7902101911604404e-03f;
+      } else {
+        sum += -2.9121399857103825e-03f;
+      }
+    }
+    // tree 67
+    if ( x6 >= 1.2911892700195312e+02f ) {
+      if ( x2 >= 2.1056036949157715e+00f ) {
+        sum += -1.7092712223529816e-02f;
+      } else {
+        sum += 8.8071571663022041e-03f;
+      }
+    } else {
+      if ( x6 >= 4.1753009796142578e+01f ) {
+        sum += -3.2049636356532574e-03f;
+      } else {
+        sum += 3.7564525846391916e-03f;
+      }
+    }
+    // tree 68
+    if ( x0 >= 1.2463545799255371e+00f ) {
+      if ( x5 >= 2.0507140159606934e+00f ) {
+        sum += -5.1258923485875130e-03f;
+      } else {
+        sum += 2.5131008587777615e-03f;
+      }
+    } else {
+      if ( x4 >= 6.3860050201416016e+01f ) {
+        sum += 6.1566159129142761e-03f;
+      } else {
+        sum += 4.0297793020727113e-05f;
+      }
+    }
+    // tree 69
+    if ( x2 >= 7.9961258172988892e-01f ) {
+      if ( x0 >= 6.8782925605773926e-01f ) {
+        sum += -3.2393767032772303e-03f;
+      } else {
+        sum += 5.5699027143418789e-03f;
+      }
+    } else {
+      if ( x3 >= 2.3334095478057861e+00f ) {
+        sum += -1.7808694392442703e-02f;
+      } else {
+        sum += 5.3763217292726040e-03f;
+      }
+    }
+    // tree 70
+    if ( x5 >= 2.2098867893218994e+00f ) {
+      if ( x1 >= 7.0099501609802246e+00f ) {
+        sum += 1.1596603319048882e-02f;
+      } else {
+        sum += -3.9763385429978371e-03f;
+      }
+    } else {
+      if ( x3 >= 2.4234387874603271e+00f ) {
+        sum += -1.8848093226552010e-02f;
+      } else {
+        sum += 3.4637437202036381e-03f;
+      }
+    }
+    // tree 71
+    if ( x6 >= 9.5435752868652344e+01f ) {
+      if ( x0 >= 2.1896560192108154e+00f ) {
+        sum += -6.8165967240929604e-03f;
+      } else {
+        sum += 5.6863604113459587e-03f;
+      }
+    } else {
+      if ( x6 >= 5.2228492736816406e+01f ) {
+        sum += -5.8219656348228455e-03f;
+      } else {
+        sum += 2.6045590639114380e-03f;
+      }
+    }
+    // tree 72
+    if ( x1 >= 4.0547266006469727e+00f ) {
+      if ( x0 >= 1.9783558845520020e+00f ) {
+        sum += -4.2181210592389107e-03f;
+      } else {
+        sum += 4.0056458674371243e-03f;
+      }
+    } else {
+      if ( x4 >= 1.2158036041259766e+02f ) {
+        sum += 3.7550085689872503e-03f;
+      } else {
+        sum += -4.7938278876245022e-03f;
+      }
+    }
+    // tree 73
+    if ( x3 >= 1.2702541351318359e+00f ) {
+      if ( x4 >= 1.3351263427734375e+02f ) {
+        sum += 4.1373525746166706e-03f;
+      } else {
+        sum += -5.1932767964899540e-03f;
+      }
+    } else {
+      if ( x5 >= 2.6397123336791992e+00f ) {
+        sum += -7.6959901489317417e-03f;
+      } else {
+        sum += 3.1824880279600620e-03f;
+      }
+    }
+    // tree 74
+    if ( x4 >= 6.3854789733886719e+01f ) {
+      if ( x4 >= 1.8092063903808594e+02f ) {
+        sum += 1.0707864537835121e-02f;
+      } else {
+        sum += 1.5515609411522746e-03f;
+      }
+    } else {
+      if ( x2 >= 6.3687998056411743e-01f ) {
+        sum += -4.3200221844017506e-03f;
+      } else {
+        sum += 4.5784874819219112e-03f;
+      }
+    }
+    // tree 75
+    if ( x2 >= 1.4138587713241577e+00f ) {
+      if ( x5 >= 1.8871679306030273e+00f ) {
+        sum += -6.6587589681148529e-03f;
+      } else {
+        sum += 2.5072700809687376e-03f;
+      }
+    } else {
+      if ( x3 >= 1.5265173912048340e+00f ) {
+        sum += -4.0391930378973484e-03f;
+      } else {
+        sum += 3.1105289235711098e-03f;
+      }
+    }
+    // tree 76
+    if ( x0 >= 2.1275832653045654e+00f ) {
+      if ( x0 >= 2.4017589092254639e+00f ) {
+        sum += -2.0963486284017563e-02f;
+      } else {
+        sum += -5.7802549563348293e-03f;
+      }
+    } else {
+      if ( x5 >= 2.2098867893218994e+00f ) {
+        sum += -1.8059912836179137e-03f;
+      } else {
+        sum += 3.4958145115524530e-03f;
+      }
+    }
+    // tree 77
+    if ( x1 >= 6.0248756408691406e+00f ) {
+      if ( x1 >= 7.0398011207580566e+00f ) {
+        sum += 1.1923748999834061e-02f;
+      } else {
+        sum += 4.4301180168986320e-03f;
+      }
+    } else {
+      if ( x6 >= 1.2350506591796875e+02f ) {
+        sum += 5.6580589152872562e-03f;
+      } else {
+        sum += -2.0619153510779142e-03f;
+      }
+    }
+    // tree 78
+    if ( x0 >= 6.8782925605773926e-01f ) {
+      if ( x2 >= 1.0770140886306763e+00f ) {
+        sum += -4.0132622234523296e-03f;
+      } else {
+        sum += 1.7681273166090250e-03f;
+      }
+    } else {
+      if ( x5 >= 2.5705025196075439e+00f ) {
+        sum += -1.7576834652572870e-03f;
+      } else {
+        sum += 6.9071990437805653e-03f;
+      }
+    }
+    // tree 79
+    if ( x6 >= 9.5435752868652344e+01f ) {
+      if ( x2 >= 2.1230268478393555e+00f ) {
+        sum += -1.2986829504370689e-02f;
+      } else {
+        sum += 4.5923567377030849e-03f;
+      }
+    } else {
+      if ( x6 >= 5.2228492736816406e+01f ) {
+        sum += -5.2795158699154854e-03f;
+      } else {
+        sum += 2.5411930400878191e-03f;
+      }
+    }
+    // tree 80
+    if ( x5 >= 2.0507140159606934e+00f ) {
+      if ( x1 >= 7.0099501609802246e+00f ) {
+        sum += 1.0942849330604076e-02f;
+      } else {
+        sum += -2.3977102246135473e-03f;
+      }
+    } else {
+      if ( x3 >= 2.5942809581756592e+00f ) {
+        sum += -2.3477530106902122e-02f;
+      } else {
+        sum += 4.2567905038595200e-03f;
+      }
+    }
+    // tree 81
+    if ( x1 >= 4.0547266006469727e+00f ) {
+      if ( x5 >= 2.0564692020416260e+00f ) {
+        sum += 2.8609094442799687e-04f;
+      } else {
+        sum += 6.3996082171797752e-03f;
+      }
+    } else {
+      if ( x0 >= 1.5442346334457397e+00f ) {
+        sum += -6.5831067040562630e-03f;
+      } else {
+        sum += -4.4282243470661342e-04f;
+      }
+    }
+    // tree 82
+    if ( x4 >= 6.3854789733886719e+01f ) {
+      if ( x4 >= 1.8259300231933594e+02f ) {
+        sum += 9.8254000768065453e-03f;
+      } else {
+        sum += 1.3706736499443650e-03f;
+      }
+    } else {
+      if ( x0 >= 1.6931747198104858e+00f ) {
+        sum += -7.1194316260516644e-03f;
+      } else {
+        sum += -6.1851798091083765e-04f;
+      }
+    }
+    // tree 83
+    if ( x2 >= 6.8072623014450073e-01f ) {
+      if ( x0 >= 6.8782925605773926e-01f ) {
+        sum += -2.2087325341999531e-03f;
+      } else {
+        sum += 4.7415187582373619e-03f;
+      }
+    } else {
+      if ( x5 >= 2.7367572784423828e+00f ) {
+        sum += -1.0576920583844185e-02f;
+      } else {
+        sum += 5.8797975070774555e-03f;
+      }
+    }
+    // tree 84
+    if ( x3 >= 1.1207671165466309e+00f ) {
+      if ( x0 >= 2.1283555030822754e+00f ) {
+        sum += -1.0035956278443336e-02f;
+      } else {
+        sum += -1.3324223691597581e-03f;
+      }
+    } else {
+      if ( x5 >= 2.6372141838073730e+00f ) {
+        sum += -7.2104805149137974e-03f;
+      } else {
+        sum += 3.1702241394668818e-03f;
+      }
+    }
+    // tree 85
+    if ( x1 >= 5.0398011207580566e+00f ) {
+      if ( x5 >= 2.4262719154357910e+00f ) {
+        sum += -1.4544847654178739e-03f;
+      } else {
+        sum += 5.3354413248598576e-03f;
+      }
+    } else {
+      if ( x4 >= 5.7887714385986328e+01f ) {
+        sum += 6.0847419081255794e-04f;
+      } else {
+        sum += -4.4574583880603313e-03f;
+      }
+    }
+    // tree 86
+    if ( x6 >= 9.5435752868652344e+01f ) {
+      if ( x2 >= 2.5237560272216797e+00f ) {
+        sum += -2.6123262941837311e-02f;
+      } else {
+        sum += 3.9219176396727562e-03f;
+      }
+    } else {
+      if ( x6 >= 5.2228492736816406e+01f ) {
+        sum += -4.8598172143101692e-03f;
+      } else {
+        sum += 2.3924272973090410e-03f;
+      }
+    }
+    // tree 87
+    if ( x5 >= 2.7192397117614746e+00f ) {
+      if ( x4 >= 2.0113774108886719e+02f ) {
+        sum += 1.4861117117106915e-02f;
+      } else {
+        sum += -9.5539195463061333e-03f;
+      }
+    } else {
+      if ( x3 >= 2.0603992938995361e+00f ) {
+        sum += -9.2605892568826675e-03f;
+      } else {
+        sum += 1.3213829370215535e-03f;
+      }
+    }
+    // tree 88
+    if ( x4 >= 1.6728408813476562e+02f ) {
+      if ( x6 >= 3.4805957031250000e+02f ) {
+        sum += -1.4422067441046238e-02f;
+      } else {
+        sum += 8.6168143898248672e-03f;
+      }
+    } else {
+      if ( x5 >= 2.2735559940338135e+00f ) {
+        sum += -3.4121144562959671e-03f;
+      } else {
+        sum += 1.1842435924336314e-03f;
+      }
+    }
+    // tree 89
+    if ( x2 >= 6.8072623014450073e-01f ) {
+      if ( x0 >= 6.8782925605773926e-01f ) {
+        sum += -2.0039109513163567e-03f;
+      } else {
+        sum += 4.3139075860381126e-03f;
+      }
+    } else {
+      if ( x6 >= 2.2457374572753906e+01f ) {
+        sum += 3.5972597543150187e-03f;
+      } else {
+        sum += 1.2565123848617077e-02f;
+      }
+    }
+    // tree 90
+    if ( x6 >= 1.2911892700195312e+02f ) {
+      if ( x6 >= 3.0312185668945312e+02f ) {
+        sum += -1.4276618137955666e-02f;
+      } else {
+        sum += 6.8101990036666393e-03f;
+      }
+    } else {
+      if ( x6 >= 4.1753009796142578e+01f ) {
+        sum += -2.4334278423339128e-03f;
+      } else {
+        sum += 3.0261192005127668e-03f;
+      }
+    }
+    // tree 91
+    if ( x2 >= 1.4138587713241577e+00f ) {
+      if ( x5 >= 1.5669388771057129e+00f ) {
+        sum += -4.5131794176995754e-03f;
+      } else {
+        sum += 8.5489535704255104e-03f;
+      }
+    } else {
+      if ( x3 >= 2.3807282447814941e+00f ) {
+        sum += -1.6829738393425941e-02f;
+      } else {
+        sum += 1.7019148217514157e-03f;
+      }
+    }
+    // tree 92
+    if ( x4 >= 4.3964538574218750e+01f ) {
+      if ( x0 >= 2.4006543159484863e+00f ) {
+        sum += -1.8735898658633232e-02f;
+      } else {
+        sum += 1.6163197578862309e-03f;
+      }
+    } else {
+      if ( x5 >= 2.1303005218505859e+00f ) {
+        sum += -6.3350768759846687e-03f;
+      } else {
+        sum += 2.0288003724999726e-04f;
+      }
+    }
+    // tree 93
+    if ( x1 >= 6.0248756408691406e+00f ) {
+      if ( x1 >= 8.0348262786865234e+00f ) {
+        sum += 1.4087894931435585e-02f;
+      } else {
+        sum += 4.6098553575575352e-03f;
+      }
+    } else {
+      if ( x5 >= 2.0507140159606934e+00f ) {
+        sum += -2.2930647246539593e-03f;
+      } else {
+        sum += 2.2652691695839167e-03f;
+      }
+    }
+    // tree 94
+    if ( x3 >= 1.1207671165466309e+00f ) {
+      if ( x3 >= 2.6944737434387207e+00f ) {
+        sum += -2.1838895976543427e-02f;
+      } else {
+        sum += -1.7871826421469450e-03f;
+      }
+    } else {
+      if ( x2 >= 2.1552827358245850e+00f ) {
+        sum += -1.2581007555127144e-02f;
+      } else {
+        sum += 2.3901741951704025e-03f;
+      }
+    }
+    // tree 95
+    if ( x0 >= 5.6371253728866577e-01f ) {
+      if ( x4 >= 1.8319628906250000e+02f ) {
+        sum += 8.0403946340084076e-03f;
+      } else {
+        sum += -1.1996866669505835e-03f;
+      }
+    } else {
+      if ( x4 >= 9.7715820312500000e+01f ) {
+        sum += 9.7691677510738373e-03f;
+      } else {
+        sum += 3.7939504254609346e-03f;
+      }
+    }
+    // tree 96
+    if ( x1 >= 4.0547266006469727e+00f ) {
+      if ( x2 >= 1.7754051685333252e+00f ) {
+        sum += -7.0049306377768517e-03f;
+      } else {
+        sum += 2.4890054482966661e-03f;
+      }
+    } else {
+      if ( x6 >= 9.5435752868652344e+01f ) {
+        sum += 1.1175535619258881e-03f;
+      } else {
+        sum += -3.8085181731730700e-03f;
+      }
+    }
+    // tree 97
+    if ( x0 >= 2.1275832653045654e+00f ) {
+      if ( x0 >= 2.4017589092254639e+00f ) {
+        sum += -1.7485560849308968e-02f;
+      } else {
+        sum += -4.1402578353881836e-03f;
+      }
+    } else {
+      if ( x4 >= 1.8120726013183594e+02f ) {
+        sum += 8.5884407162666321e-03f;
+      } else {
+        sum += 2.7489059721119702e-04f;
+      }
+    }
+    // tree 98
+    if ( x5 >= 2.5441496372222900e+00f ) {
+      if ( x4 >= 2.0109750366210938e+02f ) {
+        sum += 1.0950204916298389e-02f;
+      } else {
+        sum += -5.4318620823323727e-03f;
+      }
+    } else {
+      if ( x3 >= 2.4234387874603271e+00f ) {
+        sum += -1.3549620285630226e-02f;
+      } else {
+        sum += 1.2125679058954120e-03f;
+      }
+    }
+    // tree 99
+    if ( x6 >= 9.5435752868652344e+01f ) {
+      if ( x6 >= 3.2669421386718750e+02f ) {
+        sum += -1.7699429765343666e-02f;
+      } else {
+        sum += 3.4797403495758772e-03f;
+      }
+    } else {
+      if ( x6 >= 5.3652904510498047e+01f ) {
+        sum += -4.3392553925514221e-03f;
+      } else {
+        sum += 2.0436104387044907e-03f;
+      }
+    }
+    // tree 100
+    if ( x2 >= 6.8072623014450073e-01f ) {
+      if ( x0 >= 6.8782925605773926e-01f ) {
+        sum += -1.7153592780232430e-03f;
+      } else {
+        sum += 3.6096021067351103e-03f;
+      }
+    } else {
+      if ( x5 >= 2.7367572784423828e+00f ) {
+        sum += -8.6718723177909851e-03f;
+      } else {
+        sum += 4.6225572004914284e-03f;
+      }
+    }
+    // tree 101
+    if ( x4 >= 4.3964538574218750e+01f ) {
+      if ( x6 >= 3.9297122955322266e+01f ) {
+        sum += 1.2701496598310769e-04f;
+      } else {
+        sum += 5.0606704317033291e-03f;
+      }
+    } else {
+      if ( x1 >= 7.0348258018493652e+00f ) {
+        sum += 1.0304884985089302e-02f;
+      } else {
+        sum += -3.8105314597487450e-03f;
+      }
+    }
+    // tree 102
+    if ( x5 >= 2.1143832206726074e+00f ) {
+      if ( x1 >= 7.0099501609802246e+00f ) {
+        sum += 9.0545695275068283e-03f;
+      } else {
+        sum += -2.1414903458207846e-03f;
+      }
+    } else {
+      if ( x3 >= 2.5515704154968262e+00f ) {
+        sum += -1.5703724697232246e-02f;
+      } else {
+        sum += 2.6485940907150507e-03f;
+      }
+    }
+    // tree 103
+    if ( x6 >= 1.4034664916992188e+02f ) {
+      if ( x6 >= 2.9764855957031250e+02f ) {
+        sum += -1.2814356945455074e-02f;
+      } else {
+        sum += 7.0941355079412460e-03f;
+      }
+    } else {
+      if ( x6 >= 4.1894340515136719e+01f ) {
+        sum += -1.9222603878006339e-03f;
+      } else {
+        sum += 2.5815272238105536e-03f;
+      }
+    }
+    // tree 104
+    if ( x3 >= 1.0994118452072144e+00f ) {
+      if ( x4 >= 8.7772262573242188e+01f ) {
+        sum += 1.0947375558316708e-03f;
+      } else {
+        sum += -3.6414545029401779e-03f;
+      }
+    } else {
+      if ( x2 >= 2.3484299182891846e+00f ) {
+        sum += -1.5742963179945946e-02f;
+      } else {
+        sum += 2.0334981381893158e-03f;
+      }
+    }
+    // tree 105
+    if ( x1 >= 4.0547266006469727e+00f ) {
+      if ( x2 >= 1.7578380107879639e+00f ) {
+        sum += -6.0989712364971638e-03f;
+      } else {
+        sum += 2.2288805339485407e-03f;
+      }
+    } else {
+      if ( x0 >= 4.1477245092391968e-01f ) {
+        sum += -2.5881014298647642e-03f;
+      } else {
+        sum += 5.2795046940445900e-03f;
+      }
+    }
+    // tree 106
+    if ( x5 >= 2.0347969532012939e+00f ) {
+      if ( x0 >= 1.8545265197753906e+00f ) {
+        sum += -5.3850244730710983e-03f;
+      } else {
+        sum += 1.8203213403467089e-04f;
+      }
+    } else {
+      if ( x3 >= 2.5942809581756592e+00f ) {
+        sum += -1.6268987208604813e-02f;
+      } else {
+        sum += 3.0801156535744667e-03f;
+      }
+    }
+    // tree 107
+    if ( x6 >= 9.5435752868652344e+01f ) {
+      if ( x6 >= 3.2669421386718750e+02f ) {
+        sum += -1.5399768017232418e-02f;
+      } else {
+        sum += 3.1568878330290318e-03f;
+      }
+    } else {
+      if ( x6 >= 5.3652904510498047e+01f ) {
+        sum += -3.8025286048650742e-03f;
+      } else {
+        sum += 1.7075383802875876e-03f;
+      }
+    }
+    // tree 108
+    if ( x5 >= 2.7988259792327881e+00f ) {
+      if ( x4 >= 2.0113774108886719e+02f ) {
+        sum += 1.5366757288575172e-02f;
+      } else {
+        sum += -9.1839740052819252e-03f;
+      }
+    } else {
+      if ( x2 >= 6.8072623014450073e-01f ) {
+        sum += -4.1451075230725110e-04f;
+      } else {
+        sum += 4.0850983932614326e-03f;
+      }
+    }
+    // tree 109
+    if ( x0 >= 2.4006400108337402e+00f ) {
+      if ( x4 >= 1.2456653594970703e+02f ) {
+        sum += -2.4705534800887108e-02f;
+      } else {
+        sum += -1.3686924241483212e-02f;
+      }
+    } else {
+      if ( x4 >= 4.5953563690185547e+01f ) {
+        sum += 1.3337612617760897e-03f;
+      } else {
+        sum += -2.5790880899876356e-03f;
+      }
+    }
+    // tree 110
+    if ( x1 >= 6.0248756408691406e+00f ) {
+      if ( x5 >= 2.4122805595397949e+00f ) {
+        sum += -7.4496841989457607e-04f;
+      } else {
+        sum += 6.5186922438442707e-03f;
+      }
+    } else {
+      if ( x6 >= 1.4034664916992188e+02f ) {
+        sum += 4.5460527762770653e-03f;
+      } else {
+        sum += -1.1906034778803587e-03f;
+      }
+    }
+    // tree 111
+    if ( x0 >= 9.2365103960037231e-01f ) {
+      if ( x2 >= 2.2658774852752686e+00f ) {
+        sum += -1.1910556815564632e-02f;
+      } else {
+        sum += -6.1687210109084845e-04f;
+      }
+    } else {
+      if ( x1 >= 7.0099501609802246e+00f ) {
+        sum += 1.2444713152945042e-02f;
+      } else {
+        sum += 2.2635592613369226e-03f;
+      }
+    }
+    // tree 112
+    if ( x5 >= 2.2098867893218994e+00f ) {
+      if ( x4 >= 5.3909664154052734e+01f ) {
+        sum += -6.0509824834298342e-05f;
+      } else {
+        sum += -4.7154775820672512e-03f;
+      }
+    } else {
+      if ( x1 >= 4.0447759628295898e+00f ) {
+        sum += 3.2540217507630587e-03f;
+      } else {
+        sum += -6.2899559270590544e-04f;
+      }
+    }
+    // tree 113
+    if ( x0 >= 2.1524066925048828e+00f ) {
+      if ( x0 >= 2.4013855457305908e+00f ) {
+        sum += -1.5036117285490036e-02f;
+      } else {
+        sum += -3.4183487296104431e-03f;
+      }
+    } else {
+      if ( x2 >= 1.4336731433868408e+00f ) {
+        sum += -2.3797203321009874e-03f;
+      } else {
+        sum += 1.5363720012828708e-03f;
+      }
+    }
+    // tree 114
+    if ( x4 >= 1.8319628906250000e+02f ) {
+      if ( x5 >= 1.4131512641906738e+00f ) {
+        sum += 6.0191364027559757e-03f;
+      } else {
+        sum += 2.3154655471444130e-02f;
+      }
+    } else {
+      if ( x2 >= 2.1668057441711426e+00f ) {
+        sum += -9.5622604712843895e-03f;
+      } else {
+        sum += -2.9533173801610246e-05f;
+      }
+    }
+    // tree 115
+    if ( x5 >= 2.7192397117614746e+00f ) {
+      if ( x0 >= 1.1893445253372192e+00f ) {
+        sum += -9.2332325875759125e-03f;
+      } else {
+        sum += -1.4280766481533647e-03f;
+      }
+    } else {
+      if ( x3 >= 2.0603992938995361e+00f ) {
+        sum += -6.5991943702101707e-03f;
+      } else {
+        sum += 9.1128650819882751e-04f;
+      }
+    }
+    // tree 116
+    if ( x5 >= 2.0347969532012939e+00f ) {
+      if ( x1 >= 7.0099501609802246e+00f ) {
+        sum += 7.2037265636026859e-03f;
+      } else {
+        sum += -1.4548831386491656e-03f;
+      }
+    } else {
+      if ( x3 >= 2.6369915008544922e+00f ) {
+        sum += -1.6077835112810135e-02f;
+      } else {
+        sum += 2.6873310562223196e-03f;
+      }
+    }
+    // tree 117
+    if ( x0 >= 5.6371253728866577e-01f ) {
+      if ( x5 >= 2.2735559940338135e+00f ) {
+        sum += -2.6073486078530550e-03f;
+      } else {
+        sum += 7.6498684938997030e-04f;
+      }
+    } else {
+      if ( x6 >= 2.1252738952636719e+01f ) {
+        sum += 3.5852033179253340e-03f;
+      } else {
+        sum += 9.2008775100111961e-03f;
+      }
+    }
+    // tree 118
+    if ( x6 >= 8.9821891784667969e+01f ) {
+      if ( x6 >= 3.3267050170898438e+02f ) {
+        sum += -1.6336467117071152e-02f;
+      } else {
+        sum += 2.5275640655308962e-03f;
+      }
+    } else {
+      if ( x6 >= 5.3624084472656250e+01f ) {
+        sum += -4.0355334058403969e-03f;
+      } else {
+        sum += 1.6635945066809654e-03f;
+      }
+    }
+    // tree 119
+    if ( x3 >= 1.1207671165466309e+00f ) {
+      if ( x2 >= 5.2221107482910156e-01f ) {
+        sum += -2.0677628926932812e-03f;
+      } else {
+        sum += 6.3755004666745663e-03f;
+      }
+    } else {
+      if ( x3 >= 4.7904548048973083e-01f ) {
+        sum += 2.0097687374800444e-03f;
+      } else {
+        sum += -4.7151576727628708e-03f;
+      }
+    }
+    // tree 120
+    if ( x1 >= 5.0398011207580566e+00f ) {
+      if ( x2 >= 5.9437334537506104e-01f ) {
+        sum += 1.4669166412204504e-03f;
+      } else {
+        sum += 7.3490254580974579e-03f;
+      }
+    } else {
+      if ( x0 >= 2.3013467788696289e+00f ) {
+        sum += -9.6066752448678017e-03f;
+      } else {
+        sum += -5.1627313951030374e-04f;
+      }
+    }
+    // tree 121
+    if ( x4 >= 1.6728408813476562e+02f ) {
+      if ( x6 >= 3.4805957031250000e+02f ) {
+        sum += -1.0217669419944286e-02f;
+      } else {
+        sum += 5.9219799004495144e-03f;
+      }
+    } else {
+      if ( x2 >= 2.2856919765472412e+00f ) {
+        sum += -1.0518895462155342e-02f;
+      } else {
+        sum += -1.5631369024049491e-04f;
+      }
+    }
+    // tree 122
+    if ( x6 >= 1.4034664916992188e+02f ) {
+      if ( x6 >= 2.9764855957031250e+02f ) {
+        sum += -1.1186850257217884e-02f;
+      } else {
+        sum += 5.7389424182474613e-03f;
+      }
+    } else {
+      if ( x6 >= 4.1894340515136719e+01f ) {
+        sum += -1.5971952816471457e-03f;
+      } else {
+        sum += 2.2194315679371357e-03f;
+      }
+    }
+    // tree 123
+    if ( x5 >= 2.8465778827667236e+00f ) {
+      if ( x0 >= 1.1765391826629639e+00f ) {
+        sum += -1.1853424832224846e-02f;
+      } else {
+        sum += -1.3991965679451823e-03f;
+      }
+    } else {
+      if ( x4 >= 4.5953563690185547e+01f ) {
+        sum += 1.1846033157780766e-03f;
+      } else {
+        sum += -2.0216761622577906e-03f;
+      }
+    }
+    // tree 124
+    if ( x0 >= 5.6371253728866577e-01f ) {
+      if ( x4 >= 1.8319628906250000e+02f ) {
+        sum += 5.6707225739955902e-03f;
+      } else {
+        sum += -8.3925505168735981e-04f;
+      }
+    } else {
+      if ( x5 >= 2.8721477985382080e+00f ) {
+        sum += -8.0192228779196739e-03f;
+      } else {
+        sum += 4.2384569533169270e-03f;
+      }
+    }
+    // tree 125
+    if ( x2 >= 7.9961258172988892e-01f ) {
+      if ( x0 >= 2.4006400108337402e+00f ) {
+        sum += -1.5538162551820278e-02f;
+      } else {
+        sum += -6.3664466142654419e-04f;
+      }
+    } else {
+      if ( x6 >= 1.1229667663574219e+01f ) {
+        sum += 1.8242489313706756e-03f;
+      } else {
+        sum += 9.1465087607502937e-03f;
+      }
+    }
+    // tree 126
+    if ( x5 >= 2.0347969532012939e+00f ) {
+      if ( x0 >= 1.8545265197753906e+00f ) {
+        sum += -4.2603868059813976e-03f;
+      } else {
+        sum += 1.4250368985813111e-04f;
+      }
+    } else {
+      if ( x3 >= 2.5942809581756592e+00f ) {
+        sum += -1.3304290361702442e-02f;
+      } else {
+        sum += 2.3999752011150122e-03f;
+      }
+    }
+    // tree 127
+    if ( x1 >= 7.0099501609802246e+00f ) {
+      if ( x0 >= 1.9539028406143188e+00f ) {
+        sum += -1.4705529902130365e-03f;
+      } else {
+        sum += 8.6910370737314224e-03f;
+      }
+    } else {
+      if ( x5 >= 2.1143832206726074e+00f ) {
+        sum += -1.5079644508659840e-03f;
+      } else {
+        sum += 1.4016131171956658e-03f;
+      }
+    }
+    // tree 128
+    if ( x6 >= 8.9821891784667969e+01f ) {
+      if ( x6 >= 3.3267050170898438e+02f ) {
+        sum += -1.4081218279898167e-02f;
+      } else {
+        sum += 2.2743823938071728e-03f;
+      }
+    } else {
+      if ( x6 >= 5.3624084472656250e+01f ) {
+        sum += -3.5941952373832464e-03f;
+      } else {
+        sum += 1.4513402711600065e-03f;
+      }
+    }
+    // tree 129
+    if ( x1 >= 4.0547266006469727e+00f ) {
+      if ( x3 >= 1.7618578672409058e+00f ) {
+        sum += -4.4587687589228153e-03f;
+      } else {
+        sum += 1.7950152978301048e-03f;
+      }
+    } else {
+      if ( x5 >= 1.3981058597564697e+00f ) {
+        sum += -1.8339541275054216e-03f;
+      } else {
+        sum += 1.0575968772172928e-02f;
+      }
+    }
+    // tree 130
+    if ( x4 >= 2.0905360412597656e+02f ) {
+      if ( x0 >= 2.3014183044433594e+00f ) {
+        sum += -1.2629788368940353e-02f;
+      } else {
+        sum += 7.6227076351642609e-03f;
+      }
+    } else {
+      if ( x3 >= 2.7437679767608643e+00f ) {
+        sum += -1.9632760435342789e-02f;
+      } else {
+        sum += -8.1767408119048923e-05f;
+      }
+    }
+    // tree 131
+    if ( x2 >= 1.5723738670349121e+00f ) {
+      if ( x6 >= 2.8704101562500000e+02f ) {
+        sum += -4.1098743677139282e-02f;
+      } else {
+        sum += -2.5175372138619423e-03f;
+      }
+    } else {
+      if ( x3 >= 2.3807282447814941e+00f ) {
+        sum += -1.1164966970682144e-02f;
+      } else {
+        sum += 8.8269618572667241e-04f;
+      }
+    }
+    // tree 132
+    if ( x4 >= 4.3964538574218750e+01f ) {
+      if ( x6 >= 2.2455535888671875e+01f ) {
+        sum += 2.4032554938457906e-04f;
+      } else {
+        sum += 4.9154306761920452e-03f;
+      }
+    } else {
+      if ( x2 >= 1.6036089658737183e+00f ) {
+        sum += -8.0655654892325401e-03f;
+      } else {
+        sum += -1.1326993117108941e-03f;
+      }
+    }
+    // tree 133
+    if ( x6 >= 1.4034664916992188e+02f ) {
+      if ( x6 >= 2.9764855957031250e+02f ) {
+        sum += -9.9009061232209206e-03f;
+      } else {
+        sum += 5.1082698628306389e-03f;
+      }
+    } else {
+      if ( x6 >= 4.1894340515136719e+01f ) {
+        sum += -1.3778988504782319e-03f;
+      } else {
+        sum += 1.8761700484901667e-03f;
+      }
+    }
+    // tree 134
+    if ( x2 >= 6.2128305435180664e-01f ) {
+      if ( x4 >= 1.3148162841796875e+02f ) {
+        sum += 2.7576813008636236e-03f;
+      } else {
+        sum += -1.0605488205328584e-03f;
+      }
+    } else {
+      if ( x1 >= 4.0398011207580566e+00f ) {
+        sum += 4.9488977529108524e-03f;
+      } else {
+        sum += -3.6856497172266245e-04f;
+      }
+    }
+    // tree 135
+    if ( x5 >= 2.8465778827667236e+00f ) {
+      if ( x0 >= 1.1765391826629639e+00f ) {
+        sum += -1.0702989995479584e-02f;
+      } else {
+        sum += -9.4774551689624786e-04f;
+      }
+    } else {
+      if ( x0 >= 5.3888916969299316e-01f ) {
+        sum += -1.6330294602084905e-04f;
+      } else {
+        sum += 3.9673564024269581e-03f;
+      }
+    }
+    // tree 136
+    if ( x6 >= 8.9821891784667969e+01f ) {
+      if ( x2 >= 2.5132286548614502e+00f ) {
+        sum += -1.8885664641857147e-02f;
+      } else {
+        sum += 2.0159306004643440e-03f;
+      }
+    } else {
+      if ( x6 >= 5.3624084472656250e+01f ) {
+        sum += -3.1779767014086246e-03f;
+      } else {
+        sum += 1.2370027834549546e-03f;
+      }
+    }
+    // tree 137
+    if ( x3 >= 1.0994118452072144e+00f ) {
+      if ( x4 >= 2.5283532714843750e+02f ) {
+        sum += 1.1056052520871162e-02f;
+      } else {
+        sum += -1.5200056368485093e-03f;
+      }
+    } else {
+      if ( x3 >= 4.8201462626457214e-01f ) {
+        sum += 1.7940576653927565e-03f;
+      } else {
+        sum += -4.4642621651291847e-03f;
+      }
+    }
+    // tree 138
+    if ( x0 >= 2.3758168220520020e+00f ) {
+      if ( x5 >= 2.5056622028350830e+00f ) {
+        sum += -2.1873721852898598e-02f;
+      } else {
+        sum += -6.7188441753387451e-03f;
+      }
+    } else {
+      if ( x1 >= 7.0099501609802246e+00f ) {
+        sum += 6.3319168984889984e-03f;
+      } else {
+        sum += -5.4400421504396945e-05f;
+      }
+    }
+    // tree 139
+    if ( x5 >= 2.0347969532012939e+00f ) {
+      if ( x0 >= 1.8545265197753906e+00f ) {
+        sum += -3.6817309446632862e-03f;
+      } else {
+        sum += 1.0857028246391565e-04f;
+      }
+    } else {
+      if ( x3 >= 4.8010897636413574e-01f ) {
+        sum += 2.2466350346803665e-03f;
+      } else {
+        sum += -5.8815558440983295e-03f;
+      }
+    }
+    // tree 140
+    if ( x1 >= 6.0248756408691406e+00f ) {
+      if ( x2 >= 2.1651864051818848e+00f ) {
+        sum += -2.2560598328709602e-02f;
+      } else {
+        sum += 3.5346304066479206e-03f;
+      }
+    } else {
+      if ( x2 >= 5.2221107482910156e-01f ) {
+        sum += -7.1183126419782639e-04f;
+      } else {
+        sum += 4.8307734541594982e-03f;
+      }
+    }
+    // tree 141
+    if ( x6 >= 8.9821891784667969e+01f ) {
+      if ( x5 >= 1.4138572216033936e+00f ) {
+        sum += 1.5027277404442430e-03f;
+      } else {
+        sum += 1.9868586212396622e-02f;
+      }
+    } else {
+      if ( x6 >= 5.2283485412597656e+01f ) {
+        sum += -2.8743611183017492e-03f;
+      } else {
+        sum += 1.2002836447209120e-03f;
+      }
+    }
+    // tree 142
+    if ( x5 >= 2.5123150348663330e+00f ) {
+      if ( x0 >= 2.3758440017700195e+00f ) {
+        sum += -1.9517475739121437e-02f;
+      } else {
+        sum += -2.3171096108853817e-03f;
+      }
+    } else {
+      if ( x1 >= 4.0547266006469727e+00f ) {
+        sum += 1.6206409782171249e-03f;
+      } else {
+        sum += -9.8038092255592346e-04f;
+      }
+    }
+    // tree 143
+    if ( x3 >= 1.3129646778106689e+00f ) {
+      if ( x5 >= 1.2454363107681274e+00f ) {
+        sum += -1.8309737788513303e-03f;
+      } else {
+        sum += 1.7878487706184387e-02f;
+      }
+    } else {
+      if ( x2 >= 2.2507431507110596e+00f ) {
+        sum += -1.1756598949432373e-02f;
+      } else {
+        sum += 1.0994672775268555e-03f;
+      }
+    }
+    // tree 144
+    if ( x4 >= 4.3964538574218750e+01f ) {
+      if ( x6 >= 5.6138713836669922e+01f ) {
+        sum += -1.8363571143709123e-04f;
+      } else {
+        sum += 2.5814885739237070e-03f;
+      }
+    } else {
+      if ( x2 >= 1.6036089658737183e+00f ) {
+        sum += -7.1623739786446095e-03f;
+      } else {
+        sum += -9.9324644543230534e-04f;
+      }
+    }
+    // tree 145
+    if ( x0 >= 5.6371253728866577e-01f ) {
+      if ( x5 >= 2.2735559940338135e+00f ) {
+        sum += -1.9899376202374697e-03f;
+      } else {
+        sum += 6.0524471336975694e-04f;
+      }
+    } else {
+      if ( x2 >= 1.9848352670669556e+00f ) {
+        sum += 1.1037957854568958e-02f;
+      } else {
+        sum += 2.8703061398118734e-03f;
+      }
+    }
+    // tree 146
+    if ( x1 >= 8.0497512817382812e+00f ) {
+      if ( x4 >= 9.5131050109863281e+01f ) {
+        sum += 4.6515590511262417e-03f;
+      } else {
+        sum += 1.2276985682547092e-02f;
+      }
+    } else {
+      if ( x2 >= 5.2221107482910156e-01f ) {
+        sum += -3.9949247729964554e-04f;
+      } else {
+        sum += 4.4611440971493721e-03f;
+      }
+    }
+    // tree 147
+    if ( x0 >= 2.4006400108337402e+00f ) {
+      if ( x4 >= 1.2456653594970703e+02f ) {
+        sum += -2.0512524992227554e-02f;
+      } else {
+        sum += -8.5234763100743294e-03f;
+      }
+    } else {
+      if ( x4 >= 2.0905360412597656e+02f ) {
+        sum += 6.2408950179815292e-03f;
+      } else {
+        sum += -6.4602216298226267e-05f;
+      }
+    }
+    // tree 148
+    if ( x6 >= 8.9821891784667969e+01f ) {
+      if ( x6 >= 3.3267050170898438e+02f ) {
+        sum += -1.3002051971852779e-02f;
+      } else {
+        sum += 1.8435129895806313e-03f;
+      }
+    } else {
+      if ( x6 >= 5.3624084472656250e+01f ) {
+        sum += -2.6816111057996750e-03f;
+      } else {
+        sum += 9.8620343487709761e-04f;
+      }
+    }
+    // tree 149
+    if ( x5 >= 2.8465778827667236e+00f ) {
+      if ( x0 >= 1.1765391826629639e+00f ) {
+        sum += -9.4027156010270119e-03f;
+      } else {
+        sum += -5.8870128123089671e-04f;
+      }
+    } else {
+      if ( x6 >= 1.2911892700195312e+02f ) {
+        sum += 3.1972187571227551e-03f;
+      } else {
+        sum += -2.0507264707703143e-04f;
+      }
+    }
+    // tree 150
+    if ( x2 >= 2.5234646797180176e+00f ) {
+      if ( x3 >= 1.6164059638977051e+00f ) {
+        sum += 2.2481661289930344e-03f;
+      } else {
+        sum += -1.6861757263541222e-02f;
+      }
+    } else {
+      if ( x5 >= 2.0310206413269043e+00f ) {
+        sum += -6.0686550568789244e-04f;
+      } else {
+        sum += 1.8721822416409850e-03f;
+      }
+    }
+    // tree 151
+    if ( x3 >= 2.6797020435333252e+00f ) {
+      if ( x5 >= 1.6734455823898315e+00f ) {
+        sum += -1.7780136317014694e-02f;
+      } else {
+        sum += 1.8251547589898109e-02f;
+      }
+    } else {
+      if ( x2 >= 2.1271767616271973e+00f ) {
+        sum += -5.3995409980416298e-03f;
+      } else {
+        sum += 3.7554293521679938e-04f;
+      }
+    }
+    // tree 152
+    if ( x1 >= 5.0398011207580566e+00f ) {
+      if ( x6 >= 1.0614191436767578e+02f ) {
+        sum += 5.3593330085277557e-03f;
+      } else {
+        sum += 7.1528123226016760e-04f;
+      }
+    } else {
+      if ( x5 >= 1.2548503875732422e+00f ) {
+        sum += -7.3947577038779855e-04f;
+      } else {
+        sum += 1.3993684202432632e-02f;
+      }
+    }
+    // tree 153
+    if ( x0 >= 7.9953432083129883e-01f ) {
+      if ( x5 >= 2.4486460685729980e+00f ) {
+        sum += -3.0167137738317251e-03f;
+      } else {
+        sum += 1.3165485870558769e-04f;
+      }
+    } else {
+      if ( x6 >= 1.5922055244445801e+01f ) {
+        sum += 1.5646913088858128e-03f;
+      } else {
+        sum += 6.0765347443521023e-03f;
+      }
+    }
+    // tree 154
+    if ( x3 >= 1.0994118452072144e+00f ) {
+      if ( x6 >= 2.6256834030151367e+01f ) {
+        sum += -1.7074113711714745e-03f;
+      } else {
+        sum += 2.3028918076306581e-03f;
+      }
+    } else {
+      if ( x3 >= 4.8201462626457214e-01f ) {
+        sum += 1.5188386896625161e-03f;
+      } else {
+        sum += -4.1399784386157990e-03f;
+      }
+    }
+    // tree 155
+    if ( x2 >= 7.9961258172988892e-01f ) {
+      if ( x4 >= 1.0151116371154785e+01f ) {
+        sum += -4.3730114703066647e-04f;
+      } else {
+        sum += -1.1140795424580574e-02f;
+      }
+    } else {
+      if ( x6 >= 1.1229667663574219e+01f ) {
+        sum += 1.2770944740623236e-03f;
+      } else {
+        sum += 7.2231739759445190e-03f;
+      }
+    }
+    // tree 156
+    if ( x4 >= 2.0905360412597656e+02f ) {
+      if ( x3 >= 6.6309112310409546e-01f ) {
+        sum += 7.2485296986997128e-03f;
+      } else {
+        sum += -1.3411649269983172e-03f;
+      }
+    } else {
+      if ( x6 >= 2.9647933959960938e+02f ) {
+        sum += -1.8165677785873413e-02f;
+      } else {
+        sum += -8.6403502791654319e-05f;
+      }
+    }
+    // tree 157
+    if ( x1 >= 8.0497512817382812e+00f ) {
+      if ( x5 >= 1.9312490224838257e+00f ) {
+        sum += 7.3468750342726707e-03f;
+      } else {
+        sum += 2.5716139003634453e-02f;
+      }
+    } else {
+      if ( x4 >= 4.3964538574218750e+01f ) {
+        sum += 5.0177675439044833e-04f;
+      } else {
+        sum += -1.9191125174984336e-03f;
+      }
+    }
+    // tree 158
+    if ( x0 >= 2.4006400108337402e+00f ) {
+      if ( x4 >= 1.2456653594970703e+02f ) {
+        sum += -1.9256738945841789e-02f;
+      } else {
+        sum += -7.7385781332850456e-03f;
+      }
+    } else {
+      if ( x6 >= 1.4034664916992188e+02f ) {
+        sum += 3.2375338487327099e-03f;
+      } else {
+        sum += -2.0517056691460311e-04f;
+      }
+    }
+    // tree 159
+    if ( x0 >= 5.0165414810180664e-01f ) {
+      if ( x5 >= 2.2735559940338135e+00f ) {
+        sum += -1.6412341501563787e-03f;
+      } else {
+        sum += 5.2987976232543588e-04f;
+      }
+    } else {
+      if ( x4 >= 9.7715820312500000e+01f ) {
+        sum += 6.6623445600271225e-03f;
+      } else {
+        sum += 1.5442662406712770e-03f;
+      }
+    }
+    // tree 160
+    if ( x3 >= 1.9109122753143311e+00f ) {
+      if ( x5 >= 1.7107319831848145e+00f ) {
+        sum += -5.1180319860577583e-03f;
+      } else {
+        sum += 8.1890216097235680e-03f;
+      }
+    } else {
+      if ( x2 >= 2.2658774852752686e+00f ) {
+        sum += -9.2480024322867393e-03f;
+      } else {
+        sum += 5.5335584329441190e-04f;
+      }
+    }
+    // tree 161
+    if ( x2 >= 4.8258227109909058e-01f ) {
+      if ( x4 >= 1.1358041381835938e+02f ) {
+        sum += 1.7257690196856856e-03f;
+      } else {
+        sum += -7.0537632564082742e-04f;
+      }
+    } else {
+      if ( x5 >= 2.6528694629669189e+00f ) {
+        sum += -1.4485293999314308e-02f;
+      } else {
+        sum += 6.3544879667460918e-03f;
+      }
+    }
+    // tree 162
+    if ( x1 >= 4.0547266006469727e+00f ) {
+      if ( x2 >= 1.7754051685333252e+00f ) {
+        sum += -4.2089452035725117e-03f;
+      } else {
+        sum += 1.2374012731015682e-03f;
+      }
+    } else {
+      if ( x5 >= 1.7005341053009033e+00f ) {
+        sum += -1.5259787905961275e-03f;
+      } else {
+        sum += 4.0665585547685623e-03f;
+      }
+    }
+    // tree 163
+    if ( x3 >= 2.7437679767608643e+00f ) {
+      if ( x4 >= 1.6254127502441406e+02f ) {
+        sum += 1.3539901934564114e-02f;
+      } else {
+        sum += -1.7168298363685608e-02f;
+      }
+    } else {
+      if ( x3 >= 4.7605285048484802e-01f ) {
+        sum += 3.3697771141305566e-04f;
+      } else {
+        sum += -4.2456090450286865e-03f;
+      }
+    }
+    // tree 164
+    if ( x6 >= 8.4208023071289062e+01f ) {
+      if ( x6 >= 2.9720123291015625e+02f ) {
+        sum += -9.4767957925796509e-03f;
+      } else {
+        sum += 1.4842686941847205e-03f;
+      }
+    } else {
+      if ( x6 >= 5.3624919891357422e+01f ) {
+        sum += -2.8923873323947191e-03f;
+      } else {
+        sum += 9.5884728943929076e-04f;
+      }
+    }
+    // tree 165
+    if ( x1 >= 7.0099501609802246e+00f ) {
+      if ( x0 >= 1.9539028406143188e+00f ) {
+        sum += -2.4728446733206511e-03f;
+      } else {
+        sum += 6.3584139570593834e-03f;
+      }
+    } else {
+      if ( x5 >= 2.1143832206726074e+00f ) {
+        sum += -1.0448192479088902e-03f;
+      } else {
+        sum += 9.7467034356668591e-04f;
+      }
+    }
+    // tree 166
+    if ( x5 >= 1.2548503875732422e+00f ) {
+      if ( x3 >= 1.9109122753143311e+00f ) {
+        sum += -3.6473560612648726e-03f;
+      } else {
+        sum += 2.8239146922715008e-04f;
+      }
+    } else {
+      if ( x0 >= 1.2279150485992432e+00f ) {
+        sum += 1.9988361746072769e-02f;
+      } else {
+        sum += 1.6699811676517129e-03f;
+      }
+    }
+    // tree 167
+    if ( x0 >= 2.4006400108337402e+00f ) {
+      if ( x2 >= 1.1747320890426636e+00f ) {
+        sum += -1.6378223896026611e-02f;
+      } else {
+        sum += -2.3654066026210785e-03f;
+      }
+    } else {
+      if ( x4 >= 1.0151116371154785e+01f ) {
+        sum += 2.5989711866714060e-04f;
+      } else {
+        sum += -7.1066110394895077e-03f;
+      }
+    }
+    // tree 168
+    if ( x5 >= 2.8465778827667236e+00f ) {
+      if ( x0 >= 1.1765391826629639e+00f ) {
+        sum += -8.1376470625400543e-03f;
+      } else {
+        sum += -2.3627131304237992e-04f;
+      }
+    } else {
+      if ( x2 >= 2.5234646797180176e+00f ) {
+        sum += -8.9764706790447235e-03f;
+      } else {
+        sum += 2.9351335251703858e-04f;
+      }
+    }
+    // tree 169
+    if ( x2 >= 5.8165425062179565e-01f ) {
+      if ( x4 >= 1.3943772888183594e+02f ) {
+        sum += 2.2886386141180992e-03f;
+      } else {
+        sum += -6.7597802262753248e-04f;
+      }
+    } else {
+      if ( x5 >= 1.7906570434570312e+00f ) {
+        sum += 2.2036621812731028e-03f;
+      } else {
+        sum += 1.3400579802691936e-02f;
+      }
+    }
+    // tree 170
+    if ( x0 >= 5.0165414810180664e-01f ) {
+      if ( x1 >= 8.0497512817382812e+00f ) {
+        sum += 7.8342566266655922e-03f;
+      } else {
+        sum += -3.8832664722576737e-04f;
+      }
+    } else {
+      if ( x4 >= 9.7715820312500000e+01f ) {
+        sum += 5.9895203448832035e-03f;
+      } else {
+        sum += 1.4144087908789515e-03f;
+      }
+    }
+    // tree 171
+    if ( x6 >= 1.4034664916992188e+02f ) {
+      if ( x6 >= 2.9764855957031250e+02f ) {
+        sum += -8.9861843734979630e-03f;
+      } else {
+        sum += 3.7238821387290955e-03f;
+      }
+    } else {
+      if ( x6 >= 2.6533113479614258e+01f ) {
+        sum += -8.1309641245752573e-04f;
+      } else {
+        sum += 2.1279454231262207e-03f;
+      }
+    }
+    // tree 172
+    if ( x3 >= 1.0994118452072144e+00f ) {
+      if ( x4 >= 2.5283532714843750e+02f ) {
+        sum += 8.9487498626112938e-03f;
+      } else {
+        sum += -1.0822651674970984e-03f;
+      }
+    } else {
+      if ( x3 >= 4.8201462626457214e-01f ) {
+        sum += 1.2996827717870474e-03f;
+      } else {
+        sum += -3.6465618759393692e-03f;
+      }
+    }
+    // tree 173
+    if ( x5 >= 1.8915413618087769e+00f ) {
+      if ( x2 >= 2.2489697933197021e+00f ) {
+        sum += -9.1526648029685020e-03f;
+      } else {
+        sum += -1.5771832840982825e-04f;
+      }
+    } else {
+      if ( x5 >= 1.2441583871841431e+00f ) {
+        sum += 1.7441833624616265e-03f;
+      } else {
+        sum += 1.1342405341565609e-02f;
+      }
+    }
+    // tree 174
+    if ( x3 >= 2.7437679767608643e+00f ) {
+      if ( x2 >= 1.9452338218688965e+00f ) {
+        sum += 9.6546839922666550e-03f;
+      } else {
+        sum += -1.6922643408179283e-02f;
+      }
+    } else {
+      if ( x1 >= 4.0547266006469727e+00f ) {
+        sum += 8.3352293586358428e-04f;
+      } else {
+        sum += -9.0603705029934645e-04f;
+      }
+    }
+    // tree 175
+    if ( x6 >= 8.4208023071289062e+01f ) {
+      if ( x3 >= 7.2940593957901001e-01f ) {
+        sum += 2.8668734012171626e-04f;
+      } else {
+        sum += 3.7370172794908285e-03f;
+      }
+    } else {
+      if ( x6 >= 5.3624919891357422e+01f ) {
+        sum += -2.6159801054745913e-03f;
+      } else {
+        sum += 8.6363946320489049e-04f;
+      }
+    }
+    // tree 176
+    if ( x4 >= 8.1620912551879883e+00f ) {
+      if ( x6 >= 2.2455535888671875e+01f ) {
+        sum += -2.4120429588947445e-04f;
+      } else {
+        sum += 2.4253686424344778e-03f;
+      }
+    } else {
+      if ( x5 >= 2.3174407482147217e+00f ) {
+        sum += -2.5361866573803127e-04f;
+      } else {
+        sum += -1.2280035763978958e-02f;
+      }
+    }
+    // tree 177
+    if ( x2 >= 4.8258227109909058e-01f ) {
+      if ( x4 >= 6.3854789733886719e+01f ) {
+        sum += 6.3338398467749357e-04f;
+      } else {
+        sum += -1.1336114257574081e-03f;
+      }
+    } else {
+      if ( x5 >= 2.6528694629669189e+00f ) {
+        sum += -1.3491011224687099e-02f;
+      } else {
+        sum += 5.6160278618335724e-03f;
+      }
+    }
+    // tree 178
+    if ( x0 >= 2.1524066925048828e+00f ) {
+      if ( x5 >= 1.4060262441635132e+00f ) {
+        sum += -2.9105816502124071e-03f;
+      } else {
+        sum += 2.5168694555759430e-02f;
+      }
+    } else {
+      if ( x2 >= 1.4336731433868408e+00f ) {
+        sum += -1.3750129146501422e-03f;
+      } else {
+        sum += 8.2911842036992311e-04f;
+      }
+    }
+    // tree 179
+    if ( x6 >= 3.2560412597656250e+02f ) {
+      if ( x2 >= 1.0507118701934814e+00f ) {
+        sum += -2.7215536683797836e-02f;
+      } else {
+        sum += -3.4964794758707285e-03f;
+      }
+    } else {
+      if ( x6 >= 1.4082179260253906e+02f ) {
+        sum += 3.2435411121696234e-03f;
+      } else {
+        sum += -2.5276985252276063e-04f;
+      }
+    }
+    // tree 180
+    if ( x5 >= 2.8465778827667236e+00f ) {
+      if ( x0 >= 1.1765391826629639e+00f ) {
+        sum += -7.4354438111186028e-03f;
+      } else {
+        sum += -1.4425808330997825e-04f;
+      }
+    } else {
+      if ( x3 >= 4.8010897636413574e-01f ) {
+        sum += 3.6469867336563766e-04f;
+      } else {
+        sum += -3.4933367278426886e-03f;
+      }
+    }
+    // tree 181
+    if ( x0 >= 2.4006400108337402e+00f ) {
+      if ( x4 >= 1.2456653594970703e+02f ) {
+        sum += -1.7564738169312477e-02f;
+      } else {
+        sum += -5.9548756107687950e-03f;
+      }
+    } else {
+      if ( x4 >= 2.0905360412597656e+02f ) {
+        sum += 4.6621738001704216e-03f;
+      } else {
+        sum += -5.1751132559729740e-05f;
+      }
+    }
+    // tree 182
+    if ( x5 >= 1.9074586629867554e+00f ) {
+      if ( x6 >= 3.2372750854492188e+02f ) {
+        sum += -1.4149452559649944e-02f;
+      } else {
+        sum += -2.5189650477841496e-04f;
+      }
+    } else {
+      if ( x5 >= 1.2514451742172241e+00f ) {
+        sum += 1.5316411154344678e-03f;
+      } else {
+        sum += 1.0555776767432690e-02f;
+      }
+    }
+    // tree 183
+    if ( x1 >= 6.0248756408691406e+00f ) {
+      if ( x5 >= 2.4122805595397949e+00f ) {
+        sum += -1.8128602532669902e-03f;
+      } else {
+        sum += 3.6435788497328758e-03f;
+      }
+    } else {
+      if ( x4 >= 2.3888897705078125e+02f ) {
+        sum += 6.4363037236034870e-03f;
+      } else {
+        sum += -4.2435154318809509e-04f;
+      }
+    }
+    // tree 184
+    if ( x0 >= 5.0165414810180664e-01f ) {
+      if ( x2 >= 1.0770140886306763e+00f ) {
+        sum += -1.1342409998178482e-03f;
+      } else {
+        sum += 6.0822139494121075e-04f;
+      }
+    } else {
+      if ( x3 >= 1.1038167476654053e+00f ) {
+        sum += 3.6407119478099048e-04f;
+      } else {
+        sum += 3.8792665582150221e-03f;
+      }
+    }
+    // tree 185
+    if ( x3 >= 2.5515704154968262e+00f ) {
+      if ( x5 >= 1.4154008626937866e+00f ) {
+        sum += -9.7638582810759544e-03f;
+      } else {
+        sum += 2.0223313942551613e-02f;
+      }
+    } else {
+      if ( x2 >= 2.5234646797180176e+00f ) {
+        sum += -8.6139496415853500e-03f;
+      } else {
+        sum += 2.1659053163602948e-04f;
+      }
+    }
+    // tree 186
+    if ( x1 >= 8.0497512817382812e+00f ) {
+      if ( x4 >= 9.5131050109863281e+01f ) {
+        sum += 1.8925772747024894e-03f;
+      } else {
+        sum += 9.7851073369383812e-03f;
+      }
+    } else {
+      if ( x2 >= 5.2221107482910156e-01f ) {
+        sum += -2.8808892238885164e-04f;
+      } else {
+        sum += 3.1778486445546150e-03f;
+      }
+    }
+    // tree 187
+    if ( x4 >= 8.1620912551879883e+00f ) {
+      if ( x6 >= 2.2455535888671875e+01f ) {
+        sum += -2.3318637977354228e-04f;
+      } else {
+        sum += 2.2773516830056906e-03f;
+      }
+    } else {
+      if ( x5 >= 2.3174407482147217e+00f ) {
+        sum += -5.2961862820666283e-05f;
+      } else {
+        sum += -1.1305625550448895e-02f;
+      }
+    }
+    // tree 188
+    if ( x6 >= 8.4208023071289062e+01f ) {
+      if ( x2 >= 2.5281441211700439e+00f ) {
+        sum += -1.4547673054039478e-02f;
+      } else {
+        sum += 1.1338992044329643e-03f;
+      }
+    } else {
+      if ( x6 >= 5.3624919891357422e+01f ) {
+        sum += -2.3560884874314070e-03f;
+      } else {
+        sum += 7.6398579403758049e-04f;
+      }
+    }
+    // tree 189
+    if ( x5 >= 2.0347969532012939e+00f ) {
+      if ( x6 >= 3.2903451538085938e+02f ) {
+        sum += -1.5081050805747509e-02f;
+      } else {
+        sum += -4.1250017238780856e-04f;
+      }
+    } else {
+      if ( x3 >= 4.8010897636413574e-01f ) {
+        sum += 1.4907863223925233e-03f;
+      } else {
+        sum += -5.2325418218970299e-03f;
+      }
+    }
+    // tree 190
+    if ( x3 >= 1.2702541351318359e+00f ) {
+      if ( x0 >= 8.8976204395294189e-01f ) {
+        sum += -1.7369526904076338e-03f;
+      } else {
+        sum += 1.7122718272730708e-03f;
+      }
+    } else {
+      if ( x6 >= 3.4806024169921875e+02f ) {
+        sum += -1.6820710152387619e-02f;
+      } else {
+        sum += 6.6870782757177949e-04f;
+      }
+    }
+    // tree 191
+    if ( x0 >= 2.3758168220520020e+00f ) {
+      if ( x4 >= 1.0871424865722656e+02f ) {
+        sum += -1.1209207586944103e-02f;
+      } else {
+        sum += -3.9657168090343475e-03f;
+      }
+    } else {
+      if ( x4 >= 1.0151116371154785e+01f ) {
+        sum += 2.3128736938815564e-04f;
+      } else {
+        sum += -6.0189543291926384e-03f;
+      }
+    }
+    // tree 192
+    if ( x1 >= 4.0547266006469727e+00f ) {
+      if ( x5 >= 2.8004024028778076e+00f ) {
+        sum += -6.6532581113278866e-03f;
+      } else {
+        sum += 8.6325302254408598e-04f;
+      }
+    } else {
+      if ( x5 >= 1.7005341053009033e+00f ) {
+        sum += -1.1902260594069958e-03f;
+      } else {
+        sum += 3.2437751069664955e-03f;
+      }
+    }
+    // tree 193
+    if ( x3 >= 2.7437679767608643e+00f ) {
+      if ( x5 >= 1.7739413976669312e+00f ) {
+        sum += -1.5754206106066704e-02f;
+      } else {
+        sum += 8.2751689478754997e-03f;
+      }
+    } else {
+      if ( x3 >= 4.7605285048484802e-01f ) {
+        sum += 2.6534011703915894e-04f;
+      } else {
+        sum += -3.4965740051120520e-03f;
+      }
+    }
+    // tree 194
+    if ( x6 >= 1.4034664916992188e+02f ) {
+      if ( x2 >= 2.1055588722229004e+00f ) {
+        sum += -1.3047381304204464e-02f;
+      } else {
+        sum += 2.8258764650672674e-03f;
+      }
+    } else {
+      if ( x3 >= 5.2281951904296875e-01f ) {
+        sum += 2.9864007956348360e-05f;
+      } else {
+        sum += -3.3843799028545618e-03f;
+      }
+    }
+    // tree 195
+    if ( x3 >= 1.0353460311889648e+00f ) {
+      if ( x4 >= 1.6178642272949219e+01f ) {
+        sum += -4.2270880658179522e-04f;
+      } else {
+        sum += -7.1146013215184212e-03f;
+      }
+    } else {
+      if ( x3 >= 5.8401596546173096e-01f ) {
+        sum += 1.5277174534276128e-03f;
+      } else {
+        sum += -1.5176404267549515e-03f;
+      }
+    }
+    // tree 196
+    if ( x1 >= 8.0497512817382812e+00f ) {
+      if ( x3 >= 1.4697806835174561e+00f ) {
+        sum += 1.6804900020360947e-02f;
+      } else {
+        sum += 5.0866175442934036e-03f;
+      }
+    } else {
+      if ( x4 >= 2.3689996337890625e+02f ) {
+        sum += 5.1355282776057720e-03f;
+      } else {
+        sum += -1.9962515216320753e-04f;
+      }
+    }
+    // tree 197
+    if ( x5 >= 1.2548503875732422e+00f ) {
+      if ( x2 >= 2.1073625087738037e+00f ) {
+        sum += -4.0943357162177563e-03f;
+      } else {
+        sum += 1.2829383194912225e-04f;
+      }
+    } else {
+      if ( x0 >= 1.2279150485992432e+00f ) {
+        sum += 1.6563292592763901e-02f;
+      } else {
+        sum += -2.9282848117873073e-04f;
+      }
+    }
+    // tree 198
+    if ( x0 >= 7.9953432083129883e-01f ) {
+      if ( x5 >= 2.4486460685729980e+00f ) {
+        sum += -2.1999944001436234e-03f;
+      } else {
+        sum += 1.1992795771220699e-04f;
+      }
+    } else {
+      if ( x2 >= 2.1817581653594971e+00f ) {
+        sum += 1.1680629104375839e-02f;
+      } else {
+        sum += 1.1744129005819559e-03f;
+      }
+    }
+    // tree 199
+    if ( x2 >= 4.8258227109909058e-01f ) {
+      if ( x4 >= 4.3964538574218750e+01f ) {
+        sum += 3.1432378455065191e-04f;
+      } else {
+        sum += -1.4317578170448542e-03f;
+      }
+    } else {
+      if ( x5 >= 2.6528694629669189e+00f ) {
+        sum += -1.2483955360949039e-02f;
+      } else {
+        sum += 4.7990716993808746e-03f;
+      }
+    }
+    // CV: same transformation of the sum of responses as in TMVA::MethodBDT::GetGradBoostMVA
+    return 2./(1. + std::exp(-2.*sum)) - 1.;
+  }
+
+//--- BDT read from file = tthAnalysis/HiggsToTauTau/data/3l_ttV_BDTG.weights.xml
+  const char* inputVariables_3l_ttV_BDTG[] = {
+    "max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))",
+    "MT_met_lep1",
+    "nJet25_Recl",
+    "mindr_lep1_jet",
+    "mindr_lep2_jet",
+    "LepGood_conePt[iF_Recl[0]]",
+    "LepGood_conePt[iF_Recl[2]]"
+  };
+
+  double compiledBDT_3l_ttV_BDTG(const Float_t* mvaInputs, const int* mvaInputIndices)
+  {
+    const Float_t x0 = mvaInputs[mvaInputIndices[0]];
+    const Float_t x1 = mvaInputs[mvaInputIndices[1]];
+    const Float_t x2 = mvaInputs[mvaInputIndices[2]];
+    const Float_t x3 = mvaInputs[mvaInputIndices[3]];
+    const Float_t x4 = mvaInputs[mvaInputIndices[4]];
+    const Float_t x5 = mvaInputs[mvaInputIndices[5]];
+    const Float_t x6 = mvaInputs[mvaInputIndices[6]];
+    if ( TMath::IsNaN(x0) || TMath::IsNaN(x1) || TMath::IsNaN(x2) || TMath::IsNaN(x3) || TMath::IsNaN(x4) || TMath::IsNaN(x5) || TMath::IsNaN(x6) ) return -999.;
+    double sum = 0.;
+    // tree 0
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x5 >= 1.0261827087402344e+02f ) {
+        sum += -3.5672779195010662e-03f;
+      } else {
+        sum += 1.2104088440537453e-02f;
+      }
+    } else {
+      if ( x5 >= 9.1156860351562500e+01f ) {
+        sum += -3.7871662527322769e-02f;
+      } else {
+        sum += -1.8645731732249260e-02f;
+      }
+    }
+    // tree 1
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 1.5874886885285378e-02f;
+      } else {
+        sum += 2.1233069710433483e-03f;
+      }
+    } else {
+      if ( x5 >= 9.1156860351562500e+01f ) {
+        sum += -3.4846615046262741e-02f;
+      } else {
+        sum += -1.7374856397509575e-02f;
+      }
+    }
+    // tree 2
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x5 >= 1.0812603759765625e+02f ) {
+        sum += 2.1766939607914537e-04f;
+      } else {
+        sum += 1.4622095972299576e-02f;
+      }
+    } else {
+      if ( x2 >= 2.0049750804901123e+00f ) {
+        sum += -2.0349067635834217e-03f;
+      } else {
+        sum += -2.2302636876702309e-02f;
+      }
+    }
+    // tree 3
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x5 >= 9.1602737426757812e+01f ) {
+        sum += 2.3468537256121635e-03f;
+      } else {
+        sum += 1.4811403118073940e-02f;
+      }
+    } else {
+      if ( x2 >= 2.0049750804901123e+00f ) {
+        sum += -1.9185889977961779e-03f;
+      } else {
+        sum += -2.0724905654788017e-02f;
+      }
+    }
+    // tree 4
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x5 >= 1.0261827087402344e+02f ) {
+        sum += 7.8863330418244004e-04f;
+      } else {
+        sum += 1.3612584210932255e-02f;
+      }
+    } else {
+      if ( x2 >= 2.0049750804901123e+00f ) {
+        sum += -1.8089379882439971e-03f;
+      } else {
+        sum += -1.9272789359092712e-02f;
+      }
+    }
+    // tree 5
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x5 >= 1.0812603759765625e+02f ) {
+        sum += 3.0734594474779442e-05f;
+      } else {
+        sum += 1.2802209705114365e-02f;
+      }
+    } else {
+      if ( x2 >= 2.0049750804901123e+00f ) {
+        sum += -1.7055694479495287e-03f;
+      } else {
+        sum += -1.7932280898094177e-02f;
+      }
+    }
+    // tree 6
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x5 >= 9.1602737426757812e+01f ) {
+        sum += 1.8916326807811856e-03f;
+      } else {
+        sum += 1.3010745868086815e-02f;
+      }
+    } else {
+      if ( x5 >= 9.1156860351562500e+01f ) {
+        sum += -1.8433179706335068e-02f;
+      } else {
+        sum += -2.8391992673277855e-03f;
+      }
+    }
+    // tree 7
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x2 >= 5.0447759628295898e+00f ) {
+        sum += 1.7788007855415344e-02f;
+      } else {
+        sum += 5.7572852820158005e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0049750804901123e+00f ) {
+        sum += -1.0705485474318266e-03f;
+      } else {
+        sum += -1.6044881194829941e-02f;
+      }
+    }
+    // tree 8
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x2 >= 6.0298509597778320e+00f ) {
+        sum += 2.2150518372654915e-02f;
+      } else {
+        sum += 1.0603040456771851e-02f;
+      }
+    } else {
+      if ( x5 >= 1.2164292144775391e+02f ) {
+        sum += -1.8410649150609970e-02f;
+      } else {
+        sum += 1.0688580914575141e-05f;
+      }
+    }
+    // tree 9
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x5 >= 9.1602737426757812e+01f ) {
+        sum += 1.3095049653202295e-03f;
+      } else {
+        sum += 1.1841041035950184e-02f;
+      }
+    } else {
+      if ( x5 >= 7.5910789489746094e+01f ) {
+        sum += -1.3796537183225155e-02f;
+      } else {
+        sum += -6.0854939511045814e-04f;
+      }
+    }
+    // tree 10
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x2 >= 6.0298509597778320e+00f ) {
+        sum += 2.1123252809047699e-02f;
+      } else {
+        sum += 9.7930636256933212e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0149254798889160e+00f ) {
+        sum += 1.3969406718388200e-03f;
+      } else {
+        sum += -1.4095149002969265e-02f;
+      }
+    }
+    // tree 11
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x2 >= 6.0298509597778320e+00f ) {
+        sum += 2.0404580980539322e-02f;
+      } else {
+        sum += 9.3550859019160271e-03f;
+      }
+    } else {
+      if ( x5 >= 1.2164292144775391e+02f ) {
+        sum += -1.6232971101999283e-02f;
+      } else {
+        sum += 3.2594954245723784e-04f;
+      }
+    }
+    // tree 12
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x5 >= 7.5079437255859375e+01f ) {
+        sum += -3.9265610394068062e-04f;
+      } else {
+        sum += 1.0149856097996235e-02f;
+      }
+    } else {
+      if ( x0 >= 1.0701751708984375e+00f ) {
+        sum += -1.8648456782102585e-02f;
+      } else {
+        sum += -5.4565365426242352e-03f;
+      }
+    }
+    // tree 13
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x2 >= 6.0298509597778320e+00f ) {
+        sum += 1.9580474123358727e-02f;
+      } else {
+        sum += 8.7431501597166061e-03f;
+      }
+    } else {
+      if ( x5 >= 7.5904403686523438e+01f ) {
+        sum += -8.5448184981942177e-03f;
+      } else {
+        sum += 3.0230460688471794e-03f;
+      }
+    }
+    // tree 14
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x5 >= 1.0812603759765625e+02f ) {
+        sum += -8.9263514382764697e-04f;
+      } else {
+        sum += 9.6719535067677498e-03f;
+      }
+    } else {
+      if ( x0 >= 1.1448020935058594e+00f ) {
+        sum += -1.1237110942602158e-02f;
+      } else {
+        sum += 6.9765890657436103e-05f;
+      }
+    }
+    // tree 15
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x5 >= 1.1914157104492188e+02f ) {
+        sum += -5.0426521338522434e-03f;
+      } else {
+        sum += 7.1795964613556862e-03f;
+      }
+    } else {
+      if ( x2 >= 1.0049750804901123e+00f ) {
+        sum += -8.3401752635836601e-03f;
+      } else {
+        sum += -2.3626156151294708e-02f;
+      }
+    }
+    // tree 16
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x2 >= 6.0298509597778320e+00f ) {
+        sum += 1.8629435449838638e-02f;
+      } else {
+        sum += 7.9012652859091759e-03f;
+      }
+    } else {
+      if ( x5 >= 1.5213526916503906e+02f ) {
+        sum += -1.9024409353733063e-02f;
+      } else {
+        sum += -1.6179264639504254e-04f;
+      }
+    }
+    // tree 17
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x2 >= 6.0298509597778320e+00f ) {
+        sum += 1.8033131957054138e-02f;
+      } else {
+        sum += 7.5497189536690712e-03f;
+      }
+    } else {
+      if ( x0 >= 1.2069727182388306e+00f ) {
+        sum += -7.9096471890807152e-03f;
+      } else {
+        sum += 2.6733190752565861e-03f;
+      }
+    }
+    // tree 18
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x5 >= 7.5079437255859375e+01f ) {
+        sum += -3.8501928793266416e-04f;
+      } else {
+        sum += 8.7855057790875435e-03f;
+      }
+    } else {
+      if ( x0 >= 1.0701751708984375e+00f ) {
+        sum += -1.4895414933562279e-02f;
+      } else {
+        sum += -4.0856185369193554e-03f;
+      }
+    }
+    // tree 19
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x2 >= 6.0298509597778320e+00f ) {
+        sum += 1.7348945140838623e-02f;
+      } else {
+        sum += 7.0485621690750122e-03f;
+      }
+    } else {
+      if ( x6 >= 3.2469848632812500e+01f ) {
+        sum += -1.0952072218060493e-02f;
+      } else {
+        sum += 1.0640951804816723e-03f;
+      }
+    }
+    // tree 20
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x6 >= 2.7225776672363281e+01f ) {
+        sum += -8.4876903565600514e-04f;
+      } else {
+        sum += 8.6632231250405312e-03f;
+      }
+    } else {
+      if ( x1 >= 1.5942062377929688e+02f ) {
+        sum += -1.2896298430860043e-02f;
+      } else {
+        sum += -7.6945999171584845e-04f;
+      }
+    }
+    // tree 21
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x0 >= 1.4201871156692505e+00f ) {
+        sum += -2.8958560433238745e-03f;
+      } else {
+        sum += 6.9262008182704449e-03f;
+      }
+    } else {
+      if ( x2 >= 1.0049750804901123e+00f ) {
+        sum += -6.2089352868497372e-03f;
+      } else {
+        sum += -2.0098490640521049e-02f;
+      }
+    }
+    // tree 22
+    if ( x2 >= 5.0099501609802246e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 2.0477935671806335e-02f;
+      } else {
+        sum += 1.1008142493665218e-02f;
+      }
+    } else {
+      if ( x5 >= 6.4063903808593750e+01f ) {
+        sum += -4.2508598417043686e-03f;
+      } else {
+        sum += 5.4244315251708031e-03f;
+      }
+    }
+    // tree 23
+    if ( x1 >= 1.6353146362304688e+02f ) {
+      if ( x3 >= 1.3697226047515869e+00f ) {
+        sum += -2.1331703290343285e-02f;
+      } else {
+        sum += -2.6506832800805569e-03f;
+      }
+    } else {
+      if ( x0 >= 1.4182999134063721e+00f ) {
+        sum += -2.7013674844056368e-03f;
+      } else {
+        sum += 6.8419366143643856e-03f;
+      }
+    }
+    // tree 24
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x2 >= 6.0298509597778320e+00f ) {
+        sum += 1.5998337417840958e-02f;
+      } else {
+        sum += 6.1271660961210728e-03f;
+      }
+    } else {
+      if ( x5 >= 1.6229939270019531e+02f ) {
+        sum += -1.7769457772374153e-02f;
+      } else {
+        sum += 1.2671320291701704e-04f;
+      }
+    }
+    // tree 25
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x0 >= 1.5194616317749023e+00f ) {
+        sum += -3.4100078046321869e-03f;
+      } else {
+        sum += 6.1200372874736786e-03f;
+      }
+    } else {
+      if ( x0 >= 1.0701751708984375e+00f ) {
+        sum += -1.2252517044544220e-02f;
+      } else {
+        sum += -2.5090675335377455e-03f;
+      }
+    }
+    // tree 26
+    if ( x6 >= 2.8384429931640625e+01f ) {
+      if ( x0 >= 1.1103168725967407e+00f ) {
+        sum += -1.1865572072565556e-02f;
+      } else {
+        sum += 8.7842905486468226e-05f;
+      }
+    } else {
+      if ( x2 >= 3.0049750804901123e+00f ) {
+        sum += 7.5178281404078007e-03f;
+      } else {
+        sum += -2.8544661472551525e-04f;
+      }
+    }
+    // tree 27
+    if ( x2 >= 5.0099501609802246e+00f ) {
+      if ( x3 >= 1.3524535894393921e+00f ) {
+        sum += 3.3906584139913321e-03f;
+      } else {
+        sum += 1.2947085313498974e-02f;
+      }
+    } else {
+      if ( x5 >= 6.4063903808593750e+01f ) {
+        sum += -3.7372908554971218e-03f;
+      } else {
+        sum += 4.9317325465381145e-03f;
+      }
+    }
+    // tree 28
+    if ( x1 >= 1.7988426208496094e+02f ) {
+      if ( x3 >= 1.3267364501953125e+00f ) {
+        sum += -2.1378921344876289e-02f;
+      } else {
+        sum += -3.1160998623818159e-03f;
+      }
+    } else {
+      if ( x0 >= 1.1075246334075928e+00f ) {
+        sum += -8.2875438965857029e-04f;
+      } else {
+        sum += 7.1244291029870510e-03f;
+      }
+    }
+    // tree 29
+    if ( x2 >= 5.0099501609802246e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 1.8880633637309074e-02f;
+      } else {
+        sum += 9.4103030860424042e-03f;
+      }
+    } else {
+      if ( x6 >= 3.2469848632812500e+01f ) {
+        sum += -7.9758567735552788e-03f;
+      } else {
+        sum += 2.0945086143910885e-03f;
+      }
+    }
+    // tree 30
+    if ( x3 >= 1.5870760679244995e+00f ) {
+      if ( x1 >= 1.1160284423828125e+02f ) {
+        sum += -1.5112744644284248e-02f;
+      } else {
+        sum += -4.0009067743085325e-04f;
+      }
+    } else {
+      if ( x1 >= 1.5535505676269531e+02f ) {
+        sum += -2.6585105806589127e-03f;
+      } else {
+        sum += 5.9408359229564667e-03f;
+      }
+    }
+    // tree 31
+    if ( x0 >= 1.7415062189102173e+00f ) {
+      if ( x6 >= 4.1327808380126953e+01f ) {
+        sum += -2.7580546215176582e-02f;
+      } else {
+        sum += -5.4404684342443943e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 4.9624470993876457e-03f;
+      } else {
+        sum += -4.5558796264231205e-03f;
+      }
+    }
+    // tree 32
+    if ( x2 >= 5.0099501609802246e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 1.8236277624964714e-02f;
+      } else {
+        sum += 8.8235270231962204e-03f;
+      }
+    } else {
+      if ( x0 >= 1.1199556589126587e+00f ) {
+        sum += -4.2339521460235119e-03f;
+      } else {
+        sum += 3.6720733623951674e-03f;
+      }
+    }
+    // tree 33
+    if ( x6 >= 2.6341720581054688e+01f ) {
+      if ( x0 >= 1.3956496715545654e+00f ) {
+        sum += -1.1653087101876736e-02f;
+      } else {
+        sum += -7.4026628863066435e-04f;
+      }
+    } else {
+      if ( x2 >= 3.0049750804901123e+00f ) {
+        sum += 6.8432358093559742e-03f;
+      } else {
+        sum += -1.3080685675959103e-05f;
+      }
+    }
+    // tree 34
+    if ( x5 >= 2.0726583862304688e+02f ) {
+      if ( x3 >= 1.3143812417984009e+00f ) {
+        sum += -3.3622812479734421e-02f;
+      } else {
+        sum += -1.0056503117084503e-02f;
+      }
+    } else {
+      if ( x0 >= 1.2069727182388306e+00f ) {
+        sum += -2.2119923960417509e-03f;
+      } else {
+        sum += 5.1827831193804741e-03f;
+      }
+    }
+    // tree 35
+    if ( x3 >= 1.4672425985336304e+00f ) {
+      if ( x1 >= 1.1159842681884766e+02f ) {
+        sum += -1.1933697387576103e-02f;
+      } else {
+        sum += 1.3928236148785800e-04f;
+      }
+    } else {
+      if ( x1 >= 1.7988426208496094e+02f ) {
+        sum += -3.5776433069258928e-03f;
+      } else {
+        sum += 5.3759096190333366e-03f;
+      }
+    }
+    // tree 36
+    if ( x2 >= 5.0099501609802246e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 1.7586128786206245e-02f;
+      } else {
+        sum += 8.2408273592591286e-03f;
+      }
+    } else {
+      if ( x5 >= 1.5218817138671875e+02f ) {
+        sum += -1.1717210523784161e-02f;
+      } else {
+        sum += 1.2112553231418133e-03f;
+      }
+    }
+    // tree 37
+    if ( x0 >= 1.7415062189102173e+00f ) {
+      if ( x5 >= 4.7906757354736328e+01f ) {
+        sum += -9.7676701843738556e-03f;
+      } else {
+        sum += 1.9914032891392708e-03f;
+      }
+    } else {
+      if ( x6 >= 2.8384429931640625e+01f ) {
+        sum += -2.3299301974475384e-03f;
+      } else {
+        sum += 5.0208084285259247e-03f;
+      }
+    }
+    // tree 38
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x5 >= 9.1611160278320312e+01f ) {
+        sum += 1.5169193502515554e-03f;
+      } else {
+        sum += 8.7791942059993744e-03f;
+      }
+    } else {
+      if ( x5 >= 1.6229939270019531e+02f ) {
+        sum += -1.3177884742617607e-02f;
+      } else {
+        sum += 1.5352989430539310e-04f;
+      }
+    }
+    // tree 39
+    if ( x3 >= 1.4672425985336304e+00f ) {
+      if ( x1 >= 1.2753983306884766e+02f ) {
+        sum += -1.2521471828222275e-02f;
+      } else {
+        sum += -5.0088058924302459e-04f;
+      }
+    } else {
+      if ( x2 >= 5.0099501609802246e+00f ) {
+        sum += 1.0166547261178493e-02f;
+      } else {
+        sum += 2.0614780951291323e-03f;
+      }
+    }
+    // tree 40
+    if ( x0 >= 1.7415062189102173e+00f ) {
+      if ( x5 >= 6.1854713439941406e+01f ) {
+        sum += -1.0624808259308338e-02f;
+      } else {
+        sum += -3.9779869257472456e-04f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 4.2054275982081890e-03f;
+      } else {
+        sum += -3.9786202833056450e-03f;
+      }
+    }
+    // tree 41
+    if ( x6 >= 2.6341720581054688e+01f ) {
+      if ( x0 >= 1.1103168725967407e+00f ) {
+        sum += -7.9464055597782135e-03f;
+      } else {
+        sum += 4.3724066927097738e-04f;
+      }
+    } else {
+      if ( x2 >= 3.0049750804901123e+00f ) {
+        sum += 5.9272223152220249e-03f;
+      } else {
+        sum += 5.8420617278898135e-05f;
+      }
+    }
+    // tree 42
+    if ( x5 >= 6.4063903808593750e+01f ) {
+      if ( x3 >= 1.1437093019485474e+00f ) {
+        sum += -5.2719730883836746e-03f;
+      } else {
+        sum += 2.2208425216376781e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0447762012481689e+00f ) {
+        sum += 6.5587139688432217e-03f;
+      } else {
+        sum += -2.0906133577227592e-03f;
+      }
+    }
+    // tree 43
+    if ( x1 >= 1.8806065368652344e+02f ) {
+      if ( x5 >= 2.2466690063476562e+02f ) {
+        sum += -2.3582274094223976e-02f;
+      } else {
+        sum += -4.4413306750357151e-03f;
+      }
+    } else {
+      if ( x0 >= 1.0702315568923950e+00f ) {
+        sum += -5.6687300093472004e-04f;
+      } else {
+        sum += 5.4913349449634552e-03f;
+      }
+    }
+    // tree 44
+    if ( x2 >= 5.0099501609802246e+00f ) {
+      if ( x2 >= 6.0398011207580566e+00f ) {
+        sum += 1.2716127559542656e-02f;
+      } else {
+        sum += 5.7004648260772228e-03f;
+      }
+    } else {
+      if ( x6 >= 3.2469848632812500e+01f ) {
+        sum += -5.9678880497813225e-03f;
+      } else {
+        sum += 1.6238171374425292e-03f;
+      }
+    }
+    // tree 45
+    if ( x0 >= 1.8160922527313232e+00f ) {
+      if ( x6 >= 4.2580825805664062e+01f ) {
+        sum += -2.4450652301311493e-02f;
+      } else {
+        sum += -4.7415550798177719e-03f;
+      }
+    } else {
+      if ( x5 >= 2.0726583862304688e+02f ) {
+        sum += -1.2934291735291481e-02f;
+      } else {
+        sum += 2.9301389586180449e-03f;
+      }
+    }
+    // tree 46
+    if ( x3 >= 1.5870760679244995e+00f ) {
+      if ( x1 >= 1.1160284423828125e+02f ) {
+        sum += -1.0982276871800423e-02f;
+      } else {
+        sum += -3.4082602360285819e-04f;
+      }
+    } else {
+      if ( x2 >= 5.0099501609802246e+00f ) {
+        sum += 9.1026062145829201e-03f;
+      } else {
+        sum += 1.5755406348034739e-03f;
+      }
+    }
+    // tree 47
+    if ( x0 >= 1.0702315568923950e+00f ) {
+      if ( x5 >= 6.0664718627929688e+01f ) {
+        sum += -4.5574563555419445e-03f;
+      } else {
+        sum += 2.4171294644474983e-03f;
+      }
+    } else {
+      if ( x5 >= 1.5769593811035156e+02f ) {
+        sum += -5.3538121283054352e-03f;
+      } else {
+        sum += 5.0085722468793392e-03f;
+      }
+    }
+    // tree 48
+    if ( x2 >= 5.0099501609802246e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 1.6036912798881531e-02f;
+      } else {
+        sum += 6.4501934684813023e-03f;
+      }
+    } else {
+      if ( x0 >= 1.1199556589126587e+00f ) {
+        sum += -3.0215939041227102e-03f;
+      } else {
+        sum += 2.6548861060291529e-03f;
+      }
+    }
+    // tree 49
+    if ( x1 >= 1.2264945983886719e+02f ) {
+      if ( x3 >= 1.3745877742767334e+00f ) {
+        sum += -9.5534706488251686e-03f;
+      } else {
+        sum += 2.0990983466617763e-04f;
+      }
+    } else {
+      if ( x2 >= 2.0149254798889160e+00f ) {
+        sum += 4.2005386203527451e-03f;
+      } else {
+        sum += -2.6776697486639023e-03f;
+      }
+    }
+    // tree 50
+    if ( x6 >= 2.6341720581054688e+01f ) {
+      if ( x3 >= 1.3915476799011230e+00f ) {
+        sum += -7.8388424590229988e-03f;
+      } else {
+        sum += -1.5245664690155536e-04f;
+      }
+    } else {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 6.7742955870926380e-03f;
+      } else {
+        sum += 1.2387316673994064e-03f;
+      }
+    }
+    // tree 51
+    if ( x0 >= 1.8160922527313232e+00f ) {
+      if ( x6 >= 4.2580825805664062e+01f ) {
+        sum += -2.1767890080809593e-02f;
+      } else {
+        sum += -4.2420988902449608e-03f;
+      }
+    } else {
+      if ( x1 >= 2.6982702636718750e+02f ) {
+        sum += -1.1135958135128021e-02f;
+      } else {
+        sum += 2.6864637620747089e-03f;
+      }
+    }
+    // tree 52
+    if ( x5 >= 6.4063903808593750e+01f ) {
+      if ( x3 >= 1.1437093019485474e+00f ) {
+        sum += -4.4056149199604988e-03f;
+      } else {
+        sum += 1.8769841408357024e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0447762012481689e+00f ) {
+        sum += 5.5865366011857986e-03f;
+      } else {
+        sum += -2.1388502791523933e-03f;
+      }
+    }
+    // tree 53
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 1.5416209585964680e-02f;
+      } else {
+        sum += 9.2859687283635139e-03f;
+      }
+    } else {
+      if ( x5 >= 2.0726583862304688e+02f ) {
+        sum += -1.4290426857769489e-02f;
+      } else {
+        sum += 8.4205140592530370e-04f;
+      }
+    }
+    // tree 54
+    if ( x0 >= 1.6171960830688477e+00f ) {
+      if ( x4 >= 2.1531357765197754e+00f ) {
+        sum += -1.3831104151904583e-02f;
+      } else {
+        sum += -2.4644259829074144e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 3.5302550531923771e-03f;
+      } else {
+        sum += -3.0705670360475779e-03f;
+      }
+    }
+    // tree 55
+    if ( x6 >= 4.0640686035156250e+01f ) {
+      if ( x3 >= 9.9122124910354614e-01f ) {
+        sum += -9.3070277944207191e-03f;
+      } else {
+        sum += -1.2930375523865223e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 3.1100190244615078e-03f;
+      } else {
+        sum += -3.3180576283484697e-03f;
+      }
+    }
+    // tree 56
+    if ( x1 >= 1.8806065368652344e+02f ) {
+      if ( x5 >= 3.1820794677734375e+02f ) {
+        sum += -3.5962536931037903e-02f;
+      } else {
+        sum += -4.4358610175549984e-03f;
+      }
+    } else {
+      if ( x0 >= 2.0895745754241943e+00f ) {
+        sum += -7.9979524016380310e-03f;
+      } else {
+        sum += 2.5528324767947197e-03f;
+      }
+    }
+    // tree 57
+    if ( x2 >= 5.0099501609802246e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 1.4928017742931843e-02f;
+      } else {
+        sum += 5.5990577675402164e-03f;
+      }
+    } else {
+      if ( x5 >= 4.7540603637695312e+01f ) {
+        sum += -1.3839378952980042e-03f;
+      } else {
+        sum += 4.5007490552961826e-03f;
+      }
+    }
+    // tree 58
+    if ( x0 >= 1.0702315568923950e+00f ) {
+      if ( x5 >= 8.0992813110351562e+01f ) {
+        sum += -5.1339585334062576e-03f;
+      } else {
+        sum += 8.8139722356572747e-04f;
+      }
+    } else {
+      if ( x5 >= 1.7972700500488281e+02f ) {
+        sum += -6.3990107737481594e-03f;
+      } else {
+        sum += 4.0363143198192120e-03f;
+      }
+    }
+    // tree 59
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 8.0099506378173828e+00f ) {
+        sum += 1.8448285758495331e-02f;
+      } else {
+        sum += 9.7366115078330040e-03f;
+      }
+    } else {
+      if ( x6 >= 2.8384429931640625e+01f ) {
+        sum += -3.4158148337155581e-03f;
+      } else {
+        sum += 1.7887512221932411e-03f;
+      }
+    }
+    // tree 60
+    if ( x3 >= 1.3234425783157349e+00f ) {
+      if ( x5 >= 1.2465545654296875e+02f ) {
+        sum += -1.0621592402458191e-02f;
+      } else {
+        sum += -4.6994857257232070e-04f;
+      }
+    } else {
+      if ( x4 >= 1.6387826204299927e+00f ) {
+        sum += -3.8082064129412174e-03f;
+      } else {
+        sum += 4.0484438650310040e-03f;
+      }
+    }
+    // tree 61
+    if ( x0 >= 9.0862846374511719e-01f ) {
+      if ( x6 >= 3.1419643402099609e+01f ) {
+        sum += -6.4199310727417469e-03f;
+      } else {
+        sum += 4.8733048606663942e-04f;
+      }
+    } else {
+      if ( x5 >= 1.5313276672363281e+02f ) {
+        sum += -3.6607596557587385e-03f;
+      } else {
+        sum += 4.6187527477741241e-03f;
+      }
+    }
+    // tree 62
+    if ( x0 >= 1.9404023885726929e+00f ) {
+      if ( x6 >= 1.9820672988891602e+01f ) {
+        sum += -9.9895363673567772e-03f;
+      } else {
+        sum += -2.0471452735364437e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 4.9263108521699905e-03f;
+      } else {
+        sum += 1.4254136476665735e-04f;
+      }
+    }
+    // tree 63
+    if ( x1 >= 1.2264945983886719e+02f ) {
+      if ( x3 >= 1.2882261276245117e+00f ) {
+        sum += -6.9725397042930126e-03f;
+      } else {
+        sum += 3.4019956365227699e-04f;
+      }
+    } else {
+      if ( x2 >= 6.0149254798889160e+00f ) {
+        sum += 1.1545101180672646e-02f;
+      } else {
+        sum += 1.8710864242166281e-03f;
+      }
+    }
+    // tree 64
+    if ( x3 >= 1.6589760780334473e+00f ) {
+      if ( x1 >= 4.7837394714355469e+01f ) {
+        sum += -5.2911685779690742e-03f;
+      } else {
+        sum += 1.8341458635404706e-03f;
+      }
+    } else {
+      if ( x4 >= 1.6387826204299927e+00f ) {
+        sum += -3.2584483269602060e-03f;
+      } else {
+        sum += 3.1765624880790710e-03f;
+      }
+    }
+    // tree 65
+    if ( x0 >= 8.0918037891387939e-01f ) {
+      if ( x6 >= 2.1142465591430664e+01f ) {
+        sum += -3.3605503849685192e-03f;
+      } else {
+        sum += 1.7046307912096381e-03f;
+      }
+    } else {
+      if ( x5 >= 1.5313276672363281e+02f ) {
+        sum += -3.3472576178610325e-03f;
+      } else {
+        sum += 4.7465772368013859e-03f;
+      }
+    }
+    // tree 66
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 1.3862960040569305e-02f;
+      } else {
+        sum += 7.7550755813717842e-03f;
+      }
+    } else {
+      if ( x5 >= 5.8556137084960938e+01f ) {
+        sum += -1.3142743846401572e-03f;
+      } else {
+        sum += 3.0670952983200550e-03f;
+      }
+    }
+    // tree 67
+    if ( x0 >= 2.1144363880157471e+00f ) {
+      if ( x3 >= 1.8255927562713623e+00f ) {
+        sum += -1.7111418768763542e-02f;
+      } else {
+        sum += -5.3764274343848228e-03f;
+      }
+    } else {
+      if ( x5 >= 2.2378913879394531e+02f ) {
+        sum += -1.2193844653666019e-02f;
+      } else {
+        sum += 1.5930917579680681e-03f;
+      }
+    }
+    // tree 68
+    if ( x2 >= 5.0099501609802246e+00f ) {
+      if ( x3 >= 1.2471089363098145e+00f ) {
+        sum += 6.2364723999053240e-04f;
+      } else {
+        sum += 7.6334774494171143e-03f;
+      }
+    } else {
+      if ( x0 >= 1.1199556589126587e+00f ) {
+        sum += -2.2833272814750671e-03f;
+      } else {
+        sum += 1.9184089032933116e-03f;
+      }
+    }
+    // tree 69
+    if ( x6 >= 1.8170883178710938e+01f ) {
+      if ( x0 >= 6.1358135938644409e-01f ) {
+        sum += -2.1752764005213976e-03f;
+      } else {
+        sum += 3.4151896834373474e-03f;
+      }
+    } else {
+      if ( x2 >= 1.0646766424179077e+00f ) {
+        sum += 3.6255521699786186e-03f;
+      } else {
+        sum += -1.0762582533061504e-02f;
+      }
+    }
+    // tree 70
+    if ( x1 >= 4.9061859130859375e+01f ) {
+      if ( x3 >= 1.2765625715255737e+00f ) {
+        sum += -3.3500262070447206e-03f;
+      } else {
+        sum += 1.4967411989346147e-03f;
+      }
+    } else {
+      if ( x3 >= 2.4978098869323730e+00f ) {
+        sum += -4.0723271667957306e-03f;
+      } else {
+        sum += 4.9079204909503460e-03f;
+      }
+    }
+    // tree 71
+    if ( x6 >= 4.8811519622802734e+01f ) {
+      if ( x4 >= 5.5399507284164429e-01f ) {
+        sum += -8.1057976931333542e-03f;
+      } else {
+        sum += 4.8066903837025166e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 2.2387399803847075e-03f;
+      } else {
+        sum += -2.8943913057446480e-03f;
+      }
+    }
+    // tree 72
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 8.0099506378173828e+00f ) {
+        sum += 1.7347354441881180e-02f;
+      } else {
+        sum += 8.2808928564190865e-03f;
+      }
+    } else {
+      if ( x5 >= 5.8556137084960938e+01f ) {
+        sum += -1.2312751496210694e-03f;
+      } else {
+        sum += 2.7982334140688181e-03f;
+      }
+    }
+    // tree 73
+    if ( x0 >= 1.6171960830688477e+00f ) {
+      if ( x4 >= 2.1531357765197754e+00f ) {
+        sum += -1.1197073385119438e-02f;
+      } else {
+        sum += -1.8607546808198094e-03f;
+      }
+    } else {
+      if ( x1 >= 2.2894705200195312e+02f ) {
+        sum += -5.3496635518968105e-03f;
+      } else {
+        sum += 2.3217785637825727e-03f;
+      }
+    }
+    // tree 74
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 1.2993951328098774e-02f;
+      } else {
+        sum += 6.8423212505877018e-03f;
+      }
+    } else {
+      if ( x6 >= 1.8170883178710938e+01f ) {
+        sum += -1.3348603388294578e-03f;
+      } else {
+        sum += 2.5505514349788427e-03f;
+      }
+    }
+    // tree 75
+    if ( x0 >= 2.1144363880157471e+00f ) {
+      if ( x3 >= 6.5270841121673584e-01f ) {
+        sum += -8.7978076189756393e-03f;
+      } else {
+        sum += 2.6056333445012569e-03f;
+      }
+    } else {
+      if ( x5 >= 2.2378913879394531e+02f ) {
+        sum += -1.1105475015938282e-02f;
+      } else {
+        sum += 1.3994598994031549e-03f;
+      }
+    }
+    // tree 76
+    if ( x1 >= 4.9061859130859375e+01f ) {
+      if ( x3 >= 1.2765625715255737e+00f ) {
+        sum += -3.1079547479748726e-03f;
+      } else {
+        sum += 1.3579778606072068e-03f;
+      }
+    } else {
+      if ( x3 >= 2.4978098869323730e+00f ) {
+        sum += -3.7108061369508505e-03f;
+      } else {
+        sum += 4.5194951817393303e-03f;
+      }
+    }
+    // tree 77
+    if ( x0 >= 8.0918037891387939e-01f ) {
+      if ( x5 >= 4.7547191619873047e+01f ) {
+        sum += -1.8830783665180206e-03f;
+      } else {
+        sum += 3.1513029243797064e-03f;
+      }
+    } else {
+      if ( x5 >= 1.5313276672363281e+02f ) {
+        sum += -2.7929747011512518e-03f;
+      } else {
+        sum += 3.9980546571314335e-03f;
+      }
+    }
+    // tree 78
+    if ( x2 >= 5.0099501609802246e+00f ) {
+      if ( x3 >= 1.2471089363098145e+00f ) {
+        sum += 3.0347536085173488e-04f;
+      } else {
+        sum += 6.8556824699044228e-03f;
+      }
+    } else {
+      if ( x6 >= 5.0854228973388672e+01f ) {
+        sum += -7.5408793054521084e-03f;
+      } else {
+        sum += 4.0202008676715195e-04f;
+      }
+    }
+    // tree 79
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x5 >= 6.9571670532226562e+01f ) {
+        sum += -7.5074896449223161e-04f;
+      } else {
+        sum += 2.9073054902255535e-03f;
+      }
+    } else {
+      if ( x5 >= 8.1034088134765625e+01f ) {
+        sum += -7.9481089487671852e-03f;
+      } else {
+        sum += -1.3101588003337383e-02f;
+      }
+    }
+    // tree 80
+    if ( x0 >= 1.4182999134063721e+00f ) {
+      if ( x6 >= 2.0026533126831055e+01f ) {
+        sum += -4.5711854472756386e-03f;
+      } else {
+        sum += 3.8001395296305418e-04f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 2.6826758403331041e-03f;
+      } else {
+        sum += -2.2034288849681616e-03f;
+      }
+    }
+    // tree 81
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 8.0099506378173828e+00f ) {
+        sum += 1.6625570133328438e-02f;
+      } else {
+        sum += 7.4346954934298992e-03f;
+      }
+    } else {
+      if ( x0 >= 5.8542221784591675e-01f ) {
+        sum += -7.2843604721128941e-04f;
+      } else {
+        sum += 3.6629457026720047e-03f;
+      }
+    }
+    // tree 82
+    if ( x1 >= 1.3082585144042969e+02f ) {
+      if ( x1 >= 4.3937402343750000e+02f ) {
+        sum += -2.7416558936238289e-02f;
+      } else {
+        sum += -1.5935488045215607e-03f;
+      }
+    } else {
+      if ( x2 >= 1.0646766424179077e+00f ) {
+        sum += 2.0936452783644199e-03f;
+      } else {
+        sum += -1.0668724775314331e-02f;
+      }
+    }
+    // tree 83
+    if ( x0 >= 2.1144363880157471e+00f ) {
+      if ( x3 >= 1.8255927562713623e+00f ) {
+        sum += -1.4130616560578346e-02f;
+      } else {
+        sum += -4.3435469269752502e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0099501609802246e+00f ) {
+        sum += 5.4491818882524967e-03f;
+      } else {
+        sum += 2.9029024881310761e-04f;
+      }
+    }
+    // tree 84
+    if ( x1 >= 4.9061859130859375e+01f ) {
+      if ( x3 >= 1.5888566970825195e+00f ) {
+        sum += -3.9714509621262550e-03f;
+      } else {
+        sum += 7.2577316313982010e-04f;
+      }
+    } else {
+      if ( x3 >= 2.4978098869323730e+00f ) {
+        sum += -3.0613087583333254e-03f;
+      } else {
+        sum += 4.0681585669517517e-03f;
+      }
+    }
+    // tree 85
+    if ( x6 >= 4.0640686035156250e+01f ) {
+      if ( x4 >= 8.2177543640136719e-01f ) {
+        sum += -6.0836160555481911e-03f;
+      } else {
+        sum += 5.5326771689578891e-04f;
+      }
+    } else {
+      if ( x1 >= 2.6982464599609375e+02f ) {
+        sum += -8.4333084523677826e-03f;
+      } else {
+        sum += 1.4921675901859999e-03f;
+      }
+    }
+    // tree 86
+    if ( x0 >= 4.7354310750961304e-01f ) {
+      if ( x5 >= 3.1742117309570312e+02f ) {
+        sum += -3.0998162925243378e-02f;
+      } else {
+        sum += -2.7928817871725187e-05f;
+      }
+    } else {
+      if ( x4 >= 9.5290255546569824e-01f ) {
+        sum += 3.1014492269605398e-03f;
+      } else {
+        sum += 6.8506477400660515e-03f;
+      }
+    }
+    // tree 87
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 1.2032276019454002e-02f;
+      } else {
+        sum += 5.7897898368537426e-03f;
+      }
+    } else {
+      if ( x6 >= 1.8170883178710938e+01f ) {
+        sum += -1.1879744706675410e-03f;
+      } else {
+        sum += 2.1567298099398613e-03f;
+      }
+    }
+    // tree 88
+    if ( x0 >= 1.8285232782363892e+00f ) {
+      if ( x1 >= 1.2812048339843750e+02f ) {
+        sum += -8.3346078172326088e-03f;
+      } else {
+        sum += -1.4062342233955860e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 3.6312129814177752e-03f;
+      } else {
+        sum += 1.2639851775020361e-04f;
+      }
+    }
+    // tree 89
+    if ( x1 >= 4.9061859130859375e+01f ) {
+      if ( x3 >= 1.1873357295989990e+00f ) {
+        sum += -2.4009658955037594e-03f;
+      } else {
+        sum += 1.3229056494310498e-03f;
+      }
+    } else {
+      if ( x3 >= 2.1622762680053711e+00f ) {
+        sum += -9.2588068218901753e-04f;
+      } else {
+        sum += 3.9830203168094158e-03f;
+      }
+    }
+    // tree 90
+    if ( x5 >= 4.7540603637695312e+01f ) {
+      if ( x0 >= 4.7353667020797729e-01f ) {
+        sum += -1.1155011598020792e-03f;
+      } else {
+        sum += 4.1802180930972099e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0298507213592529e+00f ) {
+        sum += 4.5898063108325005e-03f;
+      } else {
+        sum += -1.8153338460251689e-03f;
+      }
+    }
+    // tree 91
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 8.0099506378173828e+00f ) {
+        sum += 1.5898279845714569e-02f;
+      } else {
+        sum += 6.5531767904758453e-03f;
+      }
+    } else {
+      if ( x6 >= 5.0854228973388672e+01f ) {
+        sum += -6.0316645540297031e-03f;
+      } else {
+        sum += 5.1816424820572138e-04f;
+      }
+    }
+    // tree 92
+    if ( x0 >= 2.1144363880157471e+00f ) {
+      if ( x4 >= 2.1568834781646729e+00f ) {
+        sum += -1.5748752281069756e-02f;
+      } else {
+        sum += -4.4139428064227104e-03f;
+      }
+    } else {
+      if ( x1 >= 4.0064706420898438e+02f ) {
+        sum += -1.9874550402164459e-02f;
+      } else {
+        sum += 9.6190173644572496e-04f;
+      }
+    }
+    // tree 93
+    if ( x4 >= 1.0702885389328003e+00f ) {
+      if ( x5 >= 9.1156860351562500e+01f ) {
+        sum += -3.7759589031338692e-03f;
+      } else {
+        sum += 4.4568566954694688e-04f;
+      }
+    } else {
+      if ( x3 >= 1.6375571489334106e+00f ) {
+        sum += -3.4498861059546471e-03f;
+      } else {
+        sum += 3.3619995228946209e-03f;
+      }
+    }
+    // tree 94
+    if ( x0 >= 1.0702315568923950e+00f ) {
+      if ( x1 >= 4.7827842712402344e+01f ) {
+        sum += -2.0392800215631723e-03f;
+      } else {
+        sum += 2.2664328571408987e-03f;
+      }
+    } else {
+      if ( x5 >= 2.7886679077148438e+02f ) {
+        sum += -1.4351440593600273e-02f;
+      } else {
+        sum += 2.1596837323158979e-03f;
+      }
+    }
+    // tree 95
+    if ( x6 >= 1.8170883178710938e+01f ) {
+      if ( x0 >= 4.6466955542564392e-01f ) {
+        sum += -1.4403372770175338e-03f;
+      } else {
+        sum += 3.6127632483839989e-03f;
+      }
+    } else {
+      if ( x0 >= 1.6544386148452759e+00f ) {
+        sum += -6.8661523982882500e-04f;
+      } else {
+        sum += 3.1717750243842602e-03f;
+      }
+    }
+    // tree 96
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 1.1339714750647545e-02f;
+      } else {
+        sum += 5.1181213930249214e-03f;
+      }
+    } else {
+      if ( x5 >= 2.5683572387695312e+02f ) {
+        sum += -1.2847808189690113e-02f;
+      } else {
+        sum += 2.5335294776596129e-04f;
+      }
+    }
+    // tree 97
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x5 >= 6.9571670532226562e+01f ) {
+        sum += -6.5955286845564842e-04f;
+      } else {
+        sum += 2.3164974991232157e-03f;
+      }
+    } else {
+      if ( x5 >= 8.1034088134765625e+01f ) {
+        sum += -5.6458483450114727e-03f;
+      } else {
+        sum += -1.1094250716269016e-02f;
+      }
+    }
+    // tree 98
+    if ( x4 >= 1.1648162603378296e+00f ) {
+      if ( x6 >= 4.8811519622802734e+01f ) {
+        sum += -8.5064973682165146e-03f;
+      } else {
+        sum += -5.3160992683842778e-04f;
+      }
+    } else {
+      if ( x3 >= 1.6375571489334106e+00f ) {
+        sum += -3.4178721252828836e-03f;
+      } else {
+        sum += 2.9822119977325201e-03f;
+      }
+    }
+    // tree 99
+    if ( x1 >= 5.7238258361816406e+01f ) {
+      if ( x3 >= 8.1323695182800293e-01f ) {
+        sum += -1.4340814668685198e-03f;
+      } else {
+        sum += 2.1045899484306574e-03f;
+      }
+    } else {
+      if ( x0 >= 1.9544945955276489e+00f ) {
+        sum += -2.7171506080776453e-03f;
+      } else {
+        sum += 3.2763343770056963e-03f;
+      }
+    }
+    // tree 100
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 8.0099506378173828e+00f ) {
+        sum += 1.5303004533052444e-02f;
+      } else {
+        sum += 5.9431530535221100e-03f;
+      }
+    } else {
+      if ( x0 >= 7.8431838750839233e-01f ) {
+        sum += -8.6962222121655941e-04f;
+      } else {
+        sum += 2.1420465782284737e-03f;
+      }
+    }
+    // tree 101
+    if ( x1 >= 1.8806065368652344e+02f ) {
+      if ( x1 >= 4.4148904418945312e+02f ) {
+        sum += -2.2180374711751938e-02f;
+      } else {
+        sum += -2.4547686334699392e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 3.1738572288304567e-03f;
+      } else {
+        sum += 6.1646453104913235e-05f;
+      }
+    }
+    // tree 102
+    if ( x0 >= 2.1144363880157471e+00f ) {
+      if ( x3 >= 5.8233535289764404e-01f ) {
+        sum += -6.2956726178526878e-03f;
+      } else {
+        sum += 5.4275700822472572e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0099501609802246e+00f ) {
+        sum += 4.3644276447594166e-03f;
+      } else {
+        sum += 2.0067705190740526e-04f;
+      }
+    }
+    // tree 103
+    if ( x6 >= 1.8170883178710938e+01f ) {
+      if ( x0 >= 4.6466955542564392e-01f ) {
+        sum += -1.3342964230105281e-03f;
+      } else {
+        sum += 3.3006223384290934e-03f;
+      }
+    } else {
+      if ( x4 >= 2.6695375442504883e+00f ) {
+        sum += -8.6739370599389076e-03f;
+      } else {
+        sum += 2.3306310176849365e-03f;
+      }
+    }
+    // tree 104
+    if ( x5 >= 4.7540603637695312e+01f ) {
+      if ( x0 >= 4.7353667020797729e-01f ) {
+        sum += -9.6442812355235219e-04f;
+      } else {
+        sum += 3.4264826681464911e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0298507213592529e+00f ) {
+        sum += 4.0009766817092896e-03f;
+      } else {
+        sum += -1.7609057249501348e-03f;
+      }
+    }
+    // tree 105
+    if ( x4 >= 1.0702885389328003e+00f ) {
+      if ( x6 >= 4.8811519622802734e+01f ) {
+        sum += -7.6122875325381756e-03f;
+      } else {
+        sum += -3.3842111588455737e-04f;
+      }
+    } else {
+      if ( x3 >= 1.3683147430419922e+00f ) {
+        sum += -1.5914028044790030e-03f;
+      } else {
+        sum += 3.2817772589623928e-03f;
+      }
+    }
+    // tree 106
+    if ( x1 >= 4.9061859130859375e+01f ) {
+      if ( x3 >= 1.1873357295989990e+00f ) {
+        sum += -1.9718916155397892e-03f;
+      } else {
+        sum += 1.0303643066436052e-03f;
+      }
+    } else {
+      if ( x3 >= 2.4978098869323730e+00f ) {
+        sum += -2.6094440836459398e-03f;
+      } else {
+        sum += 3.1233886256814003e-03f;
+      }
+    }
+    // tree 107
+    if ( x0 >= 1.4182999134063721e+00f ) {
+      if ( x4 >= 2.1531357765197754e+00f ) {
+        sum += -7.5886338017880917e-03f;
+      } else {
+        sum += -7.5642555020749569e-04f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 1.9052417483180761e-03f;
+      } else {
+        sum += -1.6571474261581898e-03f;
+      }
+    }
+    // tree 108
+    if ( x6 >= 2.6341720581054688e+01f ) {
+      if ( x0 >= 4.7762227058410645e-01f ) {
+        sum += -2.2361485753208399e-03f;
+      } else {
+        sum += 3.0847699381411076e-03f;
+      }
+    } else {
+      if ( x1 >= 2.6982891845703125e+02f ) {
+        sum += -7.8852977603673935e-03f;
+      } else {
+        sum += 1.5700694639235735e-03f;
+      }
+    }
+    // tree 109
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 1.0494419373571873e-02f;
+      } else {
+        sum += 4.2532137595117092e-03f;
+      }
+    } else {
+      if ( x5 >= 1.2464933776855469e+02f ) {
+        sum += -2.7372227050364017e-03f;
+      } else {
+        sum += 6.5953470766544342e-04f;
+      }
+    }
+    // tree 110
+    if ( x0 >= 2.1144363880157471e+00f ) {
+      if ( x3 >= 5.1196229457855225e-01f ) {
+        sum += -5.4843616671860218e-03f;
+      } else {
+        sum += 8.8323866948485374e-03f;
+      }
+    } else {
+      if ( x5 >= 2.0726583862304688e+02f ) {
+        sum += -6.2752361409366131e-03f;
+      } else {
+        sum += 9.0529356384649873e-04f;
+      }
+    }
+    // tree 111
+    if ( x5 >= 4.7540603637695312e+01f ) {
+      if ( x4 >= 8.5760128498077393e-01f ) {
+        sum += -1.2344192946329713e-03f;
+      } else {
+        sum += 1.8305991543456912e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0298507213592529e+00f ) {
+        sum += 3.6547412164509296e-03f;
+      } else {
+        sum += -1.6037303721532226e-03f;
+      }
+    }
+    // tree 112
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x0 >= 1.6783812046051025e+00f ) {
+        sum += 4.0528454701416194e-04f;
+      } else {
+        sum += 7.5315437279641628e-03f;
+      }
+    } else {
+      if ( x6 >= 1.8170883178710938e+01f ) {
+        sum += -9.0057495981454849e-04f;
+      } else {
+        sum += 1.5729762380942702e-03f;
+      }
+    }
+    // tree 113
+    if ( x1 >= 4.9061859130859375e+01f ) {
+      if ( x3 >= 8.0812144279479980e-01f ) {
+        sum += -1.1695520952343941e-03f;
+      } else {
+        sum += 1.9433823181316257e-03f;
+      }
+    } else {
+      if ( x0 >= 1.9564740657806396e+00f ) {
+        sum += -1.6989163123071194e-03f;
+      } else {
+        sum += 2.9468249995261431e-03f;
+      }
+    }
+    // tree 114
+    if ( x0 >= 1.2069727182388306e+00f ) {
+      if ( x1 >= 1.2753514099121094e+02f ) {
+        sum += -3.5883774980902672e-03f;
+      } else {
+        sum += 1.9418068404775113e-04f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 2.0219255238771439e-03f;
+      } else {
+        sum += -1.4438710641115904e-03f;
+      }
+    }
+    // tree 115
+    if ( x5 >= 3.1742117309570312e+02f ) {
+      if ( x0 >= 4.8426020145416260e-01f ) {
+        sum += -2.5905862450599670e-02f;
+      } else {
+        sum += 5.2673784084618092e-03f;
+      }
+    } else {
+      if ( x4 >= 1.1648162603378296e+00f ) {
+        sum += -8.2137412391602993e-04f;
+      } else {
+        sum += 1.6062031500041485e-03f;
+      }
+    }
+    // tree 116
+    if ( x6 >= 5.0854228973388672e+01f ) {
+      if ( x4 >= 5.7631009817123413e-01f ) {
+        sum += -5.7028341107070446e-03f;
+      } else {
+        sum += 4.5033334754407406e-03f;
+      }
+    } else {
+      if ( x5 >= 2.8935083007812500e+02f ) {
+        sum += -1.8303066492080688e-02f;
+      } else {
+        sum += 7.4090057751163840e-04f;
+      }
+    }
+    // tree 117
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 7.0348258018493652e+00f ) {
+        sum += 1.0000311769545078e-02f;
+      } else {
+        sum += 3.7953720893710852e-03f;
+      }
+    } else {
+      if ( x0 >= 6.4757728576660156e-01f ) {
+        sum += -5.8089080266654491e-04f;
+      } else {
+        sum += 2.1323005203157663e-03f;
+      }
+    }
+    // tree 118
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x5 >= 1.0812603759765625e+02f ) {
+        sum += -1.5439679846167564e-03f;
+      } else {
+        sum += 1.2531547108665109e-03f;
+      }
+    } else {
+      if ( x5 >= 8.1034088134765625e+01f ) {
+        sum += -3.6857817322015762e-03f;
+      } else {
+        sum += -9.5584886148571968e-03f;
+      }
+    }
+    // tree 119
+    if ( x0 >= 2.1144363880157471e+00f ) {
+      if ( x3 >= 6.5270841121673584e-01f ) {
+        sum += -5.4701850749552250e-03f;
+      } else {
+        sum += 3.2194552477449179e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0099501609802246e+00f ) {
+        sum += 3.7027653306722641e-03f;
+      } else {
+        sum += 1.4390799333341420e-04f;
+      }
+    }
+    // tree 120
+    if ( x5 >= 4.7540603637695312e+01f ) {
+      if ( x0 >= 4.7353667020797729e-01f ) {
+        sum += -8.1391964340582490e-04f;
+      } else {
+        sum += 2.9032402671873569e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0298507213592529e+00f ) {
+        sum += 3.3086091279983521e-03f;
+      } else {
+        sum += -1.4219898730516434e-03f;
+      }
+    }
+    // tree 121
+    if ( x1 >= 4.9061859130859375e+01f ) {
+      if ( x3 >= 8.0812144279479980e-01f ) {
+        sum += -1.0791649110615253e-03f;
+      } else {
+        sum += 1.8038224661722779e-03f;
+      }
+    } else {
+      if ( x3 >= 2.4978098869323730e+00f ) {
+        sum += -2.3278901353478432e-03f;
+      } else {
+        sum += 2.6262940373271704e-03f;
+      }
+    }
+    // tree 122
+    if ( x6 >= 1.8170883178710938e+01f ) {
+      if ( x3 >= 1.1556757688522339e+00f ) {
+        sum += -1.8793377093970776e-03f;
+      } else {
+        sum += 7.6557637657970190e-04f;
+      }
+    } else {
+      if ( x4 >= 2.6695375442504883e+00f ) {
+        sum += -7.3312632739543915e-03f;
+      } else {
+        sum += 1.8671860452741385e-03f;
+      }
+    }
+    // tree 123
+    if ( x6 >= 5.0854228973388672e+01f ) {
+      if ( x3 >= 7.1454507112503052e-01f ) {
+        sum += -5.8866743929684162e-03f;
+      } else {
+        sum += 2.2304516751319170e-03f;
+      }
+    } else {
+      if ( x5 >= 2.8935083007812500e+02f ) {
+        sum += -1.6917118802666664e-02f;
+      } else {
+        sum += 6.7328359000384808e-04f;
+      }
+    }
+    // tree 124
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 8.0099506378173828e+00f ) {
+        sum += 1.4197126962244511e-02f;
+      } else {
+        sum += 4.5332219451665878e-03f;
+      }
+    } else {
+      if ( x0 >= 1.0702315568923950e+00f ) {
+        sum += -1.0007770033553243e-03f;
+      } else {
+        sum += 1.1032666079699993e-03f;
+      }
+    }
+    // tree 125
+    if ( x4 >= 9.7576087713241577e-01f ) {
+      if ( x5 >= 1.2164900970458984e+02f ) {
+        sum += -3.9641200564801693e-03f;
+      } else {
+        sum += 1.4565035235136747e-04f;
+      }
+    } else {
+      if ( x3 >= 1.3683147430419922e+00f ) {
+        sum += -1.5036468394100666e-03f;
+      } else {
+        sum += 2.9385923407971859e-03f;
+      }
+    }
+    // tree 126
+    if ( x0 >= 1.7415062189102173e+00f ) {
+      if ( x5 >= 2.5015216064453125e+02f ) {
+        sum += -3.2692704349756241e-02f;
+      } else {
+        sum += -1.7489852616563439e-03f;
+      }
+    } else {
+      if ( x3 >= 8.1192260980606079e-01f ) {
+        sum += 7.8748795203864574e-05f;
+      } else {
+        sum += 2.5924013461917639e-03f;
+      }
+    }
+    // tree 127
+    if ( x1 >= 4.9061859130859375e+01f ) {
+      if ( x0 >= 2.2884395122528076e+00f ) {
+        sum += -8.8788401335477829e-03f;
+      } else {
+        sum += -1.4068490418139845e-04f;
+      }
+    } else {
+      if ( x0 >= 1.9564740657806396e+00f ) {
+        sum += -1.4528287574648857e-03f;
+      } else {
+        sum += 2.5280080735683441e-03f;
+      }
+    }
+    // tree 128
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x4 >= 1.3423380851745605e+00f ) {
+        sum += 5.4709246614947915e-04f;
+      } else {
+        sum += 1.0799982585012913e-02f;
+      }
+    } else {
+      if ( x6 >= 5.9025066375732422e+01f ) {
+        sum += -5.2303546108305454e-03f;
+      } else {
+        sum += 3.1748431501910090e-04f;
+      }
+    }
+    // tree 129
+    if ( x5 >= 4.7540603637695312e+01f ) {
+      if ( x0 >= 4.7353667020797729e-01f ) {
+        sum += -7.5564376311376691e-04f;
+      } else {
+        sum += 2.6515349745750427e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0298507213592529e+00f ) {
+        sum += 3.0264907982200384e-03f;
+      } else {
+        sum += -1.3608308508992195e-03f;
+      }
+    }
+    // tree 130
+    if ( x4 >= 7.6307356357574463e-01f ) {
+      if ( x6 >= 4.4726104736328125e+01f ) {
+        sum += -4.2789969593286514e-03f;
+      } else {
+        sum += 1.0573320469120517e-04f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 3.0850837938487530e-03f;
+      } else {
+        sum += -5.2201426587998867e-03f;
+      }
+    }
+    // tree 131
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x2 >= 8.0099506378173828e+00f ) {
+        sum += 1.3709142804145813e-02f;
+      } else {
+        sum += 4.2009032331407070e-03f;
+      }
+    } else {
+      if ( x1 >= 4.4152905273437500e+02f ) {
+        sum += -1.9117468968033791e-02f;
+      } else {
+        sum += 9.2915419372729957e-05f;
+      }
+    }
+    // tree 132
+    if ( x6 >= 1.8170883178710938e+01f ) {
+      if ( x0 >= 2.0902903079986572e+00f ) {
+        sum += -5.5021704174578190e-03f;
+      } else {
+        sum += -2.2377046116162091e-04f;
+      }
+    } else {
+      if ( x4 >= 1.2611687183380127e+00f ) {
+        sum += 1.1586235632421449e-04f;
+      } else {
+        sum += 2.5502382777631283e-03f;
+      }
+    }
+    // tree 133
+    if ( x1 >= 5.7238258361816406e+01f ) {
+      if ( x4 >= 9.7576087713241577e-01f ) {
+        sum += -1.2353615602478385e-03f;
+      } else {
+        sum += 1.1536260135471821e-03f;
+      }
+    } else {
+      if ( x3 >= 2.4978098869323730e+00f ) {
+        sum += -3.2204207964241505e-03f;
+      } else {
+        sum += 2.2085504606366158e-03f;
+      }
+    }
+    // tree 134
+    if ( x0 >= 8.0918037891387939e-01f ) {
+      if ( x6 >= 3.2284881591796875e+01f ) {
+        sum += -2.7437605895102024e-03f;
+      } else {
+        sum += 2.1333966287784278e-04f;
+      }
+    } else {
+      if ( x5 >= 1.5313276672363281e+02f ) {
+        sum += -2.0356769673526287e-03f;
+      } else {
+        sum += 2.1135786082595587e-03f;
+      }
+    }
+    // tree 135
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x4 >= 1.3423380851745605e+00f ) {
+        sum += 3.0861212871968746e-04f;
+      } else {
+        sum += 1.0298858396708965e-02f;
+      }
+    } else {
+      if ( x1 >= 5.7238258361816406e+01f ) {
+        sum += -4.7461609938181937e-04f;
+      } else {
+        sum += 1.5985067002475262e-03f;
+      }
+    }
+    // tree 136
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x5 >= 7.5079437255859375e+01f ) {
+        sum += -5.6163809495046735e-04f;
+      } else {
+        sum += 1.3919713674113154e-03f;
+      }
+    } else {
+      if ( x4 >= 6.0649335384368896e-01f ) {
+        sum += -5.0046555697917938e-03f;
+      } else {
+        sum += -3.3364690840244293e-02f;
+      }
+    }
+    // tree 137
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x0 >= 1.6783812046051025e+00f ) {
+        sum += -6.2514696037396789e-04f;
+      } else {
+        sum += 6.1892713420093060e-03f;
+      }
+    } else {
+      if ( x1 >= 4.4152905273437500e+02f ) {
+        sum += -1.7410468310117722e-02f;
+      } else {
+        sum += 8.1315571151208133e-05f;
+      }
+    }
+    // tree 138
+    if ( x0 >= 1.4182999134063721e+00f ) {
+      if ( x4 >= 2.1531357765197754e+00f ) {
+        sum += -5.9707229956984520e-03f;
+      } else {
+        sum += -4.8480354598723352e-04f;
+      }
+    } else {
+      if ( x3 >= 8.1192260980606079e-01f ) {
+        sum += 1.9792861712630838e-04f;
+      } else {
+        sum += 2.6272144168615341e-03f;
+      }
+    }
+    // tree 139
+    if ( x5 >= 4.7540603637695312e+01f ) {
+      if ( x0 >= 4.7353667020797729e-01f ) {
+        sum += -6.7602237686514854e-04f;
+      } else {
+        sum += 2.4110046215355396e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0298507213592529e+00f ) {
+        sum += 2.6957488153129816e-03f;
+      } else {
+        sum += -1.2444398598745465e-03f;
+      }
+    }
+    // tree 140
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x4 >= 1.3423380851745605e+00f ) {
+        sum += 9.8012555099558085e-05f;
+      } else {
+        sum += 9.8975300788879395e-03f;
+      }
+    } else {
+      if ( x0 >= 8.0918037891387939e-01f ) {
+        sum += -5.1551859360188246e-04f;
+      } else {
+        sum += 1.3485465897247195e-03f;
+      }
+    }
+    // tree 141
+    if ( x4 >= 7.6307356357574463e-01f ) {
+      if ( x6 >= 5.9025066375732422e+01f ) {
+        sum += -6.5540904179215431e-03f;
+      } else {
+        sum += -4.5337597839534283e-05f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 2.7645081281661987e-03f;
+      } else {
+        sum += -4.7774370759725571e-03f;
+      }
+    }
+    // tree 142
+    if ( x1 >= 1.8806065368652344e+02f ) {
+      if ( x3 >= 6.1858987808227539e-01f ) {
+        sum += -2.9583435971289873e-03f;
+      } else {
+        sum += 2.2925601806491613e-03f;
+      }
+    } else {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 2.1029000636190176e-03f;
+      } else {
+        sum += -7.5714697231887840e-06f;
+      }
+    }
+    // tree 143
+    if ( x0 >= 2.1144363880157471e+00f ) {
+      if ( x3 >= 5.1196229457855225e-01f ) {
+        sum += -3.9487322792410851e-03f;
+      } else {
+        sum += 8.5872467607259750e-03f;
+      }
+    } else {
+      if ( x1 >= 3.2705944824218750e+02f ) {
+        sum += -6.6645434126257896e-03f;
+      } else {
+        sum += 5.7097215903922915e-04f;
+      }
+    }
+    // tree 144
+    if ( x6 >= 1.8170883178710938e+01f ) {
+      if ( x3 >= 1.1556757688522339e+00f ) {
+        sum += -1.5251890290528536e-03f;
+      } else {
+        sum += 6.3827115809544921e-04f;
+      }
+    } else {
+      if ( x4 >= 2.6695375442504883e+00f ) {
+        sum += -6.2859966419637203e-03f;
+      } else {
+        sum += 1.4800570206716657e-03f;
+      }
+    }
+    // tree 145
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x4 >= 1.3423380851745605e+00f ) {
+        sum += 2.3750357286189683e-05f;
+      } else {
+        sum += 9.5712812617421150e-03f;
+      }
+    } else {
+      if ( x1 >= 5.7238258361816406e+01f ) {
+        sum += -4.2764269164763391e-04f;
+      } else {
+        sum += 1.4426860725507140e-03f;
+      }
+    }
+    // tree 146
+    if ( x4 >= 7.6307356357574463e-01f ) {
+      if ( x6 >= 5.9025066375732422e+01f ) {
+        sum += -6.0139121487736702e-03f;
+      } else {
+        sum += -4.7080917283892632e-05f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 2.5876141153275967e-03f;
+      } else {
+        sum += -4.3860459700226784e-03f;
+      }
+    }
+    // tree 147
+    if ( x5 >= 3.3394445800781250e+02f ) {
+      if ( x6 >= 5.9029022216796875e+01f ) {
+        sum += 4.5730164274573326e-03f;
+      } else {
+        sum += -2.5465179234743118e-02f;
+      }
+    } else {
+      if ( x4 >= 7.6307356357574463e-01f ) {
+        sum += -2.1672413276974112e-04f;
+      } else {
+        sum += 1.9044665386900306e-03f;
+      }
+    }
+    // tree 148
+    if ( x0 >= 5.8542221784591675e-01f ) {
+      if ( x3 >= 6.2840884923934937e-01f ) {
+        sum += -5.6358682923018932e-04f;
+      } else {
+        sum += 2.4212936405092478e-03f;
+      }
+    } else {
+      if ( x1 >= 5.4782629394531250e+02f ) {
+        sum += -4.4298570603132248e-02f;
+      } else {
+        sum += 1.9469587132334709e-03f;
+      }
+    }
+    // tree 149
+    if ( x5 >= 4.7540603637695312e+01f ) {
+      if ( x3 >= 8.1947076320648193e-01f ) {
+        sum += -8.0864952178671956e-04f;
+      } else {
+        sum += 1.3678856194019318e-03f;
+      }
+    } else {
+      if ( x0 >= 2.3137085437774658e+00f ) {
+        sum += -9.0243322774767876e-03f;
+      } else {
+        sum += 1.9520710920915008e-03f;
+      }
+    }
+    // tree 150
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x4 >= 1.3423380851745605e+00f ) {
+        sum += 6.2949584389571100e-05f;
+      } else {
+        sum += 9.2678628861904144e-03f;
+      }
+    } else {
+      if ( x0 >= 1.0702315568923950e+00f ) {
+        sum += -7.0539623266085982e-04f;
+      } else {
+        sum += 8.8990322547033429e-04f;
+      }
+    }
+    // tree 151
+    if ( x6 >= 1.8170883178710938e+01f ) {
+      if ( x5 >= 6.4486572265625000e+01f ) {
+        sum += -1.1334670707583427e-03f;
+      } else {
+        sum += 9.3678222037851810e-04f;
+      }
+    } else {
+      if ( x0 >= 9.7075390815734863e-01f ) {
+        sum += 3.8381555350497365e-04f;
+      } else {
+        sum += 2.4570673704147339e-03f;
+      }
+    }
+    // tree 152
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x5 >= 1.0812603759765625e+02f ) {
+        sum += -1.0816862341016531e-03f;
+      } else {
+        sum += 8.5250567644834518e-04f;
+      }
+    } else {
+      if ( x5 >= 8.1034088134765625e+01f ) {
+        sum += -1.4205216430127621e-03f;
+      } else {
+        sum += -7.8071248717606068e-03f;
+      }
+    }
+    // tree 153
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x0 >= 1.6783812046051025e+00f ) {
+        sum += -9.3941402155905962e-04f;
+      } else {
+        sum += 5.5265780538320541e-03f;
+      }
+    } else {
+      if ( x6 >= 1.8170883178710938e+01f ) {
+        sum += -5.8391765924170613e-04f;
+      } else {
+        sum += 9.6185540314763784e-04f;
+      }
+    }
+    // tree 154
+    if ( x1 >= 4.9061859130859375e+01f ) {
+      if ( x0 >= 2.3008701801300049e+00f ) {
+        sum += -7.8875590115785599e-03f;
+      } else {
+        sum += -1.1199530854355544e-04f;
+      }
+    } else {
+      if ( x5 >= 2.7640219116210938e+02f ) {
+        sum += -1.3900032266974449e-02f;
+      } else {
+        sum += 1.6667020972818136e-03f;
+      }
+    }
+    // tree 155
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x4 >= 1.3423380851745605e+00f ) {
+        sum += -9.3521091912407428e-05f;
+      } else {
+        sum += 8.9155258610844612e-03f;
+      }
+    } else {
+      if ( x0 >= 4.7354310750961304e-01f ) {
+        sum += -2.4052361550275236e-04f;
+      } else {
+        sum += 2.0266582723706961e-03f;
+      }
+    }
+    // tree 156
+    if ( x0 >= 1.8160922527313232e+00f ) {
+      if ( x3 >= 2.2243733406066895e+00f ) {
+        sum += -7.6974523253738880e-03f;
+      } else {
+        sum += -8.0875656567513943e-04f;
+      }
+    } else {
+      if ( x3 >= 8.1192260980606079e-01f ) {
+        sum += -2.6758405510918237e-05f;
+      } else {
+        sum += 1.9364770269021392e-03f;
+      }
+    }
+    // tree 157
+    if ( x1 >= 4.9061859130859375e+01f ) {
+      if ( x3 >= 6.2966769933700562e-01f ) {
+        sum += -5.9991353191435337e-04f;
+      } else {
+        sum += 2.2027536761015654e-03f;
+      }
+    } else {
+      if ( x5 >= 9.8894210815429688e+01f ) {
+        sum += -3.1360262073576450e-04f;
+      } else {
+        sum += 2.0966778974980116e-03f;
+      }
+    }
+    // tree 158
+    if ( x1 >= 1.8806065368652344e+02f ) {
+      if ( x5 >= 8.1604125976562500e+01f ) {
+        sum += -1.1461094254627824e-03f;
+      } else {
+        sum += -5.5878278799355030e-03f;
+      }
+    } else {
+      if ( x3 >= 3.1928434371948242e+00f ) {
+        sum += -1.5728792175650597e-02f;
+      } else {
+        sum += 5.4238690063357353e-04f;
+      }
+    }
+    // tree 159
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x0 >= 1.6783812046051025e+00f ) {
+        sum += -9.5185247482731938e-04f;
+      } else {
+        sum += 5.2145132794976234e-03f;
+      }
+    } else {
+      if ( x1 >= 4.4152905273437500e+02f ) {
+        sum += -1.4524367637932301e-02f;
+      } else {
+        sum += 5.2263079851400107e-05f;
+      }
+    }
+    // tree 160
+    if ( x6 >= 9.3751121520996094e+01f ) {
+      if ( x6 >= 1.1001899719238281e+02f ) {
+        sum += -2.5787176564335823e-03f;
+      } else {
+        sum += -2.2303773090243340e-02f;
+      }
+    } else {
+      if ( x4 >= 7.6307356357574463e-01f ) {
+        sum += -1.9591637828852981e-04f;
+      } else {
+        sum += 1.6256925882771611e-03f;
+      }
+    }
+    // tree 161
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x4 >= 1.3423380851745605e+00f ) {
+        sum += -2.2736401297152042e-04f;
+      } else {
+        sum += 8.5357893258333206e-03f;
+      }
+    } else {
+      if ( x0 >= 4.7354310750961304e-01f ) {
+        sum += -2.3094630159903318e-04f;
+      } else {
+        sum += 1.8943528411909938e-03f;
+      }
+    }
+    // tree 162
+    if ( x5 >= 4.7540603637695312e+01f ) {
+      if ( x4 >= 8.5760128498077393e-01f ) {
+        sum += -7.7235820936039090e-04f;
+      } else {
+        sum += 1.0946625843644142e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0298507213592529e+00f ) {
+        sum += 2.2110291756689548e-03f;
+      } else {
+        sum += -1.2267243582755327e-03f;
+      }
+    }
+    // tree 163
+    if ( x0 >= 2.1144363880157471e+00f ) {
+      if ( x6 >= 7.4366615295410156e+01f ) {
+        sum += -5.9376243501901627e-02f;
+      } else {
+        sum += -2.5905505754053593e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0099501609802246e+00f ) {
+        sum += 2.5063639041036367e-03f;
+      } else {
+        sum += 5.0001632189378142e-05f;
+      }
+    }
+    // tree 164
+    if ( x5 >= 3.3394445800781250e+02f ) {
+      if ( x0 >= 3.6115974187850952e-01f ) {
+        sum += -1.9270813092589378e-02f;
+      } else {
+        sum += 1.4144176617264748e-02f;
+      }
+    } else {
+      if ( x6 >= 6.2125873565673828e+01f ) {
+        sum += -4.2873756028711796e-03f;
+      } else {
+        sum += 3.4778096596710384e-04f;
+      }
+    }
+    // tree 165
+    if ( x1 >= 4.9061859130859375e+01f ) {
+      if ( x3 >= 6.2966769933700562e-01f ) {
+        sum += -5.6468712864443660e-04f;
+      } else {
+        sum += 2.0968259777873755e-03f;
+      }
+    } else {
+      if ( x5 >= 2.0737130737304688e+02f ) {
+        sum += -5.5411541834473610e-03f;
+      } else {
+        sum += 1.5394801739603281e-03f;
+      }
+    }
+    // tree 166
+    if ( x6 >= 1.8170883178710938e+01f ) {
+      if ( x3 >= 1.1556757688522339e+00f ) {
+        sum += -1.2471654918044806e-03f;
+      } else {
+        sum += 5.1597075071185827e-04f;
+      }
+    } else {
+      if ( x4 >= 2.6695375442504883e+00f ) {
+        sum += -5.6117302738130093e-03f;
+      } else {
+        sum += 1.1782606597989798e-03f;
+      }
+    }
+    // tree 167
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x2 >= 8.0298509597778320e+00f ) {
+        sum += 1.2040443718433380e-02f;
+      } else {
+        sum += 4.7110226005315781e-03f;
+      }
+    } else {
+      if ( x0 >= 8.0918037891387939e-01f ) {
+        sum += -4.1599111864343286e-04f;
+      } else {
+        sum += 1.0338473366573453e-03f;
+      }
+    }
+    // tree 168
+    if ( x5 >= 4.7540603637695312e+01f ) {
+      if ( x0 >= 4.7353667020797729e-01f ) {
+        sum += -5.2298424998298287e-04f;
+      } else {
+        sum += 1.7993632936850190e-03f;
+      }
+    } else {
+      if ( x6 >= 1.3073231697082520e+01f ) {
+        sum += 2.0760137122124434e-03f;
+      } else {
+        sum += -1.4712186530232430e-03f;
+      }
+    }
+    // tree 169
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x0 >= 2.3133325576782227e+00f ) {
+        sum += -5.5803027935326099e-03f;
+      } else {
+        sum += 3.8164985016919672e-04f;
+      }
+    } else {
+      if ( x5 >= 8.1034088134765625e+01f ) {
+        sum += -8.1754580605775118e-04f;
+      } else {
+        sum += -6.9588492624461651e-03f;
+      }
+    }
+    // tree 170
+    if ( x3 >= 4.3667539954185486e-01f ) {
+      if ( x0 >= 1.4182999134063721e+00f ) {
+        sum += -9.5536216394975781e-04f;
+      } else {
+        sum += 5.2357197273522615e-04f;
+      }
+    } else {
+      if ( x6 >= 4.7915908813476562e+01f ) {
+        sum += 1.6321228817105293e-02f;
+      } else {
+        sum += 4.5116022229194641e-03f;
+      }
+    }
+    // tree 171
+    if ( x1 >= 2.6982464599609375e+02f ) {
+      if ( x6 >= 3.5439884185791016e+01f ) {
+        sum += 9.9542748648673296e-04f;
+      } else {
+        sum += -5.9350291267037392e-03f;
+      }
+    } else {
+      if ( x6 >= 5.9025066375732422e+01f ) {
+        sum += -4.1125039570033550e-03f;
+      } else {
+        sum += 4.5276031596586108e-04f;
+      }
+    }
+    // tree 172
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x4 >= 1.3423380851745605e+00f ) {
+        sum += -5.5008963681757450e-04f;
+      } else {
+        sum += 8.0291060730814934e-03f;
+      }
+    } else {
+      if ( x1 >= 8.1767456054687500e+01f ) {
+        sum += -4.8942811554297805e-04f;
+      } else {
+        sum += 8.2615768769755960e-04f;
+      }
+    }
+    // tree 173
+    if ( x4 >= 1.0702885389328003e+00f ) {
+      if ( x0 >= 1.1968193054199219e+00f ) {
+        sum += -1.4572407817468047e-03f;
+      } else {
+        sum += 4.5141257578507066e-04f;
+      }
+    } else {
+      if ( x3 >= 1.6375571489334106e+00f ) {
+        sum += -2.6055073831230402e-03f;
+      } else {
+        sum += 1.6734085511416197e-03f;
+      }
+    }
+    // tree 174
+    if ( x6 >= 1.8170883178710938e+01f ) {
+      if ( x5 >= 6.4486572265625000e+01f ) {
+        sum += -9.4943318981677294e-04f;
+      } else {
+        sum += 7.8794697765260935e-04f;
+      }
+    } else {
+      if ( x1 >= 2.0293962097167969e+02f ) {
+        sum += -1.8758794758468866e-03f;
+      } else {
+        sum += 1.2493920512497425e-03f;
+      }
+    }
+    // tree 175
+    if ( x3 >= 5.0857543945312500e-01f ) {
+      if ( x1 >= 3.2705944824218750e+02f ) {
+        sum += -5.8354516513645649e-03f;
+      } else {
+        sum += 9.9579345260281116e-05f;
+      }
+    } else {
+      if ( x1 >= 2.0681486511230469e+02f ) {
+        sum += -2.6857666671276093e-03f;
+      } else {
+        sum += 4.4048107229173183e-03f;
+      }
+    }
+    // tree 176
+    if ( x2 >= 6.0447759628295898e+00f ) {
+      if ( x1 >= 1.9776821899414062e+02f ) {
+        sum += -3.5448088310658932e-03f;
+      } else {
+        sum += 4.2556044645607471e-03f;
+      }
+    } else {
+      if ( x5 >= 3.1742117309570312e+02f ) {
+        sum += -1.0601139627397060e-02f;
+      } else {
+        sum += 4.2649313400033861e-05f;
+      }
+    }
+    // tree 177
+    if ( x4 >= 7.1580976247787476e-01f ) {
+      if ( x6 >= 4.4726104736328125e+01f ) {
+        sum += -2.7401591651141644e-03f;
+      } else {
+        sum += 8.9860441221389920e-05f;
+      }
+    } else {
+      if ( x1 >= 3.9247280883789062e+02f ) {
+        sum += -2.4459695443511009e-02f;
+      } else {
+        sum += 1.7307584639638662e-03f;
+      }
+    }
+    // tree 178
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x2 >= 8.0298509597778320e+00f ) {
+        sum += 1.1562021449208260e-02f;
+      } else {
+        sum += 4.1917315684258938e-03f;
+      }
+    } else {
+      if ( x1 >= 4.9061859130859375e+01f ) {
+        sum += -2.8714517247863114e-04f;
+      } else {
+        sum += 1.1426674900576472e-03f;
+      }
+    }
+    // tree 179
+    if ( x3 >= 6.0444217920303345e-01f ) {
+      if ( x6 >= 5.0161792755126953e+01f ) {
+        sum += -3.0201666522771120e-03f;
+      } else {
+        sum += 1.2783188140019774e-04f;
+      }
+    } else {
+      if ( x4 >= 1.6035251617431641e+00f ) {
+        sum += -2.8824459295719862e-03f;
+      } else {
+        sum += 2.8716716915369034e-03f;
+      }
+    }
+    // tree 180
+    if ( x0 >= 2.1144363880157471e+00f ) {
+      if ( x3 >= 5.1196229457855225e-01f ) {
+        sum += -2.8730737976729870e-03f;
+      } else {
+        sum += 7.9833483323454857e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0099501609802246e+00f ) {
+        sum += 2.1928232163190842e-03f;
+      } else {
+        sum += 3.5805387597065419e-05f;
+      }
+    }
+    // tree 181
+    if ( x3 >= 4.3667539954185486e-01f ) {
+      if ( x0 >= 5.8542221784591675e-01f ) {
+        sum += -2.5316668325103819e-04f;
+      } else {
+        sum += 1.3560449006035924e-03f;
+      }
+    } else {
+      if ( x0 >= 6.3505142927169800e-01f ) {
+        sum += 7.4498616158962250e-03f;
+      } else {
+        sum += -2.5093241129070520e-03f;
+      }
+    }
+    // tree 182
+    if ( x6 >= 9.3751121520996094e+01f ) {
+      if ( x6 >= 1.1001899719238281e+02f ) {
+        sum += -1.4091049088165164e-03f;
+      } else {
+        sum += -1.9537156447768211e-02f;
+      }
+    } else {
+      if ( x3 >= 3.1928434371948242e+00f ) {
+        sum += -1.1939124204218388e-02f;
+      } else {
+        sum += 2.0471688185352832e-04f;
+      }
+    }
+    // tree 183
+    if ( x4 >= 3.2444250583648682e+00f ) {
+      if ( x2 >= 1.0199004411697388e+00f ) {
+        sum += -2.4549489840865135e-02f;
+      } else {
+        sum += -5.5965650826692581e-03f;
+      }
+    } else {
+      if ( x4 >= 7.8525108098983765e-01f ) {
+        sum += -1.8935593834612519e-04f;
+      } else {
+        sum += 1.2179318582639098e-03f;
+      }
+    }
+    // tree 184
+    if ( x6 >= 1.8170883178710938e+01f ) {
+      if ( x0 >= 2.2267928123474121e+00f ) {
+        sum += -5.1084854640066624e-03f;
+      } else {
+        sum += -1.9607636204455048e-04f;
+      }
+    } else {
+      if ( x4 >= 2.6695375442504883e+00f ) {
+        sum += -4.8687886446714401e-03f;
+      } else {
+        sum += 1.0011669946834445e-03f;
+      }
+    }
+    // tree 185
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x2 >= 8.0298509597778320e+00f ) {
+        sum += 1.1272701434791088e-02f;
+      } else {
+        sum += 3.9538918063044548e-03f;
+      }
+    } else {
+      if ( x1 >= 4.9061859130859375e+01f ) {
+        sum += -2.7783753466792405e-04f;
+      } else {
+        sum += 1.0750904912129045e-03f;
+      }
+    }
+    // tree 186
+    if ( x3 >= 1.2515424489974976e+00f ) {
+      if ( x4 >= 1.8301885128021240e+00f ) {
+        sum += 1.4889932936057448e-03f;
+      } else {
+        sum += -1.2602866627275944e-03f;
+      }
+    } else {
+      if ( x4 >= 1.6452976465225220e+00f ) {
+        sum += -2.9052030295133591e-03f;
+      } else {
+        sum += 1.3981428928673267e-03f;
+      }
+    }
+    // tree 187
+    if ( x5 >= 4.7540603637695312e+01f ) {
+      if ( x0 >= 4.7353667020797729e-01f ) {
+        sum += -4.6049818047322333e-04f;
+      } else {
+        sum += 1.5752072213217616e-03f;
+      }
+    } else {
+      if ( x6 >= 1.3073231697082520e+01f ) {
+        sum += 1.8481976585462689e-03f;
+      } else {
+        sum += -1.5897904522716999e-03f;
+      }
+    }
+    // tree 188
+    if ( x3 >= 4.3667539954185486e-01f ) {
+      if ( x0 >= 2.3009016513824463e+00f ) {
+        sum += -4.3822196312248707e-03f;
+      } else {
+        sum += 1.2060057633789256e-04f;
+      }
+    } else {
+      if ( x6 >= 4.7915908813476562e+01f ) {
+        sum += 1.5216008760035038e-02f;
+      } else {
+        sum += 3.7038673181086779e-03f;
+      }
+    }
+    // tree 189
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x3 >= 3.2013697624206543e+00f ) {
+        sum += -2.1075380966067314e-02f;
+      } else {
+        sum += 2.5813307729549706e-04f;
+      }
+    } else {
+      if ( x5 >= 8.1034088134765625e+01f ) {
+        sum += -2.0638814021367580e-04f;
+      } else {
+        sum += -6.3325022347271442e-03f;
+      }
+    }
+    // tree 190
+    if ( x6 >= 1.8170883178710938e+01f ) {
+      if ( x5 >= 6.4486572265625000e+01f ) {
+        sum += -8.3202775567770004e-04f;
+      } else {
+        sum += 6.9118052488192916e-04f;
+      }
+    } else {
+      if ( x3 >= 5.3853350877761841e-01f ) {
+        sum += 6.1211793217808008e-04f;
+      } else {
+        sum += 4.0425709448754787e-03f;
+      }
+    }
+    // tree 191
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x4 >= 1.3423380851745605e+00f ) {
+        sum += -1.1624663602560759e-03f;
+      } else {
+        sum += 7.2180894203484058e-03f;
+      }
+    } else {
+      if ( x1 >= 4.4152905273437500e+02f ) {
+        sum += -1.1190657503902912e-02f;
+      } else {
+        sum += 7.0409209001809359e-05f;
+      }
+    }
+    // tree 192
+    if ( x4 >= 7.1580976247787476e-01f ) {
+      if ( x1 >= 5.5798572540283203e+01f ) {
+        sum += -5.6591350585222244e-04f;
+      } else {
+        sum += 9.9448184482753277e-04f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 2.0357561297714710e-03f;
+      } else {
+        sum += -4.5489487238228321e-03f;
+      }
+    }
+    // tree 193
+    if ( x6 >= 9.3751121520996094e+01f ) {
+      if ( x6 >= 1.1001899719238281e+02f ) {
+        sum += -1.2802036944776773e-03f;
+      } else {
+        sum += -1.8010823056101799e-02f;
+      }
+    } else {
+      if ( x2 >= 7.0149254798889160e+00f ) {
+        sum += 6.1383722350001335e-03f;
+      } else {
+        sum += 6.5947344410233200e-05f;
+      }
+    }
+    // tree 194
+    if ( x5 >= 3.3394445800781250e+02f ) {
+      if ( x6 >= 5.9029022216796875e+01f ) {
+        sum += 8.7578482925891876e-03f;
+      } else {
+        sum += -2.0207900553941727e-02f;
+      }
+    } else {
+      if ( x4 >= 7.1580976247787476e-01f ) {
+        sum += -1.4441662642639130e-04f;
+      } else {
+        sum += 1.3982877135276794e-03f;
+      }
+    }
+    // tree 195
+    if ( x3 >= 6.0444217920303345e-01f ) {
+      if ( x6 >= 5.0161792755126953e+01f ) {
+        sum += -2.6710426900535822e-03f;
+      } else {
+        sum += 1.0812164691742510e-04f;
+      }
+    } else {
+      if ( x4 >= 1.6035251617431641e+00f ) {
+        sum += -2.6006258558481932e-03f;
+      } else {
+        sum += 2.5186559651046991e-03f;
+      }
+    }
+    // tree 196
+    if ( x0 >= 6.4757728576660156e-01f ) {
+      if ( x3 >= 4.3667539954185486e-01f ) {
+        sum += -2.6349810650572181e-04f;
+      } else {
+        sum += 6.4683440141379833e-03f;
+      }
+    } else {
+      if ( x4 >= 1.8272185325622559e+00f ) {
+        sum += 4.1966992430388927e-03f;
+      } else {
+        sum += 4.6213006135076284e-04f;
+      }
+    }
+    // tree 197
+    if ( x3 >= 1.4672425985336304e+00f ) {
+      if ( x4 >= 1.8301885128021240e+00f ) {
+        sum += 1.5784841962158680e-03f;
+      } else {
+        sum += -1.6074096783995628e-03f;
+      }
+    } else {
+      if ( x4 >= 1.6387826204299927e+00f ) {
+        sum += -1.8670707941055298e-03f;
+      } else {
+        sum += 1.0277646360918880e-03f;
+      }
+    }
+    // tree 198
+    if ( x4 >= 3.2444250583648682e+00f ) {
+      if ( x4 >= 3.5090806484222412e+00f ) {
+        sum += -8.6538674077019095e-04f;
+      } else {
+        sum += -2.1495284512639046e-02f;
+      }
+    } else {
+      if ( x0 >= 2.3133325576782227e+00f ) {
+        sum += -4.0454440750181675e-03f;
+      } else {
+        sum += 1.9187378347851336e-04f;
+      }
+    }
+    // tree 199
+    if ( x5 >= 4.7540603637695312e+01f ) {
+      if ( x6 >= 1.4085465431213379e+01f ) {
+        sum += -4.6851858496665955e-04f;
+      } else {
+        sum += 1.3257085811346769e-03f;
+      }
+    } else {
+      if ( x6 >= 1.3073231697082520e+01f ) {
+        sum += 1.7044108826667070e-03f;
+      } else {
+        sum += -1.5716481721028686e-03f;
+      }
+    }
+    // CV: same transformation of the sum of responses as in TMVA::MethodBDT::GetGradBoostMVA
+    return 2./(1. + std::exp(-2.*sum)) - 1.;
+  }
+
+//--- BDT read from file = tthAnalysis/HiggsToTauTau/data/3l_ttbar_BDTG.weights.xml
+  const char* inputVariables_3l_ttbar_BDTG[] = {
+    "max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))",
+    "MT_met_lep1",
+    "nJet25_Recl",
+    "mhtJet25_Recl",
+    "avg_dr_jet",
+    "mindr_lep1_jet",
+    "mindr_lep2_jet"
+  };
+
+  double compiledBDT_3l_ttbar_BDTG(const Float_t* mvaInputs, const int* mvaInputIndices)
+  {
+    const Float_t x0 = mvaInputs[mvaInputIndices[0]];
+    const Float_t x1 = mvaInputs[mvaInputIndices[1]];
+    const Float_t x2 = mvaInputs[mvaInputIndices[2]];
+    const Float_t x3 = mvaInputs[mvaInputIndices[3]];
+    const Float_t x4 = mvaInputs[mvaInputIndices[4]];
+    const Float_t x5 = mvaInputs[mvaInputIndices[5]];
+    const Float_t x6 = mvaInputs[mvaInputIndices[6]];
+    if ( TMath::IsNaN(x0) || TMath::IsNaN(x1) || TMath::IsNaN(x2) || TMath::IsNaN(x3) || TMath::IsNaN(x4) || TMath::IsNaN(x5) || TMath::IsNaN(x6) ) return -999.;
+    double sum = 0.;
+    // tree 0
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x2 >= 3.0547263622283936e+00f ) {
+        sum += 3.9092496037483215e-02f;
+      } else {
+        sum += 6.1238775961101055e-03f;
+      }
+    } else {
+      if ( x2 >= 1.0049750804901123e+00f ) {
+        sum += -1.9854029640555382e-02f;
+      } else {
+        sum += -3.8013052195310593e-02f;
+      }
+    }
+    // tree 1
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 4.8361752182245255e-02f;
+      } else {
+        sum += 1.3628491200506687e-02f;
+      }
+    } else {
+      if ( x2 >= 1.0049750804901123e+00f ) {
+        sum += -1.8657004460692406e-02f;
+      } else {
+        sum += -3.6186706274747849e-02f;
+      }
+    }
+    // tree 2
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x0 >= 1.5940536260604858e+00f ) {
+        sum += 1.1186264455318451e-03f;
+      } else {
+        sum += 3.0223194509744644e-02f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += -1.7544731497764587e-02f;
+      } else {
+        sum += -3.4540560096502304e-02f;
+      }
+    }
+    // tree 3
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x2 >= 3.0547263622283936e+00f ) {
+        sum += 3.0630489811301231e-02f;
+      } else {
+        sum += 2.9967720620334148e-03f;
+      }
+    } else {
+      if ( x2 >= 1.0049750804901123e+00f ) {
+        sum += -1.6508474946022034e-02f;
+      } else {
+        sum += -3.3045347779989243e-02f;
+      }
+    }
+    // tree 4
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x4 >= 2.4232225418090820e+00f ) {
+        sum += 1.3746257536695339e-05f;
+      } else {
+        sum += 2.6901941746473312e-02f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += -1.5540844760835171e-02f;
+      } else {
+        sum += -3.1677685678005219e-02f;
+      }
+    }
+    // tree 5
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x0 >= 1.6188637018203735e+00f ) {
+        sum += -2.4328287690877914e-03f;
+      } else {
+        sum += 2.3957265540957451e-02f;
+      }
+    } else {
+      if ( x2 >= 1.0049750804901123e+00f ) {
+        sum += -1.4635544270277023e-02f;
+      } else {
+        sum += -3.0418680980801582e-02f;
+      }
+    }
+    // tree 6
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x2 >= 3.0547263622283936e+00f ) {
+        sum += 2.4751681834459305e-02f;
+      } else {
+        sum += 1.9450507534202188e-04f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += -1.3787156902253628e-02f;
+      } else {
+        sum += -2.9252903535962105e-02f;
+      }
+    }
+    // tree 7
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x4 >= 2.4232225418090820e+00f ) {
+        sum += -2.3556943051517010e-03f;
+      } else {
+        sum += 2.1691430360078812e-02f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += -1.2990984134376049e-02f;
+      } else {
+        sum += -2.8167637065052986e-02f;
+      }
+    }
+    // tree 8
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x0 >= 1.7056993246078491e+00f ) {
+        sum += -6.1878194101154804e-03f;
+      } else {
+        sum += 1.8600724637508392e-02f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += -1.2242931872606277e-02f;
+      } else {
+        sum += -2.7152318507432938e-02f;
+      }
+    }
+    // tree 9
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 3.0814995989203453e-02f;
+      } else {
+        sum += 3.6725569516420364e-03f;
+      }
+    } else {
+      if ( x2 >= 1.0049750804901123e+00f ) {
+        sum += -1.1539392173290253e-02f;
+      } else {
+        sum += -2.6198111474514008e-02f;
+      }
+    }
+    // tree 10
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x0 >= 1.5692434310913086e+00f ) {
+        sum += -4.5898966491222382e-03f;
+      } else {
+        sum += 1.7187012359499931e-02f;
+      }
+    } else {
+      if ( x2 >= 1.0049750804901123e+00f ) {
+        sum += -1.0877176187932491e-02f;
+      } else {
+        sum += -2.5297574698925018e-02f;
+      }
+    }
+    // tree 11
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x4 >= 2.4054546356201172e+00f ) {
+        sum += -4.3899496085941792e-03f;
+      } else {
+        sum += 1.7018293961882591e-02f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += -1.0253432206809521e-02f;
+      } else {
+        sum += -2.4444416165351868e-02f;
+      }
+    }
+    // tree 12
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x4 >= 2.1811122894287109e+00f ) {
+        sum += 7.4479239992797375e-03f;
+      } else {
+        sum += 3.0143832787871361e-02f;
+      }
+    } else {
+      if ( x2 >= 1.0099502801895142e+00f ) {
+        sum += -6.9892415776848793e-03f;
+      } else {
+        sum += -2.3633280768990517e-02f;
+      }
+    }
+    // tree 13
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x5 >= 1.4082870483398438e+00f ) {
+        sum += -4.6882983297109604e-03f;
+      } else {
+        sum += 1.4980553649365902e-02f;
+      }
+    } else {
+      if ( x3 >= 1.1196504974365234e+02f ) {
+        sum += -1.2693878961727023e-03f;
+      } else {
+        sum += -1.8393430858850479e-02f;
+      }
+    }
+    // tree 14
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x0 >= 1.7055922746658325e+00f ) {
+        sum += -3.0810674652457237e-03f;
+      } else {
+        sum += 2.0538598299026489e-02f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += -6.2770512886345387e-03f;
+      } else {
+        sum += -2.2367838770151138e-02f;
+      }
+    }
+    // tree 15
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x3 >= 1.1698811340332031e+02f ) {
+        sum += 2.1442636847496033e-02f;
+      } else {
+        sum += 2.1058182755950838e-04f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += -8.1089716404676437e-03f;
+      } else {
+        sum += -2.1648021414875984e-02f;
+      }
+    }
+    // tree 16
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x0 >= 1.1846115589141846e+00f ) {
+        sum += 3.0234816949814558e-03f;
+      } else {
+        sum += 2.2620599716901779e-02f;
+      }
+    } else {
+      if ( x3 >= 1.1196504974365234e+02f ) {
+        sum += 3.5018015187233686e-03f;
+      } else {
+        sum += -1.4084997586905956e-02f;
+      }
+    }
+    // tree 17
+    if ( x2 >= 2.0348258018493652e+00f ) {
+      if ( x4 >= 2.4232225418090820e+00f ) {
+        sum += -6.4541543833911419e-03f;
+      } else {
+        sum += 1.1864486150443554e-02f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += -7.1019530296325684e-03f;
+      } else {
+        sum += -2.0616710186004639e-02f;
+      }
+    }
+    // tree 18
+    if ( x5 >= 1.4672425985336304e+00f ) {
+      if ( x3 >= 1.2206582641601562e+02f ) {
+        sum += 6.9312518462538719e-03f;
+      } else {
+        sum += -1.5558434650301933e-02f;
+      }
+    } else {
+      if ( x6 >= 1.9770849943161011e+00f ) {
+        sum += -1.3614281080663204e-02f;
+      } else {
+        sum += 1.0721428319811821e-02f;
+      }
+    }
+    // tree 19
+    if ( x4 >= 2.4803299456834793e-02f ) {
+      if ( x3 >= 1.1698811340332031e+02f ) {
+        sum += 1.4193113893270493e-02f;
+      } else {
+        sum += -3.9869765751063824e-03f;
+      }
+    } else {
+      if ( x1 >= 1.4801522827148438e+02f ) {
+        sum += -1.0977870784699917e-02f;
+      } else {
+        sum += -2.2195769473910332e-02f;
+      }
+    }
+    // tree 20
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x4 >= 2.1811122894287109e+00f ) {
+        sum += 2.2847177460789680e-03f;
+      } else {
+        sum += 2.1906336769461632e-02f;
+      }
+    } else {
+      if ( x1 >= 1.6766712951660156e+02f ) {
+        sum += 6.5311472862958908e-03f;
+      } else {
+        sum += -1.1630036868155003e-02f;
+      }
+    }
+    // tree 21
+    if ( x5 >= 1.4672425985336304e+00f ) {
+      if ( x3 >= 1.3222125244140625e+02f ) {
+        sum += 8.6939064785838127e-03f;
+      } else {
+        sum += -1.3692057691514492e-02f;
+      }
+    } else {
+      if ( x6 >= 1.9770849943161011e+00f ) {
+        sum += -1.2603145092725754e-02f;
+      } else {
+        sum += 9.4966357573866844e-03f;
+      }
+    }
+    // tree 22
+    if ( x4 >= 2.4803299456834793e-02f ) {
+      if ( x0 >= 1.6312688589096069e+00f ) {
+        sum += -9.7237378358840942e-03f;
+      } else {
+        sum += 5.3099235519766808e-03f;
+      }
+    } else {
+      if ( x1 >= 2.1378680419921875e+02f ) {
+        sum += -7.6864875154569745e-04f;
+      } else {
+        sum += -1.9646417349576950e-02f;
+      }
+    }
+    // tree 23
+    if ( x5 >= 1.6589760780334473e+00f ) {
+      if ( x3 >= 1.1196504974365234e+02f ) {
+        sum += 2.6392093859612942e-03f;
+      } else {
+        sum += -1.5039077028632164e-02f;
+      }
+    } else {
+      if ( x6 >= 1.9985176324844360e+00f ) {
+        sum += -1.2994066812098026e-02f;
+      } else {
+        sum += 7.3382393456995487e-03f;
+      }
+    }
+    // tree 24
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x3 >= 1.6776522827148438e+02f ) {
+        sum += 2.3740587756037712e-02f;
+      } else {
+        sum += -1.8979654414579272e-03f;
+      }
+    } else {
+      if ( x1 >= 2.1378680419921875e+02f ) {
+        sum += -3.0504225287586451e-04f;
+      } else {
+        sum += -1.8719447776675224e-02f;
+      }
+    }
+    // tree 25
+    if ( x5 >= 1.3713759183883667e+00f ) {
+      if ( x3 >= 1.1191040039062500e+02f ) {
+        sum += 3.4621343947947025e-03f;
+      } else {
+        sum += -1.2330337427556515e-02f;
+      }
+    } else {
+      if ( x6 >= 1.6555953025817871e+00f ) {
+        sum += -7.9634459689259529e-03f;
+      } else {
+        sum += 1.0623239912092686e-02f;
+      }
+    }
+    // tree 26
+    if ( x2 >= 3.0049750804901123e+00f ) {
+      if ( x4 >= 2.1811122894287109e+00f ) {
+        sum += 8.3078781608492136e-04f;
+      } else {
+        sum += 1.8741657957434654e-02f;
+      }
+    } else {
+      if ( x1 >= 1.4954409790039062e+02f ) {
+        sum += 4.0195882320404053e-03f;
+      } else {
+        sum += -1.0519315488636494e-02f;
+      }
+    }
+    // tree 27
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x0 >= 1.7056993246078491e+00f ) {
+        sum += -9.7211627289652824e-03f;
+      } else {
+        sum += 4.2566307820379734e-03f;
+      }
+    } else {
+      if ( x3 >= 1.0035488891601562e+02f ) {
+        sum += -8.4619102999567986e-03f;
+      } else {
+        sum += -1.9082142040133476e-02f;
+      }
+    }
+    // tree 28
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x0 >= 1.3870105743408203e+00f ) {
+        sum += 4.9918871372938156e-03f;
+      } else {
+        sum += 2.2915931418538094e-02f;
+      }
+    } else {
+      if ( x3 >= 9.2507186889648438e+01f ) {
+        sum += 1.6562957316637039e-03f;
+      } else {
+        sum += -1.0019429028034210e-02f;
+      }
+    }
+    // tree 29
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x0 >= 1.1970908641815186e+00f ) {
+        sum += -5.3812018595635891e-03f;
+      } else {
+        sum += 6.7534893751144409e-03f;
+      }
+    } else {
+      if ( x1 >= 1.3979379272460938e+02f ) {
+        sum += -8.3458442240953445e-03f;
+      } else {
+        sum += -1.8549814820289612e-02f;
+      }
+    }
+    // tree 30
+    if ( x5 >= 1.7788094282150269e+00f ) {
+      if ( x3 >= 9.0663627624511719e+01f ) {
+        sum += -2.0162467844784260e-03f;
+      } else {
+        sum += -1.4519664458930492e-02f;
+      }
+    } else {
+      if ( x6 >= 1.9985176324844360e+00f ) {
+        sum += -1.1170607060194016e-02f;
+      } else {
+        sum += 5.3815525025129318e-03f;
+      }
+    }
+    // tree 31
+    if ( x6 >= 1.1452996730804443e+00f ) {
+      if ( x3 >= 1.7354211425781250e+02f ) {
+        sum += 1.7463149502873421e-02f;
+      } else {
+        sum += -8.2914270460605621e-03f;
+      }
+    } else {
+      if ( x5 >= 2.2276532649993896e+00f ) {
+        sum += -1.1618115939199924e-02f;
+      } else {
+        sum += 8.9496690779924393e-03f;
+      }
+    }
+    // tree 32
+    if ( x4 >= 2.4803299456834793e-02f ) {
+      if ( x4 >= 2.7880313396453857e+00f ) {
+        sum += -1.0272858664393425e-02f;
+      } else {
+        sum += 2.8556969482451677e-03f;
+      }
+    } else {
+      if ( x1 >= 2.1378680419921875e+02f ) {
+        sum += 1.4885511482134461e-03f;
+      } else {
+        sum += -1.5959447249770164e-02f;
+      }
+    }
+    // tree 33
+    if ( x5 >= 1.3713759183883667e+00f ) {
+      if ( x3 >= 1.2206582641601562e+02f ) {
+        sum += 5.2041416056454182e-03f;
+      } else {
+        sum += -9.5995217561721802e-03f;
+      }
+    } else {
+      if ( x6 >= 1.6555953025817871e+00f ) {
+        sum += -6.3865524716675282e-03f;
+      } else {
+        sum += 8.2836970686912537e-03f;
+      }
+    }
+    // tree 34
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x5 >= 2.0313971042633057e+00f ) {
+        sum += -1.3529273681342602e-02f;
+      } else {
+        sum += 1.4633358456194401e-02f;
+      }
+    } else {
+      if ( x3 >= 1.6859846496582031e+02f ) {
+        sum += 1.5426794067025185e-02f;
+      } else {
+        sum += -5.9067760594189167e-03f;
+      }
+    }
+    // tree 35
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x0 >= 1.7056993246078491e+00f ) {
+        sum += -8.1504955887794495e-03f;
+      } else {
+        sum += 3.4888046793639660e-03f;
+      }
+    } else {
+      if ( x1 >= 1.3979379272460938e+02f ) {
+        sum += -6.4538768492639065e-03f;
+      } else {
+        sum += -1.6723686829209328e-02f;
+      }
+    }
+    // tree 36
+    if ( x6 >= 1.1452996730804443e+00f ) {
+      if ( x3 >= 1.0251275634765625e+02f ) {
+        sum += 1.4954835642129183e-03f;
+      } else {
+        sum += -9.1888476163148880e-03f;
+      }
+    } else {
+      if ( x5 >= 2.2707026004791260e+00f ) {
+        sum += -1.0644230991601944e-02f;
+      } else {
+        sum += 7.5454795733094215e-03f;
+      }
+    }
+    // tree 37
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x4 >= 2.4255683422088623e+00f ) {
+        sum += -6.0853906907141209e-03f;
+      } else {
+        sum += 4.4918167404830456e-03f;
+      }
+    } else {
+      if ( x1 >= 2.1378680419921875e+02f ) {
+        sum += 2.1309042349457741e-03f;
+      } else {
+        sum += -1.4427226036787033e-02f;
+      }
+    }
+    // tree 38
+    if ( x5 >= 1.7788094282150269e+00f ) {
+      if ( x3 >= 9.0663627624511719e+01f ) {
+        sum += -1.0045849485322833e-03f;
+      } else {
+        sum += -1.1966140009462833e-02f;
+      }
+    } else {
+      if ( x6 >= 2.2128438949584961e+00f ) {
+        sum += -1.1487583629786968e-02f;
+      } else {
+        sum += 3.6819882225245237e-03f;
+      }
+    }
+    // tree 39
+    if ( x3 >= 1.3729896545410156e+02f ) {
+      if ( x0 >= 2.3303921222686768e+00f ) {
+        sum += -2.8452018275856972e-02f;
+      } else {
+        sum += 1.1442566290497780e-02f;
+      }
+    } else {
+      if ( x6 >= 2.0029020309448242e+00f ) {
+        sum += -1.1429635807871819e-02f;
+      } else {
+        sum += -1.4146482571959496e-03f;
+      }
+    }
+    // tree 40
+    if ( x0 >= 1.1846858263015747e+00f ) {
+      if ( x6 >= 2.2046909332275391e+00f ) {
+        sum += -1.4625510200858116e-02f;
+      } else {
+        sum += -3.5742453765124083e-03f;
+      }
+    } else {
+      if ( x1 >= 1.3461672973632812e+02f ) {
+        sum += 1.2451987713575363e-02f;
+      } else {
+        sum += -4.2735238093882799e-04f;
+      }
+    }
+    // tree 41
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x2 >= 6.0298509597778320e+00f ) {
+        sum += 2.7544094249606133e-02f;
+      } else {
+        sum += 8.1657227128744125e-03f;
+      }
+    } else {
+      if ( x1 >= 1.4952966308593750e+02f ) {
+        sum += 5.0509711727499962e-03f;
+      } else {
+        sum += -6.2171970494091511e-03f;
+      }
+    }
+    // tree 42
+    if ( x4 >= 2.4803299456834793e-02f ) {
+      if ( x4 >= 2.2669906616210938e+00f ) {
+        sum += -4.4893934391438961e-03f;
+      } else {
+        sum += 5.5381311103701591e-03f;
+      }
+    } else {
+      if ( x3 >= 1.5565309143066406e+02f ) {
+        sum += 5.6116385385394096e-03f;
+      } else {
+        sum += -1.3038110919296741e-02f;
+      }
+    }
+    // tree 43
+    if ( x3 >= 1.7284294128417969e+02f ) {
+      if ( x0 >= 2.2068164348602295e+00f ) {
+        sum += -1.5413456596434116e-02f;
+      } else {
+        sum += 1.8412280827760696e-02f;
+      }
+    } else {
+      if ( x6 >= 1.1452996730804443e+00f ) {
+        sum += -6.0343872755765915e-03f;
+      } else {
+        sum += 2.9509465675801039e-03f;
+      }
+    }
+    // tree 44
+    if ( x0 >= 9.1177392005920410e-01f ) {
+      if ( x6 >= 2.2551381587982178e+00f ) {
+        sum += -1.2957171536982059e-02f;
+      } else {
+        sum += -2.3896077182143927e-03f;
+      }
+    } else {
+      if ( x5 >= 1.3562432527542114e+00f ) {
+        sum += -1.0975267505273223e-03f;
+      } else {
+        sum += 1.1990283615887165e-02f;
+      }
+    }
+    // tree 45
+    if ( x3 >= 9.1599548339843750e+01f ) {
+      if ( x0 >= 9.1037470102310181e-01f ) {
+        sum += 1.6774413234088570e-04f;
+      } else {
+        sum += 1.1169515550136566e-02f;
+      }
+    } else {
+      if ( x6 >= 9.2036223411560059e-01f ) {
+        sum += -7.4653029441833496e-03f;
+      } else {
+        sum += 3.5908177960664034e-03f;
+      }
+    }
+    // tree 46
+    if ( x4 >= 2.4803299456834793e-02f ) {
+      if ( x4 >= 2.2669906616210938e+00f ) {
+        sum += -4.0438044816255569e-03f;
+      } else {
+        sum += 5.1579754799604416e-03f;
+      }
+    } else {
+      if ( x1 >= 1.3979379272460938e+02f ) {
+        sum += -4.3759620748460293e-03f;
+      } else {
+        sum += -1.4182435348629951e-02f;
+      }
+    }
+    // tree 47
+    if ( x5 >= 1.8507094383239746e+00f ) {
+      if ( x3 >= 8.2143058776855469e+01f ) {
+        sum += -1.8182053463533521e-03f;
+      } else {
+        sum += -1.1085578240454197e-02f;
+      }
+    } else {
+      if ( x6 >= 2.2128438949584961e+00f ) {
+        sum += -9.2932330444455147e-03f;
+      } else {
+        sum += 2.9761325567960739e-03f;
+      }
+    }
+    // tree 48
+    if ( x0 >= 1.9413958787918091e+00f ) {
+      if ( x6 >= 2.4689102172851562e+00f ) {
+        sum += -1.8916616216301918e-02f;
+      } else {
+        sum += -7.5737363658845425e-03f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += 2.2107858676463366e-03f;
+      } else {
+        sum += -1.0258358903229237e-02f;
+      }
+    }
+    // tree 49
+    if ( x1 >= 1.4957281494140625e+02f ) {
+      if ( x5 >= 6.1592698097229004e-01f ) {
+        sum += 3.8892601151019335e-03f;
+      } else {
+        sum += 3.3125922083854675e-02f;
+      }
+    } else {
+      if ( x2 >= 3.0049750804901123e+00f ) {
+        sum += 2.9339906759560108e-03f;
+      } else {
+        sum += -6.4223827794194221e-03f;
+      }
+    }
+    // tree 50
+    if ( x0 >= 1.1846858263015747e+00f ) {
+      if ( x3 >= 1.7894725036621094e+02f ) {
+        sum += 1.2449874542653561e-02f;
+      } else {
+        sum += -5.7939803227782249e-03f;
+      }
+    } else {
+      if ( x1 >= 1.3461672973632812e+02f ) {
+        sum += 1.0374984703958035e-02f;
+      } else {
+        sum += -2.9191171051934361e-04f;
+      }
+    }
+    // tree 51
+    if ( x5 >= 8.4410893917083740e-01f ) {
+      if ( x4 >= 2.8275761604309082e+00f ) {
+        sum += -1.0296752676367760e-02f;
+      } else {
+        sum += -1.6264308942481875e-03f;
+      }
+    } else {
+      if ( x1 >= 1.7948500061035156e+02f ) {
+        sum += 2.2588109597563744e-02f;
+      } else {
+        sum += 3.6997087299823761e-03f;
+      }
+    }
+    // tree 52
+    if ( x2 >= 4.0398011207580566e+00f ) {
+      if ( x2 >= 7.0149254798889160e+00f ) {
+        sum += 3.8408797234296799e-02f;
+      } else {
+        sum += 7.4613639153540134e-03f;
+      }
+    } else {
+      if ( x1 >= 1.4952966308593750e+02f ) {
+        sum += 4.1253096424043179e-03f;
+      } else {
+        sum += -4.7869561240077019e-03f;
+      }
+    }
+    // tree 53
+    if ( x0 >= 9.1177392005920410e-01f ) {
+      if ( x6 >= 2.4064798355102539e+00f ) {
+        sum += -1.2275117449462414e-02f;
+      } else {
+        sum += -1.9482041243463755e-03f;
+      }
+    } else {
+      if ( x4 >= 4.7360718250274658e-01f ) {
+        sum += 6.3752843998372555e-03f;
+      } else {
+        sum += -7.7241375111043453e-03f;
+      }
+    }
+    // tree 54
+    if ( x3 >= 9.1599548339843750e+01f ) {
+      if ( x0 >= 2.3208553791046143e+00f ) {
+        sum += -1.7227714881300926e-02f;
+      } else {
+        sum += 3.7217091303318739e-03f;
+      }
+    } else {
+      if ( x5 >= 2.2821097373962402e+00f ) {
+        sum += -1.1574415490031242e-02f;
+      } else {
+        sum += -2.1763439290225506e-03f;
+      }
+    }
+    // tree 55
+    if ( x0 >= 1.9413958787918091e+00f ) {
+      if ( x6 >= 2.4689102172851562e+00f ) {
+        sum += -1.7243528738617897e-02f;
+      } else {
+        sum += -6.3178567215800285e-03f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += 2.0385044626891613e-03f;
+      } else {
+        sum += -9.2768147587776184e-03f;
+      }
+    }
+    // tree 56
+    if ( x3 >= 1.7284294128417969e+02f ) {
+      if ( x0 >= 2.2068164348602295e+00f ) {
+        sum += -1.3363344594836235e-02f;
+      } else {
+        sum += 1.4569560997188091e-02f;
+      }
+    } else {
+      if ( x6 >= 1.1452996730804443e+00f ) {
+        sum += -4.5028897002339363e-03f;
+      } else {
+        sum += 2.4338676594197750e-03f;
+      }
+    }
+    // tree 57
+    if ( x0 >= 9.1177392005920410e-01f ) {
+      if ( x4 >= 2.3315100669860840e+00f ) {
+        sum += -7.0108841173350811e-03f;
+      } else {
+        sum += -3.3712430740706623e-04f;
+      }
+    } else {
+      if ( x5 >= 1.3562432527542114e+00f ) {
+        sum += -7.9842627746984363e-04f;
+      } else {
+        sum += 8.9397011324763298e-03f;
+      }
+    }
+    // tree 58
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x4 >= 2.1763749122619629e+00f ) {
+        sum += -2.9767388477921486e-03f;
+      } else {
+        sum += 5.4198103025555611e-03f;
+      }
+    } else {
+      if ( x1 >= 2.1378680419921875e+02f ) {
+        sum += 3.9145029149949551e-03f;
+      } else {
+        sum += -1.0423323139548302e-02f;
+      }
+    }
+    // tree 59
+    if ( x3 >= 9.1599548339843750e+01f ) {
+      if ( x0 >= 2.3332278728485107e+00f ) {
+        sum += -1.6122842207551003e-02f;
+      } else {
+        sum += 3.2874504104256630e-03f;
+      }
+    } else {
+      if ( x4 >= 2.8771827220916748e+00f ) {
+        sum += -1.1004269123077393e-02f;
+      } else {
+        sum += -2.3284482304006815e-03f;
+      }
+    }
+    // tree 60
+    if ( x5 >= 8.4410893917083740e-01f ) {
+      if ( x4 >= 2.8275761604309082e+00f ) {
+        sum += -8.7906466796994209e-03f;
+      } else {
+        sum += -1.2065155897289515e-03f;
+      }
+    } else {
+      if ( x1 >= 1.7948500061035156e+02f ) {
+        sum += 1.9541071727871895e-02f;
+      } else {
+        sum += 3.1273926142603159e-03f;
+      }
+    }
+    // tree 61
+    if ( x2 >= 1.0646766424179077e+00f ) {
+      if ( x4 >= 2.2669906616210938e+00f ) {
+        sum += -3.0695975292474031e-03f;
+      } else {
+        sum += 4.2559821158647537e-03f;
+      }
+    } else {
+      if ( x1 >= 2.1378680419921875e+02f ) {
+        sum += 3.5541760735213757e-03f;
+      } else {
+        sum += -1.0008813813328743e-02f;
+      }
+    }
+    // tree 62
+    if ( x0 >= 1.9413958787918091e+00f ) {
+      if ( x6 >= 2.4689102172851562e+00f ) {
+        sum += -1.6180196776986122e-02f;
+      } else {
+        sum += -5.3606564179062843e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0099501609802246e+00f ) {
+        sum += 1.7950918525457382e-02f;
+      } else {
+        sum += -5.8300123782828450e-04f;
+      }
+    }
+    // tree 63
+    if ( x1 >= 1.4957281494140625e+02f ) {
+      if ( x6 >= 2.6540973186492920e+00f ) {
+        sum += -9.3663549050688744e-03f;
+      } else {
+        sum += 6.7904358729720116e-03f;
+      }
+    } else {
+      if ( x1 >= 4.4653495788574219e+01f ) {
+        sum += -4.4521158561110497e-03f;
+      } else {
+        sum += 4.9653658643364906e-03f;
+      }
+    }
+    // tree 64
+    if ( x5 >= 2.2821097373962402e+00f ) {
+      if ( x4 >= 2.0834770202636719e+00f ) {
+        sum += -1.5709754079580307e-02f;
+      } else {
+        sum += -3.4700597170740366e-03f;
+      }
+    } else {
+      if ( x6 >= 2.0002629756927490e+00f ) {
+        sum += -5.9936186298727989e-03f;
+      } else {
+        sum += 2.2873412817716599e-03f;
+      }
+    }
+    // tree 65
+    if ( x0 >= 1.1102552413940430e+00f ) {
+      if ( x5 >= 2.2821097373962402e+00f ) {
+        sum += -1.0006965138018131e-02f;
+      } else {
+        sum += -1.5766273718327284e-03f;
+      }
+    } else {
+      if ( x1 >= 1.3461672973632812e+02f ) {
+        sum += 8.5664270445704460e-03f;
+      } else {
+        sum += 8.7400134361814708e-05f;
+      }
+    }
+    // tree 66
+    if ( x6 >= 1.1452996730804443e+00f ) {
+      if ( x3 >= 2.2427735900878906e+02f ) {
+        sum += 2.0665539428591728e-02f;
+      } else {
+        sum += -3.3870371989905834e-03f;
+      }
+    } else {
+      if ( x4 >= 2.7039301395416260e+00f ) {
+        sum += -5.5243144743144512e-03f;
+      } else {
+        sum += 5.2464995533227921e-03f;
+      }
+    }
+    // tree 67
+    if ( x4 >= 2.4803299456834793e-02f ) {
+      if ( x4 >= 2.1763749122619629e+00f ) {
+        sum += -2.3974378127604723e-03f;
+      } else {
+        sum += 4.6346029266715050e-03f;
+      }
+    } else {
+      if ( x3 >= 1.3863825988769531e+02f ) {
+        sum += 3.5714185796678066e-03f;
+      } else {
+        sum += -9.3190446496009827e-03f;
+      }
+    }
+    // tree 68
+    if ( x5 >= 5.8047550916671753e-01f ) {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 6.3308491371572018e-03f;
+      } else {
+        sum += -2.5246590375900269e-03f;
+      }
+    } else {
+      if ( x1 >= 1.0702696990966797e+02f ) {
+        sum += 2.0464744418859482e-02f;
+      } else {
+        sum += 4.8252660781145096e-03f;
+      }
+    }
+    // tree 69
+    if ( x0 >= 1.9413958787918091e+00f ) {
+      if ( x0 >= 2.3913190364837646e+00f ) {
+        sum += -1.8591260537505150e-02f;
+      } else {
+        sum += -5.3316252306103706e-03f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += 1.6777778510004282e-03f;
+      } else {
+        sum += -7.4305273592472076e-03f;
+      }
+    }
+    // tree 70
+    if ( x1 >= 1.3461672973632812e+02f ) {
+      if ( x6 >= 2.6609990596771240e+00f ) {
+        sum += -8.0608930438756943e-03f;
+      } else {
+        sum += 5.0278790295124054e-03f;
+      }
+    } else {
+      if ( x1 >= 4.6219516754150391e+01f ) {
+        sum += -4.6788724139332771e-03f;
+      } else {
+        sum += 4.5466818846762180e-03f;
+      }
+    }
+    // tree 71
+    if ( x3 >= 1.7792065429687500e+02f ) {
+      if ( x4 >= 1.4482877254486084e+00f ) {
+        sum += 7.8619429841637611e-03f;
+      } else {
+        sum += 2.2267768159508705e-02f;
+      }
+    } else {
+      if ( x2 >= 5.0099501609802246e+00f ) {
+        sum += 1.2510935775935650e-02f;
+      } else {
+        sum += -2.1730107255280018e-03f;
+      }
+    }
+    // tree 72
+    if ( x0 >= 9.1177392005920410e-01f ) {
+      if ( x5 >= 2.2102096080780029e+00f ) {
+        sum += -8.2873981446027756e-03f;
+      } else {
+        sum += -8.8798173237591982e-04f;
+      }
+    } else {
+      if ( x6 >= 9.6946841478347778e-01f ) {
+        sum += 8.8776421034708619e-04f;
+      } else {
+        sum += 9.6316561102867126e-03f;
+      }
+    }
+    // tree 73
+    if ( x3 >= 8.6521842956542969e+01f ) {
+      if ( x0 >= 2.3361749649047852e+00f ) {
+        sum += -1.3382648117840290e-02f;
+      } else {
+        sum += 2.4969850201159716e-03f;
+      }
+    } else {
+      if ( x2 >= 6.0149254798889160e+00f ) {
+        sum += 3.5181529819965363e-02f;
+      } else {
+        sum += -3.5877209156751633e-03f;
+      }
+    }
+    // tree 74
+    if ( x1 >= 1.6951426696777344e+02f ) {
+      if ( x5 >= 6.1592698097229004e-01f ) {
+        sum += 3.1914394348859787e-03f;
+      } else {
+        sum += 2.6963833719491959e-02f;
+      }
+    } else {
+      if ( x1 >= 4.6392330169677734e+01f ) {
+        sum += -3.2373210415244102e-03f;
+      } else {
+        sum += 4.1931346058845520e-03f;
+      }
+    }
+    // tree 75
+    if ( x5 >= 2.4978098869323730e+00f ) {
+      if ( x4 >= 2.0501964092254639e+00f ) {
+        sum += -1.6708001494407654e-02f;
+      } else {
+        sum += -3.5020138602703810e-03f;
+      }
+    } else {
+      if ( x6 >= 2.4235706329345703e+00f ) {
+        sum += -7.4619525112211704e-03f;
+      } else {
+        sum += 1.2058955617249012e-03f;
+      }
+    }
+    // tree 76
+    if ( x0 >= 2.1150670051574707e+00f ) {
+      if ( x0 >= 2.3982300758361816e+00f ) {
+        sum += -1.7749281600117683e-02f;
+      } else {
+        sum += -6.1488286592066288e-03f;
+      }
+    } else {
+      if ( x2 >= 1.0646766424179077e+00f ) {
+        sum += 1.2077521532773972e-03f;
+      } else {
+        sum += -6.7012794315814972e-03f;
+      }
+    }
+    // tree 77
+    if ( x1 >= 1.3461672973632812e+02f ) {
+      if ( x0 >= 2.2841036319732666e+00f ) {
+        sum += -1.3374360278248787e-02f;
+      } else {
+        sum += 3.9163143374025822e-03f;
+      }
+    } else {
+      if ( x1 >= 4.6219516754150391e+01f ) {
+        sum += -4.0392326191067696e-03f;
+      } else {
+        sum += 3.9301905781030655e-03f;
+      }
+    }
+    // tree 78
+    if ( x0 >= 9.1177392005920410e-01f ) {
+      if ( x3 >= 2.2725712585449219e+02f ) {
+        sum += 2.0878540351986885e-02f;
+      } else {
+        sum += -2.5977683253586292e-03f;
+      }
+    } else {
+      if ( x5 >= 1.3562432527542114e+00f ) {
+        sum += -4.3433788232505322e-04f;
+      } else {
+        sum += 6.6993590444326401e-03f;
+      }
+    }
+    // tree 79
+    if ( x4 >= 2.8275761604309082e+00f ) {
+      if ( x3 >= 1.1787094879150391e+02f ) {
+        sum += 5.7247211225330830e-03f;
+      } else {
+        sum += -7.6764537952840328e-03f;
+      }
+    } else {
+      if ( x4 >= 1.4067060314118862e-02f ) {
+        sum += 1.6283354489132762e-03f;
+      } else {
+        sum += -6.6631538793444633e-03f;
+      }
+    }
+    // tree 80
+    if ( x5 >= 5.8047550916671753e-01f ) {
+      if ( x4 >= 2.8275761604309082e+00f ) {
+        sum += -5.8410414494574070e-03f;
+      } else {
+        sum += -2.0018877694383264e-04f;
+      }
+    } else {
+      if ( x0 >= 1.1601376533508301e+00f ) {
+        sum += 3.6508694756776094e-03f;
+      } else {
+        sum += 1.9976150244474411e-02f;
+      }
+    }
+    // tree 81
+    if ( x1 >= 1.1966063690185547e+02f ) {
+      if ( x6 >= 1.9805433750152588e+00f ) {
+        sum += -4.1534327901899815e-03f;
+      } else {
+        sum += 5.0327661447227001e-03f;
+      }
+    } else {
+      if ( x1 >= 4.5841602325439453e+01f ) {
+        sum += -4.5104310847818851e-03f;
+      } else {
+        sum += 3.7225824780762196e-03f;
+      }
+    }
+    // tree 82
+    if ( x6 >= 1.1200760602951050e+00f ) {
+      if ( x4 >= 2.3067069053649902e+00f ) {
+        sum += -4.5605143532156944e-03f;
+      } else {
+        sum += -3.8671187940053642e-04f;
+      }
+    } else {
+      if ( x4 >= 2.7039301395416260e+00f ) {
+        sum += -4.5447717420756817e-03f;
+      } else {
+        sum += 4.2679510079324245e-03f;
+      }
+    }
+    // tree 83
+    if ( x5 >= 2.4978098869323730e+00f ) {
+      if ( x4 >= 1.4156117439270020e+00f ) {
+        sum += -1.3228650204837322e-02f;
+      } else {
+        sum += -1.4969645999372005e-03f;
+      }
+    } else {
+      if ( x4 >= 9.4252538681030273e-01f ) {
+        sum += 1.2053378159180284e-03f;
+      } else {
+        sum += -6.6442824900150299e-03f;
+      }
+    }
+    // tree 84
+    if ( x3 >= 8.6521842956542969e+01f ) {
+      if ( x6 >= 3.2640821933746338e+00f ) {
+        sum += -1.6181409358978271e-02f;
+      } else {
+        sum += 2.0940816029906273e-03f;
+      }
+    } else {
+      if ( x2 >= 6.0149254798889160e+00f ) {
+        sum += 3.1704146414995193e-02f;
+      } else {
+        sum += -3.0122573953121901e-03f;
+      }
+    }
+    // tree 85
+    if ( x0 >= 2.1150670051574707e+00f ) {
+      if ( x0 >= 2.3982300758361816e+00f ) {
+        sum += -1.6189416870474815e-02f;
+      } else {
+        sum += -5.3284456953406334e-03f;
+      }
+    } else {
+      if ( x3 >= 1.7284294128417969e+02f ) {
+        sum += 9.4956550747156143e-03f;
+      } else {
+        sum += -5.3316098637878895e-04f;
+      }
+    }
+    // tree 86
+    if ( x1 >= 1.0968991088867188e+02f ) {
+      if ( x6 >= 1.9805433750152588e+00f ) {
+        sum += -3.9138863794505596e-03f;
+      } else {
+        sum += 4.2719924822449684e-03f;
+      }
+    } else {
+      if ( x1 >= 4.5845710754394531e+01f ) {
+        sum += -4.8288730904459953e-03f;
+      } else {
+        sum += 3.4825054462999105e-03f;
+      }
+    }
+    // tree 87
+    if ( x0 >= 1.1846858263015747e+00f ) {
+      if ( x6 >= 2.2551381587982178e+00f ) {
+        sum += -7.7616535127162933e-03f;
+      } else {
+        sum += -1.0900193592533469e-03f;
+      }
+    } else {
+      if ( x5 >= 4.8456269502639771e-01f ) {
+        sum += 1.3170280726626515e-03f;
+      } else {
+        sum += 3.9168179035186768e-02f;
+      }
+    }
+    // tree 88
+    if ( x5 >= 2.4978098869323730e+00f ) {
+      if ( x4 >= 2.0501964092254639e+00f ) {
+        sum += -1.4820369891822338e-02f;
+      } else {
+        sum += -2.4970518425107002e-03f;
+      }
+    } else {
+      if ( x4 >= 9.4252538681030273e-01f ) {
+        sum += 1.1170292273163795e-03f;
+      } else {
+        sum += -6.1684758402407169e-03f;
+      }
+    }
+    // tree 89
+    if ( x4 >= 2.3315100669860840e+00f ) {
+      if ( x5 >= 2.2614154815673828e+00f ) {
+        sum += -1.3053824193775654e-02f;
+      } else {
+        sum += -1.6043679788708687e-03f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 5.1307748071849346e-03f;
+      } else {
+        sum += -3.3276635222136974e-03f;
+      }
+    }
+    // tree 90
+    if ( x1 >= 1.4957281494140625e+02f ) {
+      if ( x5 >= 6.1592698097229004e-01f ) {
+        sum += 1.9989674910902977e-03f;
+      } else {
+        sum += 1.9040260463953018e-02f;
+      }
+    } else {
+      if ( x4 >= 2.9019861221313477e+00f ) {
+        sum += -7.3831747286021709e-03f;
+      } else {
+        sum += -6.8785488838329911e-04f;
+      }
+    }
+    // tree 91
+    if ( x0 >= 9.1177392005920410e-01f ) {
+      if ( x4 >= 2.3315100669860840e+00f ) {
+        sum += -4.4815829023718834e-03f;
+      } else {
+        sum += 2.8966472018510103e-04f;
+      }
+    } else {
+      if ( x6 >= 4.9516946077346802e-01f ) {
+        sum += 1.9340729340910912e-03f;
+      } else {
+        sum += 2.4193862453103065e-02f;
+      }
+    }
+    // tree 92
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x0 >= 1.6144337654113770e+00f ) {
+        sum += -1.9104210659861565e-02f;
+      } else {
+        sum += -1.0630675591528416e-02f;
+      }
+    } else {
+      if ( x1 >= 1.0968991088867188e+02f ) {
+        sum += 2.1761583629995584e-03f;
+      } else {
+        sum += -1.9187631551176310e-03f;
+      }
+    }
+    // tree 93
+    if ( x0 >= 2.1150670051574707e+00f ) {
+      if ( x1 >= 2.1776937484741211e+01f ) {
+        sum += -7.0005846209824085e-03f;
+      } else {
+        sum += 7.3902928270399570e-03f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += 9.9690468050539494e-04f;
+      } else {
+        sum += -5.3728683851659298e-03f;
+      }
+    }
+    // tree 94
+    if ( x3 >= 8.6521842956542969e+01f ) {
+      if ( x0 >= 2.3361749649047852e+00f ) {
+        sum += -1.0314647108316422e-02f;
+      } else {
+        sum += 1.8874171655625105e-03f;
+      }
+    } else {
+      if ( x6 >= 9.4244462251663208e-01f ) {
+        sum += -3.7213237956166267e-03f;
+      } else {
+        sum += 3.1814510002732277e-03f;
+      }
+    }
+    // tree 95
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x0 >= 1.8925414085388184e+00f ) {
+        sum += -1.9516156986355782e-02f;
+      } else {
+        sum += -1.1762998998165131e-02f;
+      }
+    } else {
+      if ( x4 >= 2.1826903820037842e+00f ) {
+        sum += -1.9854072015732527e-03f;
+      } else {
+        sum += 1.8934455001726747e-03f;
+      }
+    }
+    // tree 96
+    if ( x4 >= 2.4803299456834793e-02f ) {
+      if ( x4 >= 2.0857591629028320e+00f ) {
+        sum += -1.5339622041210532e-03f;
+      } else {
+        sum += 4.2559732683002949e-03f;
+      }
+    } else {
+      if ( x1 >= 1.3979379272460938e+02f ) {
+        sum += 5.5516755674034357e-04f;
+      } else {
+        sum += -8.2198269665241241e-03f;
+      }
+    }
+    // tree 97
+    if ( x5 >= 7.0030885934829712e-01f ) {
+      if ( x4 >= 3.2988388538360596e+00f ) {
+        sum += -9.0416260063648224e-03f;
+      } else {
+        sum += -6.1332865152508020e-04f;
+      }
+    } else {
+      if ( x6 >= 1.6721904277801514e+00f ) {
+        sum += -3.8576454389840364e-03f;
+      } else {
+        sum += 8.2963192835450172e-03f;
+      }
+    }
+    // tree 98
+    if ( x1 >= 1.0968991088867188e+02f ) {
+      if ( x6 >= 1.9805433750152588e+00f ) {
+        sum += -3.3058465924113989e-03f;
+      } else {
+        sum += 3.6176533903926611e-03f;
+      }
+    } else {
+      if ( x1 >= 4.5845710754394531e+01f ) {
+        sum += -4.2272699065506458e-03f;
+      } else {
+        sum += 3.3960433211177588e-03f;
+      }
+    }
+    // tree 99
+    if ( x3 >= 1.7792065429687500e+02f ) {
+      if ( x4 >= 1.2146929502487183e+00f ) {
+        sum += 4.5627527870237827e-03f;
+      } else {
+        sum += 2.1224182099103928e-02f;
+      }
+    } else {
+      if ( x2 >= 5.0099501609802246e+00f ) {
+        sum += 9.2136291787028313e-03f;
+      } else {
+        sum += -1.3692765496671200e-03f;
+      }
+    }
+    // tree 100
+    if ( x0 >= 9.1177392005920410e-01f ) {
+      if ( x3 >= 2.2725712585449219e+02f ) {
+        sum += 1.7264220863580704e-02f;
+      } else {
+        sum += -1.8834671936929226e-03f;
+      }
+    } else {
+      if ( x6 >= 4.9516946077346802e-01f ) {
+        sum += 1.7722856719046831e-03f;
+      } else {
+        sum += 2.1664079278707504e-02f;
+      }
+    }
+    // tree 101
+    if ( x5 >= 2.4978098869323730e+00f ) {
+      if ( x4 >= 1.4156117439270020e+00f ) {
+        sum += -1.1331095360219479e-02f;
+      } else {
+        sum += -5.1095656817778945e-04f;
+      }
+    } else {
+      if ( x4 >= 9.4252538681030273e-01f ) {
+        sum += 1.0032416321337223e-03f;
+      } else {
+        sum += -5.4538082331418991e-03f;
+      }
+    }
+    // tree 102
+    if ( x0 >= 1.9413958787918091e+00f ) {
+      if ( x5 >= 3.0495264530181885e+00f ) {
+        sum += -1.9395580515265465e-02f;
+      } else {
+        sum += -2.9765618965029716e-03f;
+      }
+    } else {
+      if ( x4 >= 4.7126269340515137e-01f ) {
+        sum += 1.1219846783205867e-03f;
+      } else {
+        sum += -4.7530541196465492e-03f;
+      }
+    }
+    // tree 103
+    if ( x1 >= 1.6951426696777344e+02f ) {
+      if ( x0 >= 2.6703941822052002e-01f ) {
+        sum += 2.7228943072259426e-03f;
+      } else {
+        sum += 3.1003113836050034e-02f;
+      }
+    } else {
+      if ( x1 >= 4.2175926208496094e+01f ) {
+        sum += -2.0439068321138620e-03f;
+      } else {
+        sum += 3.3299485221505165e-03f;
+      }
+    }
+    // tree 104
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x0 >= 1.6144337654113770e+00f ) {
+        sum += -1.7663959413766861e-02f;
+      } else {
+        sum += -9.1060260310769081e-03f;
+      }
+    } else {
+      if ( x4 >= 2.1826903820037842e+00f ) {
+        sum += -1.7700312891975045e-03f;
+      } else {
+        sum += 1.7500094836577773e-03f;
+      }
+    }
+    // tree 105
+    if ( x1 >= 1.0968991088867188e+02f ) {
+      if ( x6 >= 1.9805433750152588e+00f ) {
+        sum += -2.9404973611235619e-03f;
+      } else {
+        sum += 3.3187500666826963e-03f;
+      }
+    } else {
+      if ( x1 >= 4.5845710754394531e+01f ) {
+        sum += -3.7628808058798313e-03f;
+      } else {
+        sum += 2.8958914335817099e-03f;
+      }
+    }
+    // tree 106
+    if ( x5 >= 3.0490434169769287e+00f ) {
+      if ( x4 >= 1.4680558443069458e+00f ) {
+        sum += -2.3228285834193230e-02f;
+      } else {
+        sum += -4.3911561369895935e-03f;
+      }
+    } else {
+      if ( x4 >= 3.2740354537963867e+00f ) {
+        sum += -6.8299616686999798e-03f;
+      } else {
+        sum += 3.3839041134342551e-04f;
+      }
+    }
+    // tree 107
+    if ( x3 >= 7.1288703918457031e+01f ) {
+      if ( x0 >= 7.3763597011566162e-01f ) {
+        sum += -1.2151950068073347e-04f;
+      } else {
+        sum += 4.9895271658897400e-03f;
+      }
+    } else {
+      if ( x2 >= 6.0149254798889160e+00f ) {
+        sum += 3.2048914581537247e-02f;
+      } else {
+        sum += -2.7863371651619673e-03f;
+      }
+    }
+    // tree 108
+    if ( x5 >= 5.8047550916671753e-01f ) {
+      if ( x4 >= 3.2988388538360596e+00f ) {
+        sum += -7.4216043576598167e-03f;
+      } else {
+        sum += -3.5427190596237779e-04f;
+      }
+    } else {
+      if ( x1 >= 2.8932649612426758e+01f ) {
+        sum += 9.8835388198494911e-03f;
+      } else {
+        sum += -9.1947354376316071e-03f;
+      }
+    }
+    // tree 109
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x0 >= 1.6144337654113770e+00f ) {
+        sum += -1.7047697678208351e-02f;
+      } else {
+        sum += -8.5526444017887115e-03f;
+      }
+    } else {
+      if ( x4 >= 2.1826903820037842e+00f ) {
+        sum += -1.6050272388383746e-03f;
+      } else {
+        sum += 1.6354824183508754e-03f;
+      }
+    }
+    // tree 110
+    if ( x0 >= 2.3507637977600098e+00f ) {
+      if ( x4 >= 2.2769937515258789e+00f ) {
+        sum += -1.6496406868100166e-02f;
+      } else {
+        sum += -9.5839740242809057e-04f;
+      }
+    } else {
+      if ( x4 >= 4.7126269340515137e-01f ) {
+        sum += 6.3378224149346352e-04f;
+      } else {
+        sum += -4.6103904023766518e-03f;
+      }
+    }
+    // tree 111
+    if ( x5 >= 3.0490434169769287e+00f ) {
+      if ( x4 >= 1.4680558443069458e+00f ) {
+        sum += -2.2377200424671173e-02f;
+      } else {
+        sum += -4.0012458339333534e-03f;
+      }
+    } else {
+      if ( x4 >= 2.1826903820037842e+00f ) {
+        sum += -1.4406086411327124e-03f;
+      } else {
+        sum += 1.6937997424975038e-03f;
+      }
+    }
+    // tree 112
+    if ( x1 >= 1.0968991088867188e+02f ) {
+      if ( x6 >= 1.9805433750152588e+00f ) {
+        sum += -2.6875960174947977e-03f;
+      } else {
+        sum += 3.0768143478780985e-03f;
+      }
+    } else {
+      if ( x1 >= 4.5845710754394531e+01f ) {
+        sum += -3.4565143287181854e-03f;
+      } else {
+        sum += 2.7545536868274212e-03f;
+      }
+    }
+    // tree 113
+    if ( x0 >= 2.1150670051574707e+00f ) {
+      if ( x1 >= 1.2461792945861816e+01f ) {
+        sum += -5.3342385217547417e-03f;
+      } else {
+        sum += 1.2419118545949459e-02f;
+      }
+    } else {
+      if ( x4 >= 2.4803299456834793e-02f ) {
+        sum += 8.3873572293668985e-04f;
+      } else {
+        sum += -4.2396187782287598e-03f;
+      }
+    }
+    // tree 114
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x0 >= 1.2672405242919922e+00f ) {
+        sum += 3.9817798882722855e-02f;
+      } else {
+        sum += 1.5194222331047058e-02f;
+      }
+    } else {
+      if ( x3 >= 7.1288703918457031e+01f ) {
+        sum += 7.2530726902186871e-04f;
+      } else {
+        sum += -2.2216935176402330e-03f;
+      }
+    }
+    // tree 115
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x0 >= 1.6144337654113770e+00f ) {
+        sum += -1.6342313960194588e-02f;
+      } else {
+        sum += -7.8695304691791534e-03f;
+      }
+    } else {
+      if ( x1 >= 1.6951426696777344e+02f ) {
+        sum += 3.4704429563134909e-03f;
+      } else {
+        sum += -6.9018808426335454e-04f;
+      }
+    }
+    // tree 116
+    if ( x5 >= 2.4978098869323730e+00f ) {
+      if ( x4 >= 1.4156117439270020e+00f ) {
+        sum += -1.0227480903267860e-02f;
+      } else {
+        sum += 1.6657129162922502e-04f;
+      }
+    } else {
+      if ( x4 >= 9.4252538681030273e-01f ) {
+        sum += 9.0862886281684041e-04f;
+      } else {
+        sum += -4.7884751111268997e-03f;
+      }
+    }
+    // tree 117
+    if ( x5 >= 5.8047550916671753e-01f ) {
+      if ( x4 >= 2.9763958454132080e+00f ) {
+        sum += -4.4774203561246395e-03f;
+      } else {
+        sum += -9.8776341474149376e-05f;
+      }
+    } else {
+      if ( x3 >= 5.2603851318359375e+01f ) {
+        sum += 4.0893685072660446e-03f;
+      } else {
+        sum += 2.3139154538512230e-02f;
+      }
+    }
+    // tree 118
+    if ( x0 >= 2.3507637977600098e+00f ) {
+      if ( x4 >= 2.2769937515258789e+00f ) {
+        sum += -1.5333587303757668e-02f;
+      } else {
+        sum += -4.4665232417173684e-04f;
+      }
+    } else {
+      if ( x3 >= 1.7792065429687500e+02f ) {
+        sum += 6.3452566973865032e-03f;
+      } else {
+        sum += -4.5500797568820417e-04f;
+      }
+    }
+    // tree 119
+    if ( x5 >= 3.0490434169769287e+00f ) {
+      if ( x4 >= 9.0674036741256714e-01f ) {
+        sum += -1.8004443496465683e-02f;
+      } else {
+        sum += -2.2024009376764297e-03f;
+      }
+    } else {
+      if ( x4 >= 2.1826903820037842e+00f ) {
+        sum += -1.3679040130227804e-03f;
+      } else {
+        sum += 1.6416844446212053e-03f;
+      }
+    }
+    // tree 120
+    if ( x0 >= 9.1177392005920410e-01f ) {
+      if ( x6 >= 2.5325977802276611e+00f ) {
+        sum += -7.1283383294939995e-03f;
+      } else {
+        sum += -3.9159724838100374e-04f;
+      }
+    } else {
+      if ( x6 >= 2.3220987319946289e+00f ) {
+        sum += 8.9622111991047859e-03f;
+      } else {
+        sum += 1.1276137083768845e-03f;
+      }
+    }
+    // tree 121
+    if ( x4 >= 2.4803299456834793e-02f ) {
+      if ( x4 >= 1.9498355388641357e+00f ) {
+        sum += -9.2522829072549939e-04f;
+      } else {
+        sum += 4.1634147055447102e-03f;
+      }
+    } else {
+      if ( x1 >= 1.3979379272460938e+02f ) {
+        sum += 1.5438720583915710e-03f;
+      } else {
+        sum += -6.8701370619237423e-03f;
+      }
+    }
+    // tree 122
+    if ( x6 >= 1.1200760602951050e+00f ) {
+      if ( x3 >= 2.5471852111816406e+02f ) {
+        sum += 1.6973728314042091e-02f;
+      } else {
+        sum += -1.4165523461997509e-03f;
+      }
+    } else {
+      if ( x5 >= 2.2276532649993896e+00f ) {
+        sum += -4.8481258563697338e-03f;
+      } else {
+        sum += 2.6273671537637711e-03f;
+      }
+    }
+    // tree 123
+    if ( x1 >= 1.0968991088867188e+02f ) {
+      if ( x6 >= 1.9805433750152588e+00f ) {
+        sum += -2.3572065401822329e-03f;
+      } else {
+        sum += 2.7229939587414265e-03f;
+      }
+    } else {
+      if ( x1 >= 4.5845710754394531e+01f ) {
+        sum += -3.1209886074066162e-03f;
+      } else {
+        sum += 2.5879284366965294e-03f;
+      }
+    }
+    // tree 124
+    if ( x0 >= 2.4003839492797852e+00f ) {
+      if ( x6 >= 1.4454586505889893e+00f ) {
+        sum += -6.6467258147895336e-03f;
+      } else {
+        sum += -1.7141457647085190e-02f;
+      }
+    } else {
+      if ( x2 >= 5.0099501609802246e+00f ) {
+        sum += 7.0116431452333927e-03f;
+      } else {
+        sum += -4.7343739424832165e-04f;
+      }
+    }
+    // tree 125
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x0 >= 1.6144337654113770e+00f ) {
+        sum += -1.5476408414542675e-02f;
+      } else {
+        sum += -7.1139466017484665e-03f;
+      }
+    } else {
+      if ( x1 >= 1.0968991088867188e+02f ) {
+        sum += 1.5010975766927004e-03f;
+      } else {
+        sum += -1.1818645289167762e-03f;
+      }
+    }
+    // tree 126
+    if ( x5 >= 4.8460876941680908e-01f ) {
+      if ( x4 >= 3.2988388538360596e+00f ) {
+        sum += -5.9900307096540928e-03f;
+      } else {
+        sum += -1.2296219938434660e-04f;
+      }
+    } else {
+      if ( x1 >= 5.8025581359863281e+01f ) {
+        sum += 2.0936129614710808e-02f;
+      } else {
+        sum += -1.0025366209447384e-02f;
+      }
+    }
+    // tree 127
+    if ( x0 >= 1.6312688589096069e+00f ) {
+      if ( x3 >= 1.1301740264892578e+02f ) {
+        sum += 2.9818171169608831e-03f;
+      } else {
+        sum += -3.6950963549315929e-03f;
+      }
+    } else {
+      if ( x5 >= 4.8411676287651062e-01f ) {
+        sum += 3.8232718361541629e-04f;
+      } else {
+        sum += 2.1237358450889587e-02f;
+      }
+    }
+    // tree 128
+    if ( x5 >= 3.0490434169769287e+00f ) {
+      if ( x4 >= 1.4680558443069458e+00f ) {
+        sum += -2.0352169871330261e-02f;
+      } else {
+        sum += -2.9388896655291319e-03f;
+      }
+    } else {
+      if ( x4 >= 2.1826903820037842e+00f ) {
+        sum += -1.2202318757772446e-03f;
+      } else {
+        sum += 1.4911597827449441e-03f;
+      }
+    }
+    // tree 129
+    if ( x4 >= 4.7126269340515137e-01f ) {
+      if ( x4 >= 1.9132646322250366e+00f ) {
+        sum += -7.7783333836123347e-04f;
+      } else {
+        sum += 4.0200892835855484e-03f;
+      }
+    } else {
+      if ( x3 >= 1.3863825988769531e+02f ) {
+        sum += 6.3050701282918453e-03f;
+      } else {
+        sum += -5.0046206451952457e-03f;
+      }
+    }
+    // tree 130
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x0 >= 1.8925414085388184e+00f ) {
+        sum += -1.6094645485281944e-02f;
+      } else {
+        sum += -8.3809373900294304e-03f;
+      }
+    } else {
+      if ( x1 >= 1.6951426696777344e+02f ) {
+        sum += 2.9120610561221838e-03f;
+      } else {
+        sum += -5.5496691493317485e-04f;
+      }
+    }
+    // tree 131
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x6 >= 1.1365180015563965e+00f ) {
+        sum += -2.1744756959378719e-03f;
+      } else {
+        sum += 3.6402724683284760e-02f;
+      }
+    } else {
+      if ( x0 >= 9.1177392005920410e-01f ) {
+        sum += -1.0969425784423947e-03f;
+      } else {
+        sum += 1.4998881379142404e-03f;
+      }
+    }
+    // tree 132
+    if ( x0 >= 2.4003839492797852e+00f ) {
+      if ( x6 >= 1.4454586505889893e+00f ) {
+        sum += -5.9438808821141720e-03f;
+      } else {
+        sum += -1.5894813463091850e-02f;
+      }
+    } else {
+      if ( x3 >= 2.5408633422851562e+02f ) {
+        sum += 1.1919829063117504e-02f;
+      } else {
+        sum += -2.2938736947253346e-04f;
+      }
+    }
+    // tree 133
+    if ( x1 >= 4.4880187988281250e+01f ) {
+      if ( x1 >= 1.1631616210937500e+02f ) {
+        sum += 1.1693969136103988e-03f;
+      } else {
+        sum += -2.3849036078900099e-03f;
+      }
+    } else {
+      if ( x5 >= 1.9945095777511597e+00f ) {
+        sum += -2.3570063058286905e-03f;
+      } else {
+        sum += 5.2514276467263699e-03f;
+      }
+    }
+    // tree 134
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x3 >= 9.3311088562011719e+01f ) {
+        sum += -1.3037209399044514e-02f;
+      } else {
+        sum += -1.0080180130898952e-02f;
+      }
+    } else {
+      if ( x4 >= 3.2740354537963867e+00f ) {
+        sum += -4.9269441515207291e-03f;
+      } else {
+        sum += 2.1943057072348893e-04f;
+      }
+    }
+    // tree 135
+    if ( x4 >= 4.7126269340515137e-01f ) {
+      if ( x4 >= 1.9132646322250366e+00f ) {
+        sum += -7.1934965671971440e-04f;
+      } else {
+        sum += 3.7631620652973652e-03f;
+      }
+    } else {
+      if ( x3 >= 1.0035488891601562e+02f ) {
+        sum += 1.9483821233734488e-03f;
+      } else {
+        sum += -6.0316435992717743e-03f;
+      }
+    }
+    // tree 136
+    if ( x3 >= 1.5433870315551758e+01f ) {
+      if ( x6 >= 1.1200760602951050e+00f ) {
+        sum += -9.2185719404369593e-04f;
+      } else {
+        sum += 1.6650380566716194e-03f;
+      }
+    } else {
+      if ( x5 >= 9.4853764772415161e-01f ) {
+        sum += -1.4800678938627243e-02f;
+      } else {
+        sum += 1.2035014107823372e-02f;
+      }
+    }
+    // tree 137
+    if ( x0 >= 2.2763330936431885e+00f ) {
+      if ( x5 >= 9.5063483715057373e-01f ) {
+        sum += -7.6290243305265903e-03f;
+      } else {
+        sum += 5.5766962468624115e-03f;
+      }
+    } else {
+      if ( x4 >= 4.7126269340515137e-01f ) {
+        sum += 5.5265426635742188e-04f;
+      } else {
+        sum += -3.3757803030312061e-03f;
+      }
+    }
+    // tree 138
+    if ( x5 >= 3.0490434169769287e+00f ) {
+      if ( x4 >= 9.0674036741256714e-01f ) {
+        sum += -1.6497643664479256e-02f;
+      } else {
+        sum += -8.1674417015165091e-04f;
+      }
+    } else {
+      if ( x1 >= 4.4880187988281250e+01f ) {
+        sum += -5.0195195944979787e-04f;
+      } else {
+        sum += 2.8280292171984911e-03f;
+      }
+    }
+    // tree 139
+    if ( x3 >= 7.1288703918457031e+01f ) {
+      if ( x0 >= 7.3763597011566162e-01f ) {
+        sum += -1.2997294834349304e-04f;
+      } else {
+        sum += 3.7903531920164824e-03f;
+      }
+    } else {
+      if ( x0 >= 1.3858841359615326e-01f ) {
+        sum += -1.2437236728146672e-03f;
+      } else {
+        sum += -2.5871524587273598e-02f;
+      }
+    }
+    // tree 140
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x0 >= 1.6144337654113770e+00f ) {
+        sum += -1.4023909345269203e-02f;
+      } else {
+        sum += -5.6169177405536175e-03f;
+      }
+    } else {
+      if ( x1 >= 1.0968991088867188e+02f ) {
+        sum += 1.3226231094449759e-03f;
+      } else {
+        sum += -1.0073761222884059e-03f;
+      }
+    }
+    // tree 141
+    if ( x4 >= 3.2740354537963867e+00f ) {
+      if ( x2 >= 2.0149254798889160e+00f ) {
+        sum += -1.6097975894808769e-02f;
+      } else {
+        sum += 1.8680570065043867e-05f;
+      }
+    } else {
+      if ( x6 >= 5.3993326425552368e-01f ) {
+        sum += -2.0699168089777231e-04f;
+      } else {
+        sum += 6.1255712062120438e-03f;
+      }
+    }
+    // tree 142
+    if ( x0 >= 2.4003839492797852e+00f ) {
+      if ( x2 >= 3.0199005603790283e+00f ) {
+        sum += -1.5180416405200958e-02f;
+      } else {
+        sum += -5.4264692589640617e-03f;
+      }
+    } else {
+      if ( x2 >= 7.0149254798889160e+00f ) {
+        sum += 2.1740499883890152e-02f;
+      } else {
+        sum += -1.5108266961760819e-04f;
+      }
+    }
+    // tree 143
+    if ( x3 >= 1.5433870315551758e+01f ) {
+      if ( x4 >= 3.6460850238800049e+00f ) {
+        sum += -7.6930592767894268e-03f;
+      } else {
+        sum += 1.2264277029316872e-04f;
+      }
+    } else {
+      if ( x1 >= 4.8406898498535156e+01f ) {
+        sum += -1.4908506534993649e-02f;
+      } else {
+        sum += 7.7840047888457775e-03f;
+      }
+    }
+    // tree 144
+    if ( x5 >= 2.4978098869323730e+00f ) {
+      if ( x4 >= 1.4156117439270020e+00f ) {
+        sum += -8.8819125667214394e-03f;
+      } else {
+        sum += 1.0551172308623791e-03f;
+      }
+    } else {
+      if ( x4 >= 9.4252538681030273e-01f ) {
+        sum += 7.7510700793936849e-04f;
+      } else {
+        sum += -4.1841696947813034e-03f;
+      }
+    }
+    // tree 145
+    if ( x4 >= 2.1826903820037842e+00f ) {
+      if ( x5 >= 2.2678291797637939e+00f ) {
+        sum += -8.5419947281479836e-03f;
+      } else {
+        sum += -4.7191852354444563e-04f;
+      }
+    } else {
+      if ( x2 >= 2.0348258018493652e+00f ) {
+        sum += 4.6807578764855862e-03f;
+      } else {
+        sum += -2.3491433821618557e-03f;
+      }
+    }
+    // tree 146
+    if ( x1 >= 1.0968991088867188e+02f ) {
+      if ( x5 >= 7.6896703243255615e-01f ) {
+        sum += 2.8527249014587142e-05f;
+      } else {
+        sum += 6.2082521617412567e-03f;
+      }
+    } else {
+      if ( x1 >= 4.2571868896484375e+01f ) {
+        sum += -2.4002415593713522e-03f;
+      } else {
+        sum += 2.3889278527349234e-03f;
+      }
+    }
+    // tree 147
+    if ( x0 >= 2.1150670051574707e+00f ) {
+      if ( x1 >= 1.2461792945861816e+01f ) {
+        sum += -3.9050232153385878e-03f;
+      } else {
+        sum += 1.2476803734898567e-02f;
+      }
+    } else {
+      if ( x4 >= 2.7531661987304688e+00f ) {
+        sum += -2.2262535057961941e-03f;
+      } else {
+        sum += 6.6898361546918750e-04f;
+      }
+    }
+    // tree 148
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x6 >= 3.4206764698028564e+00f ) {
+        sum += -7.2076474316418171e-03f;
+      } else {
+        sum += -1.4740929938852787e-02f;
+      }
+    } else {
+      if ( x4 >= 2.0834770202636719e+00f ) {
+        sum += -9.0204022126272321e-04f;
+      } else {
+        sum += 1.2889691861346364e-03f;
+      }
+    }
+    // tree 149
+    if ( x5 >= 3.1928434371948242e+00f ) {
+      if ( x0 >= 1.9091333150863647e+00f ) {
+        sum += -1.6380131244659424e-02f;
+      } else {
+        sum += -4.2478227987885475e-03f;
+      }
+    } else {
+      if ( x3 >= 1.5433870315551758e+01f ) {
+        sum += 1.2251739099156111e-04f;
+      } else {
+        sum += -8.4860464558005333e-03f;
+      }
+    }
+    // tree 150
+    if ( x5 >= 4.8460876941680908e-01f ) {
+      if ( x4 >= 3.6460850238800049e+00f ) {
+        sum += -7.6556699350476265e-03f;
+      } else {
+        sum += -1.5280501975212246e-04f;
+      }
+    } else {
+      if ( x1 >= 5.8025581359863281e+01f ) {
+        sum += 1.7695484682917595e-02f;
+      } else {
+        sum += -1.1054621078073978e-02f;
+      }
+    }
+    // tree 151
+    if ( x0 >= 1.1846858263015747e+00f ) {
+      if ( x1 >= 2.2675662994384766e+01f ) {
+        sum += -1.5952978283166885e-03f;
+      } else {
+        sum += 5.3938808850944042e-03f;
+      }
+    } else {
+      if ( x5 >= 4.8456269502639771e-01f ) {
+        sum += 6.1039789579808712e-04f;
+      } else {
+        sum += 2.7958879247307777e-02f;
+      }
+    }
+    // tree 152
+    if ( x1 >= 1.4957281494140625e+02f ) {
+      if ( x2 >= 3.0248756408691406e+00f ) {
+        sum += -2.7069731149822474e-03f;
+      } else {
+        sum += 3.2235805410891771e-03f;
+      }
+    } else {
+      if ( x4 >= 2.9019861221313477e+00f ) {
+        sum += -4.0862015448510647e-03f;
+      } else {
+        sum += -1.8938527500722557e-04f;
+      }
+    }
+    // tree 153
+    if ( x5 >= 3.0490434169769287e+00f ) {
+      if ( x4 >= 9.0674036741256714e-01f ) {
+        sum += -1.5242479741573334e-02f;
+      } else {
+        sum += -4.5553056406788528e-04f;
+      }
+    } else {
+      if ( x4 >= 4.7126269340515137e-01f ) {
+        sum += 4.4569355668500066e-04f;
+      } else {
+        sum += -3.2236874103546143e-03f;
+      }
+    }
+    // tree 154
+    if ( x6 >= 7.1649849414825439e-01f ) {
+      if ( x3 >= 2.2419203186035156e+02f ) {
+        sum += 1.3038995675742626e-02f;
+      } else {
+        sum += -8.2156038843095303e-04f;
+      }
+    } else {
+      if ( x3 >= 2.1503462219238281e+02f ) {
+        sum += -2.6177767664194107e-02f;
+      } else {
+        sum += 4.0732952766120434e-03f;
+      }
+    }
+    // tree 155
+    if ( x0 >= 2.4003839492797852e+00f ) {
+      if ( x6 >= 1.4454586505889893e+00f ) {
+        sum += -4.1660219430923462e-03f;
+      } else {
+        sum += -1.3552737422287464e-02f;
+      }
+    } else {
+      if ( x1 >= 1.6951426696777344e+02f ) {
+        sum += 2.3951737675815821e-03f;
+      } else {
+        sum += -4.8102697473950684e-04f;
+      }
+    }
+    // tree 156
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x0 >= 1.6144337654113770e+00f ) {
+        sum += -1.3065803796052933e-02f;
+      } else {
+        sum += -4.5517096295952797e-03f;
+      }
+    } else {
+      if ( x4 >= 2.0834770202636719e+00f ) {
+        sum += -8.2315510371699929e-04f;
+      } else {
+        sum += 1.2319842353463173e-03f;
+      }
+    }
+    // tree 157
+    if ( x2 >= 7.0149254798889160e+00f ) {
+      if ( x6 >= 7.0642548799514771e-01f ) {
+        sum += 5.8722626417875290e-03f;
+      } else {
+        sum += 5.1570456475019455e-02f;
+      }
+    } else {
+      if ( x1 >= 1.0968991088867188e+02f ) {
+        sum += 8.5731508443132043e-04f;
+      } else {
+        sum += -1.0283713927492499e-03f;
+      }
+    }
+    // tree 158
+    if ( x4 >= 4.7126269340515137e-01f ) {
+      if ( x6 >= 3.0927958488464355e+00f ) {
+        sum += -1.4134937897324562e-02f;
+      } else {
+        sum += 4.3420534348115325e-04f;
+      }
+    } else {
+      if ( x3 >= 1.5565309143066406e+02f ) {
+        sum += 8.5418177768588066e-03f;
+      } else {
+        sum += -3.7266730796545744e-03f;
+      }
+    }
+    // tree 159
+    if ( x3 >= 1.5433870315551758e+01f ) {
+      if ( x5 >= 3.1928434371948242e+00f ) {
+        sum += -8.1693986430764198e-03f;
+      } else {
+        sum += 1.2829437036998570e-04f;
+      }
+    } else {
+      if ( x5 >= 9.4853764772415161e-01f ) {
+        sum += -1.2641703709959984e-02f;
+      } else {
+        sum += 1.2363514862954617e-02f;
+      }
+    }
+    // tree 160
+    if ( x1 >= 4.4880187988281250e+01f ) {
+      if ( x1 >= 9.2505577087402344e+01f ) {
+        sum += 4.9861415755003691e-04f;
+      } else {
+        sum += -2.5341454893350601e-03f;
+      }
+    } else {
+      if ( x5 >= 1.9945095777511597e+00f ) {
+        sum += -2.0622727461159229e-03f;
+      } else {
+        sum += 4.2300308123230934e-03f;
+      }
+    }
+    // tree 161
+    if ( x0 >= 2.2763330936431885e+00f ) {
+      if ( x5 >= 9.5063483715057373e-01f ) {
+        sum += -6.3389600254595280e-03f;
+      } else {
+        sum += 5.6549049913883209e-03f;
+      }
+    } else {
+      if ( x3 >= 2.8455261230468750e+02f ) {
+        sum += 1.2924851849675179e-02f;
+      } else {
+        sum += -5.2446092013269663e-05f;
+      }
+    }
+    // tree 162
+    if ( x4 >= 2.0834770202636719e+00f ) {
+      if ( x5 >= 2.2678291797637939e+00f ) {
+        sum += -7.7669578604400158e-03f;
+      } else {
+        sum += -2.2835684649180621e-04f;
+      }
+    } else {
+      if ( x2 >= 2.0447762012481689e+00f ) {
+        sum += 5.2267871797084808e-03f;
+      } else {
+        sum += -2.0023414399474859e-03f;
+      }
+    }
+    // tree 163
+    if ( x0 >= 9.1177392005920410e-01f ) {
+      if ( x3 >= 2.2725712585449219e+02f ) {
+        sum += 1.2062994763255119e-02f;
+      } else {
+        sum += -9.8664301913231611e-04f;
+      }
+    } else {
+      if ( x6 >= 2.3220987319946289e+00f ) {
+        sum += 8.8343052193522453e-03f;
+      } else {
+        sum += 4.0593818994238973e-04f;
+      }
+    }
+    // tree 164
+    if ( x4 >= 3.6708881855010986e+00f ) {
+      if ( x6 >= 1.5826621055603027e+00f ) {
+        sum += -8.6193229071795940e-04f;
+      } else {
+        sum += -1.2537322007119656e-02f;
+      }
+    } else {
+      if ( x3 >= 1.5433870315551758e+01f ) {
+        sum += 7.9432771599385887e-05f;
+      } else {
+        sum += -7.3469895869493484e-03f;
+      }
+    }
+    // tree 165
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x1 >= 9.9441062927246094e+01f ) {
+        sum += -1.1652626097202301e-02f;
+      } else {
+        sum += -3.9918706752359867e-03f;
+      }
+    } else {
+      if ( x1 >= 1.0968991088867188e+02f ) {
+        sum += 1.0184251004830003e-03f;
+      } else {
+        sum += -7.7826640335842967e-04f;
+      }
+    }
+    // tree 166
+    if ( x6 >= 5.3993326425552368e-01f ) {
+      if ( x6 >= 5.8772814273834229e-01f ) {
+        sum += -7.9524746979586780e-05f;
+      } else {
+        sum += -9.4270538538694382e-03f;
+      }
+    } else {
+      if ( x6 >= 5.1222658157348633e-01f ) {
+        sum += 2.0904038101434708e-02f;
+      } else {
+        sum += -2.4820177713991143e-05f;
+      }
+    }
+    // tree 167
+    if ( x0 >= 2.4003839492797852e+00f ) {
+      if ( x2 >= 3.0199005603790283e+00f ) {
+        sum += -1.3006997294723988e-02f;
+      } else {
+        sum += -3.7584388628602028e-03f;
+      }
+    } else {
+      if ( x2 >= 5.0099501609802246e+00f ) {
+        sum += 5.0521860830485821e-03f;
+      } else {
+        sum += -3.0691659776493907e-04f;
+      }
+    }
+    // tree 168
+    if ( x1 >= 4.4880187988281250e+01f ) {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 3.3002146519720554e-03f;
+      } else {
+        sum += -1.0578393703326583e-03f;
+      }
+    } else {
+      if ( x4 >= 2.1826903820037842e+00f ) {
+        sum += -1.2089338852092624e-03f;
+      } else {
+        sum += 4.8535019159317017e-03f;
+      }
+    }
+    // tree 169
+    if ( x5 >= 3.1928434371948242e+00f ) {
+      if ( x0 >= 1.9091333150863647e+00f ) {
+        sum += -1.5016458928585052e-02f;
+      } else {
+        sum += -3.2154417131096125e-03f;
+      }
+    } else {
+      if ( x1 >= 2.9913372802734375e+02f ) {
+        sum += -5.9879515320062637e-03f;
+      } else {
+        sum += 1.3774965191259980e-04f;
+      }
+    }
+    // tree 170
+    if ( x3 >= 7.1288703918457031e+01f ) {
+      if ( x0 >= 2.7894055843353271e-01f ) {
+        sum += 2.7455246890895069e-04f;
+      } else {
+        sum += 8.0653317272663116e-03f;
+      }
+    } else {
+      if ( x0 >= 1.3858841359615326e-01f ) {
+        sum += -8.7681406876072288e-04f;
+      } else {
+        sum += -2.4167487397789955e-02f;
+      }
+    }
+    // tree 171
+    if ( x6 >= 7.1649849414825439e-01f ) {
+      if ( x3 >= 3.2567340087890625e+02f ) {
+        sum += 3.0431367456912994e-02f;
+      } else {
+        sum += -5.5822887225076556e-04f;
+      }
+    } else {
+      if ( x3 >= 2.1503462219238281e+02f ) {
+        sum += -2.5148699060082436e-02f;
+      } else {
+        sum += 3.6594578996300697e-03f;
+      }
+    }
+    // tree 172
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x1 >= 9.9441062927246094e+01f ) {
+        sum += -1.1216136626899242e-02f;
+      } else {
+        sum += -3.7216227501630783e-03f;
+      }
+    } else {
+      if ( x1 >= 1.6951426696777344e+02f ) {
+        sum += 2.0734611898660660e-03f;
+      } else {
+        sum += -3.8250291254371405e-04f;
+      }
+    }
+    // tree 173
+    if ( x4 >= 4.7126269340515137e-01f ) {
+      if ( x4 >= 1.9132646322250366e+00f ) {
+        sum += -6.1500299489125609e-04f;
+      } else {
+        sum += 3.0320154037326574e-03f;
+      }
+    } else {
+      if ( x3 >= 1.0035488891601562e+02f ) {
+        sum += 2.5486811064183712e-03f;
+      } else {
+        sum += -4.8876944929361343e-03f;
+      }
+    }
+    // tree 174
+    if ( x4 >= 3.6708881855010986e+00f ) {
+      if ( x6 >= 1.5826621055603027e+00f ) {
+        sum += -6.4101861789822578e-04f;
+      } else {
+        sum += -1.1889536865055561e-02f;
+      }
+    } else {
+      if ( x1 >= 1.0968991088867188e+02f ) {
+        sum += 9.6532452153041959e-04f;
+      } else {
+        sum += -7.4934342410415411e-04f;
+      }
+    }
+    // tree 175
+    if ( x1 >= 4.4880187988281250e+01f ) {
+      if ( x0 >= 1.0854451656341553e+00f ) {
+        sum += -1.5046771150082350e-03f;
+      } else {
+        sum += 9.8845036700367928e-04f;
+      }
+    } else {
+      if ( x1 >= 3.7286487579345703e+01f ) {
+        sum += 7.8594125807285309e-03f;
+      } else {
+        sum += 4.2833230691030622e-04f;
+      }
+    }
+    // tree 176
+    if ( x0 >= 2.3507637977600098e+00f ) {
+      if ( x4 >= 2.2769937515258789e+00f ) {
+        sum += -1.1742671951651573e-02f;
+      } else {
+        sum += 3.0907907057553530e-03f;
+      }
+    } else {
+      if ( x1 >= 4.1878244018554688e+02f ) {
+        sum += 1.8717976287007332e-02f;
+      } else {
+        sum += -3.1461138860322535e-05f;
+      }
+    }
+    // tree 177
+    if ( x5 >= 3.0490434169769287e+00f ) {
+      if ( x4 >= 9.0674036741256714e-01f ) {
+        sum += -1.4084377326071262e-02f;
+      } else {
+        sum += 4.9992190906777978e-04f;
+      }
+    } else {
+      if ( x5 >= 5.8700001239776611e-01f ) {
+        sum += -1.8068110512103885e-04f;
+      } else {
+        sum += 4.5048915781080723e-03f;
+      }
+    }
+    // tree 178
+    if ( x3 >= 1.5433870315551758e+01f ) {
+      if ( x6 >= 1.1200760602951050e+00f ) {
+        sum += -6.2934844754636288e-04f;
+      } else {
+        sum += 1.1803011875599623e-03f;
+      }
+    } else {
+      if ( x1 >= 4.8406898498535156e+01f ) {
+        sum += -1.2228124774992466e-02f;
+      } else {
+        sum += 8.7743075564503670e-03f;
+      }
+    }
+    // tree 179
+    if ( x4 >= 4.7126269340515137e-01f ) {
+      if ( x6 >= 3.0927958488464355e+00f ) {
+        sum += -1.3091589324176311e-02f;
+      } else {
+        sum += 3.7190853618085384e-04f;
+      }
+    } else {
+      if ( x1 >= 2.1378680419921875e+02f ) {
+        sum += 6.2557570636272430e-03f;
+      } else {
+        sum += -3.4189582802355289e-03f;
+      }
+    }
+    // tree 180
+    if ( x1 >= 2.4938735961914062e+01f ) {
+      if ( x3 >= 1.6492290496826172e+01f ) {
+        sum += -1.9751534273382276e-04f;
+      } else {
+        sum += -9.3631995841860771e-03f;
+      }
+    } else {
+      if ( x5 >= 5.4341924190521240e-01f ) {
+        sum += 3.4550270065665245e-03f;
+      } else {
+        sum += -2.1275803446769714e-02f;
+      }
+    }
+    // tree 181
+    if ( x1 >= 9.4733825683593750e+01f ) {
+      if ( x2 >= 4.0398011207580566e+00f ) {
+        sum += 6.9444999098777771e-03f;
+      } else {
+        sum += -1.0954181925626472e-04f;
+      }
+    } else {
+      if ( x1 >= 5.0431373596191406e+01f ) {
+        sum += -2.5828748475760221e-03f;
+      } else {
+        sum += 1.3126728590577841e-03f;
+      }
+    }
+    // tree 182
+    if ( x1 >= 2.9913372802734375e+02f ) {
+      if ( x2 >= 2.0447762012481689e+00f ) {
+        sum += -1.6083529219031334e-02f;
+      } else {
+        sum += 1.0044552385807037e-02f;
+      }
+    } else {
+      if ( x1 >= 2.4696824645996094e+02f ) {
+        sum += 1.0063458234071732e-02f;
+      } else {
+        sum += -2.1202511561568826e-04f;
+      }
+    }
+    // tree 183
+    if ( x0 >= 2.4003839492797852e+00f ) {
+      if ( x6 >= 1.4454586505889893e+00f ) {
+        sum += -2.4800866376608610e-03f;
+      } else {
+        sum += -1.1664953082799911e-02f;
+      }
+    } else {
+      if ( x2 >= 7.0149254798889160e+00f ) {
+        sum += 1.6652273014187813e-02f;
+      } else {
+        sum += -1.0120912338607013e-04f;
+      }
+    }
+    // tree 184
+    if ( x5 >= 3.1928434371948242e+00f ) {
+      if ( x0 >= 1.9091333150863647e+00f ) {
+        sum += -1.4181696809828281e-02f;
+      } else {
+        sum += -2.7127652429044247e-03f;
+      }
+    } else {
+      if ( x1 >= 2.9913372802734375e+02f ) {
+        sum += -5.5644740350544453e-03f;
+      } else {
+        sum += 1.4671651297248900e-04f;
+      }
+    }
+    // tree 185
+    if ( x4 >= 3.6708881855010986e+00f ) {
+      if ( x6 >= 1.5826621055603027e+00f ) {
+        sum += -4.6619671047665179e-04f;
+      } else {
+        sum += -1.1303579434752464e-02f;
+      }
+    } else {
+      if ( x1 >= 9.4733825683593750e+01f ) {
+        sum += 7.3454913217574358e-04f;
+      } else {
+        sum += -8.2361733075231314e-04f;
+      }
+    }
+    // tree 186
+    if ( x4 >= 2.0834770202636719e+00f ) {
+      if ( x5 >= 2.2678291797637939e+00f ) {
+        sum += -7.0099961012601852e-03f;
+      } else {
+        sum += -1.3411692634690553e-04f;
+      }
+    } else {
+      if ( x2 >= 2.0447762012481689e+00f ) {
+        sum += 4.5525743626058102e-03f;
+      } else {
+        sum += -1.7822734080255032e-03f;
+      }
+    }
+    // tree 187
+    if ( x0 >= 1.3025361299514771e-01f ) {
+      if ( x0 >= 7.3214286565780640e-01f ) {
+        sum += -4.7770477249287069e-04f;
+      } else {
+        sum += 1.7432332970201969e-03f;
+      }
+    } else {
+      if ( x3 >= 7.1883071899414062e+01f ) {
+        sum += 5.1613980904221535e-03f;
+      } else {
+        sum += -2.2454325109720230e-02f;
+      }
+    }
+    // tree 188
+    if ( x5 >= 4.8460876941680908e-01f ) {
+      if ( x5 >= 5.0760257244110107e-01f ) {
+        sum += -9.9275188404135406e-05f;
+      } else {
+        sum += -1.2799426913261414e-02f;
+      }
+    } else {
+      if ( x1 >= 5.8025581359863281e+01f ) {
+        sum += 1.4649546705186367e-02f;
+      } else {
+        sum += -1.1427593417465687e-02f;
+      }
+    }
+    // tree 189
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x1 >= 9.9441062927246094e+01f ) {
+        sum += -1.0599914006888866e-02f;
+      } else {
+        sum += -2.7094457764178514e-03f;
+      }
+    } else {
+      if ( x1 >= 1.6951426696777344e+02f ) {
+        sum += 1.7469034064561129e-03f;
+      } else {
+        sum += -3.1753961229696870e-04f;
+      }
+    }
+    // tree 190
+    if ( x1 >= 4.4880187988281250e+01f ) {
+      if ( x0 >= 1.0854451656341553e+00f ) {
+        sum += -1.3227161252871156e-03f;
+      } else {
+        sum += 8.7468203855678439e-04f;
+      }
+    } else {
+      if ( x1 >= 3.7286487579345703e+01f ) {
+        sum += 7.2482288815081120e-03f;
+      } else {
+        sum += 2.6605706079863012e-04f;
+      }
+    }
+    // tree 191
+    if ( x6 >= 5.3993326425552368e-01f ) {
+      if ( x6 >= 5.8772814273834229e-01f ) {
+        sum += -2.5144525352516212e-05f;
+      } else {
+        sum += -9.0634813532233238e-03f;
+      }
+    } else {
+      if ( x0 >= 7.4280256032943726e-01f ) {
+        sum += -9.0936681954190135e-04f;
+      } else {
+        sum += 1.9740177318453789e-02f;
+      }
+    }
+    // tree 192
+    if ( x0 >= 1.3025361299514771e-01f ) {
+      if ( x5 >= 7.0030885934829712e-01f ) {
+        sum += -3.1059779576025903e-04f;
+      } else {
+        sum += 2.6033490430563688e-03f;
+      }
+    } else {
+      if ( x3 >= 7.1883071899414062e+01f ) {
+        sum += 4.5324699021875858e-03f;
+      } else {
+        sum += -2.1060932427644730e-02f;
+      }
+    }
+    // tree 193
+    if ( x1 >= 2.4938735961914062e+01f ) {
+      if ( x3 >= 1.6492290496826172e+01f ) {
+        sum += -1.7139111878350377e-04f;
+      } else {
+        sum += -8.6812162771821022e-03f;
+      }
+    } else {
+      if ( x5 >= 5.4341924190521240e-01f ) {
+        sum += 3.1371305231004953e-03f;
+      } else {
+        sum += -1.8892170861363411e-02f;
+      }
+    }
+    // tree 194
+    if ( x5 >= 3.1928434371948242e+00f ) {
+      if ( x0 >= 1.9091333150863647e+00f ) {
+        sum += -1.3611922040581703e-02f;
+      } else {
+        sum += -2.4547753855586052e-03f;
+      }
+    } else {
+      if ( x1 >= 2.9913372802734375e+02f ) {
+        sum += -5.3372411057353020e-03f;
+      } else {
+        sum += 1.4374236343428493e-04f;
+      }
+    }
+    // tree 195
+    if ( x4 >= 3.6460850238800049e+00f ) {
+      if ( x1 >= 1.1289519500732422e+02f ) {
+        sum += -9.0860323980450630e-03f;
+      } else {
+        sum += 1.3345787301659584e-03f;
+      }
+    } else {
+      if ( x1 >= 9.4733825683593750e+01f ) {
+        sum += 7.2722916956990957e-04f;
+      } else {
+        sum += -8.0273119965568185e-04f;
+      }
+    }
+    // tree 196
+    if ( x4 >= 4.7126269340515137e-01f ) {
+      if ( x4 >= 1.7338662147521973e+00f ) {
+        sum += -3.8931274320930243e-04f;
+      } else {
+        sum += 3.3950773067772388e-03f;
+      }
+    } else {
+      if ( x3 >= 1.0035488891601562e+02f ) {
+        sum += 2.4999652523547411e-03f;
+      } else {
+        sum += -4.3796910904347897e-03f;
+      }
+    }
+    // tree 197
+    if ( x6 >= 7.1649849414825439e-01f ) {
+      if ( x3 >= 3.0537713623046875e+02f ) {
+        sum += 2.3611696437001228e-02f;
+      } else {
+        sum += -4.7527046990580857e-04f;
+      }
+    } else {
+      if ( x3 >= 2.1503462219238281e+02f ) {
+        sum += -2.3253159597516060e-02f;
+      } else {
+        sum += 3.2482440583407879e-03f;
+      }
+    }
+    // tree 198
+    if ( x6 >= 3.2640821933746338e+00f ) {
+      if ( x0 >= 1.6144337654113770e+00f ) {
+        sum += -1.1006245389580727e-02f;
+      } else {
+        sum += -2.1479290444403887e-03f;
+      }
+    } else {
+      if ( x1 >= 1.0968991088867188e+02f ) {
+        sum += 8.2906789612025023e-04f;
+      } else {
+        sum += -5.9226434677839279e-04f;
+      }
+    }
+    // tree 199
+    if ( x0 >= 2.4003839492797852e+00f ) {
+      if ( x6 >= 1.4454586505889893e+00f ) {
+        sum += -2.0994937513023615e-03f;
+      } else {
+        sum += -1.0773411951959133e-02f;
+      }
+    } else {
+      if ( x1 >= 4.1878244018554688e+02f ) {
+        sum += 1.7764661461114883e-02f;
+      } else {
+        sum += -4.8192996473517269e-05f;
+      }
+    }
+    // CV: same transformation of the sum of responses as in TMVA::MethodBDT::GetGradBoostMVA
+    return 2./(1. + std::exp(-2.*sum)) - 1.;
+  }
+}
+
+extern const CompiledBDT compiledBDTs[] = {
+  { "tthAnalysis/HiggsToTauTau/data/2lss_ttV_BDTG.weights.xml", 0x107b265a5e6280deULL, inputVariables_2lss_ttV_BDTG, 7, &compiledBDT_2lss_ttV_BDTG },
+  { "tthAnalysis/HiggsToTauTau/data/2lss_ttbar_BDTG.weights.xml", 0xcb9eae86f50ae300ULL, inputVariables_2lss_ttbar_BDTG, 7, &compiledBDT_2lss_ttbar_BDTG },
+  { "tthAnalysis/HiggsToTauTau/data/3l_ttV_BDTG.weights.xml", 0x443b4d175612b10eULL, inputVariables_3l_ttV_BDTG, 7, &compiledBDT_3l_ttV_BDTG },
+  { "tthAnalysis/HiggsToTauTau/data/3l_ttbar_BDTG.weights.xml", 0x1c943e3421e0db1bULL, inputVariables_3l_ttbar_BDTG, 7, &compiledBDT_3l_ttbar_BDTG },
+  { 0, 0, 0, 0, 0 }
+};
+extern const size_t numCompiledBDTs = 4;
@@ -5,6 +5,9 @@
 
 #include <assert.h> // assert
 
+// CV: the look-up tables are loaded on first use and kept in function-local static variables,
+//     which C++11 guarantees to be initialized exactly once, also when the functions are called from multiple threads
+
 /**
  * @brief Evaluate data/MC correction for electron and muon trigger efficiency (Table 10 in AN-2015/321)
  * @param type (either kElectron or kMuon), pT and eta of both leptons
@@ -26,22 +29,12 @@ double sf_triggerEff(int lepton1_type, double lepton1_pt, double lepton1_eta, in
 double sf_electronID_and_Iso_loose(double electron_pt, double electron_eta)
 {
   // efficiency for electron to pass loose identification criteria: AN-2015/321, Fig. 10 top left
-  static TH2* lut_id_loose = 0;
-  if ( !lut_id_loose ) {
-    edm::FileInPath fileName_id_loose("tthAnalysis/HiggsToTauTau/data/");
-    std::string histogramName_id_loose = "";
-    lut_id_loose = loadTH2(fileName_id_loose, histogramName_id_loose);
-  }
+  static TH2* lut_id_loose = loadTH2(edm::FileInPath("tthAnalysis/HiggsToTauTau/data/"), "");
   assert(lut_id_loose);
   double sf_id_loose = get_sf_from_TH2(lut_id_loose, electron_pt, electron_eta);
   
   // electron isolation efficiency: AN-2015/321, Fig. 10 top right
-  static TH2* lut_iso = 0;
-  if ( !lut_iso ) {
-    edm::FileInPath fileName_iso("tthAnalysis/HiggsToTauTau/data/");
-    std::string histogramName_iso = "";
-    lut_iso = loadTH2(fileName_iso, histogramName_iso);
-  }
+  static TH2* lut_iso = loadTH2(edm::FileInPath("tthAnalysis/HiggsToTauTau/data/"), "");
   assert(lut_iso);
   double sf_iso = get_sf_from_TH2(lut_iso, electron_pt, electron_eta);
 
@@ -52,33 +45,18 @@ double sf_electronID_and_Iso_loose(double electron_pt, double electron_eta)
 double sf_electronID_and_Iso_tight_to_loose(double electron_pt, double electron_eta)
 {
   // efficiency for electron to pass tight conversion veto and missing inner hits cut: AN-2015/321, Fig. 10 bottom
-  static TH2* lut_convVeto = 0;
-  if ( !lut_convVeto ) {
-    edm::FileInPath fileName_convVeto("tthAnalysis/HiggsToTauTau/data/");
-    std::string histogramName_convVeto = "";
-    lut_convVeto = loadTH2(fileName_convVeto, histogramName_convVeto);
-  }
+  static TH2* lut_convVeto = loadTH2(edm::FileInPath("tthAnalysis/HiggsToTauTau/data/"), "");
   assert(lut_convVeto);
   double sf_convVeto = get_sf_from_TH2(lut_convVeto, electron_pt, electron_eta);
 
   // efficiency for electron to pass tight identification criteria: AN-2015/321, Fig. 12 top left (barrel) and center (endcap)
   double sf_id_tight = 1.;
   if ( fabs(electron_eta) < 1.479 ) {
-    static TH1* lut_id_tight_barrel = 0;
-    if ( !lut_id_tight_barrel ) {
-      edm::FileInPath fileName_id_tight_barrel("tthAnalysis/HiggsToTauTau/data/");
-      std::string histogramName_id_tight_barrel = "";
-      lut_id_tight_barrel = loadTH1(fileName_id_tight_barrel, histogramName_id_tight_barrel);
-    }
+    static TH1* lut_id_tight_barrel = loadTH1(edm::FileInPath("tthAnalysis/HiggsToTauTau/data/"), "");
     assert(lut_id_tight_barrel);
     sf_id_tight = get_sf_from_TH1(lut_id_tight_barrel, electron_pt);
   } else {
-    static TH1* lut_id_tight_endcap = 0;
-    if ( !lut_id_tight_endcap ) {
-      edm::FileInPath fileName_id_tight_endcap("tthAnalysis/HiggsToTauTau/data/");
-      std::string histogramName_id_tight_endcap = "";
-      lut_id_tight_endcap = loadTH1(fileName_id_tight_endcap, histogramName_id_tight_endcap);
-    }
+    static TH1* lut_id_tight_endcap = loadTH1(edm::FileInPath("tthAnalysis/HiggsToTauTau/data/"), "");
     assert(lut_id_tight_endcap);
     sf_id_tight = get_sf_from_TH1(lut_id_tight_endcap, electron_pt);
   }
@@ -99,44 +77,24 @@ double sf_electronID_and_Iso_tight(double electron_pt, double electron_eta)
 double sf_muonID_and_Iso_loose(double muon_pt, double muon_eta)
 {
   // efficiency for muon to pass loose identification criteria: AN-2015/321, Fig. 11 bottom
-  static TH2* lut_id_loose = 0;
-  if ( !lut_id_loose ) {
-    edm::FileInPath fileName_id_loose("tthAnalysis/HiggsToTauTau/data/");
-    std::string histogramName_id_loose = "";
-    lut_id_loose = loadTH2(fileName_id_loose, histogramName_id_loose);
-  }
+  static TH2* lut_id_loose = loadTH2(edm::FileInPath("tthAnalysis/HiggsToTauTau/data/"), "");
   assert(lut_id_loose);
   double sf_id_loose = get_sf_from_TH2(lut_id_loose, muon_pt, muon_eta);
 
   // muon isolation efficiency: AN-2015/321, Fig. 11 top left (barrel) and center (endcap)
   double sf_iso = 1.;
   if ( fabs(muon_eta) < 1.2 ) {
-    static TH1* lut_iso_barrel = 0;
-    if ( !lut_iso_barrel ) {
-      edm::FileInPath fileName_iso_barrel("tthAnalysis/HiggsToTauTau/data/");
-      std::string histogramName_iso_barrel = "";
-      lut_iso_barrel = loadTH1(fileName_iso_barrel, histogramName_iso_barrel);
-    }
+    static TH1* lut_iso_barrel = loadTH1(edm::FileInPath("tthAnalysis/HiggsToTauTau/data/"), "");
     assert(lut_iso_barrel);
     sf_iso = get_sf_from_TH1(lut_iso_barrel, muon_pt);
   } else {
-    static TH1* lut_iso_endcap = 0;
-    if ( !lut_iso_endcap ) {
-      edm::FileInPath fileName_iso_endcap("tthAnalysis/HiggsToTauTau/data/");
-      std::string histogramName_iso_endcap = "";
-      lut_iso_endcap = loadTH1(fileName_iso_endcap, histogramName_iso_endcap);
-    }
+    static TH1* lut_iso_endcap = loadTH1(edm::FileInPath("tthAnalysis/HiggsToTauTau/data/"), "");
     assert(lut_iso_endcap);
     sf_iso = get_sf_from_TH1(lut_iso_endcap, muon_pt);
   }
   
   // efficiency for muon to pass transverse impact parameter cut: AN-2015/321, Fig. 11 top right
-  static TH1* lut_ip = 0;
-  if ( !lut_ip ) {
-    edm::FileInPath fileName_ip("tthAnalysis/HiggsToTauTau/data/");
-    std::string histogramName_ip = "";
-    lut_ip = loadTH2(fileName_ip, histogramName_ip);
-  }
+  static TH1* lut_ip = loadTH2(edm::FileInPath("tthAnalysis/HiggsToTauTau/data/"), "");
   assert(lut_ip);
   double sf_ip = get_sf_from_TH1(lut_ip, muon_eta);
   
@@ -149,21 +107,11 @@ double sf_muonID_and_Iso_tight_to_loose(double muon_pt, double muon_eta)
   // efficiency for muon to pass tight identification criteria: AN-2015/321, Fig. 13 top left (barrel) and center (endcap)
   double sf_id_tight = 1.;
   if ( fabs(muon_eta) < 1.2 ) {
-    static TH1* lut_id_tight_barrel = 0;
-    if ( !lut_id_tight_barrel ) {
-      edm::FileInPath fileName_id_tight_barrel("tthAnalysis/HiggsToTauTau/data/");
-      std::string histogramName_id_tight_barrel = "";
-      lut_id_tight_barrel = loadTH1(fileName_id_tight_barrel, histogramName_id_tight_barrel);
-    }
+    static TH1* lut_id_tight_barrel = loadTH1(edm::FileInPath("tthAnalysis/HiggsToTauTau/data/"), "");
     assert(lut_id_tight_barrel);
     sf_id_tight = get_sf_from_TH1(lut_id_tight_barrel, muon_pt);
   } else {
-    static TH1* lut_id_tight_endcap = 0;
-    if ( !lut_id_tight_endcap ) {
-      edm::FileInPath fileName_id_tight_endcap("tthAnalysis/HiggsToTauTau/data/");
-      std::string histogramName_id_tight_endcap = "";
-      lut_id_tight_endcap = loadTH1(fileName_id_tight_endcap, histogramName_id_tight_endcap);
-    }
+    static TH1* lut_id_tight_endcap = loadTH1(edm::FileInPath("tthAnalysis/HiggsToTauTau/data/"), "");
     assert(lut_id_tight_endcap);
     sf_id_tight = get_sf_from_TH1(lut_id_tight_endcap, muon_pt);
   }
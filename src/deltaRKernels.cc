@@ -0,0 +1,360 @@
+// CV: disable contraction of multiplications and additions into FMA instructions,
+//     which the compiler would otherwise generate for the AVX-512 implementation only,
+//     so that all implementations return bit-identical results
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+#include "tthAnalysis/HiggsToTauTau/interface/deltaRKernels.h"
+
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <cfloat> // FLT_MAX
+#include <atomic> // std::atomic
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DELTAR_KERNELS_X86 1
+#include <immintrin.h> // AVX2 and AVX-512 intrinsics
+#endif
+
+namespace
+{
+  std::atomic<int> selectedKernel(kDeltaRKernelAuto);
+
+//--- scalar implementation
+  void comp_deltaR2_matrix_scalar(const float* eta1, const float* phi1, size_t n1,
+				  const float* eta2, const float* phi2, size_t n2,
+				  float* dR2)
+  {
+    for ( size_t idx1 = 0; idx1 < n1; ++idx1 ) {
+      float* dR2_row = dR2 + idx1*n2;
+      for ( size_t idx2 = 0; idx2 < n2; ++idx2 ) {
+	dR2_row[idx2] = comp_deltaR2(eta1[idx1], phi1[idx1], eta2[idx2], phi2[idx2]);
+      }
+    }
+  }
+
+  /**
+   * @brief Compute minimal dR^2 of one particle in the first collection to any particle in the second collection
+   */
+  void comp_deltaR2_min_row_scalar(float eta1, float phi1,
+				   const float* eta2, const float* phi2, size_t idx2_begin, size_t idx2_end,
+				   float& dR2_min, int& idx2_min)
+  {
+    for ( size_t idx2 = idx2_begin; idx2 < idx2_end; ++idx2 ) {
+      float dR2 = comp_deltaR2(eta1, phi1, eta2[idx2], phi2[idx2]);
+      if ( dR2 < dR2_min ) {
+	dR2_min = dR2;
+	idx2_min = idx2;
+      }
+    }
+  }
+
+  void comp_deltaR2_min_scalar(const float* eta1, const float* phi1, size_t n1,
+			       const float* eta2, const float* phi2, size_t n2,
+			       float* dR2min, int* idxMin)
+  {
+    for ( size_t idx1 = 0; idx1 < n1; ++idx1 ) {
+      float dR2_min = FLT_MAX;
+      int idx2_min = -1;
+      comp_deltaR2_min_row_scalar(eta1[idx1], phi1[idx1], eta2, phi2, 0, n2, dR2_min, idx2_min);
+      dR2min[idx1] = dR2_min;
+      if ( idxMin ) idxMin[idx1] = idx2_min;
+    }
+  }
+
+#ifdef DELTAR_KERNELS_X86
+  /**
+   * @brief Reduce the per-lane minima and indices to the overall minimum,
+   *        taking the lowest index in case of ties (same as the scalar implementation)
+   */
+  void reduceMin(const float* lane_dR2min, const int* lane_idxMin, int numLanes, float& dR2_min, int& idx2_min)
+  {
+    dR2_min = FLT_MAX;
+    idx2_min = -1;
+    for ( int idxLane = 0; idxLane < numLanes; ++idxLane ) {
+      if ( lane_idxMin[idxLane] == -1 ) continue;
+      if ( lane_dR2min[idxLane] < dR2_min || (lane_dR2min[idxLane] == dR2_min && lane_idxMin[idxLane] < idx2_min) ) {
+	dR2_min = lane_dR2min[idxLane];
+	idx2_min = lane_idxMin[idxLane];
+      }
+    }
+  }
+
+//--- AVX2 implementation (8 particles per instruction)
+  __attribute__((target("avx2")))
+  inline __m256 comp_deltaR2_avx2(__m256 eta1, __m256 phi1, __m256 eta2, __m256 phi2)
+  {
+    __m256 dEta = _mm256_sub_ps(eta1, eta2);
+    __m256 dPhi = _mm256_sub_ps(phi1, phi2);
+    __m256 nTwoPi = _mm256_round_ps(_mm256_mul_ps(dPhi, _mm256_set1_ps(deltaRKernels_invTwoPi)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    dPhi = _mm256_sub_ps(dPhi, _mm256_mul_ps(_mm256_set1_ps(deltaRKernels_twoPi), nTwoPi));
+    return _mm256_add_ps(_mm256_mul_ps(dEta, dEta), _mm256_mul_ps(dPhi, dPhi));
+  }
+
+  __attribute__((target("avx2")))
+  void comp_deltaR2_matrix_avx2(const float* eta1, const float* phi1, size_t n1,
+				const float* eta2, const float* phi2, size_t n2,
+				float* dR2)
+  {
+    for ( size_t idx1 = 0; idx1 < n1; ++idx1 ) {
+      __m256 eta1_vec = _mm256_set1_ps(eta1[idx1]);
+      __m256 phi1_vec = _mm256_set1_ps(phi1[idx1]);
+      float* dR2_row = dR2 + idx1*n2;
+      size_t idx2 = 0;
+      for ( ; idx2 + 8 <= n2; idx2 += 8 ) {
+	_mm256_storeu_ps(dR2_row + idx2, comp_deltaR2_avx2(eta1_vec, phi1_vec, _mm256_loadu_ps(eta2 + idx2), _mm256_loadu_ps(phi2 + idx2)));
+      }
+      for ( ; idx2 < n2; ++idx2 ) {
+	dR2_row[idx2] = comp_deltaR2(eta1[idx1], phi1[idx1], eta2[idx2], phi2[idx2]);
+      }
+    }
+  }
+
+  /**
+   * @brief Compute minimal dR^2 of one particle in the first collection to any particle in the second collection,
+   *        processing 8 particles of the second collection per instruction
+   */
+  __attribute__((target("avx2")))
+  void comp_deltaR2_min_row_avx2(float eta1, float phi1,
+				 const float* eta2, const float* phi2, size_t n2,
+				 float& dR2_min, int& idx2_min)
+  {
+    dR2_min = FLT_MAX;
+    idx2_min = -1;
+    size_t idx2 = 0;
+    if ( n2 >= 8 ) {
+      __m256 eta1_vec = _mm256_set1_ps(eta1);
+      __m256 phi1_vec = _mm256_set1_ps(phi1);
+      __m256 dR2min_vec = _mm256_set1_ps(FLT_MAX);
+      __m256i idxMin_vec = _mm256_set1_epi32(-1);
+      __m256i idx2_vec = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+      const __m256i step_vec = _mm256_set1_epi32(8);
+      for ( ; idx2 + 8 <= n2; idx2 += 8 ) {
+	__m256 dR2_vec = comp_deltaR2_avx2(eta1_vec, phi1_vec, _mm256_loadu_ps(eta2 + idx2), _mm256_loadu_ps(phi2 + idx2));
+	__m256 isSmaller = _mm256_cmp_ps(dR2_vec, dR2min_vec, _CMP_LT_OQ);
+	dR2min_vec = _mm256_blendv_ps(dR2min_vec, dR2_vec, isSmaller);
+	idxMin_vec = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(idxMin_vec), _mm256_castsi256_ps(idx2_vec), isSmaller));
+	idx2_vec = _mm256_add_epi32(idx2_vec, step_vec);
+      }
+      float lane_dR2min[8];
+      int lane_idxMin[8];
+      _mm256_storeu_ps(lane_dR2min, dR2min_vec);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(lane_idxMin), idxMin_vec);
+      reduceMin(lane_dR2min, lane_idxMin, 8, dR2_min, idx2_min);
+    }
+    // CV: remaining particles have higher indices than any particle processed by the vectorized loop,
+    //     so requiring dR^2 to be strictly smaller keeps the lowest index in case of ties
+    comp_deltaR2_min_row_scalar(eta1, phi1, eta2, phi2, idx2, n2, dR2_min, idx2_min);
+  }
+
+  /**
+   * @brief Compute minimal dR^2 of 8 particles in the first collection to any particle in the second collection
+   *
+   *        Each lane keeps track of the minimum for one particle in the first collection, so no horizontal reduction is needed
+   */
+  __attribute__((target("avx2")))
+  void comp_deltaR2_min_block_avx2(const float* eta1, const float* phi1,
+				   const float* eta2, const float* phi2, size_t n2,
+				   float* dR2min, int* idxMin)
+  {
+    __m256 eta1_vec = _mm256_loadu_ps(eta1);
+    __m256 phi1_vec = _mm256_loadu_ps(phi1);
+    __m256 dR2min_vec = _mm256_set1_ps(FLT_MAX);
+    __m256i idxMin_vec = _mm256_set1_epi32(-1);
+    for ( size_t idx2 = 0; idx2 < n2; ++idx2 ) {
+      __m256 dR2_vec = comp_deltaR2_avx2(eta1_vec, phi1_vec, _mm256_set1_ps(eta2[idx2]), _mm256_set1_ps(phi2[idx2]));
+      __m256 isSmaller = _mm256_cmp_ps(dR2_vec, dR2min_vec, _CMP_LT_OQ);
+      dR2min_vec = _mm256_blendv_ps(dR2min_vec, dR2_vec, isSmaller);
+      idxMin_vec = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(idxMin_vec), _mm256_castsi256_ps(_mm256_set1_epi32(idx2)), isSmaller));
+    }
+    _mm256_storeu_ps(dR2min, dR2min_vec);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(idxMin), idxMin_vec);
+  }
+
+  __attribute__((target("avx2")))
+  void comp_deltaR2_min_avx2(const float* eta1, const float* phi1, size_t n1,
+			     const float* eta2, const float* phi2, size_t n2,
+			     float* dR2min, int* idxMin)
+  {
+    int block_idxMin[8];
+    size_t idx1 = 0;
+    for ( ; idx1 + 8 <= n1; idx1 += 8 ) {
+      comp_deltaR2_min_block_avx2(eta1 + idx1, phi1 + idx1, eta2, phi2, n2, dR2min + idx1, block_idxMin);
+      if ( idxMin ) {
+	for ( int idxLane = 0; idxLane < 8; ++idxLane ) {
+	  idxMin[idx1 + idxLane] = block_idxMin[idxLane];
+	}
+      }
+    }
+    size_t numRemaining = n1 - idx1;
+    if ( numRemaining == 0 ) return;
+    // CV: choose the fastest way to process the remaining particles in the first collection, depending on the number of pairs:
+    //     for few pairs the overhead of the vectorized code does not pay off;
+    //     for few remaining particles in the first collection and many particles in the second collection, vectorize the loop over the second collection;
+    //     otherwise pad the remaining particles to a full block of 8 particles
+    if ( numRemaining*n2 < 32 ) {
+      comp_deltaR2_min_scalar(eta1 + idx1, phi1 + idx1, numRemaining, eta2, phi2, n2, dR2min + idx1, ( idxMin ) ? idxMin + idx1 : 0);
+    } else if ( n2 >= 16*numRemaining ) {
+      for ( ; idx1 < n1; ++idx1 ) {
+	float dR2_min;
+	int idx2_min;
+	comp_deltaR2_min_row_avx2(eta1[idx1], phi1[idx1], eta2, phi2, n2, dR2_min, idx2_min);
+	dR2min[idx1] = dR2_min;
+	if ( idxMin ) idxMin[idx1] = idx2_min;
+      }
+    } else {
+      float block_eta1[8] = { 0. };
+      float block_phi1[8] = { 0. };
+      float block_dR2min[8];
+      for ( size_t idxLane = 0; idxLane < numRemaining; ++idxLane ) {
+	block_eta1[idxLane] = eta1[idx1 + idxLane];
+	block_phi1[idxLane] = phi1[idx1 + idxLane];
+      }
+      comp_deltaR2_min_block_avx2(block_eta1, block_phi1, eta2, phi2, n2, block_dR2min, block_idxMin);
+      for ( size_t idxLane = 0; idxLane < numRemaining; ++idxLane ) {
+	dR2min[idx1 + idxLane] = block_dR2min[idxLane];
+	if ( idxMin ) idxMin[idx1 + idxLane] = block_idxMin[idxLane];
+      }
+    }
+  }
+
+//--- AVX-512 implementation (16 particles per instruction)
+  __attribute__((target("avx512f")))
+  inline __m512 comp_deltaR2_avx512(__m512 eta1, __m512 phi1, __m512 eta2, __m512 phi2)
+  {
+    __m512 dEta = _mm512_sub_ps(eta1, eta2);
+    __m512 dPhi = _mm512_sub_ps(phi1, phi2);
+    __m512 nTwoPi = _mm512_roundscale_ps(_mm512_mul_ps(dPhi, _mm512_set1_ps(deltaRKernels_invTwoPi)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    dPhi = _mm512_sub_ps(dPhi, _mm512_mul_ps(_mm512_set1_ps(deltaRKernels_twoPi), nTwoPi));
+    return _mm512_add_ps(_mm512_mul_ps(dEta, dEta), _mm512_mul_ps(dPhi, dPhi));
+  }
+
+  __attribute__((target("avx512f")))
+  void comp_deltaR2_matrix_avx512(const float* eta1, const float* phi1, size_t n1,
+				  const float* eta2, const float* phi2, size_t n2,
+				  float* dR2)
+  {
+    for ( size_t idx1 = 0; idx1 < n1; ++idx1 ) {
+      __m512 eta1_vec = _mm512_set1_ps(eta1[idx1]);
+      __m512 phi1_vec = _mm512_set1_ps(phi1[idx1]);
+      float* dR2_row = dR2 + idx1*n2;
+      size_t idx2 = 0;
+      for ( ; idx2 + 16 <= n2; idx2 += 16 ) {
+	_mm512_storeu_ps(dR2_row + idx2, comp_deltaR2_avx512(eta1_vec, phi1_vec, _mm512_loadu_ps(eta2 + idx2), _mm512_loadu_ps(phi2 + idx2)));
+      }
+      for ( ; idx2 < n2; ++idx2 ) {
+	dR2_row[idx2] = comp_deltaR2(eta1[idx1], phi1[idx1], eta2[idx2], phi2[idx2]);
+      }
+    }
+  }
+
+  __attribute__((target("avx512f")))
+  void comp_deltaR2_min_avx512(const float* eta1, const float* phi1, size_t n1,
+			       const float* eta2, const float* phi2, size_t n2,
+			       float* dR2min, int* idxMin)
+  {
+    // CV: process 16 particles of the first collection per instruction
+    //     (each lane keeps track of the minimum for one particle, same as for the AVX2 implementation)
+    size_t idx1 = 0;
+    for ( ; idx1 + 16 <= n1; idx1 += 16 ) {
+      __m512 eta1_vec = _mm512_loadu_ps(eta1 + idx1);
+      __m512 phi1_vec = _mm512_loadu_ps(phi1 + idx1);
+      __m512 dR2min_vec = _mm512_set1_ps(FLT_MAX);
+      __m512i idxMin_vec = _mm512_set1_epi32(-1);
+      for ( size_t idx2 = 0; idx2 < n2; ++idx2 ) {
+	__m512 dR2_vec = comp_deltaR2_avx512(eta1_vec, phi1_vec, _mm512_set1_ps(eta2[idx2]), _mm512_set1_ps(phi2[idx2]));
+	__mmask16 isSmaller = _mm512_cmp_ps_mask(dR2_vec, dR2min_vec, _CMP_LT_OQ);
+	dR2min_vec = _mm512_mask_blend_ps(isSmaller, dR2min_vec, dR2_vec);
+	idxMin_vec = _mm512_mask_blend_epi32(isSmaller, idxMin_vec, _mm512_set1_epi32(idx2));
+      }
+      _mm512_storeu_ps(dR2min + idx1, dR2min_vec);
+      if ( idxMin ) _mm512_storeu_si512(idxMin + idx1, idxMin_vec);
+    }
+    // CV: use the AVX2 implementation for the remaining particles of the first collection
+    //     (AVX-512 capable CPUs support AVX2 also)
+    comp_deltaR2_min_avx2(eta1 + idx1, phi1 + idx1, n1 - idx1, eta2, phi2, n2, dR2min + idx1, ( idxMin ) ? idxMin + idx1 : 0);
+  }
+#endif // DELTAR_KERNELS_X86
+
+  int detectDeltaRKernel()
+  {
+    if ( isDeltaRKernelSupported(kDeltaRKernelAVX512) ) return kDeltaRKernelAVX512;
+    if ( isDeltaRKernelSupported(kDeltaRKernelAVX2)   ) return kDeltaRKernelAVX2;
+    return kDeltaRKernelScalar;
+  }
+}
+
+bool isDeltaRKernelSupported(int kernel)
+{
+  if ( kernel == kDeltaRKernelAuto || kernel == kDeltaRKernelScalar ) return true;
+#ifdef DELTAR_KERNELS_X86
+  __builtin_cpu_init();
+  if ( kernel == kDeltaRKernelAVX2   ) return __builtin_cpu_supports("avx2");
+  if ( kernel == kDeltaRKernelAVX512 ) return __builtin_cpu_supports("avx512f");
+#endif
+  return false;
+}
+
+void setDeltaRKernel(int kernel)
+{
+  if ( kernel != kDeltaRKernelAuto && kernel != kDeltaRKernelScalar && kernel != kDeltaRKernelAVX2 && kernel != kDeltaRKernelAVX512 )
+    throw cms::Exception("setDeltaRKernel")
+      << "Invalid Configuration parameter 'kernel' = " << kernel << " !!\n";
+  if ( !isDeltaRKernelSupported(kernel) )
+    throw cms::Exception("setDeltaRKernel")
+      << "Kernel = " << getDeltaRKernelName(kernel) << " not supported by CPU !!\n";
+  selectedKernel = kernel;
+}
+
+int getDeltaRKernel()
+{
+  static const int detectedKernel = detectDeltaRKernel();
+  int kernel = selectedKernel;
+  return ( kernel == kDeltaRKernelAuto ) ? detectedKernel : kernel;
+}
+
+std::string getDeltaRKernelName(int kernel)
+{
+  if      ( kernel == kDeltaRKernelAuto   ) return "auto";
+  else if ( kernel == kDeltaRKernelScalar ) return "scalar";
+  else if ( kernel == kDeltaRKernelAVX2   ) return "AVX2";
+  else if ( kernel == kDeltaRKernelAVX512 ) return "AVX-512";
+  else return "undefined";
+}
+
+void comp_deltaR2_matrix(const float* eta1, const float* phi1, size_t n1,
+			 const float* eta2, const float* phi2, size_t n2,
+			 float* dR2)
+{
+  switch ( getDeltaRKernel() ) {
+#ifdef DELTAR_KERNELS_X86
+    case kDeltaRKernelAVX512:
+      comp_deltaR2_matrix_avx512(eta1, phi1, n1, eta2, phi2, n2, dR2);
+      break;
+    case kDeltaRKernelAVX2:
+      comp_deltaR2_matrix_avx2(eta1, phi1, n1, eta2, phi2, n2, dR2);
+      break;
+#endif
+    default:
+      comp_deltaR2_matrix_scalar(eta1, phi1, n1, eta2, phi2, n2, dR2);
+  }
+}
+
+void comp_deltaR2_min(const float* eta1, const float* phi1, size_t n1,
+		      const float* eta2, const float* phi2, size_t n2,
+		      float* dR2min, int* idxMin)
+{
+  switch ( getDeltaRKernel() ) {
+#ifdef DELTAR_KERNELS_X86
+    case kDeltaRKernelAVX512:
+      comp_deltaR2_min_avx512(eta1, phi1, n1, eta2, phi2, n2, dR2min, idxMin);
+      break;
+    case kDeltaRKernelAVX2:
+      comp_deltaR2_min_avx2(eta1, phi1, n1, eta2, phi2, n2, dR2min, idxMin);
+      break;
+#endif
+    default:
+      comp_deltaR2_min_scalar(eta1, phi1, n1, eta2, phi2, n2, dR2min, idxMin);
+  }
+}
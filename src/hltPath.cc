@@ -10,20 +10,30 @@ std::vector<hltPath*> create_hltPaths(std::vector<std::string>& branchNames)
   return hltPaths;
 }
 
-void hltPaths_setBranchAddresses(TTree* tree, const std::vector<hltPath*>& hltPaths)
+void hltPaths_setBranchAddresses(EventSource& eventSource, const std::vector<hltPath*>& hltPaths)
 {
   for ( std::vector<hltPath*>::const_iterator hltPath_iter = hltPaths.begin();
 	hltPath_iter != hltPaths.end(); ++hltPath_iter ) {
-    (*hltPath_iter)->setBranchAddress(tree);
+    (*hltPath_iter)->setBranchAddress(eventSource);
   }
 }
 
+std::vector<std::string> hltPaths_branchNames(const std::vector<hltPath*>& hltPaths)
+{
+  std::vector<std::string> branchNames;
+  for ( std::vector<hltPath*>::const_iterator hltPath_iter = hltPaths.begin();
+	hltPath_iter != hltPaths.end(); ++hltPath_iter ) {
+    branchNames.push_back((*hltPath_iter)->branchName_);
+  }
+  return branchNames;
+}
+
 bool hltPaths_isTriggered(const std::vector<hltPath*>& hltPaths)
 {
   bool retVal = false;
   for ( std::vector<hltPath*>::const_iterator hltPath_iter = hltPaths.begin();
 	hltPath_iter != hltPaths.end(); ++hltPath_iter ) {
-    if ( (*hltPath_iter)->value_ >= 1 ) {
+    if ( (*(*hltPath_iter)->value_) >= 1 ) {
       retVal = true;
       break;
     }
@@ -3,7 +3,7 @@
 #include "tthAnalysis/HiggsToTauTau/interface/RecoElectron.h" // RecoElectron
 #include "tthAnalysis/HiggsToTauTau/interface/RecoMuon.h" // RecoMuon
 
-#include "DataFormats/Math/interface/deltaR.h" // deltaR
+#include "tthAnalysis/HiggsToTauTau/interface/deltaRKernels.h" // comp_deltaR2_min, comp_deltaR2_matrix, EtaPhiArrays
 
 #include <cmath> // std::abs(), std::fabs(), std::sqrt(), std::pow()
 
@@ -19,7 +19,7 @@ double comp_MT_met_lep1(const GenParticle& lepton, double met_pt, double met_phi
 {
   double met_px = met_pt*std::cos(met_phi);
   double met_py = met_pt*std::sin(met_phi);
-  double mT = std::sqrt(square(lepton.p4_.Et() + met_pt) - (square(lepton.p4_.px() + met_px) + square(lepton.p4_.py() + met_py)));
+  double mT = std::sqrt(square(lepton.p4().Et() + met_pt) - (square(lepton.p4().px() + met_px) + square(lepton.p4().py() + met_py)));
   return mT;
 }
 
@@ -35,13 +35,14 @@ double comp_n_jet25_recl(const std::vector<const RecoJet*>& jets_cleaned)
 
 double comp_mindr_lep1_jet(const GenParticle& lepton, const std::vector<const RecoJet*>& jets_cleaned)
 {
-  double dRmin = 1.e+3;
-  for ( std::vector<const RecoJet*>::const_iterator jet = jets_cleaned.begin();
-	jet != jets_cleaned.end(); ++jet ) {
-    double dR = deltaR(lepton.eta_, lepton.phi_, (*jet)->eta_, (*jet)->phi_);
-    if ( dR < dRmin ) dRmin = dR;
-  }
-  return dRmin;
+  if ( jets_cleaned.empty() ) return 1.e+3;
+  EtaPhiArrays jets_etaPhi;
+  jets_etaPhi.push_back(jets_cleaned);
+  float lepton_eta = lepton.eta_;
+  float lepton_phi = lepton.phi_;
+  float dR2min;
+  comp_deltaR2_min(&lepton_eta, &lepton_phi, 1, jets_etaPhi.eta(), jets_etaPhi.phi(), jets_etaPhi.size(), &dR2min);
+  return std::sqrt(dR2min);
 }
 
 double comp_mindr_lep2_jet(const GenParticle& lepton, const std::vector<const RecoJet*>& jets_cleaned)
@@ -71,21 +72,38 @@ double comp_lep2_conePt(const RecoLepton& lepton)
 
 double comp_avg_dr_jet(const std::vector<const RecoJet*>& jets_cleaned)
 {
+  EtaPhiArrays jets_etaPhi;
+  for ( std::vector<const RecoJet*>::const_iterator jet = jets_cleaned.begin();
+	jet != jets_cleaned.end(); ++jet ) {
+    if ( (*jet)->pt_ > 25. && std::fabs((*jet)->eta_) < 2.4 ) jets_etaPhi.push_back((*jet)->eta_, (*jet)->phi_);
+  }
+  size_t numJets = jets_etaPhi.size();
+  if ( numJets < 2 ) return 0.;
+  std::vector<float> dR2(numJets*numJets);
+  comp_deltaR2_matrix(jets_etaPhi.eta(), jets_etaPhi.phi(), numJets, jets_etaPhi.eta(), jets_etaPhi.phi(), numJets, dR2.data());
   int n_jet_pairs = 0;
   double dRsum = 0.;
-  for ( std::vector<const RecoJet*>::const_iterator jet1 = jets_cleaned.begin();
-	jet1 != jets_cleaned.end(); ++jet1 ) {
-    if ( (*jet1)->pt_ > 25. && std::fabs((*jet1)->eta_) < 2.4 ) {
-      for ( std::vector<const RecoJet*>::const_iterator jet2 = jet1 + 1;
-	    jet2 != jets_cleaned.end(); ++jet2 ) {
-	if ( (*jet2)->pt_ > 25. && std::fabs((*jet2)->eta_) < 2.4 ) {
-	  double dR = deltaR((*jet1)->eta_, (*jet1)->phi_, (*jet2)->eta_, (*jet2)->phi_);
-	  dRsum += dR;
-	  ++n_jet_pairs;
-	}
-      }
+  for ( size_t idxJet1 = 0; idxJet1 < numJets; ++idxJet1 ) {
+    for ( size_t idxJet2 = idxJet1 + 1; idxJet2 < numJets; ++idxJet2 ) {
+      dRsum += std::sqrt(dR2[idxJet1*numJets + idxJet2]);
+      ++n_jet_pairs;
     }
   }
-  double avg_dr_jet = ( n_jet_pairs > 0 ) ? dRsum/n_jet_pairs : 0.;
+  double avg_dr_jet = dRsum/n_jet_pairs;
   return avg_dr_jet;
 }
+
+std::vector<std::string> getMVAInputLayout_2lss()
+{
+  std::vector<std::string> mvaInputLayout(kNumMVAInputs_2lss);
+  mvaInputLayout[kMVAInput_2lss_max_lep_eta]    = "max(abs(LepGood_eta[iF_Recl[0]]),abs(LepGood_eta[iF_Recl[1]]))";
+  mvaInputLayout[kMVAInput_2lss_MT_met_lep1]    = "MT_met_lep1";
+  mvaInputLayout[kMVAInput_2lss_nJet25_Recl]    = "nJet25_Recl";
+  mvaInputLayout[kMVAInput_2lss_mindr_lep1_jet] = "mindr_lep1_jet";
+  mvaInputLayout[kMVAInput_2lss_mindr_lep2_jet] = "mindr_lep2_jet";
+  mvaInputLayout[kMVAInput_2lss_lep1_conePt]    = "LepGood_conePt[iF_Recl[0]]";
+  mvaInputLayout[kMVAInput_2lss_lep2_conePt]    = "LepGood_conePt[iF_Recl[1]]";
+  mvaInputLayout[kMVAInput_2lss_met_pt]         = "min(met_pt,400)";
+  mvaInputLayout[kMVAInput_2lss_avg_dr_jet]     = "avg_dr_jet";
+  return mvaInputLayout;
+}
@@ -8,7 +8,10 @@ process.fwliteInput = cms.PSet(
     fileNames = cms.vstring('/afs/cern.ch/user/v/veelken/scratch0/VHbbNtuples_7_6_x/CMSSW_7_6_3/src/VHbbAnalysis/Heppy/test/latest_Loop/tree.root'),
     ##fileNames = cms.vstring('/afs/cern.ch/user/k/kaehatah/public/ttHJetToNonbb_M125_13TeV_amcatnloFXFX_madspin_pythia8_mWCutfix/VHBB_HEPPY_V12_ttHJetToNonbb_M125_13TeV_amcatnloFXFX_madspin_Py8_mWCutfix__fall15MAv2-pu25ns15v1_76r2as_v12-v1/160330_172426/0000/tree_1.root'),
     maxEvents = cms.int32(-1),
-    outputEvery = cms.uint32(100000)
+    outputEvery = cms.uint32(100000),
+    inputFormat = cms.string('ROOT'), # 'ROOT' or 'columnarCache' (files produced by convertToColumnarCache)
+    firstEntry = cms.int64(0),
+    lastEntry = cms.int64(-1) # -1 = process all entries
 )
 
 process.fwliteOutput = cms.PSet(
@@ -42,8 +45,37 @@ process.analyze_2lss_1tau = cms.PSet(
     
     isMC = cms.bool(False),
     central_or_shift = cms.string('central'),
+    # CV: if non-empty, all systematic shifts given in central_or_shifts are processed in a single pass
+    #     over the input tree and the value of central_or_shift is ignored;
+    #     shifts that change the b-tagging weights only (CMS_ttHl_btag_*) share the event selection with the central value
+    #     and are filled into the same histogram objects
+    central_or_shifts = cms.vstring(),
     lumiScale = cms.double(1.),
+
+    # CV: number of threads processing events in parallel;
+    #     writing a skim is supported in single-threaded mode only
+    numThreads = cms.int32(1),
     
     selEventsFileName_input = cms.string(''),
-    selEventsFileName_output = cms.string('')
+    selEventsFileName_output = cms.string(''),
+
+    # CV: if non-empty, the cut-flow table (events passing each cut and CPU time per cut) is written to this file
+    cutFlowFileName = cms.string(''),
+
+    # CV: BDT outputs are computed once per event and reused for all systematic shifts that do not change the BDT inputs;
+    #     if outputFileName is non-empty, the BDT outputs of all events are written to this file,
+    #     from which they can be read back (inputFileName) when re-running the analysis on the same events with the same BDTs
+    mvaOutputCache = cms.PSet(
+        inputFileName = cms.string(''),
+        outputFileName = cms.string('')
+    ),
+
+    # CV: if outputFileName is non-empty, events passing the preselection are written to a slimmed copy of the input tree,
+    #     which can be used as input for re-running the analysis with different leptonSelection, chargeSelection or MVA binning
+    skim = cms.PSet(
+        outputFileName = cms.string(''),
+        compressionAlgorithm = cms.string('LZ4'),
+        compressionLevel = cms.int32(4),
+        basketSize = cms.int32(256000)
+    )
 )
@@ -8,7 +8,10 @@ process.fwliteInput = cms.PSet(
     ##fileNames = cms.vstring('/afs/cern.ch/user/v/veelken/scratch0/VHbbNtuples_7_6_x/CMSSW_7_6_3/src/VHbbAnalysis/Heppy/test/latest_Loop/tree.root'),
     fileNames = cms.vstring('/afs/cern.ch/user/k/kaehatah/public/ttHJetToNonbb_M125_13TeV_amcatnloFXFX_madspin_pythia8_mWCutfix/VHBB_HEPPY_V12_ttHJetToNonbb_M125_13TeV_amcatnloFXFX_madspin_Py8_mWCutfix__fall15MAv2-pu25ns15v1_76r2as_v12-v1/160330_172426/0000/tree_1.root'),
     maxEvents = cms.int32(-1),
-    outputEvery = cms.uint32(100000)
+    outputEvery = cms.uint32(100000),
+    inputFormat = cms.string('ROOT'), # 'ROOT' or 'columnarCache' (files produced by convertToColumnarCache)
+    firstEntry = cms.int64(0),
+    lastEntry = cms.int64(-1) # -1 = process all entries
 )
 
 process.fwliteOutput = cms.PSet(
@@ -35,7 +38,13 @@ process.analyze_jetToTauFakeRate = cms.PSet(
     isMC = cms.bool(False),
     central_or_shift = cms.string('central'),
     lumiScale = cms.double(1.),
+
+    # CV: number of threads processing events in parallel
+    numThreads = cms.int32(1),
     
     selEventsFileName_input = cms.string(''),
-    selEventsFileName_output = cms.string('')
+    selEventsFileName_output = cms.string(''),
+
+    # CV: if non-empty, the cut-flow table (events passing each cut and CPU time per cut) is written to this file
+    cutFlowFileName = cms.string('')
 )
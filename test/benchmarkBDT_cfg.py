@@ -0,0 +1,16 @@
+import FWCore.ParameterSet.Config as cms
+
+process = cms.PSet()
+
+process.benchmarkBDT = cms.PSet(
+    mvaFileNames = cms.vstring(
+        'tthAnalysis/HiggsToTauTau/data/2lss_ttV_BDTG.weights.xml',
+        'tthAnalysis/HiggsToTauTau/data/2lss_ttbar_BDTG.weights.xml',
+        'tthAnalysis/HiggsToTauTau/data/3l_ttV_BDTG.weights.xml',
+        'tthAnalysis/HiggsToTauTau/data/3l_ttbar_BDTG.weights.xml'
+    ),
+
+    numEvents = cms.int32(100000),
+    numRepetitions = cms.int32(10),
+    seed = cms.uint32(12345)
+)
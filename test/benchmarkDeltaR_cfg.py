@@ -0,0 +1,14 @@
+import FWCore.ParameterSet.Config as cms
+
+process = cms.PSet()
+
+process.benchmarkDeltaR = cms.PSet(
+    numEvents = cms.int32(100000),
+
+    # CV: typical multiplicities of leptons and hadronic taus (numParticles1) and of jets (numParticles2) per event
+    numParticles1 = cms.int32(4),
+    numParticles2 = cms.int32(8),
+
+    numRepetitions = cms.int32(10),
+    seed = cms.uint32(12345)
+)
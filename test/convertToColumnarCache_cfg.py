@@ -0,0 +1,31 @@
+import FWCore.ParameterSet.Config as cms
+
+import os
+
+process = cms.PSet()
+
+process.fwliteInput = cms.PSet(
+    fileNames = cms.vstring('/afs/cern.ch/user/v/veelken/scratch0/VHbbNtuples_7_6_x/CMSSW_7_6_3/src/VHbbAnalysis/Heppy/test/latest_Loop/tree.root'),
+    maxEvents = cms.int32(-1),
+    outputEvery = cms.uint32(100000)
+)
+
+process.convertToColumnarCache = cms.PSet(
+    treeName = cms.string('tree'),
+
+    outputFileName = cms.string('tree.ttcol'),
+
+    # CV: wildcards are allowed; branches holding the number of elements of variable-size arrays are added automatically
+    branchNames = cms.vstring(
+        'run', 'lumi', 'evt',
+        'genHiggsDecayMode',
+        'HLT_BIT_*',
+        'met_*',
+        'selLeptons_*',
+        'TauGood_*',
+        'Jet_*',
+        'GenLep_*', 'GenHadTaus_*', 'GenJet_*'
+    ),
+
+    blockSize = cms.int32(10000)
+)
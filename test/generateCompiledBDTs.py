@@ -0,0 +1,178 @@
+import os, sys, glob, logging
+import xml.etree.ElementTree as ET
+
+"""This script generates C++ code for the BDTs stored in TMVA weight files (XML format),
+   so that the BDTs are compiled into the library and the weight files do not need to be parsed at runtime.
+   Each BDT becomes one function, with the cuts and responses of all trees written as constants.
+
+   Usage: python generateCompiledBDTs.py [weight files]
+          (by default, the code is generated for all data/*.weights.xml files that contain a supported BDT)
+   Output: src/compiledBDTs_generated.cc (overwriting enabled)
+
+   Rerun the script whenever a weight file is added or changed:
+   TMVAInterface compares the checksum of the weight file with the checksum stored in the generated code
+   and ignores the compiled BDT in case they differ.
+"""
+
+PACKAGE_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+PACKAGE_NAME = "tthAnalysis/HiggsToTauTau"
+OUTPUT_FILE = os.path.join(PACKAGE_DIR, "src", "compiledBDTs_generated.cc")
+
+FNV_OFFSET = 14695981039346656037
+FNV_PRIME = 1099511628211
+
+class UnsupportedMVA(Exception):
+  pass
+
+def compute_checksum(file_name):
+  """Computes 64-bit FNV-1a hash of the content of the file (same hash as computed by computeFileChecksum in src/compiledBDTs.cc)
+  """
+  checksum = FNV_OFFSET
+  with open(file_name, "rb") as f:
+    for byte in bytearray(f.read()):
+      checksum = ((checksum ^ byte) * FNV_PRIME) & 0xFFFFFFFFFFFFFFFF
+  return checksum
+
+def read_bdt(file_name):
+  """Reads the input variables and trees from the weight file
+
+  The same restrictions apply as for BDTForest: only classification BDTs with gradient boosting,
+  without variable transformations and without Fisher cuts are supported.
+
+  Returns:
+    list of input variable names (in the order used for the TMVA training), list of trees (root nodes as ElementTree elements)
+  """
+  root = ET.parse(file_name).getroot()
+  if not root.get("Method", "").startswith("BDT::"):
+    raise UnsupportedMVA("Method = %s is not a BDT" % root.get("Method"))
+  for info in root.iter("Info"):
+    if info.get("name") == "AnalysisType" and info.get("value") != "Classification":
+      raise UnsupportedMVA("AnalysisType is not Classification")
+  boost_types = [ option.text for option in root.iter("Option") if option.get("name") == "BoostType" ]
+  if boost_types != [ "Grad" ]:
+    raise UnsupportedMVA("BoostType is not Grad")
+  for transformations in root.iter("Transformations"):
+    if int(transformations.get("NTransformations")) != 0:
+      raise UnsupportedMVA("Variable transformations are not supported")
+  input_variables = []
+  for variables in root.iter("Variables"):
+    for variable in variables:
+      if int(variable.get("VarIndex")) != len(input_variables):
+        raise UnsupportedMVA("Variables are not stored in order of VarIndex")
+      input_variables.append(variable.get("Expression"))
+  trees = [ tree.find("Node") for tree in root.iter("BinaryTree") ]
+  if not trees or None in trees:
+    raise UnsupportedMVA("No trees found")
+  return input_variables, trees
+
+def float_literal(value):
+  """Returns single precision C++ literal for the number given as string in the weight file
+  """
+  float(value) # CV: raise exception in case the string is not a number
+  if value.lower().lstrip("+-") in [ "inf", "nan" ]:
+    raise UnsupportedMVA("Cut or response = %s is not finite" % value)
+  if not any(c in value for c in ".eE"):
+    value += "."
+  return value + "f"
+
+def write_node(node, num_input_variables, indent, lines):
+  """Appends the code for the node (recursively including all its daughters) to lines
+
+  TMVA sends events to the right daughter if value >= cut for cType = 1 and if value < cut for cType = 0.
+  The cuts and responses are written as single precision literals in the notation used in the weight file,
+  so that they are rounded in the same way as by TMVA::DecisionTreeNode and BDTForest.
+  """
+  daughters = dict((daughter.get("pos"), daughter) for daughter in node.findall("Node"))
+  if not daughters:
+    lines.append("%ssum += %s;" % (indent, float_literal(node.get("res"))))
+    return
+  if set(daughters.keys()) != set([ "l", "r" ]):
+    raise UnsupportedMVA("Node with only one daughter")
+  if int(node.get("NCoef")) != 0:
+    raise UnsupportedMVA("Fisher cuts are not supported")
+  idx_variable = int(node.get("IVar"))
+  if not (0 <= idx_variable < num_input_variables):
+    raise UnsupportedMVA("Invalid index of input variable = %i" % idx_variable)
+  if int(node.get("cType")) != 0:
+    daughter_geq, daughter_lt = daughters["r"], daughters["l"]
+  else:
+    daughter_geq, daughter_lt = daughters["l"], daughters["r"]
+  lines.append("%sif ( x%i >= %s ) {" % (indent, idx_variable, float_literal(node.get("Cut"))))
+  write_node(daughter_geq, num_input_variables, indent + "  ", lines)
+  lines.append("%s} else {" % indent)
+  write_node(daughter_lt, num_input_variables, indent + "  ", lines)
+  lines.append("%s}" % indent)
+
+def generate_bdt(file_name, name):
+  """Generates the code of the function computing the output of the BDT stored in the weight file
+
+  Returns:
+    list of code lines, list of input variable names
+  """
+  input_variables, trees = read_bdt(file_name)
+  lines = []
+  lines.append("//--- BDT read from file = %s/data/%s" % (PACKAGE_NAME, os.path.basename(file_name)))
+  lines.append("  const char* inputVariables_%s[] = {" % name)
+  lines.append(",\n".join([ "    \"%s\"" % input_variable for input_variable in input_variables ]))
+  lines.append("  };")
+  lines.append("")
+  lines.append("  double compiledBDT_%s(const Float_t* mvaInputs, const int* mvaInputIndices)" % name)
+  lines.append("  {")
+  for idx_variable in range(len(input_variables)):
+    lines.append("    const Float_t x%i = mvaInputs[mvaInputIndices[%i]];" % (idx_variable, idx_variable))
+  lines.append("    if ( %s ) return -999.;" % " || ".join([ "TMath::IsNaN(x%i)" % idx_variable for idx_variable in range(len(input_variables)) ]))
+  lines.append("    double sum = 0.;")
+  for idx_tree, tree in enumerate(trees):
+    lines.append("    // tree %i" % idx_tree)
+    write_node(tree, len(input_variables), "    ", lines)
+  lines.append("    // CV: same transformation of the sum of responses as in TMVA::MethodBDT::GetGradBoostMVA")
+  lines.append("    return 2./(1. + std::exp(-2.*sum)) - 1.;")
+  lines.append("  }")
+  lines.append("")
+  return lines, input_variables
+
+def main():
+  logging.basicConfig(stream = sys.stdout, level = logging.INFO, format = "%(asctime)s - %(levelname)s: %(message)s")
+
+  file_names = sys.argv[1:]
+  skip_unsupported = not file_names
+  if not file_names:
+    file_names = sorted(glob.glob(os.path.join(PACKAGE_DIR, "data", "*.weights.xml")))
+
+  code = []
+  entries = []
+  for file_name in file_names:
+    name = os.path.basename(file_name).replace(".weights.xml", "").replace(".", "_").replace("-", "_")
+    try:
+      lines, input_variables = generate_bdt(file_name, name)
+    except UnsupportedMVA as error:
+      if not skip_unsupported:
+        raise
+      logging.warning("Skipping file = %s: %s" % (file_name, error))
+      continue
+    logging.info("Generated code for file = %s" % file_name)
+    code.extend(lines)
+    entries.append("  { \"%s/data/%s\", 0x%016xULL, inputVariables_%s, %i, &compiledBDT_%s }" % \
+      (PACKAGE_NAME, os.path.basename(file_name), compute_checksum(file_name), name, len(input_variables), name))
+
+  with open(OUTPUT_FILE, "w") as output_file:
+    output_file.write("// CV: this file has been generated by test/generateCompiledBDTs.py from the BDT weight files in data/, do not edit it by hand !!\n")
+    output_file.write("\n")
+    output_file.write("#include \"tthAnalysis/HiggsToTauTau/interface/compiledBDTs.h\"\n")
+    output_file.write("\n")
+    output_file.write("#include <TMath.h> // TMath::IsNaN\n")
+    output_file.write("\n")
+    output_file.write("#include <cmath> // std::exp\n")
+    output_file.write("\n")
+    output_file.write("namespace\n{\n")
+    output_file.write("\n".join(code))
+    output_file.write("}\n")
+    output_file.write("\n")
+    output_file.write("extern const CompiledBDT compiledBDTs[] = {\n")
+    output_file.write(",\n".join(entries + [ "  { 0, 0, 0, 0, 0 }" ]) + "\n")
+    output_file.write("};\n")
+    output_file.write("extern const size_t numCompiledBDTs = %i;\n" % len(entries))
+  logging.info("Wrote file = %s" % OUTPUT_FILE)
+
+if __name__ == "__main__":
+  main()
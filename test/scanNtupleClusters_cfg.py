@@ -0,0 +1,17 @@
+import FWCore.ParameterSet.Config as cms
+
+import os
+
+process = cms.PSet()
+
+process.fwliteInput = cms.PSet(
+    fileNames = cms.vstring('/afs/cern.ch/user/v/veelken/scratch0/VHbbNtuples_7_6_x/CMSSW_7_6_3/src/VHbbAnalysis/Heppy/test/latest_Loop/tree.root'),
+    maxEvents = cms.int32(-1),
+    outputEvery = cms.uint32(100000)
+)
+
+process.scanNtupleClusters = cms.PSet(
+    treeName = cms.string('tree'),
+
+    outputFileName = cms.string('scanNtupleClusters.json')
+)
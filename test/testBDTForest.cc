@@ -0,0 +1,178 @@
+#include "FWCore/ParameterSet/interface/FileInPath.h" // edm::FileInPath
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include <TRandom3.h> // TRandom3
+#include <TXMLEngine.h> // TXMLEngine
+#include <TMath.h> // TMath::QuietNaN
+#include "TMVA/Reader.h" // TMVA::Reader
+#include "TMVA/MethodBase.h" // TMVA::MethodBase
+#include "TMVA/Tools.h" // TMVA::Tools
+
+#include "tthAnalysis/HiggsToTauTau/interface/BDTForest.h" // BDTForest
+
+#include <iostream> // std::cout, std::cerr
+#include <string> // std::string
+#include <vector> // std::vector<>
+#include <cmath> // std::fabs
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE, std::atof
+
+typedef std::vector<std::string> vstring;
+
+/**
+ * @brief Read names and ranges of the input variables (nodeName = "Variables") or spectators (nodeName = "Spectators")
+ *        from TMVA weight file
+ */
+void readVariables(const std::string& mvaFileName, const std::string& nodeName, vstring& names, std::vector<double>& mins, std::vector<double>& maxs)
+{
+  TXMLEngine xml;
+  XMLDocPointer_t xmlDocument = xml.ParseFile(mvaFileName.data());
+  if ( !xmlDocument )
+    throw cms::Exception("testBDTForest")
+      << "Failed to parse file = " << mvaFileName << " !!\n";
+  for ( XMLNodePointer_t xmlNode = xml.GetChild(xml.DocGetRootElement(xmlDocument)); xmlNode; xmlNode = xml.GetNext(xmlNode) ) {
+    if ( nodeName != xml.GetNodeName(xmlNode) ) continue;
+    for ( XMLNodePointer_t xmlVariable = xml.GetChild(xmlNode); xmlVariable; xmlVariable = xml.GetNext(xmlVariable) ) {
+      names.push_back(xml.GetAttr(xmlVariable, "Expression"));
+      mins.push_back(std::atof(xml.GetAttr(xmlVariable, "Min")));
+      maxs.push_back(std::atof(xml.GetAttr(xmlVariable, "Max")));
+    }
+  }
+  xml.FreeDoc(xmlDocument);
+}
+
+/**
+ * @brief Count the events for which the output differs from the output computed by TMVA::Reader by more than given tolerance
+ */
+int compareOutputs(const std::string& label, const std::vector<double>& mvaOutputs, const std::vector<double>& mvaOutputs_reference, double tolerance)
+{
+  int numMismatches = 0;
+  for ( size_t idxEvent = 0; idxEvent < mvaOutputs.size(); ++idxEvent ) {
+    if ( !(std::fabs(mvaOutputs[idxEvent] - mvaOutputs_reference[idxEvent]) <= tolerance) ) {
+      if ( numMismatches < 10 ) {
+	std::cerr << label << ": event #" << idxEvent << ": output = " << mvaOutputs[idxEvent] << ","
+		  << " expected " << mvaOutputs_reference[idxEvent] << std::endl;
+      }
+      ++numMismatches;
+    }
+  }
+  return numMismatches;
+}
+
+/**
+ * @brief Evaluate the BDT given by the TMVA weight file by TMVA::Reader and by BDTForest
+ *        for random input values and compare the outputs
+ * @return Number of mismatches
+ */
+int testBDT(const std::string& mvaFileName, TRandom3& rnd)
+{
+  std::string mvaFileName_full = edm::FileInPath(mvaFileName).fullPath();
+
+  vstring mvaInputVariables;
+  std::vector<double> mvaInputVariables_min;
+  std::vector<double> mvaInputVariables_max;
+  readVariables(mvaFileName_full, "Variables", mvaInputVariables, mvaInputVariables_min, mvaInputVariables_max);
+  vstring spectators;
+  std::vector<double> spectators_min;
+  std::vector<double> spectators_max;
+  readVariables(mvaFileName_full, "Spectators", spectators, spectators_min, spectators_max);
+  size_t numVariables = mvaInputVariables.size();
+
+//--- generate input values, uniformly within the range of each input variable seen in the TMVA training
+//    (extended by 10% on either side, to include values outside of the range);
+//    every hundredth event has one input value set to NaN
+  const int numEvents = 10000;
+  std::vector<Float_t> mvaInputs(numEvents*numVariables);
+  for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+    for ( size_t idxVariable = 0; idxVariable < numVariables; ++idxVariable ) {
+      double range = mvaInputVariables_max[idxVariable] - mvaInputVariables_min[idxVariable];
+      mvaInputs[idxEvent*numVariables + idxVariable] = rnd.Uniform(mvaInputVariables_min[idxVariable] - 0.1*range, mvaInputVariables_max[idxVariable] + 0.1*range);
+    }
+    if ( (idxEvent % 100) == 0 ) mvaInputs[idxEvent*numVariables + (idxEvent/100) % numVariables] = TMath::QuietNaN();
+  }
+
+//--- evaluate MVA by TMVA::Reader
+  std::vector<Float_t> mvaInputVariables_reader(numVariables);
+  std::vector<Float_t> spectators_reader(spectators.size());
+  TMVA::Reader reader("!V:Silent");
+  for ( size_t idxVariable = 0; idxVariable < numVariables; ++idxVariable ) {
+    reader.AddVariable(mvaInputVariables[idxVariable], &mvaInputVariables_reader[idxVariable]);
+  }
+  for ( size_t idxSpectator = 0; idxSpectator < spectators.size(); ++idxSpectator ) {
+    reader.AddSpectator(spectators[idxSpectator], &spectators_reader[idxSpectator]);
+  }
+  TMVA::MethodBase* method = dynamic_cast<TMVA::MethodBase*>(reader.BookMVA("BDTG", mvaFileName_full));
+  if ( !method )
+    throw cms::Exception("testBDTForest")
+      << "Failed to book MVA from file = " << mvaFileName_full << " !!\n";
+  std::vector<double> mvaOutputs_reference(numEvents);
+  for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+    for ( size_t idxVariable = 0; idxVariable < numVariables; ++idxVariable ) {
+      mvaInputVariables_reader[idxVariable] = mvaInputs[idxEvent*numVariables + idxVariable];
+    }
+    mvaOutputs_reference[idxEvent] = reader.EvaluateMVA(method);
+  }
+
+  int numMismatches = 0;
+
+//--- evaluate MVA by BDTForest, event by event
+  BDTForest bdt(mvaFileName_full);
+  if ( bdt.getInputVariables() != mvaInputVariables ) {
+    std::cerr << mvaFileName << ": input variables of BDTForest do not match the weight file !!" << std::endl;
+    ++numMismatches;
+  }
+  std::vector<double> mvaOutputs(numEvents);
+  for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+    mvaOutputs[idxEvent] = bdt(&mvaInputs[idxEvent*numVariables]);
+  }
+  // CV: BDTForest stores cuts and responses with the same (single) precision as TMVA,
+  //     small differences may arise from the order in which the responses of the trees are summed
+  numMismatches += compareOutputs(mvaFileName + " (BDTForest)", mvaOutputs, mvaOutputs_reference, 1.e-6);
+  std::vector<double> mvaOutputs_event = mvaOutputs;
+
+//--- evaluate MVA by BDTForest with input values passed in reversed order
+  std::vector<int> mvaInputIndices;
+  for ( size_t idxVariable = 0; idxVariable < numVariables; ++idxVariable ) {
+    mvaInputIndices.push_back(numVariables - (idxVariable + 1));
+  }
+  bdt.setInputIndices(mvaInputIndices);
+  std::vector<Float_t> mvaInputs_reversed(numVariables);
+  for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+    for ( size_t idxVariable = 0; idxVariable < numVariables; ++idxVariable ) {
+      mvaInputs_reversed[mvaInputIndices[idxVariable]] = mvaInputs[idxEvent*numVariables + idxVariable];
+    }
+    mvaOutputs[idxEvent] = bdt(mvaInputs_reversed.data());
+  }
+  numMismatches += compareOutputs(mvaFileName + " (BDTForest, reversed inputs)", mvaOutputs, mvaOutputs_event, 0.);
+
+  std::cout << mvaFileName << ": " << bdt.getNumTrees() << " trees, " << numMismatches << " mismatches" << std::endl;
+  return numMismatches;
+}
+
+/**
+ * @brief Check that BDTForest gives the same output as TMVA::Reader for the BDTs used in the analysis
+ */
+int main(int argc, char* argv[])
+{
+  TMVA::Tools::Instance();
+  TRandom3 rnd(12345);
+
+  vstring mvaFileNames = {
+    "tthAnalysis/HiggsToTauTau/data/2lss_ttV_BDTG.weights.xml",
+    "tthAnalysis/HiggsToTauTau/data/2lss_ttbar_BDTG.weights.xml",
+    "tthAnalysis/HiggsToTauTau/data/3l_ttV_BDTG.weights.xml",
+    "tthAnalysis/HiggsToTauTau/data/3l_ttbar_BDTG.weights.xml"
+  };
+
+  int numMismatches = 0;
+  for ( vstring::const_iterator mvaFileName = mvaFileNames.begin();
+	mvaFileName != mvaFileNames.end(); ++mvaFileName ) {
+    numMismatches += testBDT(*mvaFileName, rnd);
+  }
+
+  if ( numMismatches > 0 ) {
+    std::cerr << "<testBDTForest>: " << numMismatches << " mismatches found !!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "<testBDTForest>: all checks passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,96 @@
+#include "tthAnalysis/HiggsToTauTau/interface/categories_2lss_1tau.h" // getCategory_2lss_1tau, getCategoryName_2lss_1tau, kNoCategory_2lss_1tau
+
+#include <iostream> // std::cout, std::cerr
+#include <string> // std::string
+#include <cstddef> // size_t
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+
+/**
+ * @brief Event category as computed by the if-else chain previously used in analyze_2lss_1tau
+ */
+int getCategory_2lss_1tau_reference(size_t numElectrons, size_t numMuons, bool isCharge_pp, bool isCharge_mm, size_t numBJets_medium)
+{
+  int category = -1;
+  if      ( numElectrons == 2 &&                     isCharge_pp && numBJets_medium >= 1 ) category = k2epp_btight;
+  else if ( numElectrons == 2 &&                     isCharge_pp                         ) category = k2epp_bloose;
+  else if ( numElectrons == 2 &&                     isCharge_mm && numBJets_medium >= 1 ) category = k2emm_btight;
+  else if ( numElectrons == 2 &&                     isCharge_mm                         ) category = k2emm_bloose;
+  else if ( numElectrons == 1 && numMuons == 1 &&    isCharge_pp && numBJets_medium >= 1 ) category = k1e1mupp_btight;
+  else if ( numElectrons == 1 && numMuons == 1 &&    isCharge_pp                         ) category = k1e1mupp_bloose;
+  else if ( numElectrons == 1 && numMuons == 1 &&    isCharge_mm && numBJets_medium >= 1 ) category = k1e1mumm_btight;
+  else if ( numElectrons == 1 && numMuons == 1 &&    isCharge_mm                         ) category = k1e1mumm_bloose;
+  else if (                      numMuons == 2 &&    isCharge_pp && numBJets_medium >= 1 ) category = k2mupp_btight;
+  else if (                      numMuons == 2 &&    isCharge_pp                         ) category = k2mupp_bloose;
+  else if (                      numMuons == 2 &&    isCharge_mm && numBJets_medium >= 1 ) category = k2mumm_btight;
+  else if (                      numMuons == 2 &&    isCharge_mm                         ) category = k2mumm_bloose;
+  return category;
+}
+
+/**
+ * @brief Name of the histogram directory filled for given event category, as previously used in analyze_2lss_1tau
+ */
+std::string getCategoryName_2lss_1tau_reference(size_t numElectrons, size_t numMuons, bool isCharge_pp, size_t numBJets_medium)
+{
+  std::string name;
+  if      ( numElectrons == 2 ) name = "2e";
+  else if ( numMuons     == 2 ) name = "2mu";
+  else                          name = "1e1mu";
+  name += ( isCharge_pp ) ? "pp" : "mm";
+  name += "_1tau";
+  name += ( numBJets_medium >= 1 ) ? "_btight" : "_bloose";
+  return name;
+}
+
+/**
+ * @brief Compare the category computed by table lookup with the if-else chain previously used in analyze_2lss_1tau
+ *        for all combinations of lepton flavours, lepton charges and number of b-tagged jets,
+ *        and check that events with two leptons of opposite charge or with a number of leptons different from two
+ *        are not assigned to any category
+ */
+int main(int argc, char* argv[])
+{
+  int numFailures = 0;
+  for ( size_t numElectrons = 0; numElectrons <= 3; ++numElectrons ) {
+    for ( size_t numMuons = 0; numMuons <= 3; ++numMuons ) {
+      // CV: isCharge_pp and isCharge_mm are never both true, so idxCharge = 0 (OS), 1 (pp) and 2 (mm) cover all events
+      for ( int idxCharge = 0; idxCharge < 3; ++idxCharge ) {
+	bool isCharge_pp = ( idxCharge == 1 );
+	bool isCharge_mm = ( idxCharge == 2 );
+	for ( size_t numBJets_medium = 0; numBJets_medium <= 3; ++numBJets_medium ) {
+	  int category = getCategory_2lss_1tau(numElectrons, numMuons, isCharge_pp, isCharge_mm, numBJets_medium);
+	  int category_expected = kNoCategory_2lss_1tau;
+	  if ( numElectrons + numMuons == 2 ) {
+	    category_expected = getCategory_2lss_1tau_reference(numElectrons, numMuons, isCharge_pp, isCharge_mm, numBJets_medium);
+	  }
+	  if ( category != category_expected ) {
+	    std::cerr << "numElectrons = " << numElectrons << ", numMuons = " << numMuons << ","
+		      << " isCharge_pp = " << isCharge_pp << ", isCharge_mm = " << isCharge_mm << ", numBJets_medium = " << numBJets_medium << ":"
+		      << " category = " << category << ", expected " << category_expected << std::endl;
+	    ++numFailures;
+	    continue;
+	  }
+	  if ( category == kNoCategory_2lss_1tau ) continue;
+	  std::string name_expected = getCategoryName_2lss_1tau_reference(numElectrons, numMuons, isCharge_pp, numBJets_medium);
+	  int charge_expected = ( isCharge_pp ) ? +1 : -1;
+	  if ( getCategoryName_2lss_1tau(category) != name_expected ||
+	       getNumElectrons_2lss_1tau(category) != (int)numElectrons ||
+	       getNumMuons_2lss_1tau(category) != (int)numMuons ||
+	       getCharge_2lss_1tau(category) != charge_expected ) {
+	    std::cerr << "category = " << category << ": name = " << getCategoryName_2lss_1tau(category) << ","
+		      << " numElectrons = " << getNumElectrons_2lss_1tau(category) << ", numMuons = " << getNumMuons_2lss_1tau(category) << ","
+		      << " charge = " << getCharge_2lss_1tau(category) << ", expected name = " << name_expected << ","
+		      << " numElectrons = " << numElectrons << ", numMuons = " << numMuons << ", charge = " << charge_expected << std::endl;
+	    ++numFailures;
+	  }
+	}
+      }
+    }
+  }
+
+  if ( numFailures > 0 ) {
+    std::cerr << "<testCategories_2lss_1tau>: " << numFailures << " checks failed !!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "<testCategories_2lss_1tau>: all checks passed." << std::endl;
+  return EXIT_SUCCESS;
+}
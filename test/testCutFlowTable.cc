@@ -0,0 +1,148 @@
+#include "tthAnalysis/HiggsToTauTau/interface/CutFlowTable.h" // CutFlowTable
+
+#include <TRandom3.h> // TRandom3
+
+#include <iostream> // std::cout, std::cerr
+#include <sstream> // std::stringstream
+#include <string> // std::string
+#include <vector> // std::vector<>
+#include <map> // std::map<,>
+#include <cmath> // std::fabs
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE, std::atoi
+
+namespace
+{
+  /**
+   * @brief Spend CPU time proportional to given number of iterations, in order to simulate cuts that are expensive to compute
+   */
+  bool spendTime(int numIterations, bool passes)
+  {
+    volatile double sum = 0.;
+    for ( int idxIteration = 0; idxIteration < numIterations; ++idxIteration ) {
+      sum = sum + idxIteration*1.e-3;
+    }
+    return passes;
+  }
+
+  /**
+   * @brief Return position of each cut in given group, in the order of evaluation at the end of the job
+   *        (read from the output of CutFlowTable::write)
+   */
+  std::map<std::string, int> getPositions(const CutFlowTable& cutFlow, const std::string& group)
+  {
+    std::stringstream output;
+    cutFlow.write(output);
+    std::map<std::string, int> positions;
+    std::string line;
+    while ( std::getline(output, line) ) {
+      std::vector<std::string> fields;
+      std::stringstream line_stream(line);
+      std::string field;
+      while ( std::getline(line_stream, field, ';') ) {
+	fields.push_back(field);
+      }
+      if ( fields.size() >= 4 && fields[2] == group ) positions[fields[1]] = std::atoi(fields[3].data());
+    }
+    return positions;
+  }
+}
+
+/**
+ * @brief Apply a group of three independent cuts, which differ in rejection and CPU time, to random events
+ *        and check that the group passes the same events as the logical AND of the cuts,
+ *        while the order of evaluation is changed to decreasing rejection per unit of CPU time
+ * @param reorderInterval As passed to CutFlowTable::addCutGroup (0 = order of evaluation does not change)
+ * @return Number of failed checks
+ */
+int testCutGroup(unsigned reorderInterval)
+{
+  CutFlowTable cutFlow("test");
+  int idxCut_first = cutFlow.addCut("first cut");
+  int idxCutGroup = cutFlow.addCutGroup("group", reorderInterval);
+  double x, y, z;
+  // CV: cuts declared in the order opposite to the optimal order of evaluation
+  cutFlow.addCut(idxCutGroup, "expensive, loose", [&x]() { return spendTime(20000, x > 0.01); });
+  cutFlow.addCut(idxCutGroup, "medium, 50%", [&y]() { return spendTime(200, y > 0.5); });
+  cutFlow.addCut(idxCutGroup, "cheap, tight", [&z]() { return z > 0.9; });
+  int idxCut_last = cutFlow.addCut("last cut");
+
+  TRandom3 rnd(reorderInterval + 1);
+  const int numEvents = 20000;
+  int numPassed_first = 0;
+  int numPassed_group = 0;
+  double numPassed_group_weighted = 0.;
+  int numFailures = 0;
+  for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+    x = rnd.Uniform(1.);
+    y = rnd.Uniform(1.);
+    z = rnd.Uniform(1.);
+    double evtWeight = rnd.Uniform(0.5, 1.5);
+    cutFlow.startEvent();
+    // CV: do not count every tenth event, as done for events processed for systematic shifts other than the central value
+    cutFlow.setActive(idxEvent % 10 != 0);
+    if ( !cutFlow(idxCut_first, x < 0.95, evtWeight) ) continue;
+    if ( idxEvent % 10 != 0 ) ++numPassed_first;
+    bool passes_expected = x > 0.01 && y > 0.5 && z > 0.9;
+    bool passes = cutFlow.passesCutGroup(idxCutGroup, evtWeight);
+    if ( passes != passes_expected ) {
+      std::cerr << "reorderInterval = " << reorderInterval << ", event #" << idxEvent << ": group of cuts returns " << passes
+		<< ", expected " << passes_expected << std::endl;
+      ++numFailures;
+    }
+    if ( !passes ) continue;
+    if ( idxEvent % 10 != 0 ) {
+      ++numPassed_group;
+      numPassed_group_weighted += evtWeight;
+    }
+    cutFlow(idxCut_last, true, evtWeight);
+  }
+
+  if ( cutFlow.getNumPassed(idxCut_first) != numPassed_first ) {
+    std::cerr << "reorderInterval = " << reorderInterval << ": " << cutFlow.getNumPassed(idxCut_first) << " events pass first cut,"
+	      << " expected " << numPassed_first << std::endl;
+    ++numFailures;
+  }
+  if ( cutFlow.getNumPassed(idxCutGroup) != numPassed_group || cutFlow.getNumPassed(idxCut_last) != numPassed_group ||
+       std::fabs(cutFlow.getNumPassed_weighted(idxCutGroup) - numPassed_group_weighted) > 1.e-6*numPassed_group_weighted ) {
+    std::cerr << "reorderInterval = " << reorderInterval << ": " << cutFlow.getNumPassed(idxCutGroup)
+	      << " (weighted = " << cutFlow.getNumPassed_weighted(idxCutGroup) << ") events pass group of cuts,"
+	      << " expected " << numPassed_group << " (weighted = " << numPassed_group_weighted << ")" << std::endl;
+    ++numFailures;
+  }
+
+  std::map<std::string, int> positions = getPositions(cutFlow, "group");
+  std::map<std::string, int> positions_expected;
+  if ( reorderInterval > 0 ) {
+    positions_expected["cheap, tight"] = 0;
+    positions_expected["medium, 50%"] = 1;
+    positions_expected["expensive, loose"] = 2;
+  } else {
+    positions_expected["expensive, loose"] = 0;
+    positions_expected["medium, 50%"] = 1;
+    positions_expected["cheap, tight"] = 2;
+  }
+  if ( positions != positions_expected ) {
+    std::cerr << "reorderInterval = " << reorderInterval << ": cuts are evaluated in wrong order:" << std::endl;
+    cutFlow.print(std::cerr);
+    ++numFailures;
+  }
+  return numFailures;
+}
+
+/**
+ * @brief Check that the counts of CutFlowTable match the events passing the cuts
+ *        and that groups of cuts are reordered by rejection per unit of CPU time without changing the events that pass
+ */
+int main(int argc, char* argv[])
+{
+  int numFailures = 0;
+  numFailures += testCutGroup(0);
+  numFailures += testCutGroup(100);
+
+  if ( numFailures > 0 ) {
+    std::cerr << "<testCutFlowTable>: " << numFailures << " checks failed !!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "<testCutFlowTable>: all checks passed." << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,193 @@
+#include "tthAnalysis/HiggsToTauTau/interface/HistogramAccumulator.h" // HistogramAccumulator
+#include "tthAnalysis/HiggsToTauTau/interface/histogramAuxFunctions.h" // fill, fillWithOverFlow, fill2d, fillWithOverFlow2d
+
+#include <TH1D.h> // TH1D
+#include <TH2D.h> // TH2D
+#include <TRandom3.h> // TRandom3
+#include <TMath.h> // TMath::QuietNaN
+#include <TString.h> // Form
+
+#include <iostream> // std::cout, std::cerr
+#include <string> // std::string
+#include <vector> // std::vector<>
+#include <cmath> // std::fabs
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+
+/**
+ * @brief Compare content, error and number of entries of all cells (including underflow and overflow) of two histograms;
+ *        the errors are compared with a tolerance, as HistogramAccumulator adds the squared weights before taking the square root
+ * @return Number of cells that differ
+ */
+int compareHistograms(const std::string& label, const TH1* histogram, const TH1* histogram_reference)
+{
+  int numMismatches = 0;
+  for ( int bin = 0; bin < histogram_reference->GetNcells(); ++bin ) {
+    double binContent = histogram->GetBinContent(bin);
+    double binContent_reference = histogram_reference->GetBinContent(bin);
+    double binError = histogram->GetBinError(bin);
+    double binError_reference = histogram_reference->GetBinError(bin);
+    if ( std::fabs(binContent - binContent_reference) > 1.e-9*(1. + std::fabs(binContent_reference)) ||
+	 std::fabs(binError - binError_reference) > 1.e-9*(1. + binError_reference) ) {
+      std::cerr << label << ": bin #" << bin << " = " << binContent << " +/- " << binError
+		<< ", expected " << binContent_reference << " +/- " << binError_reference << std::endl;
+      ++numMismatches;
+    }
+  }
+  if ( histogram->GetEntries() != histogram_reference->GetEntries() ) {
+    std::cerr << label << ": entries = " << histogram->GetEntries() << ", expected " << histogram_reference->GetEntries() << std::endl;
+    ++numMismatches;
+  }
+  return numMismatches;
+}
+
+/**
+ * @brief Values to fill: the bin edges, values just below and above the edges, underflow, overflow, NaN and random values within the range
+ */
+std::vector<double> getTestValues(const TAxis* axis, TRandom3& rnd)
+{
+  std::vector<double> values;
+  for ( int bin = 1; bin <= axis->GetNbins() + 1; ++bin ) {
+    double binEdge = axis->GetBinLowEdge(bin);
+    values.push_back(binEdge);
+    values.push_back(binEdge - 1.e-9*(1. + std::fabs(binEdge)));
+    values.push_back(binEdge + 1.e-9*(1. + std::fabs(binEdge)));
+  }
+  values.push_back(axis->GetXmin() - 1.e+3);
+  values.push_back(axis->GetXmax() + 1.e+3);
+  values.push_back(TMath::QuietNaN());
+  for ( int idxValue = 0; idxValue < 1000; ++idxValue ) {
+    values.push_back(rnd.Uniform(axis->GetXmin(), axis->GetXmax()));
+  }
+  return values;
+}
+
+/**
+ * @brief Fill one-dimensional histogram event by event by the functions defined in histogramAuxFunctions.h
+ *        and by HistogramAccumulator, flushing the accumulator twice, and compare the results
+ */
+int test1d(const std::string& label, TH1* histogram_reference, TH1* histogram, bool withOverFlow, TRandom3& rnd)
+{
+  histogram_reference->Sumw2();
+  histogram->Sumw2();
+  // CV: the accumulated sums are added to the content of the histogram, so start with a histogram that has been filled before
+  fill(histogram_reference, histogram_reference->GetXaxis()->GetBinCenter(1), 2., 0.);
+  fill(histogram, histogram->GetXaxis()->GetBinCenter(1), 2., 0.);
+  HistogramAccumulator accumulator(histogram);
+  std::vector<double> values = getTestValues(histogram->GetXaxis(), rnd);
+  int numMismatches = 0;
+  for ( int idxFlush = 0; idxFlush < 2; ++idxFlush ) {
+    for ( std::vector<double>::const_iterator value = values.begin();
+	  value != values.end(); ++value ) {
+      double evtWeight = rnd.Uniform(-0.5, 2.);
+      double evtWeightErr = rnd.Uniform(0., 0.1);
+      if ( withOverFlow ) {
+	fillWithOverFlow(histogram_reference, *value, evtWeight, evtWeightErr);
+	accumulator.fillWithOverFlow(*value, evtWeight, evtWeightErr);
+      } else {
+	fill(histogram_reference, *value, evtWeight, evtWeightErr);
+	accumulator.fill(*value, evtWeight, evtWeightErr);
+      }
+    }
+    accumulator.flush();
+    numMismatches += compareHistograms(Form("%s (flush #%i)", label.data(), idxFlush), histogram, histogram_reference);
+  }
+  return numMismatches;
+}
+
+int test2d(const std::string& label, TH2* histogram_reference, TH2* histogram, bool withOverFlow, TRandom3& rnd)
+{
+  histogram_reference->Sumw2();
+  histogram->Sumw2();
+  HistogramAccumulator accumulator(histogram);
+  std::vector<double> xValues = getTestValues(histogram->GetXaxis(), rnd);
+  std::vector<double> yValues = getTestValues(histogram->GetYaxis(), rnd);
+  for ( size_t idxValue = 0; idxValue < xValues.size(); ++idxValue ) {
+    double x = xValues[idxValue];
+    double y = yValues[(7*idxValue) % yValues.size()];
+    double evtWeight = rnd.Uniform(-0.5, 2.);
+    double evtWeightErr = rnd.Uniform(0., 0.1);
+    if ( withOverFlow ) {
+      fillWithOverFlow2d(histogram_reference, x, y, evtWeight, evtWeightErr);
+      accumulator.fillWithOverFlow2d(x, y, evtWeight, evtWeightErr);
+    } else {
+      fill2d(histogram_reference, x, y, evtWeight, evtWeightErr);
+      accumulator.fill2d(x, y, evtWeight, evtWeightErr);
+    }
+  }
+  accumulator.flush();
+  return compareHistograms(label, histogram, histogram_reference);
+}
+
+/**
+ * @brief Fill histograms for two systematic shifts with the weight of each shift given separately,
+ *        including events for which the weight of the first shift is zero
+ */
+int testShifts(TRandom3& rnd)
+{
+  std::vector<TH1*> histograms_reference;
+  std::vector<TH1*> histograms;
+  for ( int idxShift = 0; idxShift < 2; ++idxShift ) {
+    histograms_reference.push_back(new TH1D(Form("shift%i_reference", idxShift), "", 20, -1., +1.));
+    histograms_reference.back()->Sumw2();
+    histograms.push_back(new TH1D(Form("shift%i", idxShift), "", 20, -1., +1.));
+    histograms.back()->Sumw2();
+  }
+  double weights[2];
+  HistogramAccumulator accumulator(histograms, weights);
+  for ( int idxEvent = 0; idxEvent < 1000; ++idxEvent ) {
+    weights[0] = ( (idxEvent % 3) == 0 ) ? 0. : rnd.Uniform(0.5, 1.5);
+    weights[1] = rnd.Uniform(0.5, 1.5);
+    double x = rnd.Uniform(-1.2, +1.2);
+    double evtWeight = rnd.Uniform(0., 2.);
+    for ( int idxShift = 0; idxShift < 2; ++idxShift ) {
+      fillWithOverFlow(histograms_reference[idxShift], x, evtWeight*weights[idxShift], 0.);
+    }
+    accumulator.fillWithOverFlow(x, evtWeight, 0.);
+  }
+  accumulator.flush();
+  int numMismatches = 0;
+  for ( int idxShift = 0; idxShift < 2; ++idxShift ) {
+    numMismatches += compareHistograms(Form("shift #%i", idxShift), histograms[idxShift], histograms_reference[idxShift]);
+    delete histograms_reference[idxShift];
+    delete histograms[idxShift];
+  }
+  return numMismatches;
+}
+
+/**
+ * @brief Check that HistogramAccumulator gives the same bin contents, bin errors and number of entries
+ *        as filling the histograms event by event by the functions defined in histogramAuxFunctions.h
+ */
+int main(int argc, char* argv[])
+{
+  TH1::AddDirectory(false);
+  TRandom3 rnd(12345);
+
+  int numMismatches = 0;
+
+  double binning[] = { -2.5, -1.479, -0.8, 0., 0.3, 0.8, 1.479, 2.5 };
+  for ( int withOverFlow = 0; withOverFlow <= 1; ++withOverFlow ) {
+    std::string label_fill = ( withOverFlow ) ? "fillWithOverFlow" : "fill";
+
+    TH1D histogram1d_reference("histogram1d_reference", "", 10, 0., 100.);
+    TH1D histogram1d("histogram1d", "", 10, 0., 100.);
+    numMismatches += test1d("1d, bins of equal width, " + label_fill, &histogram1d_reference, &histogram1d, withOverFlow, rnd);
+
+    TH1D histogram1d_variable_reference("histogram1d_variable_reference", "", 7, binning);
+    TH1D histogram1d_variable("histogram1d_variable", "", 7, binning);
+    numMismatches += test1d("1d, bins of variable width, " + label_fill, &histogram1d_variable_reference, &histogram1d_variable, withOverFlow, rnd);
+
+    TH2D histogram2d_reference("histogram2d_reference", "", 10, 0., 100., 7, binning);
+    TH2D histogram2d("histogram2d", "", 10, 0., 100., 7, binning);
+    numMismatches += test2d("2d, " + label_fill, &histogram2d_reference, &histogram2d, withOverFlow, rnd);
+  }
+
+  numMismatches += testShifts(rnd);
+
+  if ( numMismatches > 0 ) {
+    std::cerr << "<testHistogramAccumulator>: " << numMismatches << " mismatches found !!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "<testHistogramAccumulator>: all checks passed." << std::endl;
+  return EXIT_SUCCESS;
+}
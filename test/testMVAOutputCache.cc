@@ -0,0 +1,206 @@
+#include "FWCore/ParameterSet/interface/FileInPath.h" // edm::FileInPath
+#include "FWCore/Utilities/interface/Exception.h" // cms::Exception
+
+#include "tthAnalysis/HiggsToTauTau/interface/MVAOutputCache.h" // MVAOutputCache, getMVAOutputCacheTag
+#include "tthAnalysis/HiggsToTauTau/interface/compiledBDTs.h" // computeFileChecksum
+
+#include <iostream> // std::cout, std::cerr
+#include <fstream> // std::ifstream, std::ofstream, std::fstream
+#include <sstream> // std::ostringstream
+#include <string> // std::string
+#include <vector> // std::vector<>
+#include <iterator> // std::istreambuf_iterator<>
+#include <cstdio> // std::remove
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+
+typedef std::vector<std::string> vstring;
+
+namespace
+{
+  const int numInputs = 3;
+  const int numOutputs = 2;
+  const int numEvents = 100;
+
+  void getInputs(int idxEvent, Float_t* mvaInputs)
+  {
+    for ( int idxInput = 0; idxInput < numInputs; ++idxInput ) {
+      mvaInputs[idxInput] = 0.5*idxEvent + idxInput;
+    }
+  }
+
+  void getOutputs(int idxEvent, double* mvaOutputs)
+  {
+    for ( int idxOutput = 0; idxOutput < numOutputs; ++idxOutput ) {
+      mvaOutputs[idxOutput] = 1.e-3*idxEvent - idxOutput;
+    }
+  }
+
+  std::string toHex(unsigned long long checksum)
+  {
+    std::ostringstream checksum_hex;
+    checksum_hex << std::hex << checksum;
+    return checksum_hex.str();
+  }
+
+  /**
+   * @brief Copy file, changing the byte at given position
+   */
+  void copyModifiedFile(const std::string& inputFileName, const std::string& outputFileName, std::streamoff position)
+  {
+    std::ifstream inputFile(inputFileName.data(), std::ios::in | std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
+    if ( !(inputFile.good() || inputFile.eof()) || position >= (std::streamoff)content.size() )
+      throw cms::Exception("testMVAOutputCache")
+	<< "Failed to read file = " << inputFileName << " !!\n";
+    content[position] = ( content[position] == ' ' ) ? '\t' : ' ';
+    std::ofstream outputFile(outputFileName.data(), std::ios::out | std::ios::binary | std::ios::trunc);
+    outputFile.write(content.data(), content.size());
+  }
+
+  /**
+   * @brief Count the events for which the outputs read back from the sidecar file are missing or differ from the outputs written
+   */
+  int checkEntries(const std::string& label, MVAOutputCache& cache, bool isExpected)
+  {
+    int numFailures = 0;
+    Float_t mvaInputs[numInputs];
+    double mvaOutputs[numOutputs];
+    for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+      getInputs(idxEvent, mvaInputs);
+      getOutputs(idxEvent, mvaOutputs);
+      const double* mvaOutputs_cached = cache.find(1, 1, idxEvent, mvaInputs);
+      bool isMatch = ( mvaOutputs_cached != 0 );
+      for ( int idxOutput = 0; idxOutput < numOutputs && isMatch; ++idxOutput ) {
+	if ( mvaOutputs_cached[idxOutput] != mvaOutputs[idxOutput] ) isMatch = false;
+      }
+      if ( isMatch != isExpected ) ++numFailures;
+      // CV: input values that differ from the values written must not return the cached outputs
+      mvaInputs[numInputs - 1] += 1.;
+      if ( cache.find(1, 1, idxEvent, mvaInputs) ) ++numFailures;
+    }
+    if ( numFailures > 0 ) {
+      std::cerr << label << ": " << numFailures << " entries differ from the entries written to the sidecar file !!" << std::endl;
+    }
+    return numFailures;
+  }
+
+  /**
+   * @brief Check that reading the sidecar file throws an exception
+   */
+  int checkCorruptedFile(const std::string& label, const std::string& tag, const std::string& fileName)
+  {
+    MVAOutputCache cache(tag, numInputs, numOutputs, true);
+    try {
+      cache.read(fileName);
+    } catch ( const cms::Exception& ) {
+      return 0;
+    }
+    std::cerr << label << ": no exception thrown when reading corrupted file !!" << std::endl;
+    return 1;
+  }
+}
+
+/**
+ * @brief Write MVA outputs to a sidecar file and check that they are read back only by a cache with the same tag,
+ *        i.e. that a file written for MVAs whose weight files have changed since (checksum differs) is ignored
+ */
+int main(int argc, char* argv[])
+{
+  vstring mvaFileNames = {
+    "tthAnalysis/HiggsToTauTau/data/2lss_ttV_BDTG.weights.xml",
+    "tthAnalysis/HiggsToTauTau/data/2lss_ttbar_BDTG.weights.xml"
+  };
+  vstring mvaInputLayout = { "input1", "input2", "input3" };
+  std::string tag = getMVAOutputCacheTag(mvaFileNames, mvaInputLayout);
+
+  const std::string sidecarFileName = "testMVAOutputCache.bin";
+  const std::string corruptedFileName = "testMVAOutputCache_corrupted.bin";
+  const std::string modifiedMVAFileName = "testMVAOutputCache_BDTG.weights.xml";
+
+  int numFailures = 0;
+
+//--- write sidecar file
+  MVAOutputCache cache_output(tag, numInputs, numOutputs, true);
+  Float_t mvaInputs[numInputs];
+  double mvaOutputs[numOutputs];
+  for ( int idxEvent = 0; idxEvent < numEvents; ++idxEvent ) {
+    getInputs(idxEvent, mvaInputs);
+    getOutputs(idxEvent, mvaOutputs);
+    cache_output.insert(1, 1, idxEvent, mvaInputs, mvaOutputs);
+  }
+  cache_output.write(sidecarFileName);
+
+//--- read sidecar file back with the same tag
+  MVAOutputCache cache_sameTag(tag, numInputs, numOutputs, true);
+  if ( !cache_sameTag.read(sidecarFileName) || cache_sameTag.size() != numEvents ) {
+    std::cerr << "same tag: failed to read sidecar file !!" << std::endl;
+    ++numFailures;
+  }
+  numFailures += checkEntries("same tag", cache_sameTag, true);
+
+//--- read sidecar file with the tag computed after changing one byte of the first weight file
+  std::string mvaFileName_full = edm::FileInPath(mvaFileNames[0]).fullPath();
+  copyModifiedFile(mvaFileName_full, modifiedMVAFileName, 100);
+  std::string checksum = toHex(computeFileChecksum(mvaFileName_full));
+  std::string checksum_modified = toHex(computeFileChecksum(modifiedMVAFileName));
+  std::string::size_type checksum_position = tag.find(mvaFileNames[0] + ":" + checksum + ";");
+  if ( checksum == checksum_modified || checksum_position != 0 ) {
+    std::cerr << "modified weight file: checksum = " << checksum_modified << " not different from checksum = " << checksum
+	      << " or not found in tag = " << tag << " !!" << std::endl;
+    ++numFailures;
+  } else {
+    std::string tag_modified = tag;
+    tag_modified.replace(mvaFileNames[0].size() + 1, checksum.size(), checksum_modified);
+    MVAOutputCache cache_modified(tag_modified, numInputs, numOutputs, true);
+    if ( cache_modified.read(sidecarFileName) || cache_modified.size() != 0 ) {
+      std::cerr << "modified weight file: sidecar file not rejected !!" << std::endl;
+      ++numFailures;
+    }
+    numFailures += checkEntries("modified weight file", cache_modified, false);
+  }
+
+//--- read sidecar file with a different layout of the input values
+  vstring mvaInputLayout_reversed(mvaInputLayout.rbegin(), mvaInputLayout.rend());
+  MVAOutputCache cache_layout(getMVAOutputCacheTag(mvaFileNames, mvaInputLayout_reversed), numInputs, numOutputs, true);
+  if ( cache_layout.read(sidecarFileName) || cache_layout.size() != 0 ) {
+    std::cerr << "different input layout: sidecar file not rejected !!" << std::endl;
+    ++numFailures;
+  }
+
+//--- read sidecar file with a different number of input values or outputs
+  MVAOutputCache cache_numInputs(tag, numInputs + 1, numOutputs, true);
+  MVAOutputCache cache_numOutputs(tag, numInputs, numOutputs + 1, true);
+  if ( cache_numInputs.read(sidecarFileName) || cache_numOutputs.read(sidecarFileName) ) {
+    std::cerr << "different number of input values or outputs: sidecar file not rejected !!" << std::endl;
+    ++numFailures;
+  }
+
+//--- read file that does not exist
+  MVAOutputCache cache_missing(tag, numInputs, numOutputs, true);
+  if ( cache_missing.read("testMVAOutputCache_missing.bin") ) {
+    std::cerr << "missing file: read returned true !!" << std::endl;
+    ++numFailures;
+  }
+
+//--- read corrupted files: wrong magic string and truncated file
+  std::ifstream sidecarFile(sidecarFileName.data(), std::ios::in | std::ios::binary);
+  std::string content((std::istreambuf_iterator<char>(sidecarFile)), std::istreambuf_iterator<char>());
+  sidecarFile.close();
+  std::string content_corrupted = content;
+  content_corrupted[0] = 'X';
+  std::ofstream(corruptedFileName.data(), std::ios::out | std::ios::binary | std::ios::trunc).write(content_corrupted.data(), content_corrupted.size());
+  numFailures += checkCorruptedFile("wrong magic string", tag, corruptedFileName);
+  std::ofstream(corruptedFileName.data(), std::ios::out | std::ios::binary | std::ios::trunc).write(content.data(), content.size() - 5);
+  numFailures += checkCorruptedFile("truncated file", tag, corruptedFileName);
+
+  std::remove(sidecarFileName.data());
+  std::remove(corruptedFileName.data());
+  std::remove(modifiedMVAFileName.data());
+
+  if ( numFailures > 0 ) {
+    std::cerr << "<testMVAOutputCache>: " << numFailures << " checks failed !!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "<testMVAOutputCache>: all checks passed." << std::endl;
+  return EXIT_SUCCESS;
+}
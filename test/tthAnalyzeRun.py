@@ -1,4 +1,4 @@
-import json, os, codecs, stat, logging, sys, jinja2, subprocess, getpass, time
+import json, os, codecs, stat, logging, sys, jinja2, subprocess, getpass, time, bisect
 import tthAnalyzeSamples
 
 LUMI = 2260. # 1/pb
@@ -24,12 +24,15 @@ class analyzeConfig:
     charge_selection: either `OS` or `SS` (opposite-sign or same-sign)
     lepton_selection: either `Tight`, `Loose` or `Fakeable`
     max_files_per_job: maximum number of input root files (Ntuples) are allowed to chain together per job
+    max_events_per_job: if positive, split the input into jobs of about this many events (aligned to cluster boundaries)
+                        instead of splitting by `max_files_per_job`
     use_lumi: if True, use lumiSection aka event weight ( = xsection * luminosity / nof events), otherwise uses plain event count
     debug: if True, checks each input root file (Ntuple) before creating the python configuration files
     running_method: either `sbatch` (uses SLURM) or `Makefile`
     nof_parallel_jobs: number of jobs that can be run in parallel (matters only if `running_method` is set to `Makefile`)
     poll_interval: the interval of checking whether all sbatch jobs are completed (matters only if `running_method` is set to `sbatch`)
     prep_dcard_exec: executable name for preparing the datacards
+    scan_exec: executable name for scanning the number of entries and cluster boundaries of the input files
     histogram_to_fit: what histograms are filtered in datacard preparation
   
   Other:
@@ -46,7 +49,8 @@ class analyzeConfig:
   """
   def __init__(self, output_dir, exec_name, charge_selection, lepton_selection, data_selection,
                max_files_per_job, use_lumi, debug, running_method, nof_parallel_jobs,
-               poll_interval, prep_dcard_exec, histogram_to_fit):
+               poll_interval, prep_dcard_exec, histogram_to_fit,
+               max_events_per_job = -1, scan_exec = "scanNtupleClusters"):
 
     assert(exec_name in ["analyze_2lss_1tau", "analyze_2los_1tau", "analyze_1l_2tau", "analyze_charge_flip"]), "Invalid exec name: %s" % exec_name
     assert(charge_selection in ["OS", "SS"]),                                           "Invalid charge selection: %s" % charge_selection
@@ -60,6 +64,7 @@ class analyzeConfig:
     self.lepton_selection = lepton_selection
     self.data_selection = data_selection
     self.max_files_per_job = max_files_per_job
+    self.max_events_per_job = max_events_per_job
     self.use_lumi = use_lumi
     self.debug = debug
     self.running_method = running_method
@@ -67,6 +72,7 @@ class analyzeConfig:
     self.poll_interval = poll_interval
     self.prep_dcard_exec = prep_dcard_exec
     self.histogram_to_fit = histogram_to_fit
+    self.scan_exec = scan_exec
     
     self.is_sbatch = False
     self.is_makefile = False
@@ -117,7 +123,8 @@ def add_chmodX(fullpath):
   st = os.stat(fullpath)
   os.chmod(fullpath, st.st_mode | stat.S_IEXEC)
 
-def create_config(root_filenames, output_file, category_name, is_mc, lumi_scale, cfg, idx):
+def create_config(root_filenames, output_file, category_name, is_mc, lumi_scale, cfg, idx,
+                  first_entry = 0, last_entry = -1):
   """Fill python configuration file for the job exectuable (analysis code)
 
   Args:
@@ -128,6 +135,8 @@ def create_config(root_filenames, output_file, category_name, is_mc, lumi_scale,
     lumi_scale: event weight ( = xsection * luminosity / nof events)
     cfg: configuration instance that contains paths; see `analyzeConfig`
     idx: job index
+    first_entry: index of the first entry processed by the job (counting from the start of the first input file)
+    last_entry: index of the first entry not processed by the job any more; -1 means all entries
 
   Returns:
     Filled template
@@ -139,7 +148,9 @@ process = cms.PSet()
 process.fwliteInput = cms.PSet(
     fileNames = cms.vstring('{{ fileNames|join("',\n                            '") }}'),
     maxEvents = cms.int32(-1),
-    outputEvery = cms.uint32(100000)
+    outputEvery = cms.uint32(100000),
+    firstEntry = cms.int64({{ firstEntry }}),
+    lastEntry = cms.int64({{ lastEntry }})
 )
 
 process.fwliteOutput = cms.PSet(
@@ -185,7 +196,37 @@ process.{{ execName }} = cms.PSet(
     leptonSelection = cfg.lepton_selection,
     isMC = False, # NOTE: temporary fix; previously: is_mc
     lumiScale = lumi_scale,
-    idx = idx)
+    idx = idx,
+    firstEntry = first_entry,
+    lastEntry = last_entry)
+
+def create_scan_cfg(root_filenames, output_file):
+  """Fill python configuration file for scanning the number of entries and cluster boundaries of the input files
+
+  Args:
+    root_filenames: list of full path to the input root files (Ntuples)
+    output_file: full path to the JSON file the scan results are written to
+
+  Returns:
+    Filled template
+  """
+  cfg_file = """import FWCore.ParameterSet.Config as cms
+
+process = cms.PSet()
+process.fwliteInput = cms.PSet(
+    fileNames = cms.vstring('{{ fileNames|join("',\n                            '") }}'),
+    maxEvents = cms.int32(-1),
+    outputEvery = cms.uint32(100000)
+)
+
+process.scanNtupleClusters = cms.PSet(
+    treeName = cms.string('tree'),
+    outputFileName = cms.string('{{ outputFile }}')
+)
+"""
+  return jinja2.Template(cfg_file).render(
+    fileNames = root_filenames,
+    outputFile = output_file)
 
 def create_job(exec_name, py_cfg):
   """Fills bash job template (run by either sbatch or make)
@@ -357,6 +398,58 @@ def generate_file_ids(nof_files, max_files_per_job):
   job_ids = [range(file_limits[i], file_limits[i + 1]) for i in range(len(file_limits) - 1)]
   return job_ids
 
+def generate_entry_ranges(scan_result, max_events_per_job):
+  """Splits the input files into jobs of similar number of events
+
+    The job boundaries are aligned to the cluster boundaries reported by the scan executable,
+    so that each job processes at least one cluster and no cluster is read by more than one job.
+
+  Args:
+    scan_result: content of the JSON file written by the scan executable
+    max_events_per_job: Maximum number of events a job should process (unless a single cluster is larger)
+
+  Returns:
+    List of tuples (indices of input files, first entry, last entry) for each job,
+    where the entry indices count from the start of the first input file of the job
+  """
+  file_offsets = []
+  cluster_boundaries = []
+  nof_entries = 0
+  for input_file in scan_result["files"]:
+    file_offsets.append(nof_entries)
+    cluster_boundaries.extend([nof_entries + cluster for cluster in input_file["clusters"]])
+    nof_entries += input_file["entries"]
+  cluster_boundaries.append(nof_entries)
+
+  jobs = []
+  idx_start = 0
+  while idx_start < len(cluster_boundaries) - 1:
+    first_entry = cluster_boundaries[idx_start]
+    idx_end = max(bisect.bisect_right(cluster_boundaries, first_entry + max_events_per_job) - 1, idx_start + 1)
+    last_entry = cluster_boundaries[idx_end]
+    first_file = bisect.bisect_right(file_offsets, first_entry) - 1
+    last_file = bisect.bisect_left(file_offsets, last_entry) - 1
+    jobs.append((range(first_file, last_file + 1), first_entry - file_offsets[first_file], last_entry - file_offsets[first_file]))
+    idx_start = idx_end
+  return jobs
+
+def scan_input_files(cfg, root_filenames, scan_dir):
+  """Runs the scan executable on the input files
+
+  Args:
+    cfg: configuration instance that contains paths; see `analyzeConfig`
+    root_filenames: list of full path to the input root files (Ntuples)
+    scan_dir: directory where the configuration file and the results of the scan are stored
+
+  Returns:
+    Content of the JSON file written by the scan executable
+  """
+  scan_outputfile = os.path.join(scan_dir, "scanNtupleClusters.json")
+  scan_cfg_fullpath = os.path.join(scan_dir, "scanNtupleClusters_cfg.py")
+  with codecs.open(scan_cfg_fullpath, "w", "utf-8") as f: f.write(create_scan_cfg(root_filenames, scan_outputfile))
+  subprocess.check_call([cfg.scan_exec, scan_cfg_fullpath], stdout = open(os.devnull, "w"))
+  with open(scan_outputfile, "r") as f: return json.load(f)
+
 def generate_input_list(job_ids, secondary_files, primary_store, secondary_store, debug = False):
   """Generates input file list for each job
 
@@ -417,19 +510,27 @@ def create_setup(cfg):
       else:
         secondary_store = store_dir["path"]
         secondary_files = map(lambda x: int(x), store_dir["selection"].split(","))
-    job_ids = generate_file_ids(nof_files, cfg.max_files_per_job)
+    if cfg.max_events_per_job > 0:
+      input_list = generate_input_list(range(1, nof_files + 1), secondary_files,
+                                       primary_store, secondary_store, cfg.debug)
+      scan_result = scan_input_files(cfg, input_list, cfg_outputdir)
+      jobs = [([input_list[file_id] for file_id in file_ids], first_entry, last_entry) \
+        for file_ids, first_entry, last_entry in generate_entry_ranges(scan_result, cfg.max_events_per_job)]
+    else:
+      jobs = [(generate_input_list(file_ids, secondary_files, primary_store, secondary_store, cfg.debug), 0, -1) \
+        for file_ids in generate_file_ids(nof_files, cfg.max_files_per_job)]
 
     lumi_scale = 1. if not (cfg.use_lumi and is_mc) else v["xsection"] * LUMI / v["nof_events"]
-    for idx in range(len(job_ids)):
+    for idx in range(len(jobs)):
       cfg_basename = "_".join([process_name, str(idx)])
       cfg_basenames.append(cfg_basename)
 
-      cfg_filelist = generate_input_list(job_ids[idx], secondary_files,
-                                         primary_store, secondary_store, cfg.debug)
+      cfg_filelist, first_entry, last_entry = jobs[idx]
       cfg_outputfile = "_".join([process_name, cfg.charge_selection, cfg.lepton_selection, str(idx)]) + ".root"
       cfg_outputfile_fullpath = os.path.join(histogram_outputdir, cfg_outputfile)
 
-      cfg_contents = create_config(cfg_filelist, cfg_outputfile_fullpath, category_name, is_mc, lumi_scale, cfg, idx)
+      cfg_contents = create_config(cfg_filelist, cfg_outputfile_fullpath, category_name, is_mc, lumi_scale, cfg, idx,
+                                   first_entry, last_entry)
       cfg_file_fullpath = os.path.join(cfg_outputdir,  cfg_basename + ".py")
       with codecs.open(cfg_file_fullpath, "w", "utf-8") as f: f.write(cfg_contents)
 
@@ -529,6 +630,7 @@ if __name__ == '__main__':
                       lepton_selection = "Tight",
                       data_selection = "regular",
                       max_files_per_job = 30,
+                      max_events_per_job = -1,
                       use_lumi = True,
                       debug = False,
                       running_method = "sbatch",